@@ -0,0 +1,147 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "allocation_tracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+thread_local allocation_phase current_allocation_phase =
+        allocation_phase::other;
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+std::atomic<bool> allocation_tracking_enabled{false};
+std::array<std::atomic<std::int64_t>, allocation_phases_count>
+        allocation_counts{};
+std::array<std::atomic<std::int64_t>, allocation_phases_count>
+        allocated_bytes{};
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+const char *get_allocation_phase_name(const allocation_phase phase)
+{
+    switch (phase)
+    {
+    case allocation_phase::other:
+        return "other";
+    case allocation_phase::tokenize:
+        return "tokenize";
+    case allocation_phase::parse_expression:
+        return "parse expression";
+    case allocation_phase::decode_proof:
+        return "decode proof";
+    case allocation_phase::unpack:
+        return "unpack";
+    case allocation_phase::write:
+        return "write";
+    }
+    return "unknown";
+}
+/*----------------------------------------------------------------------------*/
+void enable_allocation_tracking()
+{
+    allocation_tracking_enabled = true;
+}
+/*----------------------------------------------------------------------------*/
+allocation_report get_allocation_report()
+{
+    allocation_report result;
+    for (index i = 0; i < allocation_phases_count; ++i)
+        result[i] =
+                allocation_statistics{
+                    allocation_counts[i].load(std::memory_order_relaxed),
+                    allocated_bytes[i].load(std::memory_order_relaxed)};
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+allocation_statistics get_total_allocations()
+{
+    allocation_statistics result;
+    for (const auto &statistics : get_allocation_report())
+    {
+        result.count += statistics.count;
+        result.bytes += statistics.bytes;
+    }
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+void write_allocation_report(
+        const allocation_report &report,
+        std::ostream &output_stream)
+{
+    output_stream << "allocations by phase:\n";
+    for (index i = 0; i < allocation_phases_count; ++i)
+        output_stream
+                << "  " << std::setw(18) << std::left
+                << get_allocation_phase_name(allocation_phase(i))
+                << std::right
+                << std::setw(12) << report[i].count << " allocations"
+                << std::setw(16) << report[i].bytes << " bytes\n";
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
+/*----------------------------------------------------------------------------*/
+#if defined(__GNUC__) && !defined(__clang__)
+/* Replacement operators pair malloc and free themselves. */
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+/*----------------------------------------------------------------------------*/
+void *operator new(const std::size_t size)
+{
+    using namespace metamath_playground;
+    if (allocation_tracking_enabled.load(std::memory_order_relaxed))
+    {
+        const auto phase = static_cast<index>(current_allocation_phase);
+        allocation_counts[phase].fetch_add(1, std::memory_order_relaxed);
+        allocated_bytes[phase].fetch_add(size, std::memory_order_relaxed);
+    }
+    if (void *const result = std::malloc(size == 0 ? 1 : size))
+        return result;
+    throw std::bad_alloc();
+}
+/*----------------------------------------------------------------------------*/
+void *operator new[](const std::size_t size)
+{
+    return operator new(size);
+}
+/*----------------------------------------------------------------------------*/
+void operator delete(void *const pointer) noexcept
+{
+    std::free(pointer);
+}
+/*----------------------------------------------------------------------------*/
+void operator delete[](void *const pointer) noexcept
+{
+    std::free(pointer);
+}
+/*----------------------------------------------------------------------------*/
+void operator delete(void *const pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+/*----------------------------------------------------------------------------*/
+void operator delete[](void *const pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
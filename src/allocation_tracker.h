@@ -0,0 +1,95 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ALLOCATION_TRACKER_H
+#define ALLOCATION_TRACKER_H
+
+#include "typed_indices.h"
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+
+namespace metamath_playground {
+
+/* Opt-in accounting of heap allocations. The library replaces global
+ * operator new; once tracking is enabled each allocation is attributed to
+ * the phase active in the allocating thread. Disabled tracking costs a relaxed
+ * atomic load per allocation. */
+
+enum class allocation_phase : std::uint8_t
+{
+    other,
+    tokenize,
+    parse_expression,
+    decode_proof,
+    unpack,
+    write
+};
+
+const index allocation_phases_count = 6;
+
+const char *get_allocation_phase_name(allocation_phase phase);
+
+struct allocation_statistics
+{
+    std::int64_t count = 0;
+    std::int64_t bytes = 0;
+};
+
+using allocation_report =
+        std::array<allocation_statistics, allocation_phases_count>;
+
+extern thread_local allocation_phase current_allocation_phase;
+
+/* Sets the phase of the current thread for its lifetime. Nested phases take
+ * precedence. */
+class allocation_phase_scope
+{
+private:
+    allocation_phase previous;
+
+public:
+    explicit allocation_phase_scope(const allocation_phase phase):
+        previous(current_allocation_phase)
+    {
+        current_allocation_phase = phase;
+    }
+
+    allocation_phase_scope(const allocation_phase_scope &) = delete;
+    allocation_phase_scope &operator=(const allocation_phase_scope &) =
+            delete;
+
+    ~allocation_phase_scope()
+    {
+        current_allocation_phase = previous;
+    }
+};
+
+void enable_allocation_tracking();
+/* Allocations counted so far, of all threads. */
+allocation_report get_allocation_report();
+allocation_statistics get_total_allocations();
+void write_allocation_report(
+        const allocation_report &report,
+        std::ostream &output_stream);
+
+} /* namespace metamath_playground */
+
+#endif /* ALLOCATION_TRACKER_H */
@@ -0,0 +1,323 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "common_subproofs.h"
+#include "proof_tree.h"
+#include "proof_verifier.h"
+#include "subproof_table.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+/* Two independent 64 bit hashes make accidental merging of different
+ * subproofs negligible, without keeping subproofs themselves. */
+struct subproof_key
+{
+    std::uint64_t first;
+    std::uint64_t second;
+
+    bool operator==(const subproof_key &other) const
+    {
+        return first == other.first && second == other.second;
+    }
+};
+/*----------------------------------------------------------------------------*/
+struct subproof_key_hash
+{
+    std::size_t operator()(const subproof_key &key) const
+    {
+        return static_cast<std::size_t>(key.first);
+    }
+};
+/*----------------------------------------------------------------------------*/
+std::uint64_t mix(std::uint64_t hash, const std::uint64_t value)
+{
+    /* splitmix64 finalizer over combined value */
+    hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    hash ^= hash >> 30;
+    hash *= 0xbf58476d1ce4e5b9ull;
+    hash ^= hash >> 27;
+    hash *= 0x94d049bb133111ebull;
+    hash ^= hash >> 31;
+    return hash;
+}
+/*----------------------------------------------------------------------------*/
+subproof_key mix(const subproof_key key, const std::uint64_t value)
+{
+    return subproof_key{
+        mix(key.first, value),
+        mix(key.second ^ 0x5851f42d4c957f2dull, value)};
+}
+/*----------------------------------------------------------------------------*/
+subproof_key mix(subproof_key key, const subproof_key value)
+{
+    key = mix(key, value.first);
+    return mix(key, value.second);
+}
+/*----------------------------------------------------------------------------*/
+std::uint64_t encode_symbol(const symbol_index symbol)
+{
+    return
+            static_cast<std::uint64_t>(symbol.second) * 2
+            + (symbol.first == symbol::type_t::variable ? 1 : 0);
+}
+/*----------------------------------------------------------------------------*/
+struct subproof_statistics
+{
+    index assertions_count;
+    index steps_count;
+    assertion_index example_assertion;
+    index example_step;
+};
+/*----------------------------------------------------------------------------*/
+using subproof_map =
+        std::unordered_map<
+            subproof_key,
+            subproof_statistics,
+            subproof_key_hash>;
+/*----------------------------------------------------------------------------*/
+void collect_subproofs(
+        const metamath_database &database,
+        const assertion_index assertion_index_0,
+        const common_subproofs_options &options,
+        const symbol_index typecode,
+        subproof_map &result)
+{
+    const assertion &assertion_0 = database.get_assertion(assertion_index_0);
+    const proof &proof_0 = assertion_0.proof_0;
+    if (proof_0.steps.empty())
+        return;
+
+    const proof_tree tree(proof_0.steps);
+    const subproof_table subproofs(tree);
+    const index saturation = index(1) << 40;
+
+    std::vector<subproof_key> keys(subproofs.size());
+    std::vector<index> sizes(subproofs.size());
+    /* complete subproofs have no "unknown" steps */
+    std::vector<bool> complete(subproofs.size());
+    std::unordered_set<subproof_key, subproof_key_hash> seen;
+
+    for (index i = 0; i < subproofs.size(); ++i)
+    {
+        const proof_step &step = subproofs.get_step(i);
+        subproof_key key{static_cast<std::uint64_t>(step.type), 0};
+        symbol_index step_typecode{symbol::type_t::constant, -1};
+        complete[i] = true;
+        sizes[i] = 1;
+
+        switch (step.type)
+        {
+        case proof_step::type_t::floating_hypothesis: {
+            const index mandatory_count =
+                    assertion_0.floating_hypotheses.size();
+            const floating_hypothesis &hypothesis =
+                    step.index_0 < mandatory_count
+                    ? assertion_0.floating_hypotheses[step.index_0]
+                    : proof_0.floating_hypotheses[
+                        step.index_0 - mandatory_count];
+            key = mix(key, encode_symbol(hypothesis.type));
+            key = mix(key, encode_symbol(hypothesis.variable));
+            step_typecode = hypothesis.type;
+            break; }
+        case proof_step::type_t::essential_hypothesis: {
+            const expression &expression_0 =
+                    assertion_0.essential_hypotheses[step.index_0]
+                    .expression_0;
+            for (const auto &symbol : expression_0)
+                key = mix(key, encode_symbol(symbol));
+            step_typecode = expression_0.at(0);
+            break; }
+        case proof_step::type_t::assertion: {
+            key = mix(key, static_cast<std::uint64_t>(step.index_0));
+            for (const index child : subproofs.get_children(i))
+            {
+                const index child_subproof = subproofs.get_subproof(child);
+                key = mix(key, keys[child_subproof]);
+                sizes[i] =
+                        std::min(
+                            saturation,
+                            sizes[i] + sizes[child_subproof]);
+                complete[i] = complete[i] && complete[child_subproof];
+            }
+            step_typecode =
+                    database.get_assertion(assertion_index(step.index_0))
+                    .expression_0.at(0);
+            break; }
+        case proof_step::type_t::recall:
+            throw std::runtime_error("unexpected recall step");
+        case proof_step::type_t::unknown:
+            complete[i] = false;
+            break;
+        }
+        keys[i] = key;
+
+        if (
+                !complete[i]
+                || sizes[i] < options.minimal_steps_count
+                || (
+                    database.is_valid(typecode)
+                    && step_typecode != typecode))
+            continue;
+        /* Count each assertion once. */
+        if (!seen.insert(key).second)
+            continue;
+
+        auto emplaced =
+                result.emplace(
+                    key,
+                    subproof_statistics{
+                        0,
+                        sizes[i],
+                        assertion_index_0,
+                        subproofs.get_representative(i)});
+        ++emplaced.first->second.assertions_count;
+    }
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+std::vector<common_subproof> find_common_subproofs(
+        const metamath_database &database,
+        const common_subproofs_options &options)
+{
+    symbol_index typecode{symbol::type_t::constant, -1};
+    if (!options.typecode.empty())
+    {
+        typecode = database.find_symbol(options.typecode);
+        if (!database.is_valid(typecode))
+            throw std::runtime_error("unknown typecode " + options.typecode);
+    }
+
+    const index assertions_count =
+            (*database.assertions_end()).get_index();
+    thread_pool pool(options.threads_count);
+
+    /* Each chunk of consecutive assertions is collected separately, then
+     * chunks are merged in order, so examples are the first assertions. */
+    const index chunks_count =
+            std::min<index>(
+                std::max<index>(assertions_count, 1),
+                pool.get_threads_count() * 8);
+    std::vector<subproof_map> chunk_results(chunks_count);
+    parallel_for(
+                pool,
+                chunks_count,
+                [&] (const index chunk)
+                {
+                    const index begin =
+                            assertions_count * chunk / chunks_count;
+                    const index end =
+                            assertions_count * (chunk + 1) / chunks_count;
+                    for (index i = begin; i < end; ++i)
+                        collect_subproofs(
+                                    database,
+                                    assertion_index(i),
+                                    options,
+                                    typecode,
+                                    chunk_results[chunk]);
+                });
+
+    subproof_map merged = std::move(chunk_results.front());
+    for (index chunk = 1; chunk < chunks_count; ++chunk)
+    {
+        for (const auto &entry : chunk_results[chunk])
+        {
+            auto emplaced = merged.emplace(entry);
+            if (!emplaced.second)
+                emplaced.first->second.assertions_count +=
+                        entry.second.assertions_count;
+        }
+        chunk_results[chunk].clear();
+    }
+
+    std::vector<subproof_statistics> candidates;
+    for (const auto &entry : merged)
+        if (entry.second.assertions_count >= options.minimal_assertions_count)
+            candidates.push_back(entry.second);
+    const auto is_better =
+            [] (const subproof_statistics &lhs, const subproof_statistics &rhs)
+            {
+                return
+                        std::make_tuple(
+                            -lhs.assertions_count,
+                            -lhs.steps_count,
+                            lhs.example_assertion.get_index(),
+                            lhs.example_step)
+                        < std::make_tuple(
+                            -rhs.assertions_count,
+                            -rhs.steps_count,
+                            rhs.example_assertion.get_index(),
+                            rhs.example_step);
+            };
+    const index results_count =
+            std::min<index>(options.results_count, candidates.size());
+    std::partial_sort(
+                candidates.begin(),
+                candidates.begin() + results_count,
+                candidates.end(),
+                is_better);
+
+    std::vector<common_subproof> results;
+    for (index i = 0; i < results_count; ++i)
+    {
+        const auto &candidate = candidates[i];
+        const assertion &example =
+                database.get_assertion(candidate.example_assertion);
+        const auto statements = evaluate_proof(database, example);
+        results.push_back(
+                    common_subproof{
+                        candidate.assertions_count,
+                        candidate.steps_count,
+                        candidate.example_assertion,
+                        candidate.example_step,
+                        statements[candidate.example_step]});
+    }
+    return results;
+}
+/*----------------------------------------------------------------------------*/
+void write_common_subproofs_report(
+        const metamath_database &database,
+        const std::vector<common_subproof> &subproofs,
+        std::ostream &output_stream)
+{
+    for (const auto &subproof : subproofs)
+    {
+        output_stream
+                << subproof.assertions_count << " assertions, "
+                << subproof.steps_count << " steps, e.g. in "
+                << database.get_assertion(subproof.example_assertion).label
+                << " at step " << subproof.example_step << ":";
+        for (const auto &symbol : subproof.statement)
+            output_stream << ' ' << database.get_symbol_label(symbol);
+        output_stream << '\n';
+    }
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
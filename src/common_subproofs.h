@@ -0,0 +1,73 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef COMMON_SUBPROOFS_H
+#define COMMON_SUBPROOFS_H
+
+#include "metamath_database.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace metamath_playground {
+
+/* Subproof found in proofs of several assertions - a candidate for extraction
+ * into a lemma. Subproofs are compared by their content: hypotheses by
+ * their statements, not by their labels or positions. */
+struct common_subproof
+{
+    /* number of assertions, which proofs contain the subproof */
+    index assertions_count;
+    /* size of the subproof with "recall" steps expanded */
+    index steps_count;
+    /* the first assertion containing the subproof */
+    assertion_index example_assertion;
+    /* step of example assertion's proof, which ends the subproof */
+    index example_step;
+    expression statement;
+};
+
+struct common_subproofs_options
+{
+    index minimal_steps_count = 10;
+    index minimal_assertions_count = 2;
+    index results_count = 20;
+    /* If not empty, only subproofs of statements with this typecode are
+     * reported, e.g. "|-". */
+    std::string typecode;
+    /* 0 means one thread per hardware thread. */
+    unsigned threads_count = 0;
+};
+
+/* Returns the most frequent subproofs, more frequent and then larger first.
+ * Proofs containing "unknown" steps are analysed only in their complete
+ * parts. */
+std::vector<common_subproof> find_common_subproofs(
+        const metamath_database &database,
+        const common_subproofs_options &options);
+
+void write_common_subproofs_report(
+        const metamath_database &database,
+        const std::vector<common_subproof> &subproofs,
+        std::ostream &output_stream);
+
+} /* namespace metamath_playground */
+
+#endif /* COMMON_SUBPROOFS_H */
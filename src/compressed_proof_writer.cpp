@@ -0,0 +1,461 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "compressed_proof_writer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+const index line_width = 79;
+const index first_line_indentation = 4;
+const index line_indentation = 6;
+/*----------------------------------------------------------------------------*/
+/* Number of characters of number in the compressed format. */
+index compressed_number_length(index number)
+{
+    index length = 1;
+    number = (number - 1) / 20;
+    while (number > 0)
+    {
+        number = (number - 1) / 5;
+        ++length;
+    }
+    return length;
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+compressed_proof_writer::compressed_proof_writer(
+        const metamath_database &database_in) :
+    database(database_in),
+    assertion_slots((*database_in.assertions_end()).get_index(), -1)
+{ }
+/*----------------------------------------------------------------------------*/
+void compressed_proof_writer::write(
+        const assertion &assertion_0,
+        std::string &output)
+{
+    output.append(first_line_indentation, ' ');
+    column = first_line_indentation;
+    write_proof(assertion_0, nullptr, output);
+}
+/*----------------------------------------------------------------------------*/
+void compressed_proof_writer::write(
+        const assertion &assertion_0,
+        const proof_source_context &context,
+        const index start_column,
+        std::string &output)
+{
+    column = start_column;
+    write_proof(assertion_0, &context, output);
+}
+/*----------------------------------------------------------------------------*/
+void compressed_proof_writer::write_proof(
+        const assertion &assertion_0,
+        const proof_source_context *const context,
+        std::string &output)
+{
+    const proof &proof_0 = assertion_0.proof_0;
+    collect_referred_assertions(proof_0);
+
+    output += "$=";
+    column += 2;
+    append_word("(", output);
+    if (context == nullptr)
+    {
+        for (const auto &hypothesis : proof_0.floating_hypotheses)
+            append_word(hypothesis.label, output);
+        for (const auto assertion_index : referred_assertions)
+            append_word(
+                        database.get_assertion(assertion_index).label,
+                        output);
+    }
+    else
+    {
+        for (const auto &label : context->floating_hypothesis_labels)
+            append_word(label, output);
+        for (const auto assertion_index : referred_assertions)
+            append_word(context->get_assertion_label(assertion_index), output);
+    }
+    append_word(")", output);
+
+    const index mandatory_hypotheses_count =
+            assertion_0.floating_hypotheses.size()
+            + assertion_0.essential_hypotheses.size();
+    const index first_reference_number =
+            mandatory_hypotheses_count
+            + proof_0.floating_hypotheses.size()
+            + referred_assertions.size()
+            + 1;
+
+    tree.assign(proof_0.steps);
+    subproofs.assign(tree);
+
+    step_numbers.resize(subproofs.size());
+    code_lengths.resize(subproofs.size());
+    for (index i = 0; i < subproofs.size(); ++i)
+    {
+        step_numbers[i] =
+                get_step_number(
+                    assertion_0,
+                    context,
+                    subproofs.get_step(i));
+        code_lengths[i] =
+                step_numbers[i] == 0
+                ? 1
+                : compressed_number_length(step_numbers[i]);
+    }
+    mark_shared_subproofs(first_reference_number);
+
+    if (subproofs.size() != 0)
+    {
+        if (column + 2 > line_width)
+            break_line(output);
+        else
+        {
+            output += ' ';
+            ++column;
+        }
+    }
+
+    /* number of reference for marked subproofs, which were already written */
+    references.assign(subproofs.size(), -1);
+    index references_count = 0;
+    stack.clear();
+    if (subproofs.size() != 0)
+        stack.push_back(stack_entry{subproofs.size() - 1, 0});
+    while (!stack.empty())
+    {
+        auto &entry = stack.back();
+        const index subproof = entry.subproof;
+        if (entry.child_position == 0 && references[subproof] != -1)
+        {
+            append_code(first_reference_number + references[subproof], output);
+            stack.pop_back();
+            continue;
+        }
+
+        const auto children = subproofs.get_children(subproof);
+        if (entry.child_position < static_cast<index>(children.size()))
+        {
+            const index child = children[entry.child_position++];
+            stack.push_back(
+                        stack_entry{subproofs.get_subproof(child), 0});
+            continue;
+        }
+
+        if (step_numbers[subproof] == 0)
+            append_code_character('?', output);
+        else
+            append_code(step_numbers[subproof], output);
+        if (marks[subproof])
+        {
+            append_code_character('Z', output);
+            references[subproof] = references_count++;
+        }
+        stack.pop_back();
+    }
+
+    append_word("$.", output);
+
+    for (const auto assertion_index : referred_assertions)
+        assertion_slots[assertion_index.get_index()] = -1;
+}
+/*----------------------------------------------------------------------------*/
+void compressed_proof_writer::collect_referred_assertions(const proof &proof_0)
+{
+    referred_assertions.clear();
+    for (const auto step : proof_0.steps)
+    {
+        if (step.type != proof_step::type_t::assertion)
+            continue;
+        if (step.index_0 >= static_cast<index>(assertion_slots.size()))
+            assertion_slots.resize(step.index_0 + 1, -1);
+        index &slot = assertion_slots[step.index_0];
+        if (slot == -1)
+        {
+            slot = referred_assertions.size();
+            referred_assertions.push_back(assertion_index(step.index_0));
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
+/* Chooses subproofs, which are written once, marked with "Z" and then
+ * referred to by number, assuming that each reference is reference_length
+ * characters long. The marks are stored in trial_marks.
+ *
+ * Marking a subproof costs one character, every later use saves the
+ * difference between length of its spelled out form and length of the
+ * reference. Subproofs are considered from the whole proof down, so uses
+ * hidden inside a marked subproof are not counted for its descendants. The
+ * length of spelled out form assumes, that all repeated descendants are
+ * replaced by references. code_lengths holds the length of the number of
+ * each subproof's own step. */
+void compressed_proof_writer::choose_shared_subproofs(
+        const index reference_length)
+{
+    const index subproofs_count = subproofs.size();
+    trial_marks.assign(subproofs_count, false);
+    const index root = subproofs_count - 1;
+
+    const auto saturating_add =
+            [] (const index lhs, const index rhs)
+            {
+                const index limit = index(1) << 30;
+                return std::min(limit, lhs + rhs);
+            };
+
+    spelled_lengths.resize(subproofs_count);
+    for (index i = 0; i < subproofs_count; ++i)
+    {
+        index length = code_lengths[i];
+        for (const index child : subproofs.get_children(i))
+        {
+            const index child_subproof = subproofs.get_subproof(child);
+            length +=
+                    candidates[child_subproof]
+                    ? std::min(
+                          spelled_lengths[child_subproof],
+                          reference_length)
+                    : spelled_lengths[child_subproof];
+        }
+        spelled_lengths[i] = length;
+    }
+
+    /* Uses in the written proof, given the decisions made for ancestors. */
+    uses.assign(subproofs_count, 0);
+    uses[root] = 1;
+    for (index i = root; i >= 0; --i)
+    {
+        if (uses[i] == 0)
+            continue;
+        trial_marks[i] =
+                candidates[i]
+                && (uses[i] - 1) * (spelled_lengths[i] - reference_length) > 1;
+        const index written_uses = trial_marks[i] ? 1 : uses[i];
+        for (const index child : subproofs.get_children(i))
+        {
+            index &child_uses = uses[subproofs.get_subproof(child)];
+            child_uses = saturating_add(child_uses, written_uses);
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
+/* Number of characters of the codes of the proof written with trial_marks,
+ * walked in the order of the writer, so that every reference is counted with
+ * its own number. */
+index compressed_proof_writer::get_encoded_length(
+        const index first_reference_number)
+{
+    references.assign(subproofs.size(), -1);
+    index references_count = 0;
+    index length = 0;
+    stack.clear();
+    stack.push_back(stack_entry{subproofs.size() - 1, 0});
+    while (!stack.empty())
+    {
+        stack_entry &entry = stack.back();
+        const index subproof = entry.subproof;
+        if (entry.child_position == 0 && references[subproof] != -1)
+        {
+            length +=
+                    compressed_number_length(
+                        first_reference_number + references[subproof]);
+            stack.pop_back();
+            continue;
+        }
+        const auto children = subproofs.get_children(subproof);
+        if (entry.child_position < static_cast<index>(children.size()))
+        {
+            const index child = children[entry.child_position++];
+            /* invalidates entry */
+            stack.push_back(stack_entry{subproofs.get_subproof(child), 0});
+            continue;
+        }
+        length += code_lengths[subproof];
+        if (trial_marks[subproof])
+        {
+            ++length;
+            references[subproof] = references_count++;
+        }
+        stack.pop_back();
+    }
+    return length;
+}
+/*----------------------------------------------------------------------------*/
+/* Each marked subproof widens the numbers of later references, so the
+ * length of references depends on the number of marks. Marks are chosen
+ * for reference length of all candidates first, then again for the length
+ * implied by the marks, until it is stable. The marks giving the shortest
+ * encoding are stored in marks. */
+void compressed_proof_writer::mark_shared_subproofs(
+        const index first_reference_number)
+{
+    const index subproofs_count = subproofs.size();
+    marks.clear();
+    if (subproofs_count == 0)
+        return;
+    const index root = subproofs_count - 1;
+
+    /* Uses in fully expanded proof, which are at least 2 for candidates. */
+    uses.assign(subproofs_count, 0);
+    uses[root] = 1;
+    for (index i = root; i >= 0; --i)
+        for (const index child : subproofs.get_children(i))
+        {
+            index &child_uses = uses[subproofs.get_subproof(child)];
+            child_uses = std::min<index>(2, child_uses + uses[i]);
+        }
+    candidates.resize(subproofs_count);
+    index candidates_count = 0;
+    for (index i = 0; i < subproofs_count; ++i)
+    {
+        candidates[i] = uses[i] > 1 && !subproofs.get_children(i).empty();
+        candidates_count += candidates[i];
+    }
+    const auto get_reference_length =
+            [&] (const index marks_count)
+            {
+                return
+                        compressed_number_length(
+                            first_reference_number
+                            + std::max<index>(marks_count, 1) - 1);
+            };
+
+    index best_length = 0;
+    index reference_length = get_reference_length(candidates_count);
+    /* shorter references may make more marks profitable and the other way
+     * round, so the iterations are bounded */
+    for (index iteration = 0; iteration < 8; ++iteration)
+    {
+        choose_shared_subproofs(reference_length);
+        const index length = get_encoded_length(first_reference_number);
+        const index marks_count =
+                std::count(trial_marks.begin(), trial_marks.end(), true);
+        if (iteration == 0 || length < best_length)
+        {
+            marks.swap(trial_marks);
+            best_length = length;
+        }
+        const index next_reference_length = get_reference_length(marks_count);
+        if (next_reference_length == reference_length)
+            break;
+        reference_length = next_reference_length;
+    }
+}
+/*----------------------------------------------------------------------------*/
+/* Returns 0 for "unknown" step. */
+index compressed_proof_writer::get_step_number(
+        const assertion &assertion_0,
+        const proof_source_context *const context,
+        const proof_step &step) const
+{
+    const index mandatory_floating_count =
+            assertion_0.floating_hypotheses.size();
+    const index essential_count = assertion_0.essential_hypotheses.size();
+    const auto get_mandatory_number =
+            [&] (const index position)
+            {
+                return
+                        context == nullptr
+                        ? position + 1
+                        : context->mandatory_numbers[position];
+            };
+    switch (step.type)
+    {
+    case proof_step::type_t::floating_hypothesis:
+        if (step.index_0 < mandatory_floating_count)
+            return get_mandatory_number(step.index_0);
+        else
+            return step.index_0 + essential_count + 1;
+    case proof_step::type_t::essential_hypothesis:
+        return get_mandatory_number(step.index_0 + mandatory_floating_count);
+    case proof_step::type_t::assertion:
+        return
+                assertion_slots[step.index_0]
+                + mandatory_floating_count
+                + essential_count
+                + assertion_0.proof_0.floating_hypotheses.size()
+                + 1;
+    case proof_step::type_t::recall:
+        break;
+    case proof_step::type_t::unknown:
+        return 0;
+    }
+    throw std::runtime_error("unexpected recall step");
+}
+/*----------------------------------------------------------------------------*/
+void compressed_proof_writer::append_word(
+        const std::string &word,
+        std::string &output)
+{
+    if (column + 1 + static_cast<index>(word.size()) > line_width)
+        break_line(output);
+    else
+    {
+        output += ' ';
+        ++column;
+    }
+    output += word;
+    column += word.size();
+}
+/*----------------------------------------------------------------------------*/
+void compressed_proof_writer::append_code(index number, std::string &output)
+{
+    /* digits are produced from the least significant one */
+    char digits[32];
+    index length = 0;
+    number--;
+    if (number < 0)
+        throw std::runtime_error("n < 1");
+
+    digits[length++] = 'A' + number % 20;
+    number /= 20;
+    while (number > 0)
+    {
+        number--;
+        digits[length++] = 'U' + number % 5;
+        number /= 5;
+    }
+    while (length > 0)
+        append_code_character(digits[--length], output);
+}
+/*----------------------------------------------------------------------------*/
+void compressed_proof_writer::append_code_character(
+        const char character,
+        std::string &output)
+{
+    if (column + 1 > line_width)
+        break_line(output);
+    output += character;
+    ++column;
+}
+/*----------------------------------------------------------------------------*/
+void compressed_proof_writer::break_line(std::string &output)
+{
+    output += '\n';
+    output.append(line_indentation, ' ');
+    column = line_indentation;
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
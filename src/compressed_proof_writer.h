@@ -0,0 +1,118 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef COMPRESSED_PROOF_WRITER_H
+#define COMPRESSED_PROOF_WRITER_H
+
+#include "metamath_database.h"
+#include "proof_tree.h"
+#include "subproof_table.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace metamath_playground {
+
+/* Labels and numbering of statements used by a proof in a source file, if
+ * they differ from the database. */
+struct proof_source_context
+{
+    /* number of each mandatory hypothesis in the frame of the file, for
+     * floating hypotheses of the assertion followed by essential ones */
+    std::vector<index> mandatory_numbers;
+    /* labels of the proof's floating hypotheses */
+    std::vector<std::string> floating_hypothesis_labels;
+    std::function<std::string(assertion_index)> get_assertion_label;
+};
+
+/* Formats proofs in the compressed format, wrapped at 79 columns.
+ *
+ * Buffers are kept between proofs, so a single instance should be used for
+ * many proofs. An instance must not be used by several threads at once. */
+class compressed_proof_writer
+{
+private:
+    struct stack_entry
+    {
+        index subproof;
+        index child_position;
+    };
+
+    const metamath_database &database;
+    /* assertion index -> position on the list of referred assertions, -1 if
+     * not referred by the current proof */
+    std::vector<index> assertion_slots;
+    std::vector<assertion_index> referred_assertions;
+    proof_tree tree;
+    subproof_table subproofs;
+    std::vector<index> step_numbers;
+    std::vector<index> code_lengths;
+    /* subproofs written once and then referred to */
+    std::vector<bool> marks;
+    /* scratch of mark_shared_subproofs */
+    std::vector<bool> trial_marks;
+    std::vector<bool> candidates;
+    std::vector<index> spelled_lengths;
+    std::vector<index> uses;
+    std::vector<index> references;
+    std::vector<stack_entry> stack;
+    /* column of the next character in the output */
+    index column = 0;
+
+public:
+    explicit compressed_proof_writer(const metamath_database &database_in);
+    /* subproofs refers to tree */
+    compressed_proof_writer(const compressed_proof_writer &) = delete;
+    compressed_proof_writer &operator=(const compressed_proof_writer &) =
+            delete;
+
+    /* Appends "$= ( ... ) ... $." to output. It has to start at a new line,
+     * the first line is indented by 4 spaces and the following by 6. */
+    void write(const assertion &assertion_0, std::string &output);
+    /* As above, but for a proof placed in a source file at given column. */
+    void write(
+            const assertion &assertion_0,
+            const proof_source_context &context,
+            index start_column,
+            std::string &output);
+
+private:
+    void write_proof(
+            const assertion &assertion_0,
+            const proof_source_context *context,
+            std::string &output);
+    void collect_referred_assertions(const proof &proof_0);
+    void choose_shared_subproofs(index reference_length);
+    index get_encoded_length(index first_reference_number);
+    void mark_shared_subproofs(index first_reference_number);
+    index get_step_number(
+            const assertion &assertion_0,
+            const proof_source_context *context,
+            const proof_step &step) const;
+
+    void append_word(const std::string &word, std::string &output);
+    void append_code(index number, std::string &output);
+    void append_code_character(char character, std::string &output);
+    void break_line(std::string &output);
+};
+
+} /* namespace metamath_playground */
+
+#endif /* COMPRESSED_PROOF_WRITER_H */
@@ -0,0 +1,1033 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "database_generator.h"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+struct wff
+{
+    enum class type_t
+    {
+        variable,
+        constant,
+        implication,
+        negation
+    };
+
+    type_t type;
+    /* number of variable or constant */
+    index index_0;
+    index left;
+    index right;
+};
+/*----------------------------------------------------------------------------*/
+struct proof_node
+{
+    std::string label;
+    std::vector<index> children;
+};
+/*----------------------------------------------------------------------------*/
+struct assertion_entry
+{
+    std::string label;
+    index statement;
+    /* variables of the statement in the order of their $f statements */
+    std::vector<index> variables;
+    /* $d restrictions, the lower variable number first */
+    std::vector<std::pair<index, index>> disjoint_pairs;
+};
+/*----------------------------------------------------------------------------*/
+struct statement_entry
+{
+    std::string label;
+    index statement;
+};
+/*----------------------------------------------------------------------------*/
+struct proved_statement
+{
+    index statement;
+    /* root node of the proof */
+    index root;
+};
+/*----------------------------------------------------------------------------*/
+std::string encode_compressed_number(index number)
+{
+    std::string result;
+    --number;
+    result.push_back(static_cast<char>('A' + number % 20));
+    number /= 20;
+    while (number > 0)
+    {
+        --number;
+        result.push_back(static_cast<char>('U' + number % 5));
+        number /= 5;
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+class generator
+{
+private:
+    const generator_options &options;
+    std::ostream &output_stream;
+    std::mt19937 random;
+    std::vector<wff> wffs;
+    std::vector<assertion_entry> axioms;
+    /* "|-" theorems without essential hypotheses, usable in later proofs */
+    std::vector<assertion_entry> theorems;
+    /* essential hypotheses of open scopes */
+    std::vector<statement_entry> hypotheses;
+
+    /* the proof being generated, a DAG of steps */
+    std::vector<proof_node> nodes;
+    std::unordered_map<index, index> syntax_nodes;
+    std::vector<index> used_wffs;
+    /* restrictions required by the proof being generated */
+    std::vector<std::pair<index, index>> disjoint_pairs;
+
+    /* $f of the variable numbered variables_count in the open scope block,
+     * declared after late_floating_position essential hypotheses */
+    std::string late_floating_label;
+    index late_floating_position = -1;
+
+    index open_scopes_count = 0;
+    std::string line;
+
+public:
+    generator(const generator_options &options_in, std::ostream &output_in):
+        options(options_in),
+        output_stream(output_in),
+        random(options_in.seed)
+    {
+    }
+
+    void generate();
+
+private:
+    bool draw(const double probability)
+    {
+        return std::bernoulli_distribution(probability)(random);
+    }
+
+    index draw_index(const index count)
+    {
+        return std::uniform_int_distribution<index>(0, count - 1)(random);
+    }
+
+    /* Draws nothing if the feature is disabled, so that databases generated
+     * without it stay the same. */
+    bool draw_feature(const double probability)
+    {
+        return probability > 0.0 && draw(probability);
+    }
+
+    /* including the variable of late $f statements */
+    index get_variables_count() const
+    {
+        return options.variables_count
+                + (options.late_floating_ratio > 0.0 ? 1 : 0);
+    }
+
+    index add_wff(const wff &wff_0)
+    {
+        wffs.push_back(wff_0);
+        return static_cast<index>(wffs.size() - 1);
+    }
+
+    index make_implication(const index left, const index right)
+    {
+        return add_wff(wff{wff::type_t::implication, 0, left, right});
+    }
+
+    index make_random_wff(index depth, bool variables_only);
+    index choose_wff(index depth);
+    index substitute(index wff_index, const std::vector<index> &substitution);
+    void collect_variables(index wff_index, std::vector<bool> &marks) const;
+    std::vector<index> get_variables(index wff_index) const;
+    void format_wff(index wff_index, std::string &output) const;
+
+    void clear_proof();
+    index add_node(std::string label, std::vector<index> children);
+    index prove_syntax(index wff_index);
+    assertion_entry make_assertion_entry(
+            const std::string &label,
+            index statement) const;
+    bool is_disjoint(
+            const assertion_entry &assertion,
+            const std::vector<index> &substitution) const;
+    void make_disjoint(
+            const assertion_entry &assertion,
+            index substitution_depth,
+            std::vector<index> &substitution);
+    proved_statement prove_instance(
+            const assertion_entry &assertion,
+            index substitution_depth);
+    proved_statement add_antecedent(
+            const proved_statement &proved,
+            index antecedent);
+    proved_statement add_dummy_variable(const proved_statement &proved);
+    proved_statement prove_theorem(
+            const statement_entry *base,
+            bool use_theorem);
+
+    void write_header();
+    void write_axiom(const assertion_entry &axiom);
+    void write_syntax_theorem(index number);
+    void write_theorem(const std::string &label, const statement_entry &base);
+    void write_scope_block(index number);
+    void open_disjoint_scope(
+            const std::vector<std::pair<index, index>> &pairs);
+    void close_scope();
+    void write_proof(
+            const std::string &label,
+            const std::string &typecode,
+            index statement,
+            index root);
+    void write_uncompressed_proof(index root);
+    void write_compressed_proof(
+            const std::vector<std::string> &mandatory_labels,
+            index root);
+    void append_word(const std::string &word, index &column);
+    void flush_line();
+};
+/*----------------------------------------------------------------------------*/
+index generator::make_random_wff(const index depth, const bool variables_only)
+{
+    if (depth <= 1 || draw(0.25))
+    {
+        if (variables_only || options.constants_count == 0 || draw(0.7))
+            return add_wff(
+                        wff{
+                            wff::type_t::variable,
+                            draw_index(options.variables_count),
+                            -1,
+                            -1});
+        return add_wff(
+                    wff{
+                        wff::type_t::constant,
+                        draw_index(options.constants_count),
+                        -1,
+                        -1});
+    }
+    if (draw(0.2))
+    {
+        const index operand = make_random_wff(depth - 1, variables_only);
+        return add_wff(wff{wff::type_t::negation, 0, operand, -1});
+    }
+    const index left = make_random_wff(depth - 1, variables_only);
+    const index right = make_random_wff(depth - 1, variables_only);
+    return make_implication(left, right);
+}
+/*----------------------------------------------------------------------------*/
+index generator::choose_wff(const index depth)
+{
+    if (!used_wffs.empty() && draw(options.backreference_density))
+        return used_wffs[draw_index(used_wffs.size())];
+    const index result = make_random_wff(depth, false);
+    used_wffs.push_back(result);
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+index generator::substitute(
+        const index wff_index,
+        const std::vector<index> &substitution)
+{
+    const wff wff_0 = wffs[wff_index];
+    switch (wff_0.type)
+    {
+    case wff::type_t::variable:
+        return substitution[wff_0.index_0];
+    case wff::type_t::constant:
+        return wff_index;
+    case wff::type_t::implication: {
+        const index left = substitute(wff_0.left, substitution);
+        const index right = substitute(wff_0.right, substitution);
+        return make_implication(left, right); }
+    case wff::type_t::negation: {
+        const index operand = substitute(wff_0.left, substitution);
+        return add_wff(wff{wff::type_t::negation, 0, operand, -1}); }
+    }
+    throw std::runtime_error("unexpected wff type");
+}
+/*----------------------------------------------------------------------------*/
+void generator::collect_variables(
+        const index wff_index,
+        std::vector<bool> &marks) const
+{
+    const wff &wff_0 = wffs[wff_index];
+    switch (wff_0.type)
+    {
+    case wff::type_t::variable:
+        marks[wff_0.index_0] = true;
+        break;
+    case wff::type_t::constant:
+        break;
+    case wff::type_t::implication:
+        collect_variables(wff_0.left, marks);
+        collect_variables(wff_0.right, marks);
+        break;
+    case wff::type_t::negation:
+        collect_variables(wff_0.left, marks);
+        break;
+    }
+}
+/*----------------------------------------------------------------------------*/
+std::vector<index> generator::get_variables(const index wff_index) const
+{
+    std::vector<bool> marks(get_variables_count());
+    collect_variables(wff_index, marks);
+    std::vector<index> result;
+    for (index i = 0; i < get_variables_count(); ++i)
+        if (marks[i])
+            result.push_back(i);
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+/* Appends symbols, each preceded by a space. */
+void generator::format_wff(const index wff_index, std::string &output) const
+{
+    const wff &wff_0 = wffs[wff_index];
+    switch (wff_0.type)
+    {
+    case wff::type_t::variable:
+        output += " v" + std::to_string(wff_0.index_0);
+        break;
+    case wff::type_t::constant:
+        output += " c" + std::to_string(wff_0.index_0);
+        break;
+    case wff::type_t::implication:
+        output += " (";
+        format_wff(wff_0.left, output);
+        output += " ->";
+        format_wff(wff_0.right, output);
+        output += " )";
+        break;
+    case wff::type_t::negation:
+        output += " -.";
+        format_wff(wff_0.left, output);
+        break;
+    }
+}
+/*----------------------------------------------------------------------------*/
+void generator::clear_proof()
+{
+    nodes.clear();
+    syntax_nodes.clear();
+    used_wffs.clear();
+    disjoint_pairs.clear();
+}
+/*----------------------------------------------------------------------------*/
+index generator::add_node(std::string label, std::vector<index> children)
+{
+    nodes.push_back(proof_node{std::move(label), std::move(children)});
+    return static_cast<index>(nodes.size() - 1);
+}
+/*----------------------------------------------------------------------------*/
+/* Identical formulas share their syntax subproofs. */
+index generator::prove_syntax(const index wff_index)
+{
+    const auto found = syntax_nodes.find(wff_index);
+    if (found != syntax_nodes.end())
+        return found->second;
+
+    const wff wff_0 = wffs[wff_index];
+    index result = -1;
+    switch (wff_0.type)
+    {
+    case wff::type_t::variable:
+        result =
+                add_node(
+                    wff_0.index_0 == options.variables_count
+                    ? late_floating_label
+                    : "wv" + std::to_string(wff_0.index_0),
+                    {});
+        break;
+    case wff::type_t::constant:
+        result = add_node("wc" + std::to_string(wff_0.index_0), {});
+        break;
+    case wff::type_t::implication: {
+        const index left = prove_syntax(wff_0.left);
+        const index right = prove_syntax(wff_0.right);
+        result = add_node("wi", {left, right});
+        break; }
+    case wff::type_t::negation: {
+        const index operand = prove_syntax(wff_0.left);
+        result = add_node("wn", {operand});
+        break; }
+    }
+    syntax_nodes.emplace(wff_index, result);
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+assertion_entry generator::make_assertion_entry(
+        const std::string &label,
+        const index statement) const
+{
+    return assertion_entry{label, statement, get_variables(statement), {}};
+}
+/*----------------------------------------------------------------------------*/
+bool generator::is_disjoint(
+        const assertion_entry &assertion,
+        const std::vector<index> &substitution) const
+{
+    for (const auto &pair : assertion.disjoint_pairs)
+    {
+        std::vector<bool> marks(get_variables_count());
+        collect_variables(substitution[pair.first], marks);
+        for (const index variable : get_variables(substitution[pair.second]))
+            if (marks[variable])
+                return false;
+    }
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+/* Redraws substitutions of restricted variables until they have no common
+ * variables, falling back to the variables themselves. Adds restrictions
+ * between the substituted variables to the proof. */
+void generator::make_disjoint(
+        const assertion_entry &assertion,
+        const index substitution_depth,
+        std::vector<index> &substitution)
+{
+    const index attempts_count = 8;
+    for (index attempt = 0; !is_disjoint(assertion, substitution); ++attempt)
+        for (const auto &pair : assertion.disjoint_pairs)
+            for (const index variable : {pair.first, pair.second})
+                substitution[variable] =
+                        attempt < attempts_count
+                        ? choose_wff(substitution_depth)
+                        : add_wff(
+                            wff{wff::type_t::variable, variable, -1, -1});
+
+    for (const auto &pair : assertion.disjoint_pairs)
+        for (const index lhs : get_variables(substitution[pair.first]))
+            for (const index rhs : get_variables(substitution[pair.second]))
+                disjoint_pairs.emplace_back(
+                            std::min(lhs, rhs),
+                            std::max(lhs, rhs));
+}
+/*----------------------------------------------------------------------------*/
+proved_statement generator::prove_instance(
+        const assertion_entry &assertion,
+        const index substitution_depth)
+{
+    std::vector<index> substitution(options.variables_count, -1);
+    for (const index variable : assertion.variables)
+        substitution[variable] = choose_wff(substitution_depth);
+    if (!assertion.disjoint_pairs.empty())
+        make_disjoint(assertion, substitution_depth, substitution);
+    std::vector<index> children;
+    for (const index variable : assertion.variables)
+        children.push_back(prove_syntax(substitution[variable]));
+    const index root = add_node(assertion.label, std::move(children));
+    return proved_statement{
+        substitute(assertion.statement, substitution),
+        root};
+}
+/*----------------------------------------------------------------------------*/
+/* ax-1 gives |- ( S -> ( Q -> S ) ), ax-mp then gives |- ( Q -> S ) */
+proved_statement generator::add_antecedent(
+        const proved_statement &proved,
+        const index antecedent)
+{
+    const index consequent = make_implication(antecedent, proved.statement);
+    const index instance =
+            add_node(
+                "ax-1",
+                {prove_syntax(proved.statement), prove_syntax(antecedent)});
+    const index root =
+            add_node(
+                "ax-mp",
+                {
+                    prove_syntax(proved.statement),
+                    prove_syntax(consequent),
+                    proved.root,
+                    instance});
+    return proved_statement{consequent, root};
+}
+/*----------------------------------------------------------------------------*/
+/* ax-1 gives |- D for D = ( x -> ( x -> x ) ), where x is not mandatory,
+ * ax-mp with |- ( D -> S ) then gives back |- S. Returns proved unchanged if
+ * all variables are mandatory. */
+proved_statement generator::add_dummy_variable(const proved_statement &proved)
+{
+    std::vector<bool> marks(get_variables_count());
+    collect_variables(proved.statement, marks);
+    for (const auto &hypothesis : hypotheses)
+        collect_variables(hypothesis.statement, marks);
+    std::vector<index> dummy_variables;
+    for (index i = 0; i < options.variables_count; ++i)
+        if (!marks[i])
+            dummy_variables.push_back(i);
+    if (dummy_variables.empty())
+        return proved;
+
+    const index variable =
+            add_wff(
+                wff{
+                    wff::type_t::variable,
+                    dummy_variables[draw_index(dummy_variables.size())],
+                    -1,
+                    -1});
+    const index detour =
+            make_implication(variable, make_implication(variable, variable));
+    const index detour_root =
+            add_node("ax-1", {prove_syntax(variable), prove_syntax(variable)});
+    const proved_statement implication = add_antecedent(proved, detour);
+    const index root =
+            add_node(
+                "ax-mp",
+                {
+                    prove_syntax(detour),
+                    prove_syntax(proved.statement),
+                    detour_root,
+                    implication.root});
+    return proved_statement{proved.statement, root};
+}
+/*----------------------------------------------------------------------------*/
+/* Starts from base, or from an instance of an earlier theorem or an axiom if
+ * base is null, and applies modus ponens with ax-1 instances to it. */
+proved_statement generator::prove_theorem(
+        const statement_entry *const base,
+        const bool use_theorem)
+{
+    proved_statement result;
+    if (base != nullptr)
+    {
+        result.statement = base->statement;
+        result.root = add_node(base->label, {});
+    }
+    else
+    {
+        result =
+                use_theorem
+                ? prove_instance(theorems[draw_index(theorems.size())], 1)
+                : prove_instance(
+                    axioms[draw_index(axioms.size())],
+                    std::max<index>(1, options.wff_depth / 2));
+    }
+
+    const index applications_count =
+            std::uniform_int_distribution<index>(1, options.proof_depth)(
+                random);
+    for (index i = 0; i < applications_count; ++i)
+        result = add_antecedent(result, choose_wff(options.wff_depth));
+    if (draw_feature(options.dummy_variables_ratio))
+        result = add_dummy_variable(result);
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+void generator::generate()
+{
+    if (
+            options.constants_count < 0 || options.variables_count < 3
+            || options.axioms_count < 0 || options.syntax_theorems_count < 0
+            || options.theorems_count < 0 || options.scopes_count < 0
+            || options.scope_depth < 1 || options.proof_depth < 1
+            || options.wff_depth < 1
+            || !(options.compressed_ratio >= 0.0)
+            || !(options.compressed_ratio <= 1.0)
+            || !(options.backreference_density >= 0.0)
+            || !(options.backreference_density <= 1.0)
+            || !(options.disjoint_variables_ratio >= 0.0)
+            || !(options.disjoint_variables_ratio <= 1.0)
+            || !(options.dummy_variables_ratio >= 0.0)
+            || !(options.dummy_variables_ratio <= 1.0)
+            || !(options.late_floating_ratio >= 0.0)
+            || !(options.late_floating_ratio <= 1.0))
+        throw std::runtime_error("invalid generator options");
+
+    write_header();
+
+    /* Kinds of statements are interleaved randomly. */
+    index syntax_theorems_left = options.syntax_theorems_count;
+    index theorems_left = options.theorems_count;
+    index scopes_left = options.scopes_count;
+    while (syntax_theorems_left + theorems_left + scopes_left > 0)
+    {
+        const index choice =
+                draw_index(syntax_theorems_left + theorems_left + scopes_left);
+        if (choice < syntax_theorems_left)
+        {
+            write_syntax_theorem(
+                        options.syntax_theorems_count - syntax_theorems_left);
+            --syntax_theorems_left;
+        }
+        else if (choice < syntax_theorems_left + theorems_left)
+        {
+            const std::string label =
+                    "th"
+                    + std::to_string(options.theorems_count - theorems_left);
+            clear_proof();
+            /* Theorems based on theorems are not used again, so that
+             * statements do not grow with the size of the database. */
+            const bool use_theorem = !theorems.empty() && draw(0.3);
+            const proved_statement proved =
+                    prove_theorem(nullptr, use_theorem);
+            std::sort(disjoint_pairs.begin(), disjoint_pairs.end());
+            disjoint_pairs.erase(
+                        std::unique(
+                            disjoint_pairs.begin(),
+                            disjoint_pairs.end()),
+                        disjoint_pairs.end());
+            if (!disjoint_pairs.empty())
+                open_disjoint_scope(disjoint_pairs);
+            write_proof(label, "|-", proved.statement, proved.root);
+            if (!disjoint_pairs.empty())
+                close_scope();
+            if (!use_theorem)
+            {
+                theorems.push_back(
+                            make_assertion_entry(label, proved.statement));
+                theorems.back().disjoint_pairs = disjoint_pairs;
+            }
+            --theorems_left;
+        }
+        else
+        {
+            write_scope_block(options.scopes_count - scopes_left);
+            --scopes_left;
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
+void generator::write_header()
+{
+    line = "$( Synthetic database generated by metamath_generator $)\n";
+    line += "  $c ( ) -> -. wff |- $.\n";
+    if (options.constants_count > 0)
+    {
+        line += "  $c";
+        for (index i = 0; i < options.constants_count; ++i)
+            line += " c" + std::to_string(i);
+        line += " $.\n";
+    }
+    /* the last variable has $f only in scope blocks */
+    line += "  $v";
+    for (index i = 0; i < get_variables_count(); ++i)
+        line += " v" + std::to_string(i);
+    line += " $.\n";
+    for (index i = 0; i < options.variables_count; ++i)
+        line +=
+                "  wv" + std::to_string(i) + " $f wff v" + std::to_string(i)
+                + " $.\n";
+    for (index i = 0; i < options.constants_count; ++i)
+        line +=
+                "  wc" + std::to_string(i) + " $a wff c" + std::to_string(i)
+                + " $.\n";
+    line += "  wi $a wff ( v0 -> v1 ) $.\n";
+    line += "  wn $a wff -. v0 $.\n";
+    flush_line();
+
+    const auto variable =
+            [&] (const index number)
+            {
+                return add_wff(wff{wff::type_t::variable, number, -1, -1});
+            };
+    const auto negation =
+            [&] (const index operand)
+            {
+                return add_wff(wff{wff::type_t::negation, 0, operand, -1});
+            };
+    const index v0 = variable(0);
+    const index v1 = variable(1);
+    const index v2 = variable(2);
+    write_axiom(
+                make_assertion_entry(
+                    "ax-1",
+                    make_implication(v0, make_implication(v1, v0))));
+    write_axiom(
+                make_assertion_entry(
+                    "ax-2",
+                    make_implication(
+                        make_implication(v0, make_implication(v1, v2)),
+                        make_implication(
+                            make_implication(v0, v1),
+                            make_implication(v0, v2)))));
+    write_axiom(
+                make_assertion_entry(
+                    "ax-3",
+                    make_implication(
+                        make_implication(negation(v0), negation(v1)),
+                        make_implication(v1, v0))));
+    line =
+            "  ${\n"
+            "    min $e |- v0 $.\n"
+            "    maj $e |- ( v0 -> v1 ) $.\n"
+            "    ax-mp $a |- v1 $.\n"
+            "  $}\n";
+    flush_line();
+    for (index i = 0; i < options.axioms_count; ++i)
+    {
+        assertion_entry axiom =
+                make_assertion_entry(
+                    "ax-g" + std::to_string(i),
+                    make_random_wff(options.wff_depth, true));
+        const index variables_count = axiom.variables.size();
+        if (
+                variables_count >= 2
+                && draw_feature(options.disjoint_variables_ratio))
+        {
+            const index first = draw_index(variables_count);
+            const index second =
+                    (first + 1 + draw_index(variables_count - 1))
+                    % variables_count;
+            axiom.disjoint_pairs.emplace_back(
+                        axiom.variables[std::min(first, second)],
+                        axiom.variables[std::max(first, second)]);
+        }
+        write_axiom(axiom);
+    }
+}
+/*----------------------------------------------------------------------------*/
+void generator::write_axiom(const assertion_entry &axiom)
+{
+    if (!axiom.disjoint_pairs.empty())
+        open_disjoint_scope(axiom.disjoint_pairs);
+    line =
+            std::string(2 * open_scopes_count + 2, ' ') + axiom.label
+            + " $a |-";
+    format_wff(axiom.statement, line);
+    line += " $.\n";
+    flush_line();
+    if (!axiom.disjoint_pairs.empty())
+        close_scope();
+    axioms.push_back(axiom);
+}
+/*----------------------------------------------------------------------------*/
+void generator::write_syntax_theorem(const index number)
+{
+    clear_proof();
+    const index statement = make_random_wff(options.wff_depth + 1, false);
+    write_proof(
+                "wth" + std::to_string(number),
+                "wff",
+                statement,
+                prove_syntax(statement));
+}
+/*----------------------------------------------------------------------------*/
+/* Each level of the block adds a hypothesis and proves a theorem from it. */
+void generator::write_scope_block(const index number)
+{
+    const std::string prefix = std::to_string(number) + ".";
+    for (index level = 0; level < options.scope_depth; ++level)
+    {
+        const std::string indentation(2 * level + 2, ' ');
+        const statement_entry hypothesis{
+            "sh" + prefix + std::to_string(level),
+            make_random_wff(options.wff_depth, false)};
+        line = indentation + "${\n" + indentation + "  " + hypothesis.label
+                + " $e |-";
+        format_wff(hypothesis.statement, line);
+        line += " $.\n";
+        ++open_scopes_count;
+        hypotheses.push_back(hypothesis);
+
+        /* The $f follows the $e, so the frame is not sorted by type. */
+        const bool late_floating =
+                late_floating_label.empty()
+                && draw_feature(options.late_floating_ratio);
+        if (late_floating)
+        {
+            late_floating_label = "wl" + prefix + std::to_string(level);
+            late_floating_position = hypotheses.size();
+            line +=
+                    indentation + "  " + late_floating_label + " $f wff v"
+                    + std::to_string(options.variables_count) + " $.\n";
+        }
+        flush_line();
+
+        clear_proof();
+        proved_statement proved = prove_theorem(&hypothesis, false);
+        if (late_floating)
+            proved =
+                    add_antecedent(
+                        proved,
+                        add_wff(
+                            wff{
+                                wff::type_t::variable,
+                                options.variables_count,
+                                -1,
+                                -1}));
+        write_proof(
+                    "sth" + prefix + std::to_string(level),
+                    "|-",
+                    proved.statement,
+                    proved.root);
+    }
+    for (index level = 0; level < options.scope_depth; ++level)
+        close_scope();
+    hypotheses.clear();
+    late_floating_label.clear();
+    late_floating_position = -1;
+}
+/*----------------------------------------------------------------------------*/
+void generator::open_disjoint_scope(
+        const std::vector<std::pair<index, index>> &pairs)
+{
+    const std::string indentation(2 * open_scopes_count + 2, ' ');
+    line = indentation + "${\n";
+    for (const auto &pair : pairs)
+        line +=
+                indentation + "  $d v" + std::to_string(pair.first) + " v"
+                + std::to_string(pair.second) + " $.\n";
+    flush_line();
+    ++open_scopes_count;
+}
+/*----------------------------------------------------------------------------*/
+void generator::close_scope()
+{
+    --open_scopes_count;
+    line = std::string(2 * open_scopes_count + 2, ' ') + "$}\n";
+    flush_line();
+}
+/*----------------------------------------------------------------------------*/
+void generator::write_proof(
+        const std::string &label,
+        const std::string &typecode,
+        const index statement,
+        const index root)
+{
+    line = std::string(2 * open_scopes_count + 2, ' ') + label + " $p "
+            + typecode;
+    format_wff(statement, line);
+    line += " $=\n";
+
+    if (draw(options.compressed_ratio))
+    {
+        /* mandatory hypotheses: $f of variables of the statement and of the
+         * hypotheses in their order, then all $e, with the late $f after its
+         * preceding $e */
+        std::vector<bool> marks(get_variables_count());
+        collect_variables(statement, marks);
+        for (const auto &hypothesis : hypotheses)
+            collect_variables(hypothesis.statement, marks);
+        std::vector<std::string> mandatory_labels;
+        for (index i = 0; i < options.variables_count; ++i)
+            if (marks[i])
+                mandatory_labels.push_back("wv" + std::to_string(i));
+        for (index i = 0; i < static_cast<index>(hypotheses.size()); ++i)
+        {
+            mandatory_labels.push_back(hypotheses[i].label);
+            if (
+                    i + 1 == late_floating_position
+                    && marks[options.variables_count])
+                mandatory_labels.push_back(late_floating_label);
+        }
+        write_compressed_proof(mandatory_labels, root);
+    }
+    else
+    {
+        write_uncompressed_proof(root);
+    }
+}
+/*----------------------------------------------------------------------------*/
+/* Repeated subproofs are written in full each time. */
+void generator::write_uncompressed_proof(const index root)
+{
+    index column = 0;
+    struct stack_entry
+    {
+        index node;
+        index child_position;
+    };
+    std::vector<stack_entry> stack{{root, 0}};
+    while (!stack.empty())
+    {
+        auto &entry = stack.back();
+        const proof_node &node = nodes[entry.node];
+        if (entry.child_position < static_cast<index>(node.children.size()))
+        {
+            const index child = node.children[entry.child_position++];
+            stack.push_back(stack_entry{child, 0}); /* invalidates entry */
+            continue;
+        }
+        append_word(node.label, column);
+        stack.pop_back();
+    }
+    append_word("$.", column);
+    line += '\n';
+    flush_line();
+}
+/*----------------------------------------------------------------------------*/
+void generator::write_compressed_proof(
+        const std::vector<std::string> &mandatory_labels,
+        const index root)
+{
+    /* Subproofs used more than once are marked with Z after their first
+     * occurrence. */
+    std::vector<index> uses(nodes.size());
+    {
+        std::vector<bool> visited(nodes.size());
+        std::vector<index> pending{root};
+        visited[root] = true;
+        while (!pending.empty())
+        {
+            const index node = pending.back();
+            pending.pop_back();
+            for (const index child : nodes[node].children)
+            {
+                ++uses[child];
+                if (!visited[child])
+                {
+                    visited[child] = true;
+                    pending.push_back(child);
+                }
+            }
+        }
+    }
+
+    std::unordered_map<std::string, index> label_numbers;
+    for (const auto &label : mandatory_labels)
+        label_numbers.emplace(label, label_numbers.size() + 1);
+    std::vector<std::string> referred_labels;
+    /* positive numbers of labels, marks as -(mark number + 1) */
+    std::vector<index> codes;
+    std::vector<bool> marked_codes;
+    std::vector<index> marks(nodes.size(), -1);
+    index marks_count = 0;
+
+    struct stack_entry
+    {
+        index node;
+        index child_position;
+    };
+    std::vector<stack_entry> stack{{root, 0}};
+    while (!stack.empty())
+    {
+        auto &entry = stack.back();
+        const proof_node &node = nodes[entry.node];
+        if (marks[entry.node] != -1)
+        {
+            codes.push_back(-(marks[entry.node] + 1));
+            marked_codes.push_back(false);
+            stack.pop_back();
+            continue;
+        }
+        if (entry.child_position < static_cast<index>(node.children.size()))
+        {
+            const index child = node.children[entry.child_position++];
+            stack.push_back(stack_entry{child, 0}); /* invalidates entry */
+            continue;
+        }
+        auto emplaced =
+                label_numbers.emplace(node.label, label_numbers.size() + 1);
+        if (emplaced.second)
+            referred_labels.push_back(node.label);
+        codes.push_back(emplaced.first->second);
+        const bool marked = !node.children.empty() && uses[entry.node] > 1;
+        marked_codes.push_back(marked);
+        if (marked)
+            marks[entry.node] = marks_count++;
+        stack.pop_back();
+    }
+
+    index column = 0;
+    append_word("(", column);
+    for (const auto &label : referred_labels)
+        append_word(label, column);
+    append_word(")", column);
+
+    std::string code;
+    const index labels_count = label_numbers.size();
+    for (std::size_t i = 0; i < codes.size(); ++i)
+    {
+        code +=
+                encode_compressed_number(
+                    codes[i] > 0 ? codes[i] : labels_count - codes[i]);
+        if (marked_codes[i])
+            code += 'Z';
+    }
+    /* Code is split to fill the lines. */
+    index position = 0;
+    const index code_size = code.size();
+    while (position < code_size)
+    {
+        index length = 78 - column;
+        if (length < 8)
+            length = 73;
+        length = std::min<index>(length, code_size - position);
+        append_word(code.substr(position, length), column);
+        position += length;
+    }
+    append_word("$.", column);
+    line += '\n';
+    flush_line();
+}
+/*----------------------------------------------------------------------------*/
+/* Appends word after a space or at a new line, wrapping at 79 columns. */
+void generator::append_word(const std::string &word, index &column)
+{
+    const index indentation = 6;
+    if (
+            column == 0
+            || column + 1 + static_cast<index>(word.size()) > 79)
+    {
+        if (column != 0)
+            line += '\n';
+        line.append(indentation, ' ');
+        column = indentation;
+    }
+    else
+    {
+        line += ' ';
+        ++column;
+    }
+    line += word;
+    column += word.size();
+    if (line.size() > 65536)
+        flush_line();
+}
+/*----------------------------------------------------------------------------*/
+void generator::flush_line()
+{
+    output_stream.write(line.data(), line.size());
+    line.clear();
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+void generator_options::scale(const index factor)
+{
+    axioms_count *= factor;
+    syntax_theorems_count *= factor;
+    theorems_count *= factor;
+    scopes_count *= factor;
+}
+/*----------------------------------------------------------------------------*/
+void generate_database(
+        const generator_options &options,
+        std::ostream &output_stream)
+{
+    generator(options, output_stream).generate();
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef DATABASE_GENERATOR_H
+#define DATABASE_GENERATOR_H
+
+#include "typed_indices.h"
+
+#include <iostream>
+
+namespace metamath_playground {
+
+/* Parameters of a synthetic database. Axioms, wff syntax and modus ponens
+ * follow set.mm, so the database is valid and all its proofs verify. */
+struct generator_options
+{
+    /* atomic wff constants, besides the symbols of the logic */
+    index constants_count = 10;
+    /* wff variables, at least 3 */
+    index variables_count = 10;
+    /* random axioms added to ax-1, ax-2, ax-3 and ax-mp */
+    index axioms_count = 10;
+    /* theorems proving only that an expression is a wff */
+    index syntax_theorems_count = 100;
+    /* "|-" theorems at the top level */
+    index theorems_count = 1000;
+    /* blocks of nested scopes, each level has an essential hypothesis and a
+     * theorem using it */
+    index scopes_count = 10;
+    index scope_depth = 3;
+    /* "|-" proofs apply modus ponens 1 to proof_depth times */
+    index proof_depth = 8;
+    index wff_depth = 4;
+    /* fraction of proofs written in compressed format */
+    double compressed_ratio = 0.5;
+    /* probability of reusing a formula already present in the proof, which
+     * gives repeated subproofs, backreferences in compressed proofs */
+    double backreference_density = 0.3;
+    /* probability that a random axiom has a $d restriction between two of
+     * its variables, theorems using the axiom inherit restrictions */
+    double disjoint_variables_ratio = 0.0;
+    /* probability that a "|-" proof passes through a variable absent from
+     * the statement, so that its $f is not mandatory */
+    double dummy_variables_ratio = 0.0;
+    /* probability that a level of a scope block declares a $f after its
+     * essential hypothesis, used by the theorem of the level */
+    double late_floating_ratio = 0.0;
+    unsigned seed = 1;
+
+    /* Multiplies counts of statements by factor. */
+    void scale(index factor);
+};
+
+/* Throws std::runtime_error if options are invalid. */
+void generate_database(
+        const generator_options &options,
+        std::ostream &output_stream);
+
+} /* namespace metamath_playground */
+
+#endif /* DATABASE_GENERATOR_H */
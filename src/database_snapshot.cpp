@@ -0,0 +1,324 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "database_snapshot.h"
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+const std::string snapshot_magic = "metamath_playground snapshot 1\n";
+/*----------------------------------------------------------------------------*/
+class snapshot_writer
+{
+private:
+    std::string buffer;
+
+public:
+    const std::string &get_buffer() const
+    {
+        return buffer;
+    }
+
+    void write_integer(const std::int64_t value)
+    {
+        char bytes[sizeof(value)];
+        std::memcpy(bytes, &value, sizeof(value));
+        buffer.append(bytes, sizeof(value));
+    }
+
+    void write_string(const std::string &value)
+    {
+        write_integer(value.size());
+        buffer += value;
+    }
+
+    void write_symbol(const symbol_index symbol_0)
+    {
+        /* variables are marked by the sign */
+        write_integer(
+                    symbol_0.first == symbol::type_t::variable
+                    ? -symbol_0.second - 1
+                    : symbol_0.second);
+    }
+
+    void write_expression(const expression &expression_0)
+    {
+        write_integer(expression_0.size());
+        for (const auto &symbol_0 : expression_0)
+            write_symbol(symbol_0);
+    }
+
+    void write_restrictions(
+            const std::vector<disjoint_variable_restriction> &restrictions)
+    {
+        write_integer(restrictions.size());
+        for (const auto &restriction : restrictions)
+        {
+            write_symbol(restriction[0]);
+            write_symbol(restriction[1]);
+        }
+    }
+
+    void write_floating_hypotheses(
+            const std::vector<floating_hypothesis> &hypotheses)
+    {
+        write_integer(hypotheses.size());
+        for (const auto &hypothesis : hypotheses)
+        {
+            write_string(hypothesis.label);
+            write_symbol(hypothesis.type);
+            write_symbol(hypothesis.variable);
+        }
+    }
+};
+/*----------------------------------------------------------------------------*/
+class snapshot_reader
+{
+private:
+    const std::string &buffer;
+    std::size_t position;
+    index constants_count = 0;
+    index variables_count = 0;
+
+public:
+    snapshot_reader(
+            const std::string &buffer_in,
+            const std::size_t position_in):
+        buffer(buffer_in),
+        position(position_in)
+    {
+    }
+
+    void set_symbols_counts(
+            const index constants_count_in,
+            const index variables_count_in)
+    {
+        constants_count = constants_count_in;
+        variables_count = variables_count_in;
+    }
+
+    bool at_end() const
+    {
+        return position == buffer.size();
+    }
+
+    std::int64_t read_integer()
+    {
+        std::int64_t result;
+        if (buffer.size() - position < sizeof(result))
+            throw std::runtime_error("truncated database snapshot");
+        std::memcpy(&result, buffer.data() + position, sizeof(result));
+        position += sizeof(result);
+        return result;
+    }
+
+    /* Reads a count of elements, each taking at least element_size bytes. */
+    index read_count(const std::size_t element_size)
+    {
+        const std::int64_t result = read_integer();
+        if (
+                result < 0
+                || static_cast<std::uint64_t>(result)
+                > (buffer.size() - position) / element_size)
+            throw std::runtime_error("corrupted database snapshot");
+        return result;
+    }
+
+    std::string read_string()
+    {
+        const index size = read_count(1);
+        std::string result(buffer.data() + position, size);
+        position += size;
+        return result;
+    }
+
+    symbol_index read_symbol()
+    {
+        const std::int64_t value = read_integer();
+        if (value < -variables_count || value >= constants_count)
+            throw std::runtime_error("corrupted database snapshot");
+        return
+                value < 0
+                ? symbol_index{symbol::type_t::variable, -value - 1}
+                : symbol_index{symbol::type_t::constant, value};
+    }
+
+    expression read_expression()
+    {
+        expression result(read_count(sizeof(std::int64_t)));
+        for (auto &symbol_0 : result)
+            symbol_0 = read_symbol();
+        return result;
+    }
+
+    std::vector<disjoint_variable_restriction> read_restrictions()
+    {
+        std::vector<disjoint_variable_restriction> result(
+                    read_count(2 * sizeof(std::int64_t)));
+        for (auto &restriction : result)
+        {
+            restriction[0] = read_symbol();
+            restriction[1] = read_symbol();
+        }
+        return result;
+    }
+
+    std::vector<floating_hypothesis> read_floating_hypotheses()
+    {
+        std::vector<floating_hypothesis> result(
+                    read_count(3 * sizeof(std::int64_t)));
+        for (auto &hypothesis : result)
+        {
+            hypothesis.label = read_string();
+            hypothesis.type = read_symbol();
+            hypothesis.variable = read_symbol();
+        }
+        return result;
+    }
+};
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+void write_database_snapshot(
+        const metamath_database &database,
+        const std::string &source_stamp,
+        std::ostream &output_stream)
+{
+    snapshot_writer writer;
+    writer.write_string(source_stamp);
+
+    for (
+            const auto &[begin, end] : {
+                std::make_pair(
+                    database.constants_begin(),
+                    database.constants_end()),
+                std::make_pair(
+                    database.variables_begin(),
+                    database.variables_end())})
+    {
+        writer.write_integer((*end).second);
+        for (auto i = begin; i != end; ++i)
+            writer.write_string(database.get_symbol_label(*i));
+    }
+
+    writer.write_integer((*database.assertions_end()).get_index());
+    for (
+            auto i = database.assertions_begin();
+            i != database.assertions_end();
+            ++i)
+    {
+        const assertion &assertion_0 = database.get_assertion(*i);
+        writer.write_string(assertion_0.label);
+        writer.write_integer(static_cast<std::int64_t>(assertion_0.type));
+        writer.write_restrictions(assertion_0.disjoint_variable_restrictions);
+        writer.write_floating_hypotheses(assertion_0.floating_hypotheses);
+        writer.write_integer(assertion_0.essential_hypotheses.size());
+        for (const auto &hypothesis : assertion_0.essential_hypotheses)
+        {
+            writer.write_string(hypothesis.label);
+            writer.write_expression(hypothesis.expression_0);
+        }
+        writer.write_expression(assertion_0.expression_0);
+
+        const proof &proof_0 = assertion_0.proof_0;
+        writer.write_restrictions(proof_0.disjoint_variable_restrictions);
+        writer.write_floating_hypotheses(proof_0.floating_hypotheses);
+        writer.write_integer(proof_0.steps.size());
+        for (const auto &step : proof_0.steps)
+        {
+            writer.write_integer(static_cast<std::int64_t>(step.type));
+            writer.write_integer(step.index_0);
+            writer.write_integer(step.assumptions_count);
+        }
+    }
+
+    output_stream.write(snapshot_magic.data(), snapshot_magic.size());
+    output_stream.write(
+                writer.get_buffer().data(),
+                writer.get_buffer().size());
+    if (!output_stream)
+        throw std::runtime_error("writing database snapshot failed");
+}
+/*----------------------------------------------------------------------------*/
+bool read_database_snapshot(
+        metamath_database &database,
+        const std::string &source_stamp,
+        std::istream &input_stream)
+{
+    const std::string buffer(
+                (std::istreambuf_iterator<char>(input_stream)),
+                std::istreambuf_iterator<char>());
+    if (buffer.compare(0, snapshot_magic.size(), snapshot_magic) != 0)
+        return false;
+    snapshot_reader reader(buffer, snapshot_magic.size());
+    if (reader.read_string() != source_stamp)
+        return false;
+
+    const index constants_count = reader.read_count(sizeof(std::int64_t));
+    for (index i = 0; i < constants_count; ++i)
+        database.add_constant(reader.read_string());
+    const index variables_count = reader.read_count(sizeof(std::int64_t));
+    for (index i = 0; i < variables_count; ++i)
+        database.add_variable(reader.read_string());
+    reader.set_symbols_counts(constants_count, variables_count);
+
+    const index assertions_count = reader.read_count(sizeof(std::int64_t));
+    for (index i = 0; i < assertions_count; ++i)
+    {
+        assertion assertion_0;
+        assertion_0.label = reader.read_string();
+        assertion_0.type =
+                static_cast<assertion::type_t>(reader.read_integer());
+        assertion_0.disjoint_variable_restrictions =
+                reader.read_restrictions();
+        assertion_0.floating_hypotheses = reader.read_floating_hypotheses();
+        assertion_0.essential_hypotheses.resize(
+                    reader.read_count(2 * sizeof(std::int64_t)));
+        for (auto &hypothesis : assertion_0.essential_hypotheses)
+        {
+            hypothesis.label = reader.read_string();
+            hypothesis.expression_0 = reader.read_expression();
+        }
+        assertion_0.expression_0 = reader.read_expression();
+
+        proof &proof_0 = assertion_0.proof_0;
+        proof_0.disjoint_variable_restrictions = reader.read_restrictions();
+        proof_0.floating_hypotheses = reader.read_floating_hypotheses();
+        proof_0.steps.resize(reader.read_count(3 * sizeof(std::int64_t)));
+        for (auto &step : proof_0.steps)
+        {
+            step.type = static_cast<proof_step::type_t>(reader.read_integer());
+            step.index_0 = reader.read_integer();
+            step.assumptions_count = reader.read_integer();
+        }
+        database.add_assertion(std::move(assertion_0));
+    }
+
+    if (!reader.at_end())
+        throw std::runtime_error("corrupted database snapshot");
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
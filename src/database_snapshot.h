@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef DATABASE_SNAPSHOT_H
+#define DATABASE_SNAPSHOT_H
+
+#include "metamath_database.h"
+
+#include <iostream>
+#include <string>
+
+namespace metamath_playground {
+
+/* Binary image of a database, loaded much faster than the source is parsed.
+ * Legacy frames and source locations are not stored. Snapshots use the
+ * native byte order and are meant to be read on the machine which wrote
+ * them.
+ *
+ * source_stamp identifies the source the database was read from, e.g. its
+ * size and modification time, so that stale snapshots are not used. */
+void write_database_snapshot(
+        const metamath_database &database,
+        const std::string &source_stamp,
+        std::ostream &output_stream);
+
+/* Returns false if the stream is not a snapshot of this version or of the
+ * given source, database is left unchanged then. database must be empty.
+ * Throws std::runtime_error if the snapshot is truncated or refers to
+ * missing symbols. */
+bool read_database_snapshot(
+        metamath_database &database,
+        const std::string &source_stamp,
+        std::istream &input_stream);
+
+} /* namespace metamath_playground */
+
+#endif /* DATABASE_SNAPSHOT_H */
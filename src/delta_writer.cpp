@@ -0,0 +1,323 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "delta_writer.h"
+#include "allocation_tracker.h"
+#include "compressed_proof_writer.h"
+#include "legacy_frame.h"
+#include "span_tracer.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+std::runtime_error system_error(const std::string &message)
+{
+    return std::runtime_error(message + ": " + std::strerror(errno));
+}
+/*----------------------------------------------------------------------------*/
+class mapped_file
+{
+private:
+    const char *data = nullptr;
+    index size = 0;
+
+public:
+    explicit mapped_file(const int file_descriptor)
+    {
+        struct stat status;
+        if (::fstat(file_descriptor, &status) != 0)
+            throw system_error("reading source file status failed");
+        size = status.st_size;
+        if (size == 0)
+            return;
+        void *const mapping =
+                ::mmap(
+                    nullptr,
+                    size,
+                    PROT_READ,
+                    MAP_PRIVATE,
+                    file_descriptor,
+                    0);
+        if (mapping == MAP_FAILED)
+            throw system_error("mapping source file failed");
+        data = static_cast<const char *>(mapping);
+    }
+    mapped_file(const mapped_file &) = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+    ~mapped_file()
+    {
+        if (data != nullptr)
+            ::munmap(const_cast<char *>(data), size);
+    }
+
+    const char *get_data() const
+    {
+        return data;
+    }
+
+    index get_size() const
+    {
+        return size;
+    }
+};
+/*----------------------------------------------------------------------------*/
+void write_all(const int file_descriptor, const char *data, index size)
+{
+    while (size > 0)
+    {
+        const ssize_t written = ::write(file_descriptor, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw system_error("writing database failed");
+        }
+        data += written;
+        size -= written;
+    }
+}
+/*----------------------------------------------------------------------------*/
+/* Copies [begin, end) of the source to the current position of the output. */
+void copy_region(
+        const mapped_file &source,
+        const int source_file_descriptor,
+        const int output_file_descriptor,
+        index begin,
+        const index end)
+{
+#ifdef __linux__
+    while (begin < end)
+    {
+        loff_t source_offset = begin;
+        const ssize_t copied =
+                ::copy_file_range(
+                    source_file_descriptor,
+                    &source_offset,
+                    output_file_descriptor,
+                    nullptr,
+                    end - begin,
+                    0);
+        if (copied < 0 && errno == EINTR)
+            continue;
+        /* not supported for these files, fall back to writing */
+        if (copied <= 0)
+            break;
+        begin += copied;
+    }
+#endif
+    write_all(output_file_descriptor, source.get_data() + begin, end - begin);
+}
+/*----------------------------------------------------------------------------*/
+std::string read_label(const mapped_file &source, const index offset)
+{
+    const char *const begin = source.get_data() + offset;
+    const char *const end =
+            std::find_if(
+                begin,
+                source.get_data() + source.get_size(),
+                [] (const char character)
+                {
+                    return
+                            character == ' ' || character == '\t'
+                            || character == '\n' || character == '\r'
+                            || character == '\f' || character == '\v';
+                });
+    return std::string(begin, end);
+}
+/*----------------------------------------------------------------------------*/
+index get_column(const mapped_file &source, const index offset)
+{
+    const char *const begin = source.get_data();
+    const char *line_begin = begin + offset;
+    while (line_begin != begin && line_begin[-1] != '\n')
+        --line_begin;
+    return begin + offset - line_begin;
+}
+/*----------------------------------------------------------------------------*/
+proof_source_context make_source_context(
+        const metamath_database &database,
+        const mapped_file &source,
+        const assertion_index assertion_index_0)
+{
+    const assertion &assertion_0 = database.get_assertion(assertion_index_0);
+    const source_location &location =
+            *database.get_source_location(assertion_index_0);
+    const legacy_frame_registry &legacy_frames = *database.get_legacy_frames();
+
+    proof_source_context context;
+    const index floating_count = assertion_0.floating_hypotheses.size();
+    const index frame_size =
+            legacy_frames.get_frame_size(assertion_index_0.get_index());
+    if (
+            frame_size
+            != floating_count
+            + static_cast<index>(assertion_0.essential_hypotheses.size()))
+        throw std::runtime_error(
+                "legacy frame does not match " + assertion_0.label);
+    context.mandatory_numbers.resize(frame_size);
+    for (index position = 0; position < frame_size; ++position)
+    {
+        const frame_entry entry =
+                legacy_frames.get_entry(
+                    assertion_index_0.get_index(),
+                    position);
+        const index internal_position =
+                entry.type == frame_entry::type_t::floating_hypothesis
+                ? entry.index_0
+                : floating_count + entry.index_0;
+        context.mandatory_numbers[internal_position] = position + 1;
+    }
+
+    for (const auto &hypothesis : assertion_0.proof_0.floating_hypotheses)
+    {
+        const auto found =
+                std::find_if(
+                    location.proof_floating_hypotheses.begin(),
+                    location.proof_floating_hypotheses.end(),
+                    [&] (const floating_hypothesis &available)
+                    {
+                        return
+                                available.type == hypothesis.type
+                                && available.variable == hypothesis.variable;
+                    });
+        if (found == location.proof_floating_hypotheses.end())
+            throw std::runtime_error(
+                    "proof of " + assertion_0.label + " uses floating "
+                    "hypothesis not available in the source");
+        context.floating_hypothesis_labels.push_back(found->label);
+    }
+
+    for (const auto &restriction :
+         assertion_0.proof_0.disjoint_variable_restrictions)
+    {
+        const auto &available = location.proof_disjoint_variable_restrictions;
+        const disjoint_variable_restriction swapped{
+                    {restriction[1], restriction[0]}};
+        if (
+                std::find(available.begin(), available.end(), restriction)
+                    == available.end()
+                && std::find(available.begin(), available.end(), swapped)
+                    == available.end())
+            throw std::runtime_error(
+                    "proof of " + assertion_0.label + " uses disjoint "
+                    "variable restriction not available in the source");
+    }
+
+    context.get_assertion_label =
+            [&database, &source, assertion_index_0] (
+                const assertion_index referred)
+            {
+                const source_location *const referred_location =
+                        database.get_source_location(referred);
+                if (
+                        referred_location == nullptr
+                        || referred.get_index()
+                            >= assertion_index_0.get_index())
+                    throw std::runtime_error(
+                            "proof refers to assertion not available in the "
+                            "source: "
+                            + database.get_assertion(referred).label);
+                return read_label(source, referred_location->statement_begin);
+            };
+    return context;
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+void write_database_delta(
+        const metamath_database &database,
+        const int source_file_descriptor,
+        const int output_file_descriptor)
+{
+    const trace_span span("write_database_delta");
+    const allocation_phase_scope phase(allocation_phase::write);
+    if (database.get_legacy_frames() == nullptr)
+        throw std::runtime_error(
+                "delta write requires legacy frames retained after reading");
+
+    const mapped_file source(source_file_descriptor);
+    const index assertions_count = (*database.assertions_end()).get_index();
+    compressed_proof_writer proof_writer(database);
+    std::string proof_buffer;
+    index position = 0;
+
+    for (index i = 0; i < assertions_count; ++i)
+    {
+        const assertion_index assertion_index_0(i);
+        if (!database.is_modified(assertion_index_0))
+            continue;
+        const source_location *const location =
+                database.get_source_location(assertion_index_0);
+        if (
+                location == nullptr
+                || location->proof_begin < position
+                || location->proof_end > source.get_size()
+                || location->proof_begin == location->proof_end)
+            throw std::runtime_error(
+                    "no source location of modified assertion "
+                    + database.get_assertion(assertion_index_0).label);
+
+        const proof_source_context context =
+                make_source_context(database, source, assertion_index_0);
+        /* Source reads children of assertion steps in legacy frame order. */
+        assertion legacy_assertion = database.get_assertion(assertion_index_0);
+        restore_legacy_order(
+                    legacy_assertion.proof_0,
+                    *database.get_legacy_frames());
+        proof_buffer.clear();
+        proof_writer.write(
+                    legacy_assertion,
+                    context,
+                    get_column(source, location->proof_begin),
+                    proof_buffer);
+
+        copy_region(
+                    source,
+                    source_file_descriptor,
+                    output_file_descriptor,
+                    position,
+                    location->proof_begin);
+        write_all(
+                    output_file_descriptor,
+                    proof_buffer.data(),
+                    proof_buffer.size());
+        position = location->proof_end;
+    }
+
+    copy_region(
+                source,
+                source_file_descriptor,
+                output_file_descriptor,
+                position,
+                source.get_size());
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
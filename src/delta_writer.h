@@ -0,0 +1,45 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef DELTA_WRITER_H
+#define DELTA_WRITER_H
+
+#include "metamath_database.h"
+
+namespace metamath_playground {
+
+/* Writes the file, from which the database was read, with only proofs of
+ * modified assertions replaced. Unchanged bytes are copied from the source,
+ * with copy_file_range where possible. The database must be read with
+ * retain_legacy_frames and retain_source_locations, the output must be a
+ * different file than the source.
+ *
+ * New proofs are written in the terms of the source file, so they may use
+ * only non-mandatory hypotheses and disjoint variable restrictions of the
+ * original proof and assertions read from the file before. Otherwise
+ * std::runtime_error is thrown and the whole database has to be written
+ * with write_database_to_file. */
+void write_database_delta(
+        const metamath_database &database,
+        int source_file_descriptor,
+        int output_file_descriptor);
+
+} /* namespace metamath_playground */
+
+#endif /* DELTA_WRITER_H */
@@ -0,0 +1,690 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "expression_parser.h"
+#include "span_tracer.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+/* Top-down parser memoizing all parses of each nonterminal at each position
+ * of one expression. Parses of a nonterminal from a position are kept only
+ * once per end position, a second parse marks the kept one as ambiguous. */
+class expression_parser
+{
+private:
+    struct parse_item
+    {
+        index end;
+        parse_node node;
+        /* in children, ordered as floating hypotheses of the axiom */
+        index children_begin;
+        index children_count;
+        bool ambiguous;
+    };
+
+    struct memo_entry
+    {
+        enum class state_t : std::uint8_t
+        {
+            unknown,
+            in_progress,
+            done
+        };
+
+        state_t state = state_t::unknown;
+        /* range in results */
+        index results_begin = 0;
+        index results_end = 0;
+    };
+
+    const grammar &grammar_0;
+    const expression &expression_0;
+    const index length;
+    /* nonterminal of the variable at each position, -1 for constants */
+    std::vector<index> variable_nonterminals;
+    std::vector<memo_entry> memo;
+    std::vector<parse_item> items;
+    std::vector<index> children;
+    std::vector<index> results;
+
+public:
+    expression_parser(
+            const grammar &grammar_in,
+            const expression &expression_in,
+            const std::vector<floating_hypothesis> &floating_hypotheses);
+
+    parse_tree parse();
+
+private:
+    std::pair<index, index> parse_nonterminal(
+            index nonterminal,
+            index position);
+    void match_rule(
+            index rule_index,
+            index body_position,
+            index position,
+            std::vector<index> &matched,
+            std::vector<index> &found);
+    void add_item(
+            index rule_index,
+            index end,
+            const std::vector<index> &matched,
+            std::vector<index> &found);
+    void write_tree(index item, parse_tree &tree) const;
+};
+/*----------------------------------------------------------------------------*/
+expression_parser::expression_parser(
+        const grammar &grammar_in,
+        const expression &expression_in,
+        const std::vector<floating_hypothesis> &floating_hypotheses):
+    grammar_0(grammar_in),
+    expression_0(expression_in),
+    length(expression_in.size()),
+    variable_nonterminals(expression_in.size(), -1),
+    memo((expression_in.size() + 1) * grammar_in.get_nonterminals_count())
+{
+    for (index position = 0; position < length; ++position)
+    {
+        const symbol_index symbol_0 = expression_0[position];
+        if (symbol_0.first != symbol::type_t::variable)
+            continue;
+        for (const auto &hypothesis : floating_hypotheses)
+            if (hypothesis.variable == symbol_0)
+            {
+                variable_nonterminals[position] =
+                        grammar_0.get_nonterminal(hypothesis.type);
+                break;
+            }
+    }
+}
+/*----------------------------------------------------------------------------*/
+parse_tree expression_parser::parse()
+{
+    if (length == 0)
+        throw std::runtime_error("empty expression");
+    const index root_nonterminal = grammar_0.get_nonterminal(expression_0[0]);
+    if (root_nonterminal == -1)
+        throw std::runtime_error("typecode without syntax axioms");
+
+    const auto [begin, end] = parse_nonterminal(root_nonterminal, 1);
+    for (index i = begin; i < end; ++i)
+    {
+        const parse_item &item = items[results[i]];
+        if (item.end != length)
+            continue;
+        if (item.ambiguous)
+            throw std::runtime_error("ambiguous expression");
+        parse_tree tree;
+        write_tree(results[i], tree);
+        return tree;
+    }
+    throw std::runtime_error("expression does not parse");
+}
+/*----------------------------------------------------------------------------*/
+std::pair<index, index> expression_parser::parse_nonterminal(
+        const index nonterminal,
+        const index position)
+{
+    const index memo_index =
+            position * grammar_0.get_nonterminals_count() + nonterminal;
+    switch (memo[memo_index].state)
+    {
+    case memo_entry::state_t::done:
+        return {memo[memo_index].results_begin, memo[memo_index].results_end};
+    case memo_entry::state_t::in_progress:
+        /* left recursion, not supported */
+        return {0, 0};
+    case memo_entry::state_t::unknown:
+        break;
+    }
+    memo[memo_index].state = memo_entry::state_t::in_progress;
+
+    std::vector<index> found;
+    std::vector<index> matched;
+    if (
+            position < length
+            && variable_nonterminals[position] == nonterminal)
+    {
+        found.push_back(items.size());
+        items.push_back(
+                    parse_item{
+                        position + 1,
+                        parse_node{
+                            parse_node::type_t::variable,
+                            expression_0[position].second},
+                        0,
+                        0,
+                        false});
+    }
+    if (
+            position < length
+            && expression_0[position].first == symbol::type_t::constant)
+        for (
+                const index rule_index :
+                grammar_0.get_rules_by_first_constant(
+                    nonterminal,
+                    expression_0[position].second))
+            match_rule(rule_index, 0, position, matched, found);
+    for (
+            const index rule_index :
+            grammar_0.get_rules_by_first_nonterminal(nonterminal))
+        match_rule(rule_index, 0, position, matched, found);
+
+    memo[memo_index].state = memo_entry::state_t::done;
+    memo[memo_index].results_begin = results.size();
+    results.insert(results.end(), found.begin(), found.end());
+    memo[memo_index].results_end = results.size();
+    return {memo[memo_index].results_begin, memo[memo_index].results_end};
+}
+/*----------------------------------------------------------------------------*/
+void expression_parser::match_rule(
+        const index rule_index,
+        const index body_position,
+        const index position,
+        std::vector<index> &matched,
+        std::vector<index> &found)
+{
+    const grammar::rule &rule_0 = grammar_0.get_rule(rule_index);
+    if (body_position == static_cast<index>(rule_0.body.size()))
+    {
+        add_item(rule_index, position, matched, found);
+        return;
+    }
+
+    const grammar::rule_symbol &symbol_0 = rule_0.body[body_position];
+    if (!symbol_0.is_nonterminal)
+    {
+        if (
+                position < length
+                && expression_0[position]
+                    == symbol_index(symbol::type_t::constant, symbol_0.value))
+            match_rule(
+                        rule_index,
+                        body_position + 1,
+                        position + 1,
+                        matched,
+                        found);
+        return;
+    }
+
+    const auto [begin, end] = parse_nonterminal(symbol_0.value, position);
+    for (index i = begin; i < end; ++i)
+    {
+        matched.push_back(results[i]);
+        match_rule(
+                    rule_index,
+                    body_position + 1,
+                    items[results[i]].end,
+                    matched,
+                    found);
+        matched.pop_back();
+    }
+}
+/*----------------------------------------------------------------------------*/
+void expression_parser::add_item(
+        const index rule_index,
+        const index end,
+        const std::vector<index> &matched,
+        std::vector<index> &found)
+{
+    for (const index other : found)
+        if (items[other].end == end)
+        {
+            items[other].ambiguous = true;
+            return;
+        }
+
+    const grammar::rule &rule_0 = grammar_0.get_rule(rule_index);
+    parse_item item{
+        end,
+        parse_node{
+            parse_node::type_t::syntax_axiom,
+            rule_0.axiom.get_index()},
+        static_cast<index>(children.size()),
+        static_cast<index>(matched.size()),
+        false};
+    children.resize(children.size() + matched.size());
+    index matched_position = 0;
+    for (const auto &symbol_0 : rule_0.body)
+    {
+        if (!symbol_0.is_nonterminal)
+            continue;
+        const index child = matched[matched_position++];
+        children[item.children_begin + symbol_0.hypothesis] = child;
+        item.ambiguous = item.ambiguous || items[child].ambiguous;
+    }
+    found.push_back(items.size());
+    items.push_back(item);
+}
+/*----------------------------------------------------------------------------*/
+void expression_parser::write_tree(const index item, parse_tree &tree) const
+{
+    const parse_item &parse_item_0 = items[item];
+    for (index i = 0; i < parse_item_0.children_count; ++i)
+        write_tree(children[parse_item_0.children_begin + i], tree);
+    tree.push_back(parse_item_0.node);
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+grammar::grammar(
+        const std::string &provable_typecode_label_in,
+        const std::string &logical_typecode_label_in):
+    provable_typecode_label(provable_typecode_label_in),
+    logical_typecode_label(logical_typecode_label_in)
+{
+}
+/*----------------------------------------------------------------------------*/
+grammar::grammar(
+        const metamath_database &database,
+        const std::string &provable_typecode_label_in,
+        const std::string &logical_typecode_label_in):
+    grammar(provable_typecode_label_in, logical_typecode_label_in)
+{
+    for (
+            auto i = database.assertions_begin();
+            i != database.assertions_end();
+            ++i)
+        add_assertion(database, *i);
+}
+/*----------------------------------------------------------------------------*/
+void grammar::add_assertion(
+        const metamath_database &database,
+        const assertion_index assertion_index_0)
+{
+    /* typecodes are declared before the first assertion using them */
+    const auto resolve =
+            [&database] (index &typecode, const std::string &label)
+            {
+                if (typecode != -1)
+                    return;
+                const symbol_index found = database.find_symbol(label);
+                if (
+                        database.is_valid(found)
+                        && found.first == symbol::type_t::constant)
+                    typecode = found.second;
+            };
+    resolve(provable_typecode, provable_typecode_label);
+    resolve(logical_typecode, logical_typecode_label);
+
+    const auto add_nonterminal =
+            [this] (const symbol_index typecode)
+            {
+                if (
+                        typecode.first != symbol::type_t::constant
+                        || typecode.second == provable_typecode)
+                    return;
+                if (typecode.second >= static_cast<index>(nonterminals.size()))
+                    nonterminals.resize(typecode.second + 1, -1);
+                if (nonterminals[typecode.second] == -1)
+                {
+                    nonterminals[typecode.second] = nonterminals_count++;
+                    rules_by_first_nonterminal.emplace_back();
+                }
+            };
+
+    const assertion &assertion_0 = database.get_assertion(assertion_index_0);
+    for (const auto &hypothesis : assertion_0.floating_hypotheses)
+        add_nonterminal(hypothesis.type);
+    for (const auto &hypothesis : assertion_0.proof_0.floating_hypotheses)
+        add_nonterminal(hypothesis.type);
+    if (
+            assertion_0.type != assertion::type_t::axiom
+            || !assertion_0.essential_hypotheses.empty()
+            || assertion_0.expression_0.empty()
+            || assertion_0.expression_0[0]
+                == symbol_index(symbol::type_t::constant, provable_typecode))
+        return;
+    add_nonterminal(assertion_0.expression_0[0]);
+
+    const auto &hypotheses = assertion_0.floating_hypotheses;
+    rule rule_0{assertion_index_0, {}};
+    std::vector<bool> used(hypotheses.size(), false);
+    for (
+            auto symbol_0 = assertion_0.expression_0.begin() + 1;
+            symbol_0 != assertion_0.expression_0.end();
+            ++symbol_0)
+    {
+        if (symbol_0->first == symbol::type_t::constant)
+        {
+            rule_0.body.push_back(rule_symbol{false, symbol_0->second, -1});
+            continue;
+        }
+        index hypothesis = 0;
+        while (
+                hypothesis < static_cast<index>(hypotheses.size())
+                && hypotheses[hypothesis].variable != *symbol_0)
+            ++hypothesis;
+        if (
+                hypothesis == static_cast<index>(hypotheses.size())
+                || used[hypothesis])
+            throw std::runtime_error(
+                    "syntax axiom " + assertion_0.label
+                    + " does not use each variable once");
+        used[hypothesis] = true;
+        rule_0.body.push_back(
+                    rule_symbol{
+                        true,
+                        get_nonterminal(hypotheses[hypothesis].type),
+                        hypothesis});
+    }
+    for (const bool used_0 : used)
+        if (!used_0)
+            throw std::runtime_error(
+                    "syntax axiom " + assertion_0.label
+                    + " does not use each variable once");
+
+    const index nonterminal = get_nonterminal(assertion_0.expression_0[0]);
+    const index rule_index = rules.size();
+    if (!rule_0.body.empty() && !rule_0.body[0].is_nonterminal)
+    {
+        const index constant = rule_0.body[0].value;
+        if (constant >= static_cast<index>(rules_by_first_constant.size()))
+            rules_by_first_constant.resize(constant + 1);
+        auto &by_nonterminal = rules_by_first_constant[constant];
+        if (nonterminal >= static_cast<index>(by_nonterminal.size()))
+            by_nonterminal.resize(nonterminal + 1);
+        by_nonterminal[nonterminal].push_back(rule_index);
+    }
+    else
+        rules_by_first_nonterminal[nonterminal].push_back(rule_index);
+    rules.push_back(std::move(rule_0));
+}
+/*----------------------------------------------------------------------------*/
+index grammar::get_nonterminal(const symbol_index typecode) const
+{
+    if (typecode.first != symbol::type_t::constant)
+        return -1;
+    const index constant =
+            typecode.second == provable_typecode
+            ? logical_typecode
+            : typecode.second;
+    if (
+            constant == -1
+            || constant >= static_cast<index>(nonterminals.size()))
+        return -1;
+    return nonterminals[constant];
+}
+/*----------------------------------------------------------------------------*/
+const std::vector<index> &grammar::get_rules_by_first_constant(
+        const index nonterminal,
+        const index constant) const
+{
+    static const std::vector<index> no_rules;
+    if (constant >= static_cast<index>(rules_by_first_constant.size()))
+        return no_rules;
+    const auto &by_nonterminal = rules_by_first_constant[constant];
+    if (nonterminal >= static_cast<index>(by_nonterminal.size()))
+        return no_rules;
+    return by_nonterminal[nonterminal];
+}
+/*----------------------------------------------------------------------------*/
+parse_tree parse_expression(
+        const grammar &grammar_0,
+        const expression &expression_0,
+        const std::vector<floating_hypothesis> &floating_hypotheses)
+{
+    return
+            expression_parser(grammar_0, expression_0, floating_hypotheses)
+                .parse();
+}
+/*----------------------------------------------------------------------------*/
+index find_floating_hypothesis(
+        const std::vector<floating_hypothesis> &hypotheses,
+        const index variable)
+{
+    for (index i = 0; i < static_cast<index>(hypotheses.size()); ++i)
+        if (hypotheses[i].variable.second == variable)
+            return i;
+    return -1;
+}
+/*----------------------------------------------------------------------------*/
+std::vector<index> get_subtree_sizes(
+        const std::span<const parse_node> tree,
+        const std::vector<index> &arities)
+{
+    std::vector<index> sizes(tree.size());
+    for (index i = 0; i < static_cast<index>(tree.size()); ++i)
+    {
+        index size = 1;
+        if (tree[i].type == parse_node::type_t::syntax_axiom)
+        {
+            index child = i - 1;
+            for (index j = 0; j < arities[tree[i].index_0]; ++j)
+            {
+                size += sizes[child];
+                child -= sizes[child];
+            }
+        }
+        sizes[i] = size;
+    }
+    return sizes;
+}
+/*----------------------------------------------------------------------------*/
+bool match_tree(
+        const assertion &applied,
+        const std::span<const parse_node> pattern,
+        const std::span<const parse_node> ground,
+        const std::vector<index> &ground_sizes,
+        tree_substitution &substitution_0)
+{
+    index ground_position = static_cast<index>(ground.size()) - 1;
+    for (
+            index position = static_cast<index>(pattern.size()) - 1;
+            position >= 0;
+            --position)
+    {
+        if (ground_position < 0)
+            return false;
+        const parse_node &node = pattern[position];
+        if (node.type == parse_node::type_t::syntax_axiom)
+        {
+            if (ground[ground_position] != node)
+                return false;
+            --ground_position;
+            continue;
+        }
+        const index hypothesis =
+                find_floating_hypothesis(
+                    applied.floating_hypotheses,
+                    node.index_0);
+        const index size = ground_sizes[ground_position];
+        const std::span<const parse_node> value =
+                ground.subspan(ground_position + 1 - size, size);
+        parse_tree &bound = substitution_0[hypothesis];
+        if (bound.empty())
+            bound.assign(value.begin(), value.end());
+        else if (!std::equal(
+                    bound.begin(),
+                    bound.end(),
+                    value.begin(),
+                    value.end()))
+            return false;
+        ground_position -= size;
+    }
+    return ground_position == -1;
+}
+/*----------------------------------------------------------------------------*/
+parse_tree substitute_tree(
+        const assertion &applied,
+        const std::span<const parse_node> pattern,
+        const tree_substitution &substitution_0,
+        const index first_metavariable)
+{
+    parse_tree result;
+    for (const auto &node : pattern)
+    {
+        if (node.type == parse_node::type_t::syntax_axiom)
+        {
+            result.push_back(node);
+            continue;
+        }
+        const parse_tree &value =
+                substitution_0[
+                    find_floating_hypothesis(
+                        applied.floating_hypotheses,
+                        node.index_0)];
+        if (value.empty())
+            result.push_back(
+                        parse_node{
+                            parse_node::type_t::variable,
+                            first_metavariable + node.index_0});
+        else
+            result.insert(result.end(), value.begin(), value.end());
+    }
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+void parse_tree_cache::add_assertion(
+        const std::vector<parse_tree> &essential_hypotheses,
+        const parse_tree &expression_tree)
+{
+    for (const auto &tree : essential_hypotheses)
+    {
+        nodes.insert(nodes.end(), tree.begin(), tree.end());
+        node_offsets.push_back(nodes.size());
+    }
+    nodes.insert(nodes.end(), expression_tree.begin(), expression_tree.end());
+    node_offsets.push_back(nodes.size());
+    statement_offsets.push_back(node_offsets.size() - 1);
+}
+/*----------------------------------------------------------------------------*/
+std::span<const parse_node> parse_tree_cache::get_hypothesis_tree(
+        const assertion_index assertion_index_0,
+        const index hypothesis) const
+{
+    return
+            get_tree(
+                statement_offsets[assertion_index_0.get_index()] + hypothesis);
+}
+/*----------------------------------------------------------------------------*/
+std::span<const parse_node> parse_tree_cache::get_expression_tree(
+        const assertion_index assertion_index_0) const
+{
+    return get_tree(statement_offsets[assertion_index_0.get_index() + 1] - 1);
+}
+/*----------------------------------------------------------------------------*/
+bool parse_tree_cache::is_parsed(const assertion_index assertion_index_0) const
+{
+    for (
+            index i = statement_offsets[assertion_index_0.get_index()];
+            i < statement_offsets[assertion_index_0.get_index() + 1];
+            ++i)
+        if (node_offsets[i] == node_offsets[i + 1])
+            return false;
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+std::size_t parse_tree_cache::memory_usage() const
+{
+    std::size_t result =
+            nodes.capacity() * sizeof(parse_node)
+            + node_offsets.capacity() * sizeof(std::uint32_t)
+            + statement_offsets.capacity() * sizeof(std::uint32_t)
+            + errors.capacity() * sizeof(std::string);
+    for (const auto &error : errors)
+        result += error.capacity();
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+std::span<const parse_node> parse_tree_cache::get_tree(
+        const index statement) const
+{
+    return
+            std::span<const parse_node>(
+                nodes.data() + node_offsets[statement],
+                node_offsets[statement + 1] - node_offsets[statement]);
+}
+/*----------------------------------------------------------------------------*/
+std::shared_ptr<const parse_tree_cache> parse_database(
+        const metamath_database &database,
+        const grammar &grammar_0,
+        const unsigned threads_count)
+{
+    const trace_span span("parse_database");
+    const index assertions_count = (*database.assertions_end()).get_index();
+    std::vector<std::vector<parse_tree>> hypothesis_trees(assertions_count);
+    std::vector<parse_tree> expression_trees(assertions_count);
+    /* first error of each assertion, empty if all its statements parse */
+    std::vector<std::string> errors(assertions_count);
+
+    thread_pool pool(threads_count);
+    parallel_for(
+                pool,
+                assertions_count,
+                [&] (const index i)
+                {
+                    const assertion &assertion_0 =
+                            database.get_assertion(assertion_index(i));
+                    const auto parse =
+                            [&] (const expression &expression_0)
+                            {
+                                try
+                                {
+                                    return parse_expression(
+                                                grammar_0,
+                                                expression_0,
+                                                assertion_0
+                                                    .floating_hypotheses);
+                                }
+                                catch (const std::runtime_error &error)
+                                {
+                                    if (errors[i].empty())
+                                        errors[i] =
+                                                "parsing " + assertion_0.label
+                                                + ": " + error.what();
+                                    return parse_tree();
+                                }
+                            };
+                    for (
+                            const auto &hypothesis :
+                            assertion_0.essential_hypotheses)
+                        hypothesis_trees[i].push_back(
+                                    parse(hypothesis.expression_0));
+                    expression_trees[i] = parse(assertion_0.expression_0);
+                });
+
+    auto cache = std::make_shared<parse_tree_cache>();
+    for (index i = 0; i < assertions_count; ++i)
+    {
+        cache->add_assertion(hypothesis_trees[i], expression_trees[i]);
+        if (!errors[i].empty())
+            cache->add_error(std::move(errors[i]));
+    }
+    return cache;
+}
+/*----------------------------------------------------------------------------*/
+const parse_tree_cache &get_parse_trees(
+        metamath_database &database,
+        const unsigned threads_count)
+{
+    if (database.get_parse_trees() == nullptr)
+        database.set_parse_trees(
+                    parse_database(database, grammar(database), threads_count));
+    return *database.get_parse_trees();
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
@@ -0,0 +1,253 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EXPRESSION_PARSER_H
+#define EXPRESSION_PARSER_H
+
+#include "metamath_database.h"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace metamath_playground {
+
+struct parse_node
+{
+    enum class type_t : std::uint8_t
+    {
+        variable,
+        syntax_axiom
+    };
+
+    type_t type;
+    /* variable: number of the variable symbol,
+     * syntax_axiom: index of the axiom in database */
+    index index_0;
+
+    bool operator==(const parse_node &) const = default;
+};
+
+/* Nodes in the order of proof steps: children precede their parent, the
+ * root is last. Children of a syntax axiom are subtrees substituted for its
+ * floating hypotheses, in their order, so that a tree is also a proof of the
+ * syntax of its expression. */
+using parse_tree = std::vector<parse_node>;
+
+/* Grammar derived from syntax axioms: axioms without essential hypotheses
+ * whose typecode is not the provable one. Each typecode of syntax axioms or of
+ * floating hypotheses is a nonterminal. Statements with the provable typecode
+ * are parsed as the logical typecode. */
+class grammar
+{
+public:
+    struct rule_symbol
+    {
+        bool is_nonterminal;
+        /* nonterminal or number of constant */
+        index value;
+        /* for nonterminals: position of the floating hypothesis of the
+         * axiom */
+        index hypothesis;
+    };
+
+    struct rule
+    {
+        assertion_index axiom;
+        std::vector<rule_symbol> body;
+    };
+
+private:
+    std::string provable_typecode_label;
+    std::string logical_typecode_label;
+    /* numbers of constants, -1 until declared */
+    index provable_typecode = -1;
+    index logical_typecode = -1;
+    /* nonterminal of each constant, -1 or missing for constants which are not
+     * typecodes */
+    std::vector<index> nonterminals;
+    index nonterminals_count = 0;
+    std::vector<rule> rules;
+    /* Rules of nonterminal n starting with constant c are
+     * rules_by_first_constant[c][n], rules starting with a nonterminal are
+     * rules_by_first_nonterminal[n]. Missing entries are empty. */
+    std::vector<std::vector<std::vector<index>>> rules_by_first_constant;
+    std::vector<std::vector<index>> rules_by_first_nonterminal;
+
+public:
+    explicit grammar(
+            const std::string &provable_typecode_label_in = "|-",
+            const std::string &logical_typecode_label_in = "wff");
+    /* Grammar of all assertions of the database. */
+    explicit grammar(
+            const metamath_database &database,
+            const std::string &provable_typecode_label_in = "|-",
+            const std::string &logical_typecode_label_in = "wff");
+
+    /* Extends the grammar with typecodes of floating hypotheses of the
+     * assertion and, for a syntax axiom, with its rule. Throws
+     * std::runtime_error if a syntax axiom does not use each of its
+     * variables once. */
+    void add_assertion(
+            const metamath_database &database,
+            assertion_index assertion_index_0);
+
+    index get_nonterminals_count() const
+    {
+        return nonterminals_count;
+    }
+
+    /* number of the constant, -1 until declared */
+    index get_provable_typecode() const
+    {
+        return provable_typecode;
+    }
+
+    /* -1 if the typecode is not a nonterminal */
+    index get_nonterminal(symbol_index typecode) const;
+
+    const rule &get_rule(const index rule_index) const
+    {
+        return rules[rule_index];
+    }
+
+    const std::vector<index> &get_rules_by_first_constant(
+            index nonterminal,
+            index constant) const;
+
+    const std::vector<index> &get_rules_by_first_nonterminal(
+            const index nonterminal) const
+    {
+        return rules_by_first_nonterminal[nonterminal];
+    }
+};
+
+/* Parses expression with the typecode as its first symbol, variables are
+ * typed by the floating hypotheses. Uses a memoizing top-down parser which
+ * explores all alternatives, so the grammar does not need to be LL or PEG,
+ * but must not be left recursive. Throws std::runtime_error if the
+ * expression does not parse or parses in more than one way. */
+parse_tree parse_expression(
+        const grammar &grammar_0,
+        const expression &expression_0,
+        const std::vector<floating_hypothesis> &floating_hypotheses);
+
+/* Substitution for the variables of an assertion, indexed by its floating
+ * hypotheses. Empty trees stand for unbound variables. */
+using tree_substitution = std::vector<parse_tree>;
+
+/* Position of the floating hypothesis of the variable, -1 if none. */
+index find_floating_hypothesis(
+        const std::vector<floating_hypothesis> &hypotheses,
+        index variable);
+
+/* Sizes of subtrees ending at each position of the tree. arities[a] is the
+ * number of floating hypotheses of assertion a. */
+std::vector<index> get_subtree_sizes(
+        std::span<const parse_node> tree,
+        const std::vector<index> &arities);
+
+/* Extends the substitution for variables of pattern, a tree of a statement
+ * of applied, so that it gives the ground tree. Returns false if it does not
+ * match, the substitution may be partially extended then. */
+bool match_tree(
+        const assertion &applied,
+        std::span<const parse_node> pattern,
+        std::span<const parse_node> ground,
+        const std::vector<index> &ground_sizes,
+        tree_substitution &substitution_0);
+
+/* Applies the substitution to pattern, a tree of a statement of applied.
+ * Unbound variables are renumbered to first_metavariable + their number. */
+parse_tree substitute_tree(
+        const assertion &applied,
+        std::span<const parse_node> pattern,
+        const tree_substitution &substitution_0,
+        index first_metavariable = 0);
+
+/* Parse trees of essential hypotheses and statements of all assertions of a
+ * database, kept in one array of nodes. Statements which do not parse have
+ * empty trees. */
+class parse_tree_cache
+{
+private:
+    std::vector<parse_node> nodes;
+    /* tree of statement i is [node_offsets[i], node_offsets[i + 1]) */
+    std::vector<std::uint32_t> node_offsets{0};
+    /* statements of assertion i are [statement_offsets[i],
+     * statement_offsets[i + 1]), essential hypotheses first */
+    std::vector<std::uint32_t> statement_offsets{0};
+    std::vector<std::string> errors;
+
+public:
+    /* Adds trees of the next assertion, empty for statements which do not
+     * parse. */
+    void add_assertion(
+            const std::vector<parse_tree> &essential_hypotheses,
+            const parse_tree &expression_tree);
+    void add_error(std::string error)
+    {
+        errors.push_back(std::move(error));
+    }
+
+    index size() const
+    {
+        return static_cast<index>(statement_offsets.size()) - 1;
+    }
+
+    /* false if a statement of the assertion does not parse */
+    bool is_parsed(assertion_index assertion_index_0) const;
+
+    /* Errors of statements which do not parse, in database order. */
+    const std::vector<std::string> &get_errors() const
+    {
+        return errors;
+    }
+
+    std::span<const parse_node> get_hypothesis_tree(
+            assertion_index assertion_index_0,
+            index hypothesis) const;
+    std::span<const parse_node> get_expression_tree(
+            assertion_index assertion_index_0) const;
+
+    /* Bytes of heap memory held. */
+    std::size_t memory_usage() const;
+
+private:
+    std::span<const parse_node> get_tree(index statement) const;
+};
+
+/* Parses all statements of the database in parallel. threads_count 0 means
+ * one thread per hardware thread. Statements which do not parse get empty
+ * trees and an error naming the assertion. */
+std::shared_ptr<const parse_tree_cache> parse_database(
+        const metamath_database &database,
+        const grammar &grammar_0,
+        unsigned threads_count = 0);
+
+/* Returns parse trees cached in the database, parsing it first if needed. */
+const parse_tree_cache &get_parse_trees(
+        metamath_database &database,
+        unsigned threads_count = 0);
+
+} /* namespace metamath_playground */
+
+#endif /* EXPRESSION_PARSER_H */
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "label_normalizer.h"
+
+#include <algorithm>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+void label_normalizer::normalize(
+        std::string &assertion_label,
+        std::vector<floating_hypothesis> &floating_hypotheses,
+        std::vector<essential_hypothesis> &essential_hypotheses,
+        std::vector<floating_hypothesis> &non_mandatory_floating_hypotheses)
+{
+    other_names.clear();
+    std::replace(assertion_label.begin(), assertion_label.end(), '.', '_');
+    assertion_label = find_free_name(assertion_label);
+    other_names.insert(assertion_label);
+
+    const auto normalize_all =
+            [&] (auto &hypotheses)
+            {
+                for (auto &hypothesis : hypotheses)
+                {
+                    hypothesis.label =
+                            normalize_hypothesis_label(
+                                assertion_label,
+                                hypothesis.label);
+                    other_names.insert(hypothesis.label);
+                }
+            };
+    normalize_all(floating_hypotheses);
+    normalize_all(essential_hypotheses);
+    normalize_all(non_mandatory_floating_hypotheses);
+}
+/*----------------------------------------------------------------------------*/
+void label_normalizer::normalize(std::vector<assertion> &assertions)
+{
+    batch_names.clear();
+    for (auto &assertion_0 : assertions)
+    {
+        normalize(
+                    assertion_0.label,
+                    assertion_0.floating_hypotheses,
+                    assertion_0.essential_hypotheses,
+                    assertion_0.proof_0.floating_hypotheses);
+        batch_names.insert(other_names.begin(), other_names.end());
+    }
+    batch_names.clear();
+}
+/*----------------------------------------------------------------------------*/
+std::string label_normalizer::normalize_hypothesis_label(
+        const std::string &assertion_label,
+        const std::string &hypothesis_label)
+{
+    const index assertion_label_size =
+            assertion_label.size();
+    const index hypothesis_label_size =
+            hypothesis_label.size();
+    const bool correct_prefix =
+            hypothesis_label_size >= assertion_label_size + 2
+            && std::equal(
+                assertion_label.begin(),
+                assertion_label.end(),
+                hypothesis_label.begin())
+            && hypothesis_label[assertion_label_size] == '.';
+
+    std::string result;
+
+    if (correct_prefix)
+    {
+        result = hypothesis_label;
+    }
+    else
+    {
+        result.reserve(assertion_label_size + 1 + hypothesis_label_size);
+        result += assertion_label;
+        result += '.';
+        result += hypothesis_label;
+    }
+    std::replace(
+                result.begin() + assertion_label_size + 1,
+                result.end(),
+                '.',
+                '_');
+    return find_free_name(result);
+}
+/*----------------------------------------------------------------------------*/
+std::string label_normalizer::find_free_name(const std::string &base_name)
+{
+    auto next_iterator = next_suffixes.find(base_name);
+    if (
+            next_iterator == next_suffixes.end()
+            && !is_taken_permanently(base_name)
+            && other_names.count(base_name) == 0)
+        return base_name;
+
+    if (next_iterator == next_suffixes.end())
+        next_iterator = next_suffixes.emplace(base_name, -1).first;
+    index &next_suffix = next_iterator->second;
+
+    /* Suffixes taken only within the current assertion may be free for the
+     * next ones, so they do not advance the counter. */
+    std::string result;
+    result.reserve(base_name.size() + 8);
+    for (index suffix = next_suffix; ; ++suffix)
+    {
+        result = base_name;
+        if (suffix >= 0)
+        {
+            result += '_';
+            result += std::to_string(suffix);
+        }
+        if (is_taken_permanently(result))
+        {
+            if (suffix == next_suffix)
+                ++next_suffix;
+            continue;
+        }
+        if (other_names.count(result) == 0)
+            return result;
+    }
+}
+/*----------------------------------------------------------------------------*/
+bool label_normalizer::is_taken_permanently(const std::string &name) const
+{
+    return database.is_reserved(name) || batch_names.count(name) != 0;
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LABEL_NORMALIZER_H
+#define LABEL_NORMALIZER_H
+
+#include "metamath_database.h"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace metamath_playground {
+
+/* Gives assertions and their hypotheses unique labels of the form
+ * "assertion" and "assertion.hypothesis", with '.' elsewhere replaced by '_'.
+ * Conflicting labels get the first free suffix "_0", "_1", ...
+ *
+ * Labels reserved in the database are never released while reading, so for
+ * each conflicting base name the normalizer remembers the suffixes already
+ * known to be taken and continues from there. */
+class label_normalizer
+{
+private:
+    const metamath_database &database;
+    /* base name -> first suffix not known to be taken, -1 is the base name */
+    std::unordered_map<std::string, index> next_suffixes;
+    /* labels given to assertions of the current batch */
+    std::unordered_set<std::string> batch_names;
+    /* labels given within the current assertion */
+    std::unordered_set<std::string> other_names;
+
+public:
+    explicit label_normalizer(const metamath_database &database_in) :
+        database(database_in)
+    { }
+
+    void normalize(
+            std::string &assertion_label,
+            std::vector<floating_hypothesis> &floating_hypotheses,
+            std::vector<essential_hypothesis> &essential_hypotheses,
+            std::vector<floating_hypothesis>
+                &non_mandatory_floating_hypotheses);
+
+    /* Normalizes assertions, which are going to be added to the database
+     * together, so their labels are unique also among themselves. They are
+     * expected to be added before the next use of the normalizer. */
+    void normalize(std::vector<assertion> &assertions);
+
+private:
+    std::string normalize_hypothesis_label(
+            const std::string &assertion_label,
+            const std::string &hypothesis_label);
+    std::string find_free_name(const std::string &base_name);
+    bool is_taken_permanently(const std::string &name) const;
+};
+
+} /* namespace metamath_playground */
+
+#endif /* LABEL_NORMALIZER_H */
@@ -0,0 +1,276 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "legacy_frame.h"
+#include "proof_tree.h"
+#include "span_tracer.h"
+
+#include <limits>
+#include <stdexcept>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+void legacy_frame_registry::add_frame(const frame &frame_0)
+{
+    if (
+            types.size() + frame_0.size()
+            > std::numeric_limits<std::uint32_t>::max())
+        throw std::runtime_error("too many legacy frame entries");
+
+    for (const auto entry : frame_0)
+    {
+        if (
+                entry.index_0 < 0
+                || entry.index_0 > std::numeric_limits<std::uint32_t>::max())
+            throw std::runtime_error("legacy frame entry index out of range");
+        types.push_back(entry.type);
+        indices.push_back(static_cast<std::uint32_t>(entry.index_0));
+    }
+    offsets.push_back(static_cast<std::uint32_t>(types.size()));
+}
+/*----------------------------------------------------------------------------*/
+std::size_t legacy_frame_registry::memory_usage() const
+{
+    return
+            types.capacity() * sizeof(types[0])
+            + indices.capacity() * sizeof(indices[0])
+            + offsets.capacity() * sizeof(offsets[0]);
+}
+/*----------------------------------------------------------------------------*/
+void legacy_frame_registry::shrink_to_fit()
+{
+    types.shrink_to_fit();
+    indices.shrink_to_fit();
+    offsets.shrink_to_fit();
+}
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+/* Follows chains of "recall" steps down to the step, which is actually
+ * recalled. */
+index find_recalled_step(const proof_tree &tree, index step_index)
+{
+    while (tree.get_step(step_index).type == proof_step::type_t::recall)
+    {
+        const index target = tree.get_step(step_index).index_0;
+        if (target < 0 || target >= step_index)
+            throw std::runtime_error("recall step does not refer backwards");
+        step_index = target;
+    }
+    return step_index;
+}
+/*----------------------------------------------------------------------------*/
+enum class reorder_direction
+{
+    to_internal,
+    to_legacy
+};
+/*----------------------------------------------------------------------------*/
+/* Returns -1 if branch at given position is not visited in given pass. */
+index get_reordered_child(
+        const proof_tree &tree,
+        const legacy_frame_registry &registry,
+        const index node,
+        const index position)
+{
+    const auto children = tree.get_children(node);
+    const index children_count = static_cast<index>(children.size());
+    const index child_position = position % children_count;
+    const bool essential_pass = position >= children_count;
+
+    const frame_entry entry =
+            registry.get_entry(tree.get_step(node).index_0, child_position);
+    switch (entry.type)
+    {
+    case frame_entry::type_t::floating_hypothesis:
+        return essential_pass ? -1 : children[child_position];
+    case frame_entry::type_t::essential_hypothesis:
+        return essential_pass ? children[child_position] : -1;
+    case frame_entry::type_t::disjoint_variable_restriction:
+        break;
+    }
+    throw std::runtime_error(
+            "unexpected disjoint variable restriction in legacy frame");
+}
+/*----------------------------------------------------------------------------*/
+/* Children in internal order are floating hypotheses followed by essential
+ * ones, given position in legacy frame returns the child placed there. */
+index get_legacy_child(
+        const proof_tree &tree,
+        const legacy_frame_registry &registry,
+        const index node,
+        const index floating_count,
+        const index position)
+{
+    const frame_entry entry =
+            registry.get_entry(tree.get_step(node).index_0, position);
+    switch (entry.type)
+    {
+    case frame_entry::type_t::floating_hypothesis:
+        return tree.get_children(node)[entry.index_0];
+    case frame_entry::type_t::essential_hypothesis:
+        return tree.get_children(node)[floating_count + entry.index_0];
+    case frame_entry::type_t::disjoint_variable_restriction:
+        break;
+    }
+    throw std::runtime_error(
+            "unexpected disjoint variable restriction in legacy frame");
+}
+/*----------------------------------------------------------------------------*/
+index get_floating_count(
+        const legacy_frame_registry &registry,
+        const index assertion)
+{
+    index result = 0;
+    for (index i = 0; i < registry.get_frame_size(assertion); ++i)
+        if (
+                registry.get_entry(assertion, i).type
+                == frame_entry::type_t::floating_hypothesis)
+            ++result;
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+void reorder_steps(
+        proof &proof_0,
+        const legacy_frame_registry &registry,
+        const reorder_direction direction)
+{
+    const proof_tree tree(proof_0.steps);
+
+    for (const index node : tree.post_order())
+    {
+        const proof_step &step = tree.get_step(node);
+        if (
+                step.type == proof_step::type_t::assertion
+                && registry.get_frame_size(step.index_0)
+                != tree.get_children_count(node))
+        {
+            throw std::runtime_error(
+                    "number of assertion's hypotheses does not match its "
+                    "legacy frame");
+        }
+    }
+
+    const index not_written = -1;
+    const index being_written = -2;
+    /* maps from old index of a branch root to its new index */
+    std::vector<index> map(tree.size(), not_written);
+
+    /* To internal order children are visited in two passes over the legacy
+     * frame: floating hypotheses first, essential hypotheses next. Position
+     * counts visited frame entries over both passes. To legacy order they are
+     * visited in one pass over the legacy frame. */
+    struct stack_entry
+    {
+        index node;
+        index position;
+        /* used only for assertions to legacy order */
+        index floating_count;
+    };
+    std::vector<stack_entry> stack;
+    std::vector<proof_step> new_steps;
+    new_steps.reserve(proof_0.steps.size());
+
+    const auto push_branch =
+            [&] (const index node)
+            {
+                const index recalled = find_recalled_step(tree, node);
+                if (map[recalled] == being_written)
+                    throw std::runtime_error("cyclic recall in proof");
+                if (map[recalled] == not_written)
+                {
+                    /* First use of the branch in new order - write it whole,
+                     * even if originally this was a recall. */
+                    map[recalled] = being_written;
+                    const proof_step &step = tree.get_step(recalled);
+                    const index floating_count =
+                            direction == reorder_direction::to_legacy
+                            && step.type == proof_step::type_t::assertion
+                            ? get_floating_count(registry, step.index_0)
+                            : 0;
+                    stack.push_back(stack_entry{recalled, 0, floating_count});
+                }
+                else
+                {
+                    new_steps.push_back(
+                                proof_step{
+                                    proof_step::type_t::recall,
+                                    map[recalled],
+                                    0});
+                }
+            };
+
+    if (!tree.empty())
+        push_branch(tree.get_root());
+    while (!stack.empty())
+    {
+        auto &entry = stack.back();
+        const index node = entry.node;
+        const index children_count = tree.get_children_count(node);
+        const bool is_assertion =
+                tree.get_step(node).type == proof_step::type_t::assertion;
+        const index positions_count =
+                is_assertion && direction == reorder_direction::to_internal
+                ? 2 * children_count
+                : children_count;
+        if (entry.position < positions_count)
+        {
+            const index position = entry.position++;
+            index child;
+            if (!is_assertion)
+                child = tree.get_children(node)[position];
+            else if (direction == reorder_direction::to_internal)
+                child = get_reordered_child(tree, registry, node, position);
+            else
+                child =
+                        get_legacy_child(
+                            tree,
+                            registry,
+                            node,
+                            entry.floating_count,
+                            position);
+            if (child != -1)
+                push_branch(child); /* invalidates entry */
+            continue;
+        }
+
+        new_steps.push_back(tree.get_step(node));
+        map[node] = static_cast<index>(new_steps.size() - 1);
+        stack.pop_back();
+    }
+
+    proof_0.steps = std::move(new_steps);
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+void reorder_proof(proof &proof_0, const legacy_frame_registry &registry)
+{
+    const trace_span span("reorder_proof");
+    reorder_steps(proof_0, registry, reorder_direction::to_internal);
+}
+/*----------------------------------------------------------------------------*/
+void restore_legacy_order(
+        proof &proof_0,
+        const legacy_frame_registry &registry)
+{
+    reorder_steps(proof_0, registry, reorder_direction::to_legacy);
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
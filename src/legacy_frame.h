@@ -0,0 +1,102 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LEGACY_FRAME_H
+#define LEGACY_FRAME_H
+
+#include "metamath_database.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace metamath_playground {
+
+struct frame_entry
+{
+    enum class type_t : std::uint8_t
+    {
+        disjoint_variable_restriction,
+        essential_hypothesis,
+        floating_hypothesis
+    };
+
+    type_t type;
+    index index_0; /* index in its category */
+};
+
+using frame = std::vector<frame_entry>;
+
+/* Only ordinary (not extended) frames are kept in this registry. Frames of
+ * all assertions are stored in one array of 5 byte entries, indexed by
+ * per-assertion offsets. */
+class legacy_frame_registry
+{
+private:
+    std::vector<frame_entry::type_t> types;
+    /* Indices in this context refer to assertion's internal arrays. */
+    std::vector<std::uint32_t> indices;
+    /* frame of assertion i is [offsets[i], offsets[i + 1]) */
+    std::vector<std::uint32_t> offsets{0};
+
+public:
+    /* Adds frame of the next assertion. */
+    void add_frame(const frame &frame_0);
+
+    index size() const
+    {
+        return static_cast<index>(offsets.size()) - 1;
+    }
+
+    index get_frame_size(const index assertion) const
+    {
+        return offsets[assertion + 1] - offsets[assertion];
+    }
+
+    frame_entry get_entry(const index assertion, const index position) const
+    {
+        const std::uint32_t offset = offsets[assertion] + position;
+        return frame_entry{types[offset], indices[offset]};
+    }
+
+    /* Bytes of heap memory held. */
+    std::size_t memory_usage() const;
+    void shrink_to_fit();
+};
+
+/* Proofs in metamath files push hypotheses of each assertion in the order of
+ * its legacy frame, i.e. the order of declaration in the source. Database
+ * keeps mandatory floating hypotheses first and essential hypotheses next.
+ * This function reorders branches of each assertion step accordingly.
+ *
+ * Moving branches may make a "recall" step refer to a step, which is now
+ * placed after it. In such case the referred branch is moved to the place of
+ * the first use and the original place gets a "recall" step instead.
+ *
+ * Time and memory are linear in the number of steps. */
+void reorder_proof(proof &proof_0, const legacy_frame_registry &registry);
+
+/* Inverse of reorder_proof, used to write proofs into the source file. */
+void restore_legacy_order(
+        proof &proof_0,
+        const legacy_frame_registry &registry);
+
+} /* namespace metamath_playground */
+
+#endif /* LEGACY_FRAME_H */
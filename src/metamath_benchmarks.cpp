@@ -0,0 +1,529 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "allocation_tracker.h"
+#include "compressed_proof_writer.h"
+#include "database_generator.h"
+#include "label_normalizer.h"
+#include "legacy_frame.h"
+#include "metamath_database_read_write.h"
+#include "proof_tree.h"
+#include "tokenizer.h"
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace metamath_playground;
+/* hides index() from <strings.h> */
+using metamath_playground::index;
+
+/* Input stream reading directly from a string, without copying it. */
+class string_buffer : public std::streambuf
+{
+public:
+    explicit string_buffer(const std::string &data)
+    {
+        char *const begin = const_cast<char *>(data.data());
+        setg(begin, begin, begin + data.size());
+    }
+};
+
+struct benchmark_result
+{
+    std::string name;
+    index iterations;
+    double nanoseconds_per_operation;
+    double megabytes_per_second;
+    double allocations_per_operation;
+    double allocated_bytes_per_operation;
+};
+
+class benchmark_runner
+{
+private:
+    double minimal_seconds;
+    std::string filter;
+    std::vector<benchmark_result> results;
+
+public:
+    benchmark_runner(const double minimal_seconds_in, std::string filter_in):
+        minimal_seconds(minimal_seconds_in),
+        filter(std::move(filter_in))
+    {
+    }
+
+    /* Calls setup and operation repeatedly, for at least minimal_seconds of
+     * measured time. Only operation is measured. Each call of operation
+     * processes bytes_count bytes in operations_count operations.
+     * Allocations are counted by allocation tracker, which must be
+     * enabled. */
+    void run(
+            const std::string &name,
+            const index bytes_count,
+            const index operations_count,
+            const std::function<void()> &setup,
+            const std::function<void()> &operation)
+    {
+        if (!filter.empty() && name.find(filter) == std::string::npos)
+            return;
+        std::cerr << name << std::endl;
+
+        index iterations = 0;
+        std::chrono::steady_clock::duration total{0};
+        std::int64_t total_allocations = 0;
+        std::int64_t total_allocated_bytes = 0;
+        do
+        {
+            setup();
+            const allocation_statistics before = get_total_allocations();
+            const auto begin = std::chrono::steady_clock::now();
+            operation();
+            total += std::chrono::steady_clock::now() - begin;
+            const allocation_statistics after = get_total_allocations();
+            total_allocations += after.count - before.count;
+            total_allocated_bytes += after.bytes - before.bytes;
+            ++iterations;
+        } while (
+            std::chrono::duration<double>(total).count() < minimal_seconds);
+
+        const double seconds = std::chrono::duration<double>(total).count();
+        const double operations =
+                static_cast<double>(iterations) * operations_count;
+        results.push_back(
+                    benchmark_result{
+                        name,
+                        iterations,
+                        seconds * 1e9 / operations,
+                        static_cast<double>(bytes_count) * iterations
+                        / 1e6 / seconds,
+                        total_allocations / operations,
+                        total_allocated_bytes / operations});
+    }
+
+    void run(
+            const std::string &name,
+            const index bytes_count,
+            const index operations_count,
+            const std::function<void()> &operation)
+    {
+        run(name, bytes_count, operations_count, [] {}, operation);
+    }
+
+    void write_json(
+            const std::string &input_name,
+            const index input_size,
+            std::ostream &output_stream) const
+    {
+        output_stream
+                << "{\n"
+                << "  \"input\": \"" << escape(input_name) << "\",\n"
+                << "  \"input_bytes\": " << input_size << ",\n"
+                << "  \"benchmarks\": [";
+        bool first = true;
+        for (const auto &result : results)
+        {
+            output_stream
+                    << (first ? "\n" : ",\n")
+                    << "    {\"name\": \"" << escape(result.name) << "\", "
+                    << "\"iterations\": " << result.iterations << ", "
+                    << "\"ns_per_op\": " << result.nanoseconds_per_operation
+                    << ", "
+                    << "\"mb_per_s\": ";
+            /* not all benchmarks process bytes */
+            if (result.megabytes_per_second > 0)
+                output_stream << result.megabytes_per_second;
+            else
+                output_stream << "null";
+            output_stream
+                    << ", "
+                    << "\"allocations_per_op\": "
+                    << result.allocations_per_operation << ", "
+                    << "\"allocated_bytes_per_op\": "
+                    << result.allocated_bytes_per_operation << "}";
+            first = false;
+        }
+        output_stream << "\n  ]\n}\n";
+    }
+
+private:
+    static std::string escape(const std::string &text)
+    {
+        std::string result;
+        for (const char character : text)
+        {
+            if (character == '"' || character == '\\')
+                result += '\\';
+            result += character;
+        }
+        return result;
+    }
+};
+
+/* Assertion 0 takes (essential, floating), assertion 1 takes (floating,
+ * essential, floating, essential) - both need reordering. */
+legacy_frame_registry make_registry()
+{
+    using type_t = frame_entry::type_t;
+    legacy_frame_registry registry;
+    registry.add_frame(
+                frame{
+                    {type_t::essential_hypothesis, 0},
+                    {type_t::floating_hypothesis, 0}});
+    registry.add_frame(
+                frame{
+                    {type_t::floating_hypothesis, 0},
+                    {type_t::essential_hypothesis, 0},
+                    {type_t::floating_hypothesis, 1},
+                    {type_t::essential_hypothesis, 1}});
+    return registry;
+}
+
+/* Builds a random proof in legacy order. With deep == true assertions are
+ * applied as soon as possible, which gives proof depth linear in its size. */
+proof make_proof(
+        const legacy_frame_registry &registry,
+        const index steps_count,
+        const double recall_density,
+        const bool deep,
+        std::mt19937 &generator)
+{
+    std::vector<proof_step> steps;
+    steps.reserve(steps_count + steps_count / 2);
+    index dangling_count = 0;
+    std::bernoulli_distribution recall_distribution(recall_density);
+    std::bernoulli_distribution apply_distribution(deep ? 0.9 : 0.3);
+
+    const auto push_assertion =
+            [&] (index assertion)
+            {
+                const index consumed = registry.get_frame_size(assertion);
+                steps.push_back(
+                            proof_step{
+                                proof_step::type_t::assertion,
+                                assertion,
+                                consumed});
+                dangling_count += 1 - consumed;
+            };
+
+    while (static_cast<index>(steps.size()) < steps_count)
+    {
+        const index assertion = steps.size() % 2;
+        if (
+                dangling_count >= 4
+                && apply_distribution(generator))
+        {
+            push_assertion(assertion);
+        }
+        else if (!steps.empty() && recall_distribution(generator))
+        {
+            std::uniform_int_distribution<index> target_distribution(
+                        0, steps.size() - 1);
+            index target = target_distribution(generator);
+            if (steps[target].type == proof_step::type_t::recall)
+                target = steps[target].index_0;
+            steps.push_back(
+                        proof_step{proof_step::type_t::recall, target, 0});
+            ++dangling_count;
+        }
+        else
+        {
+            steps.push_back(
+                        proof_step{
+                            proof_step::type_t::floating_hypothesis,
+                            0,
+                            0});
+            ++dangling_count;
+        }
+    }
+    while (dangling_count > 1)
+    {
+        if (dangling_count >= 4)
+        {
+            push_assertion(1);
+        }
+        else if (dangling_count == 2)
+        {
+            push_assertion(0);
+        }
+        else
+        {
+            steps.push_back(
+                        proof_step{
+                            proof_step::type_t::floating_hypothesis,
+                            0,
+                            0});
+            ++dangling_count;
+        }
+    }
+    return proof{{}, {}, std::move(steps)};
+}
+
+void run_reorder_proof_benchmarks(benchmark_runner &runner)
+{
+    const auto registry = make_registry();
+    for (const bool deep : {false, true})
+        for (const double recall_density : {0.0, 0.2})
+            for (index steps_count = 1000; steps_count <= 100000;
+                    steps_count *= 10)
+            {
+                std::mt19937 generator(steps_count);
+                const proof original =
+                        make_proof(
+                            registry,
+                            steps_count,
+                            recall_density,
+                            deep,
+                            generator);
+                proof proof_0;
+                runner.run(
+                            std::string("reorder_proof/")
+                            + (deep ? "deep" : "shallow")
+                            + "/recalls_"
+                            + std::to_string(
+                                static_cast<int>(recall_density * 100))
+                            + "%/steps_" + std::to_string(steps_count),
+                            0,
+                            original.steps.size(),
+                            [&] { proof_0 = original; },
+                            [&] { reorder_proof(proof_0, registry); });
+            }
+}
+
+void run_database_benchmarks(
+        benchmark_runner &runner,
+        const std::string &input)
+{
+    const index input_size = static_cast<index>(input.size());
+
+    index tokens_count = 0;
+    runner.run(
+                "tokenizer",
+                input_size,
+                1,
+                [&]
+                {
+                    string_buffer buffer(input);
+                    std::istream input_stream(&buffer);
+                    tokenizer tokenizer_0(input_stream);
+                    tokens_count = 0;
+                    while (!tokenizer_0.peek().empty())
+                    {
+                        tokenizer_0.get_token();
+                        ++tokens_count;
+                    }
+                });
+
+    const auto read =
+            [] (metamath_database &database, const std::string &text)
+            {
+                string_buffer buffer(text);
+                std::istream input_stream(&buffer);
+                read_database_from_file(database, input_stream);
+            };
+    runner.run(
+                "read_database_from_file",
+                input_size,
+                1,
+                [&]
+                {
+                    metamath_database database;
+                    read(database, input);
+                });
+
+    metamath_database database;
+    read(database, input);
+    const index assertions_count = (*database.assertions_end()).get_index();
+    std::vector<const assertion *> theorems;
+    index steps_count = 0;
+    for (index i = 0; i < assertions_count; ++i)
+    {
+        const assertion &assertion_0 =
+                database.get_assertion(assertion_index(i));
+        if (assertion_0.proof_0.steps.empty())
+            continue;
+        theorems.push_back(&assertion_0);
+        steps_count += assertion_0.proof_0.steps.size();
+    }
+
+    /* The writer compresses all proofs, so reading its output measures
+     * read_compressed_proof. */
+    std::ostringstream compressed_stream;
+    write_database_to_file(database, compressed_stream);
+    const std::string compressed = compressed_stream.str();
+    runner.run(
+                "read_database_from_file/compressed",
+                compressed.size(),
+                1,
+                [&]
+                {
+                    metamath_database compressed_database;
+                    read(compressed_database, compressed);
+                });
+
+    runner.run(
+                "unpack_proof/round_trip",
+                0,
+                std::max<index>(steps_count, 1),
+                [&]
+                {
+                    for (const assertion *const theorem : theorems)
+                    {
+                        const unpacked_proof unpacked =
+                                unpack_proof(theorem->proof_0);
+                        const proof packed = unpack_proof(unpacked);
+                        if (
+                                static_cast<index>(packed.steps.size())
+                                != unpacked.steps.size())
+                            throw std::runtime_error(
+                                    "proof round-trip changed its size");
+                    }
+                });
+
+    compressed_proof_writer proof_writer(database);
+    std::string proof_buffer;
+    for (const assertion *const theorem : theorems)
+        proof_writer.write(*theorem, proof_buffer);
+    runner.run(
+                "compressed_proof_writer",
+                proof_buffer.size(),
+                std::max<index>(theorems.size(), 1),
+                [&] { proof_buffer.clear(); },
+                [&]
+                {
+                    for (const assertion *const theorem : theorems)
+                        proof_writer.write(*theorem, proof_buffer);
+                });
+
+    /* All labels are taken by the database, so each one is renamed. */
+    std::vector<assertion> original_assertions;
+    for (index i = 0; i < assertions_count; ++i)
+        original_assertions.push_back(
+                    database.get_assertion(assertion_index(i)));
+    std::vector<assertion> assertions;
+    runner.run(
+                "label_normalizer/batch",
+                0,
+                std::max<index>(assertions_count, 1),
+                [&] { assertions = original_assertions; },
+                [&]
+                {
+                    label_normalizer normalizer(database);
+                    normalizer.normalize(assertions);
+                });
+
+    for (const unsigned threads_count : {1u, 0u})
+    {
+        write_options options;
+        options.threads_count = threads_count;
+        runner.run(
+                    "write_database_to_file/threads_"
+                    + (threads_count == 0
+                        ? std::string("all")
+                        : std::to_string(threads_count)),
+                    compressed.size(),
+                    1,
+                    [&]
+                    {
+                        std::ostringstream output_stream;
+                        write_database_to_file(
+                                    database,
+                                    output_stream,
+                                    options);
+                    });
+    }
+}
+
+} /* anonymous namespace */
+
+int main(const int argc, const char *const *const argv) try
+{
+    double minimal_seconds = 1.0;
+    std::string filter;
+    std::string output_name;
+    std::string input_name;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        if (argument == "--min-time" && i + 1 < argc)
+            minimal_seconds = std::stod(argv[++i]);
+        else if (argument == "--filter" && i + 1 < argc)
+            filter = argv[++i];
+        else if (argument == "--output" && i + 1 < argc)
+            output_name = argv[++i];
+        else if (input_name.empty() && argument.substr(0, 2) != "--")
+            input_name = argument;
+        else
+            throw std::runtime_error(
+                    "usage: metamath_benchmarks [--min-time seconds] "
+                    "[--filter substring] [--output results.json] "
+                    "[input.mm]\n"
+                    "Without input a database generated with default "
+                    "generator options is used.");
+    }
+
+    enable_allocation_tracking();
+    benchmark_runner runner(minimal_seconds, filter);
+    run_reorder_proof_benchmarks(runner);
+
+    std::string input;
+    if (input_name.empty())
+    {
+        std::ostringstream input_stream;
+        generate_database(generator_options(), input_stream);
+        input = input_stream.str();
+        input_name = "generated";
+    }
+    else
+    {
+        std::ifstream input_stream(input_name, std::ios::binary);
+        if (!input_stream)
+            throw std::runtime_error("cannot open " + input_name);
+        input.assign(
+                    std::istreambuf_iterator<char>(input_stream),
+                    std::istreambuf_iterator<char>());
+    }
+    run_database_benchmarks(runner, input);
+
+    if (output_name.empty())
+    {
+        runner.write_json(input_name, input.size(), std::cout);
+    }
+    else
+    {
+        std::ofstream output_stream(output_name);
+        runner.write_json(input_name, input.size(), output_stream);
+    }
+    return 0;
+}
+catch (const std::exception &error)
+{
+    std::cerr << "std::exception caught: " << error.what() << std::endl;
+    return 1;
+}
@@ -18,9 +18,69 @@
  * limitations under the License.
  */
 #include "metamath_database.h"
+#include "expression_parser.h"
+#include "legacy_frame.h"
+#include "span_tracer.h"
+#include "unification_index.h"
+
+#include <stdexcept>
+#include <utility>
 
 namespace metamath_playground {
 /*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+std::size_t heap_size(const std::string &string_0)
+{
+    /* short strings are stored inside the object */
+    const char *const object = reinterpret_cast<const char *>(&string_0);
+    const bool is_inline =
+            string_0.data() >= object
+            && string_0.data() < object + sizeof(string_0);
+    return is_inline ? 0 : string_0.capacity() + 1;
+}
+/*----------------------------------------------------------------------------*/
+template<typename element_t>
+std::size_t heap_size(const std::vector<element_t> &vector_0)
+{
+    return vector_0.capacity() * sizeof(element_t);
+}
+/*----------------------------------------------------------------------------*/
+std::size_t heap_size_of_key(const std::string &key)
+{
+    return heap_size(key);
+}
+/*----------------------------------------------------------------------------*/
+template<typename value_t>
+std::size_t heap_size_of_key(const std::pair<const std::string, value_t> &entry)
+{
+    return heap_size(entry.first);
+}
+/*----------------------------------------------------------------------------*/
+/* Nodes are estimated as the value with a link and a cached hash. */
+template<typename container_t>
+std::size_t heap_size_of_hashed(const container_t &container)
+{
+    const std::size_t node_size =
+            sizeof(typename container_t::value_type) + 2 * sizeof(void *);
+    std::size_t result =
+            container.bucket_count() * sizeof(void *)
+            + container.size() * node_size;
+    for (const auto &entry : container)
+        result += heap_size_of_key(entry);
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+std::size_t heap_size(const std::vector<floating_hypothesis> &hypotheses)
+{
+    std::size_t result = hypotheses.capacity() * sizeof(floating_hypothesis);
+    for (const auto &hypothesis : hypotheses)
+        result += heap_size(hypothesis.label);
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
 bool metamath_database::is_reserved(const std::string &label) const
 {
     return allocated_labels.count(label) != 0;
@@ -97,6 +157,7 @@ metamath_database::symbol_iterator metamath_database::variables_end() const
 /*----------------------------------------------------------------------------*/
 assertion_index metamath_database::add_assertion(assertion &&assertion_in)
 {
+    const trace_span span("add_assertion");
     std::vector<const std::string *> labels;
     labels.push_back(&assertion_in.label);
     for (auto &hypothesis : assertion_in.floating_hypotheses)
@@ -109,12 +170,16 @@ assertion_index metamath_database::add_assertion(assertion &&assertion_in)
         reserve(*label);
 
     assertions.push_back(std::move(assertion_in));
+    parse_trees.reset();
     const assertion_index index0{static_cast<index>(assertions.size() - 1)};
     label_to_assertion[assertions.back().label] = index0;
+    if (unification_index_0 != nullptr)
+        unification_index_0->add_assertion(*this, index0);
     return index0;
 }
 /*----------------------------------------------------------------------------*/
-assertion_index metamath_database::find_assertion(const std::string &label)
+assertion_index metamath_database::find_assertion(
+        const std::string &label) const
 {
     auto iterator = label_to_assertion.find(label);
     if (iterator != label_to_assertion.end())
@@ -151,6 +216,63 @@ void metamath_database::remove_assertion(const assertion_index index_in)
     throw std::runtime_error("TODO");
 }
 /*----------------------------------------------------------------------------*/
+void metamath_database::set_proof(
+        const assertion_index index_in,
+        proof &&proof_in)
+{
+    assertion &assertion_0 = assertions[index_in.get_index()];
+    if (assertion_0.type != assertion::type_t::theorem)
+        throw std::runtime_error("only theorems have proofs");
+
+    std::unordered_set<std::string> old_labels;
+    for (const auto &hypothesis : assertion_0.proof_0.floating_hypotheses)
+        old_labels.insert(hypothesis.label);
+    std::unordered_set<std::string> new_labels;
+    for (const auto &hypothesis : proof_in.floating_hypotheses)
+        if (
+                !new_labels.insert(hypothesis.label).second
+                || (
+                    is_reserved(hypothesis.label)
+                    && old_labels.count(hypothesis.label) == 0))
+            throw std::runtime_error(
+                    "name conflict when setting a proof: " + hypothesis.label);
+
+    for (const auto &label : old_labels)
+        release(label);
+    for (const auto &label : new_labels)
+        reserve(label);
+
+    assertion_0.proof_0 = std::move(proof_in);
+    if (modified_assertions.size() < assertions.size())
+        modified_assertions.resize(assertions.size(), false);
+    modified_assertions[index_in.get_index()] = true;
+}
+/*----------------------------------------------------------------------------*/
+bool metamath_database::is_modified(const assertion_index index_in) const
+{
+    const auto i = static_cast<std::size_t>(index_in.get_index());
+    return i < modified_assertions.size() && modified_assertions[i];
+}
+/*----------------------------------------------------------------------------*/
+const source_location *metamath_database::get_source_location(
+        const assertion_index index_in) const
+{
+    const auto i = static_cast<std::size_t>(index_in.get_index());
+    if (i >= source_locations.size() || source_locations[i].statement_end == 0)
+        return nullptr;
+    return &source_locations[i];
+}
+/*----------------------------------------------------------------------------*/
+void metamath_database::set_source_location(
+        const assertion_index index_in,
+        source_location &&location)
+{
+    const auto i = static_cast<std::size_t>(index_in.get_index());
+    if (i >= source_locations.size())
+        source_locations.resize(i + 1, source_location{0, 0, 0, 0, {}, {}});
+    source_locations[i] = std::move(location);
+}
+/*----------------------------------------------------------------------------*/
 void metamath_database::reserve(const std::string &label)
 {
     if (allocated_labels.count(label) != 0)
@@ -189,55 +311,58 @@ symbol_index metamath_database::add_symbol(
     return  symbol_index0;
 }
 /*----------------------------------------------------------------------------*/
-unpacked_proof unpack_proof(const proof &proof_0)
+database_memory_usage metamath_database::memory_usage() const
 {
-    std::vector<adobe::forest<proof_step>> dangling_proofs;
-    for (auto &step : proof_0.steps)
+    database_memory_usage result;
+
+    for (const auto *symbols : {&constants, &variables})
     {
-        adobe::forest<proof_step> new_proof;
-        new_proof.push_back(step);
-        if (dangling_proofs.size() < step.assumptions_count)
-            throw std::runtime_error("insufficient number of dangling proofs");
-        /* leading at parent step */
-        auto insert_iter = new_proof.begin();
-        /* trailing at parent step */
-        ++insert_iter;
-        for (index i = 0; i < step.assumptions_count; ++i)
-        {
-            new_proof.splice(
-                        insert_iter,
-                        *(dangling_proofs.end() - step.assumptions_count + i));
-        }
-        dangling_proofs.resize(
-                    dangling_proofs.size() - step.assumptions_count);
-        dangling_proofs.push_back(new_proof);
+        result.symbols += heap_size(*symbols);
+        for (const auto &symbol_0 : *symbols)
+            result.symbols += heap_size(symbol_0.label);
     }
-    if (dangling_proofs.size() != 1)
-        std::runtime_error("invalid packed proof");
 
-    unpacked_proof result;
-    result.disjoint_variable_restrictions =
-            proof_0.disjoint_variable_restrictions;
-    result.floating_hypotheses = proof_0.floating_hypotheses;
-    result.steps = std::move(dangling_proofs.back());
-    return result;
-}
-/*----------------------------------------------------------------------------*/
-proof unpack_proof(const unpacked_proof &proof_0)
-{
-    proof result;
-    auto post_order_range =
-            adobe::postorder_range(
-                boost::make_iterator_range(
-                    proof_0.steps.begin(),
-                    proof_0.steps.end()));
-    for(auto step : post_order_range)
+    result.assertions += heap_size(assertions);
+    for (const auto &assertion_0 : assertions)
     {
-        result.steps.push_back(step);
+        result.assertions +=
+                heap_size(assertion_0.label)
+                + heap_size(assertion_0.disjoint_variable_restrictions)
+                + heap_size(assertion_0.floating_hypotheses)
+                + heap_size(assertion_0.essential_hypotheses);
+        result.expressions += heap_size(assertion_0.expression_0);
+        for (const auto &hypothesis : assertion_0.essential_hypotheses)
+        {
+            result.assertions += heap_size(hypothesis.label);
+            result.expressions += heap_size(hypothesis.expression_0);
+        }
+        const proof &proof_0 = assertion_0.proof_0;
+        result.proofs +=
+                heap_size(proof_0.disjoint_variable_restrictions)
+                + heap_size(proof_0.floating_hypotheses)
+                + heap_size(proof_0.steps);
     }
-    result.disjoint_variable_restrictions =
-            proof_0.disjoint_variable_restrictions;
-    result.floating_hypotheses = proof_0.floating_hypotheses;
+
+    result.label_indices =
+            heap_size_of_hashed(label_to_symbol)
+            + heap_size_of_hashed(label_to_assertion)
+            + heap_size_of_hashed(allocated_labels);
+
+    if (legacy_frames != nullptr)
+        result.legacy_frames = legacy_frames->memory_usage();
+    if (parse_trees != nullptr)
+        result.parse_trees = parse_trees->memory_usage();
+    if (unification_index_0 != nullptr)
+        result.unification_index = unification_index_0->memory_usage();
+
+    result.source_locations =
+            heap_size(source_locations)
+            + modified_assertions.capacity() / 8;
+    for (const auto &location : source_locations)
+        result.source_locations +=
+                heap_size(location.proof_floating_hypotheses)
+                + heap_size(location.proof_disjoint_variable_restrictions);
+
     return result;
 }
 /*----------------------------------------------------------------------------*/
@@ -23,14 +23,13 @@
 #include "named.h"
 #include "typed_indices.h"
 
-#include <adobe/forest.hpp>
-
 #include <vector>
 #include <string>
 #include <array>
 #include <unordered_map>
 #include <unordered_set>
 #include <iterator>
+#include <memory>
 
 namespace metamath_playground {
 
@@ -116,7 +115,55 @@ struct assertion
     proof proof_0;
 };
 
+/* Position of an assertion in the file it was read from. Offsets are in
+ * bytes, ranges are [begin, end). */
+struct source_location
+{
+    /* from the label to the final "$." */
+    index statement_begin;
+    index statement_end;
+    /* from "$=" to the final "$." inclusive, empty for axioms */
+    index proof_begin;
+    index proof_end;
+    /* Non-mandatory floating hypotheses available to the proof in the file,
+     * with labels used there. */
+    std::vector<floating_hypothesis> proof_floating_hypotheses;
+    std::vector<disjoint_variable_restriction>
+        proof_disjoint_variable_restrictions;
+};
+
+/* Heap bytes used by a database, by component. Sizes of hash table nodes are
+ * estimated, allocator overhead is not counted. */
+struct database_memory_usage
+{
+    /* symbols with their labels */
+    std::size_t symbols = 0;
+    /* assertions with their labels, hypotheses and restrictions */
+    std::size_t assertions = 0;
+    /* statements of assertions and of essential hypotheses */
+    std::size_t expressions = 0;
+    std::size_t proofs = 0;
+    /* maps of labels */
+    std::size_t label_indices = 0;
+    std::size_t legacy_frames = 0;
+    /* source locations and modification flags */
+    std::size_t source_locations = 0;
+    std::size_t parse_trees = 0;
+    std::size_t unification_index = 0;
+
+    std::size_t get_total() const
+    {
+        return
+                symbols + assertions + expressions + proofs + label_indices
+                + legacy_frames + source_locations + parse_trees
+                + unification_index;
+    }
+};
+
 class metamath_database;
+class legacy_frame_registry;
+class parse_tree_cache;
+class unification_index;
 
 using assertion_index = typed_index<assertion, metamath_database>;
 
@@ -220,6 +267,15 @@ private:
     /* This is to verify if the metamath restriction of uniqueness of label and
      * math symbols is satisfied. */
     std::unordered_set<std::string> allocated_labels;
+    /* Frames in the order of the source file, kept only on request. */
+    std::shared_ptr<const legacy_frame_registry> legacy_frames;
+    /* Indexed by assertion, kept only on request. */
+    std::vector<source_location> source_locations;
+    std::vector<bool> modified_assertions;
+    /* Parse trees of all statements, dropped when an assertion is added. */
+    std::shared_ptr<const parse_tree_cache> parse_trees;
+    /* Updated by add_assertion. */
+    std::shared_ptr<unification_index> unification_index_0;
 
 public:
     /* public methods */
@@ -245,7 +301,7 @@ public:
 
     /* add/remove assertion */
     assertion_index add_assertion(assertion &&assertion_in);
-    assertion_index find_assertion(const std::string &label);
+    assertion_index find_assertion(const std::string &label) const;
     static bool is_valid(assertion_index index_in);
     const assertion &get_assertion(assertion_index index_in) const;
     assertion_iterator assertions_begin() const;
@@ -254,6 +310,52 @@ public:
      * Also note, that any assertion indices kept outside database may be
      * invalidated. */
     void remove_assertion(assertion_index index_in);
+    /* Replaces the proof and marks the assertion as modified. Labels of
+     * hypotheses of the new proof must not be used elsewhere. */
+    void set_proof(assertion_index index_in, proof &&proof_in);
+    bool is_modified(assertion_index index_in) const;
+
+    /* null if not retained after reading */
+    const source_location *get_source_location(
+            assertion_index index_in) const;
+    void set_source_location(
+            assertion_index index_in,
+            source_location &&location);
+
+    database_memory_usage memory_usage() const;
+
+    /* null if not retained after reading */
+    const legacy_frame_registry *get_legacy_frames() const
+    {
+        return legacy_frames.get();
+    }
+    void set_legacy_frames(
+            std::shared_ptr<const legacy_frame_registry> legacy_frames_in)
+    {
+        legacy_frames = std::move(legacy_frames_in);
+    }
+
+    /* null if not parsed since the last change of assertions */
+    const parse_tree_cache *get_parse_trees() const
+    {
+        return parse_trees.get();
+    }
+    void set_parse_trees(
+            std::shared_ptr<const parse_tree_cache> parse_trees_in)
+    {
+        parse_trees = std::move(parse_trees_in);
+    }
+
+    /* null unless set, then kept up to date when assertions are added */
+    const unification_index *get_unification_index() const
+    {
+        return unification_index_0.get();
+    }
+    void set_unification_index(
+            std::shared_ptr<unification_index> unification_index_in)
+    {
+        unification_index_0 = std::move(unification_index_in);
+    }
 
 private:
     /* private methods */
@@ -264,17 +366,6 @@ private:
             symbol::type_t symbol_type);
 };
 
-struct unpacked_proof
-{
-    std::vector<disjoint_variable_restriction>
-        disjoint_variable_restrictions;
-    std::vector<floating_hypothesis> floating_hypotheses;
-    adobe::forest<proof_step> steps;
-};
-
-unpacked_proof unpack_proof(const proof &proof_0);
-proof unpack_proof(const unpacked_proof &proof_0);
-
 } /* namespace metamath_playground */
 
 #endif /* METAMATH_DATABASE_H */
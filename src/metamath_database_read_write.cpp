@@ -18,61 +18,76 @@
  * limitations under the License.
  */
 #include "metamath_database_read_write.h"
+#include "allocation_tracker.h"
+#include "compressed_proof_writer.h"
+#include "label_normalizer.h"
+#include "legacy_frame.h"
+#include "scope_groups.h"
+#include "span_tracer.h"
+#include "thread_pool.h"
 #include "tokenizer.h"
+#include "variable_marks.h"
 
-#include <adobe/forest.hpp>
 #include <boost/range/iterator_range_core.hpp>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <memory>
 #include <stdexcept>
 #include <utility>
-#include <map>
-#include <set>
-#include <tuple>
+#include <unordered_map>
 #include <algorithm>
-#include <numeric>
+
+#include <sys/uio.h>
 
 namespace metamath_playground {
 /*----------------------------------------------------------------------------*/
 namespace {
 /*----------------------------------------------------------------------------*/
-struct frame_entry
+/* Mandatory part of the frame of an assertion. */
+struct mandatory_frame
 {
-    enum class type_t
-    {
-        disjoint_variable_restriction,
-        essential_hypothesis,
-        floating_hypothesis
-    };
-
-    type_t type;
-    index index_0; /* index in its category */
-};
-/*----------------------------------------------------------------------------*/
-using frame = std::vector<frame_entry>;
-/*----------------------------------------------------------------------------*/
-/* Only ordinary (not extended) frames are kept in this registry. */
-struct legacy_frame_registry
-{
-    /* Indices in this context refer to assertion's internal arrays. */
-    std::vector<frame> frames;
+    std::vector<disjoint_variable_restriction> disjoint_variable_restrictions;
+    std::vector<floating_hypothesis> floating_hypotheses;
+    frame legacy_frame;
 };
 /*----------------------------------------------------------------------------*/
+/* Statements active at the current point of the file. All nested scopes share
+ * the same containers - entering a scope records their sizes and leaving it
+ * truncates them back, so both are O(1) amortized. */
 class scope
 {
 private:
-    std::map<std::string, int> label_to_essential_hypothesis_index;
+    struct watermark
+    {
+        index floating_hypotheses_count;
+        index essential_hypotheses_count;
+        index disjoint_variable_restrictions_count;
+        index spurious_frame_size;
+    };
+
+    std::unordered_map<std::string, frame_entry> label_to_hypothesis;
     std::vector<floating_hypothesis> floating_hypotheses;
     std::vector<essential_hypothesis> essential_hypotheses;
     std::vector<disjoint_variable_restriction> disjoint_variable_restrictions;
     std::vector<frame_entry> spurious_frame;
+    std::vector<watermark> watermarks;
+    /* variable number -> indices of disjoint variable restrictions containing
+     * the variable, in increasing order */
+    std::vector<std::vector<index>> variable_restrictions;
+    variable_marks mandatory_variables;
+    variable_marks non_mandatory_variables;
 
 public:
     scope() = default;
-    scope(scope &) = default;
+    scope(const scope &) = delete;
+
+    void enter();
+    void leave();
 
     void add_floating_hypothesis(floating_hypothesis &&hypothesis);
-    /* Returns -1 on failure. */
-    index find_essential_hypothesis_index_by_label(
-            const std::string &label) const;
+    /* Returns entry with index_0 == -1 on failure. */
+    frame_entry find_hypothesis(const std::string &label) const;
     void add_essential_hypothesis(essential_hypothesis &&hypothesis);
     void add_disjoint_variable_restriction(
             disjoint_variable_restriction &&restriction);
@@ -97,55 +112,226 @@ public:
     {
         return spurious_frame;
     }
+
+    /* Variables of the essential hypotheses and the expression are
+     * mandatory, the frame keeps the declaration order of the file. */
+    mandatory_frame build_mandatory_frame(const expression &expression_0);
+
+    /* Restrictions of the scope between variables of non-mandatory
+     * hypotheses and variables of any hypotheses of the proof, in the order
+     * of the scope. */
+    std::vector<disjoint_variable_restriction>
+    extract_non_mandatory_restrictions(
+            const std::vector<floating_hypothesis>
+                &mandatory_floating_hypotheses,
+            const std::vector<floating_hypothesis> &non_mandatory_hypotheses);
+
+private:
+    void add_label(const std::string &label, frame_entry entry);
 };
 /*----------------------------------------------------------------------------*/
+void scope::enter()
+{
+    watermarks.push_back(
+                watermark{
+                    static_cast<index>(floating_hypotheses.size()),
+                    static_cast<index>(essential_hypotheses.size()),
+                    static_cast<index>(disjoint_variable_restrictions.size()),
+                    static_cast<index>(spurious_frame.size())});
+}
+/*----------------------------------------------------------------------------*/
+void scope::leave()
+{
+    if (watermarks.empty())
+        throw std::runtime_error("leaving the outermost scope");
+    const watermark mark = watermarks.back();
+    watermarks.pop_back();
+
+    for (
+            auto i = floating_hypotheses.begin()
+                + mark.floating_hypotheses_count;
+            i != floating_hypotheses.end();
+            ++i)
+        label_to_hypothesis.erase(i->label);
+    for (
+            auto i = essential_hypotheses.begin()
+                + mark.essential_hypotheses_count;
+            i != essential_hypotheses.end();
+            ++i)
+        label_to_hypothesis.erase(i->label);
+
+    /* restrictions of the scope are at the ends of adjacency lists */
+    for (
+            index i = disjoint_variable_restrictions.size() - 1;
+            i >= mark.disjoint_variable_restrictions_count;
+            --i)
+    {
+        for (const auto &variable : disjoint_variable_restrictions[i])
+        {
+            auto &restrictions = variable_restrictions[variable.second];
+            if (!restrictions.empty() && restrictions.back() == i)
+                restrictions.pop_back();
+        }
+    }
+
+    floating_hypotheses.resize(mark.floating_hypotheses_count);
+    essential_hypotheses.resize(mark.essential_hypotheses_count);
+    disjoint_variable_restrictions.resize(
+                mark.disjoint_variable_restrictions_count);
+    spurious_frame.resize(mark.spurious_frame_size);
+}
+/*----------------------------------------------------------------------------*/
 void scope::add_floating_hypothesis(floating_hypothesis &&hypothesis)
 {
+    add_label(
+                hypothesis.label,
+                frame_entry{
+                    frame_entry::type_t::floating_hypothesis,
+                    static_cast<index>(floating_hypotheses.size())});
     floating_hypotheses.push_back(std::move(hypothesis));
     spurious_frame.push_back(
                 frame_entry{
                     frame_entry::type_t::floating_hypothesis,
-                    static_cast<int>(floating_hypotheses.size() - 1)});
+                    static_cast<index>(floating_hypotheses.size() - 1)});
 }
 /*----------------------------------------------------------------------------*/
-index scope::find_essential_hypothesis_index_by_label(
-        const std::string &label) const
+frame_entry scope::find_hypothesis(const std::string &label) const
 {
-    for (index i = 0; i < get_essential_hypotheses().size(); ++i)
-        if (get_essential_hypotheses()[i].label == label)
-            return i;
-    return -1;
+    auto iterator = label_to_hypothesis.find(label);
+    if (iterator != label_to_hypothesis.end())
+        return iterator->second;
+    else
+        return frame_entry{frame_entry::type_t::floating_hypothesis, -1};
 }
 /*----------------------------------------------------------------------------*/
 void scope::add_essential_hypothesis(essential_hypothesis &&hypothesis)
 {
-    /* TODO: Put global check for name clashes at level above. */
-    if(find_essential_hypothesis_index_by_label(hypothesis.label) != -1)
-        throw std::runtime_error("statement name clash");
-
+    add_label(
+                hypothesis.label,
+                frame_entry{
+                    frame_entry::type_t::essential_hypothesis,
+                    static_cast<index>(essential_hypotheses.size())});
     essential_hypotheses.push_back(std::move(hypothesis));
-
-    auto &added_hypothesis = essential_hypotheses.back();
-    label_to_essential_hypothesis_index[added_hypothesis.label] =
-            static_cast<int>(essential_hypotheses.size() - 1);
-
     spurious_frame.push_back(
                 frame_entry{
                     frame_entry::type_t::essential_hypothesis,
-                    static_cast<int>(essential_hypotheses.size() - 1)});
+                    static_cast<index>(essential_hypotheses.size() - 1)});
 }
 /*----------------------------------------------------------------------------*/
 void scope::add_disjoint_variable_restriction(
         disjoint_variable_restriction &&restriction)
 {
+    const index restriction_index = disjoint_variable_restrictions.size();
+    for (const auto &variable : restriction)
+    {
+        const auto variable_number = static_cast<std::size_t>(variable.second);
+        if (variable_number >= variable_restrictions.size())
+            variable_restrictions.resize(variable_number + 1);
+        auto &restrictions = variable_restrictions[variable_number];
+        /* "$d x x" is listed once */
+        if (restrictions.empty() || restrictions.back() != restriction_index)
+            restrictions.push_back(restriction_index);
+    }
+
     disjoint_variable_restrictions.push_back(std::move(restriction));
     spurious_frame.push_back(
                 frame_entry{
                     frame_entry::type_t::disjoint_variable_restriction,
-                    static_cast<int>(
+                    static_cast<index>(
                         disjoint_variable_restrictions.size() - 1)});
 }
 /*----------------------------------------------------------------------------*/
+mandatory_frame scope::build_mandatory_frame(const expression &expression_0)
+{
+    mandatory_variables.clear();
+    for (const auto &hypothesis : essential_hypotheses)
+        mandatory_variables.mark(hypothesis.expression_0);
+    mandatory_variables.mark(expression_0);
+
+    mandatory_frame result;
+    for (const auto &restriction : disjoint_variable_restrictions)
+        if (
+                mandatory_variables.is_marked(restriction[0])
+                && mandatory_variables.is_marked(restriction[1]))
+            result.disjoint_variable_restrictions.push_back(restriction);
+
+    index essential_hypothesis_index = 0;
+    index floating_hypothesis_index = 0;
+    for (const auto entry : spurious_frame)
+    {
+        switch (entry.type)
+        {
+        case frame_entry::type_t::disjoint_variable_restriction:
+            break;
+        case frame_entry::type_t::essential_hypothesis:
+            result.legacy_frame.push_back(
+                        frame_entry{entry.type, essential_hypothesis_index});
+            ++essential_hypothesis_index;
+            break;
+        case frame_entry::type_t::floating_hypothesis: {
+            const auto &hypothesis = floating_hypotheses[entry.index_0];
+            if (!mandatory_variables.is_marked(hypothesis.variable))
+                break;
+            result.floating_hypotheses.push_back(hypothesis);
+            result.legacy_frame.push_back(
+                        frame_entry{entry.type, floating_hypothesis_index});
+            ++floating_hypothesis_index;
+            break; }
+        }
+    }
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+std::vector<disjoint_variable_restriction>
+scope::extract_non_mandatory_restrictions(
+        const std::vector<floating_hypothesis> &mandatory_floating_hypotheses,
+        const std::vector<floating_hypothesis> &non_mandatory_hypotheses)
+{
+    mandatory_variables.clear();
+    for (const auto &hypothesis : mandatory_floating_hypotheses)
+        mandatory_variables.mark(hypothesis.variable);
+    non_mandatory_variables.clear();
+    for (const auto &hypothesis : non_mandatory_hypotheses)
+        non_mandatory_variables.mark(hypothesis.variable);
+
+    /* Only restrictions adjacent to non-mandatory variables are visited. A
+     * restriction between two of them is taken from its first variable. */
+    std::vector<index> selected;
+    for (const auto &hypothesis : non_mandatory_hypotheses)
+    {
+        const auto variable_number =
+                static_cast<std::size_t>(hypothesis.variable.second);
+        if (variable_number >= variable_restrictions.size())
+            continue;
+        for (const index i : variable_restrictions[variable_number])
+        {
+            const auto &restriction = disjoint_variable_restrictions[i];
+            const bool is_first = restriction[0] == hypothesis.variable;
+            const symbol_index other = restriction[is_first ? 1 : 0];
+            if (
+                    mandatory_variables.is_marked(other)
+                    || (
+                        non_mandatory_variables.is_marked(other)
+                        && is_first))
+                selected.push_back(i);
+        }
+    }
+    std::sort(selected.begin(), selected.end());
+
+    std::vector<disjoint_variable_restriction> result;
+    result.reserve(selected.size());
+    for (const index i : selected)
+        result.push_back(disjoint_variable_restrictions[i]);
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+void scope::add_label(const std::string &label, const frame_entry entry)
+{
+    /* TODO: Put global check for name clashes at level above. */
+    if (!label_to_hypothesis.emplace(label, entry).second)
+        throw std::runtime_error("statement name clash");
+}
+/*----------------------------------------------------------------------------*/
 void read_comment(tokenizer &tokenizer0);
 /*----------------------------------------------------------------------------*/
 expression read_expression(
@@ -153,6 +339,7 @@ expression read_expression(
         tokenizer &input_tokenizer,
         const std::string &terminating_token = "$.")
 {
+    const allocation_phase_scope phase(allocation_phase::parse_expression);
     expression result;
     while (input_tokenizer.peek() != terminating_token)
     {
@@ -166,25 +353,38 @@ expression read_expression(
     return result;
 }
 /*----------------------------------------------------------------------------*/
+/* State of reading a single file, other than the current scope. */
+struct reader_state
+{
+    const read_options &options;
+    legacy_frame_registry &registry;
+    label_normalizer normalizer;
+};
+/*----------------------------------------------------------------------------*/
 void read_statement(
         metamath_database &database,
-        legacy_frame_registry &registry,
+        reader_state &state,
         scope &current_scope,
         tokenizer &input_tokenizer);
 /*----------------------------------------------------------------------------*/
 void read_scope(
         metamath_database &database,
-        legacy_frame_registry &registry,
-        scope &parent_scope,
+        reader_state &state,
+        scope &current_scope,
         tokenizer &input_tokenizer)
 {
     if (input_tokenizer.get_token() != "${")
         throw std::runtime_error("scope does not start with \"${\"");
 
-    scope current_scope(parent_scope);
+    current_scope.enter();
     while (input_tokenizer.peek() != "$}")
-        read_statement(database, registry, current_scope, input_tokenizer);
+        read_statement(
+                    database,
+                    state,
+                    current_scope,
+                    input_tokenizer);
     input_tokenizer.get_token(); /* consume "$}" */
+    current_scope.leave();
 }
 /*----------------------------------------------------------------------------*/
 void read_variables(metamath_database &database, tokenizer &input_tokenizer)
@@ -256,100 +456,6 @@ void read_essential_hypothesis(
     input_tokenizer.get_token(); /* consume "$." */
 }
 /*----------------------------------------------------------------------------*/
-void collect_variables(
-        const expression &expression0,
-        std::set<symbol_index> &symbols_found,
-        std::vector<symbol_index> &result)
-{
-    /* Algorithm is designed to preserve the order of symbols in expression. */
-
-    for(auto symbol : expression0)
-    {
-        if(
-                symbol.first == symbol::type_t::variable
-                && symbols_found.count(symbol) == 0)
-        {
-            symbols_found.insert(symbol);
-            result.push_back(symbol);
-        }
-    }
-}
-/*----------------------------------------------------------------------------*/
-/* The order of variables in frame is the order of first occurance in hypotheses
- * and expression. */
-std::vector<symbol_index> collect_variables(
-        const std::vector<essential_hypothesis> &hypotheses,
-        const expression &expression0)
-{
-    std::set<symbol_index> symbols_found;
-    std::vector<symbol_index> result;
-
-    for(auto &hypothesis : hypotheses)
-        collect_variables(hypothesis.expression_0, symbols_found, result);
-    collect_variables(expression0, symbols_found, result);
-
-    return result;
-}
-/*----------------------------------------------------------------------------*/
-std::vector<disjoint_variable_restriction> filter_restrictions(
-        const std::vector<disjoint_variable_restriction> &input_restrictions,
-        const std::vector<symbol_index> variables)
-{
-    std::vector<disjoint_variable_restriction> result;
-    for (auto restriction : input_restrictions)
-    {
-        auto v0_iterator =
-                std::find(variables.begin(), variables.end(), restriction[0]);
-        auto v1_iterator =
-                std::find(variables.begin(), variables.end(), restriction[1]);
-        if (v0_iterator != variables.end() && v1_iterator != variables.end())
-            result.push_back(restriction);
-    }
-    return result;
-}
-/*----------------------------------------------------------------------------*/
-std::tuple<std::vector<floating_hypothesis>, frame>
-fill_legacy_frame_and_floating_hypotheses(
-        const frame &spurious_frame,
-        const std::vector<floating_hypothesis> &input_hypotheses,
-        const std::vector<symbol_index> &variables)
-{
-    std::vector<floating_hypothesis> floating_hypotheses;
-    frame legacy_frame;
-    index essential_hypothesis_index = 0;
-    index floating_hypothesis_index = 0;
-    for(auto entry : spurious_frame)
-    {
-        switch (entry.type)
-        {
-        case frame_entry::type_t::disjoint_variable_restriction:
-            break;
-        case frame_entry::type_t::essential_hypothesis:
-            legacy_frame.push_back(
-                        frame_entry{entry.type, essential_hypothesis_index});
-            ++essential_hypothesis_index;
-            break;
-        case frame_entry::type_t::floating_hypothesis: {
-            auto &hypothesis = input_hypotheses[entry.index_0];
-            auto iterator =
-                    std::find(
-                        variables.begin(),
-                        variables.end(),
-                        hypothesis.variable);
-            if (iterator == variables.end())
-                break;
-            floating_hypotheses.push_back(hypothesis);
-            legacy_frame.push_back(
-                        frame_entry{entry.type, floating_hypothesis_index});
-            ++floating_hypothesis_index;
-            break; }
-        }
-    }
-    return std::make_tuple(
-                std::move(floating_hypotheses),
-                std::move(legacy_frame));
-}
-/*----------------------------------------------------------------------------*/
 class compressed_proof_code_extractor
 {
 private:
@@ -360,13 +466,18 @@ public:
     compressed_proof_code_extractor(tokenizer &tokenizer_in) :
         tokenizer0(tokenizer_in)
     { }
+    /* Returns 0 for "?", an unknown step. */
     int extract_number()
     {
         int n = 0;
         while (true)
         {
             char z = get_character();
-            if ('A' <= z && z <= 'T')
+            if (z == '?' && n == 0)
+            {
+                return 0;
+            }
+            else if ('A' <= z && z <= 'T')
             {
                 n = n * 20 + z - 'A' + 1;
                 return n;
@@ -432,58 +543,124 @@ private:
     }
 };
 /*----------------------------------------------------------------------------*/
-std::vector<disjoint_variable_restriction> extract_non_mandatory_restrictions(
-        const std::vector<disjoint_variable_restriction>
-            &available_restrictions,
-        const std::vector<floating_hypothesis> &mandatory_floating_hypotheses,
-        const std::vector<floating_hypothesis> &non_mandatory_hypotheses)
+/* Resolves labels used in the proof of a single assertion. Hypotheses are
+ * found with a single lookup in the hashed labels of the scope, which is then
+ * translated to the proof's numbering: mandatory floating hypotheses first,
+ * non-mandatory ones appended in order of the first use. */
+class proof_label_resolver
 {
-    std::vector<disjoint_variable_restriction> non_mandatory_restrictions;
-    for (auto &restriction : available_restrictions)
+private:
+    const scope &current_scope;
+    const index mandatory_count;
+    /* index of floating hypothesis in scope -> index in proof steps, -1 if not
+     * used yet */
+    std::vector<index> floating_step_indices;
+    std::vector<floating_hypothesis> non_mandatory_hypotheses;
+
+public:
+    proof_label_resolver(
+            const scope &current_scope_in,
+            const std::vector<floating_hypothesis>
+                &mandatory_floating_hypotheses);
+
+    /* Returns step with index_0 == -1 if label is not a hypothesis. */
+    proof_step resolve(const std::string &label);
+
+    std::vector<floating_hypothesis> &get_non_mandatory_hypotheses()
     {
-        const auto is_variable_in_hypotheses =
-                [] (
-                const std::vector<floating_hypothesis> &hypotheses,
-                const symbol_index symbol) -> bool
-                {
-                    return
-                            std::find_if(
-                                hypotheses.begin(),
-                                hypotheses.end(),
-                                [&symbol](const floating_hypothesis &hypothesis)
-                                {
-                                    return hypothesis.variable == symbol;
-                                })
-                            != hypotheses.end();
-                };
-
-        const bool non_mandatory_0 =
-                is_variable_in_hypotheses(
-                    non_mandatory_hypotheses,
-                    restriction[0]);
-        const bool non_mandatory_1 =
-                is_variable_in_hypotheses(
-                    non_mandatory_hypotheses,
-                    restriction[1]);
-        const bool mandatory_0 =
-                is_variable_in_hypotheses(
-                    mandatory_floating_hypotheses,
-                    restriction[0]);
-        const bool mandatory_1 =
-                is_variable_in_hypotheses(
-                    mandatory_floating_hypotheses,
-                    restriction[1]);
+        return non_mandatory_hypotheses;
+    }
+};
+/*----------------------------------------------------------------------------*/
+proof_label_resolver::proof_label_resolver(
+        const scope &current_scope_in,
+        const std::vector<floating_hypothesis> &mandatory_floating_hypotheses) :
+    current_scope(current_scope_in),
+    mandatory_count(mandatory_floating_hypotheses.size()),
+    floating_step_indices(
+        current_scope_in.get_floating_hypotheses().size(),
+        -1)
+{
+    for (index i = 0; i < mandatory_count; ++i)
+    {
+        const frame_entry entry =
+                current_scope.find_hypothesis(
+                    mandatory_floating_hypotheses[i].label);
         if (
-                (non_mandatory_0 && non_mandatory_1)
-                || (non_mandatory_0 && mandatory_1)
-                || (mandatory_0 && non_mandatory_1))
+                entry.index_0 == -1
+                || entry.type != frame_entry::type_t::floating_hypothesis)
+            throw std::runtime_error(
+                    "mandatory floating hypothesis not found in scope");
+        floating_step_indices[entry.index_0] = i;
+    }
+}
+/*----------------------------------------------------------------------------*/
+proof_step proof_label_resolver::resolve(const std::string &label)
+{
+    const frame_entry entry = current_scope.find_hypothesis(label);
+    if (entry.index_0 == -1)
+        return proof_step{proof_step::type_t::unknown, -1, 0};
+
+    switch (entry.type)
+    {
+    case frame_entry::type_t::essential_hypothesis:
+        return proof_step{
+                    proof_step::type_t::essential_hypothesis,
+                    entry.index_0,
+                    0};
+    case frame_entry::type_t::floating_hypothesis: {
+        index &step_index = floating_step_indices[entry.index_0];
+        if (step_index == -1)
         {
-            non_mandatory_restrictions.push_back(restriction);
+            /* add to proof with
+             * index =
+             *      (non mandatory hypotheses count)
+             *      + (mandatory floating hypotheses count)
+             */
+            step_index =
+                    static_cast<index>(non_mandatory_hypotheses.size())
+                    + mandatory_count;
+            non_mandatory_hypotheses.push_back(
+                        current_scope.get_floating_hypotheses()[
+                            entry.index_0]);
         }
+        return proof_step{
+                    proof_step::type_t::floating_hypothesis,
+                    step_index,
+                    0}; }
+    case frame_entry::type_t::disjoint_variable_restriction:
+        break;
     }
-    return non_mandatory_restrictions;
+    throw std::runtime_error("unexpected frame entry for label");
 }
+/*----------------------------------------------------------------------------*/
+proof_step read_proof_label(
+        metamath_database &database,
+        const legacy_frame_registry &frame_registry,
+        proof_label_resolver &resolver,
+        const std::string &label)
+{
+    if (label == "?")
+        return proof_step{proof_step::type_t::unknown, 0, 0};
+
+    const proof_step hypothesis_step = resolver.resolve(label);
+    if (hypothesis_step.index_0 != -1)
+        return hypothesis_step;
+
+    auto assertion_index = database.find_assertion(label);
+    if (database.is_valid(assertion_index))
+    {
+        /* push with marking consumed count */
+        const index consumed_count =
+                frame_registry.get_frame_size(assertion_index.get_index());
+        return proof_step{
+                    proof_step::type_t::assertion,
+                    assertion_index.get_index(),
+                    consumed_count};
+    }
 
+    throw std::runtime_error("not recognized proof step");
+}
 /*----------------------------------------------------------------------------*/
 proof read_compressed_proof(
         metamath_database &database,
@@ -492,20 +669,21 @@ proof read_compressed_proof(
         legacy_frame_registry &frame_registry,
         const std::vector<floating_hypothesis> &mandatory_floating_hypotheses)
 {
+    const trace_span span("read_compressed_proof");
     input_tokenizer.get_token(); // read "("
 
     std::vector<proof_step> steps;
-    std::vector<floating_hypothesis> non_mandatory_hypotheses;
+    proof_label_resolver resolver(current_scope, mandatory_floating_hypotheses);
 
     const auto &essential_hypotheses = current_scope.get_essential_hypotheses();
-    const auto &other_floating_hypotheses =
-            current_scope.get_floating_hypotheses();
-    const auto &current_legacy_frame = frame_registry.frames.back();
+    const index current_assertion = frame_registry.size() - 1;
 
     const index mandatory_hypotheses_count =
             essential_hypotheses.size()
             + mandatory_floating_hypotheses.size();
-    if (mandatory_hypotheses_count != current_legacy_frame.size())
+    if (
+            mandatory_hypotheses_count
+            != frame_registry.get_frame_size(current_assertion))
         throw std::runtime_error(
                 "collected mandatory hypotheses count does not match the size "
                 "of the frame");
@@ -517,54 +695,12 @@ proof read_compressed_proof(
         while (input_tokenizer.peek() == "$(")
             read_comment(input_tokenizer);
 
-        const auto name = input_tokenizer.get_token();
-
-        if (name == "?")
-        {
-            referred_statements.push_back(
-                        proof_step{proof_step::type_t::unknown, 0, 0});
-            continue;
-        }
-
-        auto assertion_index = database.find_assertion(name);
-        if (database.is_valid(assertion_index))
-        {
-            /* push with marking consumed count */
-            const frame &assertions_frame =
-                    frame_registry.frames[assertion_index.get_index()];
-            const index consumed_count =
-                    static_cast<index>(assertions_frame.size());
-            referred_statements.push_back(
-                        proof_step{
-                            proof_step::type_t::assertion,
-                            assertion_index.get_index(),
-                            consumed_count});
-            continue;
-        }
-
-        auto new_non_mandatory_iterator =
-                std::find_if(
-                    other_floating_hypotheses.begin(),
-                    other_floating_hypotheses.end(),
-                    [&name](const floating_hypothesis &hypothesis) -> bool
-                    {
-                        return hypothesis.label == name;
-                    });
-        if (new_non_mandatory_iterator != other_floating_hypotheses.end())
-        {
-            const index non_mandatory_index =
-                    non_mandatory_hypotheses.size()
-                    + mandatory_floating_hypotheses.size();
-            non_mandatory_hypotheses.push_back(*new_non_mandatory_iterator);
-            referred_statements.push_back(
-                        proof_step{
-                            proof_step::type_t::floating_hypothesis,
-                            non_mandatory_index,
-                            0});
-            continue;
-        }
-
-        throw std::runtime_error("not recognized proof step");
+        referred_statements.push_back(
+                    read_proof_label(
+                        database,
+                        frame_registry,
+                        resolver,
+                        input_tokenizer.get_token()));
     }
     const index referred_statements_count = referred_statements.size();
 
@@ -575,10 +711,16 @@ proof read_compressed_proof(
     while (!extractor.is_end_of_proof())
     {
         index number = extractor.extract_number() - 1;
-        if (number < mandatory_hypotheses_count)
+        if (number == -1)
+        {
+            steps.push_back(proof_step{proof_step::type_t::unknown, 0, 0});
+        }
+        else if (number < mandatory_hypotheses_count)
         {
+            const frame_entry entry =
+                    frame_registry.get_entry(current_assertion, number);
             proof_step::type_t step_type;
-            switch (current_legacy_frame[number].type)
+            switch (entry.type)
             {
             case frame_entry::type_t::essential_hypothesis:
                 step_type = proof_step::type_t::essential_hypothesis;
@@ -593,7 +735,7 @@ proof read_compressed_proof(
             steps.push_back(
                         proof_step{
                             step_type,
-                            current_legacy_frame[number].index_0,
+                            entry.index_0,
                             0});
         }
         else if (
@@ -624,14 +766,13 @@ proof read_compressed_proof(
     }
 
     std::vector<disjoint_variable_restriction> non_mandatory_restrictions =
-            extract_non_mandatory_restrictions(
-                current_scope.get_disjoint_variable_restrictions(),
+            current_scope.extract_non_mandatory_restrictions(
                 mandatory_floating_hypotheses,
-                non_mandatory_hypotheses);
+                resolver.get_non_mandatory_hypotheses());
 
     return proof{
                 std::move(non_mandatory_restrictions),
-                std::move(non_mandatory_hypotheses),
+                std::move(resolver.get_non_mandatory_hypotheses()),
                 std::move(steps)};
 }
 //------------------------------------------------------------------------------
@@ -642,394 +783,44 @@ proof read_uncompressed_proof(
         legacy_frame_registry &frame_registry,
         const std::vector<floating_hypothesis> &mandatory_floating_hypotheses)
 {
+    const trace_span span("read_uncompressed_proof");
     std::vector<proof_step> steps;
-    std::vector<floating_hypothesis> non_mandatory_hypotheses;
-
-    const auto &essential_hypotheses = current_scope.get_essential_hypotheses();
-    const auto &other_floating_hypotheses =
-            current_scope.get_floating_hypotheses();
+    proof_label_resolver resolver(current_scope, mandatory_floating_hypotheses);
 
     while (input_tokenizer.peek() != "$.")
     {
         while (input_tokenizer.peek() == "$(")
             read_comment(input_tokenizer);
 
-        auto name = input_tokenizer.get_token();
-        if (name == "?")
-        {
-            steps.push_back(proof_step{proof_step::type_t::unknown, 0, 0});
-            continue;
-        }
-
-        auto assertion_index = database.find_assertion(name);
-        if (database.is_valid(assertion_index))
-        {
-            /* push with marking consumed count */
-            const frame &assertions_frame =
-                    frame_registry.frames[assertion_index.get_index()];
-            const index consumed_count =
-                    static_cast<index>(assertions_frame.size());
-            steps.push_back(
-                        proof_step{
-                            proof_step::type_t::assertion,
-                            assertion_index.get_index(),
-                            consumed_count});
-            continue;
-        }
-        auto essential_iterator =
-                std::find_if(
-                    essential_hypotheses.begin(),
-                    essential_hypotheses.end(),
-                    [&name](const essential_hypothesis &hypothesis) -> bool
-                    {
-                        return hypothesis.label == name;
-                    });
-        if (essential_iterator != essential_hypotheses.end())
-        {
-            /* just push with index */
-            steps.push_back(
-                        proof_step{
-                            proof_step::type_t::essential_hypothesis,
-                            essential_iterator - essential_hypotheses.begin(),
-                            0});
-            continue;
-        }
-
-        auto mandatory_iterator =
-                std::find_if(
-                    mandatory_floating_hypotheses.begin(),
-                    mandatory_floating_hypotheses.end(),
-                    [&name](const floating_hypothesis &hypothesis) -> bool
-                    {
-                        return hypothesis.label == name;
-                    });
-        if (mandatory_iterator != mandatory_floating_hypotheses.end())
-        {
-            /* just push with index */
-            const index mandatory_index =
-                    mandatory_iterator - mandatory_floating_hypotheses.begin();
-            steps.push_back(
-                        proof_step{
-                            proof_step::type_t::floating_hypothesis,
-                            mandatory_index,
-                            0});
-            continue;
-        }
-
-        auto non_mandatory_iterator =
-                std::find_if(
-                    non_mandatory_hypotheses.begin(),
-                    non_mandatory_hypotheses.end(),
-                    [&name](const floating_hypothesis &hypothesis) -> bool
-                    {
-                        return hypothesis.label == name;
-                    });
-        if (non_mandatory_iterator != non_mandatory_hypotheses.end())
-        {
-            /* add to proof and push with
-             * index = (index in proof) + (mandatory floating hypotheses count)
-             */
-            const index non_mandatory_index =
-                    (non_mandatory_iterator - non_mandatory_hypotheses.begin())
-                    + static_cast<index>(mandatory_floating_hypotheses.size());
-            steps.push_back(
-                        proof_step{
-                            proof_step::type_t::floating_hypothesis,
-                            non_mandatory_index,
-                            0});
-            continue;
-        }
-
-        auto new_non_mandatory_iterator =
-                std::find_if(
-                    other_floating_hypotheses.begin(),
-                    other_floating_hypotheses.end(),
-                    [&name](const floating_hypothesis &hypothesis) -> bool
-                    {
-                        return hypothesis.label == name;
-                    });
-        if (new_non_mandatory_iterator != other_floating_hypotheses.end())
-        {
-            /* add to proof and push with
-             * index =
-             *      (non mandatory hypotheses count)
-             *      + (mandatory floating hypotheses count)
-             */
-            const index non_mandatory_index =
-                    non_mandatory_hypotheses.size()
-                    + mandatory_floating_hypotheses.size();
-            non_mandatory_hypotheses.push_back(*new_non_mandatory_iterator);
-            steps.push_back(
-                        proof_step{
-                            proof_step::type_t::floating_hypothesis,
-                            non_mandatory_index,
-                            0});
-            continue;
-        }
-
-        throw std::runtime_error("not recognized proof step");
+        steps.push_back(
+                    read_proof_label(
+                        database,
+                        frame_registry,
+                        resolver,
+                        input_tokenizer.get_token()));
     }
 
     std::vector<disjoint_variable_restriction> non_mandatory_restrictions =
-            extract_non_mandatory_restrictions(
-                current_scope.get_disjoint_variable_restrictions(),
+            current_scope.extract_non_mandatory_restrictions(
                 mandatory_floating_hypotheses,
-                non_mandatory_hypotheses);
+                resolver.get_non_mandatory_hypotheses());
 
     return proof{
                 std::move(non_mandatory_restrictions),
-                std::move(non_mandatory_hypotheses),
+                std::move(resolver.get_non_mandatory_hypotheses()),
                 std::move(steps)};
 }
 /*----------------------------------------------------------------------------*/
-std::string find_free_name(
-        const std::string &base_name,
-        const metamath_database &database,
-        const std::set<std::string> &other_names)
-{
-    std::string result = base_name;
-    index i = 0;
-    while (
-           database.is_reserved(result)
-           || other_names.find(result) != other_names.end())
-    {
-        result = base_name + '_' + std::to_string(i);
-        ++i;
-    }
-    return result;
-}
-/*----------------------------------------------------------------------------*/
-std::string fix_assertion_label(
-        const std::string &assertion_label,
-        const metamath_database &database)
-{
-    std::string result = assertion_label;
-    std::replace(result.begin(), result.end(), '.', '_');
-    result = find_free_name(result, database, std::set<std::string>());
-    return result;
-}
-/*----------------------------------------------------------------------------*/
-std::string fix_hypothesis_label(
-        const std::string &assertion_label,
-        const std::string &hypothesis_label,
-        const metamath_database &database,
-        const std::set<std::string> &other_names)
-{
-    const index assertion_label_size =
-            assertion_label.size();
-    const index hypothesis_label_size =
-            hypothesis_label.size();
-    const bool correct_prefix =
-            hypothesis_label_size >= assertion_label_size + 2
-            && std::equal(
-                assertion_label.begin(),
-                assertion_label.end(),
-                hypothesis_label.begin())
-            && hypothesis_label[assertion_label_size] == '.';
-
-    std::string result;
-
-    if (correct_prefix)
-    {
-        result = hypothesis_label;
-    }
-    else
-    {
-        result = assertion_label + "." + hypothesis_label;
-    }
-    std::replace(
-                result.begin() + assertion_label_size + 1,
-                result.end(),
-                '.',
-                '_');
-    return find_free_name(result, database, other_names);
-}
-/*----------------------------------------------------------------------------*/
-void fix_labels_for_assertion(
-        std::string &assertion_label,
-        std::vector<floating_hypothesis> &floating_hypotheses,
-        std::vector<essential_hypothesis> &essential_hypotheses,
-        std::vector<floating_hypothesis> &non_mandatory_floating_hypotheses,
-        const metamath_database &database)
-{
-    std::set<std::string> other_names;
-    assertion_label =
-            fix_assertion_label(assertion_label, database);
-    other_names.insert(assertion_label);
-    for (auto &hypothesis : floating_hypotheses)
-    {
-        hypothesis.label =
-                fix_hypothesis_label(
-                    assertion_label,
-                    hypothesis.label,
-                    database,
-                    other_names);
-        other_names.insert(hypothesis.label);
-    }
-    for (auto &hypothesis : essential_hypotheses)
-    {
-        hypothesis.label =
-                fix_hypothesis_label(
-                    assertion_label,
-                    hypothesis.label,
-                    database,
-                    other_names);
-        other_names.insert(hypothesis.label);
-    }
-    for (auto &hypothesis : non_mandatory_floating_hypotheses)
-    {
-        hypothesis.label =
-                fix_hypothesis_label(
-                    assertion_label,
-                    hypothesis.label,
-                    database,
-                    other_names);
-        other_names.insert(hypothesis.label);
-    }
-}
-/*----------------------------------------------------------------------------*/
-template <typename T>
-void reorder_vector(std::vector<T> &vector, const std::vector<index> &map)
-{
-    auto old_vector = vector;
-    for (index i = 0; i < vector.size(); ++i)
-        vector[map[i]] = old_vector[i];
-}
-/*----------------------------------------------------------------------------*/
-void reorder_proof(
-        proof &proof_0,
-        const legacy_frame_registry &registry)
-{
-    /* maps from old index to new index */
-    std::vector<index> map(proof_0.steps.size());
-    std::iota(map.begin(), map.end(), 0);
-
-    std::vector<index> stack;
-    std::vector<index> dependency_counts(proof_0.steps.size());
-
-    for (index i = 0; i < proof_0.steps.size(); ++i)
-    {
-        auto &step = proof_0.steps[i];
-        switch (step.type)
-        {
-        case proof_step::type_t::floating_hypothesis:
-            /* no dependencies - nothing to do. */
-            dependency_counts[i] = 0;
-            stack.push_back(i);
-            break;
-        case proof_step::type_t::essential_hypothesis:
-            /* Needed floating hypotheses are also hypotheses of assertion.
-             * Reordering is done when processing assertion. */
-            dependency_counts[i] = 0;
-            stack.push_back(i);
-            break;
-        case proof_step::type_t::assertion: {
-            /* input order:
-             *    registry.frames[i->index] - each entry matches entry on the
-             *    stack
-             * output order:
-             *    mandatory floating hypotheses
-             *    essential hypotheses
-             */
-            auto &legacy_frame = registry.frames[step.index_0];
-            index floating_offset = 0;
-            index essential_offset = 0;
-            index legacy_offset = 0;
-            for (index j = 0; j < legacy_frame.size(); ++j)
-            {
-                auto l = *(stack.end() - legacy_frame.size() + j);
-                if (
-                        legacy_frame[j].type
-                        == frame_entry::type_t::floating_hypothesis)
-                {
-                    essential_offset += dependency_counts[l] + 1;
-                }
-            }
-            for (index j = 0; j < legacy_frame.size(); ++j)
-            {
-                auto l = *(stack.end() - legacy_frame.size() + j);
-                auto l_branch_begin = l - dependency_counts[l];
-                auto l_branch_end = l + 1;
-                switch (legacy_frame[j].type)
-                {
-                case frame_entry::type_t::floating_hypothesis:
-                    for (index k = l_branch_begin; k < l_branch_end; ++k)
-                        map[k] += floating_offset - legacy_offset;
-                    floating_offset += dependency_counts[l] + 1;
-                    break;
-
-                case frame_entry::type_t::essential_hypothesis:
-                    for (index k = l_branch_begin; k < l_branch_end; ++k)
-                        map[k] += essential_offset - legacy_offset;
-                    essential_offset += dependency_counts[l] + 1;
-                    break;
-
-                case frame_entry::type_t::disjoint_variable_restriction:
-                    throw
-                            std::runtime_error(
-                                "unexpected disjoint variable restriction "
-                                "in legacy frame");
-                }
-                legacy_offset += dependency_counts[l] + 1;
-            }
-            dependency_counts[i] = legacy_offset;
-            stack.resize(stack.size() - legacy_frame.size());
-            stack.push_back(i);
-            break; }
-        case proof_step::type_t::recall:
-            /* no dependencies - nothing to do. */
-            dependency_counts[i] = 0;
-            stack.push_back(i);
-            break;
-        case proof_step::type_t::unknown:
-            /* no dependencies - nothing to do. */
-            dependency_counts[i] = 0;
-            stack.push_back(i);
-            break;
-        }
-    }
-
-    for (index i = 0; i < proof_0.steps.size(); ++i)
-    {
-        auto &step = proof_0.steps[i];
-        if (step.type == proof_step::type_t::recall)
-            step.index_0 = map[step.index_0];
-    }
-    reorder_vector(proof_0.steps, map);
-    reorder_vector(dependency_counts, map);
-
-    /* TODO: Now "recall" steps can refer to future steps. Need to reorder them.
-     */
-    throw std::runtime_error("TODO!");
-    std::iota(map.begin(), map.end(), 0);
-//    index push_offset = 0;
-    for (index i = 0; i < proof_0.steps.size(); ++i)
-    {
-        auto &step = proof_0.steps[i];
-        if (step.type == proof_step::type_t::recall)
-        {
-            if (map[step.index_0] > i)
-            {
-                const index branch_begin =
-                        step.index_0 - dependency_counts[step.index_0];
-                const index branch_end = step.index_0 + 1;
-                for (index j = branch_begin; j < branch_end; ++j)
-                {
-                    map[j] += -branch_begin + i;
-                }
-            }
-        }
-    }
-
-}
-/*----------------------------------------------------------------------------*/
 void read_assertion(
         metamath_database &database,
         scope &current_scope,
-        legacy_frame_registry &registry,
+        reader_state &state,
         tokenizer &input_tokenizer,
-        const std::string &label)
+        const std::string &label,
+        const index statement_begin)
 {
+    const trace_span span("read_assertion");
+    legacy_frame_registry &registry = state.registry;
     assertion::type_t type;
     if (input_tokenizer.peek() == "$a")
         type = assertion::type_t::axiom;
@@ -1047,35 +838,26 @@ void read_assertion(
     expression expression0 =
             read_expression(database, input_tokenizer, expression_terminator);
     auto essential_hypotheses = current_scope.get_essential_hypotheses();
-    auto variables = collect_variables(essential_hypotheses, expression0);
-    auto disjoint_variable_restrictions =
-            filter_restrictions(
-                current_scope.get_disjoint_variable_restrictions(),
-                variables);
-
-    std::vector<floating_hypothesis> floating_hypotheses;
-    frame legacy_frame;
-    std::tie(floating_hypotheses, legacy_frame) =
-            fill_legacy_frame_and_floating_hypotheses(
-                current_scope.get_spurious_frame(),
-                current_scope.get_floating_hypotheses(),
-                variables);
+    mandatory_frame frame_0 = current_scope.build_mandatory_frame(expression0);
+    auto &disjoint_variable_restrictions =
+            frame_0.disjoint_variable_restrictions;
+    auto &floating_hypotheses = frame_0.floating_hypotheses;
 
-    registry.frames.push_back(legacy_frame);
+    registry.add_frame(frame_0.legacy_frame);
 
     switch (type)
     {
     case assertion::type_t::axiom: {
+        input_tokenizer.get_token(); /* consume "$." */
 
         /* fix labels */
         std::string new_label = label;
         std::vector<floating_hypothesis> dummy;
-        fix_labels_for_assertion(
+        state.normalizer.normalize(
                     new_label,
                     floating_hypotheses,
                     essential_hypotheses,
-                    dummy,
-                    database);
+                    dummy);
 
         assertion new_assertion{
                     label,
@@ -1086,8 +868,20 @@ void read_assertion(
                     std::move(expression0),
                     proof()};
         database.add_assertion(std::move(new_assertion));
+        if (state.options.retain_source_locations)
+            database.set_source_location(
+                        assertion_index(registry.size() - 1),
+                        source_location{
+                            statement_begin,
+                            input_tokenizer.get_consumed_offset(),
+                            input_tokenizer.get_consumed_offset(),
+                            input_tokenizer.get_consumed_offset(),
+                            {},
+                            {}});
         break; }
     case assertion::type_t::theorem: {
+        const allocation_phase_scope phase(allocation_phase::decode_proof);
+        const index proof_begin = input_tokenizer.get_next_token_offset();
         input_tokenizer.get_token(); /* consume "$=" */
 
         proof new_proof;
@@ -1114,14 +908,25 @@ void read_assertion(
 
         reorder_proof(new_proof, registry);
 
+        input_tokenizer.get_token(); /* consume "$." */
+        if (state.options.retain_source_locations)
+            database.set_source_location(
+                        assertion_index(registry.size() - 1),
+                        source_location{
+                            statement_begin,
+                            input_tokenizer.get_consumed_offset(),
+                            proof_begin,
+                            input_tokenizer.get_consumed_offset(),
+                            new_proof.floating_hypotheses,
+                            new_proof.disjoint_variable_restrictions});
+
         /* fix labels */
         std::string new_label = label;
-        fix_labels_for_assertion(
+        state.normalizer.normalize(
                     new_label,
                     floating_hypotheses,
                     essential_hypotheses,
-                    new_proof.floating_hypotheses,
-                    database);
+                    new_proof.floating_hypotheses);
 
         assertion new_assertion{
                     new_label,
@@ -1130,12 +935,10 @@ void read_assertion(
                     std::move(floating_hypotheses),
                     std::move(essential_hypotheses),
                     std::move(expression0),
-                    new_proof};
+                    std::move(new_proof)};
         database.add_assertion(std::move(new_assertion));
         break; }
     }
-
-    input_tokenizer.get_token(); /* consume "$." */
 }
 /*----------------------------------------------------------------------------*/
 void read_disjoint_variable_restriction(
@@ -1154,6 +957,12 @@ void read_disjoint_variable_restriction(
     if (!database.is_valid(index_0) || !database.is_valid(index_1))
         throw std::runtime_error(
                 "invalid symbol in disjoint variable restriction");
+    /* restrictions are indexed by variable number, which constants share */
+    if (
+            index_0.first != symbol::type_t::variable
+            || index_1.first != symbol::type_t::variable)
+        throw std::runtime_error(
+                "constant in disjoint variable restriction");
     disjoint_variable_restriction restriction{{index_0, index_1}};
     current_scope.add_disjoint_variable_restriction(std::move(restriction));
 
@@ -1175,10 +984,11 @@ void read_comment(tokenizer &input_tokenizer)
 /*----------------------------------------------------------------------------*/
 void read_statement(
         metamath_database &database,
-        legacy_frame_registry &registry,
+        reader_state &state,
         scope &current_scope,
         tokenizer &input_tokenizer)
 {
+    const index statement_begin = input_tokenizer.get_next_token_offset();
     std::string label;
     if (input_tokenizer.peek().at(0) != '$')
         label = input_tokenizer.get_token();
@@ -1188,9 +998,10 @@ void read_statement(
         read_assertion(
                     database,
                     current_scope,
-                    registry,
+                    state,
                     input_tokenizer,
-                    label);
+                    label,
+                    statement_begin);
     }
     else if (input_tokenizer.peek() == "$v")
     {
@@ -1200,7 +1011,11 @@ void read_statement(
     {
         if (!label.empty())
             throw std::runtime_error("Scope with label found.");
-        read_scope(database, registry, current_scope, input_tokenizer);
+        read_scope(
+                    database,
+                    state,
+                    current_scope,
+                    input_tokenizer);
     }
     else if (input_tokenizer.peek() == "$c")
     {
@@ -1239,28 +1054,42 @@ void read_statement(
 /*----------------------------------------------------------------------------*/
 void read_database_from_file(
         metamath_database &database,
-        tokenizer &input_tokenizer)
+        tokenizer &input_tokenizer,
+        const read_options &options)
 {
+    const trace_span span("read_database");
     scope top_scope;
-    legacy_frame_registry registry;
+    auto registry = std::make_shared<legacy_frame_registry>();
+    reader_state state{options, *registry, label_normalizer(database)};
     while(!input_tokenizer.peek().empty())
     {
-        read_statement(database, registry, top_scope, input_tokenizer);
+        read_statement(
+                    database,
+                    state,
+                    top_scope,
+                    input_tokenizer);
+    }
+
+    if (options.retain_legacy_frames)
+    {
+        registry->shrink_to_fit();
+        database.set_legacy_frames(std::move(registry));
     }
 }
 /*----------------------------------------------------------------------------*/
-void write_expression_to_file(
+void write_expression(
         const metamath_database &database,
         const expression &expression_0,
-        std::ostream &output_stream)
+        std::string &output)
 {
     for(auto symbol : expression_0)
-        output_stream << database.get_symbol_label(symbol) << ' ';
+    {
+        output += database.get_symbol_label(symbol);
+        output += ' ';
+    }
 }
 /*----------------------------------------------------------------------------*/
-void write_symbols_to_file(
-        const metamath_database &database,
-        std::ostream &output_stream)
+void write_symbols(const metamath_database &database, std::string &output)
 {
     const auto constants_range =
             boost::make_iterator_range(
@@ -1268,12 +1097,13 @@ void write_symbols_to_file(
                 database.constants_end());
     if (constants_range.begin() != constants_range.end())
     {
-        output_stream << "$c ";
+        output += "$c ";
         for(auto symbol_index : constants_range)
         {
-            output_stream << database.get_symbol_label(symbol_index) << ' ';
+            output += database.get_symbol_label(symbol_index);
+            output += ' ';
         }
-        output_stream << "$.\n";
+        output += "$.\n";
     }
 
     const auto variables_range =
@@ -1282,224 +1112,305 @@ void write_symbols_to_file(
                 database.variables_end());
     if (!variables_range.empty())
     {
-        output_stream << "$v ";
+        output += "$v ";
         for(auto symbol_index : variables_range)
         {
-            output_stream << database.get_symbol_label(symbol_index) << ' ';
+            output += database.get_symbol_label(symbol_index);
+            output += ' ';
         }
-        output_stream << "$.\n";
+        output += "$.\n";
     }
 }
 /*----------------------------------------------------------------------------*/
 void write_floating_hypothesis(
         const metamath_database &database,
         const floating_hypothesis &hypothesis,
-        std::ostream &output_stream)
+        std::string &output)
 {
-    output_stream
-            << "    " << hypothesis.label << " $f "
-            << database.get_symbol_label(hypothesis.type) << ' '
-            << database.get_symbol_label(hypothesis.variable) << ' '
-            << "$.\n";
+    output += "    ";
+    output += hypothesis.label;
+    output += " $f ";
+    output += database.get_symbol_label(hypothesis.type);
+    output += ' ';
+    output += database.get_symbol_label(hypothesis.variable);
+    output += " $.\n";
 }
 /*----------------------------------------------------------------------------*/
 void write_essential_hypothesis(
         const metamath_database &database,
         const essential_hypothesis &hypothesis,
-        std::ostream &output_stream)
+        std::string &output)
 {
-    output_stream << "    " << hypothesis.label << " $e ";
-    write_expression_to_file(database, hypothesis.expression_0, output_stream);
-    output_stream << "$.\n";
+    output += "    ";
+    output += hypothesis.label;
+    output += " $e ";
+    write_expression(database, hypothesis.expression_0, output);
+    output += "$.\n";
 }
 /*----------------------------------------------------------------------------*/
 void write_disjoint_variable_restriction(
         const metamath_database &database,
         const disjoint_variable_restriction &restriction,
-        std::ostream &output_stream)
+        std::string &output)
 {
-    output_stream
-            << "    $d "
-            << database.get_symbol_label(restriction[0]) << ' '
-            << database.get_symbol_label(restriction[1]) << ' '
-            << "$.\n";
+    output += "    $d ";
+    output += database.get_symbol_label(restriction[0]);
+    output += ' ';
+    output += database.get_symbol_label(restriction[1]);
+    output += " $.\n";
 }
 /*----------------------------------------------------------------------------*/
-std::string encode_compressed_number(index number)
+void write_assertion_statement(
+        const metamath_database &database,
+        const assertion &assertion_0,
+        compressed_proof_writer &proof_writer,
+        std::string &output)
 {
-    std::string result;
-    number--;
-    if (number < 0)
-        throw std::runtime_error("n < 1");
-
-    result.push_back('A' + number % 20);
-    number /= 20;
-    while (number > 0)
+    output += "    ";
+    output += assertion_0.label;
+    if (assertion_0.type == assertion::type_t::axiom)
+        output += " $a ";
+    else
+        output += " $p ";
+
+    write_expression(database, assertion_0.expression_0, output);
+
+    /* Saving only in compressed form is supported. */
+    if (assertion_0.type == assertion::type_t::theorem)
     {
-        number--;
-        result.push_back('U' + number % 5);
-        number /= 5;
+        output += '\n';
+        proof_writer.write(assertion_0, output);
     }
-    std::reverse(result.begin(), result.end());
-    return result;
+    else
+    {
+        output += " $.";
+    }
+    output += '\n';
+}
+/*----------------------------------------------------------------------------*/
+void write_proof_statements(
+        const metamath_database &database,
+        const proof &proof_0,
+        std::string &output)
+{
+    for (const auto &hypothesis : proof_0.floating_hypotheses)
+        write_floating_hypothesis(database, hypothesis, output);
+
+    for (const auto &restriction : proof_0.disjoint_variable_restrictions)
+        write_disjoint_variable_restriction(database, restriction, output);
 }
 /*----------------------------------------------------------------------------*/
 void write_assertion(
         const metamath_database &database,
         const assertion &assertion_0,
-        std::ostream &output_stream)
+        compressed_proof_writer &proof_writer,
+        std::string &output)
 {
-    output_stream << "${\n";
+    output += "${\n";
 
     for (const auto &hypothesis : assertion_0.floating_hypotheses)
-        write_floating_hypothesis(database, hypothesis, output_stream);
+        write_floating_hypothesis(database, hypothesis, output);
 
     for (const auto &hypothesis : assertion_0.essential_hypotheses)
-        write_essential_hypothesis(database, hypothesis, output_stream);
+        write_essential_hypothesis(database, hypothesis, output);
 
     for (const auto &restriction : assertion_0.disjoint_variable_restrictions)
-        write_disjoint_variable_restriction(
-                    database,
-                    restriction,
-                    output_stream);
+        write_disjoint_variable_restriction(database, restriction, output);
 
     if (assertion_0.type == assertion::type_t::theorem)
-    {
-        const proof &proof_0 = assertion_0.proof_0;
-        for (const auto &hypothesis : proof_0.floating_hypotheses)
-            write_floating_hypothesis(database, hypothesis, output_stream);
+        write_proof_statements(database, assertion_0.proof_0, output);
 
-        for (const auto &restriction : proof_0.disjoint_variable_restrictions)
-            write_disjoint_variable_restriction(
-                        database,
-                        restriction,
-                        output_stream);
+    write_assertion_statement(database, assertion_0, proof_writer, output);
+
+    output += "$}\n";
+}
+/*----------------------------------------------------------------------------*/
+/* Shared statements are written once, members needing their own statements
+ * get a nested scope. */
+void write_scope_group(
+        const metamath_database &database,
+        const scope_group &group,
+        compressed_proof_writer &proof_writer,
+        std::string &output)
+{
+    if (group.end - group.begin == 1)
+    {
+        write_assertion(
+                    database,
+                    database.get_assertion(assertion_index(group.begin)),
+                    proof_writer,
+                    output);
+        return;
     }
 
-    output_stream << "    " << assertion_0.label;
-    if (assertion_0.type == assertion::type_t::axiom)
-        output_stream << " $a ";
-    else
-        output_stream << " $p ";
+    output += "${\n";
 
-    write_expression_to_file(database, assertion_0.expression_0, output_stream);
+    for (const auto &hypothesis : group.floating_hypotheses)
+        write_floating_hypothesis(database, hypothesis, output);
 
-    if (assertion_0.type == assertion::type_t::theorem)
+    for (const auto &hypothesis : group.essential_hypotheses)
+        write_essential_hypothesis(database, hypothesis, output);
+
+    for (const auto &restriction : group.disjoint_variable_restrictions)
+        write_disjoint_variable_restriction(database, restriction, output);
+
+    for (index i = group.begin; i < group.end; ++i)
     {
-        /* Saving only in compressed form is supported. */
+        const assertion &assertion_0 =
+                database.get_assertion(assertion_index(i));
         const proof &proof_0 = assertion_0.proof_0;
+        const bool has_own_statements =
+                !proof_0.floating_hypotheses.empty()
+                || !proof_0.disjoint_variable_restrictions.empty();
 
-        std::vector<assertion_index> referred_assertions;
-        for (const auto step : proof_0.steps)
+        if (has_own_statements)
         {
-            if (step.type == proof_step::type_t::assertion)
-            {
-                assertion_index current_assertion_index(step.index_0);
-                if (
-                        std::find(
-                            referred_assertions.begin(),
-                            referred_assertions.end(),
-                            current_assertion_index)
-                        == referred_assertions.end())
-                {
-                    referred_assertions.push_back(current_assertion_index);
-                }
-            }
+            output += "    ${\n";
+            write_proof_statements(database, proof_0, output);
         }
+        write_assertion_statement(
+                    database,
+                    assertion_0,
+                    proof_writer,
+                    output);
+        if (has_own_statements)
+            output += "    $}\n";
+    }
+
+    output += "$}\n";
+}
+/*----------------------------------------------------------------------------*/
+/* Formats the database into consecutive chunks of the output. Chunks of
+ * groups are formatted in parallel, each with its own proof writer. */
+std::vector<std::string> format_database(
+        const metamath_database &database,
+        const write_options &options)
+{
+    const trace_span span("format_database");
+    const allocation_phase_scope phase(allocation_phase::write);
+    std::vector<scope_group> groups;
+    if (options.regroup_scopes)
+    {
+        groups = find_scope_groups(database);
+    }
+    else
+    {
+        const index assertions_count =
+                (*database.assertions_end()).get_index();
+        groups.reserve(assertions_count);
+        for (index i = 0; i < assertions_count; ++i)
+            groups.push_back(scope_group{i, i + 1, {}, {}, {}});
+    }
+    const index groups_count = groups.size();
 
-        output_stream << "\n    $= ( ";
-        for (const auto &hypothesis : proof_0.floating_hypotheses)
-            output_stream << hypothesis.label << ' ';
-        for (const auto &assertion_index : referred_assertions)
-            output_stream
-                    << database.get_assertion(assertion_index).label
-                    << ' ';
-        output_stream << ") ";
+    std::vector<std::string> chunks(1);
+    write_symbols(database, chunks.front());
 
-        for (const auto step : proof_0.steps)
-        {
-            switch (step.type)
+    const auto format_groups =
+            [&] (const index begin, const index end, std::string &output)
             {
-            case proof_step::type_t::floating_hypothesis: {
-                index index_0 = step.index_0;
-                if (step.index_0 >= assertion_0.floating_hypotheses.size())
-                    index_0 +=
-                            assertion_0.floating_hypotheses.size()
-                            + assertion_0.essential_hypotheses.size();
-                output_stream << encode_compressed_number(index_0 + 1);
-                break; }
-            case proof_step::type_t::essential_hypothesis:
-                output_stream
-                        << encode_compressed_number(
-                               step.index_0
-                               + assertion_0.floating_hypotheses.size()
-                               + 1);
-                break;
-            case proof_step::type_t::assertion: {
-                assertion_index current_assertion_index(
-                            step.index_0);
-                auto index_iterator =
-                        std::find(
-                            referred_assertions.begin(),
-                            referred_assertions.end(),
-                            current_assertion_index);
-                if (index_iterator == referred_assertions.end())
-                    throw std::runtime_error(
-                            "assertion index not found on list of referred "
-                            "assertions");
-                output_stream
-                        << encode_compressed_number(
-                               (index_iterator - referred_assertions.begin())
-                               + assertion_0.floating_hypotheses.size()
-                               + assertion_0.essential_hypotheses.size()
-                               + proof_0.floating_hypotheses.size()
-                               + 1);
-                break; }
-            case proof_step::type_t::recall:
-                output_stream
-                        << encode_compressed_number(
-                               step.index_0
-                               + assertion_0.floating_hypotheses.size()
-                               + assertion_0.essential_hypotheses.size()
-                               + proof_0.floating_hypotheses.size()
-                               + referred_assertions.size()
-                               + 1);
-                break;
-            case proof_step::type_t::unknown:
-                output_stream << '?';
-                break;
-            }
-        }
+                const trace_span chunk_span("format_chunk");
+                /* runs also in worker threads */
+                const allocation_phase_scope phase(allocation_phase::write);
+                compressed_proof_writer proof_writer(database);
+                for (index i = begin; i < end; ++i)
+                    write_scope_group(
+                                database,
+                                groups[i],
+                                proof_writer,
+                                output);
+            };
+
+    if (options.threads_count == 1 || groups_count < 2)
+    {
+        format_groups(0, groups_count, chunks.front());
+        return chunks;
     }
 
-    output_stream << " $.\n";
-    output_stream << "$}\n";
+    thread_pool pool(options.threads_count);
+    const index group_chunks_count =
+            std::min<index>(groups_count, pool.get_threads_count() * 8);
+    chunks.resize(group_chunks_count + 1);
+    parallel_for(
+                pool,
+                group_chunks_count,
+                [&] (const index chunk)
+                {
+                    format_groups(
+                                groups_count * chunk / group_chunks_count,
+                                groups_count * (chunk + 1)
+                                    / group_chunks_count,
+                                chunks[chunk + 1]);
+                });
+    return chunks;
 }
 /*----------------------------------------------------------------------------*/
 } /* anonymous namespace */
 /*----------------------------------------------------------------------------*/
 void read_database_from_file(
         metamath_database &database,
-        std::istream &input_stream)
+        std::istream &input_stream,
+        const read_options &options)
 {
     tokenizer input_tokenizer(input_stream);
-    read_database_from_file(database, input_tokenizer);
+    read_database_from_file(database, input_tokenizer, options);
 }
 /*----------------------------------------------------------------------------*/
 void write_database_to_file(
         const metamath_database &database,
-        std::ostream &output_stream)
+        std::ostream &output_stream,
+        const write_options &options)
 {
-    write_symbols_to_file(database, output_stream);
-
-    const auto assertions_range =
-            boost::make_iterator_range(
-                database.assertions_begin(),
-                database.assertions_end());
-    for (const auto assertion_index : assertions_range)
+    const trace_span span("write_database");
+    const allocation_phase_scope phase(allocation_phase::write);
+    for (const auto &chunk : format_database(database, options))
+        output_stream.write(chunk.data(), chunk.size());
+}
+/*----------------------------------------------------------------------------*/
+void write_database_to_file(
+        const metamath_database &database,
+        const int file_descriptor,
+        const write_options &options)
+{
+    const trace_span span("write_database");
+    const allocation_phase_scope phase(allocation_phase::write);
+    const std::vector<std::string> chunks = format_database(database, options);
+
+    std::vector<iovec> buffers;
+    for (const auto &chunk : chunks)
+        if (!chunk.empty())
+            buffers.push_back(
+                        iovec{
+                            const_cast<char *>(chunk.data()),
+                            chunk.size()});
+
+    auto next = buffers.begin();
+    while (next != buffers.end())
     {
-        const auto &assertion_0 = database.get_assertion(assertion_index);
-        write_assertion(database, assertion_0, output_stream);
+        const int count =
+                std::min<std::ptrdiff_t>(IOV_MAX, buffers.end() - next);
+        const ssize_t written = ::writev(file_descriptor, &*next, count);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw std::runtime_error(
+                    std::string("writing database failed: ")
+                    + std::strerror(errno));
+        }
+
+        /* skip completely written buffers, adjust partially written one */
+        std::size_t remaining = written;
+        while (next != buffers.end() && remaining >= next->iov_len)
+        {
+            remaining -= next->iov_len;
+            ++next;
+        }
+        if (remaining != 0)
+        {
+            next->iov_base = static_cast<char *>(next->iov_base) + remaining;
+            next->iov_len -= remaining;
+        }
     }
 }
 /*----------------------------------------------------------------------------*/
@@ -26,13 +26,44 @@
 
 namespace metamath_playground {
 
+struct read_options
+{
+    /* Keep legacy frames of assertions in the database after reading. They
+     * are needed to write proofs in the order of the source file. */
+    bool retain_legacy_frames = false;
+    /* Keep byte ranges of assertions in the source, needed together with
+     * legacy frames by write_database_delta. */
+    bool retain_source_locations = false;
+};
+
 void read_database_from_file(
         metamath_database &db,
-        std::istream &input_stream);
+        std::istream &input_stream,
+        const read_options &options = read_options());
+
+struct write_options
+{
+    /* Assertions are formatted in parallel. 0 means one thread per hardware
+     * thread. The output does not depend on the number of threads. */
+    unsigned threads_count = 0;
+    /* Consecutive assertions sharing hypotheses and disjoint variable
+     * restrictions are written in a common scope. Reading the output back
+     * gives an equivalent database, but labels of shared hypotheses are taken
+     * from the first assertion of the scope. */
+    bool regroup_scopes = false;
+};
+
+void write_database_to_file(
+        const metamath_database &db,
+        std::ostream &output_stream,
+        const write_options &options = write_options());
 
+/* Writes the whole database with a few large writev calls. Throws
+ * std::runtime_error on failure. */
 void write_database_to_file(
         const metamath_database &db,
-        std::ostream &output_stream);
+        int file_descriptor,
+        const write_options &options = write_options());
 
 } /* namespace metamath_playground */
 
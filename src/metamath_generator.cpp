@@ -0,0 +1,106 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "database_generator.h"
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+int main(const int argc, const char *const *const argv) try
+{
+    using namespace metamath_playground;
+
+    const std::string usage =
+            "usage: metamath_generator [options] output.mm\n"
+            "options: --constants n, --variables n, --axioms n,\n"
+            "         --syntax-theorems n, --theorems n, --scopes n,\n"
+            "         --scope-depth n, --proof-depth n, --wff-depth n,\n"
+            "         --compressed-ratio x, --backreference-density x,\n"
+            "         --disjoint-variables-ratio x,\n"
+            "         --dummy-variables-ratio x, --late-floating-ratio x,\n"
+            "         --seed n, --scale factor";
+
+    generator_options options;
+    metamath_playground::index scale = 1;
+    std::string output_name;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        if (argument.substr(0, 2) != "--")
+        {
+            if (!output_name.empty())
+                throw std::runtime_error(usage);
+            output_name = argument;
+            continue;
+        }
+        if (i + 1 >= argc)
+            throw std::runtime_error(usage);
+        const std::string value = argv[++i];
+        if (argument == "--constants")
+            options.constants_count = std::stoll(value);
+        else if (argument == "--variables")
+            options.variables_count = std::stoll(value);
+        else if (argument == "--axioms")
+            options.axioms_count = std::stoll(value);
+        else if (argument == "--syntax-theorems")
+            options.syntax_theorems_count = std::stoll(value);
+        else if (argument == "--theorems")
+            options.theorems_count = std::stoll(value);
+        else if (argument == "--scopes")
+            options.scopes_count = std::stoll(value);
+        else if (argument == "--scope-depth")
+            options.scope_depth = std::stoll(value);
+        else if (argument == "--proof-depth")
+            options.proof_depth = std::stoll(value);
+        else if (argument == "--wff-depth")
+            options.wff_depth = std::stoll(value);
+        else if (argument == "--compressed-ratio")
+            options.compressed_ratio = std::stod(value);
+        else if (argument == "--backreference-density")
+            options.backreference_density = std::stod(value);
+        else if (argument == "--disjoint-variables-ratio")
+            options.disjoint_variables_ratio = std::stod(value);
+        else if (argument == "--dummy-variables-ratio")
+            options.dummy_variables_ratio = std::stod(value);
+        else if (argument == "--late-floating-ratio")
+            options.late_floating_ratio = std::stod(value);
+        else if (argument == "--seed")
+            options.seed = std::stoul(value);
+        else if (argument == "--scale")
+            scale = std::stoll(value);
+        else
+            throw std::runtime_error(usage);
+    }
+    if (output_name.empty())
+        throw std::runtime_error(usage);
+    options.scale(scale);
+
+    std::ofstream output_stream(output_name, std::ios::binary);
+    if (!output_stream)
+        throw std::runtime_error("cannot open " + output_name);
+    generate_database(options, output_stream);
+    return 0;
+}
+catch (const std::exception &error)
+{
+    std::cerr << "std::exception caught: " << error.what() << std::endl;
+    return 1;
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "metamath_database_read_write.h"
+#include "proof_verifier.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/resource.h>
+
+/* Performance regression gate: measures reading, verifying and writing of a
+ * reference database and compares the results with a baseline. Times are
+ * divided by the time of a calibration loop of the same run and memory by
+ * the size of the input, so that the baseline does not depend on the
+ * machine. Returns 1 if any measurement exceeds its baseline by more than
+ * the tolerance.
+ *
+ * The reference database perf_reference.mm was generated by
+ *   metamath_generator --seed 2026 --theorems 400 --syntax-theorems 40
+ *       --scopes 8 --disjoint-variables-ratio 0.3
+ *       --dummy-variables-ratio 0.2 --late-floating-ratio 0.5
+ * and is checked in, so that changes of the generator do not move the
+ * baseline. */
+
+namespace {
+
+using namespace metamath_playground;
+/* hides index() from <strings.h> */
+using metamath_playground::index;
+
+using measurements = std::map<std::string, double>;
+
+double get_peak_rss_kilobytes()
+{
+    rusage usage;
+    if (::getrusage(RUSAGE_SELF, &usage) != 0)
+        throw std::runtime_error("getrusage failed");
+    /* kilobytes on Linux */
+    return static_cast<double>(usage.ru_maxrss);
+}
+
+/* Fixed work of the kind the measured code does: hashing short strings and
+ * sorting indices. */
+void run_calibration()
+{
+    const index count = 100000;
+    std::mt19937 random(2026);
+    std::unordered_map<std::string, index> labels;
+    std::vector<index> values(count);
+    for (index i = 0; i < count; ++i)
+    {
+        values[i] = random();
+        labels.emplace("label" + std::to_string(values[i]), i);
+    }
+    std::sort(values.begin(), values.end());
+    index found = 0;
+    for (const index value : values)
+        found += labels.count("label" + std::to_string(value));
+    if (found != count)
+        throw std::runtime_error("calibration failed");
+}
+
+double measure_seconds(const std::function<void()> &run)
+{
+    const auto begin = std::chrono::steady_clock::now();
+    run();
+    return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - begin).count();
+}
+
+/* Each run is timed right after the calibration loop, so that both see the
+ * same state of the machine. Returns the median ratio of the runs. */
+double measure_ratio(
+        const index runs_count,
+        const std::function<void()> &run)
+{
+    std::vector<double> ratios;
+    for (index i = 0; i < runs_count; ++i)
+    {
+        const double calibration_seconds = measure_seconds(run_calibration);
+        ratios.push_back(measure_seconds(run) / calibration_seconds);
+    }
+    const auto middle = ratios.begin() + ratios.size() / 2;
+    std::nth_element(ratios.begin(), middle, ratios.end());
+    return *middle;
+}
+
+std::string read_input(const std::string &file_name)
+{
+    std::ifstream input_stream(file_name, std::ios::binary);
+    if (!input_stream)
+        throw std::runtime_error("cannot open " + file_name);
+    return std::string(
+                std::istreambuf_iterator<char>(input_stream),
+                std::istreambuf_iterator<char>());
+}
+
+measurements measure(const std::string &input, const index runs_count)
+{
+    run_calibration();
+    const double initial_rss_kilobytes = get_peak_rss_kilobytes();
+
+    measurements result;
+    const auto read =
+            [&] (metamath_database &database)
+            {
+                std::istringstream stream(input);
+                read_database_from_file(database, stream);
+            };
+    result["read_ratio"] =
+            measure_ratio(
+                runs_count,
+                [&]
+                {
+                    metamath_database database;
+                    read(database);
+                });
+
+    metamath_database database;
+    read(database);
+    result["verify_ratio"] =
+            measure_ratio(
+                runs_count,
+                [&]
+                {
+                    for (
+                            auto i = database.assertions_begin();
+                            i != database.assertions_end();
+                            ++i)
+                        verify_proof(database, database.get_assertion(*i));
+                });
+    result["write_ratio"] =
+            measure_ratio(
+                runs_count,
+                [&]
+                {
+                    std::ostringstream output_stream;
+                    write_database_to_file(database, output_stream);
+                });
+    /* peak memory added by the measurements per kilobyte of input */
+    result["memory_ratio"] =
+            (get_peak_rss_kilobytes() - initial_rss_kilobytes)
+            / (static_cast<double>(input.size()) / 1024.0);
+    return result;
+}
+
+measurements read_baseline(const std::string &file_name)
+{
+    std::ifstream input_stream(file_name);
+    if (!input_stream)
+        throw std::runtime_error("cannot open baseline " + file_name);
+    measurements result;
+    std::string line;
+    while (std::getline(input_stream, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+        std::istringstream line_stream(line);
+        std::string name;
+        double value;
+        if (!(line_stream >> name >> value))
+            throw std::runtime_error("invalid baseline line: " + line);
+        result[name] = value;
+    }
+    return result;
+}
+
+void write_baseline(const std::string &file_name, const measurements &values)
+{
+    std::ofstream output_stream(file_name);
+    output_stream
+            << "# Baseline of metamath_perf_gate, regenerate with "
+            "metamath_perf_gate --update\n";
+    for (const auto &entry : values)
+        output_stream << entry.first << ' ' << entry.second << '\n';
+}
+
+} /* anonymous namespace */
+
+int main(const int argc, const char *const *const argv) try
+{
+    const std::string usage =
+            "usage: metamath_perf_gate --input reference.mm "
+            "--baseline baseline.txt\n"
+            "       [--tolerance fraction] [--runs count] [--update]";
+    std::string input_name;
+    std::string baseline_name;
+    double tolerance = 0.5;
+    index runs_count = 10;
+    bool update = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        if (argument == "--input" && i + 1 < argc)
+            input_name = argv[++i];
+        else if (argument == "--baseline" && i + 1 < argc)
+            baseline_name = argv[++i];
+        else if (argument == "--tolerance" && i + 1 < argc)
+            tolerance = std::stod(argv[++i]);
+        else if (argument == "--runs" && i + 1 < argc)
+            runs_count = std::max<index>(1, std::stoll(argv[++i]));
+        else if (argument == "--update")
+            update = true;
+        else
+            throw std::runtime_error(usage);
+    }
+    if (input_name.empty() || baseline_name.empty())
+        throw std::runtime_error(usage);
+
+    const measurements current = measure(read_input(input_name), runs_count);
+    if (update)
+    {
+        write_baseline(baseline_name, current);
+        return 0;
+    }
+
+    const measurements baseline = read_baseline(baseline_name);
+    bool failed = false;
+    for (const auto &entry : current)
+    {
+        const auto found = baseline.find(entry.first);
+        if (found == baseline.end())
+            throw std::runtime_error("no baseline of " + entry.first);
+        const double limit = found->second * (1.0 + tolerance);
+        const bool regressed = entry.second > limit;
+        failed = failed || regressed;
+        std::cout
+                << entry.first << ": " << entry.second
+                << " (baseline " << found->second << ", limit " << limit
+                << ")" << (regressed ? " REGRESSION" : "") << '\n';
+    }
+    return failed ? 1 : 0;
+}
+catch (const std::exception &error)
+{
+    std::cerr << "std::exception caught: " << error.what() << std::endl;
+    return 1;
+}
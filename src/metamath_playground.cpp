@@ -1,8 +1,8 @@
 /*
- * Copyright 2017 Dominik Wójt
+ * Copyright 2026 Dominik Wójt
  *
  * This file is part of metamath_playground.
-
+ *
  * SPDX-License-Identifier: MIT OR Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,32 +17,812 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "allocation_tracker.h"
+#include "common_subproofs.h"
+#include "database_snapshot.h"
+#include "delta_writer.h"
+#include "expression_parser.h"
 #include "metamath_database_read_write.h"
+#include "proof_minimizer.h"
+#include "proof_search.h"
+#include "proof_verifier.h"
+#include "query_server.h"
+#include "span_tracer.h"
+#include "thread_pool.h"
+#include "unification_index.h"
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
-int main(const int argc, const char *const *const argv) try
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+using namespace metamath_playground;
+/* hides index() from <strings.h> */
+using metamath_playground::index;
+
+const std::string usage =
+        "usage: metamath_playground [options] command input.mm "
+        "[arguments]\n"
+        "       metamath_playground [options] input.mm output.mm\n"
+        "                     same as convert, the original invocation\n"
+        "commands:\n"
+        "  stats\n"
+        "  verify [label...]\n"
+        "  convert output.mm [--regroup-scopes]\n"
+        "  query label...\n"
+        "  common-subproofs\n"
+        "  parse [label...]   parses all statements with the grammar of\n"
+        "                     syntax axioms, prints trees of the labels\n"
+        "  candidates label...\n"
+        "                     lists assertions whose statements may unify\n"
+        "                     with statements of the labels\n"
+        "  prove output.mm [--depth n] [--time s] [--memory mb] [label...]\n"
+        "                     searches proofs of unknown steps of the\n"
+        "                     labels, or of all theorems with such steps\n"
+        "  minimize output.mm [label...]\n"
+        "                     shortens proofs of the labels, or of all\n"
+        "                     theorems, with earlier assertions\n"
+        "  serve socket       answers find, statement, users and verify\n"
+        "                     requests on a Unix socket until \"stop\"\n"
+        "  batch script.txt   runs commands from lines of the script, or of\n"
+        "                     the standard input for \"-\", on a single load\n"
+        "options:\n"
+        "  --threads n        0 (default) means one per hardware thread\n"
+        "  --profile          print times, allocations and memory usage\n"
+        "  --snapshot file    load the database from a binary snapshot,\n"
+        "                     written there if missing or stale\n"
+        "  --trace file       write Chrome trace of the run\n"
+        "  --delta            write output files by replacing only modified\n"
+        "                     proofs in the input, then read them back and\n"
+        "                     verify those proofs; disables --snapshot";
+
+struct playground_options
+{
+    unsigned threads_count = 0;
+    bool profile = false;
+    std::string snapshot_name;
+    std::string trace_name;
+    bool delta = false;
+    std::string input_name;
+};
+
+/* Measures wall time of the scope, printed if profiling is on. */
+class profile_timer
+{
+private:
+    const playground_options &options;
+    std::string name;
+    std::chrono::steady_clock::time_point begin;
+
+public:
+    profile_timer(const playground_options &options_in, std::string name_in):
+        options(options_in),
+        name(std::move(name_in)),
+        begin(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~profile_timer()
+    {
+        if (!options.profile)
+            return;
+        const double seconds =
+                std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - begin).count();
+        std::cerr << name << ": " << seconds << " s\n";
+    }
+};
+
+std::string get_source_stamp(const std::string &file_name)
+{
+    struct stat status;
+    if (::stat(file_name.c_str(), &status) != 0)
+        throw std::runtime_error("cannot access " + file_name);
+    return
+            file_name + ' ' + std::to_string(status.st_size) + ' '
+            + std::to_string(status.st_mtim.tv_sec) + '.'
+            + std::to_string(status.st_mtim.tv_nsec);
+}
+
+void load_database(
+        metamath_database &database,
+        const std::string &input_name,
+        const playground_options &options)
+{
+    const profile_timer timer(options, "load");
+    std::string source_stamp;
+    /* snapshots do not keep what the delta writer needs */
+    if (!options.snapshot_name.empty() && !options.delta)
+    {
+        source_stamp = get_source_stamp(input_name);
+        std::ifstream snapshot_stream(
+                    options.snapshot_name,
+                    std::ios::binary);
+        if (
+                snapshot_stream
+                && read_database_snapshot(
+                    database,
+                    source_stamp,
+                    snapshot_stream))
+            return;
+    }
+
+    std::ifstream input_stream(input_name);
+    if (!input_stream)
+        throw std::runtime_error("cannot open " + input_name);
+    read_options read_options_0;
+    read_options_0.retain_legacy_frames = options.delta;
+    read_options_0.retain_source_locations = options.delta;
+    read_database_from_file(database, input_stream, read_options_0);
+
+    if (!options.snapshot_name.empty() && !options.delta)
+    {
+        std::ofstream snapshot_stream(
+                    options.snapshot_name,
+                    std::ios::binary);
+        write_database_snapshot(database, source_stamp, snapshot_stream);
+    }
+}
+
+/* The delta output splices new proofs into the text of the input, so it is
+ * read back and the modified proofs are verified there. */
+void check_delta_output(
+        const metamath_database &database,
+        const std::string &output_name)
+{
+    std::ifstream input_stream(output_name);
+    if (!input_stream)
+        throw std::runtime_error("cannot open " + output_name);
+    metamath_database written;
+    read_database_from_file(written, input_stream);
+    for (
+            auto i = database.assertions_begin();
+            i != database.assertions_end();
+            ++i)
+    {
+        if (!database.is_modified(*i))
+            continue;
+        const std::string &label = database.get_assertion(*i).label;
+        const assertion_index found = written.find_assertion(label);
+        if (!written.is_valid(found))
+            throw std::runtime_error(label + " missing in " + output_name);
+        verify_proof(written, written.get_assertion(found));
+    }
+}
+
+/* Writes the database with a few large writev calls, or with --delta only
+ * the modified proofs. */
+void write_output(
+        const metamath_database &database,
+        const playground_options &options,
+        const std::string &output_name,
+        const write_options &write_options_0)
+{
+    const int file_descriptor =
+            ::open(
+                output_name.c_str(),
+                O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                0666);
+    if (file_descriptor == -1)
+        throw std::runtime_error("cannot open " + output_name);
+    int source_file_descriptor = -1;
+    try
+    {
+        if (options.delta)
+        {
+            source_file_descriptor =
+                    ::open(options.input_name.c_str(), O_RDONLY | O_CLOEXEC);
+            if (source_file_descriptor == -1)
+                throw std::runtime_error("cannot open " + options.input_name);
+            write_database_delta(
+                        database,
+                        source_file_descriptor,
+                        file_descriptor);
+            ::close(source_file_descriptor);
+        }
+        else
+            write_database_to_file(
+                        database,
+                        file_descriptor,
+                        write_options_0);
+    }
+    catch (...)
+    {
+        if (source_file_descriptor != -1)
+            ::close(source_file_descriptor);
+        ::close(file_descriptor);
+        throw;
+    }
+    if (::close(file_descriptor) != 0)
+        throw std::runtime_error("cannot write " + output_name);
+    if (options.delta)
+        check_delta_output(database, output_name);
+}
+
+bool run_stats(const metamath_database &database, std::ostream &output)
+{
+    index axioms_count = 0;
+    index theorems_count = 0;
+    index steps_count = 0;
+    index incomplete_count = 0;
+    for (
+            auto i = database.assertions_begin();
+            i != database.assertions_end();
+            ++i)
+    {
+        const assertion &assertion_0 = database.get_assertion(*i);
+        if (assertion_0.type == assertion::type_t::axiom)
+        {
+            ++axioms_count;
+            continue;
+        }
+        ++theorems_count;
+        const auto &steps = assertion_0.proof_0.steps;
+        steps_count += steps.size();
+        for (const auto &step : steps)
+            if (step.type == proof_step::type_t::unknown)
+            {
+                ++incomplete_count;
+                break;
+            }
+    }
+
+    output
+            << "constants: " << (*database.constants_end()).second << '\n'
+            << "variables: " << (*database.variables_end()).second << '\n'
+            << "axioms: " << axioms_count << '\n'
+            << "theorems: " << theorems_count << '\n'
+            << "incomplete proofs: " << incomplete_count << '\n'
+            << "proof steps: " << steps_count << '\n'
+            << "memory usage: " << database.memory_usage().get_total()
+            << " bytes\n";
+    return true;
+}
+
+bool run_verify(
+        const metamath_database &database,
+        const playground_options &options,
+        const std::vector<std::string> &labels,
+        std::ostream &output)
+{
+    std::vector<assertion_index> assertions;
+    if (labels.empty())
+    {
+        for (
+                auto i = database.assertions_begin();
+                i != database.assertions_end();
+                ++i)
+            assertions.push_back(*i);
+    }
+    for (const auto &label : labels)
+    {
+        const assertion_index found = database.find_assertion(label);
+        if (!database.is_valid(found))
+            throw std::runtime_error("unknown assertion " + label);
+        assertions.push_back(found);
+    }
+
+    /* errors are reported in the order of assertions */
+    std::vector<std::string> errors(assertions.size());
+    thread_pool pool(options.threads_count);
+    parallel_for(
+                pool,
+                assertions.size(),
+                [&] (const index i)
+                {
+                    try
+                    {
+                        verify_proof(
+                                    database,
+                                    database.get_assertion(assertions[i]));
+                    }
+                    catch (const std::runtime_error &error)
+                    {
+                        errors[i] = error.what();
+                    }
+                });
+
+    index failed_count = 0;
+    for (std::size_t i = 0; i < assertions.size(); ++i)
+    {
+        if (errors[i].empty())
+            continue;
+        ++failed_count;
+        output
+                << database.get_assertion(assertions[i]).label << ": "
+                << errors[i] << '\n';
+    }
+    output
+            << "verified " << assertions.size() << " assertions, "
+            << failed_count << " failed\n";
+    return failed_count == 0;
+}
+
+bool run_convert(
+        const metamath_database &database,
+        const playground_options &options,
+        const std::vector<std::string> &arguments)
 {
-    if (argc != 3)
-        throw std::runtime_error(
-                "usage: metamath_playgroud input.mm output.mm");
+    write_options write_options_0;
+    write_options_0.threads_count = options.threads_count;
+    std::string output_name;
+    for (const auto &argument : arguments)
+    {
+        if (argument == "--regroup-scopes")
+            write_options_0.regroup_scopes = true;
+        else if (output_name.empty())
+            output_name = argument;
+        else
+            throw std::runtime_error(usage);
+    }
+    if (output_name.empty())
+        throw std::runtime_error(usage);
+
+    write_output(database, options, output_name, write_options_0);
+    return true;
+}
 
-    using namespace metamath_playground;
+bool run_query(
+        const metamath_database &database,
+        const std::vector<std::string> &labels,
+        std::ostream &output)
+{
+    if (labels.empty())
+        throw std::runtime_error(usage);
+    bool result = true;
+    for (const auto &label : labels)
+    {
+        const assertion_index found = database.find_assertion(label);
+        if (!database.is_valid(found))
+        {
+            output << label << ": not found\n";
+            result = false;
+            continue;
+        }
+        const assertion &assertion_0 = database.get_assertion(found);
+        write_assertion_statement(database, assertion_0, output, "  ");
+        if (assertion_0.type == assertion::type_t::theorem)
+            output
+                    << "  proof steps: " << assertion_0.proof_0.steps.size()
+                    << '\n';
+    }
+    return result;
+}
+
+bool run_common_subproofs(
+        const metamath_database &database,
+        const playground_options &options,
+        std::ostream &output)
+{
+    common_subproofs_options subproofs_options;
+    subproofs_options.threads_count = options.threads_count;
+    const auto subproofs = find_common_subproofs(database, subproofs_options);
+    write_common_subproofs_report(database, subproofs, output);
+    return true;
+}
+
+/* Writes the tree as nested applications of syntax axioms. */
+void write_parse_tree(
+        const metamath_database &database,
+        const std::span<const parse_node> tree,
+        std::ostream &output)
+{
+    std::vector<std::string> stack;
+    for (const auto &node : tree)
+    {
+        if (node.type == parse_node::type_t::variable)
+        {
+            const symbol_index variable(
+                        symbol::type_t::variable,
+                        node.index_0);
+            stack.push_back(database.get_symbol_label(variable));
+            continue;
+        }
+        const assertion &axiom =
+                database.get_assertion(assertion_index(node.index_0));
+        const index children_count = axiom.floating_hypotheses.size();
+        std::string text = axiom.label;
+        if (children_count > 0)
+        {
+            text += '(';
+            const index stack_size = stack.size();
+            for (index i = stack_size - children_count; i < stack_size; ++i)
+            {
+                if (text.back() != '(')
+                    text += ", ";
+                text += stack[i];
+            }
+            text += ')';
+            stack.resize(stack.size() - children_count);
+        }
+        stack.push_back(std::move(text));
+    }
+    output << (stack.empty() ? "does not parse" : stack.back()) << '\n';
+}
+
+bool run_parse(
+        metamath_database &database,
+        const playground_options &options,
+        const std::vector<std::string> &labels,
+        std::ostream &output)
+{
+    const parse_tree_cache &trees =
+            get_parse_trees(database, options.threads_count);
+    output
+            << "parsed " << trees.size() << " assertions, "
+            << trees.memory_usage() << " bytes\n";
+    const auto &errors = trees.get_errors();
+    for (const auto &error : errors)
+        output << error << '\n';
+    bool result = errors.empty();
+    for (const auto &label : labels)
+    {
+        const assertion_index found = database.find_assertion(label);
+        if (!database.is_valid(found))
+        {
+            output << label << ": not found\n";
+            result = false;
+            continue;
+        }
+        const assertion &assertion_0 = database.get_assertion(found);
+        const auto &hypotheses = assertion_0.essential_hypotheses;
+        for (std::size_t i = 0; i < hypotheses.size(); ++i)
+        {
+            output << hypotheses[i].label << ": ";
+            write_parse_tree(
+                        database,
+                        trees.get_hypothesis_tree(found, i),
+                        output);
+        }
+        output << label << ": ";
+        write_parse_tree(database, trees.get_expression_tree(found), output);
+    }
+    return result;
+}
+
+bool run_candidates(
+        metamath_database &database,
+        const playground_options &options,
+        const std::vector<std::string> &labels,
+        std::ostream &output)
+{
+    if (labels.empty())
+        throw std::runtime_error(usage);
+    if (database.get_unification_index() == nullptr)
+        database.set_unification_index(
+                    std::make_shared<unification_index>(
+                        database,
+                        options.threads_count));
+    const unification_index &index_0 = *database.get_unification_index();
+
+    const index shown_count = 10;
+    bool result = true;
+    for (const auto &label : labels)
+    {
+        const assertion_index found = database.find_assertion(label);
+        if (!database.is_valid(found))
+        {
+            output << label << ": not found\n";
+            result = false;
+            continue;
+        }
+        const assertion &assertion_0 = database.get_assertion(found);
+        const auto begin = std::chrono::steady_clock::now();
+        const std::vector<assertion_index> candidates =
+                index_0.find_candidates(
+                    assertion_0.expression_0,
+                    assertion_0.floating_hypotheses,
+                    {});
+        const double microseconds =
+                std::chrono::duration<double, std::micro>(
+                    std::chrono::steady_clock::now() - begin).count();
+        output
+                << label << ": " << candidates.size() << " candidates in "
+                << microseconds << " us:";
+        const index candidates_count = candidates.size();
+        for (index i = 0; i < candidates_count && i < shown_count; ++i)
+            output << ' ' << database.get_assertion(candidates[i]).label;
+        if (candidates_count > shown_count)
+            output << " ...";
+        output << '\n';
+    }
+    return result;
+}
+
+bool run_prove(
+        metamath_database &database,
+        const playground_options &options,
+        const std::vector<std::string> &arguments,
+        std::ostream &output)
+{
+    proof_search_options search_options;
+    search_options.threads_count = options.threads_count;
+    std::string output_name;
+    std::vector<assertion_index> theorems;
+    for (std::size_t i = 0; i < arguments.size(); ++i)
+    {
+        const std::string &argument = arguments[i];
+        const bool has_value = i + 1 < arguments.size();
+        if (argument == "--depth" && has_value)
+            search_options.max_depth = std::stol(arguments[++i]);
+        else if (argument == "--time" && has_value)
+            search_options.time_limit_seconds = std::stod(arguments[++i]);
+        else if (argument == "--memory" && has_value)
+            search_options.memory_limit_bytes =
+                    std::stoul(arguments[++i]) << 20;
+        else if (argument.substr(0, 2) == "--")
+            throw std::runtime_error(usage);
+        else if (output_name.empty())
+            output_name = argument;
+        else
+        {
+            const assertion_index found = database.find_assertion(argument);
+            if (!database.is_valid(found))
+                throw std::runtime_error("unknown assertion " + argument);
+            theorems.push_back(found);
+        }
+    }
+    if (output_name.empty())
+        throw std::runtime_error(usage);
+    if (database.get_unification_index() == nullptr)
+        database.set_unification_index(
+                    std::make_shared<unification_index>(
+                        database,
+                        options.threads_count));
+    if (theorems.empty())
+    {
+        for (
+                auto i = database.assertions_begin();
+                i != database.assertions_end();
+                ++i)
+        {
+            const auto &steps = database.get_assertion(*i).proof_0.steps;
+            if (
+                    std::any_of(
+                        steps.begin(),
+                        steps.end(),
+                        [] (const proof_step &step)
+                        {
+                            return step.type == proof_step::type_t::unknown;
+                        }))
+                theorems.push_back(*i);
+        }
+    }
+
+    bool result = true;
+    thread_pool pool(options.threads_count);
+    for (const auto theorem : theorems)
+    {
+        const proof_search_result found =
+                search_unknown_steps(database, theorem, pool, search_options);
+        output
+                << database.get_assertion(theorem).label << ": proved "
+                << found.proven_count << " of " << found.goals_count
+                << " unknown steps";
+        if (found.budget_exceeded)
+            output << ", budget exceeded";
+        output << '\n';
+        result = result && found.proven_count == found.goals_count;
+    }
+
+    write_options write_options_0;
+    write_options_0.threads_count = options.threads_count;
+    write_output(database, options, output_name, write_options_0);
+    return result;
+}
+
+bool run_minimize(
+        metamath_database &database,
+        const playground_options &options,
+        const std::vector<std::string> &arguments,
+        std::ostream &output)
+{
+    if (arguments.empty())
+        throw std::runtime_error(usage);
+    const std::string &output_name = arguments[0];
+    std::vector<assertion_index> theorems;
+    for (std::size_t i = 1; i < arguments.size(); ++i)
+    {
+        const assertion_index found = database.find_assertion(arguments[i]);
+        if (!database.is_valid(found))
+            throw std::runtime_error("unknown assertion " + arguments[i]);
+        theorems.push_back(found);
+    }
+
+    proof_minimizer_options minimizer_options;
+    minimizer_options.threads_count = options.threads_count;
+    const proof_minimizer_result result =
+            minimize_proofs(database, theorems, minimizer_options);
+    output
+            << "shortened " << result.shortened_count << " of "
+            << result.theorems_count << " proofs, "
+            << result.original_length << " -> " << result.minimized_length
+            << " steps\n";
+
+    write_options write_options_0;
+    write_options_0.threads_count = options.threads_count;
+    write_output(database, options, output_name, write_options_0);
+    return true;
+}
+
+bool run_command(
+        metamath_database &database,
+        const playground_options &options,
+        const std::string &command,
+        const std::vector<std::string> &arguments,
+        std::ostream &output);
+
+bool run_batch(
+        metamath_database &database,
+        const playground_options &options,
+        const std::string &script_name,
+        std::ostream &output)
+{
+    std::ifstream script_file;
+    if (script_name != "-")
+    {
+        script_file.open(script_name);
+        if (!script_file)
+            throw std::runtime_error("cannot open " + script_name);
+    }
+    std::istream &script = script_name == "-" ? std::cin : script_file;
+
+    bool result = true;
+    std::string line;
+    while (std::getline(script, line))
+    {
+        std::istringstream line_stream(line);
+        std::string command;
+        if (!(line_stream >> command) || command[0] == '#')
+            continue;
+        if (command == "batch")
+            throw std::runtime_error("nested batch is not supported");
+        std::vector<std::string> arguments;
+        for (std::string argument; line_stream >> argument;)
+            arguments.push_back(argument);
+
+        output << "> " << line << '\n';
+        result =
+                run_command(database, options, command, arguments, output)
+                && result;
+    }
+    return result;
+}
+
+bool run_command(
+        metamath_database &database,
+        const playground_options &options,
+        const std::string &command,
+        const std::vector<std::string> &arguments,
+        std::ostream &output)
+{
+    const profile_timer timer(options, command);
+    const trace_span span("command");
+    if (command == "stats" && arguments.empty())
+        return run_stats(database, output);
+    if (command == "verify")
+        return run_verify(database, options, arguments, output);
+    if (command == "convert")
+        return run_convert(database, options, arguments);
+    if (command == "query")
+        return run_query(database, arguments, output);
+    if (command == "common-subproofs" && arguments.empty())
+        return run_common_subproofs(database, options, output);
+    if (command == "parse")
+        return run_parse(database, options, arguments, output);
+    if (command == "candidates")
+        return run_candidates(database, options, arguments, output);
+    if (command == "prove")
+        return run_prove(database, options, arguments, output);
+    if (command == "minimize")
+        return run_minimize(database, options, arguments, output);
+    if (command == "serve" && arguments.size() == 1)
+    {
+        serve_queries(database, arguments[0], options.threads_count);
+        return true;
+    }
+    if (command == "batch" && arguments.size() == 1)
+        return run_batch(database, options, arguments[0], output);
+    throw std::runtime_error(usage);
+}
+
+void write_profile(const metamath_database &database)
+{
+    write_allocation_report(get_allocation_report(), std::cerr);
+    const database_memory_usage usage = database.memory_usage();
+    std::cerr
+            << "database memory usage:\n"
+            << "  symbols           " << usage.symbols << " bytes\n"
+            << "  assertions        " << usage.assertions << " bytes\n"
+            << "  expressions       " << usage.expressions << " bytes\n"
+            << "  proofs            " << usage.proofs << " bytes\n"
+            << "  label indices     " << usage.label_indices << " bytes\n"
+            << "  legacy frames     " << usage.legacy_frames << " bytes\n"
+            << "  source locations  " << usage.source_locations
+            << " bytes\n"
+            << "  parse trees       " << usage.parse_trees << " bytes\n"
+            << "  unification index " << usage.unification_index
+            << " bytes\n"
+            << "  total             " << usage.get_total() << " bytes\n";
+}
+
+} /* anonymous namespace */
+
+int main(const int argc, const char *const *const argv) try
+{
+    playground_options options;
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        /* options must precede the command */
+        if (!positional.empty())
+            positional.push_back(argument);
+        else if (argument == "--threads" && i + 1 < argc)
+            options.threads_count = std::stoul(argv[++i]);
+        else if (argument == "--profile")
+            options.profile = true;
+        else if (argument == "--snapshot" && i + 1 < argc)
+            options.snapshot_name = argv[++i];
+        else if (argument == "--trace" && i + 1 < argc)
+            options.trace_name = argv[++i];
+        else if (argument == "--delta")
+            options.delta = true;
+        else if (argument.substr(0, 2) == "--")
+            throw std::runtime_error(usage);
+        else
+            positional.push_back(argument);
+    }
+    const std::unordered_set<std::string> commands{
+        "stats", "verify", "convert", "query", "common-subproofs", "parse",
+        "candidates", "prove", "minimize", "serve", "batch"};
+    if (positional.size() == 2 && commands.count(positional[0]) == 0)
+        positional.insert(positional.begin(), "convert");
+    if (positional.size() < 2)
+        throw std::runtime_error(usage);
+    const std::string &command = positional[0];
+    const std::string &input_name = positional[1];
+    options.input_name = input_name;
+    const std::vector<std::string> arguments(
+                positional.begin() + 2,
+                positional.end());
 
-    std::ifstream input_stream(argv[1]);
-    std::ofstream output_stream(argv[2]);
+    if (!options.trace_name.empty())
+        enable_tracing();
+    if (options.profile)
+        enable_allocation_tracking();
 
     metamath_database database;
-    read_database_from_file(database, input_stream);
-    write_database_to_file(database, output_stream);
+    load_database(database, input_name, options);
+    const bool succeeded =
+            run_command(database, options, command, arguments, std::cout);
 
-    return 0;
+    if (options.profile)
+        write_profile(database);
+    if (!options.trace_name.empty())
+    {
+        std::ofstream trace_stream(options.trace_name);
+        write_chrome_trace(trace_stream);
+    }
+    return succeeded ? 0 : 1;
 }
 catch (const std::runtime_error &error)
 {
     std::cerr << "std::runtime_error caught: " << error.what() << std::endl;
+    return 1;
 }
 catch (...)
 {
     std::cerr << "unknown exception caught" << std::endl;
+    return 1;
 }
@@ -0,0 +1,7468 @@
+$( Synthetic database generated by metamath_generator $)
+  $c ( ) -> -. wff |- $.
+  $c c0 c1 c2 c3 c4 c5 c6 c7 c8 c9 $.
+  $v v0 v1 v2 v3 v4 v5 v6 v7 v8 v9 v10 $.
+  wv0 $f wff v0 $.
+  wv1 $f wff v1 $.
+  wv2 $f wff v2 $.
+  wv3 $f wff v3 $.
+  wv4 $f wff v4 $.
+  wv5 $f wff v5 $.
+  wv6 $f wff v6 $.
+  wv7 $f wff v7 $.
+  wv8 $f wff v8 $.
+  wv9 $f wff v9 $.
+  wc0 $a wff c0 $.
+  wc1 $a wff c1 $.
+  wc2 $a wff c2 $.
+  wc3 $a wff c3 $.
+  wc4 $a wff c4 $.
+  wc5 $a wff c5 $.
+  wc6 $a wff c6 $.
+  wc7 $a wff c7 $.
+  wc8 $a wff c8 $.
+  wc9 $a wff c9 $.
+  wi $a wff ( v0 -> v1 ) $.
+  wn $a wff -. v0 $.
+  ax-1 $a |- ( v0 -> ( v1 -> v0 ) ) $.
+  ax-2 $a |- ( ( v0 -> ( v1 -> v2 ) ) -> ( ( v0 -> v1 ) -> ( v0 -> v2 ) ) ) $.
+  ax-3 $a |- ( ( -. v0 -> -. v1 ) -> ( v1 -> v0 ) ) $.
+  ${
+    min $e |- v0 $.
+    maj $e |- ( v0 -> v1 ) $.
+    ax-mp $a |- v1 $.
+  $}
+  ax-g0 $a |- ( ( v9 -> v7 ) -> -. ( v3 -> v6 ) ) $.
+  ${
+    $d v0 v9 $.
+    ax-g1 $a |- ( -. ( v9 -> v0 ) -> v1 ) $.
+  $}
+  ax-g2 $a |- v8 $.
+  ${
+    $d v3 v7 $.
+    ax-g3 $a |- ( -. ( v6 -> v7 ) -> -. ( v5 -> v3 ) ) $.
+  $}
+  ax-g4 $a |- v9 $.
+  ax-g5 $a |- -. v9 $.
+  ax-g6 $a |- v2 $.
+  ax-g7 $a |- ( -. v3 -> -. ( v6 -> v6 ) ) $.
+  ax-g8 $a |- -. ( ( v0 -> v7 ) -> ( v2 -> v2 ) ) $.
+  ax-g9 $a |- ( -. ( v2 -> v3 ) -> ( -. v7 -> ( v6 -> v7 ) ) ) $.
+  th0 $p |- ( v3 -> ( ( ( c0 -> v9 ) -> ( c9 -> c8 ) ) -> -. ( v2 -> ( c9 -> c8 ) ) ) ) $=
+      wc0 wv9 wi wc9 wc8 wi wi wv2 wc9 wc8 wi wi wn wi wv3 wc0 wv9 wi wc9 wc8
+      wi wi wv2 wc9 wc8 wi wi wn wi wi wv2 wc9 wc8 wi wc9 wc8 wi wc0 wv9 wi
+      ax-g0 wc0 wv9 wi wc9 wc8 wi wi wv2 wc9 wc8 wi wi wn wi wv3 ax-1 ax-mp $.
+  th1 $p |- ( ( v2 -> -. ( v7 -> v9 ) ) -> ( v0 -> ( c0 -> ( ( v8 -> v7 ) -> ( v8 -> v7 ) ) ) ) ) $=
+      wv0 wc0 wv8 wv7 wi wv8 wv7 wi wi wi wi wv2 wv7 wv9 wi wn wi wv0 wc0 wv8
+      wv7 wi wv8 wv7 wi wi wi wi wi wc0 wv8 wv7 wi wv8 wv7 wi wi wi wv0 wc0 wv8
+      wv7 wi wv8 wv7 wi wi wi wi wv8 wv7 wi wv8 wv7 wi wi wc0 wv8 wv7 wi wv8
+      wv7 wi wi wi wv8 wv7 wi wv8 wv7 wi wv8 wv7 wi wi wv8 wv7 wi ax-g4 wv8 wv7
+      wi wv8 wv7 wi ax-1 ax-mp wv8 wv7 wi wv8 wv7 wi wi wc0 ax-1 ax-mp wc0 wv8
+      wv7 wi wv8 wv7 wi wi wi wv0 ax-1 ax-mp wv0 wc0 wv8 wv7 wi wv8 wv7 wi wi
+      wi wi wv2 wv7 wv9 wi wn wi ax-1 ax-mp $.
+  th2 $p |- ( ( ( ( v1 -> v0 ) -> v3 ) -> -. ( v9 -> v9 ) ) -> ( c9 -> ( v8 -> ( ( v6 -> -. ( v8 -> v8 ) ) -> ( v6 -> ( c0 -> ( ( v6 -> v8 ) -> ( v6 -> v8 ) ) ) ) ) ) ) ) $=
+      ( wv5 wi wn wc9 wc0 ax-1 th1 ax-mp ) GGGHHZBAHCHFFHIHZJEDEEHIHDKDEHDEHHHH
+      HZHZHZHZGGLTOTHSTRSQRDDEDEMQELNRJLNSPLNTOLNN $.
+  th3 $p |- ( ( v0 -> ( -. v0 -> ( v8 -> v0 ) ) ) -> ( -. v9 -> ( c1 -> ( -. c1 -> -. ( c1 -> c1 ) ) ) ) ) $=
+      wv9 wn wc1 wc1 wn wc1 wc1 wi wn wi wi wi wv0 wv0 wn wv8 wv0 wi wi wi wv9
+      wn wc1 wc1 wn wc1 wc1 wi wn wi wi wi wi wc1 wc1 wn wc1 wc1 wi wn wi wi
+      wv9 wn wc1 wc1 wn wc1 wc1 wi wn wi wi wi wc1 wn wc1 wc1 wi wn wi wc1 wc1
+      wn wc1 wc1 wi wn wi wi wc1 wc1 ax-g7 wc1 wn wc1 wc1 wi wn wi wc1 ax-1
+      ax-mp wc1 wc1 wn wc1 wc1 wi wn wi wi wv9 wn ax-1 ax-mp wv9 wn wc1 wc1 wn
+      wc1 wc1 wi wn wi wi wi wv0 wv0 wn wv8 wv0 wi wi wi ax-1 ax-mp $.
+  th4 $p |- ( -. ( ( v3 -> v1 ) -> ( v3 -> v7 ) ) -> ( v5 -> ( -. ( ( v3 -> v1 ) -> ( v3 -> v7 ) ) -> ( -. ( ( v3 -> v1 ) -> ( v3 -> v7 ) ) -> ( -. ( v4 -> v2 ) -> -. ( ( v4 -> v2 ) -> ( v4 -> v2 ) ) ) ) ) ) ) $=
+      wv8 wv8 wv8 wi wi wv3 wv1 wi wv3 wv7 wi wi wn wv5 wv3 wv1 wi wv3 wv7 wi
+      wi wn wv3 wv1 wi wv3 wv7 wi wi wn wv4 wv2 wi wn wv4 wv2 wi wv4 wv2 wi wi
+      wn wi wi wi wi wi wv8 wv8 ax-1 wv3 wv1 wi wv3 wv7 wi wi wn wv5 wv3 wv1 wi
+      wv3 wv7 wi wi wn wv3 wv1 wi wv3 wv7 wi wi wn wv4 wv2 wi wn wv4 wv2 wi wv4
+      wv2 wi wi wn wi wi wi wi wi wv8 wv8 wv8 wi wi wv3 wv1 wi wv3 wv7 wi wi wn
+      wv5 wv3 wv1 wi wv3 wv7 wi wi wn wv3 wv1 wi wv3 wv7 wi wi wn wv4 wv2 wi wn
+      wv4 wv2 wi wv4 wv2 wi wi wn wi wi wi wi wi wi wv5 wv3 wv1 wi wv3 wv7 wi
+      wi wn wv3 wv1 wi wv3 wv7 wi wi wn wv4 wv2 wi wn wv4 wv2 wi wv4 wv2 wi wi
+      wn wi wi wi wi wv3 wv1 wi wv3 wv7 wi wi wn wv5 wv3 wv1 wi wv3 wv7 wi wi
+      wn wv3 wv1 wi wv3 wv7 wi wi wn wv4 wv2 wi wn wv4 wv2 wi wv4 wv2 wi wi wn
+      wi wi wi wi wi wv3 wv1 wi wv3 wv7 wi wi wn wv3 wv1 wi wv3 wv7 wi wi wn
+      wv4 wv2 wi wn wv4 wv2 wi wv4 wv2 wi wi wn wi wi wi wv5 wv3 wv1 wi wv3 wv7
+      wi wi wn wv3 wv1 wi wv3 wv7 wi wi wn wv4 wv2 wi wn wv4 wv2 wi wv4 wv2 wi
+      wi wn wi wi wi wi wv3 wv1 wi wv3 wv7 wi wi wn wv4 wv2 wi wn wv4 wv2 wi
+      wv4 wv2 wi wi wn wi wi wv3 wv1 wi wv3 wv7 wi wi wn wv3 wv1 wi wv3 wv7 wi
+      wi wn wv4 wv2 wi wn wv4 wv2 wi wv4 wv2 wi wi wn wi wi wi wv4 wv2 wi wn
+      wv4 wv2 wi wv4 wv2 wi wi wn wi wv3 wv1 wi wv3 wv7 wi wi wn wv4 wv2 wi wn
+      wv4 wv2 wi wv4 wv2 wi wi wn wi wi wv4 wv2 wi wv4 wv2 wi ax-g7 wv4 wv2 wi
+      wn wv4 wv2 wi wv4 wv2 wi wi wn wi wv3 wv1 wi wv3 wv7 wi wi wn ax-1 ax-mp
+      wv3 wv1 wi wv3 wv7 wi wi wn wv4 wv2 wi wn wv4 wv2 wi wv4 wv2 wi wi wn wi
+      wi wv3 wv1 wi wv3 wv7 wi wi wn ax-1 ax-mp wv3 wv1 wi wv3 wv7 wi wi wn wv3
+      wv1 wi wv3 wv7 wi wi wn wv4 wv2 wi wn wv4 wv2 wi wv4 wv2 wi wi wn wi wi
+      wi wv5 ax-1 ax-mp wv5 wv3 wv1 wi wv3 wv7 wi wi wn wv3 wv1 wi wv3 wv7 wi
+      wi wn wv4 wv2 wi wn wv4 wv2 wi wv4 wv2 wi wi wn wi wi wi wi wv3 wv1 wi
+      wv3 wv7 wi wi wn ax-1 ax-mp wv3 wv1 wi wv3 wv7 wi wi wn wv5 wv3 wv1 wi
+      wv3 wv7 wi wi wn wv3 wv1 wi wv3 wv7 wi wi wn wv4 wv2 wi wn wv4 wv2 wi wv4
+      wv2 wi wi wn wi wi wi wi wi wv8 wv8 wv8 wi wi ax-1 ax-mp ax-mp $.
+  th5 $p |- ( -. ( ( v0 -> v7 ) -> ( c5 -> v1 ) ) -> ( ( v7 -> -. ( c4 -> v1 ) ) -> ( ( -. -. v0 -> v3 ) -> ( ( ( -. v6 -> c0 ) -> v5 ) -> ( ( ( v2 -> v7 ) -> c1 ) -> ( ( ( -. v6 -> c0 ) -> v5 ) -> ( ( ( -. v6 -> c0 ) -> v5 ) -> ( ( ( ( v3 -> v3 ) -> -. v6 ) -> ( v3 -> v0 ) ) -> ( ( ( v8 -> v0 ) -> ( v8 -> v0 ) ) -> -. ( ( v8 -> v3 ) -> c6 ) ) ) ) ) ) ) ) ) ) $=
+      wv7 wc4 wv1 wi wn wi wv0 wn wn wv3 wi wv6 wn wc0 wi wv5 wi wv2 wv7 wi wc1
+      wi wv6 wn wc0 wi wv5 wi wv6 wn wc0 wi wv5 wi wv3 wv3 wi wv6 wn wi wv3 wv0
+      wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi wi wi wi wi wi wi
+      wi wv0 wv7 wi wc5 wv1 wi wi wn wv7 wc4 wv1 wi wn wi wv0 wn wn wv3 wi wv6
+      wn wc0 wi wv5 wi wv2 wv7 wi wc1 wi wv6 wn wc0 wi wv5 wi wv6 wn wc0 wi wv5
+      wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi
+      wc6 wi wn wi wi wi wi wi wi wi wi wi wv0 wn wn wv3 wi wv6 wn wc0 wi wv5
+      wi wv2 wv7 wi wc1 wi wv6 wn wc0 wi wv5 wi wv6 wn wc0 wi wv5 wi wv3 wv3 wi
+      wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi
+      wi wi wi wi wi wi wv7 wc4 wv1 wi wn wi wv0 wn wn wv3 wi wv6 wn wc0 wi wv5
+      wi wv2 wv7 wi wc1 wi wv6 wn wc0 wi wv5 wi wv6 wn wc0 wi wv5 wi wv3 wv3 wi
+      wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi
+      wi wi wi wi wi wi wi wv6 wn wc0 wi wv5 wi wv2 wv7 wi wc1 wi wv6 wn wc0 wi
+      wv5 wi wv6 wn wc0 wi wv5 wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi
+      wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi wi wi wi wi wi wv0 wn wn wv3 wi wv6
+      wn wc0 wi wv5 wi wv2 wv7 wi wc1 wi wv6 wn wc0 wi wv5 wi wv6 wn wc0 wi wv5
+      wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi
+      wc6 wi wn wi wi wi wi wi wi wi wv2 wv7 wi wc1 wi wv6 wn wc0 wi wv5 wi wv6
+      wn wc0 wi wv5 wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi wv8 wv0 wi
+      wi wv8 wv3 wi wc6 wi wn wi wi wi wi wi wv6 wn wc0 wi wv5 wi wv2 wv7 wi
+      wc1 wi wv6 wn wc0 wi wv5 wi wv6 wn wc0 wi wv5 wi wv3 wv3 wi wv6 wn wi wv3
+      wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi wi wi wi wi wi
+      wv6 wn wc0 wi wv5 wi wv6 wn wc0 wi wv5 wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi
+      wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi wi wi wi wv2 wv7 wi
+      wc1 wi wv6 wn wc0 wi wv5 wi wv6 wn wc0 wi wv5 wi wv3 wv3 wi wv6 wn wi wv3
+      wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi wi wi wi wi
+      wv6 wn wc0 wi wv5 wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi wv8
+      wv0 wi wi wv8 wv3 wi wc6 wi wn wi wi wi wv6 wn wc0 wi wv5 wi wv6 wn wc0
+      wi wv5 wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8
+      wv3 wi wc6 wi wn wi wi wi wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi wi wv8 wv0
+      wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi wi wv6 wn wc0 wi wv5 wi wv3 wv3
+      wi wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn
+      wi wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi wv3 wv3 wi wv6
+      wn wi wv3 wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi wi
+      wv8 wv3 wi wc6 wv8 wv0 wi wv8 wv0 wi ax-g0 wv8 wv0 wi wv8 wv0 wi wi wv8
+      wv3 wi wc6 wi wn wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi wi ax-1 ax-mp wv3 wv3
+      wi wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn
+      wi wi wv6 wn wc0 wi wv5 wi ax-1 ax-mp wv6 wn wc0 wi wv5 wi wv3 wv3 wi wv6
+      wn wi wv3 wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi wi
+      wi wv6 wn wc0 wi wv5 wi ax-1 ax-mp wv6 wn wc0 wi wv5 wi wv6 wn wc0 wi wv5
+      wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi
+      wc6 wi wn wi wi wi wi wv2 wv7 wi wc1 wi ax-1 ax-mp wv2 wv7 wi wc1 wi wv6
+      wn wc0 wi wv5 wi wv6 wn wc0 wi wv5 wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi wi
+      wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi wi wi wi wi wv6 wn wc0
+      wi wv5 wi ax-1 ax-mp wv6 wn wc0 wi wv5 wi wv2 wv7 wi wc1 wi wv6 wn wc0 wi
+      wv5 wi wv6 wn wc0 wi wv5 wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi
+      wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi wi wi wi wi wi wv0 wn wn wv3 wi
+      ax-1 ax-mp wv0 wn wn wv3 wi wv6 wn wc0 wi wv5 wi wv2 wv7 wi wc1 wi wv6 wn
+      wc0 wi wv5 wi wv6 wn wc0 wi wv5 wi wv3 wv3 wi wv6 wn wi wv3 wv0 wi wi wv8
+      wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi wn wi wi wi wi wi wi wi wv7 wc4
+      wv1 wi wn wi ax-1 ax-mp wv7 wc4 wv1 wi wn wi wv0 wn wn wv3 wi wv6 wn wc0
+      wi wv5 wi wv2 wv7 wi wc1 wi wv6 wn wc0 wi wv5 wi wv6 wn wc0 wi wv5 wi wv3
+      wv3 wi wv6 wn wi wv3 wv0 wi wi wv8 wv0 wi wv8 wv0 wi wi wv8 wv3 wi wc6 wi
+      wn wi wi wi wi wi wi wi wi wv0 wv7 wi wc5 wv1 wi wi wn ax-1 ax-mp $.
+  th6 $p |- ( ( v5 -> v1 ) -> ( ( v4 -> v0 ) -> ( -. ( v4 -> v0 ) -> -. ( ( v4 -> v0 ) -> ( v4 -> v0 ) ) ) ) ) $=
+      ( wi wn ax-g7 ax-1 ax-mp ) CAEZJFJJEFEZEZDBEZLEKLJJGKJHILMHI $.
+  ${
+    sh0.0 $e |- ( -. v9 -> ( ( v3 -> v7 ) -> ( v4 -> c7 ) ) ) $.
+    sth0.0 $p |- ( ( -. c1 -> ( ( c2 -> v7 ) -> ( v2 -> c2 ) ) ) -> ( ( -. ( v7 -> v9 ) -> -. ( c2 -> v1 ) ) -> ( ( -. c1 -> ( ( c2 -> v7 ) -> ( v2 -> c2 ) ) ) -> ( -. v9 -> ( ( v3 -> v7 ) -> ( v4 -> c7 ) ) ) ) ) ) $=
+      ( wi wn wc2 wc1 wc7 ax-1 ax-mp ) EFHIJAHIHZKIJEHBJHHHZFICEHDLHHHZHZHZPSHR
+      SQRGQPMNROMNSPMN $.
+    ${
+      sh0.1 $e |- ( ( -. v6 -> c1 ) -> ( ( v5 -> v0 ) -> v9 ) ) $.
+      sth0.1 $p |- ( -. ( ( v8 -> c3 ) -> ( v6 -> v9 ) ) -> ( ( v7 -> -. ( c1 -> v4 ) ) -> ( ( -. v6 -> c1 ) -> ( ( v5 -> v0 ) -> v9 ) ) ) ) $=
+      wv7 wc1 wv4 wi wn wi wv6 wn wc1 wi wv5 wv0 wi wv9 wi wi wi wv8 wc3 wi wv6
+      wv9 wi wi wn wv7 wc1 wv4 wi wn wi wv6 wn wc1 wi wv5 wv0 wi wv9 wi wi wi
+      wi wv6 wn wc1 wi wv5 wv0 wi wv9 wi wi wv7 wc1 wv4 wi wn wi wv6 wn wc1 wi
+      wv5 wv0 wi wv9 wi wi wi sh0.1 wv6 wn wc1 wi wv5 wv0 wi wv9 wi wi wv7 wc1
+      wv4 wi wn wi ax-1 ax-mp wv7 wc1 wv4 wi wn wi wv6 wn wc1 wi wv5 wv0 wi wv9
+      wi wi wi wv8 wc3 wi wv6 wv9 wi wi wn ax-1 ax-mp $.
+      ${
+        sh0.2 $e |- -. v8 $.
+        sth0.2 $p |- ( v9 -> -. v8 ) $=
+      ( wn wi ax-1 ax-mp ) GLZHPMKPHNO $.
+      $}
+    $}
+  $}
+  ${
+    $d v2 v5 $.
+    th7 $p |- ( ( ( ( v4 -> v9 ) -> ( v6 -> c9 ) ) -> ( ( v5 -> v9 ) -> ( v3 -> c2 ) ) ) -> ( -. ( ( v7 -> v2 ) -> c9 ) -> ( -. ( ( v0 -> v0 ) -> ( c8 -> v2 ) ) -> -. ( ( v9 -> c4 ) -> ( c7 -> v5 ) ) ) ) ) $=
+      wv8 wv8 wv8 wi wi wv4 wv9 wi wv6 wc9 wi wi wv5 wv9 wi wv3 wc2 wi wi wi
+      wv7 wv2 wi wc9 wi wn wv0 wv0 wi wc8 wv2 wi wi wn wv9 wc4 wi wc7 wv5 wi wi
+      wn wi wi wi wv8 wv8 ax-1 wv4 wv9 wi wv6 wc9 wi wi wv5 wv9 wi wv3 wc2 wi
+      wi wi wv7 wv2 wi wc9 wi wn wv0 wv0 wi wc8 wv2 wi wi wn wv9 wc4 wi wc7 wv5
+      wi wi wn wi wi wi wv8 wv8 wv8 wi wi wv4 wv9 wi wv6 wc9 wi wi wv5 wv9 wi
+      wv3 wc2 wi wi wi wv7 wv2 wi wc9 wi wn wv0 wv0 wi wc8 wv2 wi wi wn wv9 wc4
+      wi wc7 wv5 wi wi wn wi wi wi wi wv7 wv2 wi wc9 wi wn wv0 wv0 wi wc8 wv2
+      wi wi wn wv9 wc4 wi wc7 wv5 wi wi wn wi wi wv4 wv9 wi wv6 wc9 wi wi wv5
+      wv9 wi wv3 wc2 wi wi wi wv7 wv2 wi wc9 wi wn wv0 wv0 wi wc8 wv2 wi wi wn
+      wv9 wc4 wi wc7 wv5 wi wi wn wi wi wi wv0 wv0 wi wc8 wv2 wi wi wn wv9 wc4
+      wi wc7 wv5 wi wi wn wi wv7 wv2 wi wc9 wi wn wv0 wv0 wi wc8 wv2 wi wi wn
+      wv9 wc4 wi wc7 wv5 wi wi wn wi wi wc7 wv5 wi wv9 wc4 wi wv0 wv0 wi wc8
+      wv2 wi ax-g3 wv0 wv0 wi wc8 wv2 wi wi wn wv9 wc4 wi wc7 wv5 wi wi wn wi
+      wv7 wv2 wi wc9 wi wn ax-1 ax-mp wv7 wv2 wi wc9 wi wn wv0 wv0 wi wc8 wv2
+      wi wi wn wv9 wc4 wi wc7 wv5 wi wi wn wi wi wv4 wv9 wi wv6 wc9 wi wi wv5
+      wv9 wi wv3 wc2 wi wi wi ax-1 ax-mp wv4 wv9 wi wv6 wc9 wi wi wv5 wv9 wi
+      wv3 wc2 wi wi wi wv7 wv2 wi wc9 wi wn wv0 wv0 wi wc8 wv2 wi wi wn wv9 wc4
+      wi wc7 wv5 wi wi wn wi wi wi wv8 wv8 wv8 wi wi ax-1 ax-mp ax-mp $.
+  $}
+  th8 $p |- ( -. -. ( c5 -> v3 ) -> ( ( ( ( c9 -> c2 ) -> ( v9 -> v2 ) ) -> -. ( v2 -> v3 ) ) -> ( ( v9 -> ( -. v1 -> v9 ) ) -> ( ( ( ( c9 -> c2 ) -> ( v9 -> v2 ) ) -> -. ( v2 -> v3 ) ) -> ( -. -. ( v5 -> v4 ) -> ( ( -. ( v8 -> v6 ) -> -. v6 ) -> ( v6 -> ( v8 -> v6 ) ) ) ) ) ) ) ) $=
+      wc9 wc2 wi wv9 wv2 wi wi wv2 wv3 wi wn wi wv9 wv1 wn wv9 wi wi wc9 wc2 wi
+      wv9 wv2 wi wi wv2 wv3 wi wn wi wv5 wv4 wi wn wn wv8 wv6 wi wn wv6 wn wi
+      wv6 wv8 wv6 wi wi wi wi wi wi wi wc5 wv3 wi wn wn wc9 wc2 wi wv9 wv2 wi
+      wi wv2 wv3 wi wn wi wv9 wv1 wn wv9 wi wi wc9 wc2 wi wv9 wv2 wi wi wv2 wv3
+      wi wn wi wv5 wv4 wi wn wn wv8 wv6 wi wn wv6 wn wi wv6 wv8 wv6 wi wi wi wi
+      wi wi wi wi wv9 wv1 wn wv9 wi wi wc9 wc2 wi wv9 wv2 wi wi wv2 wv3 wi wn
+      wi wv5 wv4 wi wn wn wv8 wv6 wi wn wv6 wn wi wv6 wv8 wv6 wi wi wi wi wi wi
+      wc9 wc2 wi wv9 wv2 wi wi wv2 wv3 wi wn wi wv9 wv1 wn wv9 wi wi wc9 wc2 wi
+      wv9 wv2 wi wi wv2 wv3 wi wn wi wv5 wv4 wi wn wn wv8 wv6 wi wn wv6 wn wi
+      wv6 wv8 wv6 wi wi wi wi wi wi wi wc9 wc2 wi wv9 wv2 wi wi wv2 wv3 wi wn
+      wi wv5 wv4 wi wn wn wv8 wv6 wi wn wv6 wn wi wv6 wv8 wv6 wi wi wi wi wi
+      wv9 wv1 wn wv9 wi wi wc9 wc2 wi wv9 wv2 wi wi wv2 wv3 wi wn wi wv5 wv4 wi
+      wn wn wv8 wv6 wi wn wv6 wn wi wv6 wv8 wv6 wi wi wi wi wi wi wv5 wv4 wi wn
+      wn wv8 wv6 wi wn wv6 wn wi wv6 wv8 wv6 wi wi wi wi wc9 wc2 wi wv9 wv2 wi
+      wi wv2 wv3 wi wn wi wv5 wv4 wi wn wn wv8 wv6 wi wn wv6 wn wi wv6 wv8 wv6
+      wi wi wi wi wi wv8 wv6 wi wn wv6 wn wi wv6 wv8 wv6 wi wi wi wv5 wv4 wi wn
+      wn wv8 wv6 wi wn wv6 wn wi wv6 wv8 wv6 wi wi wi wi wv8 wv6 wi wv6 ax-3
+      wv8 wv6 wi wn wv6 wn wi wv6 wv8 wv6 wi wi wi wv5 wv4 wi wn wn ax-1 ax-mp
+      wv5 wv4 wi wn wn wv8 wv6 wi wn wv6 wn wi wv6 wv8 wv6 wi wi wi wi wc9 wc2
+      wi wv9 wv2 wi wi wv2 wv3 wi wn wi ax-1 ax-mp wc9 wc2 wi wv9 wv2 wi wi wv2
+      wv3 wi wn wi wv5 wv4 wi wn wn wv8 wv6 wi wn wv6 wn wi wv6 wv8 wv6 wi wi
+      wi wi wi wv9 wv1 wn wv9 wi wi ax-1 ax-mp wv9 wv1 wn wv9 wi wi wc9 wc2 wi
+      wv9 wv2 wi wi wv2 wv3 wi wn wi wv5 wv4 wi wn wn wv8 wv6 wi wn wv6 wn wi
+      wv6 wv8 wv6 wi wi wi wi wi wi wc9 wc2 wi wv9 wv2 wi wi wv2 wv3 wi wn wi
+      ax-1 ax-mp wc9 wc2 wi wv9 wv2 wi wi wv2 wv3 wi wn wi wv9 wv1 wn wv9 wi wi
+      wc9 wc2 wi wv9 wv2 wi wi wv2 wv3 wi wn wi wv5 wv4 wi wn wn wv8 wv6 wi wn
+      wv6 wn wi wv6 wv8 wv6 wi wi wi wi wi wi wi wc5 wv3 wi wn wn ax-1 ax-mp $.
+  th9 $p |- ( ( v4 -> v1 ) -> ( v2 -> ( ( v9 -> c0 ) -> ( ( ( -. c4 -> -. v3 ) -> ( ( c0 -> v9 ) -> v6 ) ) -> ( ( -. ( v2 -> c9 ) -> ( -. c6 -> c7 ) ) -> ( -. -. ( v9 -> v7 ) -> -. ( ( ( v9 -> c0 ) -> ( c4 -> c7 ) ) -> ( ( v4 -> v1 ) -> ( v4 -> v1 ) ) ) ) ) ) ) ) ) $=
+      wv2 wv9 wc0 wi wc4 wn wv3 wn wi wc0 wv9 wi wv6 wi wi wv2 wc9 wi wn wc6 wn
+      wc7 wi wi wv9 wv7 wi wn wn wv9 wc0 wi wc4 wc7 wi wi wv4 wv1 wi wv4 wv1 wi
+      wi wi wn wi wi wi wi wi wv4 wv1 wi wv2 wv9 wc0 wi wc4 wn wv3 wn wi wc0
+      wv9 wi wv6 wi wi wv2 wc9 wi wn wc6 wn wc7 wi wi wv9 wv7 wi wn wn wv9 wc0
+      wi wc4 wc7 wi wi wv4 wv1 wi wv4 wv1 wi wi wi wn wi wi wi wi wi wi wv9 wc0
+      wi wc4 wn wv3 wn wi wc0 wv9 wi wv6 wi wi wv2 wc9 wi wn wc6 wn wc7 wi wi
+      wv9 wv7 wi wn wn wv9 wc0 wi wc4 wc7 wi wi wv4 wv1 wi wv4 wv1 wi wi wi wn
+      wi wi wi wi wv2 wv9 wc0 wi wc4 wn wv3 wn wi wc0 wv9 wi wv6 wi wi wv2 wc9
+      wi wn wc6 wn wc7 wi wi wv9 wv7 wi wn wn wv9 wc0 wi wc4 wc7 wi wi wv4 wv1
+      wi wv4 wv1 wi wi wi wn wi wi wi wi wi wc4 wn wv3 wn wi wc0 wv9 wi wv6 wi
+      wi wv2 wc9 wi wn wc6 wn wc7 wi wi wv9 wv7 wi wn wn wv9 wc0 wi wc4 wc7 wi
+      wi wv4 wv1 wi wv4 wv1 wi wi wi wn wi wi wi wv9 wc0 wi wc4 wn wv3 wn wi
+      wc0 wv9 wi wv6 wi wi wv2 wc9 wi wn wc6 wn wc7 wi wi wv9 wv7 wi wn wn wv9
+      wc0 wi wc4 wc7 wi wi wv4 wv1 wi wv4 wv1 wi wi wi wn wi wi wi wi wv2 wc9
+      wi wn wc6 wn wc7 wi wi wv9 wv7 wi wn wn wv9 wc0 wi wc4 wc7 wi wi wv4 wv1
+      wi wv4 wv1 wi wi wi wn wi wi wc4 wn wv3 wn wi wc0 wv9 wi wv6 wi wi wv2
+      wc9 wi wn wc6 wn wc7 wi wi wv9 wv7 wi wn wn wv9 wc0 wi wc4 wc7 wi wi wv4
+      wv1 wi wv4 wv1 wi wi wi wn wi wi wi wv9 wv7 wi wn wn wv9 wc0 wi wc4 wc7
+      wi wi wv4 wv1 wi wv4 wv1 wi wi wi wn wi wv2 wc9 wi wn wc6 wn wc7 wi wi
+      wv9 wv7 wi wn wn wv9 wc0 wi wc4 wc7 wi wi wv4 wv1 wi wv4 wv1 wi wi wi wn
+      wi wi wv9 wc0 wi wc4 wc7 wi wi wv4 wv1 wi wv4 wv1 wi wi wi wn wv9 wv7 wi
+      wn wn wv9 wc0 wi wc4 wc7 wi wi wv4 wv1 wi wv4 wv1 wi wi wi wn wi wv9 wc0
+      wi wv4 wv1 wi wc4 wc7 wi ax-g8 wv9 wc0 wi wc4 wc7 wi wi wv4 wv1 wi wv4
+      wv1 wi wi wi wn wv9 wv7 wi wn wn ax-1 ax-mp wv9 wv7 wi wn wn wv9 wc0 wi
+      wc4 wc7 wi wi wv4 wv1 wi wv4 wv1 wi wi wi wn wi wv2 wc9 wi wn wc6 wn wc7
+      wi wi ax-1 ax-mp wv2 wc9 wi wn wc6 wn wc7 wi wi wv9 wv7 wi wn wn wv9 wc0
+      wi wc4 wc7 wi wi wv4 wv1 wi wv4 wv1 wi wi wi wn wi wi wc4 wn wv3 wn wi
+      wc0 wv9 wi wv6 wi wi ax-1 ax-mp wc4 wn wv3 wn wi wc0 wv9 wi wv6 wi wi wv2
+      wc9 wi wn wc6 wn wc7 wi wi wv9 wv7 wi wn wn wv9 wc0 wi wc4 wc7 wi wi wv4
+      wv1 wi wv4 wv1 wi wi wi wn wi wi wi wv9 wc0 wi ax-1 ax-mp wv9 wc0 wi wc4
+      wn wv3 wn wi wc0 wv9 wi wv6 wi wi wv2 wc9 wi wn wc6 wn wc7 wi wi wv9 wv7
+      wi wn wn wv9 wc0 wi wc4 wc7 wi wi wv4 wv1 wi wv4 wv1 wi wi wi wn wi wi wi
+      wi wv2 ax-1 ax-mp wv2 wv9 wc0 wi wc4 wn wv3 wn wi wc0 wv9 wi wv6 wi wi
+      wv2 wc9 wi wn wc6 wn wc7 wi wi wv9 wv7 wi wn wn wv9 wc0 wi wc4 wc7 wi wi
+      wv4 wv1 wi wv4 wv1 wi wi wi wn wi wi wi wi wi wv4 wv1 wi ax-1 ax-mp $.
+  th10 $p |- ( ( ( ( v8 -> v0 ) -> ( v5 -> c9 ) ) -> v0 ) -> ( c5 -> ( ( ( v8 -> ( v7 -> c5 ) ) -> ( ( v9 -> v0 ) -> ( c4 -> v3 ) ) ) -> ( v0 -> ( ( c5 -> v6 ) -> ( ( -. ( c5 -> v6 ) -> -. -. v3 ) -> ( -. v3 -> ( c5 -> v6 ) ) ) ) ) ) ) ) $=
+      ( wc5 wi wc4 wn wc9 ax-3 ax-1 ax-mp ) HFEHIIGAIJBIIIZAHDIZQKBKZKIRQIIZIZI
+      ZIZIZFAICLIIAIZUCIUBUCUAUBTUASTQRMSQNOTANOUAPNOUBHNOUCUDNO $.
+  ${
+    $d v2 v5 $.
+    $d v3 v5 $.
+    th11 $p |- ( ( v5 -> ( ( c5 -> v2 ) -> ( c4 -> v6 ) ) ) -> ( v2 -> ( ( v5 -> ( ( c5 -> v2 ) -> ( c4 -> v6 ) ) ) -> ( v3 -> ( c9 -> ( ( ( ( v0 -> v3 ) -> ( v4 -> v9 ) ) -> ( -. c8 -> ( v4 -> c0 ) ) ) -> ( ( ( ( v1 -> c9 ) -> ( v8 -> v3 ) ) -> ( ( v6 -> v7 ) -> v7 ) ) -> ( -. c9 -> ( -. ( ( v2 -> v3 ) -> ( c9 -> v5 ) ) -> ( v2 -> v6 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc5 wi wc4 wc9 wc8 wn wc0 ax-g1 ax-1 ax-mp ) CFKCLMGLLLZDNADLEJLLOPEQLL
+      LZBNLIDLLGHLHLLZNPZCDLZNFLZLPCGLZLZLZLZLZLZLZLZLZUAUOLUNUOUMUNULUMUKULUJU
+      KUIUJUHUIUFUGUERUHUDSTUIUCSTUJUBSTUKNSTULDSTUMUASTUNCSTUOUAST $.
+  $}
+  th12 $p |- ( v3 -> ( ( ( ( v8 -> c9 ) -> ( c6 -> v6 ) ) -> ( ( v9 -> c8 ) -> v1 ) ) -> ( -. ( ( v5 -> c7 ) -> ( v5 -> c9 ) ) -> ( v0 -> ( -. ( ( v5 -> c7 ) -> ( v5 -> c9 ) ) -> ( -. ( ( v5 -> c7 ) -> ( v5 -> c9 ) ) -> ( -. ( c9 -> c3 ) -> -. ( ( c9 -> c3 ) -> ( c9 -> c3 ) ) ) ) ) ) ) ) ) $=
+      ( wc9 wi wc6 wc8 wc7 wn wc3 th4 ax-1 ax-mp ) FHIJEIIGKIBIIZDLIDHIIMADLIDH
+      IIMDLIDHIIMHNIMHNIHNIIMIIIIIZIZCTISTLNDHAHOSRPQTCPQ $.
+  th13 $p |- ( ( v3 -> v7 ) -> ( ( c9 -> c5 ) -> ( ( c9 -> c5 ) -> ( ( ( c5 -> ( v8 -> v6 ) ) -> ( v6 -> v9 ) ) -> ( v5 -> ( v3 -> v7 ) ) ) ) ) ) $=
+      wc9 wc5 wi wc9 wc5 wi wc5 wv8 wv6 wi wi wv6 wv9 wi wi wv5 wv3 wv7 wi wi
+      wi wi wi wv3 wv7 wi wc9 wc5 wi wc9 wc5 wi wc5 wv8 wv6 wi wi wv6 wv9 wi wi
+      wv5 wv3 wv7 wi wi wi wi wi wi wc9 wc5 wi wc5 wv8 wv6 wi wi wv6 wv9 wi wi
+      wv5 wv3 wv7 wi wi wi wi wc9 wc5 wi wc9 wc5 wi wc5 wv8 wv6 wi wi wv6 wv9
+      wi wi wv5 wv3 wv7 wi wi wi wi wi wc5 wv8 wv6 wi wi wv6 wv9 wi wi wv5 wv3
+      wv7 wi wi wi wc9 wc5 wi wc5 wv8 wv6 wi wi wv6 wv9 wi wi wv5 wv3 wv7 wi wi
+      wi wi wv5 wv3 wv7 wi wi wc5 wv8 wv6 wi wi wv6 wv9 wi wi wv5 wv3 wv7 wi wi
+      wi wv3 wv7 wi wv5 wv3 wv7 wi wi wv3 wv7 wi ax-g6 wv3 wv7 wi wv5 ax-1
+      ax-mp wv5 wv3 wv7 wi wi wc5 wv8 wv6 wi wi wv6 wv9 wi wi ax-1 ax-mp wc5
+      wv8 wv6 wi wi wv6 wv9 wi wi wv5 wv3 wv7 wi wi wi wc9 wc5 wi ax-1 ax-mp
+      wc9 wc5 wi wc5 wv8 wv6 wi wi wv6 wv9 wi wi wv5 wv3 wv7 wi wi wi wi wc9
+      wc5 wi ax-1 ax-mp wc9 wc5 wi wc9 wc5 wi wc5 wv8 wv6 wi wi wv6 wv9 wi wi
+      wv5 wv3 wv7 wi wi wi wi wi wv3 wv7 wi ax-1 ax-mp $.
+  th14 $p |- ( v8 -> ( c3 -> ( ( ( v2 -> ( v7 -> v0 ) ) -> v5 ) -> ( ( c4 -> v3 ) -> ( ( v2 -> v2 ) -> ( v2 -> ( ( v2 -> c0 ) -> ( ( ( -. c4 -> -. v2 ) -> ( ( c0 -> v2 ) -> v2 ) ) -> ( ( -. ( v2 -> c9 ) -> ( -. c6 -> c7 ) ) -> ( -. -. ( v2 -> v9 ) -> -. ( ( ( v2 -> c0 ) -> ( c4 -> c7 ) ) -> ( ( v2 -> v2 ) -> ( v2 -> v2 ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc3 wi wc4 wc0 wn wc9 wc6 wc7 th9 ax-1 ax-mp ) HBEAIIDIZJCIZBBIBBKIJLBL
+      IKBIBIIBMILNLOIIBGILLBKIJOIIBBIBBIIILIIIIIIZIZIZIZFUDIUCUDUBUCUAUBBBBBBGB
+      PUATQRUBSQRUCHQRUDFQR $.
+  th15 $p |- ( ( c9 -> v8 ) -> ( ( ( v5 -> c5 ) -> ( c9 -> v8 ) ) -> -. ( -. v9 -> ( c6 -> v5 ) ) ) ) $=
+      wv5 wc5 wi wc9 wv8 wi wi wv9 wn wc6 wv5 wi wi wn wi wc9 wv8 wi wv5 wc5 wi
+      wc9 wv8 wi wi wv9 wn wc6 wv5 wi wi wn wi wi wv9 wn wc6 wv5 wi wc9 wv8 wi
+      wv5 wc5 wi ax-g0 wv5 wc5 wi wc9 wv8 wi wi wv9 wn wc6 wv5 wi wi wn wi wc9
+      wv8 wi ax-1 ax-mp $.
+  th16 $p |- ( c0 -> ( c0 -> ( ( ( ( v9 -> c3 ) -> ( c0 -> c6 ) ) -> ( c9 -> c3 ) ) -> -. ( c5 -> v5 ) ) ) ) $=
+      ( wc0 wc3 wi wc6 wc9 wc5 wn ax-g5 ax-1 ax-mp ) CBDECFEEGDEEZHAEZIZEZEZCQE
+      PQOPNJOMKLPCKLQCKL $.
+  th17 $p |- ( v6 -> ( v1 -> ( -. v0 -> ( -. v9 -> ( -. ( v9 -> c5 ) -> -. ( ( v3 -> v3 ) -> v9 ) ) ) ) ) ) $=
+      ( wn wc5 wi ax-g3 ax-1 ax-mp ) BAFZEFZEGHFCCHZEHFHZHZHZHZDRHQRPQOPENEGIOM
+      JKPLJKQBJKRDJK $.
+  th18 $p |- ( ( ( ( v9 -> c4 ) -> ( v7 -> v0 ) ) -> ( ( v7 -> v9 ) -> ( v4 -> v3 ) ) ) -> ( -. ( -. v7 -> ( v6 -> v8 ) ) -> -. ( ( v2 -> c1 ) -> -. c7 ) ) ) $=
+      wv7 wn wv6 wv8 wi wi wn wv2 wc1 wi wc7 wn wi wn wi wv9 wc4 wi wv7 wv0 wi
+      wi wv7 wv9 wi wv4 wv3 wi wi wi wv7 wn wv6 wv8 wi wi wn wv2 wc1 wi wc7 wn
+      wi wn wi wi wc7 wn wv2 wc1 wi wv7 wn wv6 wv8 wi ax-g3 wv7 wn wv6 wv8 wi
+      wi wn wv2 wc1 wi wc7 wn wi wn wi wv9 wc4 wi wv7 wv0 wi wi wv7 wv9 wi wv4
+      wv3 wi wi wi ax-1 ax-mp $.
+  ${
+    sh1.0 $e |- ( ( ( v6 -> v4 ) -> ( c1 -> c1 ) ) -> ( ( v7 -> v0 ) -> ( v3 -> v3 ) ) ) $.
+    sth1.0 $p |- ( c0 -> ( v2 -> ( ( ( ( c4 -> v1 ) -> ( v7 -> c0 ) ) -> -. ( c3 -> v1 ) ) -> ( ( ( ( v2 -> v6 ) -> ( c1 -> c3 ) ) -> ( ( v0 -> v6 ) -> -. c3 ) ) -> ( ( ( ( v3 -> v4 ) -> -. c3 ) -> v2 ) -> ( ( -. ( v0 -> v4 ) -> ( ( c3 -> v2 ) -> ( v9 -> v4 ) ) ) -> ( ( ( v6 -> v4 ) -> ( c1 -> c1 ) ) -> ( ( v7 -> v0 ) -> ( v3 -> v3 ) ) ) ) ) ) ) ) ) $=
+      ( wv5 wi wc0 wc4 wc3 wn wc1 ax-1 ax-mp ) JJJKKZLCMBKGLKKNBKOKZCFKPNKKAFKN
+      OKKZDEKNOKCKZAEKONCKHEKKKZFEKPPKKGAKDDKKKZKZKZKZKZKZKZJJQUJSUJKUIUJUHUIUG
+      UHUFUGUEUFUDUEIUDUCQRUEUBQRUFUAQRUGTQRUHCQRUILQRUJSQRR $.
+    ${
+      sh1.1 $e |- ( -. ( v5 -> v7 ) -> ( v4 -> -. v2 ) ) $.
+      wl1.1 $f wff v10 $.
+      sth1.1 $p |- ( v10 -> ( ( ( ( v2 -> v0 ) -> ( c1 -> v9 ) ) -> ( v1 -> c9 ) ) -> ( ( v5 -> v3 ) -> ( v2 -> ( ( v5 -> v3 ) -> ( c7 -> ( -. ( v5 -> v7 ) -> ( v4 -> -. v2 ) ) ) ) ) ) ) ) $=
+      wv2 wv0 wi wc1 wv9 wi wi wv1 wc9 wi wi wv5 wv3 wi wv2 wv5 wv3 wi wc7 wv5
+      wv7 wi wn wv4 wv2 wn wi wi wi wi wi wi wi wl1.1 wv2 wv0 wi wc1 wv9 wi wi
+      wv1 wc9 wi wi wv5 wv3 wi wv2 wv5 wv3 wi wc7 wv5 wv7 wi wn wv4 wv2 wn wi
+      wi wi wi wi wi wi wi wv5 wv3 wi wv2 wv5 wv3 wi wc7 wv5 wv7 wi wn wv4 wv2
+      wn wi wi wi wi wi wi wv2 wv0 wi wc1 wv9 wi wi wv1 wc9 wi wi wv5 wv3 wi
+      wv2 wv5 wv3 wi wc7 wv5 wv7 wi wn wv4 wv2 wn wi wi wi wi wi wi wi wv2 wv5
+      wv3 wi wc7 wv5 wv7 wi wn wv4 wv2 wn wi wi wi wi wi wv5 wv3 wi wv2 wv5 wv3
+      wi wc7 wv5 wv7 wi wn wv4 wv2 wn wi wi wi wi wi wi wv5 wv3 wi wc7 wv5 wv7
+      wi wn wv4 wv2 wn wi wi wi wi wv2 wv5 wv3 wi wc7 wv5 wv7 wi wn wv4 wv2 wn
+      wi wi wi wi wi wc7 wv5 wv7 wi wn wv4 wv2 wn wi wi wi wv5 wv3 wi wc7 wv5
+      wv7 wi wn wv4 wv2 wn wi wi wi wi wv5 wv7 wi wn wv4 wv2 wn wi wi wc7 wv5
+      wv7 wi wn wv4 wv2 wn wi wi wi sh1.1 wv5 wv7 wi wn wv4 wv2 wn wi wi wc7
+      ax-1 ax-mp wc7 wv5 wv7 wi wn wv4 wv2 wn wi wi wi wv5 wv3 wi ax-1 ax-mp
+      wv5 wv3 wi wc7 wv5 wv7 wi wn wv4 wv2 wn wi wi wi wi wv2 ax-1 ax-mp wv2
+      wv5 wv3 wi wc7 wv5 wv7 wi wn wv4 wv2 wn wi wi wi wi wi wv5 wv3 wi ax-1
+      ax-mp wv5 wv3 wi wv2 wv5 wv3 wi wc7 wv5 wv7 wi wn wv4 wv2 wn wi wi wi wi
+      wi wi wv2 wv0 wi wc1 wv9 wi wi wv1 wc9 wi wi ax-1 ax-mp wv2 wv0 wi wc1
+      wv9 wi wi wv1 wc9 wi wi wv5 wv3 wi wv2 wv5 wv3 wi wc7 wv5 wv7 wi wn wv4
+      wv2 wn wi wi wi wi wi wi wi wl1.1 ax-1 ax-mp $.
+      ${
+        sh1.2 $e |- c8 $.
+        sth1.2 $p |- ( ( ( c5 -> v5 ) -> ( ( c7 -> v4 ) -> -. c1 ) ) -> ( ( ( v3 -> -. v4 ) -> -. -. v6 ) -> ( v3 -> ( ( ( v3 -> -. v4 ) -> -. -. v6 ) -> c8 ) ) ) ) $=
+      wv3 wv4 wn wi wv6 wn wn wi wv3 wv3 wv4 wn wi wv6 wn wn wi wc8 wi wi wi
+      wc5 wv5 wi wc7 wv4 wi wc1 wn wi wi wv3 wv4 wn wi wv6 wn wn wi wv3 wv3 wv4
+      wn wi wv6 wn wn wi wc8 wi wi wi wi wv3 wv3 wv4 wn wi wv6 wn wn wi wc8 wi
+      wi wv3 wv4 wn wi wv6 wn wn wi wv3 wv3 wv4 wn wi wv6 wn wn wi wc8 wi wi wi
+      wv3 wv4 wn wi wv6 wn wn wi wc8 wi wv3 wv3 wv4 wn wi wv6 wn wn wi wc8 wi
+      wi wc8 wv3 wv4 wn wi wv6 wn wn wi wc8 wi sh1.2 wc8 wv3 wv4 wn wi wv6 wn
+      wn wi ax-1 ax-mp wv3 wv4 wn wi wv6 wn wn wi wc8 wi wv3 ax-1 ax-mp wv3 wv3
+      wv4 wn wi wv6 wn wn wi wc8 wi wi wv3 wv4 wn wi wv6 wn wn wi ax-1 ax-mp
+      wv3 wv4 wn wi wv6 wn wn wi wv3 wv3 wv4 wn wi wv6 wn wn wi wc8 wi wi wi
+      wc5 wv5 wi wc7 wv4 wi wc1 wn wi wi ax-1 ax-mp $.
+      $}
+    $}
+  $}
+  th19 $p |- ( v7 -> ( v8 -> ( v7 -> ( v9 -> ( c0 -> ( v0 -> ( v7 -> ( ( v8 -> ( v8 -> c0 ) ) -> ( ( v8 -> v8 ) -> ( v8 -> c0 ) ) ) ) ) ) ) ) ) ) $=
+      wv8 wv7 wv9 wc0 wv0 wv7 wv8 wv8 wc0 wi wi wv8 wv8 wi wv8 wc0 wi wi wi wi
+      wi wi wi wi wi wv7 wv8 wv7 wv9 wc0 wv0 wv7 wv8 wv8 wc0 wi wi wv8 wv8 wi
+      wv8 wc0 wi wi wi wi wi wi wi wi wi wi wv7 wv9 wc0 wv0 wv7 wv8 wv8 wc0 wi
+      wi wv8 wv8 wi wv8 wc0 wi wi wi wi wi wi wi wi wv8 wv7 wv9 wc0 wv0 wv7 wv8
+      wv8 wc0 wi wi wv8 wv8 wi wv8 wc0 wi wi wi wi wi wi wi wi wi wv9 wc0 wv0
+      wv7 wv8 wv8 wc0 wi wi wv8 wv8 wi wv8 wc0 wi wi wi wi wi wi wi wv7 wv9 wc0
+      wv0 wv7 wv8 wv8 wc0 wi wi wv8 wv8 wi wv8 wc0 wi wi wi wi wi wi wi wi wc0
+      wv0 wv7 wv8 wv8 wc0 wi wi wv8 wv8 wi wv8 wc0 wi wi wi wi wi wi wv9 wc0
+      wv0 wv7 wv8 wv8 wc0 wi wi wv8 wv8 wi wv8 wc0 wi wi wi wi wi wi wi wv0 wv7
+      wv8 wv8 wc0 wi wi wv8 wv8 wi wv8 wc0 wi wi wi wi wi wc0 wv0 wv7 wv8 wv8
+      wc0 wi wi wv8 wv8 wi wv8 wc0 wi wi wi wi wi wi wv7 wv8 wv8 wc0 wi wi wv8
+      wv8 wi wv8 wc0 wi wi wi wi wv0 wv7 wv8 wv8 wc0 wi wi wv8 wv8 wi wv8 wc0
+      wi wi wi wi wi wv8 wv8 wc0 wi wi wv8 wv8 wi wv8 wc0 wi wi wi wv7 wv8 wv8
+      wc0 wi wi wv8 wv8 wi wv8 wc0 wi wi wi wi wv8 wv8 wc0 ax-2 wv8 wv8 wc0 wi
+      wi wv8 wv8 wi wv8 wc0 wi wi wi wv7 ax-1 ax-mp wv7 wv8 wv8 wc0 wi wi wv8
+      wv8 wi wv8 wc0 wi wi wi wi wv0 ax-1 ax-mp wv0 wv7 wv8 wv8 wc0 wi wi wv8
+      wv8 wi wv8 wc0 wi wi wi wi wi wc0 ax-1 ax-mp wc0 wv0 wv7 wv8 wv8 wc0 wi
+      wi wv8 wv8 wi wv8 wc0 wi wi wi wi wi wi wv9 ax-1 ax-mp wv9 wc0 wv0 wv7
+      wv8 wv8 wc0 wi wi wv8 wv8 wi wv8 wc0 wi wi wi wi wi wi wi wv7 ax-1 ax-mp
+      wv7 wv9 wc0 wv0 wv7 wv8 wv8 wc0 wi wi wv8 wv8 wi wv8 wc0 wi wi wi wi wi
+      wi wi wi wv8 ax-1 ax-mp wv8 wv7 wv9 wc0 wv0 wv7 wv8 wv8 wc0 wi wi wv8 wv8
+      wi wv8 wc0 wi wi wi wi wi wi wi wi wi wv7 ax-1 ax-mp $.
+  th20 $p |- ( v1 -> ( ( ( ( v8 -> v7 ) -> ( v4 -> c9 ) ) -> c7 ) -> ( ( ( ( v5 -> v0 ) -> c8 ) -> ( ( v8 -> v4 ) -> -. v9 ) ) -> ( c7 -> ( c6 -> ( ( c1 -> ( ( c5 -> v1 ) -> ( c4 -> v2 ) ) ) -> ( v1 -> ( ( c1 -> ( ( c5 -> v1 ) -> ( c4 -> v2 ) ) ) -> ( c9 -> ( c9 -> ( ( ( ( v1 -> c9 ) -> ( v5 -> c5 ) ) -> ( -. c8 -> ( v5 -> c0 ) ) ) -> ( ( ( ( v5 -> c9 ) -> ( v1 -> c9 ) ) -> ( ( v2 -> v2 ) -> v2 ) ) -> ( -. c9 -> ( -. ( ( v1 -> c9 ) -> ( c9 -> c1 ) ) -> ( v1 -> v2 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv3 wv3 wv3 wi wi wv1 wv8 wv7 wi wv4 wc9 wi wi wc7 wi wv5 wv0 wi wc8 wi
+      wv8 wv4 wi wv9 wn wi wi wc7 wc6 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wv1 wc1
+      wc5 wv1 wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5 wc5 wi wi wc8 wn wv5
+      wc0 wi wi wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2 wi wi wc9 wn wv1 wc9
+      wi wc9 wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi
+      wv3 wv3 ax-1 wv1 wv8 wv7 wi wv4 wc9 wi wi wc7 wi wv5 wv0 wi wc8 wi wv8
+      wv4 wi wv9 wn wi wi wc7 wc6 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wv1 wc1 wc5
+      wv1 wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5 wc5 wi wi wc8 wn wv5 wc0
+      wi wi wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2 wi wi wc9 wn wv1 wc9 wi
+      wc9 wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv3
+      wv3 wv3 wi wi wv1 wv8 wv7 wi wv4 wc9 wi wi wc7 wi wv5 wv0 wi wc8 wi wv8
+      wv4 wi wv9 wn wi wi wc7 wc6 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wv1 wc1 wc5
+      wv1 wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5 wc5 wi wi wc8 wn wv5 wc0
+      wi wi wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2 wi wi wc9 wn wv1 wc9 wi
+      wc9 wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi
+      wv8 wv7 wi wv4 wc9 wi wi wc7 wi wv5 wv0 wi wc8 wi wv8 wv4 wi wv9 wn wi wi
+      wc7 wc6 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wv1 wc1 wc5 wv1 wi wc4 wv2 wi wi
+      wi wc9 wc9 wv1 wc9 wi wv5 wc5 wi wi wc8 wn wv5 wc0 wi wi wi wv5 wc9 wi
+      wv1 wc9 wi wi wv2 wv2 wi wv2 wi wi wc9 wn wv1 wc9 wi wc9 wc1 wi wi wn wv1
+      wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv1 wv8 wv7 wi wv4 wc9 wi
+      wi wc7 wi wv5 wv0 wi wc8 wi wv8 wv4 wi wv9 wn wi wi wc7 wc6 wc1 wc5 wv1
+      wi wc4 wv2 wi wi wi wv1 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9
+      wi wv5 wc5 wi wi wc8 wn wv5 wc0 wi wi wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2
+      wi wv2 wi wi wc9 wn wv1 wc9 wi wc9 wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi
+      wi wi wi wi wi wi wi wi wi wv5 wv0 wi wc8 wi wv8 wv4 wi wv9 wn wi wi wc7
+      wc6 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wv1 wc1 wc5 wv1 wi wc4 wv2 wi wi wi
+      wc9 wc9 wv1 wc9 wi wv5 wc5 wi wi wc8 wn wv5 wc0 wi wi wi wv5 wc9 wi wv1
+      wc9 wi wi wv2 wv2 wi wv2 wi wi wc9 wn wv1 wc9 wi wc9 wc1 wi wi wn wv1 wv2
+      wi wi wi wi wi wi wi wi wi wi wi wi wi wv8 wv7 wi wv4 wc9 wi wi wc7 wi
+      wv5 wv0 wi wc8 wi wv8 wv4 wi wv9 wn wi wi wc7 wc6 wc1 wc5 wv1 wi wc4 wv2
+      wi wi wi wv1 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5 wc5
+      wi wi wc8 wn wv5 wc0 wi wi wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2 wi
+      wi wc9 wn wv1 wc9 wi wc9 wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi wi
+      wi wi wi wi wi wc7 wc6 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wv1 wc1 wc5 wv1 wi
+      wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5 wc5 wi wi wc8 wn wv5 wc0 wi wi wi
+      wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2 wi wi wc9 wn wv1 wc9 wi wc9 wc1
+      wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wv5 wv0 wi wc8 wi
+      wv8 wv4 wi wv9 wn wi wi wc7 wc6 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wv1 wc1
+      wc5 wv1 wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5 wc5 wi wi wc8 wn wv5
+      wc0 wi wi wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2 wi wi wc9 wn wv1 wc9
+      wi wc9 wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi wc6
+      wc1 wc5 wv1 wi wc4 wv2 wi wi wi wv1 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wc9
+      wc9 wv1 wc9 wi wv5 wc5 wi wi wc8 wn wv5 wc0 wi wi wi wv5 wc9 wi wv1 wc9
+      wi wi wv2 wv2 wi wv2 wi wi wc9 wn wv1 wc9 wi wc9 wc1 wi wi wn wv1 wv2 wi
+      wi wi wi wi wi wi wi wi wi wi wc7 wc6 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wv1
+      wc1 wc5 wv1 wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5 wc5 wi wi wc8 wn
+      wv5 wc0 wi wi wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2 wi wi wc9 wn wv1
+      wc9 wi wc9 wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wc1
+      wc5 wv1 wi wc4 wv2 wi wi wi wv1 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wc9 wc9
+      wv1 wc9 wi wv5 wc5 wi wi wc8 wn wv5 wc0 wi wi wi wv5 wc9 wi wv1 wc9 wi wi
+      wv2 wv2 wi wv2 wi wi wc9 wn wv1 wc9 wi wc9 wc1 wi wi wn wv1 wv2 wi wi wi
+      wi wi wi wi wi wi wi wc6 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wv1 wc1 wc5 wv1
+      wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5 wc5 wi wi wc8 wn wv5 wc0 wi wi
+      wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2 wi wi wc9 wn wv1 wc9 wi wc9
+      wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi wi wi wi wv1 wv5 wv1 wc9 wv5
+      wc1 wv2 wv2 wv1 wc5 th11 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wv1 wc1 wc5 wv1
+      wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5 wc5 wi wi wc8 wn wv5 wc0 wi wi
+      wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2 wi wi wc9 wn wv1 wc9 wi wc9
+      wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi wi wi wc6 ax-1 ax-mp wc6 wc1
+      wc5 wv1 wi wc4 wv2 wi wi wi wv1 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wc9 wc9
+      wv1 wc9 wi wv5 wc5 wi wi wc8 wn wv5 wc0 wi wi wi wv5 wc9 wi wv1 wc9 wi wi
+      wv2 wv2 wi wv2 wi wi wc9 wn wv1 wc9 wi wc9 wc1 wi wi wn wv1 wv2 wi wi wi
+      wi wi wi wi wi wi wi wi wc7 ax-1 ax-mp wc7 wc6 wc1 wc5 wv1 wi wc4 wv2 wi
+      wi wi wv1 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5 wc5 wi
+      wi wc8 wn wv5 wc0 wi wi wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2 wi wi
+      wc9 wn wv1 wc9 wi wc9 wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi wi wi
+      wi wi wv5 wv0 wi wc8 wi wv8 wv4 wi wv9 wn wi wi ax-1 ax-mp wv5 wv0 wi wc8
+      wi wv8 wv4 wi wv9 wn wi wi wc7 wc6 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wv1
+      wc1 wc5 wv1 wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5 wc5 wi wi wc8 wn
+      wv5 wc0 wi wi wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2 wi wi wc9 wn wv1
+      wc9 wi wc9 wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi
+      wv8 wv7 wi wv4 wc9 wi wi wc7 wi ax-1 ax-mp wv8 wv7 wi wv4 wc9 wi wi wc7
+      wi wv5 wv0 wi wc8 wi wv8 wv4 wi wv9 wn wi wi wc7 wc6 wc1 wc5 wv1 wi wc4
+      wv2 wi wi wi wv1 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5
+      wc5 wi wi wc8 wn wv5 wc0 wi wi wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2
+      wi wi wc9 wn wv1 wc9 wi wc9 wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wv1 ax-1 ax-mp wv1 wv8 wv7 wi wv4 wc9 wi wi wc7 wi wv5
+      wv0 wi wc8 wi wv8 wv4 wi wv9 wn wi wi wc7 wc6 wc1 wc5 wv1 wi wc4 wv2 wi
+      wi wi wv1 wc1 wc5 wv1 wi wc4 wv2 wi wi wi wc9 wc9 wv1 wc9 wi wv5 wc5 wi
+      wi wc8 wn wv5 wc0 wi wi wi wv5 wc9 wi wv1 wc9 wi wi wv2 wv2 wi wv2 wi wi
+      wc9 wn wv1 wc9 wi wc9 wc1 wi wi wn wv1 wv2 wi wi wi wi wi wi wi wi wi wi
+      wi wi wi wi wi wv3 wv3 wv3 wi wi ax-1 ax-mp ax-mp $.
+  th21 $p |- ( c2 -> ( c0 -> ( ( v8 -> v0 ) -> ( ( ( ( v6 -> v4 ) -> ( c9 -> v4 ) ) -> ( ( v0 -> c7 ) -> ( v9 -> v9 ) ) ) -> ( v0 -> ( ( ( -. v1 -> ( v1 -> c1 ) ) -> v1 ) -> ( v4 -> v6 ) ) ) ) ) ) ) $=
+      ( wc0 wi wc9 wc7 wn wc1 wc2 ax-g2 ax-1 ax-mp ) GEAHZDCHICHHAJHFFHHHZABKBL
+      HHBHZCDHZHZHZHZHZHZMUEHUDUEUCUDUBUCUAUBTUADTDNDCOPTSOPUAAOPUBROPUCQOPUDGO
+      PUEMOP $.
+  ${
+    $d v0 v3 $.
+    th22 $p |- ( ( v1 -> -. v9 ) -> ( c6 -> ( ( v1 -> -. v9 ) -> ( v0 -> ( ( v1 -> -. v9 ) -> ( c6 -> ( -. ( v0 -> v0 ) -> -. ( v3 -> v3 ) ) ) ) ) ) ) ) $=
+      ( wc6 wn wi ax-g3 ax-1 ax-mp ) EBDFGZAKEAAGFCCGFGZGZGZGZGZGZKQGPQOPNOMNLM
+      CCAAHLEIJMKIJNAIJOKIJPEIJQKIJ $.
+  $}
+  th23 $p |- ( ( ( c4 -> ( v7 -> v3 ) ) -> ( -. c3 -> ( v7 -> c6 ) ) ) -> ( v3 -> ( ( v6 -> ( ( v1 -> v2 ) -> ( v3 -> c5 ) ) ) -> ( c8 -> ( ( ( v6 -> c1 ) -> ( ( c5 -> v6 ) -> v7 ) ) -> ( ( v4 -> v1 ) -> ( v6 -> ( v3 -> ( v6 -> ( v5 -> ( c0 -> ( v5 -> ( v6 -> ( ( v3 -> ( v3 -> c0 ) ) -> ( ( v3 -> v3 ) -> ( v3 -> c0 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wi wc5 wc8 wc1 wc0 wc4 wc3 wn wc6 th19 ax-1 ax-mp ) CFABHCIHHHZJFKHIFHG
+      HHZDAHZFCFELEFCCLHHCCHCLHHHHHHHHHHZHZHZHZHZHZMGCHHNOGPHHHZUHHUGUHUFUGUEUF
+      UDUEUCUDEFCEQUCUBRSUDUARSUEJRSUFTRSUGCRSUHUIRS $.
+  th24 $p |- ( v3 -> ( ( ( ( c7 -> v3 ) -> ( v4 -> v1 ) ) -> -. ( v1 -> v0 ) ) -> ( v0 -> ( ( ( ( c7 -> v3 ) -> ( v4 -> v1 ) ) -> -. ( v1 -> v0 ) ) -> ( v9 -> ( ( c7 -> -. ( c6 -> c8 ) ) -> ( c7 -> ( c0 -> ( ( v9 -> c6 ) -> ( v9 -> c6 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc7 wi wn wc6 wc8 wc0 th1 ax-1 ax-mp ) FCGDBGGBAGHGZAOEFIJGHGFKEIGEIGGG
+      GGZGZGZGZGZCTGSTRSQRPQFFIEJLPEMNQOMNRAMNSOMNTCMN $.
+  ${
+    sh2.0 $e |- ( ( ( v1 -> v7 ) -> ( v3 -> v0 ) ) -> c1 ) $.
+    wl2.0 $f wff v10 $.
+    sth2.0 $p |- ( v10 -> ( ( ( ( v9 -> c1 ) -> ( c8 -> v2 ) ) -> ( ( c6 -> c3 ) -> ( v1 -> v9 ) ) ) -> ( ( v6 -> ( v0 -> ( v0 -> c7 ) ) ) -> ( v8 -> ( c3 -> ( c3 -> ( ( ( v1 -> v7 ) -> ( v3 -> v0 ) ) -> c1 ) ) ) ) ) ) ) $=
+      wv9 wc1 wi wc8 wv2 wi wi wc6 wc3 wi wv1 wv9 wi wi wi wv6 wv0 wv0 wc7 wi
+      wi wi wv8 wc3 wc3 wv1 wv7 wi wv3 wv0 wi wi wc1 wi wi wi wi wi wi wl2.0
+      wv9 wc1 wi wc8 wv2 wi wi wc6 wc3 wi wv1 wv9 wi wi wi wv6 wv0 wv0 wc7 wi
+      wi wi wv8 wc3 wc3 wv1 wv7 wi wv3 wv0 wi wi wc1 wi wi wi wi wi wi wi wv6
+      wv0 wv0 wc7 wi wi wi wv8 wc3 wc3 wv1 wv7 wi wv3 wv0 wi wi wc1 wi wi wi wi
+      wi wv9 wc1 wi wc8 wv2 wi wi wc6 wc3 wi wv1 wv9 wi wi wi wv6 wv0 wv0 wc7
+      wi wi wi wv8 wc3 wc3 wv1 wv7 wi wv3 wv0 wi wi wc1 wi wi wi wi wi wi wv8
+      wc3 wc3 wv1 wv7 wi wv3 wv0 wi wi wc1 wi wi wi wi wv6 wv0 wv0 wc7 wi wi wi
+      wv8 wc3 wc3 wv1 wv7 wi wv3 wv0 wi wi wc1 wi wi wi wi wi wc3 wc3 wv1 wv7
+      wi wv3 wv0 wi wi wc1 wi wi wi wv8 wc3 wc3 wv1 wv7 wi wv3 wv0 wi wi wc1 wi
+      wi wi wi wc3 wv1 wv7 wi wv3 wv0 wi wi wc1 wi wi wc3 wc3 wv1 wv7 wi wv3
+      wv0 wi wi wc1 wi wi wi wv1 wv7 wi wv3 wv0 wi wi wc1 wi wc3 wv1 wv7 wi wv3
+      wv0 wi wi wc1 wi wi sh2.0 wv1 wv7 wi wv3 wv0 wi wi wc1 wi wc3 ax-1 ax-mp
+      wc3 wv1 wv7 wi wv3 wv0 wi wi wc1 wi wi wc3 ax-1 ax-mp wc3 wc3 wv1 wv7 wi
+      wv3 wv0 wi wi wc1 wi wi wi wv8 ax-1 ax-mp wv8 wc3 wc3 wv1 wv7 wi wv3 wv0
+      wi wi wc1 wi wi wi wi wv6 wv0 wv0 wc7 wi wi wi ax-1 ax-mp wv6 wv0 wv0 wc7
+      wi wi wi wv8 wc3 wc3 wv1 wv7 wi wv3 wv0 wi wi wc1 wi wi wi wi wi wv9 wc1
+      wi wc8 wv2 wi wi wc6 wc3 wi wv1 wv9 wi wi wi ax-1 ax-mp wv9 wc1 wi wc8
+      wv2 wi wi wc6 wc3 wi wv1 wv9 wi wi wi wv6 wv0 wv0 wc7 wi wi wi wv8 wc3
+      wc3 wv1 wv7 wi wv3 wv0 wi wi wc1 wi wi wi wi wi wi wl2.0 ax-1 ax-mp $.
+    ${
+      sh2.1 $e |- c1 $.
+      sth2.1 $p |- ( ( ( v7 -> ( v0 -> v3 ) ) -> ( ( v6 -> v4 ) -> ( c6 -> v3 ) ) ) -> ( v8 -> ( ( c6 -> ( ( c6 -> v0 ) -> ( v6 -> v8 ) ) ) -> ( -. ( v1 -> v3 ) -> ( ( ( ( c5 -> v8 ) -> ( v3 -> c0 ) ) -> ( ( c9 -> v1 ) -> ( v5 -> v1 ) ) ) -> ( ( ( ( v7 -> v4 ) -> v3 ) -> ( ( v0 -> v0 ) -> v8 ) ) -> ( ( ( c4 -> ( v8 -> v6 ) ) -> ( v5 -> ( v9 -> v8 ) ) ) -> ( ( ( ( v9 -> v7 ) -> -. v4 ) -> -. ( v2 -> v4 ) ) -> c1 ) ) ) ) ) ) ) ) $=
+      ( wc6 wi wn wc5 wc0 wc9 wc4 wc1 ax-1 ax-mp ) IMMANGINNNZBDNOZPINDQNNRBNFB
+      NNNZHENDNAANINNZSIGNNFJINNNZJHNEONCENONZTNZNZNZNZNZNZNZHADNNGENMDNNNZUONU
+      NUOUMUNULUMUKULUJUKUIUJTUILTUHUAUBUIUGUAUBUJUFUAUBUKUEUAUBULUDUAUBUMUCUAU
+      BUNIUAUBUOUPUAUB $.
+      ${
+        sh2.2 $e |- ( -. -. v7 -> ( ( v9 -> v1 ) -> -. v7 ) ) $.
+        sth2.2 $p |- ( ( ( ( v4 -> v2 ) -> ( c9 -> v8 ) ) -> c3 ) -> ( ( ( ( v4 -> v2 ) -> ( c9 -> v8 ) ) -> c3 ) -> ( -. -. v7 -> ( ( v9 -> v1 ) -> -. v7 ) ) ) ) $=
+      ( wv5 wi wc9 wc3 wn ax-1 ax-mp ) LLLMMZECMNGMMOMZTFPPHBMFPMMZMZMZLLQUCSUC
+      MUBUCUAUBKUATQRUBTQRUCSQRR $.
+      $}
+    $}
+  $}
+  th25 $p |- ( ( v2 -> ( ( c9 -> c6 ) -> v1 ) ) -> ( ( ( c4 -> c1 ) -> ( c9 -> ( c6 -> v8 ) ) ) -> ( ( ( ( c0 -> c6 ) -> ( c7 -> v4 ) ) -> ( ( v5 -> v4 ) -> ( v0 -> v8 ) ) ) -> ( ( ( ( v1 -> c2 ) -> -. v8 ) -> v0 ) -> ( ( ( c4 -> c1 ) -> ( c9 -> ( c6 -> v8 ) ) ) -> ( ( ( c4 -> c1 ) -> ( c9 -> ( c6 -> v8 ) ) ) -> ( -. ( v9 -> ( c7 -> c7 ) ) -> ( -. ( ( c4 -> v7 ) -> c1 ) -> ( c2 -> v1 ) ) ) ) ) ) ) ) ) $=
+      ( wv3 wi wc9 wc6 wc4 wc1 wc0 wc7 wc2 wn ax-1 ax-g6 ax-mp ) IIIJJZCKLJBJJZ
+      MNJKLGJJJZOLJPDJJEDJAGJJJZBQJGRJAJZUDUDHPPJJRZMFJNJRZQBJZJZJZJZJZJZJZJZJZ
+      IISUQUBUQJUPUQUOUPUNUOUMUNULUMUKULUJUKUIUJUITUIUHSUAUJUGSUAUKUDSUAULUDSUA
+      UMUFSUAUNUESUAUOUDSUAUPUCSUAUQUBSUAUA $.
+  th26 $p |- ( v2 -> ( ( v4 -> ( ( v3 -> c0 ) -> ( c0 -> v5 ) ) ) -> ( ( ( v6 -> ( v0 -> v3 ) ) -> ( ( v6 -> v9 ) -> c2 ) ) -> ( v2 -> ( -. ( ( v1 -> v0 ) -> ( v9 -> v0 ) ) -> ( -. ( ( v1 -> v0 ) -> ( v9 -> v0 ) ) -> ( ( v2 -> ( c1 -> ( v9 -> v0 ) ) ) -> -. ( ( ( v6 -> c3 ) -> v5 ) -> ( -. v6 -> -. v6 ) ) ) ) ) ) ) ) ) $=
+      ( wc0 wi wc2 wn wc1 wc3 ax-g8 ax-1 ax-mp ) EDIJIFJJJZGADJJGHJKJJZCBAJHAJJ
+      LZTCMHAJJJZGNJZFJGLZUCJJLZJZJZJZJZJZJZCUJJUIUJUHUIUGUHUFUGUEUFUDUEUBUCFOU
+      DUAPQUETPQUFTPQUGCPQUHSPQUIRPQUJCPQ $.
+  th27 $p |- ( v1 -> ( v7 -> ( v2 -> ( c2 -> ( v7 -> ( v1 -> ( -. ( v1 -> c8 ) -> v1 ) ) ) ) ) ) ) $=
+      ( wc2 wc8 wi wn ax-g1 ax-1 ax-mp ) CBDCAAEFGAFZFZFZFZFZFZAPFOPNOMNLMKLEAA
+      HKAIJLCIJMDIJNBIJOCIJPAIJ $.
+  wth0 $p wff v7 $=
+      ( ) A $.
+  th28 $p |- ( c9 -> ( ( v0 -> v0 ) -> ( v5 -> ( ( v5 -> c0 ) -> ( ( ( -. c4 -> -. v2 ) -> ( ( c0 -> v5 ) -> v6 ) ) -> ( ( -. ( v5 -> c9 ) -> ( -. c6 -> c7 ) ) -> ( -. -. ( v5 -> v0 ) -> -. ( ( ( v5 -> c0 ) -> ( c4 -> c7 ) ) -> ( ( v0 -> v0 ) -> ( v0 -> v0 ) ) ) ) ) ) ) ) ) ) $=
+      wv0 wv0 wi wv5 wv5 wc0 wi wc4 wn wv2 wn wi wc0 wv5 wi wv6 wi wi wv5 wc9
+      wi wn wc6 wn wc7 wi wi wv5 wv0 wi wn wn wv5 wc0 wi wc4 wc7 wi wi wv0 wv0
+      wi wv0 wv0 wi wi wi wn wi wi wi wi wi wi wc9 wv0 wv0 wi wv5 wv5 wc0 wi
+      wc4 wn wv2 wn wi wc0 wv5 wi wv6 wi wi wv5 wc9 wi wn wc6 wn wc7 wi wi wv5
+      wv0 wi wn wn wv5 wc0 wi wc4 wc7 wi wi wv0 wv0 wi wv0 wv0 wi wi wi wn wi
+      wi wi wi wi wi wi wv0 wv5 wv2 wv0 wv6 wv0 wv5 th9 wv0 wv0 wi wv5 wv5 wc0
+      wi wc4 wn wv2 wn wi wc0 wv5 wi wv6 wi wi wv5 wc9 wi wn wc6 wn wc7 wi wi
+      wv5 wv0 wi wn wn wv5 wc0 wi wc4 wc7 wi wi wv0 wv0 wi wv0 wv0 wi wi wi wn
+      wi wi wi wi wi wi wc9 ax-1 ax-mp $.
+  wth1 $p wff ( ( ( c2 -> c3 ) -> ( v2 -> -. v4 ) ) -> ( ( ( v5 -> c6 ) -> ( v2 -> v0 ) ) -> v3 ) ) $=
+      wc2 wc3 wi wv2 wv4 wn wi wi wv5 wc6 wi wv2 wv0 wi wi wv3 wi wi $.
+  th29 $p |- ( v5 -> ( v5 -> ( ( ( -. v8 -> ( c8 -> v3 ) ) -> v8 ) -> ( ( ( v8 -> ( v6 -> v5 ) ) -> v3 ) -> ( ( -. v6 -> ( ( v0 -> c1 ) -> ( c2 -> v8 ) ) ) -> ( v0 -> ( -. ( c7 -> v2 ) -> -. ( v5 -> v5 ) ) ) ) ) ) ) ) $=
+      ( wv1 wi wn wc8 wc1 wc2 wc7 ax-1 ax-g7 ax-mp ) GGGHHZDDFIJCHHFHZFEDHHCHZE
+      IAKHLFHHHZAMBHZIDDHIHZHZHZHZHZHZHZGGNUHQUHHUGUHUFUGUEUFUDUEUCUDUBUCUADOUB
+      ANPUCTNPUDSNPUERNPUFDNPUGDNPUHQNPP $.
+  wth2 $p wff ( v9 -> ( ( ( v5 -> v3 ) -> v1 ) -> c1 ) ) $=
+      wv9 wv5 wv3 wi wv1 wi wc1 wi wi $.
+  th30 $p |- ( ( ( v1 -> v4 ) -> ( ( c2 -> v0 ) -> -. v7 ) ) -> ( ( ( ( v6 -> c1 ) -> ( v8 -> v3 ) ) -> ( -. v0 -> -. v5 ) ) -> ( c1 -> ( ( ( ( v6 -> c1 ) -> ( v8 -> v3 ) ) -> ( -. v0 -> -. v5 ) ) -> ( -. -. ( c5 -> v2 ) -> ( ( ( ( c9 -> c2 ) -> ( v2 -> c2 ) ) -> -. ( c2 -> v2 ) ) -> ( ( v2 -> ( -. v2 -> v2 ) ) -> ( ( ( ( c9 -> c2 ) -> ( v2 -> c2 ) ) -> -. ( c2 -> v2 ) ) -> ( -. -. ( c1 -> v6 ) -> ( ( -. ( v9 -> c5 ) -> -. c5 ) -> ( c5 -> ( v9 -> c5 ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv6 wc1 wi wv8 wv3 wi wi wv0 wn wv5 wn wi wi wc1 wv6 wc1 wi wv8 wv3 wi wi
+      wv0 wn wv5 wn wi wi wc5 wv2 wi wn wn wc9 wc2 wi wv2 wc2 wi wi wc2 wv2 wi
+      wn wi wv2 wv2 wn wv2 wi wi wc9 wc2 wi wv2 wc2 wi wi wc2 wv2 wi wn wi wc1
+      wv6 wi wn wn wv9 wc5 wi wn wc5 wn wi wc5 wv9 wc5 wi wi wi wi wi wi wi wi
+      wi wi wi wv1 wv4 wi wc2 wv0 wi wv7 wn wi wi wv6 wc1 wi wv8 wv3 wi wi wv0
+      wn wv5 wn wi wi wc1 wv6 wc1 wi wv8 wv3 wi wi wv0 wn wv5 wn wi wi wc5 wv2
+      wi wn wn wc9 wc2 wi wv2 wc2 wi wi wc2 wv2 wi wn wi wv2 wv2 wn wv2 wi wi
+      wc9 wc2 wi wv2 wc2 wi wi wc2 wv2 wi wn wi wc1 wv6 wi wn wn wv9 wc5 wi wn
+      wc5 wn wi wc5 wv9 wc5 wi wi wi wi wi wi wi wi wi wi wi wi wc1 wv6 wc1 wi
+      wv8 wv3 wi wi wv0 wn wv5 wn wi wi wc5 wv2 wi wn wn wc9 wc2 wi wv2 wc2 wi
+      wi wc2 wv2 wi wn wi wv2 wv2 wn wv2 wi wi wc9 wc2 wi wv2 wc2 wi wi wc2 wv2
+      wi wn wi wc1 wv6 wi wn wn wv9 wc5 wi wn wc5 wn wi wc5 wv9 wc5 wi wi wi wi
+      wi wi wi wi wi wi wv6 wc1 wi wv8 wv3 wi wi wv0 wn wv5 wn wi wi wc1 wv6
+      wc1 wi wv8 wv3 wi wi wv0 wn wv5 wn wi wi wc5 wv2 wi wn wn wc9 wc2 wi wv2
+      wc2 wi wi wc2 wv2 wi wn wi wv2 wv2 wn wv2 wi wi wc9 wc2 wi wv2 wc2 wi wi
+      wc2 wv2 wi wn wi wc1 wv6 wi wn wn wv9 wc5 wi wn wc5 wn wi wc5 wv9 wc5 wi
+      wi wi wi wi wi wi wi wi wi wi wv6 wc1 wi wv8 wv3 wi wi wv0 wn wv5 wn wi
+      wi wc5 wv2 wi wn wn wc9 wc2 wi wv2 wc2 wi wi wc2 wv2 wi wn wi wv2 wv2 wn
+      wv2 wi wi wc9 wc2 wi wv2 wc2 wi wi wc2 wv2 wi wn wi wc1 wv6 wi wn wn wv9
+      wc5 wi wn wc5 wn wi wc5 wv9 wc5 wi wi wi wi wi wi wi wi wi wc1 wv6 wc1 wi
+      wv8 wv3 wi wi wv0 wn wv5 wn wi wi wc5 wv2 wi wn wn wc9 wc2 wi wv2 wc2 wi
+      wi wc2 wv2 wi wn wi wv2 wv2 wn wv2 wi wi wc9 wc2 wi wv2 wc2 wi wi wc2 wv2
+      wi wn wi wc1 wv6 wi wn wn wv9 wc5 wi wn wc5 wn wi wc5 wv9 wc5 wi wi wi wi
+      wi wi wi wi wi wi wc5 wv2 wi wn wn wc9 wc2 wi wv2 wc2 wi wi wc2 wv2 wi wn
+      wi wv2 wv2 wn wv2 wi wi wc9 wc2 wi wv2 wc2 wi wi wc2 wv2 wi wn wi wc1 wv6
+      wi wn wn wv9 wc5 wi wn wc5 wn wi wc5 wv9 wc5 wi wi wi wi wi wi wi wi wv6
+      wc1 wi wv8 wv3 wi wi wv0 wn wv5 wn wi wi wc5 wv2 wi wn wn wc9 wc2 wi wv2
+      wc2 wi wi wc2 wv2 wi wn wi wv2 wv2 wn wv2 wi wi wc9 wc2 wi wv2 wc2 wi wi
+      wc2 wv2 wi wn wi wc1 wv6 wi wn wn wv9 wc5 wi wn wc5 wn wi wc5 wv9 wc5 wi
+      wi wi wi wi wi wi wi wi wv2 wc2 wv2 wv6 wc1 wc5 wv9 wv2 th8 wc5 wv2 wi wn
+      wn wc9 wc2 wi wv2 wc2 wi wi wc2 wv2 wi wn wi wv2 wv2 wn wv2 wi wi wc9 wc2
+      wi wv2 wc2 wi wi wc2 wv2 wi wn wi wc1 wv6 wi wn wn wv9 wc5 wi wn wc5 wn
+      wi wc5 wv9 wc5 wi wi wi wi wi wi wi wi wv6 wc1 wi wv8 wv3 wi wi wv0 wn
+      wv5 wn wi wi ax-1 ax-mp wv6 wc1 wi wv8 wv3 wi wi wv0 wn wv5 wn wi wi wc5
+      wv2 wi wn wn wc9 wc2 wi wv2 wc2 wi wi wc2 wv2 wi wn wi wv2 wv2 wn wv2 wi
+      wi wc9 wc2 wi wv2 wc2 wi wi wc2 wv2 wi wn wi wc1 wv6 wi wn wn wv9 wc5 wi
+      wn wc5 wn wi wc5 wv9 wc5 wi wi wi wi wi wi wi wi wi wc1 ax-1 ax-mp wc1
+      wv6 wc1 wi wv8 wv3 wi wi wv0 wn wv5 wn wi wi wc5 wv2 wi wn wn wc9 wc2 wi
+      wv2 wc2 wi wi wc2 wv2 wi wn wi wv2 wv2 wn wv2 wi wi wc9 wc2 wi wv2 wc2 wi
+      wi wc2 wv2 wi wn wi wc1 wv6 wi wn wn wv9 wc5 wi wn wc5 wn wi wc5 wv9 wc5
+      wi wi wi wi wi wi wi wi wi wi wv6 wc1 wi wv8 wv3 wi wi wv0 wn wv5 wn wi
+      wi ax-1 ax-mp wv6 wc1 wi wv8 wv3 wi wi wv0 wn wv5 wn wi wi wc1 wv6 wc1 wi
+      wv8 wv3 wi wi wv0 wn wv5 wn wi wi wc5 wv2 wi wn wn wc9 wc2 wi wv2 wc2 wi
+      wi wc2 wv2 wi wn wi wv2 wv2 wn wv2 wi wi wc9 wc2 wi wv2 wc2 wi wi wc2 wv2
+      wi wn wi wc1 wv6 wi wn wn wv9 wc5 wi wn wc5 wn wi wc5 wv9 wc5 wi wi wi wi
+      wi wi wi wi wi wi wi wv1 wv4 wi wc2 wv0 wi wv7 wn wi wi ax-1 ax-mp $.
+  th31 $p |- ( -. v3 -> ( ( -. ( v6 -> v2 ) -> v2 ) -> ( -. v3 -> -. v3 ) ) ) $=
+      ( wi wn ax-g6 ax-1 ax-mp ) CADEADZBEZJDZDZJLDKLJKJFJJGHKIGHLJGH $.
+  th32 $p |- ( ( ( -. v0 -> -. c0 ) -> ( ( v7 -> v2 ) -> ( c4 -> c8 ) ) ) -> ( ( ( v6 -> v8 ) -> ( ( v4 -> v8 ) -> v7 ) ) -> ( ( v0 -> v4 ) -> ( ( ( -. v5 -> c9 ) -> ( v0 -> ( v2 -> v7 ) ) ) -> -. ( v0 -> v4 ) ) ) ) ) $=
+      ( wi wn wc9 wc0 wc4 wc8 ax-g5 ax-1 ax-mp ) EGHCGHFHHZACHZDIJHABFHHHZRIZHZ
+      HZHZAIKIHFBHLMHHHZUCHUBUCUAUBTUARNTSOPUAROPUBQOPUCUDOP $.
+  th33 $p |- ( ( ( ( v5 -> v7 ) -> -. v8 ) -> ( v6 -> ( c1 -> v1 ) ) ) -> ( ( ( v2 -> -. c1 ) -> ( ( v5 -> v4 ) -> v8 ) ) -> ( ( ( c9 -> c1 ) -> -. ( v6 -> v0 ) ) -> ( ( ( v2 -> -. c1 ) -> ( ( v5 -> v4 ) -> v8 ) ) -> ( ( ( ( v4 -> c7 ) -> ( v3 -> v0 ) ) -> -. ( c8 -> v4 ) ) -> ( -. -. ( v3 -> v2 ) -> ( c4 -> -. ( ( ( c1 -> v3 ) -> ( c7 -> c2 ) ) -> ( c4 -> c4 ) ) ) ) ) ) ) ) ) $=
+      ( wc1 wn wi wc9 wc7 wc8 wc4 wc2 ax-g8 ax-1 ax-mp ) CJKLFELILLZMJLGALKLZUA
+      ENLDALLOELKLZDCLKKZPJDLZNQLZLPPLLKZLZLZLZLZLZLZFHLIKLGJBLLLZUMLULUMUKULUJ
+      UKUIUJUHUIUGUHUEPUFRUGPSTUHUDSTUIUCSTUJUASTUKUBSTULUASTUMUNST $.
+  th34 $p |- ( ( ( ( c7 -> c2 ) -> c6 ) -> -. c9 ) -> ( -. v9 -> ( ( ( ( c7 -> c2 ) -> c6 ) -> -. c9 ) -> ( ( v5 -> c8 ) -> ( v7 -> ( ( ( v5 -> c8 ) -> c7 ) -> -. ( -. v9 -> -. v9 ) ) ) ) ) ) ) $=
+      ( wn wc7 wc2 wi wc6 wc9 wc8 ax-g0 ax-1 ax-mp ) CDZEFGHGIDGZAJGZBPEGNNGDGZ
+      GZGZGZGZOUAGTUASTRSQRNNEPKQBLMRPLMSOLMTNLMUAOLM $.
+  th35 $p |- ( ( ( v8 -> ( c8 -> v5 ) ) -> ( ( v6 -> c0 ) -> ( v0 -> v1 ) ) ) -> ( ( v7 -> c2 ) -> ( ( v7 -> c2 ) -> ( v8 -> ( -. ( ( v7 -> c2 ) -> ( v7 -> c2 ) ) -> ( -. v8 -> ( ( v7 -> c2 ) -> v8 ) ) ) ) ) ) ) $=
+      wv7 wc2 wi wv7 wc2 wi wv8 wv7 wc2 wi wv7 wc2 wi wi wn wv8 wn wv7 wc2 wi
+      wv8 wi wi wi wi wi wi wv8 wc8 wv5 wi wi wv6 wc0 wi wv0 wv1 wi wi wi wv7
+      wc2 wi wv7 wc2 wi wv8 wv7 wc2 wi wv7 wc2 wi wi wn wv8 wn wv7 wc2 wi wv8
+      wi wi wi wi wi wi wi wv7 wc2 wi wv8 wv7 wc2 wi wv7 wc2 wi wi wn wv8 wn
+      wv7 wc2 wi wv8 wi wi wi wi wi wv7 wc2 wi wv7 wc2 wi wv8 wv7 wc2 wi wv7
+      wc2 wi wi wn wv8 wn wv7 wc2 wi wv8 wi wi wi wi wi wi wv8 wv7 wc2 wi wv7
+      wc2 wi wi wn wv8 wn wv7 wc2 wi wv8 wi wi wi wi wv7 wc2 wi wv8 wv7 wc2 wi
+      wv7 wc2 wi wi wn wv8 wn wv7 wc2 wi wv8 wi wi wi wi wi wv7 wc2 wi wv7 wc2
+      wi wi wn wv8 wn wv7 wc2 wi wv8 wi wi wi wv8 wv7 wc2 wi wv7 wc2 wi wi wn
+      wv8 wn wv7 wc2 wi wv8 wi wi wi wi wv7 wc2 wi wv7 wc2 wi wv7 wc2 wi wv8
+      ax-g9 wv7 wc2 wi wv7 wc2 wi wi wn wv8 wn wv7 wc2 wi wv8 wi wi wi wv8 ax-1
+      ax-mp wv8 wv7 wc2 wi wv7 wc2 wi wi wn wv8 wn wv7 wc2 wi wv8 wi wi wi wi
+      wv7 wc2 wi ax-1 ax-mp wv7 wc2 wi wv8 wv7 wc2 wi wv7 wc2 wi wi wn wv8 wn
+      wv7 wc2 wi wv8 wi wi wi wi wi wv7 wc2 wi ax-1 ax-mp wv7 wc2 wi wv7 wc2 wi
+      wv8 wv7 wc2 wi wv7 wc2 wi wi wn wv8 wn wv7 wc2 wi wv8 wi wi wi wi wi wi
+      wv8 wc8 wv5 wi wi wv6 wc0 wi wv0 wv1 wi wi wi ax-1 ax-mp $.
+  ${
+    sh3.0 $e |- ( -. ( v6 -> v4 ) -> v7 ) $.
+    sth3.0 $p |- ( ( ( ( v5 -> v6 ) -> ( v0 -> v2 ) ) -> ( -. v3 -> ( v4 -> v4 ) ) ) -> ( ( v6 -> ( ( v7 -> v2 ) -> -. v4 ) ) -> ( ( -. v4 -> ( -. c3 -> ( v9 -> c0 ) ) ) -> ( -. ( ( v4 -> v4 ) -> v9 ) -> ( -. ( ( v4 -> v4 ) -> v9 ) -> ( -. ( v6 -> v4 ) -> v7 ) ) ) ) ) ) $=
+      ( wi wn wc3 wc0 ax-1 ax-mp ) FGBJDKJJZDKLKHMJJJZDDJHJKZRFDJKGJZJZJZJZJZEF
+      JABJJCKDDJJJZUCJUBUCUAUBTUASTISRNOTRNOUAQNOUBPNOUCUDNO $.
+    ${
+      sh3.1 $e |- ( ( ( v2 -> v6 ) -> v8 ) -> ( ( v2 -> c0 ) -> v3 ) ) $.
+      wl3.1 $f wff v10 $.
+      sth3.1 $p |- ( v10 -> ( ( ( ( c0 -> v0 ) -> ( v9 -> c9 ) ) -> ( ( c7 -> v5 ) -> v3 ) ) -> ( ( ( ( v0 -> v0 ) -> ( v4 -> c9 ) ) -> ( ( v2 -> v1 ) -> ( c3 -> v7 ) ) ) -> ( ( ( ( c0 -> v0 ) -> ( v9 -> c9 ) ) -> ( ( c7 -> v5 ) -> v3 ) ) -> ( ( ( v2 -> v6 ) -> v8 ) -> ( ( v2 -> c0 ) -> v3 ) ) ) ) ) ) $=
+      wc0 wv0 wi wv9 wc9 wi wi wc7 wv5 wi wv3 wi wi wv0 wv0 wi wv4 wc9 wi wi
+      wv2 wv1 wi wc3 wv7 wi wi wi wc0 wv0 wi wv9 wc9 wi wi wc7 wv5 wi wv3 wi wi
+      wv2 wv6 wi wv8 wi wv2 wc0 wi wv3 wi wi wi wi wi wl3.1 wc0 wv0 wi wv9 wc9
+      wi wi wc7 wv5 wi wv3 wi wi wv0 wv0 wi wv4 wc9 wi wi wv2 wv1 wi wc3 wv7 wi
+      wi wi wc0 wv0 wi wv9 wc9 wi wi wc7 wv5 wi wv3 wi wi wv2 wv6 wi wv8 wi wv2
+      wc0 wi wv3 wi wi wi wi wi wi wv0 wv0 wi wv4 wc9 wi wi wv2 wv1 wi wc3 wv7
+      wi wi wi wc0 wv0 wi wv9 wc9 wi wi wc7 wv5 wi wv3 wi wi wv2 wv6 wi wv8 wi
+      wv2 wc0 wi wv3 wi wi wi wi wc0 wv0 wi wv9 wc9 wi wi wc7 wv5 wi wv3 wi wi
+      wv0 wv0 wi wv4 wc9 wi wi wv2 wv1 wi wc3 wv7 wi wi wi wc0 wv0 wi wv9 wc9
+      wi wi wc7 wv5 wi wv3 wi wi wv2 wv6 wi wv8 wi wv2 wc0 wi wv3 wi wi wi wi
+      wi wc0 wv0 wi wv9 wc9 wi wi wc7 wv5 wi wv3 wi wi wv2 wv6 wi wv8 wi wv2
+      wc0 wi wv3 wi wi wi wv0 wv0 wi wv4 wc9 wi wi wv2 wv1 wi wc3 wv7 wi wi wi
+      wc0 wv0 wi wv9 wc9 wi wi wc7 wv5 wi wv3 wi wi wv2 wv6 wi wv8 wi wv2 wc0
+      wi wv3 wi wi wi wi wv2 wv6 wi wv8 wi wv2 wc0 wi wv3 wi wi wc0 wv0 wi wv9
+      wc9 wi wi wc7 wv5 wi wv3 wi wi wv2 wv6 wi wv8 wi wv2 wc0 wi wv3 wi wi wi
+      sh3.1 wv2 wv6 wi wv8 wi wv2 wc0 wi wv3 wi wi wc0 wv0 wi wv9 wc9 wi wi wc7
+      wv5 wi wv3 wi wi ax-1 ax-mp wc0 wv0 wi wv9 wc9 wi wi wc7 wv5 wi wv3 wi wi
+      wv2 wv6 wi wv8 wi wv2 wc0 wi wv3 wi wi wi wv0 wv0 wi wv4 wc9 wi wi wv2
+      wv1 wi wc3 wv7 wi wi wi ax-1 ax-mp wv0 wv0 wi wv4 wc9 wi wi wv2 wv1 wi
+      wc3 wv7 wi wi wi wc0 wv0 wi wv9 wc9 wi wi wc7 wv5 wi wv3 wi wi wv2 wv6 wi
+      wv8 wi wv2 wc0 wi wv3 wi wi wi wi wc0 wv0 wi wv9 wc9 wi wi wc7 wv5 wi wv3
+      wi wi ax-1 ax-mp wc0 wv0 wi wv9 wc9 wi wi wc7 wv5 wi wv3 wi wi wv0 wv0 wi
+      wv4 wc9 wi wi wv2 wv1 wi wc3 wv7 wi wi wi wc0 wv0 wi wv9 wc9 wi wi wc7
+      wv5 wi wv3 wi wi wv2 wv6 wi wv8 wi wv2 wc0 wi wv3 wi wi wi wi wi wl3.1
+      ax-1 ax-mp $.
+      ${
+        sh3.2 $e |- v6 $.
+        sth3.2 $p |- ( v3 -> ( -. v4 -> ( v5 -> ( v3 -> ( ( ( c3 -> v9 ) -> c3 ) -> v6 ) ) ) ) ) $=
+      wv4 wn wv5 wv3 wc3 wv9 wi wc3 wi wv6 wi wi wi wi wv3 wv4 wn wv5 wv3 wc3
+      wv9 wi wc3 wi wv6 wi wi wi wi wi wv5 wv3 wc3 wv9 wi wc3 wi wv6 wi wi wi
+      wv4 wn wv5 wv3 wc3 wv9 wi wc3 wi wv6 wi wi wi wi wv3 wc3 wv9 wi wc3 wi
+      wv6 wi wi wv5 wv3 wc3 wv9 wi wc3 wi wv6 wi wi wi wc3 wv9 wi wc3 wi wv6 wi
+      wv3 wc3 wv9 wi wc3 wi wv6 wi wi wv6 wc3 wv9 wi wc3 wi wv6 wi sh3.2 wv6
+      wc3 wv9 wi wc3 wi ax-1 ax-mp wc3 wv9 wi wc3 wi wv6 wi wv3 ax-1 ax-mp wv3
+      wc3 wv9 wi wc3 wi wv6 wi wi wv5 ax-1 ax-mp wv5 wv3 wc3 wv9 wi wc3 wi wv6
+      wi wi wi wv4 wn ax-1 ax-mp wv4 wn wv5 wv3 wc3 wv9 wi wc3 wi wv6 wi wi wi
+      wi wv3 ax-1 ax-mp $.
+      $}
+    $}
+  $}
+  th36 $p |- ( ( -. ( c4 -> v3 ) -> ( ( c7 -> c1 ) -> ( c9 -> c1 ) ) ) -> ( ( ( ( v0 -> c4 ) -> ( v9 -> v5 ) ) -> ( c8 -> ( v1 -> v5 ) ) ) -> ( c9 -> ( c7 -> ( c1 -> ( ( -. ( v1 -> v1 ) -> ( ( v3 -> v2 ) -> ( v2 -> c8 ) ) ) -> ( ( c9 -> ( ( c3 -> v4 ) -> -. v7 ) ) -> ( ( c7 -> ( ( v5 -> v9 ) -> c5 ) ) -> ( -. -. v8 -> -. ( c7 -> c7 ) ) ) ) ) ) ) ) ) ) $=
+      wv0 wc4 wi wv9 wv5 wi wi wc8 wv1 wv5 wi wi wi wc9 wc7 wc1 wv1 wv1 wi wn
+      wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7 wn wi wi wc7 wv5 wv9 wi
+      wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wi wi wi wi wc4 wv3 wi wn
+      wc7 wc1 wi wc9 wc1 wi wi wi wv0 wc4 wi wv9 wv5 wi wi wc8 wv1 wv5 wi wi wi
+      wc9 wc7 wc1 wv1 wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7
+      wn wi wi wc7 wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wi
+      wi wi wi wi wc9 wc7 wc1 wv1 wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3
+      wv4 wi wv7 wn wi wi wc7 wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi
+      wi wi wi wi wi wi wv0 wc4 wi wv9 wv5 wi wi wc8 wv1 wv5 wi wi wi wc9 wc7
+      wc1 wv1 wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7 wn wi wi
+      wc7 wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wi wi wi wi
+      wc7 wc1 wv1 wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7 wn
+      wi wi wc7 wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wi wi
+      wc9 wc7 wc1 wv1 wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7
+      wn wi wi wc7 wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wi
+      wi wi wc1 wv1 wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7 wn
+      wi wi wc7 wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wi wc7
+      wc1 wv1 wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7 wn wi wi
+      wc7 wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wi wi wv1
+      wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7 wn wi wi wc7 wv5
+      wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wc1 wv1 wv1 wi wn
+      wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7 wn wi wi wc7 wv5 wv9 wi
+      wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wi wc9 wc3 wv4 wi wv7 wn wi
+      wi wc7 wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wv1 wv1 wi
+      wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7 wn wi wi wc7 wv5 wv9 wi
+      wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wc7 wv5 wv9 wi wc5 wi wi
+      wv8 wn wn wc7 wc7 wi wn wi wi wc9 wc3 wv4 wi wv7 wn wi wi wc7 wv5 wv9 wi
+      wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wv8 wn wn wc7 wc7 wi wn wi wc7
+      wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wv8 wn wc7 ax-g7 wv8
+      wn wn wc7 wc7 wi wn wi wc7 wv5 wv9 wi wc5 wi wi ax-1 ax-mp wc7 wv5 wv9 wi
+      wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wc9 wc3 wv4 wi wv7 wn wi wi ax-1
+      ax-mp wc9 wc3 wv4 wi wv7 wn wi wi wc7 wv5 wv9 wi wc5 wi wi wv8 wn wn wc7
+      wc7 wi wn wi wi wi wv1 wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi ax-1 ax-mp
+      wv1 wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7 wn wi wi wc7
+      wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wc1 ax-1 ax-mp
+      wc1 wv1 wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7 wn wi wi
+      wc7 wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wi wc7 ax-1
+      ax-mp wc7 wc1 wv1 wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi
+      wv7 wn wi wi wc7 wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi
+      wi wi wc9 ax-1 ax-mp wc9 wc7 wc1 wv1 wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi
+      wi wc9 wc3 wv4 wi wv7 wn wi wi wc7 wv5 wv9 wi wc5 wi wi wv8 wn wn wc7 wc7
+      wi wn wi wi wi wi wi wi wi wv0 wc4 wi wv9 wv5 wi wi wc8 wv1 wv5 wi wi wi
+      ax-1 ax-mp wv0 wc4 wi wv9 wv5 wi wi wc8 wv1 wv5 wi wi wi wc9 wc7 wc1 wv1
+      wv1 wi wn wv3 wv2 wi wv2 wc8 wi wi wi wc9 wc3 wv4 wi wv7 wn wi wi wc7 wv5
+      wv9 wi wc5 wi wi wv8 wn wn wc7 wc7 wi wn wi wi wi wi wi wi wi wi wc4 wv3
+      wi wn wc7 wc1 wi wc9 wc1 wi wi wi ax-1 ax-mp $.
+  ${
+    $d v1 v3 $.
+    $d v1 v9 $.
+    th37 $p |- ( v1 -> ( ( -. ( v7 -> v9 ) -> ( ( v5 -> c8 ) -> ( v2 -> v0 ) ) ) -> ( -. ( ( v9 -> v3 ) -> -. v1 ) -> ( v5 -> v9 ) ) ) ) $=
+      wv7 wv9 wi wn wv5 wc8 wi wv2 wv0 wi wi wi wv9 wv3 wi wv1 wn wi wn wv5 wv9
+      wi wi wi wv1 wv7 wv9 wi wn wv5 wc8 wi wv2 wv0 wi wi wi wv9 wv3 wi wv1 wn
+      wi wn wv5 wv9 wi wi wi wi wv9 wv3 wi wv1 wn wi wn wv5 wv9 wi wi wv7 wv9
+      wi wn wv5 wc8 wi wv2 wv0 wi wi wi wv9 wv3 wi wv1 wn wi wn wv5 wv9 wi wi
+      wi wv1 wn wv5 wv9 wi wv9 wv3 wi ax-g1 wv9 wv3 wi wv1 wn wi wn wv5 wv9 wi
+      wi wv7 wv9 wi wn wv5 wc8 wi wv2 wv0 wi wi wi ax-1 ax-mp wv7 wv9 wi wn wv5
+      wc8 wi wv2 wv0 wi wi wi wv9 wv3 wi wv1 wn wi wn wv5 wv9 wi wi wi wv1 ax-1
+      ax-mp $.
+  $}
+  ${
+    $d v2 v8 $.
+    $d v6 v8 $.
+    th38 $p |- ( ( ( -. v4 -> c8 ) -> ( ( c1 -> v8 ) -> ( v4 -> v3 ) ) ) -> ( ( c1 -> v7 ) -> ( ( ( ( c8 -> c9 ) -> -. v3 ) -> ( ( v5 -> v9 ) -> c9 ) ) -> ( ( ( v6 -> v2 ) -> -. ( c5 -> v5 ) ) -> ( c7 -> ( ( -. c8 -> ( ( c6 -> v2 ) -> ( v7 -> v6 ) ) ) -> ( ( ( v2 -> ( v3 -> v6 ) ) -> ( ( v7 -> c5 ) -> ( v4 -> v3 ) ) ) -> ( v7 -> ( -. ( ( c1 -> v7 ) -> ( v6 -> v2 ) ) -> -. ( ( v6 -> v2 ) -> ( v8 -> v8 ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc1 wi wc8 wc9 wn wc5 wc7 wc6 ax-g3 ax-1 ax-mp ) IFJZKLJBMJDHJLJJZEAJND
+      JMJZOKMPAJFEJJJZABEJJFNJCBJJJZFTEAJZJMUEGGJZJMJZJZJZJZJZJZJZJZCMKJIGJCBJJ
+      JZUNJUMUNULUMUKULUJUKUIUJUHUIUGUHUFUETUEQUGFRSUHUDRSUIUCRSUJORSUKUBRSULUA
+      RSUMTRSUNUORS $.
+  $}
+  th39 $p |- ( c6 -> ( c6 -> ( -. ( ( v6 -> c3 ) -> ( c8 -> c6 ) ) -> ( ( ( ( c6 -> v1 ) -> c0 ) -> ( ( v6 -> v4 ) -> ( v9 -> v9 ) ) ) -> ( ( c1 -> ( v0 -> v4 ) ) -> ( c9 -> ( -. ( ( v6 -> v8 ) -> ( v8 -> v5 ) ) -> ( -. ( ( v6 -> v8 ) -> ( v8 -> v5 ) ) -> ( v6 -> c5 ) ) ) ) ) ) ) ) ) $=
+      ( wc6 wc3 wi wc8 wn wc0 wc1 wc9 wc5 ax-g6 ax-1 ax-mp ) HEIJKHJJLZHBJMJECJ
+      GGJJJZNACJJZOEFJFDJJLZUCEPJZJZJZJZJZJZJZJZHUKJUJUKUIUJUHUIUGUHUFUGUEUFUDU
+      EUDQUDUCRSUEUCRSUFORSUGUBRSUHUARSUITRSUJHRSUKHRS $.
+  th40 $p |- ( ( c7 -> ( v9 -> ( v9 -> c4 ) ) ) -> ( -. ( -. v0 -> ( c9 -> v0 ) ) -> ( ( c3 -> -. ( v5 -> c4 ) ) -> ( v5 -> ( -. v5 -> ( ( ( v7 -> ( v9 -> v9 ) ) -> ( ( v4 -> v7 ) -> ( c6 -> c5 ) ) ) -> ( -. ( -. c7 -> ( v9 -> v2 ) ) -> ( ( v3 -> v4 ) -> ( ( -. v9 -> ( v3 -> v4 ) ) -> -. ( ( v9 -> c7 ) -> ( v7 -> v0 ) ) ) ) ) ) ) ) ) ) ) $=
+      wv0 wn wc9 wv0 wi wi wn wc3 wv5 wc4 wi wn wi wv5 wv5 wn wv7 wv9 wv9 wi wi
+      wv4 wv7 wi wc6 wc5 wi wi wi wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9 wn wv3
+      wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi wi wi wi wi wi wi wi wc7 wv9 wv9
+      wc4 wi wi wi wv0 wn wc9 wv0 wi wi wn wc3 wv5 wc4 wi wn wi wv5 wv5 wn wv7
+      wv9 wv9 wi wi wv4 wv7 wi wc6 wc5 wi wi wi wc7 wn wv9 wv2 wi wi wn wv3 wv4
+      wi wv9 wn wv3 wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi wi wi wi wi wi wi
+      wi wi wc3 wv5 wc4 wi wn wi wv5 wv5 wn wv7 wv9 wv9 wi wi wv4 wv7 wi wc6
+      wc5 wi wi wi wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9 wn wv3 wv4 wi wi wv9
+      wc7 wi wv7 wv0 wi wi wn wi wi wi wi wi wi wi wv0 wn wc9 wv0 wi wi wn wc3
+      wv5 wc4 wi wn wi wv5 wv5 wn wv7 wv9 wv9 wi wi wv4 wv7 wi wc6 wc5 wi wi wi
+      wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9 wn wv3 wv4 wi wi wv9 wc7 wi wv7
+      wv0 wi wi wn wi wi wi wi wi wi wi wi wv5 wv5 wn wv7 wv9 wv9 wi wi wv4 wv7
+      wi wc6 wc5 wi wi wi wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9 wn wv3 wv4 wi
+      wi wv9 wc7 wi wv7 wv0 wi wi wn wi wi wi wi wi wi wc3 wv5 wc4 wi wn wi wv5
+      wv5 wn wv7 wv9 wv9 wi wi wv4 wv7 wi wc6 wc5 wi wi wi wc7 wn wv9 wv2 wi wi
+      wn wv3 wv4 wi wv9 wn wv3 wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi wi wi
+      wi wi wi wi wv5 wn wv7 wv9 wv9 wi wi wv4 wv7 wi wc6 wc5 wi wi wi wc7 wn
+      wv9 wv2 wi wi wn wv3 wv4 wi wv9 wn wv3 wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi
+      wn wi wi wi wi wi wv5 wv5 wn wv7 wv9 wv9 wi wi wv4 wv7 wi wc6 wc5 wi wi
+      wi wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9 wn wv3 wv4 wi wi wv9 wc7 wi wv7
+      wv0 wi wi wn wi wi wi wi wi wi wv7 wv9 wv9 wi wi wv4 wv7 wi wc6 wc5 wi wi
+      wi wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9 wn wv3 wv4 wi wi wv9 wc7 wi wv7
+      wv0 wi wi wn wi wi wi wi wv5 wn wv7 wv9 wv9 wi wi wv4 wv7 wi wc6 wc5 wi
+      wi wi wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9 wn wv3 wv4 wi wi wv9 wc7 wi
+      wv7 wv0 wi wi wn wi wi wi wi wi wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9 wn
+      wv3 wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi wi wi wv7 wv9 wv9 wi wi wv4
+      wv7 wi wc6 wc5 wi wi wi wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9 wn wv3 wv4
+      wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi wi wi wi wv3 wv4 wi wv9 wn wv3 wv4
+      wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi wi wc7 wn wv9 wv2 wi wi wn wv3 wv4
+      wi wv9 wn wv3 wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi wi wi wv9 wn wv3
+      wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi wv3 wv4 wi wv9 wn wv3 wv4 wi wi
+      wv9 wc7 wi wv7 wv0 wi wi wn wi wi wv9 wc7 wi wv7 wv0 wi wv3 wv4 wi wv9 wn
+      ax-g0 wv9 wn wv3 wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi wv3 wv4 wi ax-1
+      ax-mp wv3 wv4 wi wv9 wn wv3 wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi wi
+      wc7 wn wv9 wv2 wi wi wn ax-1 ax-mp wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9
+      wn wv3 wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi wi wi wv7 wv9 wv9 wi wi
+      wv4 wv7 wi wc6 wc5 wi wi wi ax-1 ax-mp wv7 wv9 wv9 wi wi wv4 wv7 wi wc6
+      wc5 wi wi wi wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9 wn wv3 wv4 wi wi wv9
+      wc7 wi wv7 wv0 wi wi wn wi wi wi wi wv5 wn ax-1 ax-mp wv5 wn wv7 wv9 wv9
+      wi wi wv4 wv7 wi wc6 wc5 wi wi wi wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9
+      wn wv3 wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi wi wi wi wi wv5 ax-1
+      ax-mp wv5 wv5 wn wv7 wv9 wv9 wi wi wv4 wv7 wi wc6 wc5 wi wi wi wc7 wn wv9
+      wv2 wi wi wn wv3 wv4 wi wv9 wn wv3 wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi wn
+      wi wi wi wi wi wi wc3 wv5 wc4 wi wn wi ax-1 ax-mp wc3 wv5 wc4 wi wn wi
+      wv5 wv5 wn wv7 wv9 wv9 wi wi wv4 wv7 wi wc6 wc5 wi wi wi wc7 wn wv9 wv2
+      wi wi wn wv3 wv4 wi wv9 wn wv3 wv4 wi wi wv9 wc7 wi wv7 wv0 wi wi wn wi
+      wi wi wi wi wi wi wv0 wn wc9 wv0 wi wi wn ax-1 ax-mp wv0 wn wc9 wv0 wi wi
+      wn wc3 wv5 wc4 wi wn wi wv5 wv5 wn wv7 wv9 wv9 wi wi wv4 wv7 wi wc6 wc5
+      wi wi wi wc7 wn wv9 wv2 wi wi wn wv3 wv4 wi wv9 wn wv3 wv4 wi wi wv9 wc7
+      wi wv7 wv0 wi wi wn wi wi wi wi wi wi wi wi wc7 wv9 wv9 wc4 wi wi wi ax-1
+      ax-mp $.
+  th41 $p |- ( ( ( ( c1 -> v0 ) -> ( v9 -> v3 ) ) -> v4 ) -> ( ( ( ( v7 -> v6 ) -> ( c0 -> c5 ) ) -> ( ( v6 -> v3 ) -> ( v7 -> c2 ) ) ) -> ( ( v5 -> c2 ) -> ( ( v5 -> c2 ) -> ( ( v9 -> ( ( c6 -> v0 ) -> ( c7 -> v5 ) ) ) -> v6 ) ) ) ) ) $=
+      ( wi wc0 wc5 wc2 wc6 wc7 wc1 ax-g6 ax-1 ax-mp ) FEHIJHHEBHFKHHHZDKHZSGLAH
+      MDHHHZEHZHZHZHZNAHGBHHCHZUDHUCUDUBUCUAUBEUAEOETPQUASPQUBSPQUCRPQUDUEPQ $.
+  th42 $p |- ( ( v3 -> v9 ) -> ( v5 -> ( c9 -> ( c2 -> ( c2 -> ( c2 -> ( ( v4 -> v5 ) -> ( -. ( c7 -> v1 ) -> -. ( ( v4 -> v5 ) -> ( v4 -> v5 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc9 wc2 wi wc7 wn ax-g7 ax-1 ax-mp ) DFGGGCDHZIAHZJNNHJHZHZHZHZHZHZHZBE
+      HZUBHUAUBTUASTRSQRPQONKPNLMQGLMRGLMSGLMTFLMUADLMUBUCLM $.
+  wth3 $p wff ( v1 -> ( ( v3 -> ( c0 -> v6 ) ) -> -. ( c5 -> c9 ) ) ) $=
+      wv1 wv3 wc0 wv6 wi wi wc5 wc9 wi wn wi wi $.
+  th43 $p |- ( ( ( ( v0 -> v6 ) -> ( v0 -> v3 ) ) -> ( ( v8 -> v1 ) -> ( c7 -> v7 ) ) ) -> ( ( ( -. c3 -> ( v7 -> v3 ) ) -> ( ( v8 -> v2 ) -> ( v4 -> v2 ) ) ) -> ( c5 -> ( c8 -> ( ( v4 -> ( ( v6 -> v9 ) -> ( v2 -> c8 ) ) ) -> ( -. ( c8 -> ( v5 -> c5 ) ) -> c0 ) ) ) ) ) ) $=
+      wc3 wn wv7 wv3 wi wi wv8 wv2 wi wv4 wv2 wi wi wi wc5 wc8 wv4 wv6 wv9 wi
+      wv2 wc8 wi wi wi wc8 wv5 wc5 wi wi wn wc0 wi wi wi wi wi wv0 wv6 wi wv0
+      wv3 wi wi wv8 wv1 wi wc7 wv7 wi wi wi wc3 wn wv7 wv3 wi wi wv8 wv2 wi wv4
+      wv2 wi wi wi wc5 wc8 wv4 wv6 wv9 wi wv2 wc8 wi wi wi wc8 wv5 wc5 wi wi wn
+      wc0 wi wi wi wi wi wi wc5 wc8 wv4 wv6 wv9 wi wv2 wc8 wi wi wi wc8 wv5 wc5
+      wi wi wn wc0 wi wi wi wi wc3 wn wv7 wv3 wi wi wv8 wv2 wi wv4 wv2 wi wi wi
+      wc5 wc8 wv4 wv6 wv9 wi wv2 wc8 wi wi wi wc8 wv5 wc5 wi wi wn wc0 wi wi wi
+      wi wi wc8 wv4 wv6 wv9 wi wv2 wc8 wi wi wi wc8 wv5 wc5 wi wi wn wc0 wi wi
+      wi wc5 wc8 wv4 wv6 wv9 wi wv2 wc8 wi wi wi wc8 wv5 wc5 wi wi wn wc0 wi wi
+      wi wi wv4 wv6 wv9 wi wv2 wc8 wi wi wi wc8 wv5 wc5 wi wi wn wc0 wi wi wc8
+      wv4 wv6 wv9 wi wv2 wc8 wi wi wi wc8 wv5 wc5 wi wi wn wc0 wi wi wi wc8 wv5
+      wc5 wi wi wn wc0 wi wv4 wv6 wv9 wi wv2 wc8 wi wi wi wc8 wv5 wc5 wi wi wn
+      wc0 wi wi wv5 wc5 wi wc0 wc8 ax-g1 wc8 wv5 wc5 wi wi wn wc0 wi wv4 wv6
+      wv9 wi wv2 wc8 wi wi wi ax-1 ax-mp wv4 wv6 wv9 wi wv2 wc8 wi wi wi wc8
+      wv5 wc5 wi wi wn wc0 wi wi wc8 ax-1 ax-mp wc8 wv4 wv6 wv9 wi wv2 wc8 wi
+      wi wi wc8 wv5 wc5 wi wi wn wc0 wi wi wi wc5 ax-1 ax-mp wc5 wc8 wv4 wv6
+      wv9 wi wv2 wc8 wi wi wi wc8 wv5 wc5 wi wi wn wc0 wi wi wi wi wc3 wn wv7
+      wv3 wi wi wv8 wv2 wi wv4 wv2 wi wi wi ax-1 ax-mp wc3 wn wv7 wv3 wi wi wv8
+      wv2 wi wv4 wv2 wi wi wi wc5 wc8 wv4 wv6 wv9 wi wv2 wc8 wi wi wi wc8 wv5
+      wc5 wi wi wn wc0 wi wi wi wi wi wv0 wv6 wi wv0 wv3 wi wi wv8 wv1 wi wc7
+      wv7 wi wi wi ax-1 ax-mp $.
+  th44 $p |- ( v6 -> ( ( v0 -> ( v0 -> ( c1 -> v0 ) ) ) -> ( -. -. ( v2 -> c7 ) -> ( ( v6 -> ( c1 -> v9 ) ) -> ( ( c2 -> v5 ) -> ( ( c9 -> c5 ) -> ( ( c9 -> c5 ) -> ( ( ( c5 -> ( v4 -> v6 ) ) -> ( v6 -> v4 ) ) -> ( c2 -> ( c2 -> v5 ) ) ) ) ) ) ) ) ) ) $=
+      wv0 wv0 wc1 wv0 wi wi wi wv2 wc7 wi wn wn wv6 wc1 wv9 wi wi wc2 wv5 wi
+      wc9 wc5 wi wc9 wc5 wi wc5 wv4 wv6 wi wi wv6 wv4 wi wi wc2 wc2 wv5 wi wi
+      wi wi wi wi wi wi wi wv6 wv0 wv0 wc1 wv0 wi wi wi wv2 wc7 wi wn wn wv6
+      wc1 wv9 wi wi wc2 wv5 wi wc9 wc5 wi wc9 wc5 wi wc5 wv4 wv6 wi wi wv6 wv4
+      wi wi wc2 wc2 wv5 wi wi wi wi wi wi wi wi wi wi wv2 wc7 wi wn wn wv6 wc1
+      wv9 wi wi wc2 wv5 wi wc9 wc5 wi wc9 wc5 wi wc5 wv4 wv6 wi wi wv6 wv4 wi
+      wi wc2 wc2 wv5 wi wi wi wi wi wi wi wi wv0 wv0 wc1 wv0 wi wi wi wv2 wc7
+      wi wn wn wv6 wc1 wv9 wi wi wc2 wv5 wi wc9 wc5 wi wc9 wc5 wi wc5 wv4 wv6
+      wi wi wv6 wv4 wi wi wc2 wc2 wv5 wi wi wi wi wi wi wi wi wi wv6 wc1 wv9 wi
+      wi wc2 wv5 wi wc9 wc5 wi wc9 wc5 wi wc5 wv4 wv6 wi wi wv6 wv4 wi wi wc2
+      wc2 wv5 wi wi wi wi wi wi wi wv2 wc7 wi wn wn wv6 wc1 wv9 wi wi wc2 wv5
+      wi wc9 wc5 wi wc9 wc5 wi wc5 wv4 wv6 wi wi wv6 wv4 wi wi wc2 wc2 wv5 wi
+      wi wi wi wi wi wi wi wc2 wv5 wi wc9 wc5 wi wc9 wc5 wi wc5 wv4 wv6 wi wi
+      wv6 wv4 wi wi wc2 wc2 wv5 wi wi wi wi wi wi wv6 wc1 wv9 wi wi wc2 wv5 wi
+      wc9 wc5 wi wc9 wc5 wi wc5 wv4 wv6 wi wi wv6 wv4 wi wi wc2 wc2 wv5 wi wi
+      wi wi wi wi wi wc2 wc2 wv6 wv5 wv4 wv4 th13 wc2 wv5 wi wc9 wc5 wi wc9 wc5
+      wi wc5 wv4 wv6 wi wi wv6 wv4 wi wi wc2 wc2 wv5 wi wi wi wi wi wi wv6 wc1
+      wv9 wi wi ax-1 ax-mp wv6 wc1 wv9 wi wi wc2 wv5 wi wc9 wc5 wi wc9 wc5 wi
+      wc5 wv4 wv6 wi wi wv6 wv4 wi wi wc2 wc2 wv5 wi wi wi wi wi wi wi wv2 wc7
+      wi wn wn ax-1 ax-mp wv2 wc7 wi wn wn wv6 wc1 wv9 wi wi wc2 wv5 wi wc9 wc5
+      wi wc9 wc5 wi wc5 wv4 wv6 wi wi wv6 wv4 wi wi wc2 wc2 wv5 wi wi wi wi wi
+      wi wi wi wv0 wv0 wc1 wv0 wi wi wi ax-1 ax-mp wv0 wv0 wc1 wv0 wi wi wi wv2
+      wc7 wi wn wn wv6 wc1 wv9 wi wi wc2 wv5 wi wc9 wc5 wi wc9 wc5 wi wc5 wv4
+      wv6 wi wi wv6 wv4 wi wi wc2 wc2 wv5 wi wi wi wi wi wi wi wi wi wv6 ax-1
+      ax-mp $.
+  wth4 $p wff ( v5 -> v8 ) $=
+      wv5 wv8 wi $.
+  th45 $p |- ( ( v8 -> v4 ) -> ( ( ( ( v7 -> v0 ) -> ( v3 -> v4 ) ) -> ( ( v9 -> v0 ) -> ( v7 -> v4 ) ) ) -> ( v3 -> ( v9 -> ( ( ( c0 -> ( v6 -> v3 ) ) -> c6 ) -> ( ( v8 -> v4 ) -> ( -. ( ( c5 -> c0 ) -> ( c5 -> c1 ) ) -> ( ( c0 -> -. ( c4 -> c1 ) ) -> ( ( -. -. c5 -> c1 ) -> ( ( ( -. c5 -> c0 ) -> v3 ) -> ( ( ( v1 -> c0 ) -> c1 ) -> ( ( ( -. c5 -> c0 ) -> v3 ) -> ( ( ( -. c5 -> c0 ) -> v3 ) -> ( ( ( ( c1 -> c1 ) -> -. c5 ) -> ( c1 -> c5 ) ) -> ( ( ( c1 -> c5 ) -> ( c1 -> c5 ) ) -> -. ( ( c1 -> c1 ) -> c6 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv7 wv0 wi wv3 wv4 wi wi wv9 wv0 wi wv7 wv4 wi wi wi wv3 wv9 wc0 wv6 wv3
+      wi wi wc6 wi wv8 wv4 wi wc5 wc0 wi wc5 wc1 wi wi wn wc0 wc4 wc1 wi wn wi
+      wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1 wi wc5 wn wc0 wi wv3
+      wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5 wi wi wc1 wc5 wi wc1
+      wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi wi
+      wv8 wv4 wi wv7 wv0 wi wv3 wv4 wi wi wv9 wv0 wi wv7 wv4 wi wi wi wv3 wv9
+      wc0 wv6 wv3 wi wi wc6 wi wv8 wv4 wi wc5 wc0 wi wc5 wc1 wi wi wn wc0 wc4
+      wc1 wi wn wi wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1 wi wc5
+      wn wc0 wi wv3 wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5 wi wi
+      wc1 wc5 wi wc1 wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wv3 wv9 wc0 wv6 wv3 wi wi wc6 wi wv8 wv4 wi wc5 wc0 wi
+      wc5 wc1 wi wi wn wc0 wc4 wc1 wi wn wi wc5 wn wn wc1 wi wc5 wn wc0 wi wv3
+      wi wv1 wc0 wi wc1 wi wc5 wn wc0 wi wv3 wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi
+      wc5 wn wi wc1 wc5 wi wi wc1 wc5 wi wc1 wc5 wi wi wc1 wc1 wi wc6 wi wn wi
+      wi wi wi wi wi wi wi wi wi wi wi wi wv7 wv0 wi wv3 wv4 wi wi wv9 wv0 wi
+      wv7 wv4 wi wi wi wv3 wv9 wc0 wv6 wv3 wi wi wc6 wi wv8 wv4 wi wc5 wc0 wi
+      wc5 wc1 wi wi wn wc0 wc4 wc1 wi wn wi wc5 wn wn wc1 wi wc5 wn wc0 wi wv3
+      wi wv1 wc0 wi wc1 wi wc5 wn wc0 wi wv3 wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi
+      wc5 wn wi wc1 wc5 wi wi wc1 wc5 wi wc1 wc5 wi wi wc1 wc1 wi wc6 wi wn wi
+      wi wi wi wi wi wi wi wi wi wi wi wi wi wv9 wc0 wv6 wv3 wi wi wc6 wi wv8
+      wv4 wi wc5 wc0 wi wc5 wc1 wi wi wn wc0 wc4 wc1 wi wn wi wc5 wn wn wc1 wi
+      wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1 wi wc5 wn wc0 wi wv3 wi wc5 wn wc0 wi
+      wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5 wi wi wc1 wc5 wi wc1 wc5 wi wi wc1
+      wc1 wi wc6 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wv3 wv9 wc0 wv6 wv3
+      wi wi wc6 wi wv8 wv4 wi wc5 wc0 wi wc5 wc1 wi wi wn wc0 wc4 wc1 wi wn wi
+      wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1 wi wc5 wn wc0 wi wv3
+      wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5 wi wi wc1 wc5 wi wc1
+      wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi wc0
+      wv6 wv3 wi wi wc6 wi wv8 wv4 wi wc5 wc0 wi wc5 wc1 wi wi wn wc0 wc4 wc1
+      wi wn wi wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1 wi wc5 wn
+      wc0 wi wv3 wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5 wi wi wc1
+      wc5 wi wc1 wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi wi wi wi wi wi wi wi
+      wi wv9 wc0 wv6 wv3 wi wi wc6 wi wv8 wv4 wi wc5 wc0 wi wc5 wc1 wi wi wn
+      wc0 wc4 wc1 wi wn wi wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1
+      wi wc5 wn wc0 wi wv3 wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5
+      wi wi wc1 wc5 wi wc1 wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi wi wi wi wi
+      wi wi wi wi wi wv8 wv4 wi wc5 wc0 wi wc5 wc1 wi wi wn wc0 wc4 wc1 wi wn
+      wi wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1 wi wc5 wn wc0 wi
+      wv3 wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5 wi wi wc1 wc5 wi
+      wc1 wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi wi wi wi wi wi wi wi wc0 wv6
+      wv3 wi wi wc6 wi wv8 wv4 wi wc5 wc0 wi wc5 wc1 wi wi wn wc0 wc4 wc1 wi wn
+      wi wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1 wi wc5 wn wc0 wi
+      wv3 wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5 wi wi wc1 wc5 wi
+      wc1 wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi wi wi wi wi wi wi wi wi wc5
+      wc0 wi wc5 wc1 wi wi wn wc0 wc4 wc1 wi wn wi wc5 wn wn wc1 wi wc5 wn wc0
+      wi wv3 wi wv1 wc0 wi wc1 wi wc5 wn wc0 wi wv3 wi wc5 wn wc0 wi wv3 wi wc1
+      wc1 wi wc5 wn wi wc1 wc5 wi wi wc1 wc5 wi wc1 wc5 wi wi wc1 wc1 wi wc6 wi
+      wn wi wi wi wi wi wi wi wi wi wv8 wv4 wi wc5 wc0 wi wc5 wc1 wi wi wn wc0
+      wc4 wc1 wi wn wi wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1 wi
+      wc5 wn wc0 wi wv3 wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5 wi
+      wi wc1 wc5 wi wc1 wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi wi wi wi wi wi
+      wi wi wc5 wc1 wv1 wc1 wv3 wc5 wc0 wc1 th5 wc5 wc0 wi wc5 wc1 wi wi wn wc0
+      wc4 wc1 wi wn wi wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1 wi
+      wc5 wn wc0 wi wv3 wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5 wi
+      wi wc1 wc5 wi wc1 wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi wi wi wi wi wi
+      wi wv8 wv4 wi ax-1 ax-mp wv8 wv4 wi wc5 wc0 wi wc5 wc1 wi wi wn wc0 wc4
+      wc1 wi wn wi wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1 wi wc5
+      wn wc0 wi wv3 wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5 wi wi
+      wc1 wc5 wi wc1 wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi wi wi wi wi wi wi
+      wi wc0 wv6 wv3 wi wi wc6 wi ax-1 ax-mp wc0 wv6 wv3 wi wi wc6 wi wv8 wv4
+      wi wc5 wc0 wi wc5 wc1 wi wi wn wc0 wc4 wc1 wi wn wi wc5 wn wn wc1 wi wc5
+      wn wc0 wi wv3 wi wv1 wc0 wi wc1 wi wc5 wn wc0 wi wv3 wi wc5 wn wc0 wi wv3
+      wi wc1 wc1 wi wc5 wn wi wc1 wc5 wi wi wc1 wc5 wi wc1 wc5 wi wi wc1 wc1 wi
+      wc6 wi wn wi wi wi wi wi wi wi wi wi wi wi wv9 ax-1 ax-mp wv9 wc0 wv6 wv3
+      wi wi wc6 wi wv8 wv4 wi wc5 wc0 wi wc5 wc1 wi wi wn wc0 wc4 wc1 wi wn wi
+      wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1 wi wc5 wn wc0 wi wv3
+      wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5 wi wi wc1 wc5 wi wc1
+      wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wv3
+      ax-1 ax-mp wv3 wv9 wc0 wv6 wv3 wi wi wc6 wi wv8 wv4 wi wc5 wc0 wi wc5 wc1
+      wi wi wn wc0 wc4 wc1 wi wn wi wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1
+      wc0 wi wc1 wi wc5 wn wc0 wi wv3 wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn
+      wi wc1 wc5 wi wi wc1 wc5 wi wc1 wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi
+      wi wi wi wi wi wi wi wi wi wi wv7 wv0 wi wv3 wv4 wi wi wv9 wv0 wi wv7 wv4
+      wi wi wi ax-1 ax-mp wv7 wv0 wi wv3 wv4 wi wi wv9 wv0 wi wv7 wv4 wi wi wi
+      wv3 wv9 wc0 wv6 wv3 wi wi wc6 wi wv8 wv4 wi wc5 wc0 wi wc5 wc1 wi wi wn
+      wc0 wc4 wc1 wi wn wi wc5 wn wn wc1 wi wc5 wn wc0 wi wv3 wi wv1 wc0 wi wc1
+      wi wc5 wn wc0 wi wv3 wi wc5 wn wc0 wi wv3 wi wc1 wc1 wi wc5 wn wi wc1 wc5
+      wi wi wc1 wc5 wi wc1 wc5 wi wi wc1 wc1 wi wc6 wi wn wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wi wv8 wv4 wi ax-1 ax-mp $.
+  th46 $p |- ( ( ( -. v5 -> c4 ) -> c9 ) -> ( v6 -> ( ( -. c5 -> ( ( v1 -> c2 ) -> -. c5 ) ) -> ( v3 -> ( ( ( -. v1 -> ( c4 -> c6 ) ) -> -. ( c4 -> v4 ) ) -> ( ( ( v5 -> v4 ) -> ( v7 -> c3 ) ) -> -. ( ( v8 -> v6 ) -> ( v8 -> v6 ) ) ) ) ) ) ) ) $=
+      ( wc5 wn wc2 wi wc4 wc6 wc3 wc9 ax-g0 ax-1 ax-mp ) EHIAJKHIKKZBAILMKKLCKI
+      KZDCKZFNKZKGEKZUCKIKZKZKZKZKZDILKOKZUHKUGUHUFUGUEUFUDUEUCUCUBUAPUDTQRUEBQ
+      RUFSQRUGEQRUHUIQR $.
+  th47 $p |- ( ( c0 -> v3 ) -> ( v8 -> ( v8 -> ( c6 -> ( -. c3 -> ( ( c1 -> v1 ) -> ( c8 -> ( -. -. c3 -> -. ( ( c1 -> v1 ) -> ( c1 -> v1 ) ) ) ) ) ) ) ) ) ) $=
+      ( wv6 wi wc0 wc6 wc3 wn wc1 wc8 ax-1 ax-g7 ax-mp ) DDDEEZFBEZCCGHIZJAEZKQ
+      IRREIEZEZEZEZEZEZEZEZDDLUFOUFEUEUFUDUEUCUDUBUCUAUBTUASTQRMSKLNTRLNUAQLNUB
+      GLNUCCLNUDCLNUEPLNUFOLNN $.
+  th48 $p |- ( ( v5 -> ( v0 -> v8 ) ) -> ( v0 -> ( ( ( ( c8 -> v7 ) -> ( v2 -> c9 ) ) -> v5 ) -> ( ( v0 -> ( ( v2 -> c6 ) -> ( v7 -> v4 ) ) ) -> ( ( v0 -> ( ( v2 -> c6 ) -> ( v7 -> v4 ) ) ) -> -. ( ( ( c8 -> c0 ) -> v0 ) -> ( -. c6 -> -. c6 ) ) ) ) ) ) ) $=
+      ( wc8 wi wc9 wc6 wc0 wn ax-g8 ax-1 ax-mp ) AGEHBIHHDHZABJHECHHHZQGKHZAHJL
+      ZSHHLZHZHZHZHZDAFHHZUDHUCUDUBUCUAUBTUARSAMTQNOUAQNOUBPNOUCANOUDUENO $.
+  th49 $p |- ( -. v7 -> ( c9 -> ( ( ( ( c7 -> c8 ) -> v1 ) -> ( ( v7 -> c5 ) -> -. v7 ) ) -> c9 ) ) ) $=
+      ( wv9 wi wn wc9 wc7 wc8 wc5 ax-1 ax-g2 ax-mp ) CCCDDZBEZFGHDADBIDBEDDZFDZ
+      DZDZCCJRMRDQRPQFPFKFOJLPFJLQNJLRMJLL $.
+  th50 $p |- ( ( v6 -> c1 ) -> ( v5 -> ( ( ( -. v7 -> ( v1 -> v7 ) ) -> ( ( c2 -> c3 ) -> v3 ) ) -> ( ( ( -. c6 -> c7 ) -> ( v7 -> ( c1 -> v9 ) ) ) -> ( v5 -> ( -. -. v4 -> ( ( v2 -> v3 ) -> ( v2 -> v3 ) ) ) ) ) ) ) ) $=
+      ( wn wi wc2 wc3 wc6 wc7 wc1 ax-g6 ax-1 ax-mp ) EGIAGJJKLJCJJZMINJGOHJJJZE
+      DIIZBCJZUBJZJZJZJZJZJZFOJZUHJUGUHUFUGUEUFUDUEUCUDUBUCUBPUBUBQRUCUAQRUDEQR
+      UETQRUFSQRUGEQRUHUIQR $.
+  th51 $p |- ( ( ( c4 -> v4 ) -> ( -. v9 -> c2 ) ) -> ( ( ( ( v3 -> c0 ) -> ( v9 -> v3 ) ) -> v4 ) -> ( c7 -> ( v3 -> ( ( ( v2 -> -. v0 ) -> v7 ) -> ( ( c8 -> ( ( v9 -> v6 ) -> ( v0 -> c7 ) ) ) -> ( ( ( -. v8 -> ( c1 -> v9 ) ) -> ( ( v6 -> v7 ) -> ( v0 -> c9 ) ) ) -> ( -. ( ( v7 -> v9 ) -> c5 ) -> ( ( c1 -> c1 ) -> ( v6 -> ( ( ( -. c1 -> ( v3 -> c1 ) ) -> ( ( c2 -> c3 ) -> c1 ) ) -> ( ( ( -. c6 -> c7 ) -> ( c1 -> ( c1 -> c7 ) ) ) -> ( v6 -> ( -. -. c7 -> ( ( c7 -> c1 ) -> ( c7 -> c1 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc0 wi wc7 wn wc8 wc1 wc9 wc5 wc2 wc3 wc6 wc4 th50 ax-1 ax-mp )
+      CIJHCJJDJZKCBALJFJZMHEJAKJJJZGLNHJJEFJAOJJJZFHJPJLZNNJENLCNJJQRJNJJSLKJNN
+      KJJJEKLLKNJKNJJJJJJJJZJZJZJZJZJZJZJZTDJHLQJJZUPJUOUPUNUOUMUNULUMUKULUJUKU
+      IUJCKNKENNKUAUIUHUBUCUJUGUBUCUKUFUBUCULUEUBUCUMCUBUCUNKUBUCUOUDUBUCUPUQUB
+      UC $.
+  th52 $p |- ( ( ( ( v4 -> c3 ) -> -. v0 ) -> c3 ) -> ( ( ( ( v8 -> v3 ) -> v2 ) -> ( ( c4 -> c9 ) -> ( v5 -> c1 ) ) ) -> v5 ) ) $=
+      ( wi wc4 wc9 wc1 wc3 wn ax-g6 ax-1 ax-mp ) FCGBGHIGEJGGGZEGZDKGALGKGZQGEQ
+      EMEPNOQRNO $.
+  th53 $p |- ( v8 -> ( -. ( v1 -> v7 ) -> -. ( -. v4 -> -. v4 ) ) ) $=
+      ( wi wn ax-g7 ax-1 ax-mp ) ACEZFBFZKEFEZDLEJKGLDHI $.
+  th54 $p |- ( ( v4 -> v3 ) -> ( -. v7 -> ( ( ( ( v9 -> v2 ) -> ( c3 -> v0 ) ) -> -. v1 ) -> ( v4 -> ( c4 -> ( ( -. ( c4 -> c3 ) -> v8 ) -> ( -. ( ( v1 -> c7 ) -> ( v1 -> c7 ) ) -> ( -. -. v6 -> ( c4 -> -. v6 ) ) ) ) ) ) ) ) ) $=
+      wv7 wn wv9 wv2 wi wc3 wv0 wi wi wv1 wn wi wv4 wc4 wc4 wc3 wi wn wv8 wi
+      wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4 wv6 wn wi wi wi wi wi wi wi wi
+      wv4 wv3 wi wv7 wn wv9 wv2 wi wc3 wv0 wi wi wv1 wn wi wv4 wc4 wc4 wc3 wi
+      wn wv8 wi wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4 wv6 wn wi wi wi wi wi
+      wi wi wi wi wv9 wv2 wi wc3 wv0 wi wi wv1 wn wi wv4 wc4 wc4 wc3 wi wn wv8
+      wi wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4 wv6 wn wi wi wi wi wi wi wi
+      wv7 wn wv9 wv2 wi wc3 wv0 wi wi wv1 wn wi wv4 wc4 wc4 wc3 wi wn wv8 wi
+      wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4 wv6 wn wi wi wi wi wi wi wi wi
+      wv4 wc4 wc4 wc3 wi wn wv8 wi wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4
+      wv6 wn wi wi wi wi wi wi wv9 wv2 wi wc3 wv0 wi wi wv1 wn wi wv4 wc4 wc4
+      wc3 wi wn wv8 wi wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4 wv6 wn wi wi
+      wi wi wi wi wi wc4 wc4 wc3 wi wn wv8 wi wv1 wc7 wi wv1 wc7 wi wi wn wv6
+      wn wn wc4 wv6 wn wi wi wi wi wi wv4 wc4 wc4 wc3 wi wn wv8 wi wv1 wc7 wi
+      wv1 wc7 wi wi wn wv6 wn wn wc4 wv6 wn wi wi wi wi wi wi wc4 wc3 wi wn wv8
+      wi wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4 wv6 wn wi wi wi wi wc4 wc4
+      wc3 wi wn wv8 wi wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4 wv6 wn wi wi
+      wi wi wi wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4 wv6 wn wi wi wi wc4
+      wc3 wi wn wv8 wi wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4 wv6 wn wi wi
+      wi wi wv1 wc7 wi wv1 wc7 wi wc4 wv6 wn ax-g9 wv1 wc7 wi wv1 wc7 wi wi wn
+      wv6 wn wn wc4 wv6 wn wi wi wi wc4 wc3 wi wn wv8 wi ax-1 ax-mp wc4 wc3 wi
+      wn wv8 wi wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4 wv6 wn wi wi wi wi
+      wc4 ax-1 ax-mp wc4 wc4 wc3 wi wn wv8 wi wv1 wc7 wi wv1 wc7 wi wi wn wv6
+      wn wn wc4 wv6 wn wi wi wi wi wi wv4 ax-1 ax-mp wv4 wc4 wc4 wc3 wi wn wv8
+      wi wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4 wv6 wn wi wi wi wi wi wi wv9
+      wv2 wi wc3 wv0 wi wi wv1 wn wi ax-1 ax-mp wv9 wv2 wi wc3 wv0 wi wi wv1 wn
+      wi wv4 wc4 wc4 wc3 wi wn wv8 wi wv1 wc7 wi wv1 wc7 wi wi wn wv6 wn wn wc4
+      wv6 wn wi wi wi wi wi wi wi wv7 wn ax-1 ax-mp wv7 wn wv9 wv2 wi wc3 wv0
+      wi wi wv1 wn wi wv4 wc4 wc4 wc3 wi wn wv8 wi wv1 wc7 wi wv1 wc7 wi wi wn
+      wv6 wn wn wc4 wv6 wn wi wi wi wi wi wi wi wi wv4 wv3 wi ax-1 ax-mp $.
+  th55 $p |- ( ( ( ( c0 -> v9 ) -> ( v8 -> v5 ) ) -> ( ( c3 -> c8 ) -> ( v3 -> c8 ) ) ) -> ( ( ( ( v9 -> v1 ) -> v7 ) -> v1 ) -> ( v2 -> ( ( ( ( c0 -> v9 ) -> ( v8 -> v5 ) ) -> ( ( c3 -> c8 ) -> ( v3 -> c8 ) ) ) -> ( ( -. v1 -> c0 ) -> ( -. ( c4 -> c4 ) -> v9 ) ) ) ) ) ) $=
+      ( wi wc0 wc3 wc8 wn wc4 ax-g1 ax-1 ax-mp ) GAHEHAHZBIGHFDHHJKHCKHHHZALIHZ
+      MMHLGHZHZHZHZHZRUDHUCUDUBUCUAUBTUAMGMNTSOPUAROPUBBOPUCQOPUDROP $.
+  th56 $p |- ( v7 -> ( ( c3 -> ( ( v7 -> v0 ) -> ( v1 -> v3 ) ) ) -> ( ( ( v5 -> v8 ) -> ( v5 -> v8 ) ) -> -. ( v8 -> ( c6 -> v5 ) ) ) ) ) $=
+      wc3 wv7 wv0 wi wv1 wv3 wi wi wi wv5 wv8 wi wv5 wv8 wi wi wv8 wc6 wv5 wi
+      wi wn wi wi wv7 wc3 wv7 wv0 wi wv1 wv3 wi wi wi wv5 wv8 wi wv5 wv8 wi wi
+      wv8 wc6 wv5 wi wi wn wi wi wi wv5 wv8 wi wv5 wv8 wi wi wv8 wc6 wv5 wi wi
+      wn wi wc3 wv7 wv0 wi wv1 wv3 wi wi wi wv5 wv8 wi wv5 wv8 wi wi wv8 wc6
+      wv5 wi wi wn wi wi wv8 wc6 wv5 wi wv5 wv8 wi wv5 wv8 wi ax-g0 wv5 wv8 wi
+      wv5 wv8 wi wi wv8 wc6 wv5 wi wi wn wi wc3 wv7 wv0 wi wv1 wv3 wi wi wi
+      ax-1 ax-mp wc3 wv7 wv0 wi wv1 wv3 wi wi wi wv5 wv8 wi wv5 wv8 wi wi wv8
+      wc6 wv5 wi wi wn wi wi wv7 ax-1 ax-mp $.
+  th57 $p |- ( ( -. ( c8 -> v0 ) -> v2 ) -> ( ( ( ( v9 -> v2 ) -> ( v9 -> v6 ) ) -> ( v0 -> ( v3 -> v0 ) ) ) -> ( c2 -> ( v1 -> ( ( ( ( c4 -> v3 ) -> c8 ) -> -. ( c9 -> v4 ) ) -> ( ( c9 -> v4 ) -> -. ( c9 -> v4 ) ) ) ) ) ) ) $=
+      wv9 wv2 wi wv9 wv6 wi wi wv0 wv3 wv0 wi wi wi wc2 wv1 wc4 wv3 wi wc8 wi
+      wc9 wv4 wi wn wi wc9 wv4 wi wc9 wv4 wi wn wi wi wi wi wi wc8 wv0 wi wn
+      wv2 wi wv9 wv2 wi wv9 wv6 wi wi wv0 wv3 wv0 wi wi wi wc2 wv1 wc4 wv3 wi
+      wc8 wi wc9 wv4 wi wn wi wc9 wv4 wi wc9 wv4 wi wn wi wi wi wi wi wi wc2
+      wv1 wc4 wv3 wi wc8 wi wc9 wv4 wi wn wi wc9 wv4 wi wc9 wv4 wi wn wi wi wi
+      wi wv9 wv2 wi wv9 wv6 wi wi wv0 wv3 wv0 wi wi wi wc2 wv1 wc4 wv3 wi wc8
+      wi wc9 wv4 wi wn wi wc9 wv4 wi wc9 wv4 wi wn wi wi wi wi wi wv1 wc4 wv3
+      wi wc8 wi wc9 wv4 wi wn wi wc9 wv4 wi wc9 wv4 wi wn wi wi wi wc2 wv1 wc4
+      wv3 wi wc8 wi wc9 wv4 wi wn wi wc9 wv4 wi wc9 wv4 wi wn wi wi wi wi wc4
+      wv3 wi wc8 wi wc9 wv4 wi wn wi wc9 wv4 wi wc9 wv4 wi wn wi wi wv1 wc4 wv3
+      wi wc8 wi wc9 wv4 wi wn wi wc9 wv4 wi wc9 wv4 wi wn wi wi wi wc9 wv4 wi
+      wc9 wv4 wi wn wi wc4 wv3 wi wc8 wi wc9 wv4 wi wn wi wc9 wv4 wi wc9 wv4 wi
+      wn wi wi wc9 wv4 wi wn wc9 wv4 wi wc9 wv4 wi wn wi wc9 wv4 wi ax-g5 wc9
+      wv4 wi wn wc9 wv4 wi ax-1 ax-mp wc9 wv4 wi wc9 wv4 wi wn wi wc4 wv3 wi
+      wc8 wi wc9 wv4 wi wn wi ax-1 ax-mp wc4 wv3 wi wc8 wi wc9 wv4 wi wn wi wc9
+      wv4 wi wc9 wv4 wi wn wi wi wv1 ax-1 ax-mp wv1 wc4 wv3 wi wc8 wi wc9 wv4
+      wi wn wi wc9 wv4 wi wc9 wv4 wi wn wi wi wi wc2 ax-1 ax-mp wc2 wv1 wc4 wv3
+      wi wc8 wi wc9 wv4 wi wn wi wc9 wv4 wi wc9 wv4 wi wn wi wi wi wi wv9 wv2
+      wi wv9 wv6 wi wi wv0 wv3 wv0 wi wi wi ax-1 ax-mp wv9 wv2 wi wv9 wv6 wi wi
+      wv0 wv3 wv0 wi wi wi wc2 wv1 wc4 wv3 wi wc8 wi wc9 wv4 wi wn wi wc9 wv4
+      wi wc9 wv4 wi wn wi wi wi wi wi wc8 wv0 wi wn wv2 wi ax-1 ax-mp $.
+  th58 $p |- ( ( ( v0 -> v1 ) -> -. ( v4 -> v2 ) ) -> ( ( ( c6 -> -. v1 ) -> ( ( v5 -> c9 ) -> ( c4 -> v3 ) ) ) -> ( -. ( -. v9 -> ( v0 -> v6 ) ) -> ( ( -. ( c5 -> c1 ) -> ( -. v0 -> -. v9 ) ) -> ( ( c5 -> ( ( c5 -> c5 ) -> ( c4 -> c5 ) ) ) -> ( c5 -> ( ( c5 -> ( ( c5 -> c5 ) -> ( c4 -> c5 ) ) ) -> ( v2 -> ( c9 -> ( ( ( ( v2 -> v2 ) -> ( v2 -> c2 ) ) -> ( -. c8 -> ( v2 -> c0 ) ) ) -> ( ( ( ( c5 -> c9 ) -> ( v2 -> v2 ) ) -> ( ( c5 -> v2 ) -> v2 ) ) -> ( -. c9 -> ( -. ( ( c5 -> v2 ) -> ( c9 -> c5 ) ) -> ( c5 -> c5 ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc6 wn wi wc9 wc4 wc5 wc1 wc2 wc8 wc0 th11 ax-1 ax-mp ) IBJKFLKMDKKKZHJ
+      AGKKJZNOKJAJHJKKZNNNKMNKKKNNNNKMNKKKCLCCKCPKKQJCRKKKNLKCCKKNCKCKKLJNCKLNK
+      KJNNKKKKKKKKKKZKZKZKZABKECKJKZUHKUGUHUFUGUEUFCNNCCNNCCPSUEUDTUAUFUCTUAUGU
+      BTUAUHUITUA $.
+  th59 $p |- ( v3 -> ( ( -. ( c8 -> v8 ) -> ( ( v1 -> v0 ) -> v9 ) ) -> ( ( v6 -> v6 ) -> ( ( v6 -> v6 ) -> ( v5 -> ( v5 -> ( ( ( ( v9 -> v0 ) -> ( c9 -> c8 ) ) -> -. ( v2 -> c6 ) ) -> ( v6 -> v6 ) ) ) ) ) ) ) ) $=
+      ( wc8 wi wn wc9 wc6 ax-g6 ax-1 ax-mp ) IGJKBAJHJJZFFJZREEHAJLIJJCMJKJZRJZ
+      JZJZJZJZJZDUEJUDUEUCUDUBUCUAUBTUARTRNRSOPTEOPUAEOPUBROPUCROPUDQOPUEDOP $.
+  th60 $p |- ( ( v6 -> ( v7 -> v4 ) ) -> ( ( c6 -> c2 ) -> ( ( ( ( v6 -> v3 ) -> ( v3 -> c6 ) ) -> ( ( v5 -> c7 ) -> c8 ) ) -> ( -. ( v6 -> c4 ) -> ( ( ( ( v5 -> v9 ) -> -. c0 ) -> ( ( c0 -> v1 ) -> ( v2 -> v9 ) ) ) -> ( ( v0 -> ( c8 -> ( v1 -> v0 ) ) ) -> -. ( ( ( v8 -> v9 ) -> ( c6 -> c2 ) ) -> ( ( v8 -> v9 ) -> ( v8 -> v9 ) ) ) ) ) ) ) ) ) $=
+      ( wc6 wc2 wi wc7 wc8 wc4 wn wc0 ax-g8 ax-1 ax-mp ) KLMZGDMDKMMFNMOMMZGPMQ
+      ZFJMRQMRBMCJMMMZAOBAMMMZIJMZUBMUGUGMMQZMZMZMZMZMZGHEMMZUMMULUMUKULUJUKUIU
+      JUHUIUGUGUBSUHUFTUAUIUETUAUJUDTUAUKUCTUAULUBTUAUMUNTUA $.
+  th61 $p |- ( ( -. c3 -> ( c4 -> ( v6 -> v7 ) ) ) -> ( -. ( ( c3 -> v0 ) -> ( v4 -> v5 ) ) -> ( ( c7 -> ( ( v4 -> v2 ) -> c2 ) ) -> ( c0 -> ( ( ( ( v0 -> v5 ) -> -. v0 ) -> ( ( v6 -> c5 ) -> v0 ) ) -> ( -. ( ( v9 -> v7 ) -> c6 ) -> -. ( c6 -> -. v5 ) ) ) ) ) ) ) $=
+      ( wv8 wi wc3 wn wc4 wc7 wc2 wc0 wc5 wc6 ax-1 ax-g3 ax-mp ) HHHIIZJKLEFIII
+      ZJAICDIIKZMCBINIIZOADIAKIEPIAIIZGFIZQIKQDKZIKIZIZIZIZIZIZHHRUMUAUMIULUMUK
+      ULUJUKUIUJUHUIUGQUFQSUHUERTUIORTUJUDRTUKUCRTULUBRTUMUARTT $.
+  th62 $p |- ( ( ( ( v2 -> v9 ) -> -. v8 ) -> ( ( c6 -> v3 ) -> ( v8 -> v0 ) ) ) -> ( -. ( v2 -> v5 ) -> ( v8 -> ( v8 -> ( -. v8 -> ( ( -. ( c9 -> v8 ) -> v8 ) -> ( -. v8 -> -. v8 ) ) ) ) ) ) ) $=
+      ( wv7 wi wn wc6 wc9 ax-1 th31 ax-mp ) GGGHHZBFHEIHJCHEAHHHZBDHIZEEEIKEHIE
+      HEIEIHHHZHZHZHZHZGGLUBOUBHUAUBTUASTRSEEKMRELNSELNTQLNUAPLNUBOLNN $.
+  th63 $p |- ( ( v8 -> ( ( v4 -> v5 ) -> -. c8 ) ) -> ( ( ( -. v1 -> v8 ) -> v2 ) -> ( ( ( ( c6 -> v0 ) -> ( v3 -> v3 ) ) -> ( v4 -> ( v7 -> c3 ) ) ) -> ( ( ( ( v3 -> v6 ) -> -. v8 ) -> ( ( v3 -> v0 ) -> ( v0 -> v9 ) ) ) -> ( c2 -> ( c3 -> ( ( c7 -> v5 ) -> ( ( v0 -> v8 ) -> ( ( v3 -> ( c7 -> v5 ) ) -> -. ( ( v9 -> v3 ) -> ( v0 -> v8 ) ) ) ) ) ) ) ) ) ) ) $=
+      wv1 wn wv8 wi wv2 wi wc6 wv0 wi wv3 wv3 wi wi wv4 wv7 wc3 wi wi wi wv3
+      wv6 wi wv8 wn wi wv3 wv0 wi wv0 wv9 wi wi wi wc2 wc3 wc7 wv5 wi wv0 wv8
+      wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn wi wi wi wi wi wi wi wi
+      wv8 wv4 wv5 wi wc8 wn wi wi wv1 wn wv8 wi wv2 wi wc6 wv0 wi wv3 wv3 wi wi
+      wv4 wv7 wc3 wi wi wi wv3 wv6 wi wv8 wn wi wv3 wv0 wi wv0 wv9 wi wi wi wc2
+      wc3 wc7 wv5 wi wv0 wv8 wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn
+      wi wi wi wi wi wi wi wi wi wc6 wv0 wi wv3 wv3 wi wi wv4 wv7 wc3 wi wi wi
+      wv3 wv6 wi wv8 wn wi wv3 wv0 wi wv0 wv9 wi wi wi wc2 wc3 wc7 wv5 wi wv0
+      wv8 wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn wi wi wi wi wi wi wi
+      wv1 wn wv8 wi wv2 wi wc6 wv0 wi wv3 wv3 wi wi wv4 wv7 wc3 wi wi wi wv3
+      wv6 wi wv8 wn wi wv3 wv0 wi wv0 wv9 wi wi wi wc2 wc3 wc7 wv5 wi wv0 wv8
+      wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn wi wi wi wi wi wi wi wi
+      wv3 wv6 wi wv8 wn wi wv3 wv0 wi wv0 wv9 wi wi wi wc2 wc3 wc7 wv5 wi wv0
+      wv8 wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn wi wi wi wi wi wi
+      wc6 wv0 wi wv3 wv3 wi wi wv4 wv7 wc3 wi wi wi wv3 wv6 wi wv8 wn wi wv3
+      wv0 wi wv0 wv9 wi wi wi wc2 wc3 wc7 wv5 wi wv0 wv8 wi wv3 wc7 wv5 wi wi
+      wv9 wv3 wi wv0 wv8 wi wi wn wi wi wi wi wi wi wi wc2 wc3 wc7 wv5 wi wv0
+      wv8 wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn wi wi wi wi wi wv3
+      wv6 wi wv8 wn wi wv3 wv0 wi wv0 wv9 wi wi wi wc2 wc3 wc7 wv5 wi wv0 wv8
+      wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn wi wi wi wi wi wi wc3
+      wc7 wv5 wi wv0 wv8 wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn wi wi
+      wi wi wc2 wc3 wc7 wv5 wi wv0 wv8 wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8
+      wi wi wn wi wi wi wi wi wc7 wv5 wi wv0 wv8 wi wv3 wc7 wv5 wi wi wv9 wv3
+      wi wv0 wv8 wi wi wn wi wi wi wc3 wc7 wv5 wi wv0 wv8 wi wv3 wc7 wv5 wi wi
+      wv9 wv3 wi wv0 wv8 wi wi wn wi wi wi wi wv0 wv8 wi wv3 wc7 wv5 wi wi wv9
+      wv3 wi wv0 wv8 wi wi wn wi wi wc7 wv5 wi wv0 wv8 wi wv3 wc7 wv5 wi wi wv9
+      wv3 wi wv0 wv8 wi wi wn wi wi wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi
+      wi wn wi wv0 wv8 wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn wi wi
+      wv9 wv3 wi wv0 wv8 wi wc7 wv5 wi wv3 ax-g0 wv3 wc7 wv5 wi wi wv9 wv3 wi
+      wv0 wv8 wi wi wn wi wv0 wv8 wi ax-1 ax-mp wv0 wv8 wi wv3 wc7 wv5 wi wi
+      wv9 wv3 wi wv0 wv8 wi wi wn wi wi wc7 wv5 wi ax-1 ax-mp wc7 wv5 wi wv0
+      wv8 wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn wi wi wi wc3 ax-1
+      ax-mp wc3 wc7 wv5 wi wv0 wv8 wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi
+      wi wn wi wi wi wi wc2 ax-1 ax-mp wc2 wc3 wc7 wv5 wi wv0 wv8 wi wv3 wc7
+      wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn wi wi wi wi wi wv3 wv6 wi wv8 wn wi
+      wv3 wv0 wi wv0 wv9 wi wi wi ax-1 ax-mp wv3 wv6 wi wv8 wn wi wv3 wv0 wi
+      wv0 wv9 wi wi wi wc2 wc3 wc7 wv5 wi wv0 wv8 wi wv3 wc7 wv5 wi wi wv9 wv3
+      wi wv0 wv8 wi wi wn wi wi wi wi wi wi wc6 wv0 wi wv3 wv3 wi wi wv4 wv7
+      wc3 wi wi wi ax-1 ax-mp wc6 wv0 wi wv3 wv3 wi wi wv4 wv7 wc3 wi wi wi wv3
+      wv6 wi wv8 wn wi wv3 wv0 wi wv0 wv9 wi wi wi wc2 wc3 wc7 wv5 wi wv0 wv8
+      wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn wi wi wi wi wi wi wi wv1
+      wn wv8 wi wv2 wi ax-1 ax-mp wv1 wn wv8 wi wv2 wi wc6 wv0 wi wv3 wv3 wi wi
+      wv4 wv7 wc3 wi wi wi wv3 wv6 wi wv8 wn wi wv3 wv0 wi wv0 wv9 wi wi wi wc2
+      wc3 wc7 wv5 wi wv0 wv8 wi wv3 wc7 wv5 wi wi wv9 wv3 wi wv0 wv8 wi wi wn
+      wi wi wi wi wi wi wi wi wv8 wv4 wv5 wi wc8 wn wi wi ax-1 ax-mp $.
+  ${
+    $d v2 v9 $.
+    $d v7 v9 $.
+    th64 $p |- ( ( ( ( c9 -> v0 ) -> ( v4 -> v5 ) ) -> ( ( v0 -> v6 ) -> v8 ) ) -> ( ( ( v0 -> ( v2 -> v7 ) ) -> v4 ) -> ( c4 -> ( -. v9 -> ( ( v7 -> v2 ) -> ( -. ( ( v7 -> v2 ) -> -. v9 ) -> -. v9 ) ) ) ) ) ) $=
+      ( wi wc4 wn wc9 ax-g1 ax-1 ax-mp ) ABFIICIZJHKZFBIZRQIKQIZIZIZIZIZLAICDII
+      AEIGIIZUCIUBUCUAUBTUASTQQRMSRNOTQNOUAJNOUBPNOUCUDNO $.
+  $}
+  th65 $p |- ( c7 -> ( ( -. ( c2 -> c0 ) -> -. c4 ) -> ( ( v7 -> ( ( c8 -> v8 ) -> ( v0 -> v7 ) ) ) -> ( -. ( ( v7 -> c9 ) -> -. v0 ) -> ( -. ( ( c1 -> v2 ) -> ( v5 -> v1 ) ) -> ( ( v3 -> ( c2 -> ( c0 -> c5 ) ) ) -> ( v0 -> ( c6 -> ( c6 -> ( -. ( ( v0 -> c3 ) -> ( c8 -> c6 ) ) -> ( ( ( ( c6 -> v5 ) -> c0 ) -> ( ( v0 -> c5 ) -> ( v3 -> v3 ) ) ) -> ( ( c1 -> ( c7 -> c5 ) ) -> ( c9 -> ( -. ( ( v0 -> c6 ) -> ( c6 -> v3 ) ) -> ( -. ( ( v0 -> c6 ) -> ( c6 -> v3 ) ) -> ( v0 -> c5 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc2 wc0 wi wn wc4 wc8 wc9 wc1 wc5 wc6 wc3 wc7 th39 ax-1 ax-mp )
+      HIJKLKJZFMGJAFJJJZFNJAKJKZOCJEBJJKZDHIPJJJZAQQARJMQJJKQEJIJAPJDDJJJOSPJJN
+      AQJQDJJKAQJQDJJKAPJJJJJJJJJZJZJZJZJZJZJZSUNJUMUNULUMUKULUJUKUIUJUHUISEPDA
+      QDTUHAUAUBUIUGUAUBUJUFUAUBUKUEUAUBULUDUAUBUMUCUAUBUNSUAUB $.
+  th66 $p |- ( ( ( ( v9 -> v0 ) -> ( v6 -> c9 ) ) -> c3 ) -> ( ( ( ( v9 -> v0 ) -> ( v6 -> c9 ) ) -> c3 ) -> ( -. ( ( v1 -> v6 ) -> ( v8 -> v8 ) ) -> ( v6 -> ( ( v7 -> v9 ) -> c7 ) ) ) ) ) $=
+      ( wi wc9 wc3 wn wc7 ax-g4 ax-1 ax-mp ) FAGCHGGIGZBCGEEGGJZCDFGZKGZGZGZGZO
+      UAGTUASTRSKRKLKQMNRCMNSPMNTOMNUAOMN $.
+  th67 $p |- ( c3 -> ( ( -. c6 -> -. ( v7 -> v3 ) ) -> ( ( ( ( v2 -> c2 ) -> -. c7 ) -> v3 ) -> ( ( ( ( v5 -> v4 ) -> -. v3 ) -> -. ( v6 -> v0 ) ) -> ( v0 -> ( c1 -> ( -. v0 -> ( -. v0 -> ( -. ( v0 -> c5 ) -> -. ( ( c6 -> c6 ) -> v0 ) ) ) ) ) ) ) ) ) ) $=
+      wc6 wn wv7 wv3 wi wn wi wv2 wc2 wi wc7 wn wi wv3 wi wv5 wv4 wi wv3 wn wi
+      wv6 wv0 wi wn wi wv0 wc1 wv0 wn wv0 wn wv0 wc5 wi wn wc6 wc6 wi wv0 wi wn
+      wi wi wi wi wi wi wi wi wc3 wc6 wn wv7 wv3 wi wn wi wv2 wc2 wi wc7 wn wi
+      wv3 wi wv5 wv4 wi wv3 wn wi wv6 wv0 wi wn wi wv0 wc1 wv0 wn wv0 wn wv0
+      wc5 wi wn wc6 wc6 wi wv0 wi wn wi wi wi wi wi wi wi wi wi wv2 wc2 wi wc7
+      wn wi wv3 wi wv5 wv4 wi wv3 wn wi wv6 wv0 wi wn wi wv0 wc1 wv0 wn wv0 wn
+      wv0 wc5 wi wn wc6 wc6 wi wv0 wi wn wi wi wi wi wi wi wi wc6 wn wv7 wv3 wi
+      wn wi wv2 wc2 wi wc7 wn wi wv3 wi wv5 wv4 wi wv3 wn wi wv6 wv0 wi wn wi
+      wv0 wc1 wv0 wn wv0 wn wv0 wc5 wi wn wc6 wc6 wi wv0 wi wn wi wi wi wi wi
+      wi wi wi wv5 wv4 wi wv3 wn wi wv6 wv0 wi wn wi wv0 wc1 wv0 wn wv0 wn wv0
+      wc5 wi wn wc6 wc6 wi wv0 wi wn wi wi wi wi wi wi wv2 wc2 wi wc7 wn wi wv3
+      wi wv5 wv4 wi wv3 wn wi wv6 wv0 wi wn wi wv0 wc1 wv0 wn wv0 wn wv0 wc5 wi
+      wn wc6 wc6 wi wv0 wi wn wi wi wi wi wi wi wi wv0 wc1 wv0 wn wv0 wn wv0
+      wc5 wi wn wc6 wc6 wi wv0 wi wn wi wi wi wi wi wv5 wv4 wi wv3 wn wi wv6
+      wv0 wi wn wi wv0 wc1 wv0 wn wv0 wn wv0 wc5 wi wn wc6 wc6 wi wv0 wi wn wi
+      wi wi wi wi wi wv0 wc1 wc6 wv0 wv0 th17 wv0 wc1 wv0 wn wv0 wn wv0 wc5 wi
+      wn wc6 wc6 wi wv0 wi wn wi wi wi wi wi wv5 wv4 wi wv3 wn wi wv6 wv0 wi wn
+      wi ax-1 ax-mp wv5 wv4 wi wv3 wn wi wv6 wv0 wi wn wi wv0 wc1 wv0 wn wv0 wn
+      wv0 wc5 wi wn wc6 wc6 wi wv0 wi wn wi wi wi wi wi wi wv2 wc2 wi wc7 wn wi
+      wv3 wi ax-1 ax-mp wv2 wc2 wi wc7 wn wi wv3 wi wv5 wv4 wi wv3 wn wi wv6
+      wv0 wi wn wi wv0 wc1 wv0 wn wv0 wn wv0 wc5 wi wn wc6 wc6 wi wv0 wi wn wi
+      wi wi wi wi wi wi wc6 wn wv7 wv3 wi wn wi ax-1 ax-mp wc6 wn wv7 wv3 wi wn
+      wi wv2 wc2 wi wc7 wn wi wv3 wi wv5 wv4 wi wv3 wn wi wv6 wv0 wi wn wi wv0
+      wc1 wv0 wn wv0 wn wv0 wc5 wi wn wc6 wc6 wi wv0 wi wn wi wi wi wi wi wi wi
+      wi wc3 ax-1 ax-mp $.
+  th68 $p |- ( v4 -> ( c0 -> ( ( ( -. v4 -> c8 ) -> ( ( c1 -> c8 ) -> ( v4 -> v3 ) ) ) -> ( ( c1 -> c6 ) -> ( ( ( ( c8 -> c9 ) -> -. v3 ) -> ( ( v9 -> c6 ) -> c9 ) ) -> ( ( ( v4 -> c6 ) -> -. ( c5 -> v9 ) ) -> ( c7 -> ( ( -. c8 -> ( ( c6 -> c6 ) -> ( c6 -> v4 ) ) ) -> ( ( ( c6 -> ( v3 -> v4 ) ) -> ( ( c6 -> c5 ) -> ( v4 -> v3 ) ) ) -> ( c6 -> ( -. ( ( c1 -> c6 ) -> ( v4 -> c6 ) ) -> -. ( ( v4 -> c6 ) -> ( c8 -> c8 ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc0 wn wc8 wi wc1 wc6 wc9 wc5 wc7 th38 ax-1 ax-mp ) DBEFGHFGBAGGGHIGFJG
+      AEGCIGJGGBIGKCGEGLFEIIGIBGGGIABGGIKGBAGGGIHIGBIGGEBIGFFGGEGGGGGGGGGZGZBQG
+      PQIABCBIFIMPDNOQBNO $.
+  th69 $p |- ( c1 -> ( ( ( v8 -> c8 ) -> ( v3 -> ( v8 -> v9 ) ) ) -> ( -. -. ( v5 -> v4 ) -> ( ( c3 -> ( ( v2 -> v2 ) -> ( v3 -> v7 ) ) ) -> ( ( -. v6 -> ( v9 -> c8 ) ) -> -. ( ( v1 -> v7 ) -> ( v1 -> v7 ) ) ) ) ) ) ) $=
+      wv8 wc8 wi wv3 wv8 wv9 wi wi wi wv5 wv4 wi wn wn wc3 wv2 wv2 wi wv3 wv7
+      wi wi wi wv6 wn wv9 wc8 wi wi wv1 wv7 wi wv1 wv7 wi wi wn wi wi wi wi wc1
+      wv8 wc8 wi wv3 wv8 wv9 wi wi wi wv5 wv4 wi wn wn wc3 wv2 wv2 wi wv3 wv7
+      wi wi wi wv6 wn wv9 wc8 wi wi wv1 wv7 wi wv1 wv7 wi wi wn wi wi wi wi wi
+      wv5 wv4 wi wn wn wc3 wv2 wv2 wi wv3 wv7 wi wi wi wv6 wn wv9 wc8 wi wi wv1
+      wv7 wi wv1 wv7 wi wi wn wi wi wi wv8 wc8 wi wv3 wv8 wv9 wi wi wi wv5 wv4
+      wi wn wn wc3 wv2 wv2 wi wv3 wv7 wi wi wi wv6 wn wv9 wc8 wi wi wv1 wv7 wi
+      wv1 wv7 wi wi wn wi wi wi wi wc3 wv2 wv2 wi wv3 wv7 wi wi wi wv6 wn wv9
+      wc8 wi wi wv1 wv7 wi wv1 wv7 wi wi wn wi wi wv5 wv4 wi wn wn wc3 wv2 wv2
+      wi wv3 wv7 wi wi wi wv6 wn wv9 wc8 wi wi wv1 wv7 wi wv1 wv7 wi wi wn wi
+      wi wi wv6 wn wv9 wc8 wi wi wv1 wv7 wi wv1 wv7 wi wi wn wi wc3 wv2 wv2 wi
+      wv3 wv7 wi wi wi wv6 wn wv9 wc8 wi wi wv1 wv7 wi wv1 wv7 wi wi wn wi wi
+      wv1 wv7 wi wv1 wv7 wi wv9 wc8 wi wv6 wn ax-g0 wv6 wn wv9 wc8 wi wi wv1
+      wv7 wi wv1 wv7 wi wi wn wi wc3 wv2 wv2 wi wv3 wv7 wi wi wi ax-1 ax-mp wc3
+      wv2 wv2 wi wv3 wv7 wi wi wi wv6 wn wv9 wc8 wi wi wv1 wv7 wi wv1 wv7 wi wi
+      wn wi wi wv5 wv4 wi wn wn ax-1 ax-mp wv5 wv4 wi wn wn wc3 wv2 wv2 wi wv3
+      wv7 wi wi wi wv6 wn wv9 wc8 wi wi wv1 wv7 wi wv1 wv7 wi wi wn wi wi wi
+      wv8 wc8 wi wv3 wv8 wv9 wi wi wi ax-1 ax-mp wv8 wc8 wi wv3 wv8 wv9 wi wi
+      wi wv5 wv4 wi wn wn wc3 wv2 wv2 wi wv3 wv7 wi wi wi wv6 wn wv9 wc8 wi wi
+      wv1 wv7 wi wv1 wv7 wi wi wn wi wi wi wi wc1 ax-1 ax-mp $.
+  ${
+    $d v1 v7 $.
+    $d v3 v7 $.
+    th70 $p |- ( v7 -> ( v4 -> ( v6 -> ( ( ( v7 -> ( c6 -> v6 ) ) -> c2 ) -> ( v7 -> ( ( ( -. v7 -> c8 ) -> ( ( c1 -> v7 ) -> ( v7 -> v5 ) ) ) -> ( ( c1 -> v5 ) -> ( ( ( ( c8 -> c9 ) -> -. v5 ) -> ( ( v2 -> v4 ) -> c9 ) ) -> ( ( ( v3 -> v1 ) -> -. ( c5 -> v2 ) ) -> ( c7 -> ( ( -. c8 -> ( ( c6 -> v1 ) -> ( v5 -> v3 ) ) ) -> ( ( ( v1 -> ( v5 -> v3 ) ) -> ( ( v5 -> c5 ) -> ( v7 -> v5 ) ) ) -> ( v5 -> ( -. ( ( c1 -> v5 ) -> ( v3 -> v1 ) ) -> -. ( ( v3 -> v1 ) -> ( v7 -> v7 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc6 wi wc2 wn wc8 wc1 wc9 wc5 wc7 th38 ax-1 ax-mp ) DFGHFIIJIZGGKLIMGIG
+      EIIIMEILNIEKIBDINIICAIOBIKIPLKHAIECIIIAECIIEOIGEIIIEMEICAIIKCAIGGIIKIIIII
+      IIIIZIZIZIZIZGUEIUDUEUCUDUBUCUAUBAEGBCEGDQUAGRSUBTRSUCFRSUDDRSUEGRS $.
+  $}
+  th71 $p |- ( v9 -> ( ( c9 -> v2 ) -> ( ( v2 -> v4 ) -> ( v6 -> ( ( -. ( v5 -> v3 ) -> ( v9 -> v2 ) ) -> ( ( ( -. c4 -> ( v8 -> v0 ) ) -> ( v9 -> -. v9 ) ) -> ( c9 -> ( -. v3 -> ( -. ( c9 -> ( c9 -> v2 ) ) -> ( -. ( v2 -> v4 ) -> ( ( v2 -> v4 ) -> ( v2 -> v4 ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc9 wi wn wc4 ax-g9 ax-1 ax-mp ) IBJZBDJZFECJKHBJJZLKGAJJHHKJJZICKZIPJK
+      QKQQJJJZJZJZJZJZJZJZJZHUHJUGUHUFUGUEUFUDUEUCUDUBUCUAUBIPQQMUATNOUBINOUCSN
+      OUDRNOUEFNOUFQNOUGPNOUHHNO $.
+  th72 $p |- ( c0 -> ( ( ( ( v7 -> v8 ) -> v2 ) -> v8 ) -> ( v0 -> ( v5 -> ( ( -. ( c0 -> c7 ) -> -. ( c1 -> v0 ) ) -> ( v7 -> ( ( -. ( c0 -> c7 ) -> -. ( c1 -> v0 ) ) -> -. ( ( v7 -> ( v0 -> v3 ) ) -> ( ( v3 -> c6 ) -> ( v3 -> c6 ) ) ) ) ) ) ) ) ) ) $=
+      wv7 wv8 wi wv2 wi wv8 wi wv0 wv5 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wc0
+      wc7 wi wn wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi wv3 wc6 wi wv3 wc6 wi wi wi
+      wn wi wi wi wi wi wi wc0 wv7 wv8 wi wv2 wi wv8 wi wv0 wv5 wc0 wc7 wi wn
+      wc1 wv0 wi wn wi wv7 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi wv3
+      wc6 wi wv3 wc6 wi wi wi wn wi wi wi wi wi wi wi wv0 wv5 wc0 wc7 wi wn wc1
+      wv0 wi wn wi wv7 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi wv3 wc6
+      wi wv3 wc6 wi wi wi wn wi wi wi wi wi wv7 wv8 wi wv2 wi wv8 wi wv0 wv5
+      wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0
+      wv3 wi wi wv3 wc6 wi wv3 wc6 wi wi wi wn wi wi wi wi wi wi wv5 wc0 wc7 wi
+      wn wc1 wv0 wi wn wi wv7 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi
+      wv3 wc6 wi wv3 wc6 wi wi wi wn wi wi wi wi wv0 wv5 wc0 wc7 wi wn wc1 wv0
+      wi wn wi wv7 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi wv3 wc6 wi
+      wv3 wc6 wi wi wi wn wi wi wi wi wi wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wc0
+      wc7 wi wn wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi wv3 wc6 wi wv3 wc6 wi wi wi
+      wn wi wi wi wv5 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wc0 wc7 wi wn wc1 wv0
+      wi wn wi wv7 wv0 wv3 wi wi wv3 wc6 wi wv3 wc6 wi wi wi wn wi wi wi wi wv7
+      wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi wv3 wc6 wi wv3 wc6 wi wi
+      wi wn wi wi wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wc0 wc7 wi wn wc1 wv0 wi
+      wn wi wv7 wv0 wv3 wi wi wv3 wc6 wi wv3 wc6 wi wi wi wn wi wi wi wc0 wc7
+      wi wn wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi wv3 wc6 wi wv3 wc6 wi wi wi wn
+      wi wv7 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi wv3 wc6 wi wv3
+      wc6 wi wi wi wn wi wi wv7 wv0 wv3 wi wi wv3 wc6 wi wv3 wc6 wi wi wi wn
+      wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi wv3 wc6 wi wv3 wc6 wi wi
+      wi wn wi wv7 wv3 wc6 wi wv0 wv3 wi ax-g8 wv7 wv0 wv3 wi wi wv3 wc6 wi wv3
+      wc6 wi wi wi wn wc0 wc7 wi wn wc1 wv0 wi wn wi ax-1 ax-mp wc0 wc7 wi wn
+      wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi wv3 wc6 wi wv3 wc6 wi wi wi wn wi wv7
+      ax-1 ax-mp wv7 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi wv3 wc6
+      wi wv3 wc6 wi wi wi wn wi wi wc0 wc7 wi wn wc1 wv0 wi wn wi ax-1 ax-mp
+      wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0
+      wv3 wi wi wv3 wc6 wi wv3 wc6 wi wi wi wn wi wi wi wv5 ax-1 ax-mp wv5 wc0
+      wc7 wi wn wc1 wv0 wi wn wi wv7 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0 wv3
+      wi wi wv3 wc6 wi wv3 wc6 wi wi wi wn wi wi wi wi wv0 ax-1 ax-mp wv0 wv5
+      wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0
+      wv3 wi wi wv3 wc6 wi wv3 wc6 wi wi wi wn wi wi wi wi wi wv7 wv8 wi wv2 wi
+      wv8 wi ax-1 ax-mp wv7 wv8 wi wv2 wi wv8 wi wv0 wv5 wc0 wc7 wi wn wc1 wv0
+      wi wn wi wv7 wc0 wc7 wi wn wc1 wv0 wi wn wi wv7 wv0 wv3 wi wi wv3 wc6 wi
+      wv3 wc6 wi wi wi wn wi wi wi wi wi wi wc0 ax-1 ax-mp $.
+  th73 $p |- ( ( ( v0 -> ( c0 -> c3 ) ) -> ( ( c6 -> v2 ) -> v9 ) ) -> ( v1 -> ( -. v8 -> ( c5 -> ( -. ( ( v3 -> v3 ) -> ( v7 -> v0 ) ) -> ( ( ( c9 -> v8 ) -> ( ( v3 -> v0 ) -> v6 ) ) -> ( -. -. ( c9 -> c6 ) -> ( ( ( v7 -> v5 ) -> ( v9 -> v0 ) ) -> -. ( ( v2 -> v7 ) -> -. v6 ) ) ) ) ) ) ) ) ) $=
+      ( wn wc5 wi wc9 wc6 wc0 wc3 ax-g0 ax-1 ax-mp ) BHJZKDDLGALLJZMHLDALFLLZMN
+      LJJZGELZIALZLCGLZFJZLJLZLZLZLZLZLZLZAOPLLNCLILLZUNLUMUNULUMUKULUJUKUIUJUH
+      UIUFUGUEUDQUHUCRSUIUBRSUJUARSUKKRSULTRSUMBRSUNUORS $.
+  wth5 $p wff -. ( -. ( c0 -> c3 ) -> ( ( c2 -> c2 ) -> ( v1 -> v7 ) ) ) $=
+      wc0 wc3 wi wn wc2 wc2 wi wv1 wv7 wi wi wi wn $.
+  th74 $p |- ( ( c9 -> ( c8 -> c8 ) ) -> ( ( -. ( c9 -> c4 ) -> ( c5 -> ( v3 -> v3 ) ) ) -> ( ( c3 -> ( v2 -> ( v4 -> v2 ) ) ) -> ( v9 -> ( ( -. ( c9 -> c4 ) -> ( c5 -> ( v3 -> v3 ) ) ) -> ( ( v2 -> -. ( c6 -> v4 ) ) -> ( v1 -> v2 ) ) ) ) ) ) ) $=
+      ( wv5 wi wc9 wc8 wc4 wn wc5 wc3 wc6 ax-1 ax-g6 ax-mp ) FFFGGZHIIGGZHJGKLC
+      CGGGZMBDBGGGZETBNDGKGZABGZGZGZGZGZGZGZFFOUIRUIGUHUIUGUHUFUGUEUFUDUEUCUDUC
+      PUCUBOQUDTOQUEEOQUFUAOQUGTOQUHSOQUIROQQ $.
+  th75 $p |- ( v3 -> ( c9 -> ( ( ( -. v9 -> v3 ) -> v2 ) -> ( ( -. ( v0 -> v6 ) -> ( c9 -> v1 ) ) -> ( v3 -> ( -. ( ( v2 -> v4 ) -> ( c6 -> v1 ) ) -> ( ( -. ( v0 -> v4 ) -> ( -. c1 -> ( c4 -> c4 ) ) ) -> ( c9 -> ( -. c9 -> -. ( c9 -> c9 ) ) ) ) ) ) ) ) ) ) $=
+      wc9 wv9 wn wv3 wi wv2 wi wv0 wv6 wi wn wc9 wv1 wi wi wv3 wv2 wv4 wi wc6
+      wv1 wi wi wn wv0 wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi
+      wn wi wi wi wi wi wi wi wi wv3 wc9 wv9 wn wv3 wi wv2 wi wv0 wv6 wi wn wc9
+      wv1 wi wi wv3 wv2 wv4 wi wc6 wv1 wi wi wn wv0 wv4 wi wn wc1 wn wc4 wc4 wi
+      wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wi wi wi wi wi wi wv9 wn wv3 wi
+      wv2 wi wv0 wv6 wi wn wc9 wv1 wi wi wv3 wv2 wv4 wi wc6 wv1 wi wi wn wv0
+      wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wi wi
+      wi wi wc9 wv9 wn wv3 wi wv2 wi wv0 wv6 wi wn wc9 wv1 wi wi wv3 wv2 wv4 wi
+      wc6 wv1 wi wi wn wv0 wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9
+      wi wn wi wi wi wi wi wi wi wi wv0 wv6 wi wn wc9 wv1 wi wi wv3 wv2 wv4 wi
+      wc6 wv1 wi wi wn wv0 wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9
+      wi wn wi wi wi wi wi wi wv9 wn wv3 wi wv2 wi wv0 wv6 wi wn wc9 wv1 wi wi
+      wv3 wv2 wv4 wi wc6 wv1 wi wi wn wv0 wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9
+      wc9 wn wc9 wc9 wi wn wi wi wi wi wi wi wi wv3 wv2 wv4 wi wc6 wv1 wi wi wn
+      wv0 wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi
+      wi wi wv0 wv6 wi wn wc9 wv1 wi wi wv3 wv2 wv4 wi wc6 wv1 wi wi wn wv0 wv4
+      wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wi wi wi
+      wv2 wv4 wi wc6 wv1 wi wi wn wv0 wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9
+      wn wc9 wc9 wi wn wi wi wi wi wv3 wv2 wv4 wi wc6 wv1 wi wi wn wv0 wv4 wi
+      wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wi wi wv0
+      wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wv2
+      wv4 wi wc6 wv1 wi wi wn wv0 wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn
+      wc9 wc9 wi wn wi wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wv0 wv4 wi wn
+      wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wc9 wn wc9 wc9
+      wi wn wi wc9 wc9 wn wc9 wc9 wi wn wi wi wc9 wc9 ax-g7 wc9 wn wc9 wc9 wi
+      wn wi wc9 ax-1 ax-mp wc9 wc9 wn wc9 wc9 wi wn wi wi wv0 wv4 wi wn wc1 wn
+      wc4 wc4 wi wi wi ax-1 ax-mp wv0 wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9
+      wn wc9 wc9 wi wn wi wi wi wv2 wv4 wi wc6 wv1 wi wi wn ax-1 ax-mp wv2 wv4
+      wi wc6 wv1 wi wi wn wv0 wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9
+      wc9 wi wn wi wi wi wi wv3 ax-1 ax-mp wv3 wv2 wv4 wi wc6 wv1 wi wi wn wv0
+      wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wi wi
+      wv0 wv6 wi wn wc9 wv1 wi wi ax-1 ax-mp wv0 wv6 wi wn wc9 wv1 wi wi wv3
+      wv2 wv4 wi wc6 wv1 wi wi wn wv0 wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9
+      wn wc9 wc9 wi wn wi wi wi wi wi wi wv9 wn wv3 wi wv2 wi ax-1 ax-mp wv9 wn
+      wv3 wi wv2 wi wv0 wv6 wi wn wc9 wv1 wi wi wv3 wv2 wv4 wi wc6 wv1 wi wi wn
+      wv0 wv4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi
+      wi wi wi wi wc9 ax-1 ax-mp wc9 wv9 wn wv3 wi wv2 wi wv0 wv6 wi wn wc9 wv1
+      wi wi wv3 wv2 wv4 wi wc6 wv1 wi wi wn wv0 wv4 wi wn wc1 wn wc4 wc4 wi wi
+      wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wi wi wi wi wi wv3 ax-1 ax-mp $.
+  th76 $p |- ( -. -. v3 -> ( ( c9 -> c9 ) -> ( ( c9 -> c5 ) -> ( ( c9 -> c5 ) -> ( ( ( c5 -> ( v2 -> v2 ) ) -> ( v2 -> v8 ) ) -> ( c9 -> ( c9 -> c9 ) ) ) ) ) ) ) $=
+      ( wc9 wi wc5 wn th13 ax-1 ax-mp ) DDEDFEDFEFAAEEACEEDDDEEEEEEZBGGZKEDDADA
+      CHKLIJ $.
+  th77 $p |- ( ( -. -. v7 -> ( ( v5 -> v2 ) -> ( v9 -> v8 ) ) ) -> ( ( -. ( v9 -> v5 ) -> -. -. v3 ) -> ( ( -. ( v9 -> v5 ) -> -. -. v3 ) -> ( v6 -> ( ( ( ( v5 -> v1 ) -> v6 ) -> ( -. c5 -> ( c6 -> c3 ) ) ) -> ( v3 -> ( v2 -> ( ( c8 -> ( ( c6 -> c0 ) -> ( c0 -> c3 ) ) ) -> ( ( ( c9 -> ( v3 -> c6 ) ) -> ( ( c9 -> c1 ) -> c2 ) ) -> ( v2 -> ( -. ( ( c7 -> v3 ) -> ( c1 -> v3 ) ) -> ( -. ( ( c7 -> v3 ) -> ( c1 -> v3 ) ) -> ( ( v2 -> ( c1 -> ( c1 -> v3 ) ) ) -> -. ( ( ( c9 -> c3 ) -> c3 ) -> ( -. c9 -> -. c9 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv9 wv5 wi wn wv3 wn wn wi wv9 wv5 wi wn wv3 wn wn wi wv6 wv5 wv1 wi wv6
+      wi wc5 wn wc6 wc3 wi wi wi wv3 wv2 wc8 wc6 wc0 wi wc0 wc3 wi wi wi wc9
+      wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi wc1 wv3 wi wi wn wc7
+      wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9 wc3 wi wc3 wi wc9 wn
+      wc9 wn wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi wv7 wn wn wv5 wv2 wi
+      wv9 wv8 wi wi wi wv9 wv5 wi wn wv3 wn wn wi wv9 wv5 wi wn wv3 wn wn wi
+      wv6 wv5 wv1 wi wv6 wi wc5 wn wc6 wc3 wi wi wi wv3 wv2 wc8 wc6 wc0 wi wc0
+      wc3 wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi wc1
+      wv3 wi wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9 wc3
+      wi wc3 wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi
+      wv9 wv5 wi wn wv3 wn wn wi wv6 wv5 wv1 wi wv6 wi wc5 wn wc6 wc3 wi wi wi
+      wv3 wv2 wc8 wc6 wc0 wi wc0 wc3 wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2
+      wi wi wv2 wc7 wv3 wi wc1 wv3 wi wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1
+      wc1 wv3 wi wi wi wc9 wc3 wi wc3 wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi
+      wi wi wi wi wi wi wv9 wv5 wi wn wv3 wn wn wi wv9 wv5 wi wn wv3 wn wn wi
+      wv6 wv5 wv1 wi wv6 wi wc5 wn wc6 wc3 wi wi wi wv3 wv2 wc8 wc6 wc0 wi wc0
+      wc3 wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi wc1
+      wv3 wi wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9 wc3
+      wi wc3 wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi wv6
+      wv5 wv1 wi wv6 wi wc5 wn wc6 wc3 wi wi wi wv3 wv2 wc8 wc6 wc0 wi wc0 wc3
+      wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi wc1 wv3 wi
+      wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9 wc3 wi wc3
+      wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wi wi wi wv9 wv5 wi wn wv3
+      wn wn wi wv6 wv5 wv1 wi wv6 wi wc5 wn wc6 wc3 wi wi wi wv3 wv2 wc8 wc6
+      wc0 wi wc0 wc3 wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7
+      wv3 wi wc1 wv3 wi wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi
+      wi wc9 wc3 wi wc3 wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wi wi wi
+      wi wv5 wv1 wi wv6 wi wc5 wn wc6 wc3 wi wi wi wv3 wv2 wc8 wc6 wc0 wi wc0
+      wc3 wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi wc1
+      wv3 wi wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9 wc3
+      wi wc3 wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wi wi wv6 wv5 wv1
+      wi wv6 wi wc5 wn wc6 wc3 wi wi wi wv3 wv2 wc8 wc6 wc0 wi wc0 wc3 wi wi wi
+      wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi wc1 wv3 wi wi wn
+      wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9 wc3 wi wc3 wi
+      wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wi wi wi wv3 wv2 wc8 wc6 wc0
+      wi wc0 wc3 wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi
+      wc1 wv3 wi wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9
+      wc3 wi wc3 wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wi wv5 wv1 wi
+      wv6 wi wc5 wn wc6 wc3 wi wi wi wv3 wv2 wc8 wc6 wc0 wi wc0 wc3 wi wi wi
+      wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi wc1 wv3 wi wi wn
+      wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9 wc3 wi wc3 wi
+      wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wi wi wv2 wc8 wc6 wc0 wi wc0
+      wc3 wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi wc1
+      wv3 wi wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9 wc3
+      wi wc3 wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wv3 wv2 wc8 wc6 wc0
+      wi wc0 wc3 wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi
+      wc1 wv3 wi wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9
+      wc3 wi wc3 wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wi wv3 wc7 wv2
+      wc6 wc8 wc3 wc9 wc1 th26 wv2 wc8 wc6 wc0 wi wc0 wc3 wi wi wi wc9 wv3 wc6
+      wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi wc1 wv3 wi wi wn wc7 wv3 wi wc1
+      wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9 wc3 wi wc3 wi wc9 wn wc9 wn wi
+      wi wn wi wi wi wi wi wi wi wv3 ax-1 ax-mp wv3 wv2 wc8 wc6 wc0 wi wc0 wc3
+      wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi wc1 wv3 wi
+      wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9 wc3 wi wc3
+      wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wi wv5 wv1 wi wv6 wi wc5
+      wn wc6 wc3 wi wi wi ax-1 ax-mp wv5 wv1 wi wv6 wi wc5 wn wc6 wc3 wi wi wi
+      wv3 wv2 wc8 wc6 wc0 wi wc0 wc3 wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2
+      wi wi wv2 wc7 wv3 wi wc1 wv3 wi wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1
+      wc1 wv3 wi wi wi wc9 wc3 wi wc3 wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi
+      wi wi wi wi wv6 ax-1 ax-mp wv6 wv5 wv1 wi wv6 wi wc5 wn wc6 wc3 wi wi wi
+      wv3 wv2 wc8 wc6 wc0 wi wc0 wc3 wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2
+      wi wi wv2 wc7 wv3 wi wc1 wv3 wi wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1
+      wc1 wv3 wi wi wi wc9 wc3 wi wc3 wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi
+      wi wi wi wi wi wv9 wv5 wi wn wv3 wn wn wi ax-1 ax-mp wv9 wv5 wi wn wv3 wn
+      wn wi wv6 wv5 wv1 wi wv6 wi wc5 wn wc6 wc3 wi wi wi wv3 wv2 wc8 wc6 wc0
+      wi wc0 wc3 wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2 wc7 wv3 wi
+      wc1 wv3 wi wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3 wi wi wi wc9
+      wc3 wi wc3 wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wi wi wi wi wv9
+      wv5 wi wn wv3 wn wn wi ax-1 ax-mp wv9 wv5 wi wn wv3 wn wn wi wv9 wv5 wi
+      wn wv3 wn wn wi wv6 wv5 wv1 wi wv6 wi wc5 wn wc6 wc3 wi wi wi wv3 wv2 wc8
+      wc6 wc0 wi wc0 wc3 wi wi wi wc9 wv3 wc6 wi wi wc9 wc1 wi wc2 wi wi wv2
+      wc7 wv3 wi wc1 wv3 wi wi wn wc7 wv3 wi wc1 wv3 wi wi wn wv2 wc1 wc1 wv3
+      wi wi wi wc9 wc3 wi wc3 wi wc9 wn wc9 wn wi wi wn wi wi wi wi wi wi wi wi
+      wi wi wi wi wv7 wn wn wv5 wv2 wi wv9 wv8 wi wi wi ax-1 ax-mp $.
+  th78 $p |- ( c9 -> ( ( ( ( v4 -> c2 ) -> ( c9 -> v4 ) ) -> -. v0 ) -> ( ( ( ( v2 -> v2 ) -> c2 ) -> ( ( v0 -> v5 ) -> ( v6 -> c9 ) ) ) -> ( v0 -> ( ( v0 -> v4 ) -> ( ( v0 -> v4 ) -> ( v0 -> v4 ) ) ) ) ) ) ) $=
+      ( wc2 wi wc9 wn ax-1 ax-mp ) CFGHCGGAIGZBBGFGADGEHGGGZAACGZNNGGZGZGZGZHRG
+      QRPQOPNNJOAJKPMJKQLJKRHJK $.
+  th79 $p |- ( ( ( v0 -> ( c4 -> v1 ) ) -> -. -. c8 ) -> ( v4 -> ( ( ( v0 -> ( c4 -> v1 ) ) -> -. -. c8 ) -> ( ( -. c7 -> ( -. v3 -> ( v0 -> v3 ) ) ) -> ( ( ( ( c0 -> c6 ) -> ( v4 -> v4 ) ) -> ( ( c3 -> c8 ) -> ( v7 -> c8 ) ) ) -> ( ( ( ( c6 -> v4 ) -> c9 ) -> v4 ) -> ( v4 -> ( ( ( ( c0 -> c6 ) -> ( v4 -> v4 ) ) -> ( ( c3 -> c8 ) -> ( v7 -> c8 ) ) ) -> ( ( -. v4 -> c0 ) -> ( -. ( c4 -> c4 ) -> c6 ) ) ) ) ) ) ) ) ) ) $=
+      wv4 wv0 wc4 wv1 wi wi wc8 wn wn wi wc7 wn wv3 wn wv0 wv3 wi wi wi wc0 wc6
+      wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi wc6 wv4 wi wc9 wi wv4 wi wv4
+      wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi wv4 wn wc0 wi wc4
+      wc4 wi wn wc6 wi wi wi wi wi wi wi wi wi wv0 wc4 wv1 wi wi wc8 wn wn wi
+      wv4 wv0 wc4 wv1 wi wi wc8 wn wn wi wc7 wn wv3 wn wv0 wv3 wi wi wi wc0 wc6
+      wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi wc6 wv4 wi wc9 wi wv4 wi wv4
+      wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi wv4 wn wc0 wi wc4
+      wc4 wi wn wc6 wi wi wi wi wi wi wi wi wi wi wv0 wc4 wv1 wi wi wc8 wn wn
+      wi wc7 wn wv3 wn wv0 wv3 wi wi wi wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7
+      wc8 wi wi wi wc6 wv4 wi wc9 wi wv4 wi wv4 wc0 wc6 wi wv4 wv4 wi wi wc3
+      wc8 wi wv7 wc8 wi wi wi wv4 wn wc0 wi wc4 wc4 wi wn wc6 wi wi wi wi wi wi
+      wi wi wv4 wv0 wc4 wv1 wi wi wc8 wn wn wi wc7 wn wv3 wn wv0 wv3 wi wi wi
+      wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi wc6 wv4 wi wc9 wi
+      wv4 wi wv4 wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi wv4 wn
+      wc0 wi wc4 wc4 wi wn wc6 wi wi wi wi wi wi wi wi wi wc7 wn wv3 wn wv0 wv3
+      wi wi wi wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi wc6 wv4 wi
+      wc9 wi wv4 wi wv4 wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi
+      wv4 wn wc0 wi wc4 wc4 wi wn wc6 wi wi wi wi wi wi wi wv0 wc4 wv1 wi wi
+      wc8 wn wn wi wc7 wn wv3 wn wv0 wv3 wi wi wi wc0 wc6 wi wv4 wv4 wi wi wc3
+      wc8 wi wv7 wc8 wi wi wi wc6 wv4 wi wc9 wi wv4 wi wv4 wc0 wc6 wi wv4 wv4
+      wi wi wc3 wc8 wi wv7 wc8 wi wi wi wv4 wn wc0 wi wc4 wc4 wi wn wc6 wi wi
+      wi wi wi wi wi wi wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi
+      wc6 wv4 wi wc9 wi wv4 wi wv4 wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8
+      wi wi wi wv4 wn wc0 wi wc4 wc4 wi wn wc6 wi wi wi wi wi wi wc7 wn wv3 wn
+      wv0 wv3 wi wi wi wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi wc6
+      wv4 wi wc9 wi wv4 wi wv4 wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi
+      wi wi wv4 wn wc0 wi wc4 wc4 wi wn wc6 wi wi wi wi wi wi wi wv4 wv4 wv7
+      wv4 wc9 wv4 wc6 th55 wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi
+      wc6 wv4 wi wc9 wi wv4 wi wv4 wc0 wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8
+      wi wi wi wv4 wn wc0 wi wc4 wc4 wi wn wc6 wi wi wi wi wi wi wc7 wn wv3 wn
+      wv0 wv3 wi wi wi ax-1 ax-mp wc7 wn wv3 wn wv0 wv3 wi wi wi wc0 wc6 wi wv4
+      wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi wc6 wv4 wi wc9 wi wv4 wi wv4 wc0
+      wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi wv4 wn wc0 wi wc4 wc4 wi
+      wn wc6 wi wi wi wi wi wi wi wv0 wc4 wv1 wi wi wc8 wn wn wi ax-1 ax-mp wv0
+      wc4 wv1 wi wi wc8 wn wn wi wc7 wn wv3 wn wv0 wv3 wi wi wi wc0 wc6 wi wv4
+      wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi wc6 wv4 wi wc9 wi wv4 wi wv4 wc0
+      wc6 wi wv4 wv4 wi wi wc3 wc8 wi wv7 wc8 wi wi wi wv4 wn wc0 wi wc4 wc4 wi
+      wn wc6 wi wi wi wi wi wi wi wi wv4 ax-1 ax-mp wv4 wv0 wc4 wv1 wi wi wc8
+      wn wn wi wc7 wn wv3 wn wv0 wv3 wi wi wi wc0 wc6 wi wv4 wv4 wi wi wc3 wc8
+      wi wv7 wc8 wi wi wi wc6 wv4 wi wc9 wi wv4 wi wv4 wc0 wc6 wi wv4 wv4 wi wi
+      wc3 wc8 wi wv7 wc8 wi wi wi wv4 wn wc0 wi wc4 wc4 wi wn wc6 wi wi wi wi
+      wi wi wi wi wi wv0 wc4 wv1 wi wi wc8 wn wn wi ax-1 ax-mp $.
+  th80 $p |- ( ( ( ( v2 -> v6 ) -> ( c8 -> v8 ) ) -> ( c4 -> ( c8 -> v7 ) ) ) -> ( v6 -> ( ( ( c9 -> -. v1 ) -> ( ( v3 -> v2 ) -> v6 ) ) -> ( ( ( v1 -> c8 ) -> ( ( c2 -> v4 ) -> ( c2 -> v4 ) ) ) -> ( v2 -> ( ( ( v1 -> c8 ) -> ( ( c2 -> v4 ) -> ( c2 -> v4 ) ) ) -> ( ( -. c7 -> c3 ) -> ( -. ( ( v2 -> c8 ) -> -. c5 ) -> -. v0 ) ) ) ) ) ) ) ) $=
+      ( wv9 wi wc8 wc4 wc9 wn wc2 wc7 wc3 wc5 ax-1 ax-g1 ax-mp ) IIIJJZCFJKHJJL
+      KGJJJZFMBNJDCJFJJZBKJOEJOEJJJZCUEPNQJZCKJZRNZJNANZJZJZJZJZJZJZJZJZIISUQUB
+      UQJUPUQUOUPUNUOUMUNULUMUKULUJUKUHUIUGTUJUFSUAUKUESUAULCSUAUMUESUAUNUDSUAU
+      OFSUAUPUCSUAUQUBSUAUA $.
+  th81 $p |- ( ( -. c7 -> ( ( v6 -> v8 ) -> -. c4 ) ) -> ( -. -. ( v0 -> c3 ) -> ( ( ( -. v4 -> v5 ) -> ( -. c1 -> -. c3 ) ) -> ( ( ( v0 -> ( c2 -> v2 ) ) -> ( v6 -> -. v2 ) ) -> ( -. -. ( v0 -> c3 ) -> ( ( -. v0 -> c7 ) -> ( ( ( v0 -> ( c2 -> v2 ) ) -> ( v6 -> -. v2 ) ) -> ( -. -. ( v0 -> c3 ) -> -. -. v5 ) ) ) ) ) ) ) ) $=
+      wv0 wc3 wi wn wn wv4 wn wv5 wi wc1 wn wc3 wn wi wi wv0 wc2 wv2 wi wi wv6
+      wv2 wn wi wi wv0 wc3 wi wn wn wv0 wn wc7 wi wv0 wc2 wv2 wi wi wv6 wv2 wn
+      wi wi wv0 wc3 wi wn wn wv5 wn wn wi wi wi wi wi wi wi wc7 wn wv6 wv8 wi
+      wc4 wn wi wi wv0 wc3 wi wn wn wv4 wn wv5 wi wc1 wn wc3 wn wi wi wv0 wc2
+      wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv0 wn wc7 wi wv0 wc2 wv2 wi
+      wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv5 wn wn wi wi wi wi wi wi wi wi
+      wv4 wn wv5 wi wc1 wn wc3 wn wi wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0
+      wc3 wi wn wn wv0 wn wc7 wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi
+      wn wn wv5 wn wn wi wi wi wi wi wi wv0 wc3 wi wn wn wv4 wn wv5 wi wc1 wn
+      wc3 wn wi wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv0 wn
+      wc7 wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv5 wn wn wi
+      wi wi wi wi wi wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv0
+      wn wc7 wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv5 wn wn
+      wi wi wi wi wi wv4 wn wv5 wi wc1 wn wc3 wn wi wi wv0 wc2 wv2 wi wi wv6
+      wv2 wn wi wi wv0 wc3 wi wn wn wv0 wn wc7 wi wv0 wc2 wv2 wi wi wv6 wv2 wn
+      wi wi wv0 wc3 wi wn wn wv5 wn wn wi wi wi wi wi wi wv0 wc3 wi wn wn wv0
+      wn wc7 wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv5 wn wn
+      wi wi wi wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv0 wn
+      wc7 wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv5 wn wn wi
+      wi wi wi wi wv0 wn wc7 wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi
+      wn wn wv5 wn wn wi wi wi wv0 wc3 wi wn wn wv0 wn wc7 wi wv0 wc2 wv2 wi wi
+      wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv5 wn wn wi wi wi wi wv0 wc2 wv2 wi wi
+      wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv5 wn wn wi wi wv0 wn wc7 wi wv0 wc2
+      wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv5 wn wn wi wi wi wv0 wc3 wi
+      wn wn wv5 wn wn wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn
+      wv5 wn wn wi wi wv5 wn wn wv0 wc3 wi wn wn wv5 wn wn wi wv5 wn ax-g5 wv5
+      wn wn wv0 wc3 wi wn wn ax-1 ax-mp wv0 wc3 wi wn wn wv5 wn wn wi wv0 wc2
+      wv2 wi wi wv6 wv2 wn wi wi ax-1 ax-mp wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi
+      wv0 wc3 wi wn wn wv5 wn wn wi wi wv0 wn wc7 wi ax-1 ax-mp wv0 wn wc7 wi
+      wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv5 wn wn wi wi wi
+      wv0 wc3 wi wn wn ax-1 ax-mp wv0 wc3 wi wn wn wv0 wn wc7 wi wv0 wc2 wv2 wi
+      wi wv6 wv2 wn wi wi wv0 wc3 wi wn wn wv5 wn wn wi wi wi wi wv0 wc2 wv2 wi
+      wi wv6 wv2 wn wi wi ax-1 ax-mp wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3
+      wi wn wn wv0 wn wc7 wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi wn
+      wn wv5 wn wn wi wi wi wi wi wv4 wn wv5 wi wc1 wn wc3 wn wi wi ax-1 ax-mp
+      wv4 wn wv5 wi wc1 wn wc3 wn wi wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0
+      wc3 wi wn wn wv0 wn wc7 wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0 wc3 wi
+      wn wn wv5 wn wn wi wi wi wi wi wi wv0 wc3 wi wn wn ax-1 ax-mp wv0 wc3 wi
+      wn wn wv4 wn wv5 wi wc1 wn wc3 wn wi wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi
+      wi wv0 wc3 wi wn wn wv0 wn wc7 wi wv0 wc2 wv2 wi wi wv6 wv2 wn wi wi wv0
+      wc3 wi wn wn wv5 wn wn wi wi wi wi wi wi wi wc7 wn wv6 wv8 wi wc4 wn wi
+      wi ax-1 ax-mp $.
+  th82 $p |- ( ( -. ( c6 -> v6 ) -> ( -. v5 -> ( v4 -> v0 ) ) ) -> ( ( ( -. v1 -> c3 ) -> ( ( v3 -> v5 ) -> c9 ) ) -> ( ( -. ( c6 -> v6 ) -> ( -. v5 -> ( v4 -> v0 ) ) ) -> -. v4 ) ) ) $=
+      wv8 wv8 wv8 wi wi wc6 wv6 wi wn wv5 wn wv4 wv0 wi wi wi wv1 wn wc3 wi wv3
+      wv5 wi wc9 wi wi wc6 wv6 wi wn wv5 wn wv4 wv0 wi wi wi wv4 wn wi wi wi
+      wv8 wv8 ax-1 wc6 wv6 wi wn wv5 wn wv4 wv0 wi wi wi wv1 wn wc3 wi wv3 wv5
+      wi wc9 wi wi wc6 wv6 wi wn wv5 wn wv4 wv0 wi wi wi wv4 wn wi wi wi wv8
+      wv8 wv8 wi wi wc6 wv6 wi wn wv5 wn wv4 wv0 wi wi wi wv1 wn wc3 wi wv3 wv5
+      wi wc9 wi wi wc6 wv6 wi wn wv5 wn wv4 wv0 wi wi wi wv4 wn wi wi wi wi wv1
+      wn wc3 wi wv3 wv5 wi wc9 wi wi wc6 wv6 wi wn wv5 wn wv4 wv0 wi wi wi wv4
+      wn wi wi wc6 wv6 wi wn wv5 wn wv4 wv0 wi wi wi wv1 wn wc3 wi wv3 wv5 wi
+      wc9 wi wi wc6 wv6 wi wn wv5 wn wv4 wv0 wi wi wi wv4 wn wi wi wi wc6 wv6
+      wi wn wv5 wn wv4 wv0 wi wi wi wv4 wn wi wv1 wn wc3 wi wv3 wv5 wi wc9 wi
+      wi wc6 wv6 wi wn wv5 wn wv4 wv0 wi wi wi wv4 wn wi wi wv4 wn wc6 wv6 wi
+      wn wv5 wn wv4 wv0 wi wi wi wv4 wn wi wv4 ax-g5 wv4 wn wc6 wv6 wi wn wv5
+      wn wv4 wv0 wi wi wi ax-1 ax-mp wc6 wv6 wi wn wv5 wn wv4 wv0 wi wi wi wv4
+      wn wi wv1 wn wc3 wi wv3 wv5 wi wc9 wi wi ax-1 ax-mp wv1 wn wc3 wi wv3 wv5
+      wi wc9 wi wi wc6 wv6 wi wn wv5 wn wv4 wv0 wi wi wi wv4 wn wi wi wc6 wv6
+      wi wn wv5 wn wv4 wv0 wi wi wi ax-1 ax-mp wc6 wv6 wi wn wv5 wn wv4 wv0 wi
+      wi wi wv1 wn wc3 wi wv3 wv5 wi wc9 wi wi wc6 wv6 wi wn wv5 wn wv4 wv0 wi
+      wi wi wv4 wn wi wi wi wv8 wv8 wv8 wi wi ax-1 ax-mp ax-mp $.
+  th83 $p |- ( ( ( -. v3 -> -. v5 ) -> -. ( c2 -> v3 ) ) -> ( v5 -> ( v7 -> ( v6 -> ( ( ( c0 -> ( c8 -> v4 ) ) -> ( ( v1 -> c0 ) -> ( c1 -> v4 ) ) ) -> ( ( v4 -> c2 ) -> ( ( v4 -> c2 ) -> ( c0 -> ( -. ( ( v4 -> c2 ) -> ( v4 -> c2 ) ) -> ( -. c0 -> ( ( v4 -> c2 ) -> c0 ) ) ) ) ) ) ) ) ) ) ) $=
+      wv8 wv8 wv8 wi wi wv3 wn wv5 wn wi wc2 wv3 wi wn wi wv5 wv7 wv6 wc0 wc8
+      wv4 wi wi wv1 wc0 wi wc1 wv4 wi wi wi wv4 wc2 wi wv4 wc2 wi wc0 wv4 wc2
+      wi wv4 wc2 wi wi wn wc0 wn wv4 wc2 wi wc0 wi wi wi wi wi wi wi wi wi wi
+      wi wv8 wv8 ax-1 wv3 wn wv5 wn wi wc2 wv3 wi wn wi wv5 wv7 wv6 wc0 wc8 wv4
+      wi wi wv1 wc0 wi wc1 wv4 wi wi wi wv4 wc2 wi wv4 wc2 wi wc0 wv4 wc2 wi
+      wv4 wc2 wi wi wn wc0 wn wv4 wc2 wi wc0 wi wi wi wi wi wi wi wi wi wi wi
+      wv8 wv8 wv8 wi wi wv3 wn wv5 wn wi wc2 wv3 wi wn wi wv5 wv7 wv6 wc0 wc8
+      wv4 wi wi wv1 wc0 wi wc1 wv4 wi wi wi wv4 wc2 wi wv4 wc2 wi wc0 wv4 wc2
+      wi wv4 wc2 wi wi wn wc0 wn wv4 wc2 wi wc0 wi wi wi wi wi wi wi wi wi wi
+      wi wi wv5 wv7 wv6 wc0 wc8 wv4 wi wi wv1 wc0 wi wc1 wv4 wi wi wi wv4 wc2
+      wi wv4 wc2 wi wc0 wv4 wc2 wi wv4 wc2 wi wi wn wc0 wn wv4 wc2 wi wc0 wi wi
+      wi wi wi wi wi wi wi wi wv3 wn wv5 wn wi wc2 wv3 wi wn wi wv5 wv7 wv6 wc0
+      wc8 wv4 wi wi wv1 wc0 wi wc1 wv4 wi wi wi wv4 wc2 wi wv4 wc2 wi wc0 wv4
+      wc2 wi wv4 wc2 wi wi wn wc0 wn wv4 wc2 wi wc0 wi wi wi wi wi wi wi wi wi
+      wi wi wv7 wv6 wc0 wc8 wv4 wi wi wv1 wc0 wi wc1 wv4 wi wi wi wv4 wc2 wi
+      wv4 wc2 wi wc0 wv4 wc2 wi wv4 wc2 wi wi wn wc0 wn wv4 wc2 wi wc0 wi wi wi
+      wi wi wi wi wi wi wv5 wv7 wv6 wc0 wc8 wv4 wi wi wv1 wc0 wi wc1 wv4 wi wi
+      wi wv4 wc2 wi wv4 wc2 wi wc0 wv4 wc2 wi wv4 wc2 wi wi wn wc0 wn wv4 wc2
+      wi wc0 wi wi wi wi wi wi wi wi wi wi wv6 wc0 wc8 wv4 wi wi wv1 wc0 wi wc1
+      wv4 wi wi wi wv4 wc2 wi wv4 wc2 wi wc0 wv4 wc2 wi wv4 wc2 wi wi wn wc0 wn
+      wv4 wc2 wi wc0 wi wi wi wi wi wi wi wi wv7 wv6 wc0 wc8 wv4 wi wi wv1 wc0
+      wi wc1 wv4 wi wi wi wv4 wc2 wi wv4 wc2 wi wc0 wv4 wc2 wi wv4 wc2 wi wi wn
+      wc0 wn wv4 wc2 wi wc0 wi wi wi wi wi wi wi wi wi wc0 wc8 wv4 wi wi wv1
+      wc0 wi wc1 wv4 wi wi wi wv4 wc2 wi wv4 wc2 wi wc0 wv4 wc2 wi wv4 wc2 wi
+      wi wn wc0 wn wv4 wc2 wi wc0 wi wi wi wi wi wi wi wv6 wc0 wc8 wv4 wi wi
+      wv1 wc0 wi wc1 wv4 wi wi wi wv4 wc2 wi wv4 wc2 wi wc0 wv4 wc2 wi wv4 wc2
+      wi wi wn wc0 wn wv4 wc2 wi wc0 wi wi wi wi wi wi wi wi wc1 wv4 wv4 wv1
+      wv4 wc0 th35 wc0 wc8 wv4 wi wi wv1 wc0 wi wc1 wv4 wi wi wi wv4 wc2 wi wv4
+      wc2 wi wc0 wv4 wc2 wi wv4 wc2 wi wi wn wc0 wn wv4 wc2 wi wc0 wi wi wi wi
+      wi wi wi wv6 ax-1 ax-mp wv6 wc0 wc8 wv4 wi wi wv1 wc0 wi wc1 wv4 wi wi wi
+      wv4 wc2 wi wv4 wc2 wi wc0 wv4 wc2 wi wv4 wc2 wi wi wn wc0 wn wv4 wc2 wi
+      wc0 wi wi wi wi wi wi wi wi wv7 ax-1 ax-mp wv7 wv6 wc0 wc8 wv4 wi wi wv1
+      wc0 wi wc1 wv4 wi wi wi wv4 wc2 wi wv4 wc2 wi wc0 wv4 wc2 wi wv4 wc2 wi
+      wi wn wc0 wn wv4 wc2 wi wc0 wi wi wi wi wi wi wi wi wi wv5 ax-1 ax-mp wv5
+      wv7 wv6 wc0 wc8 wv4 wi wi wv1 wc0 wi wc1 wv4 wi wi wi wv4 wc2 wi wv4 wc2
+      wi wc0 wv4 wc2 wi wv4 wc2 wi wi wn wc0 wn wv4 wc2 wi wc0 wi wi wi wi wi
+      wi wi wi wi wi wv3 wn wv5 wn wi wc2 wv3 wi wn wi ax-1 ax-mp wv3 wn wv5 wn
+      wi wc2 wv3 wi wn wi wv5 wv7 wv6 wc0 wc8 wv4 wi wi wv1 wc0 wi wc1 wv4 wi
+      wi wi wv4 wc2 wi wv4 wc2 wi wc0 wv4 wc2 wi wv4 wc2 wi wi wn wc0 wn wv4
+      wc2 wi wc0 wi wi wi wi wi wi wi wi wi wi wi wv8 wv8 wv8 wi wi ax-1 ax-mp
+      ax-mp $.
+  th84 $p |- ( ( v3 -> v1 ) -> ( v3 -> ( ( ( v6 -> ( v9 -> v3 ) ) -> ( v4 -> ( v7 -> v5 ) ) ) -> ( v9 -> ( ( ( v6 -> ( v9 -> v3 ) ) -> ( v4 -> ( v7 -> v5 ) ) ) -> ( v9 -> ( ( v9 -> ( -. v9 -> ( v9 -> v9 ) ) ) -> ( -. v9 -> ( c1 -> ( -. c1 -> -. ( c1 -> c1 ) ) ) ) ) ) ) ) ) ) ) $=
+      wv3 wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi wi wv9 wv6 wv9 wv3 wi wi wv4 wv7
+      wv5 wi wi wi wv9 wv9 wv9 wn wv9 wv9 wi wi wi wv9 wn wc1 wc1 wn wc1 wc1 wi
+      wn wi wi wi wi wi wi wi wi wi wv3 wv1 wi wv3 wv6 wv9 wv3 wi wi wv4 wv7
+      wv5 wi wi wi wv9 wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi wi wv9 wv9 wv9 wn
+      wv9 wv9 wi wi wi wv9 wn wc1 wc1 wn wc1 wc1 wi wn wi wi wi wi wi wi wi wi
+      wi wi wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi wi wv9 wv6 wv9 wv3 wi wi wv4
+      wv7 wv5 wi wi wi wv9 wv9 wv9 wn wv9 wv9 wi wi wi wv9 wn wc1 wc1 wn wc1
+      wc1 wi wn wi wi wi wi wi wi wi wi wv3 wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi
+      wi wv9 wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi wi wv9 wv9 wv9 wn wv9 wv9 wi
+      wi wi wv9 wn wc1 wc1 wn wc1 wc1 wi wn wi wi wi wi wi wi wi wi wi wv9 wv6
+      wv9 wv3 wi wi wv4 wv7 wv5 wi wi wi wv9 wv9 wv9 wn wv9 wv9 wi wi wi wv9 wn
+      wc1 wc1 wn wc1 wc1 wi wn wi wi wi wi wi wi wi wv6 wv9 wv3 wi wi wv4 wv7
+      wv5 wi wi wi wv9 wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi wi wv9 wv9 wv9 wn
+      wv9 wv9 wi wi wi wv9 wn wc1 wc1 wn wc1 wc1 wi wn wi wi wi wi wi wi wi wi
+      wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi wi wv9 wv9 wv9 wn wv9 wv9 wi wi wi
+      wv9 wn wc1 wc1 wn wc1 wc1 wi wn wi wi wi wi wi wi wv9 wv6 wv9 wv3 wi wi
+      wv4 wv7 wv5 wi wi wi wv9 wv9 wv9 wn wv9 wv9 wi wi wi wv9 wn wc1 wc1 wn
+      wc1 wc1 wi wn wi wi wi wi wi wi wi wv9 wv9 wv9 wn wv9 wv9 wi wi wi wv9 wn
+      wc1 wc1 wn wc1 wc1 wi wn wi wi wi wi wi wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi
+      wi wi wv9 wv9 wv9 wn wv9 wv9 wi wi wi wv9 wn wc1 wc1 wn wc1 wc1 wi wn wi
+      wi wi wi wi wi wv9 wv9 wn wv9 wv9 wi wi wi wv9 wn wc1 wc1 wn wc1 wc1 wi
+      wn wi wi wi wi wv9 wv9 wv9 wn wv9 wv9 wi wi wi wv9 wn wc1 wc1 wn wc1 wc1
+      wi wn wi wi wi wi wi wv9 wv9 wv9 th3 wv9 wv9 wn wv9 wv9 wi wi wi wv9 wn
+      wc1 wc1 wn wc1 wc1 wi wn wi wi wi wi wv9 ax-1 ax-mp wv9 wv9 wv9 wn wv9
+      wv9 wi wi wi wv9 wn wc1 wc1 wn wc1 wc1 wi wn wi wi wi wi wi wv6 wv9 wv3
+      wi wi wv4 wv7 wv5 wi wi wi ax-1 ax-mp wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi
+      wi wv9 wv9 wv9 wn wv9 wv9 wi wi wi wv9 wn wc1 wc1 wn wc1 wc1 wi wn wi wi
+      wi wi wi wi wv9 ax-1 ax-mp wv9 wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi wi wv9
+      wv9 wv9 wn wv9 wv9 wi wi wi wv9 wn wc1 wc1 wn wc1 wc1 wi wn wi wi wi wi
+      wi wi wi wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi wi ax-1 ax-mp wv6 wv9 wv3 wi
+      wi wv4 wv7 wv5 wi wi wi wv9 wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi wi wv9
+      wv9 wv9 wn wv9 wv9 wi wi wi wv9 wn wc1 wc1 wn wc1 wc1 wi wn wi wi wi wi
+      wi wi wi wi wv3 ax-1 ax-mp wv3 wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi wi wv9
+      wv6 wv9 wv3 wi wi wv4 wv7 wv5 wi wi wi wv9 wv9 wv9 wn wv9 wv9 wi wi wi
+      wv9 wn wc1 wc1 wn wc1 wc1 wi wn wi wi wi wi wi wi wi wi wi wv3 wv1 wi
+      ax-1 ax-mp $.
+  th85 $p |- ( -. -. ( v0 -> v8 ) -> ( ( ( ( c9 -> c8 ) -> ( c8 -> c1 ) ) -> ( v2 -> c0 ) ) -> ( ( ( v9 -> ( v8 -> c7 ) ) -> ( -. v1 -> ( v2 -> v5 ) ) ) -> ( ( ( -. c9 -> ( v8 -> c3 ) ) -> -. ( v1 -> v2 ) ) -> ( ( ( ( c4 -> v3 ) -> ( v8 -> v2 ) ) -> ( c3 -> -. v2 ) ) -> ( -. ( -. c2 -> c8 ) -> ( -. -. ( v0 -> v8 ) -> c5 ) ) ) ) ) ) ) $=
+      wc9 wc8 wi wc8 wc1 wi wi wv2 wc0 wi wi wv9 wv8 wc7 wi wi wv1 wn wv2 wv5
+      wi wi wi wc9 wn wv8 wc3 wi wi wv1 wv2 wi wn wi wc4 wv3 wi wv8 wv2 wi wi
+      wc3 wv2 wn wi wi wc2 wn wc8 wi wn wv0 wv8 wi wn wn wc5 wi wi wi wi wi wi
+      wv0 wv8 wi wn wn wc9 wc8 wi wc8 wc1 wi wi wv2 wc0 wi wi wv9 wv8 wc7 wi wi
+      wv1 wn wv2 wv5 wi wi wi wc9 wn wv8 wc3 wi wi wv1 wv2 wi wn wi wc4 wv3 wi
+      wv8 wv2 wi wi wc3 wv2 wn wi wi wc2 wn wc8 wi wn wv0 wv8 wi wn wn wc5 wi
+      wi wi wi wi wi wi wv9 wv8 wc7 wi wi wv1 wn wv2 wv5 wi wi wi wc9 wn wv8
+      wc3 wi wi wv1 wv2 wi wn wi wc4 wv3 wi wv8 wv2 wi wi wc3 wv2 wn wi wi wc2
+      wn wc8 wi wn wv0 wv8 wi wn wn wc5 wi wi wi wi wi wc9 wc8 wi wc8 wc1 wi wi
+      wv2 wc0 wi wi wv9 wv8 wc7 wi wi wv1 wn wv2 wv5 wi wi wi wc9 wn wv8 wc3 wi
+      wi wv1 wv2 wi wn wi wc4 wv3 wi wv8 wv2 wi wi wc3 wv2 wn wi wi wc2 wn wc8
+      wi wn wv0 wv8 wi wn wn wc5 wi wi wi wi wi wi wc9 wn wv8 wc3 wi wi wv1 wv2
+      wi wn wi wc4 wv3 wi wv8 wv2 wi wi wc3 wv2 wn wi wi wc2 wn wc8 wi wn wv0
+      wv8 wi wn wn wc5 wi wi wi wi wv9 wv8 wc7 wi wi wv1 wn wv2 wv5 wi wi wi
+      wc9 wn wv8 wc3 wi wi wv1 wv2 wi wn wi wc4 wv3 wi wv8 wv2 wi wi wc3 wv2 wn
+      wi wi wc2 wn wc8 wi wn wv0 wv8 wi wn wn wc5 wi wi wi wi wi wc4 wv3 wi wv8
+      wv2 wi wi wc3 wv2 wn wi wi wc2 wn wc8 wi wn wv0 wv8 wi wn wn wc5 wi wi wi
+      wc9 wn wv8 wc3 wi wi wv1 wv2 wi wn wi wc4 wv3 wi wv8 wv2 wi wi wc3 wv2 wn
+      wi wi wc2 wn wc8 wi wn wv0 wv8 wi wn wn wc5 wi wi wi wi wc2 wn wc8 wi wn
+      wv0 wv8 wi wn wn wc5 wi wi wc4 wv3 wi wv8 wv2 wi wi wc3 wv2 wn wi wi wc2
+      wn wc8 wi wn wv0 wv8 wi wn wn wc5 wi wi wi wv0 wv8 wi wn wn wc5 wi wc2 wn
+      wc8 wi wn wv0 wv8 wi wn wn wc5 wi wi wc5 wv0 wv8 wi wn wn wc5 wi wc5
+      ax-g6 wc5 wv0 wv8 wi wn wn ax-1 ax-mp wv0 wv8 wi wn wn wc5 wi wc2 wn wc8
+      wi wn ax-1 ax-mp wc2 wn wc8 wi wn wv0 wv8 wi wn wn wc5 wi wi wc4 wv3 wi
+      wv8 wv2 wi wi wc3 wv2 wn wi wi ax-1 ax-mp wc4 wv3 wi wv8 wv2 wi wi wc3
+      wv2 wn wi wi wc2 wn wc8 wi wn wv0 wv8 wi wn wn wc5 wi wi wi wc9 wn wv8
+      wc3 wi wi wv1 wv2 wi wn wi ax-1 ax-mp wc9 wn wv8 wc3 wi wi wv1 wv2 wi wn
+      wi wc4 wv3 wi wv8 wv2 wi wi wc3 wv2 wn wi wi wc2 wn wc8 wi wn wv0 wv8 wi
+      wn wn wc5 wi wi wi wi wv9 wv8 wc7 wi wi wv1 wn wv2 wv5 wi wi wi ax-1
+      ax-mp wv9 wv8 wc7 wi wi wv1 wn wv2 wv5 wi wi wi wc9 wn wv8 wc3 wi wi wv1
+      wv2 wi wn wi wc4 wv3 wi wv8 wv2 wi wi wc3 wv2 wn wi wi wc2 wn wc8 wi wn
+      wv0 wv8 wi wn wn wc5 wi wi wi wi wi wc9 wc8 wi wc8 wc1 wi wi wv2 wc0 wi
+      wi ax-1 ax-mp wc9 wc8 wi wc8 wc1 wi wi wv2 wc0 wi wi wv9 wv8 wc7 wi wi
+      wv1 wn wv2 wv5 wi wi wi wc9 wn wv8 wc3 wi wi wv1 wv2 wi wn wi wc4 wv3 wi
+      wv8 wv2 wi wi wc3 wv2 wn wi wi wc2 wn wc8 wi wn wv0 wv8 wi wn wn wc5 wi
+      wi wi wi wi wi wv0 wv8 wi wn wn ax-1 ax-mp $.
+  th86 $p |- ( v9 -> ( v7 -> ( c5 -> ( ( ( ( v1 -> v5 ) -> v3 ) -> ( c9 -> v9 ) ) -> ( v5 -> ( v5 -> ( ( ( -. c5 -> ( c8 -> v9 ) ) -> c5 ) -> ( ( ( c5 -> ( v7 -> v5 ) ) -> v9 ) -> ( ( -. v7 -> ( ( v5 -> c1 ) -> ( c2 -> c5 ) ) ) -> ( v5 -> ( -. ( c7 -> v5 ) -> -. ( v5 -> v5 ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv7 wc5 wv1 wv5 wi wv3 wi wc9 wv9 wi wi wv5 wv5 wc5 wn wc8 wv9 wi wi wc5
+      wi wc5 wv7 wv5 wi wi wv9 wi wv7 wn wv5 wc1 wi wc2 wc5 wi wi wi wv5 wc7
+      wv5 wi wn wv5 wv5 wi wn wi wi wi wi wi wi wi wi wi wi wv9 wv7 wc5 wv1 wv5
+      wi wv3 wi wc9 wv9 wi wi wv5 wv5 wc5 wn wc8 wv9 wi wi wc5 wi wc5 wv7 wv5
+      wi wi wv9 wi wv7 wn wv5 wc1 wi wc2 wc5 wi wi wi wv5 wc7 wv5 wi wn wv5 wv5
+      wi wn wi wi wi wi wi wi wi wi wi wi wi wc5 wv1 wv5 wi wv3 wi wc9 wv9 wi
+      wi wv5 wv5 wc5 wn wc8 wv9 wi wi wc5 wi wc5 wv7 wv5 wi wi wv9 wi wv7 wn
+      wv5 wc1 wi wc2 wc5 wi wi wi wv5 wc7 wv5 wi wn wv5 wv5 wi wn wi wi wi wi
+      wi wi wi wi wi wv7 wc5 wv1 wv5 wi wv3 wi wc9 wv9 wi wi wv5 wv5 wc5 wn wc8
+      wv9 wi wi wc5 wi wc5 wv7 wv5 wi wi wv9 wi wv7 wn wv5 wc1 wi wc2 wc5 wi wi
+      wi wv5 wc7 wv5 wi wn wv5 wv5 wi wn wi wi wi wi wi wi wi wi wi wi wv1 wv5
+      wi wv3 wi wc9 wv9 wi wi wv5 wv5 wc5 wn wc8 wv9 wi wi wc5 wi wc5 wv7 wv5
+      wi wi wv9 wi wv7 wn wv5 wc1 wi wc2 wc5 wi wi wi wv5 wc7 wv5 wi wn wv5 wv5
+      wi wn wi wi wi wi wi wi wi wi wc5 wv1 wv5 wi wv3 wi wc9 wv9 wi wi wv5 wv5
+      wc5 wn wc8 wv9 wi wi wc5 wi wc5 wv7 wv5 wi wi wv9 wi wv7 wn wv5 wc1 wi
+      wc2 wc5 wi wi wi wv5 wc7 wv5 wi wn wv5 wv5 wi wn wi wi wi wi wi wi wi wi
+      wi wv5 wv5 wc5 wn wc8 wv9 wi wi wc5 wi wc5 wv7 wv5 wi wi wv9 wi wv7 wn
+      wv5 wc1 wi wc2 wc5 wi wi wi wv5 wc7 wv5 wi wn wv5 wv5 wi wn wi wi wi wi
+      wi wi wi wv1 wv5 wi wv3 wi wc9 wv9 wi wi wv5 wv5 wc5 wn wc8 wv9 wi wi wc5
+      wi wc5 wv7 wv5 wi wi wv9 wi wv7 wn wv5 wc1 wi wc2 wc5 wi wi wi wv5 wc7
+      wv5 wi wn wv5 wv5 wi wn wi wi wi wi wi wi wi wi wv5 wv5 wv9 wv5 wv7 wc5
+      th29 wv5 wv5 wc5 wn wc8 wv9 wi wi wc5 wi wc5 wv7 wv5 wi wi wv9 wi wv7 wn
+      wv5 wc1 wi wc2 wc5 wi wi wi wv5 wc7 wv5 wi wn wv5 wv5 wi wn wi wi wi wi
+      wi wi wi wv1 wv5 wi wv3 wi wc9 wv9 wi wi ax-1 ax-mp wv1 wv5 wi wv3 wi wc9
+      wv9 wi wi wv5 wv5 wc5 wn wc8 wv9 wi wi wc5 wi wc5 wv7 wv5 wi wi wv9 wi
+      wv7 wn wv5 wc1 wi wc2 wc5 wi wi wi wv5 wc7 wv5 wi wn wv5 wv5 wi wn wi wi
+      wi wi wi wi wi wi wc5 ax-1 ax-mp wc5 wv1 wv5 wi wv3 wi wc9 wv9 wi wi wv5
+      wv5 wc5 wn wc8 wv9 wi wi wc5 wi wc5 wv7 wv5 wi wi wv9 wi wv7 wn wv5 wc1
+      wi wc2 wc5 wi wi wi wv5 wc7 wv5 wi wn wv5 wv5 wi wn wi wi wi wi wi wi wi
+      wi wi wv7 ax-1 ax-mp wv7 wc5 wv1 wv5 wi wv3 wi wc9 wv9 wi wi wv5 wv5 wc5
+      wn wc8 wv9 wi wi wc5 wi wc5 wv7 wv5 wi wi wv9 wi wv7 wn wv5 wc1 wi wc2
+      wc5 wi wi wi wv5 wc7 wv5 wi wn wv5 wv5 wi wn wi wi wi wi wi wi wi wi wi
+      wi wv9 ax-1 ax-mp $.
+  th87 $p |- ( ( ( c0 -> -. c4 ) -> ( v8 -> ( v4 -> v5 ) ) ) -> ( ( ( -. c2 -> c5 ) -> v0 ) -> ( ( ( ( v5 -> v9 ) -> ( v4 -> v1 ) ) -> v3 ) -> ( ( ( -. c9 -> ( v2 -> c8 ) ) -> ( v0 -> c9 ) ) -> ( ( ( -. v0 -> ( v5 -> v7 ) ) -> ( -. c4 -> -. v9 ) ) -> ( ( ( -. c2 -> c5 ) -> v0 ) -> ( v9 -> ( v7 -> ( v4 -> ( ( c9 -> v9 ) -> ( ( v9 -> v9 ) -> ( v1 -> ( ( -. ( v9 -> v9 ) -> ( v4 -> v9 ) ) -> ( ( ( -. c4 -> ( v9 -> v9 ) ) -> ( v4 -> -. v4 ) ) -> ( c9 -> ( -. v9 -> ( -. ( c9 -> ( c9 -> v9 ) ) -> ( -. ( v9 -> v9 ) -> ( ( v9 -> v9 ) -> ( v9 -> v9 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc2 wn wc5 wi wc9 wc8 wc4 wc0 th71 ax-1 ax-mp ) JKLMAMZFIMEBMMDMZNKCOMM
+      ANMMZAKFGMMPKIKMMZUAIGENIMIIMBIIMKEIMMPKIIMMEEKMMNIKNNIMMKIIMKIIMIIMMMMMM
+      MMMMMMZMZMZMZMZMZMZMZQPKMHEFMMMZULMUKULUJUKUIUJUHUIUGUHUFUGUEUFIIIIIBIERU
+      EGSTUFISTUGUASTUHUDSTUIUCSTUJUBSTUKUASTULUMST $.
+  th88 $p |- ( ( ( ( v5 -> v8 ) -> ( v0 -> v6 ) ) -> v5 ) -> ( c1 -> ( ( ( c0 -> v9 ) -> ( c9 -> c8 ) ) -> -. ( c1 -> ( c9 -> c8 ) ) ) ) ) $=
+      ( wc1 wc0 wi wc9 wc8 wn th0 ax-1 ax-mp ) FGEHIJHHFIJHHKHHZBDHACHHBHZOHFFE
+      LOPMN $.
+  wth6 $p wff -. ( ( c0 -> v0 ) -> ( c5 -> ( v6 -> v1 ) ) ) $=
+      wc0 wv0 wi wc5 wv6 wv1 wi wi wi wn $.
+  th89 $p |- ( -. ( c8 -> ( v2 -> v6 ) ) -> ( ( ( ( v8 -> v0 ) -> v4 ) -> ( ( v1 -> v0 ) -> ( v1 -> v5 ) ) ) -> ( ( ( ( v7 -> v7 ) -> ( v8 -> c4 ) ) -> -. -. v6 ) -> ( -. v5 -> ( ( ( ( v5 -> v6 ) -> ( v6 -> v0 ) ) -> ( -. c5 -> -. v9 ) ) -> ( -. ( ( c8 -> v9 ) -> ( v4 -> v7 ) ) -> ( ( c5 -> -. -. c0 ) -> ( ( ( ( v5 -> v6 ) -> ( v6 -> v0 ) ) -> ( -. c5 -> -. v9 ) ) -> ( -. ( v9 -> c4 ) -> -. ( ( c1 -> v6 ) -> ( c1 -> v6 ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wi wc4 wn wc5 wc8 wc0 wc1 ax-g7 ax-1 ax-mp ) HAJDJBAJBEJJJZGGJHKJJFLLJZ
+      ELZEFJFAJJMLILJJZNIJDGJJLZMOLLJZUCIKJZLPFJZUGJLJZJZJZJZJZJZJZJZNCFJJLZUOJ
+      UNUOUMUNULUMUKULUJUKUIUJUHUIUFUGQUHUCRSUIUERSUJUDRSUKUCRSULUBRSUMUARSUNTR
+      SUOUPRS $.
+  th90 $p |- ( ( ( -. v5 -> ( c3 -> c3 ) ) -> v5 ) -> ( c8 -> ( ( ( v4 -> ( v3 -> v3 ) ) -> -. ( v1 -> c0 ) ) -> ( ( ( ( v6 -> v5 ) -> ( v1 -> c9 ) ) -> ( ( v7 -> v7 ) -> ( c5 -> c2 ) ) ) -> ( v2 -> ( ( ( ( v8 -> c5 ) -> -. v9 ) -> -. v5 ) -> ( ( ( ( v6 -> v5 ) -> ( v1 -> c9 ) ) -> ( ( v7 -> v7 ) -> ( c5 -> c2 ) ) ) -> ( ( c8 -> v2 ) -> ( ( v2 -> v2 ) -> ( -. ( v2 -> v2 ) -> -. ( ( v2 -> v2 ) -> ( v2 -> v2 ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wv0 wi wn wc3 wc8 wc0 wc9 wc5 wc2 ax-1 th6 ax-mp ) JJJKKZELMMKKEKZNDCCK
+      KAOKLKZFEKAPKKGGKQRKKKZBHQKILKELKZUENBKBBKBBKLBBKBBKKLKKKZKZKZKZKZKZKZKZJ
+      JSUNUBUNKUMUNULUMUKULUJUKUIUJUHUIUGUHBBBNTUGUESUAUHUFSUAUIBSUAUJUESUAUKUD
+      SUAULNSUAUMUCSUAUNUBSUAUA $.
+  th91 $p |- ( ( c5 -> v8 ) -> ( ( ( ( v9 -> v2 ) -> ( v8 -> v0 ) ) -> ( v6 -> ( c9 -> v1 ) ) ) -> ( ( ( ( v9 -> v2 ) -> ( v8 -> v0 ) ) -> ( v6 -> ( c9 -> v1 ) ) ) -> ( ( ( ( v0 -> v2 ) -> v3 ) -> -. v7 ) -> ( ( c3 -> v3 ) -> ( ( c3 -> v3 ) -> ( ( ( ( v9 -> v2 ) -> ( v8 -> v0 ) ) -> ( v6 -> ( c9 -> v1 ) ) ) -> -. ( ( ( c3 -> v3 ) -> ( c5 -> v8 ) ) -> ( ( c5 -> v8 ) -> ( c5 -> v8 ) ) ) ) ) ) ) ) ) ) $=
+      wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi wv9 wv2 wi wv8 wv0 wi wi
+      wv6 wc9 wv1 wi wi wi wv0 wv2 wi wv3 wi wv7 wn wi wc3 wv3 wi wc3 wv3 wi
+      wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi wi
+      wc5 wv8 wi wc5 wv8 wi wi wi wn wi wi wi wi wi wi wc5 wv8 wi wv9 wv2 wi
+      wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1
+      wi wi wi wv0 wv2 wi wv3 wi wv7 wn wi wc3 wv3 wi wc3 wv3 wi wv9 wv2 wi wv8
+      wv0 wi wi wv6 wc9 wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5
+      wv8 wi wi wi wn wi wi wi wi wi wi wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1
+      wi wi wi wv0 wv2 wi wv3 wi wv7 wn wi wc3 wv3 wi wc3 wv3 wi wv9 wv2 wi wv8
+      wv0 wi wi wv6 wc9 wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5
+      wv8 wi wi wi wn wi wi wi wi wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi
+      wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi wv0 wv2 wi wv3 wi wv7 wn
+      wi wc3 wv3 wi wc3 wv3 wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi
+      wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5 wv8 wi wi wi wn wi wi wi wi wi wi
+      wv0 wv2 wi wv3 wi wv7 wn wi wc3 wv3 wi wc3 wv3 wi wv9 wv2 wi wv8 wv0 wi
+      wi wv6 wc9 wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5 wv8 wi wi
+      wi wn wi wi wi wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi wv0 wv2
+      wi wv3 wi wv7 wn wi wc3 wv3 wi wc3 wv3 wi wv9 wv2 wi wv8 wv0 wi wi wv6
+      wc9 wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5 wv8 wi wi wi wn
+      wi wi wi wi wi wc3 wv3 wi wc3 wv3 wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1
+      wi wi wi wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5 wv8 wi wi wi wn wi wi wi
+      wv0 wv2 wi wv3 wi wv7 wn wi wc3 wv3 wi wc3 wv3 wi wv9 wv2 wi wv8 wv0 wi
+      wi wv6 wc9 wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5 wv8 wi wi
+      wi wn wi wi wi wi wc3 wv3 wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi
+      wi wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5 wv8 wi wi wi wn wi wi wc3 wv3
+      wi wc3 wv3 wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi wc3 wv3 wi
+      wc5 wv8 wi wi wc5 wv8 wi wc5 wv8 wi wi wi wn wi wi wi wv9 wv2 wi wv8 wv0
+      wi wi wv6 wc9 wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5 wv8 wi
+      wi wi wn wi wc3 wv3 wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi wc3
+      wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5 wv8 wi wi wi wn wi wi wc3 wv3 wi wc5
+      wv8 wi wi wc5 wv8 wi wc5 wv8 wi wi wi wn wv9 wv2 wi wv8 wv0 wi wi wv6 wc9
+      wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5 wv8 wi wi wi wn wi
+      wc3 wv3 wi wc5 wv8 wi wc5 wv8 wi ax-g8 wc3 wv3 wi wc5 wv8 wi wi wc5 wv8
+      wi wc5 wv8 wi wi wi wn wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi ax-1
+      ax-mp wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi
+      wi wc5 wv8 wi wc5 wv8 wi wi wi wn wi wc3 wv3 wi ax-1 ax-mp wc3 wv3 wi wv9
+      wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi wi wc5
+      wv8 wi wc5 wv8 wi wi wi wn wi wi wc3 wv3 wi ax-1 ax-mp wc3 wv3 wi wc3 wv3
+      wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi wi
+      wc5 wv8 wi wc5 wv8 wi wi wi wn wi wi wi wv0 wv2 wi wv3 wi wv7 wn wi ax-1
+      ax-mp wv0 wv2 wi wv3 wi wv7 wn wi wc3 wv3 wi wc3 wv3 wi wv9 wv2 wi wv8
+      wv0 wi wi wv6 wc9 wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5
+      wv8 wi wi wi wn wi wi wi wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi
+      ax-1 ax-mp wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi wv0 wv2 wi wv3
+      wi wv7 wn wi wc3 wv3 wi wc3 wv3 wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1
+      wi wi wi wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5 wv8 wi wi wi wn wi wi wi
+      wi wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi ax-1 ax-mp wv9 wv2 wi
+      wv8 wv0 wi wi wv6 wc9 wv1 wi wi wi wv9 wv2 wi wv8 wv0 wi wi wv6 wc9 wv1
+      wi wi wi wv0 wv2 wi wv3 wi wv7 wn wi wc3 wv3 wi wc3 wv3 wi wv9 wv2 wi wv8
+      wv0 wi wi wv6 wc9 wv1 wi wi wi wc3 wv3 wi wc5 wv8 wi wi wc5 wv8 wi wc5
+      wv8 wi wi wi wn wi wi wi wi wi wi wc5 wv8 wi ax-1 ax-mp $.
+  th92 $p |- ( c0 -> ( v7 -> ( ( c8 -> ( -. v5 -> -. v4 ) ) -> ( -. ( v3 -> ( v5 -> v1 ) ) -> ( v7 -> ( ( c9 -> v7 ) -> ( ( ( c0 -> c5 ) -> ( c9 -> v7 ) ) -> -. ( -. v7 -> ( c6 -> c0 ) ) ) ) ) ) ) ) ) $=
+      wv7 wc8 wv5 wn wv4 wn wi wi wv3 wv5 wv1 wi wi wn wv7 wc9 wv7 wi wc0 wc5
+      wi wc9 wv7 wi wi wv7 wn wc6 wc0 wi wi wn wi wi wi wi wi wi wc0 wv7 wc8
+      wv5 wn wv4 wn wi wi wv3 wv5 wv1 wi wi wn wv7 wc9 wv7 wi wc0 wc5 wi wc9
+      wv7 wi wi wv7 wn wc6 wc0 wi wi wn wi wi wi wi wi wi wi wc8 wv5 wn wv4 wn
+      wi wi wv3 wv5 wv1 wi wi wn wv7 wc9 wv7 wi wc0 wc5 wi wc9 wv7 wi wi wv7 wn
+      wc6 wc0 wi wi wn wi wi wi wi wi wv7 wc8 wv5 wn wv4 wn wi wi wv3 wv5 wv1
+      wi wi wn wv7 wc9 wv7 wi wc0 wc5 wi wc9 wv7 wi wi wv7 wn wc6 wc0 wi wi wn
+      wi wi wi wi wi wi wv3 wv5 wv1 wi wi wn wv7 wc9 wv7 wi wc0 wc5 wi wc9 wv7
+      wi wi wv7 wn wc6 wc0 wi wi wn wi wi wi wi wc8 wv5 wn wv4 wn wi wi wv3 wv5
+      wv1 wi wi wn wv7 wc9 wv7 wi wc0 wc5 wi wc9 wv7 wi wi wv7 wn wc6 wc0 wi wi
+      wn wi wi wi wi wi wv7 wc9 wv7 wi wc0 wc5 wi wc9 wv7 wi wi wv7 wn wc6 wc0
+      wi wi wn wi wi wi wv3 wv5 wv1 wi wi wn wv7 wc9 wv7 wi wc0 wc5 wi wc9 wv7
+      wi wi wv7 wn wc6 wc0 wi wi wn wi wi wi wi wc9 wv7 wi wc0 wc5 wi wc9 wv7
+      wi wi wv7 wn wc6 wc0 wi wi wn wi wi wv7 wc9 wv7 wi wc0 wc5 wi wc9 wv7 wi
+      wi wv7 wn wc6 wc0 wi wi wn wi wi wi wc0 wv7 wv7 th15 wc9 wv7 wi wc0 wc5
+      wi wc9 wv7 wi wi wv7 wn wc6 wc0 wi wi wn wi wi wv7 ax-1 ax-mp wv7 wc9 wv7
+      wi wc0 wc5 wi wc9 wv7 wi wi wv7 wn wc6 wc0 wi wi wn wi wi wi wv3 wv5 wv1
+      wi wi wn ax-1 ax-mp wv3 wv5 wv1 wi wi wn wv7 wc9 wv7 wi wc0 wc5 wi wc9
+      wv7 wi wi wv7 wn wc6 wc0 wi wi wn wi wi wi wi wc8 wv5 wn wv4 wn wi wi
+      ax-1 ax-mp wc8 wv5 wn wv4 wn wi wi wv3 wv5 wv1 wi wi wn wv7 wc9 wv7 wi
+      wc0 wc5 wi wc9 wv7 wi wi wv7 wn wc6 wc0 wi wi wn wi wi wi wi wi wv7 ax-1
+      ax-mp wv7 wc8 wv5 wn wv4 wn wi wi wv3 wv5 wv1 wi wi wn wv7 wc9 wv7 wi wc0
+      wc5 wi wc9 wv7 wi wi wv7 wn wc6 wc0 wi wi wn wi wi wi wi wi wi wc0 ax-1
+      ax-mp $.
+  th93 $p |- ( ( ( ( v9 -> v2 ) -> v4 ) -> c6 ) -> ( ( ( ( c1 -> v9 ) -> ( c4 -> v3 ) ) -> v9 ) -> ( ( ( ( v9 -> v7 ) -> ( v8 -> v3 ) ) -> ( -. c8 -> -. v1 ) ) -> ( v9 -> ( v8 -> ( ( ( ( v7 -> v9 ) -> -. v5 ) -> v3 ) -> ( v8 -> ( ( ( ( v4 -> v4 ) -> -. c3 ) -> v2 ) -> ( ( v8 -> -. v8 ) -> ( c6 -> ( ( v8 -> -. v8 ) -> ( v9 -> ( ( v8 -> -. v8 ) -> ( c6 -> ( -. ( v9 -> v9 ) -> -. ( c5 -> c5 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wc1 wv9 wi wc4 wv3 wi wi wv9 wi wv9 wv7 wi wv8 wv3 wi wi wc8 wn wv1 wn wi
+      wi wv9 wv8 wv7 wv9 wi wv5 wn wi wv3 wi wv8 wv4 wv4 wi wc3 wn wi wv2 wi
+      wv8 wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5
+      wc5 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv9 wv2 wi wv4 wi wc6
+      wi wc1 wv9 wi wc4 wv3 wi wi wv9 wi wv9 wv7 wi wv8 wv3 wi wi wc8 wn wv1 wn
+      wi wi wv9 wv8 wv7 wv9 wi wv5 wn wi wv3 wi wv8 wv4 wv4 wi wc3 wn wi wv2 wi
+      wv8 wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5
+      wc5 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv9 wv7 wi wv8 wv3
+      wi wi wc8 wn wv1 wn wi wi wv9 wv8 wv7 wv9 wi wv5 wn wi wv3 wi wv8 wv4 wv4
+      wi wc3 wn wi wv2 wi wv8 wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6
+      wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi wc1
+      wv9 wi wc4 wv3 wi wi wv9 wi wv9 wv7 wi wv8 wv3 wi wi wc8 wn wv1 wn wi wi
+      wv9 wv8 wv7 wv9 wi wv5 wn wi wv3 wi wv8 wv4 wv4 wi wc3 wn wi wv2 wi wv8
+      wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5
+      wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv9 wv8 wv7 wv9 wi wv5 wn
+      wi wv3 wi wv8 wv4 wv4 wi wc3 wn wi wv2 wi wv8 wv8 wn wi wc6 wv8 wv8 wn wi
+      wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi wi wi wi wi wi
+      wi wi wi wi wv9 wv7 wi wv8 wv3 wi wi wc8 wn wv1 wn wi wi wv9 wv8 wv7 wv9
+      wi wv5 wn wi wv3 wi wv8 wv4 wv4 wi wc3 wn wi wv2 wi wv8 wv8 wn wi wc6 wv8
+      wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi wi
+      wi wi wi wi wi wi wi wi wi wv8 wv7 wv9 wi wv5 wn wi wv3 wi wv8 wv4 wv4 wi
+      wc3 wn wi wv2 wi wv8 wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6
+      wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi wi wi wi wi wi wi wi wi wv9 wv8 wv7
+      wv9 wi wv5 wn wi wv3 wi wv8 wv4 wv4 wi wc3 wn wi wv2 wi wv8 wv8 wn wi wc6
+      wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi
+      wi wi wi wi wi wi wi wi wi wv7 wv9 wi wv5 wn wi wv3 wi wv8 wv4 wv4 wi wc3
+      wn wi wv2 wi wv8 wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9
+      wv9 wi wn wc5 wc5 wi wn wi wi wi wi wi wi wi wi wi wi wv8 wv7 wv9 wi wv5
+      wn wi wv3 wi wv8 wv4 wv4 wi wc3 wn wi wv2 wi wv8 wv8 wn wi wc6 wv8 wv8 wn
+      wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi wi wi wi wi
+      wi wi wi wi wv8 wv4 wv4 wi wc3 wn wi wv2 wi wv8 wv8 wn wi wc6 wv8 wv8 wn
+      wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi wi wi wi wi
+      wi wi wv7 wv9 wi wv5 wn wi wv3 wi wv8 wv4 wv4 wi wc3 wn wi wv2 wi wv8 wv8
+      wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn
+      wi wi wi wi wi wi wi wi wi wi wv4 wv4 wi wc3 wn wi wv2 wi wv8 wv8 wn wi
+      wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn wi wi
+      wi wi wi wi wi wi wv8 wv4 wv4 wi wc3 wn wi wv2 wi wv8 wv8 wn wi wc6 wv8
+      wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi wi
+      wi wi wi wi wi wv8 wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9
+      wv9 wi wn wc5 wc5 wi wn wi wi wi wi wi wi wi wv4 wv4 wi wc3 wn wi wv2 wi
+      wv8 wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5
+      wc5 wi wn wi wi wi wi wi wi wi wi wv9 wv8 wc5 wv8 th22 wv8 wv8 wn wi wc6
+      wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi
+      wi wi wi wi wv4 wv4 wi wc3 wn wi wv2 wi ax-1 ax-mp wv4 wv4 wi wc3 wn wi
+      wv2 wi wv8 wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi
+      wn wc5 wc5 wi wn wi wi wi wi wi wi wi wi wv8 ax-1 ax-mp wv8 wv4 wv4 wi
+      wc3 wn wi wv2 wi wv8 wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6
+      wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi wi wi wi wi wi wi wv7 wv9 wi wv5 wn
+      wi wv3 wi ax-1 ax-mp wv7 wv9 wi wv5 wn wi wv3 wi wv8 wv4 wv4 wi wc3 wn wi
+      wv2 wi wv8 wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi
+      wn wc5 wc5 wi wn wi wi wi wi wi wi wi wi wi wi wv8 ax-1 ax-mp wv8 wv7 wv9
+      wi wv5 wn wi wv3 wi wv8 wv4 wv4 wi wc3 wn wi wv2 wi wv8 wv8 wn wi wc6 wv8
+      wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi wi
+      wi wi wi wi wi wi wi wv9 ax-1 ax-mp wv9 wv8 wv7 wv9 wi wv5 wn wi wv3 wi
+      wv8 wv4 wv4 wi wc3 wn wi wv2 wi wv8 wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8
+      wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi wi wi wi wi wi wi wi
+      wi wi wv9 wv7 wi wv8 wv3 wi wi wc8 wn wv1 wn wi wi ax-1 ax-mp wv9 wv7 wi
+      wv8 wv3 wi wi wc8 wn wv1 wn wi wi wv9 wv8 wv7 wv9 wi wv5 wn wi wv3 wi wv8
+      wv4 wv4 wi wc3 wn wi wv2 wi wv8 wv8 wn wi wc6 wv8 wv8 wn wi wv9 wv8 wv8
+      wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi wi wi wi wi wi wi wi wi wi
+      wi wc1 wv9 wi wc4 wv3 wi wi wv9 wi ax-1 ax-mp wc1 wv9 wi wc4 wv3 wi wi
+      wv9 wi wv9 wv7 wi wv8 wv3 wi wi wc8 wn wv1 wn wi wi wv9 wv8 wv7 wv9 wi
+      wv5 wn wi wv3 wi wv8 wv4 wv4 wi wc3 wn wi wv2 wi wv8 wv8 wn wi wc6 wv8
+      wv8 wn wi wv9 wv8 wv8 wn wi wc6 wv9 wv9 wi wn wc5 wc5 wi wn wi wi wi wi
+      wi wi wi wi wi wi wi wi wi wi wv9 wv2 wi wv4 wi wc6 wi ax-1 ax-mp $.
+  th94 $p |- ( ( ( ( v7 -> v7 ) -> ( v5 -> v1 ) ) -> ( v0 -> v6 ) ) -> ( v4 -> ( v3 -> ( -. v6 -> ( ( ( ( c7 -> c2 ) -> c6 ) -> -. c9 ) -> ( -. v6 -> ( ( ( ( c7 -> c2 ) -> c6 ) -> -. c9 ) -> ( ( v3 -> c8 ) -> ( v4 -> ( ( ( v3 -> c8 ) -> c7 ) -> -. ( -. v6 -> -. v6 ) ) ) ) ) ) ) ) ) ) ) $=
+      wv8 wv8 wv8 wi wi wv7 wv7 wi wv5 wv1 wi wi wv0 wv6 wi wi wv4 wv3 wv6 wn
+      wc7 wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv3 wc8 wi
+      wv4 wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi wi wi wi wi wi
+      wv8 wv8 ax-1 wv7 wv7 wi wv5 wv1 wi wi wv0 wv6 wi wi wv4 wv3 wv6 wn wc7
+      wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv3 wc8 wi wv4
+      wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi wi wi wi wi wi wv8
+      wv8 wv8 wi wi wv7 wv7 wi wv5 wv1 wi wi wv0 wv6 wi wi wv4 wv3 wv6 wn wc7
+      wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv3 wc8 wi wv4
+      wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi wi wi wi wi wi wi
+      wv4 wv3 wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9
+      wn wi wv3 wc8 wi wv4 wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi
+      wi wi wi wi wv7 wv7 wi wv5 wv1 wi wi wv0 wv6 wi wi wv4 wv3 wv6 wn wc7 wc2
+      wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv3 wc8 wi wv4 wv3
+      wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi wi wi wi wi wi wv3 wv6
+      wn wc7 wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv3 wc8
+      wi wv4 wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi wi wi wi wv4
+      wv3 wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi
+      wv3 wc8 wi wv4 wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi wi wi
+      wi wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn
+      wi wv3 wc8 wi wv4 wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi wi
+      wi wv3 wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn
+      wi wv3 wc8 wi wv4 wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi wi
+      wi wi wc7 wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv3
+      wc8 wi wv4 wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi wi wv6 wn
+      wc7 wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv3 wc8 wi
+      wv4 wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi wi wi wv3 wv4
+      wv6 th34 wc7 wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi
+      wv3 wc8 wi wv4 wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi wi
+      wv6 wn ax-1 ax-mp wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi
+      wc6 wi wc9 wn wi wv3 wc8 wi wv4 wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi
+      wi wi wi wi wi wi wv3 ax-1 ax-mp wv3 wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi
+      wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv3 wc8 wi wv4 wv3 wc8 wi wc7 wi wv6
+      wn wv6 wn wi wn wi wi wi wi wi wi wi wi wv4 ax-1 ax-mp wv4 wv3 wv6 wn wc7
+      wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv3 wc8 wi wv4
+      wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi wi wi wi wi wi wi wi wi wv7 wv7
+      wi wv5 wv1 wi wi wv0 wv6 wi wi ax-1 ax-mp wv7 wv7 wi wv5 wv1 wi wi wv0
+      wv6 wi wi wv4 wv3 wv6 wn wc7 wc2 wi wc6 wi wc9 wn wi wv6 wn wc7 wc2 wi
+      wc6 wi wc9 wn wi wv3 wc8 wi wv4 wv3 wc8 wi wc7 wi wv6 wn wv6 wn wi wn wi
+      wi wi wi wi wi wi wi wi wi wv8 wv8 wv8 wi wi ax-1 ax-mp ax-mp $.
+  th95 $p |- ( -. ( v9 -> ( v0 -> c4 ) ) -> ( ( ( ( c8 -> v7 ) -> ( v4 -> c7 ) ) -> -. ( v9 -> c3 ) ) -> ( v5 -> ( -. ( v9 -> ( v0 -> c4 ) ) -> ( ( ( ( v3 -> c9 ) -> v2 ) -> ( ( v2 -> c4 ) -> ( v2 -> v1 ) ) ) -> ( ( ( ( c4 -> v4 ) -> c4 ) -> ( -. c5 -> ( v0 -> v8 ) ) ) -> ( ( ( ( c4 -> v4 ) -> c4 ) -> ( -. c5 -> ( v0 -> v8 ) ) ) -> ( -. ( ( v0 -> v6 ) -> ( v8 -> v0 ) ) -> ( ( -. v2 -> ( ( c4 -> v2 ) -> ( v3 -> v7 ) ) ) -> ( ( -. v2 -> ( c4 -> v2 ) ) -> ( -. v2 -> ( v3 -> v7 ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wc8 wv7 wi wv4 wc7 wi wi wv9 wc3 wi wn wi wv5 wv9 wv0 wc4 wi wi wn wv3
+      wc9 wi wv2 wi wv2 wc4 wi wv2 wv1 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0
+      wv8 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wv0 wv6 wi wv8 wv0
+      wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2 wn
+      wv3 wv7 wi wi wi wi wi wi wi wi wi wi wi wv9 wv0 wc4 wi wi wn wc8 wv7 wi
+      wv4 wc7 wi wi wv9 wc3 wi wn wi wv5 wv9 wv0 wc4 wi wi wn wv3 wc9 wi wv2 wi
+      wv2 wc4 wi wv2 wv1 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wc4
+      wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn
+      wc4 wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi
+      wi wi wi wi wi wi wi wi wi wv5 wv9 wv0 wc4 wi wi wn wv3 wc9 wi wv2 wi wv2
+      wc4 wi wv2 wv1 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wc4 wv4
+      wi wc4 wi wc5 wn wv0 wv8 wi wi wi wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn wc4
+      wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi
+      wi wi wi wi wi wi wc8 wv7 wi wv4 wc7 wi wi wv9 wc3 wi wn wi wv5 wv9 wv0
+      wc4 wi wi wn wv3 wc9 wi wv2 wi wv2 wc4 wi wv2 wv1 wi wi wi wc4 wv4 wi wc4
+      wi wc5 wn wv0 wv8 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wv0
+      wv6 wi wv8 wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2
+      wi wi wv2 wn wv3 wv7 wi wi wi wi wi wi wi wi wi wi wi wv9 wv0 wc4 wi wi
+      wn wv3 wc9 wi wv2 wi wv2 wc4 wi wv2 wv1 wi wi wi wc4 wv4 wi wc4 wi wc5 wn
+      wv0 wv8 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wv0 wv6 wi wv8
+      wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2
+      wn wv3 wv7 wi wi wi wi wi wi wi wi wi wv5 wv9 wv0 wc4 wi wi wn wv3 wc9 wi
+      wv2 wi wv2 wc4 wi wv2 wv1 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi
+      wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wv0 wv6 wi wv8 wv0 wi wi wn
+      wv2 wn wc4 wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi
+      wi wi wi wi wi wi wi wi wi wv3 wc9 wi wv2 wi wv2 wc4 wi wv2 wv1 wi wi wi
+      wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0
+      wv8 wi wi wi wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi wi
+      wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi wi wi wi wi wv9 wv0
+      wc4 wi wi wn wv3 wc9 wi wv2 wi wv2 wc4 wi wv2 wv1 wi wi wi wc4 wv4 wi wc4
+      wi wc5 wn wv0 wv8 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wv0
+      wv6 wi wv8 wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2
+      wi wi wv2 wn wv3 wv7 wi wi wi wi wi wi wi wi wi wc4 wv4 wi wc4 wi wc5 wn
+      wv0 wv8 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wv0 wv6 wi wv8
+      wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2
+      wn wv3 wv7 wi wi wi wi wi wi wi wv3 wc9 wi wv2 wi wv2 wc4 wi wv2 wv1 wi
+      wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wc4 wv4 wi wc4 wi wc5 wn
+      wv0 wv8 wi wi wi wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi
+      wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi wi wi wi wi wc4 wv4
+      wi wc4 wi wc5 wn wv0 wv8 wi wi wi wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn wc4
+      wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi
+      wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wc4 wv4 wi wc4 wi wc5 wn
+      wv0 wv8 wi wi wi wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi
+      wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi wi wi wi wv0 wv6 wi
+      wv8 wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi
+      wv2 wn wv3 wv7 wi wi wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi
+      wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi wi wi wv2 wn wc4
+      wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi wi wi wv2 wn wc4 wv2 wi wv3 wv7 wi
+      wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi wv0 wv6 wi wv8 wv0
+      wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2 wn
+      wv3 wv7 wi wi wi wi wi wv2 wn wc4 wv2 wi wv3 wv7 wi ax-2 wv2 wn wc4 wv2
+      wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi wv0
+      wv6 wi wv8 wv0 wi wi wn ax-1 ax-mp wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn wc4
+      wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi
+      wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi ax-1 ax-mp wc4 wv4 wi wc4 wi
+      wc5 wn wv0 wv8 wi wi wi wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn wc4 wv2 wi wv3
+      wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi wi wi wc4
+      wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi ax-1 ax-mp wc4 wv4 wi wc4 wi wc5 wn
+      wv0 wv8 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wv0 wv6 wi wv8
+      wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2
+      wn wv3 wv7 wi wi wi wi wi wi wi wv3 wc9 wi wv2 wi wv2 wc4 wi wv2 wv1 wi
+      wi wi ax-1 ax-mp wv3 wc9 wi wv2 wi wv2 wc4 wi wv2 wv1 wi wi wi wc4 wv4 wi
+      wc4 wi wc5 wn wv0 wv8 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi
+      wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi wi wi wv2 wn wc4
+      wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi wi wi wi wi wv9 wv0 wc4 wi wi wn
+      ax-1 ax-mp wv9 wv0 wc4 wi wi wn wv3 wc9 wi wv2 wi wv2 wc4 wi wv2 wv1 wi
+      wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wc4 wv4 wi wc4 wi wc5 wn
+      wv0 wv8 wi wi wi wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7 wi
+      wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi wi wi wi wi wi wv5
+      ax-1 ax-mp wv5 wv9 wv0 wc4 wi wi wn wv3 wc9 wi wv2 wi wv2 wc4 wi wv2 wv1
+      wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wc4 wv4 wi wc4 wi wc5
+      wn wv0 wv8 wi wi wi wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn wc4 wv2 wi wv3 wv7
+      wi wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi wi wi wi wi wi
+      wi wc8 wv7 wi wv4 wc7 wi wi wv9 wc3 wi wn wi ax-1 ax-mp wc8 wv7 wi wv4
+      wc7 wi wi wv9 wc3 wi wn wi wv5 wv9 wv0 wc4 wi wi wn wv3 wc9 wi wv2 wi wv2
+      wc4 wi wv2 wv1 wi wi wi wc4 wv4 wi wc4 wi wc5 wn wv0 wv8 wi wi wi wc4 wv4
+      wi wc4 wi wc5 wn wv0 wv8 wi wi wi wv0 wv6 wi wv8 wv0 wi wi wn wv2 wn wc4
+      wv2 wi wv3 wv7 wi wi wi wv2 wn wc4 wv2 wi wi wv2 wn wv3 wv7 wi wi wi wi
+      wi wi wi wi wi wi wi wv9 wv0 wc4 wi wi wn ax-1 ax-mp $.
+  th96 $p |- ( -. c1 -> ( -. v4 -> ( c8 -> ( ( ( -. v3 -> ( v8 -> v2 ) ) -> ( -. v4 -> ( v5 -> v2 ) ) ) -> ( ( ( ( v2 -> v3 ) -> ( v0 -> v0 ) ) -> ( v1 -> ( v4 -> v1 ) ) ) -> -. -. v4 ) ) ) ) ) $=
+      wv6 wv6 wv6 wi wi wc1 wn wv4 wn wc8 wv3 wn wv8 wv2 wi wi wv4 wn wv5 wv2
+      wi wi wi wv2 wv3 wi wv0 wv0 wi wi wv1 wv4 wv1 wi wi wi wv4 wn wn wi wi wi
+      wi wi wv6 wv6 ax-1 wc1 wn wv4 wn wc8 wv3 wn wv8 wv2 wi wi wv4 wn wv5 wv2
+      wi wi wi wv2 wv3 wi wv0 wv0 wi wi wv1 wv4 wv1 wi wi wi wv4 wn wn wi wi wi
+      wi wi wv6 wv6 wv6 wi wi wc1 wn wv4 wn wc8 wv3 wn wv8 wv2 wi wi wv4 wn wv5
+      wv2 wi wi wi wv2 wv3 wi wv0 wv0 wi wi wv1 wv4 wv1 wi wi wi wv4 wn wn wi
+      wi wi wi wi wi wv4 wn wc8 wv3 wn wv8 wv2 wi wi wv4 wn wv5 wv2 wi wi wi
+      wv2 wv3 wi wv0 wv0 wi wi wv1 wv4 wv1 wi wi wi wv4 wn wn wi wi wi wi wc1
+      wn wv4 wn wc8 wv3 wn wv8 wv2 wi wi wv4 wn wv5 wv2 wi wi wi wv2 wv3 wi wv0
+      wv0 wi wi wv1 wv4 wv1 wi wi wi wv4 wn wn wi wi wi wi wi wc8 wv3 wn wv8
+      wv2 wi wi wv4 wn wv5 wv2 wi wi wi wv2 wv3 wi wv0 wv0 wi wi wv1 wv4 wv1 wi
+      wi wi wv4 wn wn wi wi wi wv4 wn wc8 wv3 wn wv8 wv2 wi wi wv4 wn wv5 wv2
+      wi wi wi wv2 wv3 wi wv0 wv0 wi wi wv1 wv4 wv1 wi wi wi wv4 wn wn wi wi wi
+      wi wv3 wn wv8 wv2 wi wi wv4 wn wv5 wv2 wi wi wi wv2 wv3 wi wv0 wv0 wi wi
+      wv1 wv4 wv1 wi wi wi wv4 wn wn wi wi wc8 wv3 wn wv8 wv2 wi wi wv4 wn wv5
+      wv2 wi wi wi wv2 wv3 wi wv0 wv0 wi wi wv1 wv4 wv1 wi wi wi wv4 wn wn wi
+      wi wi wv2 wv3 wi wv0 wv0 wi wi wv1 wv4 wv1 wi wi wi wv4 wn wn wi wv3 wn
+      wv8 wv2 wi wi wv4 wn wv5 wv2 wi wi wi wv2 wv3 wi wv0 wv0 wi wi wv1 wv4
+      wv1 wi wi wi wv4 wn wn wi wi wv4 wn wn wv2 wv3 wi wv0 wv0 wi wi wv1 wv4
+      wv1 wi wi wi wv4 wn wn wi wv4 wn ax-g5 wv4 wn wn wv2 wv3 wi wv0 wv0 wi wi
+      wv1 wv4 wv1 wi wi wi ax-1 ax-mp wv2 wv3 wi wv0 wv0 wi wi wv1 wv4 wv1 wi
+      wi wi wv4 wn wn wi wv3 wn wv8 wv2 wi wi wv4 wn wv5 wv2 wi wi wi ax-1
+      ax-mp wv3 wn wv8 wv2 wi wi wv4 wn wv5 wv2 wi wi wi wv2 wv3 wi wv0 wv0 wi
+      wi wv1 wv4 wv1 wi wi wi wv4 wn wn wi wi wc8 ax-1 ax-mp wc8 wv3 wn wv8 wv2
+      wi wi wv4 wn wv5 wv2 wi wi wi wv2 wv3 wi wv0 wv0 wi wi wv1 wv4 wv1 wi wi
+      wi wv4 wn wn wi wi wi wv4 wn ax-1 ax-mp wv4 wn wc8 wv3 wn wv8 wv2 wi wi
+      wv4 wn wv5 wv2 wi wi wi wv2 wv3 wi wv0 wv0 wi wi wv1 wv4 wv1 wi wi wi wv4
+      wn wn wi wi wi wi wc1 wn ax-1 ax-mp wc1 wn wv4 wn wc8 wv3 wn wv8 wv2 wi
+      wi wv4 wn wv5 wv2 wi wi wi wv2 wv3 wi wv0 wv0 wi wi wv1 wv4 wv1 wi wi wi
+      wv4 wn wn wi wi wi wi wi wv6 wv6 wv6 wi wi ax-1 ax-mp ax-mp $.
+  th97 $p |- ( ( ( v3 -> ( v7 -> v9 ) ) -> ( v7 -> ( c7 -> v6 ) ) ) -> ( ( ( c8 -> ( c1 -> v5 ) ) -> -. v8 ) -> ( v3 -> ( v5 -> ( ( ( ( c3 -> v4 ) -> v9 ) -> v8 ) -> ( -. -. ( v1 -> v4 ) -> ( ( ( ( v0 -> v1 ) -> v9 ) -> -. ( v9 -> c8 ) ) -> ( ( c9 -> ( c8 -> c8 ) ) -> ( ( -. ( c9 -> c4 ) -> ( c5 -> ( v3 -> v3 ) ) ) -> ( ( c3 -> ( v7 -> ( v7 -> v7 ) ) ) -> ( v2 -> ( ( -. ( c9 -> c4 ) -> ( c5 -> ( v3 -> v3 ) ) ) -> ( ( v7 -> -. ( c6 -> v7 ) ) -> ( v5 -> v7 ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc8 wc1 wi wn wc3 wc9 wc4 wc5 wc6 wc7 th74 ax-1 ax-mp ) KLFMMINMZDFOEMJ
+      MIMZBEMNNZABMJMJKMNMZPKKMMPQMNRDDMMMOHHHMMMCPQMNRDDMMMHSHMNMFHMMMMMMMZMZM
+      ZMZMZMZMZDHJMMHTGMMMZUNMUMUNULUMUKULUJUKUIUJUHUIFHDHCUAUHUGUBUCUIUFUBUCUJ
+      UEUBUCUKFUBUCULDUBUCUMUDUBUCUNUOUBUC $.
+  th98 $p |- ( ( v5 -> v1 ) -> ( ( c4 -> v6 ) -> ( ( -. ( v1 -> v6 ) -> ( ( v9 -> c4 ) -> -. v9 ) ) -> ( ( v5 -> v1 ) -> ( ( v5 -> v1 ) -> ( ( -. c8 -> ( ( v8 -> v3 ) -> v0 ) ) -> ( ( ( v6 -> ( c0 -> v0 ) ) -> ( ( c4 -> v2 ) -> ( v3 -> v1 ) ) ) -> -. v1 ) ) ) ) ) ) ) $=
+      ( wc4 wi wn wc8 wc0 ax-g4 ax-1 ax-mp ) IFJZBFJKHIJHKJJZEBJZSLKGDJAJJZFMAJ
+      JICJDBJJJZBKZJZJZJZJZJZJZSUHJUGUHUFUGUEUFUDUEUCUDUBUCUBNUBUAOPUCTOPUDSOPU
+      ESOPUFROPUGQOPUHSOP $.
+  wth7 $p wff ( ( ( ( v0 -> v4 ) -> v4 ) -> ( ( v7 -> v7 ) -> ( v2 -> v7 ) ) ) -> ( ( ( v0 -> v3 ) -> ( v1 -> v9 ) ) -> ( ( v3 -> v2 ) -> ( c6 -> v2 ) ) ) ) $=
+      wv0 wv4 wi wv4 wi wv7 wv7 wi wv2 wv7 wi wi wi wv0 wv3 wi wv1 wv9 wi wi
+      wv3 wv2 wi wc6 wv2 wi wi wi wi $.
+  th99 $p |- ( v0 -> ( -. ( ( c3 -> v9 ) -> ( v6 -> v9 ) ) -> ( v2 -> ( c4 -> ( ( ( ( v2 -> v8 ) -> ( c6 -> c3 ) ) -> -. ( v7 -> c2 ) ) -> ( ( ( -. v7 -> -. c0 ) -> ( ( v8 -> v7 ) -> ( c4 -> c8 ) ) ) -> ( ( ( v2 -> v2 ) -> ( ( v8 -> v2 ) -> v8 ) ) -> ( ( v7 -> v8 ) -> ( ( ( -. c9 -> c9 ) -> ( v7 -> ( v7 -> v8 ) ) ) -> -. ( v7 -> v8 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc3 wi wn wc4 wc6 wc2 wc0 wc8 wc9 th32 ax-1 ax-mp ) GFHCFHHIZBJBEHKGHHD
+      LHIHZDIMIHEDHJNHHHBBHEBHEHHDEHOIOHDDEHHHDEHIHHHHZHZHZHZHZAUEHUDUEUCUDUBUC
+      UAUBDDEOBEBPUATQRUBJQRUCBQRUDSQRUEAQR $.
+  ${
+    $d v0 v7 $.
+    $d v7 v8 $.
+    th100 $p |- ( ( -. -. v1 -> v4 ) -> ( ( v4 -> ( ( v0 -> v7 ) -> ( v8 -> v1 ) ) ) -> ( -. ( ( c6 -> v7 ) -> ( v7 -> v7 ) ) -> -. ( ( c3 -> c8 ) -> ( v0 -> v8 ) ) ) ) ) $=
+      wv4 wv0 wv7 wi wv8 wv1 wi wi wi wc6 wv7 wi wv7 wv7 wi wi wn wc3 wc8 wi
+      wv0 wv8 wi wi wn wi wi wv1 wn wn wv4 wi wv4 wv0 wv7 wi wv8 wv1 wi wi wi
+      wc6 wv7 wi wv7 wv7 wi wi wn wc3 wc8 wi wv0 wv8 wi wi wn wi wi wi wc6 wv7
+      wi wv7 wv7 wi wi wn wc3 wc8 wi wv0 wv8 wi wi wn wi wv4 wv0 wv7 wi wv8 wv1
+      wi wi wi wc6 wv7 wi wv7 wv7 wi wi wn wc3 wc8 wi wv0 wv8 wi wi wn wi wi
+      wv0 wv8 wi wc3 wc8 wi wc6 wv7 wi wv7 wv7 wi ax-g3 wc6 wv7 wi wv7 wv7 wi
+      wi wn wc3 wc8 wi wv0 wv8 wi wi wn wi wv4 wv0 wv7 wi wv8 wv1 wi wi wi ax-1
+      ax-mp wv4 wv0 wv7 wi wv8 wv1 wi wi wi wc6 wv7 wi wv7 wv7 wi wi wn wc3 wc8
+      wi wv0 wv8 wi wi wn wi wi wv1 wn wn wv4 wi ax-1 ax-mp $.
+  $}
+  th101 $p |- ( v6 -> ( v1 -> ( ( ( ( c3 -> v9 ) -> ( v8 -> v4 ) ) -> ( ( c7 -> v3 ) -> ( c3 -> v5 ) ) ) -> ( v1 -> ( ( -. ( v2 -> c7 ) -> ( v9 -> ( v0 -> v7 ) ) ) -> ( ( c0 -> v7 ) -> -. ( c0 -> v7 ) ) ) ) ) ) ) $=
+      ( wc3 wi wc7 wn wc0 ax-g5 ax-1 ax-mp ) BKJLIELLMDLKFLLLZBCMLNJAHLLLZOHLZU
+      ANZLZLZLZLZLZGUGLUFUGUEUFUDUEUCUDUBUCUAPUBUAQRUCTQRUDBQRUESQRUFBQRUGGQR
+      $.
+  th102 $p |- ( -. ( ( c6 -> v2 ) -> ( v6 -> c9 ) ) -> ( ( ( ( c8 -> c1 ) -> v4 ) -> -. -. v9 ) -> ( ( v5 -> ( v8 -> v7 ) ) -> ( v1 -> ( ( ( -. v5 -> v6 ) -> v9 ) -> ( c2 -> ( -. ( ( c6 -> v2 ) -> ( v6 -> c9 ) ) -> ( v1 -> ( -. ( ( v5 -> c8 ) -> ( c5 -> v1 ) ) -> ( ( c8 -> -. ( c4 -> v1 ) ) -> ( ( -. -. v5 -> c1 ) -> ( ( ( -. v1 -> c0 ) -> c1 ) -> ( ( ( v2 -> c8 ) -> c1 ) -> ( ( ( -. v1 -> c0 ) -> c1 ) -> ( ( ( -. v1 -> c0 ) -> c1 ) -> ( ( ( ( c1 -> c1 ) -> -. v1 ) -> ( c1 -> v5 ) ) -> ( ( ( v1 -> v5 ) -> ( v1 -> v5 ) ) -> -. ( ( v1 -> c1 ) -> c6 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc8 wc1 wi wn wc2 wc6 wc9 wc5 wc4 wc0 th5 ax-1 ax-mp ) IJKCKHLLKZDGFKKZ
+      ADLEKHKZMNBKEOKKLZADIKPAKKLIQAKLKDLLJKALRKJKBIKJKALRKJKALRKJKJJKALKJDKKAD
+      KADKKAJKNKLKKKKKKKKKZKZKZKZKZKZKZKZUEUMKULUMUKULUJUKUIUJUHUIUGUHUFUGDABJJ
+      AIASUFATUAUGUETUAUHMTUAUIUDTUAUJATUAUKUCTUAULUBTUAUMUETUA $.
+  th103 $p |- ( ( ( ( c0 -> c6 ) -> v6 ) -> ( ( v6 -> v0 ) -> ( v4 -> c4 ) ) ) -> ( ( ( ( c0 -> v1 ) -> ( v1 -> c9 ) ) -> v1 ) -> ( c5 -> ( ( ( c0 -> ( v8 -> c5 ) ) -> ( ( v1 -> v1 ) -> ( c4 -> c3 ) ) ) -> ( v1 -> ( ( c5 -> v3 ) -> ( ( -. ( c5 -> v3 ) -> -. -. c3 ) -> ( -. c3 -> ( c5 -> v3 ) ) ) ) ) ) ) ) ) $=
+      ( wc0 wi wc9 wc5 wc4 wc3 wn wc6 th10 ax-1 ax-mp ) GBHBIHHBHJGFJHHBBHKLHHH
+      BJCHJCHMLMMHLMJCHHHHHHHHZGNHEHEAHDKHHHZRHBLBCFGBORSPQ $.
+  th104 $p |- ( ( ( ( c9 -> v4 ) -> ( v8 -> v7 ) ) -> c1 ) -> ( ( -. ( v3 -> c1 ) -> ( c1 -> ( c9 -> v7 ) ) ) -> ( ( c0 -> -. ( v1 -> v8 ) ) -> ( ( ( ( v2 -> c9 ) -> -. v4 ) -> ( ( v8 -> v3 ) -> ( v9 -> v3 ) ) ) -> ( c9 -> ( v8 -> ( v8 -> c9 ) ) ) ) ) ) ) $=
+      wv3 wc1 wi wn wc1 wc9 wv7 wi wi wi wc0 wv1 wv8 wi wn wi wv2 wc9 wi wv4 wn
+      wi wv8 wv3 wi wv9 wv3 wi wi wi wc9 wv8 wv8 wc9 wi wi wi wi wi wi wc9 wv4
+      wi wv8 wv7 wi wi wc1 wi wv3 wc1 wi wn wc1 wc9 wv7 wi wi wi wc0 wv1 wv8 wi
+      wn wi wv2 wc9 wi wv4 wn wi wv8 wv3 wi wv9 wv3 wi wi wi wc9 wv8 wv8 wc9 wi
+      wi wi wi wi wi wi wc0 wv1 wv8 wi wn wi wv2 wc9 wi wv4 wn wi wv8 wv3 wi
+      wv9 wv3 wi wi wi wc9 wv8 wv8 wc9 wi wi wi wi wi wv3 wc1 wi wn wc1 wc9 wv7
+      wi wi wi wc0 wv1 wv8 wi wn wi wv2 wc9 wi wv4 wn wi wv8 wv3 wi wv9 wv3 wi
+      wi wi wc9 wv8 wv8 wc9 wi wi wi wi wi wi wv2 wc9 wi wv4 wn wi wv8 wv3 wi
+      wv9 wv3 wi wi wi wc9 wv8 wv8 wc9 wi wi wi wi wc0 wv1 wv8 wi wn wi wv2 wc9
+      wi wv4 wn wi wv8 wv3 wi wv9 wv3 wi wi wi wc9 wv8 wv8 wc9 wi wi wi wi wi
+      wc9 wv8 wv8 wc9 wi wi wi wv2 wc9 wi wv4 wn wi wv8 wv3 wi wv9 wv3 wi wi wi
+      wc9 wv8 wv8 wc9 wi wi wi wi wv8 wv8 wc9 wi wi wc9 wv8 wv8 wc9 wi wi wi
+      wv8 wc9 wi wv8 wv8 wc9 wi wi wc9 wv8 wc9 wi wc9 ax-g4 wc9 wv8 ax-1 ax-mp
+      wv8 wc9 wi wv8 ax-1 ax-mp wv8 wv8 wc9 wi wi wc9 ax-1 ax-mp wc9 wv8 wv8
+      wc9 wi wi wi wv2 wc9 wi wv4 wn wi wv8 wv3 wi wv9 wv3 wi wi wi ax-1 ax-mp
+      wv2 wc9 wi wv4 wn wi wv8 wv3 wi wv9 wv3 wi wi wi wc9 wv8 wv8 wc9 wi wi wi
+      wi wc0 wv1 wv8 wi wn wi ax-1 ax-mp wc0 wv1 wv8 wi wn wi wv2 wc9 wi wv4 wn
+      wi wv8 wv3 wi wv9 wv3 wi wi wi wc9 wv8 wv8 wc9 wi wi wi wi wi wv3 wc1 wi
+      wn wc1 wc9 wv7 wi wi wi ax-1 ax-mp wv3 wc1 wi wn wc1 wc9 wv7 wi wi wi wc0
+      wv1 wv8 wi wn wi wv2 wc9 wi wv4 wn wi wv8 wv3 wi wv9 wv3 wi wi wi wc9 wv8
+      wv8 wc9 wi wi wi wi wi wi wc9 wv4 wi wv8 wv7 wi wi wc1 wi ax-1 ax-mp $.
+  th105 $p |- ( v3 -> ( ( ( ( v5 -> c8 ) -> ( v1 -> v6 ) ) -> -. ( v8 -> c3 ) ) -> ( ( ( ( v0 -> v2 ) -> -. v5 ) -> v7 ) -> ( ( ( ( v0 -> v2 ) -> -. v5 ) -> v7 ) -> ( ( ( v7 -> -. c8 ) -> ( -. v5 -> ( c6 -> v6 ) ) ) -> ( ( ( ( v5 -> c8 ) -> ( v1 -> v6 ) ) -> -. ( v8 -> c3 ) ) -> ( ( ( ( c4 -> c6 ) -> ( c3 -> v1 ) ) -> v1 ) -> ( -. ( v3 -> v3 ) -> ( -. v9 -> ( v3 -> v9 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc8 wi wc3 wn wc6 wc4 ax-g9 ax-1 ax-mp ) EJKBFKKHLKMKZACKEMKGKZTGJMKEMN
+      FKKKZSONKLBKKBKZDDKMIMDIKKKZKZKZKZKZKZKZDUIKUHUIUGUHUFUGUEUFUDUEUCUDDDDIP
+      UCUBQRUDSQRUEUAQRUFTQRUGTQRUHSQRUIDQR $.
+  th106 $p |- ( ( c4 -> v8 ) -> ( v0 -> ( ( ( v2 -> v4 ) -> ( -. v4 -> ( v5 -> v9 ) ) ) -> ( ( -. ( v8 -> c0 ) -> v3 ) -> ( ( v6 -> c9 ) -> ( ( v2 -> ( ( c4 -> v8 ) -> ( v6 -> c9 ) ) ) -> ( ( v2 -> ( c4 -> v8 ) ) -> ( v2 -> ( v6 -> c9 ) ) ) ) ) ) ) ) ) $=
+      wv1 wv1 wv1 wi wi wc4 wv8 wi wv0 wv2 wv4 wi wv4 wn wv5 wv9 wi wi wi wv8
+      wc0 wi wn wv3 wi wv6 wc9 wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4 wv8
+      wi wi wv2 wv6 wc9 wi wi wi wi wi wi wi wi wi wv1 wv1 ax-1 wc4 wv8 wi wv0
+      wv2 wv4 wi wv4 wn wv5 wv9 wi wi wi wv8 wc0 wi wn wv3 wi wv6 wc9 wi wv2
+      wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9 wi wi wi wi wi
+      wi wi wi wi wv1 wv1 wv1 wi wi wc4 wv8 wi wv0 wv2 wv4 wi wv4 wn wv5 wv9 wi
+      wi wi wv8 wc0 wi wn wv3 wi wv6 wc9 wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2
+      wc4 wv8 wi wi wv2 wv6 wc9 wi wi wi wi wi wi wi wi wi wi wv0 wv2 wv4 wi
+      wv4 wn wv5 wv9 wi wi wi wv8 wc0 wi wn wv3 wi wv6 wc9 wi wv2 wc4 wv8 wi
+      wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9 wi wi wi wi wi wi wi wi
+      wc4 wv8 wi wv0 wv2 wv4 wi wv4 wn wv5 wv9 wi wi wi wv8 wc0 wi wn wv3 wi
+      wv6 wc9 wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9
+      wi wi wi wi wi wi wi wi wi wv2 wv4 wi wv4 wn wv5 wv9 wi wi wi wv8 wc0 wi
+      wn wv3 wi wv6 wc9 wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi
+      wv2 wv6 wc9 wi wi wi wi wi wi wi wv0 wv2 wv4 wi wv4 wn wv5 wv9 wi wi wi
+      wv8 wc0 wi wn wv3 wi wv6 wc9 wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4
+      wv8 wi wi wv2 wv6 wc9 wi wi wi wi wi wi wi wi wv8 wc0 wi wn wv3 wi wv6
+      wc9 wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9 wi
+      wi wi wi wi wi wv2 wv4 wi wv4 wn wv5 wv9 wi wi wi wv8 wc0 wi wn wv3 wi
+      wv6 wc9 wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9
+      wi wi wi wi wi wi wi wv6 wc9 wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4
+      wv8 wi wi wv2 wv6 wc9 wi wi wi wi wi wv8 wc0 wi wn wv3 wi wv6 wc9 wi wv2
+      wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9 wi wi wi wi wi
+      wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9 wi wi wi
+      wi wv6 wc9 wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6
+      wc9 wi wi wi wi wi wv2 wc4 wv8 wi wv6 wc9 wi ax-2 wv2 wc4 wv8 wi wv6 wc9
+      wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9 wi wi wi wi wv6 wc9 wi ax-1 ax-mp
+      wv6 wc9 wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9
+      wi wi wi wi wi wv8 wc0 wi wn wv3 wi ax-1 ax-mp wv8 wc0 wi wn wv3 wi wv6
+      wc9 wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9 wi
+      wi wi wi wi wi wv2 wv4 wi wv4 wn wv5 wv9 wi wi wi ax-1 ax-mp wv2 wv4 wi
+      wv4 wn wv5 wv9 wi wi wi wv8 wc0 wi wn wv3 wi wv6 wc9 wi wv2 wc4 wv8 wi
+      wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9 wi wi wi wi wi wi wi wv0
+      ax-1 ax-mp wv0 wv2 wv4 wi wv4 wn wv5 wv9 wi wi wi wv8 wc0 wi wn wv3 wi
+      wv6 wc9 wi wv2 wc4 wv8 wi wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9
+      wi wi wi wi wi wi wi wi wc4 wv8 wi ax-1 ax-mp wc4 wv8 wi wv0 wv2 wv4 wi
+      wv4 wn wv5 wv9 wi wi wi wv8 wc0 wi wn wv3 wi wv6 wc9 wi wv2 wc4 wv8 wi
+      wv6 wc9 wi wi wi wv2 wc4 wv8 wi wi wv2 wv6 wc9 wi wi wi wi wi wi wi wi wi
+      wv1 wv1 wv1 wi wi ax-1 ax-mp ax-mp $.
+  th107 $p |- ( v9 -> ( c7 -> ( c7 -> ( v2 -> ( ( ( ( v1 -> c8 ) -> ( v2 -> v9 ) ) -> -. ( v8 -> c3 ) ) -> ( ( ( ( c6 -> c6 ) -> -. v1 ) -> c4 ) -> ( ( ( ( c6 -> c6 ) -> -. v1 ) -> c4 ) -> ( ( ( c4 -> -. c8 ) -> ( -. v1 -> ( c6 -> v9 ) ) ) -> ( ( ( ( v1 -> c8 ) -> ( v2 -> v9 ) ) -> -. ( v8 -> c3 ) ) -> ( ( ( ( c4 -> c6 ) -> ( c3 -> v2 ) ) -> v2 ) -> ( -. ( v2 -> v2 ) -> ( -. c4 -> ( v2 -> c4 ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wv3 wi wc7 wc8 wc3 wn wc6 wc4 ax-1 th105 ax-mp ) EEEFFZDGGBAHFBDFFCIFJF
+      KKFAJFLFKKFAJFLFLHJFAJKDFFFAHFBDFFCIFJFLKFIBFFBFBBFJLJBLFFFFFFFFFFZFZFZFZ
+      EEMTPTFSTRSQRKBKBADLCLNQGMORGMOSDMOTPMOO $.
+  th108 $p |- ( ( ( ( v1 -> v1 ) -> -. v6 ) -> ( -. v7 -> ( v6 -> v9 ) ) ) -> ( -. ( ( v8 -> c4 ) -> -. v8 ) -> ( ( -. ( v4 -> v1 ) -> v5 ) -> ( ( ( ( c2 -> c0 ) -> c5 ) -> ( ( v7 -> v0 ) -> ( v1 -> v5 ) ) ) -> ( ( -. ( v4 -> v1 ) -> v5 ) -> ( -. ( -. v9 -> -. v9 ) -> ( -. -. v9 -> ( ( v5 -> v2 ) -> -. v9 ) ) ) ) ) ) ) ) $=
+      wv3 wv3 wv3 wi wi wv1 wv1 wi wv6 wn wi wv7 wn wv6 wv9 wi wi wi wv8 wc4 wi
+      wv8 wn wi wn wv4 wv1 wi wn wv5 wi wc2 wc0 wi wc5 wi wv7 wv0 wi wv1 wv5 wi
+      wi wi wv4 wv1 wi wn wv5 wi wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2 wi wv9
+      wn wi wi wi wi wi wi wi wi wv3 wv3 ax-1 wv1 wv1 wi wv6 wn wi wv7 wn wv6
+      wv9 wi wi wi wv8 wc4 wi wv8 wn wi wn wv4 wv1 wi wn wv5 wi wc2 wc0 wi wc5
+      wi wv7 wv0 wi wv1 wv5 wi wi wi wv4 wv1 wi wn wv5 wi wv9 wn wv9 wn wi wn
+      wv9 wn wn wv5 wv2 wi wv9 wn wi wi wi wi wi wi wi wi wv3 wv3 wv3 wi wi wv1
+      wv1 wi wv6 wn wi wv7 wn wv6 wv9 wi wi wi wv8 wc4 wi wv8 wn wi wn wv4 wv1
+      wi wn wv5 wi wc2 wc0 wi wc5 wi wv7 wv0 wi wv1 wv5 wi wi wi wv4 wv1 wi wn
+      wv5 wi wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2 wi wv9 wn wi wi wi wi wi wi
+      wi wi wi wv8 wc4 wi wv8 wn wi wn wv4 wv1 wi wn wv5 wi wc2 wc0 wi wc5 wi
+      wv7 wv0 wi wv1 wv5 wi wi wi wv4 wv1 wi wn wv5 wi wv9 wn wv9 wn wi wn wv9
+      wn wn wv5 wv2 wi wv9 wn wi wi wi wi wi wi wi wv1 wv1 wi wv6 wn wi wv7 wn
+      wv6 wv9 wi wi wi wv8 wc4 wi wv8 wn wi wn wv4 wv1 wi wn wv5 wi wc2 wc0 wi
+      wc5 wi wv7 wv0 wi wv1 wv5 wi wi wi wv4 wv1 wi wn wv5 wi wv9 wn wv9 wn wi
+      wn wv9 wn wn wv5 wv2 wi wv9 wn wi wi wi wi wi wi wi wi wv4 wv1 wi wn wv5
+      wi wc2 wc0 wi wc5 wi wv7 wv0 wi wv1 wv5 wi wi wi wv4 wv1 wi wn wv5 wi wv9
+      wn wv9 wn wi wn wv9 wn wn wv5 wv2 wi wv9 wn wi wi wi wi wi wi wv8 wc4 wi
+      wv8 wn wi wn wv4 wv1 wi wn wv5 wi wc2 wc0 wi wc5 wi wv7 wv0 wi wv1 wv5 wi
+      wi wi wv4 wv1 wi wn wv5 wi wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2 wi wv9
+      wn wi wi wi wi wi wi wi wc2 wc0 wi wc5 wi wv7 wv0 wi wv1 wv5 wi wi wi wv4
+      wv1 wi wn wv5 wi wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2 wi wv9 wn wi wi wi
+      wi wi wv4 wv1 wi wn wv5 wi wc2 wc0 wi wc5 wi wv7 wv0 wi wv1 wv5 wi wi wi
+      wv4 wv1 wi wn wv5 wi wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2 wi wv9 wn wi
+      wi wi wi wi wi wv4 wv1 wi wn wv5 wi wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2
+      wi wv9 wn wi wi wi wi wc2 wc0 wi wc5 wi wv7 wv0 wi wv1 wv5 wi wi wi wv4
+      wv1 wi wn wv5 wi wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2 wi wv9 wn wi wi wi
+      wi wi wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2 wi wv9 wn wi wi wi wv4 wv1 wi
+      wn wv5 wi wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2 wi wv9 wn wi wi wi wi wv9
+      wn wv9 wn wv5 wv2 wi wv9 wn ax-g9 wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2
+      wi wv9 wn wi wi wi wv4 wv1 wi wn wv5 wi ax-1 ax-mp wv4 wv1 wi wn wv5 wi
+      wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2 wi wv9 wn wi wi wi wi wc2 wc0 wi
+      wc5 wi wv7 wv0 wi wv1 wv5 wi wi wi ax-1 ax-mp wc2 wc0 wi wc5 wi wv7 wv0
+      wi wv1 wv5 wi wi wi wv4 wv1 wi wn wv5 wi wv9 wn wv9 wn wi wn wv9 wn wn
+      wv5 wv2 wi wv9 wn wi wi wi wi wi wv4 wv1 wi wn wv5 wi ax-1 ax-mp wv4 wv1
+      wi wn wv5 wi wc2 wc0 wi wc5 wi wv7 wv0 wi wv1 wv5 wi wi wi wv4 wv1 wi wn
+      wv5 wi wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2 wi wv9 wn wi wi wi wi wi wi
+      wv8 wc4 wi wv8 wn wi wn ax-1 ax-mp wv8 wc4 wi wv8 wn wi wn wv4 wv1 wi wn
+      wv5 wi wc2 wc0 wi wc5 wi wv7 wv0 wi wv1 wv5 wi wi wi wv4 wv1 wi wn wv5 wi
+      wv9 wn wv9 wn wi wn wv9 wn wn wv5 wv2 wi wv9 wn wi wi wi wi wi wi wi wv1
+      wv1 wi wv6 wn wi wv7 wn wv6 wv9 wi wi wi ax-1 ax-mp wv1 wv1 wi wv6 wn wi
+      wv7 wn wv6 wv9 wi wi wi wv8 wc4 wi wv8 wn wi wn wv4 wv1 wi wn wv5 wi wc2
+      wc0 wi wc5 wi wv7 wv0 wi wv1 wv5 wi wi wi wv4 wv1 wi wn wv5 wi wv9 wn wv9
+      wn wi wn wv9 wn wn wv5 wv2 wi wv9 wn wi wi wi wi wi wi wi wi wv3 wv3 wv3
+      wi wi ax-1 ax-mp ax-mp $.
+  th109 $p |- ( -. -. v2 -> ( -. -. v2 -> ( -. c7 -> ( v6 -> ( ( ( ( v6 -> c8 ) -> ( v6 -> c9 ) ) -> c8 ) -> ( c5 -> ( ( ( v6 -> ( c8 -> c5 ) ) -> ( ( v1 -> c8 ) -> ( c4 -> c8 ) ) ) -> ( c8 -> ( ( c5 -> v6 ) -> ( ( -. ( c5 -> v6 ) -> -. -. c8 ) -> ( -. c8 -> ( c5 -> v6 ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv2 wn wn wc7 wn wv6 wv6 wc8 wi wv6 wc9 wi wi wc8 wi wc5 wv6 wc8 wc5 wi
+      wi wv1 wc8 wi wc4 wc8 wi wi wi wc8 wc5 wv6 wi wc5 wv6 wi wn wc8 wn wn wi
+      wc8 wn wc5 wv6 wi wi wi wi wi wi wi wi wi wi wi wv2 wn wn wv2 wn wn wc7
+      wn wv6 wv6 wc8 wi wv6 wc9 wi wi wc8 wi wc5 wv6 wc8 wc5 wi wi wv1 wc8 wi
+      wc4 wc8 wi wi wi wc8 wc5 wv6 wi wc5 wv6 wi wn wc8 wn wn wi wc8 wn wc5 wv6
+      wi wi wi wi wi wi wi wi wi wi wi wi wc7 wn wv6 wv6 wc8 wi wv6 wc9 wi wi
+      wc8 wi wc5 wv6 wc8 wc5 wi wi wv1 wc8 wi wc4 wc8 wi wi wi wc8 wc5 wv6 wi
+      wc5 wv6 wi wn wc8 wn wn wi wc8 wn wc5 wv6 wi wi wi wi wi wi wi wi wi wi
+      wv2 wn wn wc7 wn wv6 wv6 wc8 wi wv6 wc9 wi wi wc8 wi wc5 wv6 wc8 wc5 wi
+      wi wv1 wc8 wi wc4 wc8 wi wi wi wc8 wc5 wv6 wi wc5 wv6 wi wn wc8 wn wn wi
+      wc8 wn wc5 wv6 wi wi wi wi wi wi wi wi wi wi wi wv6 wv6 wc8 wi wv6 wc9 wi
+      wi wc8 wi wc5 wv6 wc8 wc5 wi wi wv1 wc8 wi wc4 wc8 wi wi wi wc8 wc5 wv6
+      wi wc5 wv6 wi wn wc8 wn wn wi wc8 wn wc5 wv6 wi wi wi wi wi wi wi wi wi
+      wc7 wn wv6 wv6 wc8 wi wv6 wc9 wi wi wc8 wi wc5 wv6 wc8 wc5 wi wi wv1 wc8
+      wi wc4 wc8 wi wi wi wc8 wc5 wv6 wi wc5 wv6 wi wn wc8 wn wn wi wc8 wn wc5
+      wv6 wi wi wi wi wi wi wi wi wi wi wv6 wc8 wi wv6 wc9 wi wi wc8 wi wc5 wv6
+      wc8 wc5 wi wi wv1 wc8 wi wc4 wc8 wi wi wi wc8 wc5 wv6 wi wc5 wv6 wi wn
+      wc8 wn wn wi wc8 wn wc5 wv6 wi wi wi wi wi wi wi wi wv6 wv6 wc8 wi wv6
+      wc9 wi wi wc8 wi wc5 wv6 wc8 wc5 wi wi wv1 wc8 wi wc4 wc8 wi wi wi wc8
+      wc5 wv6 wi wc5 wv6 wi wn wc8 wn wn wi wc8 wn wc5 wv6 wi wi wi wi wi wi wi
+      wi wi wc8 wc8 wv6 wv6 wc8 wv6 wv1 th10 wv6 wc8 wi wv6 wc9 wi wi wc8 wi
+      wc5 wv6 wc8 wc5 wi wi wv1 wc8 wi wc4 wc8 wi wi wi wc8 wc5 wv6 wi wc5 wv6
+      wi wn wc8 wn wn wi wc8 wn wc5 wv6 wi wi wi wi wi wi wi wi wv6 ax-1 ax-mp
+      wv6 wv6 wc8 wi wv6 wc9 wi wi wc8 wi wc5 wv6 wc8 wc5 wi wi wv1 wc8 wi wc4
+      wc8 wi wi wi wc8 wc5 wv6 wi wc5 wv6 wi wn wc8 wn wn wi wc8 wn wc5 wv6 wi
+      wi wi wi wi wi wi wi wi wc7 wn ax-1 ax-mp wc7 wn wv6 wv6 wc8 wi wv6 wc9
+      wi wi wc8 wi wc5 wv6 wc8 wc5 wi wi wv1 wc8 wi wc4 wc8 wi wi wi wc8 wc5
+      wv6 wi wc5 wv6 wi wn wc8 wn wn wi wc8 wn wc5 wv6 wi wi wi wi wi wi wi wi
+      wi wi wv2 wn wn ax-1 ax-mp wv2 wn wn wc7 wn wv6 wv6 wc8 wi wv6 wc9 wi wi
+      wc8 wi wc5 wv6 wc8 wc5 wi wi wv1 wc8 wi wc4 wc8 wi wi wi wc8 wc5 wv6 wi
+      wc5 wv6 wi wn wc8 wn wn wi wc8 wn wc5 wv6 wi wi wi wi wi wi wi wi wi wi
+      wi wv2 wn wn ax-1 ax-mp $.
+  th110 $p |- ( ( v9 -> v9 ) -> ( c2 -> ( c0 -> ( ( v7 -> v6 ) -> ( ( ( ( v6 -> v2 ) -> ( c9 -> v2 ) ) -> ( ( v6 -> c7 ) -> ( v4 -> v4 ) ) ) -> ( v6 -> ( ( ( -. v9 -> ( v9 -> c1 ) ) -> v9 ) -> ( v2 -> v6 ) ) ) ) ) ) ) ) $=
+      ( wc2 wc0 wi wc9 wc7 wn wc1 th21 ax-1 ax-mp ) FGDCHCAHIAHHCJHBBHHHCEKELHH
+      EHACHHHHHHHZEEHZPHCEACDBMPQNO $.
+  th111 $p |- ( ( ( v6 -> ( v0 -> v6 ) ) -> v9 ) -> ( c6 -> ( ( -. ( c0 -> v5 ) -> ( ( c6 -> v5 ) -> c3 ) ) -> ( ( ( c2 -> v7 ) -> ( c6 -> ( v5 -> c1 ) ) ) -> ( ( ( c2 -> v7 ) -> ( c6 -> ( v5 -> c1 ) ) ) -> ( ( ( ( v6 -> c2 ) -> -. v7 ) -> v4 ) -> ( -. ( ( c1 -> v7 ) -> v6 ) -> ( ( -. ( v0 -> c1 ) -> ( ( c0 -> v5 ) -> -. v7 ) ) -> ( -. ( v4 -> c4 ) -> -. ( ( v4 -> c4 ) -> ( v4 -> c4 ) ) ) ) ) ) ) ) ) ) ) $=
+      wc6 wc0 wv5 wi wn wc6 wv5 wi wc3 wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi wi
+      wc2 wv7 wi wc6 wv5 wc1 wi wi wi wv6 wc2 wi wv7 wn wi wv4 wi wc1 wv7 wi
+      wv6 wi wn wv0 wc1 wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi
+      wv4 wc4 wi wi wn wi wi wi wi wi wi wi wi wv6 wv0 wv6 wi wi wv9 wi wc6 wc0
+      wv5 wi wn wc6 wv5 wi wc3 wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi wi wc2 wv7 wi
+      wc6 wv5 wc1 wi wi wi wv6 wc2 wi wv7 wn wi wv4 wi wc1 wv7 wi wv6 wi wn wv0
+      wc1 wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi
+      wn wi wi wi wi wi wi wi wi wi wc0 wv5 wi wn wc6 wv5 wi wc3 wi wi wc2 wv7
+      wi wc6 wv5 wc1 wi wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi wi wv6 wc2 wi wv7 wn
+      wi wv4 wi wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn wc0 wv5 wi wv7 wn wi wi wv4
+      wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi wn wi wi wi wi wi wi wi wc6 wc0 wv5 wi
+      wn wc6 wv5 wi wc3 wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi wi wc2 wv7 wi wc6
+      wv5 wc1 wi wi wi wv6 wc2 wi wv7 wn wi wv4 wi wc1 wv7 wi wv6 wi wn wv0 wc1
+      wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi wn
+      wi wi wi wi wi wi wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi wi wc2 wv7 wi wc6
+      wv5 wc1 wi wi wi wv6 wc2 wi wv7 wn wi wv4 wi wc1 wv7 wi wv6 wi wn wv0 wc1
+      wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi wn
+      wi wi wi wi wi wi wc0 wv5 wi wn wc6 wv5 wi wc3 wi wi wc2 wv7 wi wc6 wv5
+      wc1 wi wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi wi wv6 wc2 wi wv7 wn wi wv4 wi
+      wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn
+      wv4 wc4 wi wv4 wc4 wi wi wn wi wi wi wi wi wi wi wc2 wv7 wi wc6 wv5 wc1
+      wi wi wi wv6 wc2 wi wv7 wn wi wv4 wi wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn
+      wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi wn wi wi
+      wi wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi wi
+      wv6 wc2 wi wv7 wn wi wv4 wi wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn wc0 wv5 wi
+      wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi wn wi wi wi wi wi wi
+      wv6 wc2 wi wv7 wn wi wv4 wi wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn wc0 wv5 wi
+      wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi wn wi wi wi wi wc2
+      wv7 wi wc6 wv5 wc1 wi wi wi wv6 wc2 wi wv7 wn wi wv4 wi wc1 wv7 wi wv6 wi
+      wn wv0 wc1 wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4
+      wi wi wn wi wi wi wi wi wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn wc0 wv5 wi wv7
+      wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi wn wi wi wi wv6 wc2 wi
+      wv7 wn wi wv4 wi wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn wc0 wv5 wi wv7 wn wi
+      wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi wn wi wi wi wi wv0 wc1 wi wn
+      wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi wn wi wi
+      wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn
+      wv4 wc4 wi wv4 wc4 wi wi wn wi wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi
+      wi wn wi wv0 wc1 wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi
+      wv4 wc4 wi wi wn wi wi wv4 wc4 wi wv4 wc4 wi ax-g7 wv4 wc4 wi wn wv4 wc4
+      wi wv4 wc4 wi wi wn wi wv0 wc1 wi wn wc0 wv5 wi wv7 wn wi wi ax-1 ax-mp
+      wv0 wc1 wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi
+      wi wn wi wi wc1 wv7 wi wv6 wi wn ax-1 ax-mp wc1 wv7 wi wv6 wi wn wv0 wc1
+      wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi wn
+      wi wi wi wv6 wc2 wi wv7 wn wi wv4 wi ax-1 ax-mp wv6 wc2 wi wv7 wn wi wv4
+      wi wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi
+      wn wv4 wc4 wi wv4 wc4 wi wi wn wi wi wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi
+      wi ax-1 ax-mp wc2 wv7 wi wc6 wv5 wc1 wi wi wi wv6 wc2 wi wv7 wn wi wv4 wi
+      wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4 wi wn
+      wv4 wc4 wi wv4 wc4 wi wi wn wi wi wi wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi
+      wi ax-1 ax-mp wc2 wv7 wi wc6 wv5 wc1 wi wi wi wc2 wv7 wi wc6 wv5 wc1 wi
+      wi wi wv6 wc2 wi wv7 wn wi wv4 wi wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn wc0
+      wv5 wi wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi wn wi wi wi wi
+      wi wi wc0 wv5 wi wn wc6 wv5 wi wc3 wi wi ax-1 ax-mp wc0 wv5 wi wn wc6 wv5
+      wi wc3 wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi
+      wi wv6 wc2 wi wv7 wn wi wv4 wi wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn wc0 wv5
+      wi wv7 wn wi wi wv4 wc4 wi wn wv4 wc4 wi wv4 wc4 wi wi wn wi wi wi wi wi
+      wi wi wc6 ax-1 ax-mp wc6 wc0 wv5 wi wn wc6 wv5 wi wc3 wi wi wc2 wv7 wi
+      wc6 wv5 wc1 wi wi wi wc2 wv7 wi wc6 wv5 wc1 wi wi wi wv6 wc2 wi wv7 wn wi
+      wv4 wi wc1 wv7 wi wv6 wi wn wv0 wc1 wi wn wc0 wv5 wi wv7 wn wi wi wv4 wc4
+      wi wn wv4 wc4 wi wv4 wc4 wi wi wn wi wi wi wi wi wi wi wi wv6 wv0 wv6 wi
+      wi wv9 wi ax-1 ax-mp $.
+  th112 $p |- ( -. ( ( v5 -> v5 ) -> ( v8 -> v3 ) ) -> ( -. v8 -> -. -. v8 ) ) $=
+      ( wn wi ax-g5 ax-1 ax-mp ) CDZIDZEZBBECAEEDZKEJKIFJIGHKLGH $.
+  th113 $p |- ( v7 -> ( v4 -> ( c8 -> ( -. ( ( v8 -> c9 ) -> ( v8 -> v8 ) ) -> ( ( v3 -> ( c1 -> ( v5 -> v4 ) ) ) -> ( c1 -> ( ( v2 -> v5 ) -> ( ( c8 -> -. v7 ) -> ( c6 -> ( ( c8 -> -. v7 ) -> ( v7 -> ( ( c8 -> -. v7 ) -> ( c6 -> ( -. ( v7 -> v7 ) -> -. ( c8 -> c8 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv4 wc8 wv8 wc9 wi wv8 wv8 wi wi wn wv3 wc1 wv5 wv4 wi wi wi wc1 wv2 wv5
+      wi wc8 wv7 wn wi wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7 wi wn
+      wc8 wc8 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi wv7 wv4 wc8 wv8 wc9
+      wi wv8 wv8 wi wi wn wv3 wc1 wv5 wv4 wi wi wi wc1 wv2 wv5 wi wc8 wv7 wn wi
+      wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8 wi wn wi wi
+      wi wi wi wi wi wi wi wi wi wi wi wi wc8 wv8 wc9 wi wv8 wv8 wi wi wn wv3
+      wc1 wv5 wv4 wi wi wi wc1 wv2 wv5 wi wc8 wv7 wn wi wc6 wc8 wv7 wn wi wv7
+      wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8 wi wn wi wi wi wi wi wi wi wi wi
+      wi wi wi wv4 wc8 wv8 wc9 wi wv8 wv8 wi wi wn wv3 wc1 wv5 wv4 wi wi wi wc1
+      wv2 wv5 wi wc8 wv7 wn wi wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7
+      wi wn wc8 wc8 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi wv8 wc9 wi wv8
+      wv8 wi wi wn wv3 wc1 wv5 wv4 wi wi wi wc1 wv2 wv5 wi wc8 wv7 wn wi wc6
+      wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8 wi wn wi wi wi
+      wi wi wi wi wi wi wi wi wc8 wv8 wc9 wi wv8 wv8 wi wi wn wv3 wc1 wv5 wv4
+      wi wi wi wc1 wv2 wv5 wi wc8 wv7 wn wi wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi
+      wc6 wv7 wv7 wi wn wc8 wc8 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wv3
+      wc1 wv5 wv4 wi wi wi wc1 wv2 wv5 wi wc8 wv7 wn wi wc6 wc8 wv7 wn wi wv7
+      wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8 wi wn wi wi wi wi wi wi wi wi wi
+      wi wv8 wc9 wi wv8 wv8 wi wi wn wv3 wc1 wv5 wv4 wi wi wi wc1 wv2 wv5 wi
+      wc8 wv7 wn wi wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8
+      wc8 wi wn wi wi wi wi wi wi wi wi wi wi wi wc1 wv2 wv5 wi wc8 wv7 wn wi
+      wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8 wi wn wi wi
+      wi wi wi wi wi wi wi wv3 wc1 wv5 wv4 wi wi wi wc1 wv2 wv5 wi wc8 wv7 wn
+      wi wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8 wi wn wi
+      wi wi wi wi wi wi wi wi wi wv2 wv5 wi wc8 wv7 wn wi wc6 wc8 wv7 wn wi wv7
+      wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8 wi wn wi wi wi wi wi wi wi wi wc1
+      wv2 wv5 wi wc8 wv7 wn wi wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7
+      wi wn wc8 wc8 wi wn wi wi wi wi wi wi wi wi wi wc8 wv7 wn wi wc6 wc8 wv7
+      wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8 wi wn wi wi wi wi wi wi
+      wi wv2 wv5 wi wc8 wv7 wn wi wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7
+      wv7 wi wn wc8 wc8 wi wn wi wi wi wi wi wi wi wi wv7 wc8 wc8 wv7 th22 wc8
+      wv7 wn wi wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8
+      wi wn wi wi wi wi wi wi wi wv2 wv5 wi ax-1 ax-mp wv2 wv5 wi wc8 wv7 wn wi
+      wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8 wi wn wi wi
+      wi wi wi wi wi wi wc1 ax-1 ax-mp wc1 wv2 wv5 wi wc8 wv7 wn wi wc6 wc8 wv7
+      wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8 wi wn wi wi wi wi wi wi
+      wi wi wi wv3 wc1 wv5 wv4 wi wi wi ax-1 ax-mp wv3 wc1 wv5 wv4 wi wi wi wc1
+      wv2 wv5 wi wc8 wv7 wn wi wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7
+      wi wn wc8 wc8 wi wn wi wi wi wi wi wi wi wi wi wi wv8 wc9 wi wv8 wv8 wi
+      wi wn ax-1 ax-mp wv8 wc9 wi wv8 wv8 wi wi wn wv3 wc1 wv5 wv4 wi wi wi wc1
+      wv2 wv5 wi wc8 wv7 wn wi wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7
+      wi wn wc8 wc8 wi wn wi wi wi wi wi wi wi wi wi wi wi wc8 ax-1 ax-mp wc8
+      wv8 wc9 wi wv8 wv8 wi wi wn wv3 wc1 wv5 wv4 wi wi wi wc1 wv2 wv5 wi wc8
+      wv7 wn wi wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8
+      wi wn wi wi wi wi wi wi wi wi wi wi wi wi wv4 ax-1 ax-mp wv4 wc8 wv8 wc9
+      wi wv8 wv8 wi wi wn wv3 wc1 wv5 wv4 wi wi wi wc1 wv2 wv5 wi wc8 wv7 wn wi
+      wc6 wc8 wv7 wn wi wv7 wc8 wv7 wn wi wc6 wv7 wv7 wi wn wc8 wc8 wi wn wi wi
+      wi wi wi wi wi wi wi wi wi wi wi wv7 ax-1 ax-mp $.
+  th114 $p |- ( ( ( ( c5 -> v3 ) -> ( v8 -> v4 ) ) -> ( ( v2 -> v1 ) -> v8 ) ) -> ( ( v9 -> v1 ) -> ( ( v2 -> -. ( v8 -> c1 ) ) -> ( ( v2 -> -. ( v8 -> c1 ) ) -> ( v5 -> ( v3 -> ( ( ( ( v1 -> c3 ) -> c5 ) -> v9 ) -> ( ( v5 -> v3 ) -> ( ( v3 -> v3 ) -> ( -. ( v3 -> v3 ) -> -. ( ( v3 -> v3 ) -> ( v3 -> v3 ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wv6 wi wc5 wc1 wn wc3 ax-1 th6 ax-mp ) HHHIIZJCIFDIIBAIFIIZGAIZBFKILIZT
+      ECAMIJIGIZECICCICCILCCICCIILIIIZIZIZIZIZIZIZIZHHNUIQUIIUHUIUGUHUFUGUEUFUD
+      UEUCUDUBUCCCCEOUBUANPUCCNPUDENPUETNPUFTNPUGSNPUHRNPUIQNPP $.
+  th115 $p |- ( v0 -> ( ( v2 -> -. ( v7 -> v6 ) ) -> ( v0 -> ( -. v9 -> ( v1 -> ( ( v2 -> -. ( v7 -> v6 ) ) -> ( ( v0 -> -. ( c4 -> c2 ) ) -> ( c4 -> ( c0 -> ( ( v1 -> c4 ) -> ( v1 -> c4 ) ) ) ) ) ) ) ) ) ) ) $=
+      wv2 wv7 wv6 wi wn wi wv0 wv9 wn wv1 wv2 wv7 wv6 wi wn wi wv0 wc4 wc2 wi
+      wn wi wc4 wc0 wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi wi wi wi wv0 wv2
+      wv7 wv6 wi wn wi wv0 wv9 wn wv1 wv2 wv7 wv6 wi wn wi wv0 wc4 wc2 wi wn wi
+      wc4 wc0 wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi wi wi wi wi wv0 wv9 wn
+      wv1 wv2 wv7 wv6 wi wn wi wv0 wc4 wc2 wi wn wi wc4 wc0 wv1 wc4 wi wv1 wc4
+      wi wi wi wi wi wi wi wi wi wv2 wv7 wv6 wi wn wi wv0 wv9 wn wv1 wv2 wv7
+      wv6 wi wn wi wv0 wc4 wc2 wi wn wi wc4 wc0 wv1 wc4 wi wv1 wc4 wi wi wi wi
+      wi wi wi wi wi wi wv9 wn wv1 wv2 wv7 wv6 wi wn wi wv0 wc4 wc2 wi wn wi
+      wc4 wc0 wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi wi wv0 wv9 wn wv1 wv2 wv7
+      wv6 wi wn wi wv0 wc4 wc2 wi wn wi wc4 wc0 wv1 wc4 wi wv1 wc4 wi wi wi wi
+      wi wi wi wi wi wv1 wv2 wv7 wv6 wi wn wi wv0 wc4 wc2 wi wn wi wc4 wc0 wv1
+      wc4 wi wv1 wc4 wi wi wi wi wi wi wi wv9 wn wv1 wv2 wv7 wv6 wi wn wi wv0
+      wc4 wc2 wi wn wi wc4 wc0 wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi wi wv2
+      wv7 wv6 wi wn wi wv0 wc4 wc2 wi wn wi wc4 wc0 wv1 wc4 wi wv1 wc4 wi wi wi
+      wi wi wi wv1 wv2 wv7 wv6 wi wn wi wv0 wc4 wc2 wi wn wi wc4 wc0 wv1 wc4 wi
+      wv1 wc4 wi wi wi wi wi wi wi wv0 wc4 wc2 wi wn wi wc4 wc0 wv1 wc4 wi wv1
+      wc4 wi wi wi wi wi wv2 wv7 wv6 wi wn wi wv0 wc4 wc2 wi wn wi wc4 wc0 wv1
+      wc4 wi wv1 wc4 wi wi wi wi wi wi wc4 wv0 wc4 wv1 wc2 th1 wv0 wc4 wc2 wi
+      wn wi wc4 wc0 wv1 wc4 wi wv1 wc4 wi wi wi wi wi wv2 wv7 wv6 wi wn wi ax-1
+      ax-mp wv2 wv7 wv6 wi wn wi wv0 wc4 wc2 wi wn wi wc4 wc0 wv1 wc4 wi wv1
+      wc4 wi wi wi wi wi wi wv1 ax-1 ax-mp wv1 wv2 wv7 wv6 wi wn wi wv0 wc4 wc2
+      wi wn wi wc4 wc0 wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi wv9 wn ax-1
+      ax-mp wv9 wn wv1 wv2 wv7 wv6 wi wn wi wv0 wc4 wc2 wi wn wi wc4 wc0 wv1
+      wc4 wi wv1 wc4 wi wi wi wi wi wi wi wi wv0 ax-1 ax-mp wv0 wv9 wn wv1 wv2
+      wv7 wv6 wi wn wi wv0 wc4 wc2 wi wn wi wc4 wc0 wv1 wc4 wi wv1 wc4 wi wi wi
+      wi wi wi wi wi wi wv2 wv7 wv6 wi wn wi ax-1 ax-mp wv2 wv7 wv6 wi wn wi
+      wv0 wv9 wn wv1 wv2 wv7 wv6 wi wn wi wv0 wc4 wc2 wi wn wi wc4 wc0 wv1 wc4
+      wi wv1 wc4 wi wi wi wi wi wi wi wi wi wi wv0 ax-1 ax-mp $.
+  th116 $p |- ( c3 -> ( v5 -> ( ( ( ( v4 -> c2 ) -> c0 ) -> ( ( v4 -> c9 ) -> -. v0 ) ) -> ( c2 -> ( v0 -> ( v9 -> ( ( ( ( v4 -> v8 ) -> c1 ) -> ( v6 -> -. v1 ) ) -> ( ( ( ( v6 -> v6 ) -> v6 ) -> ( v3 -> v6 ) ) -> ( ( v5 -> ( v0 -> v0 ) ) -> ( ( v5 -> v0 ) -> ( v5 -> v0 ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wv2 wi wc3 wc2 wc0 wc9 wn wc1 ax-1 ax-2 ax-mp ) IIIJJZKEDLJMJDNJAOJJZLA
+      HDGJPJFBOJJZFFJFJCFJJZEAAJJEAJEAJJJZJZJZJZJZJZJZJZJZIIQULTULJUKULUJUKUIUJ
+      UHUIUGUHUFUGUEUFUDUEEAARUDUCQSUEUBQSUFHQSUGAQSUHLQSUIUAQSUJEQSUKKQSULTQSS
+      $.
+  th117 $p |- ( v1 -> ( -. ( ( v4 -> c8 ) -> v3 ) -> ( -. ( v1 -> v3 ) -> -. ( ( v0 -> v1 ) -> ( v0 -> v1 ) ) ) ) ) $=
+      ( wv5 wi wc8 wn ax-1 ax-g7 ax-mp ) EEEFFZBDGFCFHZBCFZHABFZOFHFZFZFZEEIRLR
+      FQRPQNOJPMIKQBIKRLIKK $.
+  th118 $p |- ( ( ( v7 -> ( v8 -> v7 ) ) -> ( ( c7 -> c3 ) -> v3 ) ) -> ( ( v8 -> ( -. c0 -> ( v1 -> v0 ) ) ) -> ( v4 -> ( ( -. v1 -> ( v9 -> ( v4 -> c2 ) ) ) -> ( ( ( ( v0 -> c6 ) -> -. v4 ) -> ( ( v2 -> v1 ) -> c1 ) ) -> ( ( ( ( v0 -> c6 ) -> -. v4 ) -> ( ( v2 -> v1 ) -> c1 ) ) -> ( ( ( c4 -> v1 ) -> ( ( c4 -> v1 ) -> v8 ) ) -> ( ( ( c4 -> v1 ) -> ( c4 -> v1 ) ) -> ( ( c4 -> v1 ) -> v8 ) ) ) ) ) ) ) ) ) $=
+      ( wc0 wn wi wc2 wc6 wc1 wc4 wc7 wc3 ax-2 ax-1 ax-mp ) GIJBAKKKZEBJHELKKKZ
+      AMKEJKCBKNKKZUCOBKZUDGKKUDUDKUDGKKKZKZKZKZKZKZFGFKKPQKDKKZUJKUIUJUHUIUGUH
+      UFUGUEUFUDUDGRUEUCSTUFUCSTUGUBSTUHESTUIUASTUJUKST $.
+  th119 $p |- ( ( v2 -> ( ( v0 -> v3 ) -> ( c5 -> c9 ) ) ) -> ( ( ( -. c3 -> ( v1 -> v5 ) ) -> ( ( c5 -> c4 ) -> ( v2 -> v8 ) ) ) -> ( ( ( v5 -> c0 ) -> c0 ) -> -. ( ( v5 -> c0 ) -> ( v5 -> c0 ) ) ) ) ) $=
+      wv6 wv6 wv6 wi wi wv2 wv0 wv3 wi wc5 wc9 wi wi wi wc3 wn wv1 wv5 wi wi
+      wc5 wc4 wi wv2 wv8 wi wi wi wv5 wc0 wi wc0 wi wv5 wc0 wi wv5 wc0 wi wi wn
+      wi wi wi wv6 wv6 ax-1 wv2 wv0 wv3 wi wc5 wc9 wi wi wi wc3 wn wv1 wv5 wi
+      wi wc5 wc4 wi wv2 wv8 wi wi wi wv5 wc0 wi wc0 wi wv5 wc0 wi wv5 wc0 wi wi
+      wn wi wi wi wv6 wv6 wv6 wi wi wv2 wv0 wv3 wi wc5 wc9 wi wi wi wc3 wn wv1
+      wv5 wi wi wc5 wc4 wi wv2 wv8 wi wi wi wv5 wc0 wi wc0 wi wv5 wc0 wi wv5
+      wc0 wi wi wn wi wi wi wi wc3 wn wv1 wv5 wi wi wc5 wc4 wi wv2 wv8 wi wi wi
+      wv5 wc0 wi wc0 wi wv5 wc0 wi wv5 wc0 wi wi wn wi wi wv2 wv0 wv3 wi wc5
+      wc9 wi wi wi wc3 wn wv1 wv5 wi wi wc5 wc4 wi wv2 wv8 wi wi wi wv5 wc0 wi
+      wc0 wi wv5 wc0 wi wv5 wc0 wi wi wn wi wi wi wv5 wc0 wi wc0 wi wv5 wc0 wi
+      wv5 wc0 wi wi wn wi wc3 wn wv1 wv5 wi wi wc5 wc4 wi wv2 wv8 wi wi wi wv5
+      wc0 wi wc0 wi wv5 wc0 wi wv5 wc0 wi wi wn wi wi wv5 wc0 wi wv5 wc0 wi wc0
+      wv5 wc0 wi ax-g0 wv5 wc0 wi wc0 wi wv5 wc0 wi wv5 wc0 wi wi wn wi wc3 wn
+      wv1 wv5 wi wi wc5 wc4 wi wv2 wv8 wi wi wi ax-1 ax-mp wc3 wn wv1 wv5 wi wi
+      wc5 wc4 wi wv2 wv8 wi wi wi wv5 wc0 wi wc0 wi wv5 wc0 wi wv5 wc0 wi wi wn
+      wi wi wv2 wv0 wv3 wi wc5 wc9 wi wi wi ax-1 ax-mp wv2 wv0 wv3 wi wc5 wc9
+      wi wi wi wc3 wn wv1 wv5 wi wi wc5 wc4 wi wv2 wv8 wi wi wi wv5 wc0 wi wc0
+      wi wv5 wc0 wi wv5 wc0 wi wi wn wi wi wi wv6 wv6 wv6 wi wi ax-1 ax-mp
+      ax-mp $.
+  th120 $p |- ( ( ( ( v1 -> c8 ) -> ( v8 -> c0 ) ) -> ( ( v0 -> v5 ) -> -. v8 ) ) -> ( -. ( ( v1 -> v7 ) -> -. v7 ) -> ( ( v3 -> ( ( v4 -> v7 ) -> ( v6 -> v8 ) ) ) -> ( ( v3 -> ( ( v4 -> v7 ) -> ( v6 -> v8 ) ) ) -> ( c1 -> ( ( c3 -> ( ( c1 -> c5 ) -> ( c1 -> v5 ) ) ) -> ( ( ( c5 -> c1 ) -> ( c5 -> c1 ) ) -> -. ( c1 -> ( c6 -> c5 ) ) ) ) ) ) ) ) ) $=
+      ( wi wn wc1 wc3 wc5 wc6 wc8 wc0 th56 ax-1 ax-mp ) BGIGJIJZCDGIFHIIIZUAKLK
+      MIKEIIIMKIMKIIKNMIIJIIIZIZIZIZBOIHPIIAEIHJIIZUEIUDUEUCUDUBUCMKEMKKQUBUARS
+      UCUARSUDTRSUEUFRS $.
+  th121 $p |- ( c8 -> ( v9 -> ( c3 -> ( ( ( ( c3 -> v6 ) -> ( v1 -> c8 ) ) -> ( ( c7 -> c7 ) -> ( c3 -> c8 ) ) ) -> ( c3 -> ( ( -. ( c7 -> c7 ) -> ( v6 -> ( c7 -> v9 ) ) ) -> ( ( c0 -> v9 ) -> -. ( c0 -> v9 ) ) ) ) ) ) ) ) $=
+      wv9 wc3 wc3 wv6 wi wv1 wc8 wi wi wc7 wc7 wi wc3 wc8 wi wi wi wc3 wc7 wc7
+      wi wn wv6 wc7 wv9 wi wi wi wc0 wv9 wi wc0 wv9 wi wn wi wi wi wi wi wi wc8
+      wv9 wc3 wc3 wv6 wi wv1 wc8 wi wi wc7 wc7 wi wc3 wc8 wi wi wi wc3 wc7 wc7
+      wi wn wv6 wc7 wv9 wi wi wi wc0 wv9 wi wc0 wv9 wi wn wi wi wi wi wi wi wi
+      wc7 wc3 wc7 wc7 wc8 wc8 wv9 wv9 wv1 wv6 th101 wv9 wc3 wc3 wv6 wi wv1 wc8
+      wi wi wc7 wc7 wi wc3 wc8 wi wi wi wc3 wc7 wc7 wi wn wv6 wc7 wv9 wi wi wi
+      wc0 wv9 wi wc0 wv9 wi wn wi wi wi wi wi wi wc8 ax-1 ax-mp $.
+  th122 $p |- ( -. ( c3 -> ( v0 -> c1 ) ) -> ( -. c1 -> ( -. c1 -> ( c8 -> ( ( ( -. c1 -> ( v9 -> v4 ) ) -> ( -. c1 -> ( v9 -> v4 ) ) ) -> ( ( ( ( v4 -> c1 ) -> ( c7 -> c7 ) ) -> ( v4 -> ( c1 -> v4 ) ) ) -> -. -. c1 ) ) ) ) ) ) $=
+      wc1 wn wc1 wn wc8 wc1 wn wv9 wv4 wi wi wc1 wn wv9 wv4 wi wi wi wv4 wc1 wi
+      wc7 wc7 wi wi wv4 wc1 wv4 wi wi wi wc1 wn wn wi wi wi wi wi wc3 wv0 wc1
+      wi wi wn wc1 wn wc1 wn wc8 wc1 wn wv9 wv4 wi wi wc1 wn wv9 wv4 wi wi wi
+      wv4 wc1 wi wc7 wc7 wi wi wv4 wc1 wv4 wi wi wi wc1 wn wn wi wi wi wi wi wi
+      wc7 wv4 wv4 wc1 wc1 wv9 wv9 th96 wc1 wn wc1 wn wc8 wc1 wn wv9 wv4 wi wi
+      wc1 wn wv9 wv4 wi wi wi wv4 wc1 wi wc7 wc7 wi wi wv4 wc1 wv4 wi wi wi wc1
+      wn wn wi wi wi wi wi wc3 wv0 wc1 wi wi wn ax-1 ax-mp $.
+  th123 $p |- ( -. c3 -> -. c3 ) $=
+      ( wc3 wn wi ax-g4 ax-1 ax-mp ) ABZGGCGDGGEF $.
+  th124 $p |- ( ( v5 -> ( ( v1 -> v3 ) -> ( v1 -> v2 ) ) ) -> ( -. ( c5 -> v6 ) -> ( -. ( c0 -> v2 ) -> ( ( c0 -> v2 ) -> ( c0 -> v2 ) ) ) ) ) $=
+      ( wc5 wi wn wc0 ax-g9 ax-1 ax-mp ) FEGHIBGZHMMGGGZDACGABGGGZNGFEMMJNOKL
+      $.
+  th125 $p |- ( v8 -> ( -. -. -. c5 -> ( ( ( ( v9 -> c3 ) -> v6 ) -> v0 ) -> ( v1 -> ( v8 -> ( ( ( -. v0 -> ( v9 -> c9 ) ) -> ( v7 -> -. v9 ) ) -> ( ( v6 -> ( v5 -> v8 ) ) -> ( ( c6 -> c2 ) -> ( ( ( ( v6 -> c9 ) -> ( c9 -> c6 ) ) -> ( ( v8 -> c7 ) -> c8 ) ) -> ( -. ( v6 -> c4 ) -> ( ( ( ( v8 -> c7 ) -> -. c0 ) -> ( ( c0 -> v6 ) -> ( v5 -> c7 ) ) ) -> ( ( v6 -> ( c8 -> ( v6 -> v6 ) ) ) -> -. ( ( ( v8 -> c7 ) -> ( c6 -> c2 ) ) -> ( ( v8 -> c7 ) -> ( v8 -> c7 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wv4 wi wc5 wn wc3 wc9 wc6 wc2 wc7 wc8 wc4 wc0 ax-1 th60 ax-mp )
+      HHHIIZFJKKKZGLIDIAIZBFAKGMIIEGKIIZDCFIINOIDMIMNIIFPIQIIDRIKFPISKISDICPIII
+      DQDDIIIFPINOIIFPIFPIIIKIIIIIIZIZIZIZIZIZIZHHTUMUCUMIULUMUKULUJUKUIUJUHUIU
+      GUHDDCMFFDCFPUAUGUFTUBUHFTUBUIBTUBUJUETUBUKUDTUBULFTUBUMUCTUBUB $.
+  th126 $p |- ( ( ( ( c5 -> v2 ) -> v0 ) -> ( ( c5 -> v8 ) -> ( v9 -> v0 ) ) ) -> ( v0 -> ( -. -. ( v5 -> c8 ) -> ( -. ( ( c6 -> v2 ) -> v7 ) -> ( -. v1 -> ( -. -. -. v1 -> ( ( v1 -> -. v1 ) -> ( ( -. ( c9 -> v8 ) -> ( c4 -> ( v9 -> v3 ) ) ) -> ( -. ( c9 -> ( v1 -> c5 ) ) -> ( -. ( v2 -> c8 ) -> ( c9 -> ( v2 -> c8 ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv0 wv5 wc8 wi wn wn wc6 wv2 wi wv7 wi wn wv1 wn wv1 wn wn wn wv1 wv1 wn
+      wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn
+      wc9 wv2 wc8 wi wi wi wi wi wi wi wi wi wi wi wc5 wv2 wi wv0 wi wc5 wv8 wi
+      wv9 wv0 wi wi wi wv0 wv5 wc8 wi wn wn wc6 wv2 wi wv7 wi wn wv1 wn wv1 wn
+      wn wn wv1 wv1 wn wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi
+      wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi wi wi wi wi wi wi wi wv5 wc8
+      wi wn wn wc6 wv2 wi wv7 wi wn wv1 wn wv1 wn wn wn wv1 wv1 wn wi wc9 wv8
+      wi wn wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2 wc8
+      wi wi wi wi wi wi wi wi wi wi wv0 wv5 wc8 wi wn wn wc6 wv2 wi wv7 wi wn
+      wv1 wn wv1 wn wn wn wv1 wv1 wn wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi wc9
+      wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi wi wi wi wi wi
+      wi wc6 wv2 wi wv7 wi wn wv1 wn wv1 wn wn wn wv1 wv1 wn wi wc9 wv8 wi wn
+      wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi
+      wi wi wi wi wi wi wi wv5 wc8 wi wn wn wc6 wv2 wi wv7 wi wn wv1 wn wv1 wn
+      wn wn wv1 wv1 wn wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi
+      wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi wi wi wi wi wi wv1 wn wv1 wn
+      wn wn wv1 wv1 wn wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi
+      wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi wi wi wi wc6 wv2 wi wv7 wi wn
+      wv1 wn wv1 wn wn wn wv1 wv1 wn wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi wc9
+      wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi wi wi wi wi wv1
+      wn wn wn wv1 wv1 wn wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi
+      wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi wi wi wv1 wn wv1 wn wn wn
+      wv1 wv1 wn wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi wn wv2
+      wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi wi wi wi wv1 wv1 wn wi wc9 wv8 wi wn
+      wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi
+      wi wi wi wi wv1 wn wn wn wv1 wv1 wn wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi
+      wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi wi wi wc9
+      wv8 wi wn wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2
+      wc8 wi wi wi wi wi wv1 wv1 wn wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi wc9
+      wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi wi wc9 wv1 wc5
+      wi wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wc9 wv8 wi wn wc4 wv9 wv3
+      wi wi wi wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi
+      wc9 wv1 wc5 wi wc9 wv2 wc8 wi ax-g9 wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn
+      wc9 wv2 wc8 wi wi wi wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi ax-1 ax-mp wc9
+      wv8 wi wn wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2
+      wc8 wi wi wi wi wi wv1 wv1 wn wi ax-1 ax-mp wv1 wv1 wn wi wc9 wv8 wi wn
+      wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi
+      wi wi wi wi wv1 wn wn wn ax-1 ax-mp wv1 wn wn wn wv1 wv1 wn wi wc9 wv8 wi
+      wn wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi
+      wi wi wi wi wi wi wv1 wn ax-1 ax-mp wv1 wn wv1 wn wn wn wv1 wv1 wn wi wc9
+      wv8 wi wn wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2
+      wc8 wi wi wi wi wi wi wi wi wc6 wv2 wi wv7 wi wn ax-1 ax-mp wc6 wv2 wi
+      wv7 wi wn wv1 wn wv1 wn wn wn wv1 wv1 wn wi wc9 wv8 wi wn wc4 wv9 wv3 wi
+      wi wi wc9 wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi wi wi
+      wi wi wv5 wc8 wi wn wn ax-1 ax-mp wv5 wc8 wi wn wn wc6 wv2 wi wv7 wi wn
+      wv1 wn wv1 wn wn wn wv1 wv1 wn wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi wc9
+      wv1 wc5 wi wi wn wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi wi wi wi wi wi
+      wv0 ax-1 ax-mp wv0 wv5 wc8 wi wn wn wc6 wv2 wi wv7 wi wn wv1 wn wv1 wn wn
+      wn wv1 wv1 wn wi wc9 wv8 wi wn wc4 wv9 wv3 wi wi wi wc9 wv1 wc5 wi wi wn
+      wv2 wc8 wi wn wc9 wv2 wc8 wi wi wi wi wi wi wi wi wi wi wi wc5 wv2 wi wv0
+      wi wc5 wv8 wi wv9 wv0 wi wi wi ax-1 ax-mp $.
+  th127 $p |- ( ( ( ( v3 -> v4 ) -> c4 ) -> v6 ) -> ( ( v0 -> v2 ) -> ( ( ( ( c9 -> v5 ) -> -. c6 ) -> ( ( v8 -> v5 ) -> c5 ) ) -> ( ( v5 -> c9 ) -> -. ( v5 -> c9 ) ) ) ) ) $=
+      wv0 wv2 wi wc9 wv5 wi wc6 wn wi wv8 wv5 wi wc5 wi wi wv5 wc9 wi wv5 wc9
+      wi wn wi wi wi wv3 wv4 wi wc4 wi wv6 wi wv0 wv2 wi wc9 wv5 wi wc6 wn wi
+      wv8 wv5 wi wc5 wi wi wv5 wc9 wi wv5 wc9 wi wn wi wi wi wi wc9 wv5 wi wc6
+      wn wi wv8 wv5 wi wc5 wi wi wv5 wc9 wi wv5 wc9 wi wn wi wi wv0 wv2 wi wc9
+      wv5 wi wc6 wn wi wv8 wv5 wi wc5 wi wi wv5 wc9 wi wv5 wc9 wi wn wi wi wi
+      wv5 wc9 wi wv5 wc9 wi wn wi wc9 wv5 wi wc6 wn wi wv8 wv5 wi wc5 wi wi wv5
+      wc9 wi wv5 wc9 wi wn wi wi wv5 wc9 wi wn wv5 wc9 wi wv5 wc9 wi wn wi wv5
+      wc9 wi ax-g5 wv5 wc9 wi wn wv5 wc9 wi ax-1 ax-mp wv5 wc9 wi wv5 wc9 wi wn
+      wi wc9 wv5 wi wc6 wn wi wv8 wv5 wi wc5 wi wi ax-1 ax-mp wc9 wv5 wi wc6 wn
+      wi wv8 wv5 wi wc5 wi wi wv5 wc9 wi wv5 wc9 wi wn wi wi wv0 wv2 wi ax-1
+      ax-mp wv0 wv2 wi wc9 wv5 wi wc6 wn wi wv8 wv5 wi wc5 wi wi wv5 wc9 wi wv5
+      wc9 wi wn wi wi wi wv3 wv4 wi wc4 wi wv6 wi ax-1 ax-mp $.
+  th128 $p |- ( ( ( ( v1 -> v4 ) -> c6 ) -> ( v0 -> ( v5 -> c6 ) ) ) -> ( ( v6 -> v9 ) -> ( -. -. ( c5 -> c4 ) -> ( ( c3 -> ( ( v8 -> c6 ) -> v9 ) ) -> ( ( v8 -> v3 ) -> ( ( v6 -> v9 ) -> ( ( v8 -> v3 ) -> ( v6 -> v9 ) ) ) ) ) ) ) ) $=
+      wv2 wv2 wv2 wi wi wv1 wv4 wi wc6 wi wv0 wv5 wc6 wi wi wi wv6 wv9 wi wc5
+      wc4 wi wn wn wc3 wv8 wc6 wi wv9 wi wi wv8 wv3 wi wv6 wv9 wi wv8 wv3 wi
+      wv6 wv9 wi wi wi wi wi wi wi wi wv2 wv2 ax-1 wv1 wv4 wi wc6 wi wv0 wv5
+      wc6 wi wi wi wv6 wv9 wi wc5 wc4 wi wn wn wc3 wv8 wc6 wi wv9 wi wi wv8 wv3
+      wi wv6 wv9 wi wv8 wv3 wi wv6 wv9 wi wi wi wi wi wi wi wi wv2 wv2 wv2 wi
+      wi wv1 wv4 wi wc6 wi wv0 wv5 wc6 wi wi wi wv6 wv9 wi wc5 wc4 wi wn wn wc3
+      wv8 wc6 wi wv9 wi wi wv8 wv3 wi wv6 wv9 wi wv8 wv3 wi wv6 wv9 wi wi wi wi
+      wi wi wi wi wi wv6 wv9 wi wc5 wc4 wi wn wn wc3 wv8 wc6 wi wv9 wi wi wv8
+      wv3 wi wv6 wv9 wi wv8 wv3 wi wv6 wv9 wi wi wi wi wi wi wi wv1 wv4 wi wc6
+      wi wv0 wv5 wc6 wi wi wi wv6 wv9 wi wc5 wc4 wi wn wn wc3 wv8 wc6 wi wv9 wi
+      wi wv8 wv3 wi wv6 wv9 wi wv8 wv3 wi wv6 wv9 wi wi wi wi wi wi wi wi wc5
+      wc4 wi wn wn wc3 wv8 wc6 wi wv9 wi wi wv8 wv3 wi wv6 wv9 wi wv8 wv3 wi
+      wv6 wv9 wi wi wi wi wi wi wv6 wv9 wi wc5 wc4 wi wn wn wc3 wv8 wc6 wi wv9
+      wi wi wv8 wv3 wi wv6 wv9 wi wv8 wv3 wi wv6 wv9 wi wi wi wi wi wi wi wc3
+      wv8 wc6 wi wv9 wi wi wv8 wv3 wi wv6 wv9 wi wv8 wv3 wi wv6 wv9 wi wi wi wi
+      wi wc5 wc4 wi wn wn wc3 wv8 wc6 wi wv9 wi wi wv8 wv3 wi wv6 wv9 wi wv8
+      wv3 wi wv6 wv9 wi wi wi wi wi wi wv8 wv3 wi wv6 wv9 wi wv8 wv3 wi wv6 wv9
+      wi wi wi wi wc3 wv8 wc6 wi wv9 wi wi wv8 wv3 wi wv6 wv9 wi wv8 wv3 wi wv6
+      wv9 wi wi wi wi wi wv6 wv9 wi wv8 wv3 wi wv6 wv9 wi wi wi wv8 wv3 wi wv6
+      wv9 wi wv8 wv3 wi wv6 wv9 wi wi wi wi wv6 wv9 wi wv8 wv3 wi ax-1 wv6 wv9
+      wi wv8 wv3 wi wv6 wv9 wi wi wi wv8 wv3 wi ax-1 ax-mp wv8 wv3 wi wv6 wv9
+      wi wv8 wv3 wi wv6 wv9 wi wi wi wi wc3 wv8 wc6 wi wv9 wi wi ax-1 ax-mp wc3
+      wv8 wc6 wi wv9 wi wi wv8 wv3 wi wv6 wv9 wi wv8 wv3 wi wv6 wv9 wi wi wi wi
+      wi wc5 wc4 wi wn wn ax-1 ax-mp wc5 wc4 wi wn wn wc3 wv8 wc6 wi wv9 wi wi
+      wv8 wv3 wi wv6 wv9 wi wv8 wv3 wi wv6 wv9 wi wi wi wi wi wi wv6 wv9 wi
+      ax-1 ax-mp wv6 wv9 wi wc5 wc4 wi wn wn wc3 wv8 wc6 wi wv9 wi wi wv8 wv3
+      wi wv6 wv9 wi wv8 wv3 wi wv6 wv9 wi wi wi wi wi wi wi wv1 wv4 wi wc6 wi
+      wv0 wv5 wc6 wi wi wi ax-1 ax-mp wv1 wv4 wi wc6 wi wv0 wv5 wc6 wi wi wi
+      wv6 wv9 wi wc5 wc4 wi wn wn wc3 wv8 wc6 wi wv9 wi wi wv8 wv3 wi wv6 wv9
+      wi wv8 wv3 wi wv6 wv9 wi wi wi wi wi wi wi wi wv2 wv2 wv2 wi wi ax-1
+      ax-mp ax-mp $.
+  th129 $p |- ( ( v4 -> v6 ) -> ( c3 -> ( ( c1 -> ( ( v2 -> c3 ) -> ( c9 -> v4 ) ) ) -> ( c3 -> ( ( c1 -> ( ( v2 -> c3 ) -> ( c9 -> v4 ) ) ) -> ( v4 -> v6 ) ) ) ) ) ) $=
+      wv5 wv5 wv5 wi wi wv4 wv6 wi wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi wi wc3 wc1
+      wv2 wc3 wi wc9 wv4 wi wi wi wv4 wv6 wi wi wi wi wi wi wv5 wv5 ax-1 wv4
+      wv6 wi wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi wi wc3 wc1 wv2 wc3 wi wc9 wv4 wi
+      wi wi wv4 wv6 wi wi wi wi wi wi wv5 wv5 wv5 wi wi wv4 wv6 wi wc3 wc1 wv2
+      wc3 wi wc9 wv4 wi wi wi wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi wi wv4 wv6 wi wi
+      wi wi wi wi wi wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi wi wc3 wc1 wv2 wc3 wi wc9
+      wv4 wi wi wi wv4 wv6 wi wi wi wi wi wv4 wv6 wi wc3 wc1 wv2 wc3 wi wc9 wv4
+      wi wi wi wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi wi wv4 wv6 wi wi wi wi wi wi
+      wc1 wv2 wc3 wi wc9 wv4 wi wi wi wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi wi wv4
+      wv6 wi wi wi wi wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi wi wc3 wc1 wv2 wc3 wi
+      wc9 wv4 wi wi wi wv4 wv6 wi wi wi wi wi wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi
+      wi wv4 wv6 wi wi wi wc1 wv2 wc3 wi wc9 wv4 wi wi wi wc3 wc1 wv2 wc3 wi
+      wc9 wv4 wi wi wi wv4 wv6 wi wi wi wi wc1 wv2 wc3 wi wc9 wv4 wi wi wi wv4
+      wv6 wi wi wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi wi wv4 wv6 wi wi wi wv4 wv6 wi
+      wc1 wv2 wc3 wi wc9 wv4 wi wi wi wv4 wv6 wi wi wv4 wv6 wi ax-g6 wv4 wv6 wi
+      wc1 wv2 wc3 wi wc9 wv4 wi wi wi ax-1 ax-mp wc1 wv2 wc3 wi wc9 wv4 wi wi
+      wi wv4 wv6 wi wi wc3 ax-1 ax-mp wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi wi wv4
+      wv6 wi wi wi wc1 wv2 wc3 wi wc9 wv4 wi wi wi ax-1 ax-mp wc1 wv2 wc3 wi
+      wc9 wv4 wi wi wi wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi wi wv4 wv6 wi wi wi wi
+      wc3 ax-1 ax-mp wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi wi wc3 wc1 wv2 wc3 wi wc9
+      wv4 wi wi wi wv4 wv6 wi wi wi wi wi wv4 wv6 wi ax-1 ax-mp wv4 wv6 wi wc3
+      wc1 wv2 wc3 wi wc9 wv4 wi wi wi wc3 wc1 wv2 wc3 wi wc9 wv4 wi wi wi wv4
+      wv6 wi wi wi wi wi wi wv5 wv5 wv5 wi wi ax-1 ax-mp ax-mp $.
+  th130 $p |- ( -. ( c0 -> ( v6 -> c8 ) ) -> ( -. ( v2 -> -. c4 ) -> ( ( ( ( v5 -> c6 ) -> c0 ) -> ( c8 -> v8 ) ) -> ( ( -. ( v8 -> v3 ) -> c9 ) -> ( ( v8 -> ( ( v9 -> v3 ) -> ( v6 -> v0 ) ) ) -> ( ( -. ( c7 -> v2 ) -> -. ( c7 -> v2 ) ) -> ( ( c7 -> v2 ) -> ( c7 -> v2 ) ) ) ) ) ) ) ) $=
+      wv7 wv7 wv7 wi wi wc0 wv6 wc8 wi wi wn wv2 wc4 wn wi wn wv5 wc6 wi wc0 wi
+      wc8 wv8 wi wi wv8 wv3 wi wn wc9 wi wv8 wv9 wv3 wi wv6 wv0 wi wi wi wc7
+      wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi wi wi wi wi wi wi wv7
+      wv7 ax-1 wc0 wv6 wc8 wi wi wn wv2 wc4 wn wi wn wv5 wc6 wi wc0 wi wc8 wv8
+      wi wi wv8 wv3 wi wn wc9 wi wv8 wv9 wv3 wi wv6 wv0 wi wi wi wc7 wv2 wi wn
+      wc7 wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi wi wi wi wi wi wi wv7 wv7 wv7
+      wi wi wc0 wv6 wc8 wi wi wn wv2 wc4 wn wi wn wv5 wc6 wi wc0 wi wc8 wv8 wi
+      wi wv8 wv3 wi wn wc9 wi wv8 wv9 wv3 wi wv6 wv0 wi wi wi wc7 wv2 wi wn wc7
+      wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi wi wi wi wi wi wi wi wv2 wc4 wn wi
+      wn wv5 wc6 wi wc0 wi wc8 wv8 wi wi wv8 wv3 wi wn wc9 wi wv8 wv9 wv3 wi
+      wv6 wv0 wi wi wi wc7 wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi
+      wi wi wi wi wi wc0 wv6 wc8 wi wi wn wv2 wc4 wn wi wn wv5 wc6 wi wc0 wi
+      wc8 wv8 wi wi wv8 wv3 wi wn wc9 wi wv8 wv9 wv3 wi wv6 wv0 wi wi wi wc7
+      wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi wi wi wi wi wi wi wv5
+      wc6 wi wc0 wi wc8 wv8 wi wi wv8 wv3 wi wn wc9 wi wv8 wv9 wv3 wi wv6 wv0
+      wi wi wi wc7 wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi wi wi wi
+      wi wv2 wc4 wn wi wn wv5 wc6 wi wc0 wi wc8 wv8 wi wi wv8 wv3 wi wn wc9 wi
+      wv8 wv9 wv3 wi wv6 wv0 wi wi wi wc7 wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi
+      wc7 wv2 wi wi wi wi wi wi wi wv8 wv3 wi wn wc9 wi wv8 wv9 wv3 wi wv6 wv0
+      wi wi wi wc7 wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi wi wi wi
+      wv5 wc6 wi wc0 wi wc8 wv8 wi wi wv8 wv3 wi wn wc9 wi wv8 wv9 wv3 wi wv6
+      wv0 wi wi wi wc7 wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi wi
+      wi wi wi wv8 wv9 wv3 wi wv6 wv0 wi wi wi wc7 wv2 wi wn wc7 wv2 wi wn wi
+      wc7 wv2 wi wc7 wv2 wi wi wi wi wv8 wv3 wi wn wc9 wi wv8 wv9 wv3 wi wv6
+      wv0 wi wi wi wc7 wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi wi
+      wi wi wc7 wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi wi wv8 wv9
+      wv3 wi wv6 wv0 wi wi wi wc7 wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi wc7 wv2
+      wi wi wi wi wc7 wv2 wi wc7 wv2 wi ax-3 wc7 wv2 wi wn wc7 wv2 wi wn wi wc7
+      wv2 wi wc7 wv2 wi wi wi wv8 wv9 wv3 wi wv6 wv0 wi wi wi ax-1 ax-mp wv8
+      wv9 wv3 wi wv6 wv0 wi wi wi wc7 wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi wc7
+      wv2 wi wi wi wi wv8 wv3 wi wn wc9 wi ax-1 ax-mp wv8 wv3 wi wn wc9 wi wv8
+      wv9 wv3 wi wv6 wv0 wi wi wi wc7 wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi wc7
+      wv2 wi wi wi wi wi wv5 wc6 wi wc0 wi wc8 wv8 wi wi ax-1 ax-mp wv5 wc6 wi
+      wc0 wi wc8 wv8 wi wi wv8 wv3 wi wn wc9 wi wv8 wv9 wv3 wi wv6 wv0 wi wi wi
+      wc7 wv2 wi wn wc7 wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi wi wi wi wi wv2
+      wc4 wn wi wn ax-1 ax-mp wv2 wc4 wn wi wn wv5 wc6 wi wc0 wi wc8 wv8 wi wi
+      wv8 wv3 wi wn wc9 wi wv8 wv9 wv3 wi wv6 wv0 wi wi wi wc7 wv2 wi wn wc7
+      wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi wi wi wi wi wi wc0 wv6 wc8 wi wi wn
+      ax-1 ax-mp wc0 wv6 wc8 wi wi wn wv2 wc4 wn wi wn wv5 wc6 wi wc0 wi wc8
+      wv8 wi wi wv8 wv3 wi wn wc9 wi wv8 wv9 wv3 wi wv6 wv0 wi wi wi wc7 wv2 wi
+      wn wc7 wv2 wi wn wi wc7 wv2 wi wc7 wv2 wi wi wi wi wi wi wi wi wv7 wv7
+      wv7 wi wi ax-1 ax-mp ax-mp $.
+  th131 $p |- ( ( ( ( v9 -> c5 ) -> -. c6 ) -> ( -. v9 -> ( c1 -> c5 ) ) ) -> ( -. ( ( v3 -> v2 ) -> -. v1 ) -> -. ( ( v3 -> v2 ) -> -. c7 ) ) ) $=
+      wv3 wv2 wi wv1 wn wi wn wv3 wv2 wi wc7 wn wi wn wi wv9 wc5 wi wc6 wn wi
+      wv9 wn wc1 wc5 wi wi wi wv3 wv2 wi wv1 wn wi wn wv3 wv2 wi wc7 wn wi wn
+      wi wi wc7 wn wv3 wv2 wi wv3 wv2 wi wv1 wn ax-g3 wv3 wv2 wi wv1 wn wi wn
+      wv3 wv2 wi wc7 wn wi wn wi wv9 wc5 wi wc6 wn wi wv9 wn wc1 wc5 wi wi wi
+      ax-1 ax-mp $.
+  th132 $p |- ( ( v7 -> c5 ) -> ( -. -. ( v6 -> v5 ) -> ( c9 -> ( ( ( v3 -> ( c2 -> v6 ) ) -> c7 ) -> ( v4 -> -. ( v7 -> c5 ) ) ) ) ) ) $=
+      ( wi wn wc9 wc2 wc7 wc5 ax-g5 ax-1 ax-mp ) DCFGGZHAIDFFJFZBEKFZGZFZFZFZFZ
+      QUBFUAUBTUASTRSQLRBMNSPMNTHMNUAOMNUBQMN $.
+  th133 $p |- ( -. c9 -> ( ( ( ( v0 -> v7 ) -> -. c0 ) -> v9 ) -> ( ( ( ( v4 -> v5 ) -> ( v2 -> c6 ) ) -> -. v6 ) -> ( v1 -> ( -. c1 -> ( -. c6 -> ( c8 -> ( ( ( -. c3 -> ( v1 -> c6 ) ) -> ( -. c6 -> ( v0 -> c6 ) ) ) -> ( ( ( ( c6 -> c3 ) -> ( c3 -> c3 ) ) -> ( c3 -> ( c6 -> c3 ) ) ) -> -. -. c6 ) ) ) ) ) ) ) ) ) $=
+      ( wi wc0 wn wc6 wc1 wc8 wc3 wc9 th96 ax-1 ax-mp ) AGIJKIHIZDEICLIIFKIZBMK
+      LKNOKBLIILKALIIILOIOOIIOLOIIILKKIIIIIZIZIZIZPKZUEIUDUEUCUDUBUCOOLOLABQUBB
+      RSUCUARSUDTRSUEUFRS $.
+  ${
+    sh4.0 $e |- v6 $.
+    wl4.0 $f wff v10 $.
+    sth4.0 $p |- ( v10 -> ( ( ( ( v5 -> v0 ) -> c3 ) -> ( ( v6 -> v2 ) -> v7 ) ) -> ( -. -. v1 -> v6 ) ) ) $=
+      wv5 wv0 wi wc3 wi wv6 wv2 wi wv7 wi wi wv1 wn wn wv6 wi wi wl4.0 wv5 wv0
+      wi wc3 wi wv6 wv2 wi wv7 wi wi wv1 wn wn wv6 wi wi wi wv8 wv8 wv8 wi wi
+      wv5 wv0 wi wc3 wi wv6 wv2 wi wv7 wi wi wv1 wn wn wv6 wi wi wv8 wv8 ax-1
+      wv5 wv0 wi wc3 wi wv6 wv2 wi wv7 wi wi wv1 wn wn wv6 wi wi wv8 wv8 wv8 wi
+      wi wv5 wv0 wi wc3 wi wv6 wv2 wi wv7 wi wi wv1 wn wn wv6 wi wi wi wv1 wn
+      wn wv6 wi wv5 wv0 wi wc3 wi wv6 wv2 wi wv7 wi wi wv1 wn wn wv6 wi wi wv6
+      wv1 wn wn wv6 wi sh4.0 wv6 wv1 wn wn ax-1 ax-mp wv1 wn wn wv6 wi wv5 wv0
+      wi wc3 wi wv6 wv2 wi wv7 wi wi ax-1 ax-mp wv5 wv0 wi wc3 wi wv6 wv2 wi
+      wv7 wi wi wv1 wn wn wv6 wi wi wv8 wv8 wv8 wi wi ax-1 ax-mp ax-mp wv5 wv0
+      wi wc3 wi wv6 wv2 wi wv7 wi wi wv1 wn wn wv6 wi wi wl4.0 ax-1 ax-mp $.
+    ${
+      sh4.1 $e |- ( ( -. v3 -> ( v3 -> c1 ) ) -> ( ( v8 -> c5 ) -> -. v1 ) ) $.
+      sth4.1 $p |- ( v0 -> ( -. ( v3 -> ( c3 -> v6 ) ) -> ( v3 -> ( v3 -> ( ( v3 -> c2 ) -> ( v0 -> ( c3 -> ( c3 -> ( ( -. v3 -> ( v3 -> c1 ) ) -> ( ( v8 -> c5 ) -> -. v1 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc3 wi wn wc2 wc1 wc5 ax-1 ax-mp ) CHDIIJZCCCKIZAHHCJCLIIEMIBJIIZIZIZIZ
+      IZIZIZIZAUEIUDUEUCUDUBUCUAUBTUASTRSGRHNOSHNOTANOUAQNOUBCNOUCCNOUDPNOUEANO
+      $.
+      ${
+        sh4.2 $e |- v9 $.
+        sth4.2 $p |- ( v4 -> ( v2 -> v9 ) ) $=
+      ( wi ax-1 ax-mp ) BGKZDNKGNJGBLMNDLM $.
+      $}
+    $}
+  $}
+  th134 $p |- ( v2 -> ( c2 -> ( v2 -> ( ( ( -. v0 -> c2 ) -> v4 ) -> ( ( c1 -> v7 ) -> ( ( c1 -> v7 ) -> ( ( ( c1 -> v7 ) -> ( ( v0 -> v2 ) -> ( c1 -> v7 ) ) ) -> ( ( ( c1 -> v7 ) -> ( v0 -> v2 ) ) -> ( ( c1 -> v7 ) -> ( c1 -> v7 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc2 wn wi wc1 ax-2 ax-1 ax-mp ) EBAFEGCGZHDGZMMABGZMGGMNGMMGGGZGZGZGZGZ
+      GZBTGSTRSQRPQOPMNMIOMJKPMJKQLJKRBJKSEJKTBJK $.
+  th135 $p |- ( ( v7 -> v4 ) -> ( -. ( ( c4 -> v7 ) -> ( c9 -> c3 ) ) -> -. ( ( c0 -> v3 ) -> ( v7 -> v4 ) ) ) ) $=
+      wv8 wv8 wv8 wi wi wv7 wv4 wi wc4 wv7 wi wc9 wc3 wi wi wn wc0 wv3 wi wv7
+      wv4 wi wi wn wi wi wv8 wv8 ax-1 wv7 wv4 wi wc4 wv7 wi wc9 wc3 wi wi wn
+      wc0 wv3 wi wv7 wv4 wi wi wn wi wi wv8 wv8 wv8 wi wi wv7 wv4 wi wc4 wv7 wi
+      wc9 wc3 wi wi wn wc0 wv3 wi wv7 wv4 wi wi wn wi wi wi wc4 wv7 wi wc9 wc3
+      wi wi wn wc0 wv3 wi wv7 wv4 wi wi wn wi wv7 wv4 wi wc4 wv7 wi wc9 wc3 wi
+      wi wn wc0 wv3 wi wv7 wv4 wi wi wn wi wi wv7 wv4 wi wc0 wv3 wi wc4 wv7 wi
+      wc9 wc3 wi ax-g3 wc4 wv7 wi wc9 wc3 wi wi wn wc0 wv3 wi wv7 wv4 wi wi wn
+      wi wv7 wv4 wi ax-1 ax-mp wv7 wv4 wi wc4 wv7 wi wc9 wc3 wi wi wn wc0 wv3
+      wi wv7 wv4 wi wi wn wi wi wv8 wv8 wv8 wi wi ax-1 ax-mp ax-mp $.
+  th136 $p |- ( -. v2 -> ( -. v2 -> ( -. v2 -> -. v2 ) ) ) $=
+      wv7 wv7 wv7 wi wi wv2 wn wv2 wn wv2 wn wv2 wn wi wi wi wv7 wv7 ax-1 wv2
+      wn wv2 wn wv2 wn wv2 wn wi wi wi wv7 wv7 wv7 wi wi wv2 wn wv2 wn wv2 wn
+      wv2 wn wi wi wi wi wv2 wn wv2 wn wv2 wn wi wi wv2 wn wv2 wn wv2 wn wv2 wn
+      wi wi wi wv2 wn wv2 wn wi wv2 wn wv2 wn wv2 wn wi wi wv2 wn wv2 wn wv2 wn
+      wi wv2 wn ax-g2 wv2 wn wv2 wn ax-1 ax-mp wv2 wn wv2 wn wi wv2 wn ax-1
+      ax-mp wv2 wn wv2 wn wv2 wn wi wi wv2 wn ax-1 ax-mp wv2 wn wv2 wn wv2 wn
+      wv2 wn wi wi wi wv7 wv7 wv7 wi wi ax-1 ax-mp ax-mp $.
+  ${
+    $d v1 v8 $.
+    $d v8 v9 $.
+    th137 $p |- ( -. -. ( v7 -> v3 ) -> ( v8 -> ( ( v1 -> v1 ) -> ( ( c1 -> -. v7 ) -> ( -. v0 -> ( ( v8 -> ( v4 -> ( v3 -> v8 ) ) ) -> ( -. ( ( v1 -> v1 ) -> v8 ) -> -. ( ( v0 -> c2 ) -> ( v1 -> v9 ) ) ) ) ) ) ) ) ) $=
+      ( wi wc1 wn wc2 ax-g3 ax-1 ax-mp ) FBBHZIEJHZAJZFDCFHHHZOFHJAKHZBGHZHJHZH
+      ZHZHZHZHZECHJJZUFHUEUFUDUEUCUDUBUCUAUBTSOFLUARMNUBQMNUCPMNUDOMNUEFMNUFUGM
+      N $.
+  $}
+  th138 $p |- ( ( ( ( v0 -> c2 ) -> ( v1 -> c2 ) ) -> -. v5 ) -> ( ( ( -. v3 -> ( c6 -> v7 ) ) -> ( ( c7 -> v9 ) -> v8 ) ) -> ( ( ( ( v3 -> v7 ) -> ( v8 -> v9 ) ) -> ( ( c9 -> c6 ) -> ( v4 -> v4 ) ) ) -> ( -. v4 -> ( ( c6 -> c4 ) -> ( ( c6 -> c4 ) -> ( ( c6 -> c4 ) -> ( c6 -> c4 ) ) ) ) ) ) ) ) $=
+      wv3 wn wc6 wv7 wi wi wc7 wv9 wi wv8 wi wi wv3 wv7 wi wv8 wv9 wi wi wc9
+      wc6 wi wv4 wv4 wi wi wi wv4 wn wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wc6 wc4
+      wi wi wi wi wi wi wi wv0 wc2 wi wv1 wc2 wi wi wv5 wn wi wv3 wn wc6 wv7 wi
+      wi wc7 wv9 wi wv8 wi wi wv3 wv7 wi wv8 wv9 wi wi wc9 wc6 wi wv4 wv4 wi wi
+      wi wv4 wn wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wi wi wi wi wi wi
+      wi wv3 wv7 wi wv8 wv9 wi wi wc9 wc6 wi wv4 wv4 wi wi wi wv4 wn wc6 wc4 wi
+      wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wi wi wi wi wi wv3 wn wc6 wv7 wi wi wc7
+      wv9 wi wv8 wi wi wv3 wv7 wi wv8 wv9 wi wi wc9 wc6 wi wv4 wv4 wi wi wi wv4
+      wn wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wi wi wi wi wi wi wv4 wn
+      wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wi wi wi wi wv3 wv7 wi wv8
+      wv9 wi wi wc9 wc6 wi wv4 wv4 wi wi wi wv4 wn wc6 wc4 wi wc6 wc4 wi wc6
+      wc4 wi wc6 wc4 wi wi wi wi wi wi wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wc6 wc4
+      wi wi wi wi wv4 wn wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wi wi wi
+      wi wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wi wi wc6 wc4 wi wc6 wc4 wi wc6 wc4
+      wi wc6 wc4 wi wi wi wi wc6 wc4 wi wc6 wc4 wi wi wc6 wc4 wi wc6 wc4 wi wc6
+      wc4 wi wi wi wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wi wc6 wc4 wi ax-g2 wc6 wc4
+      wi wc6 wc4 wi ax-1 ax-mp wc6 wc4 wi wc6 wc4 wi wi wc6 wc4 wi ax-1 ax-mp
+      wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wi wi wc6 wc4 wi ax-1 ax-mp wc6 wc4 wi
+      wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wi wi wi wv4 wn ax-1 ax-mp wv4 wn wc6
+      wc4 wi wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wi wi wi wi wv3 wv7 wi wv8 wv9 wi
+      wi wc9 wc6 wi wv4 wv4 wi wi wi ax-1 ax-mp wv3 wv7 wi wv8 wv9 wi wi wc9
+      wc6 wi wv4 wv4 wi wi wi wv4 wn wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wc6 wc4
+      wi wi wi wi wi wi wv3 wn wc6 wv7 wi wi wc7 wv9 wi wv8 wi wi ax-1 ax-mp
+      wv3 wn wc6 wv7 wi wi wc7 wv9 wi wv8 wi wi wv3 wv7 wi wv8 wv9 wi wi wc9
+      wc6 wi wv4 wv4 wi wi wi wv4 wn wc6 wc4 wi wc6 wc4 wi wc6 wc4 wi wc6 wc4
+      wi wi wi wi wi wi wi wv0 wc2 wi wv1 wc2 wi wi wv5 wn wi ax-1 ax-mp $.
+  ${
+    $d v3 v9 $.
+    $d v8 v9 $.
+    th139 $p |- ( ( ( ( v3 -> v9 ) -> c8 ) -> v9 ) -> ( -. ( c5 -> ( v9 -> v6 ) ) -> ( -. ( v0 -> v8 ) -> ( v8 -> ( c3 -> ( c3 -> ( v8 -> ( v8 -> ( -. ( ( v9 -> c4 ) -> ( v3 -> v8 ) ) -> v6 ) ) ) ) ) ) ) ) ) $=
+      ( wc5 wi wn wc3 wc4 wc8 ax-g1 ax-1 ax-mp ) FECGGHZADGHZDIIDDEJGZBDGZGHCGZ
+      GZGZGZGZGZGZGZBEGKGEGZUFGUEUFUDUEUCUDUBUCUAUBTUASTRCQLSDMNTDMNUAIMNUBIMNU
+      CDMNUDPMNUEOMNUFUGMN $.
+  $}
+  th140 $p |- ( v4 -> ( c2 -> ( v4 -> ( c8 -> ( ( ( -. v0 -> c4 ) -> c9 ) -> ( c8 -> ( ( -. c5 -> ( ( v0 -> c2 ) -> -. c5 ) ) -> ( v0 -> ( ( ( -. v0 -> ( c4 -> c6 ) ) -> -. ( c4 -> v4 ) ) -> ( ( ( v0 -> v4 ) -> ( c8 -> c3 ) ) -> -. ( ( v0 -> c8 ) -> ( v0 -> c8 ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc2 wc8 wn wc4 wi wc9 wc5 wc6 wc3 th46 ax-1 ax-mp ) CBDAEFGHGDIEACGIEGG
+      AAEFJGGFBGEGABGDKGGADGADGGEGGGGGGZGZGZGZBRGQRPQOPAABADDALODMNPBMNQCMNRBMN
+      $.
+  th141 $p |- ( c2 -> ( ( v6 -> ( ( v8 -> c0 ) -> ( v9 -> v2 ) ) ) -> ( ( ( ( c6 -> v9 ) -> ( c2 -> v7 ) ) -> ( ( v0 -> v6 ) -> c9 ) ) -> ( ( v9 -> ( ( c1 -> v7 ) -> -. c3 ) ) -> ( ( ( v5 -> ( v3 -> v3 ) ) -> v2 ) -> ( ( -. ( v1 -> v7 ) -> -. v5 ) -> ( v5 -> ( v1 -> v7 ) ) ) ) ) ) ) ) $=
+      wv6 wv8 wc0 wi wv9 wv2 wi wi wi wc6 wv9 wi wc2 wv7 wi wi wv0 wv6 wi wc9
+      wi wi wv9 wc1 wv7 wi wc3 wn wi wi wv5 wv3 wv3 wi wi wv2 wi wv1 wv7 wi wn
+      wv5 wn wi wv5 wv1 wv7 wi wi wi wi wi wi wi wc2 wv6 wv8 wc0 wi wv9 wv2 wi
+      wi wi wc6 wv9 wi wc2 wv7 wi wi wv0 wv6 wi wc9 wi wi wv9 wc1 wv7 wi wc3 wn
+      wi wi wv5 wv3 wv3 wi wi wv2 wi wv1 wv7 wi wn wv5 wn wi wv5 wv1 wv7 wi wi
+      wi wi wi wi wi wi wc6 wv9 wi wc2 wv7 wi wi wv0 wv6 wi wc9 wi wi wv9 wc1
+      wv7 wi wc3 wn wi wi wv5 wv3 wv3 wi wi wv2 wi wv1 wv7 wi wn wv5 wn wi wv5
+      wv1 wv7 wi wi wi wi wi wi wv6 wv8 wc0 wi wv9 wv2 wi wi wi wc6 wv9 wi wc2
+      wv7 wi wi wv0 wv6 wi wc9 wi wi wv9 wc1 wv7 wi wc3 wn wi wi wv5 wv3 wv3 wi
+      wi wv2 wi wv1 wv7 wi wn wv5 wn wi wv5 wv1 wv7 wi wi wi wi wi wi wi wv9
+      wc1 wv7 wi wc3 wn wi wi wv5 wv3 wv3 wi wi wv2 wi wv1 wv7 wi wn wv5 wn wi
+      wv5 wv1 wv7 wi wi wi wi wi wc6 wv9 wi wc2 wv7 wi wi wv0 wv6 wi wc9 wi wi
+      wv9 wc1 wv7 wi wc3 wn wi wi wv5 wv3 wv3 wi wi wv2 wi wv1 wv7 wi wn wv5 wn
+      wi wv5 wv1 wv7 wi wi wi wi wi wi wv5 wv3 wv3 wi wi wv2 wi wv1 wv7 wi wn
+      wv5 wn wi wv5 wv1 wv7 wi wi wi wi wv9 wc1 wv7 wi wc3 wn wi wi wv5 wv3 wv3
+      wi wi wv2 wi wv1 wv7 wi wn wv5 wn wi wv5 wv1 wv7 wi wi wi wi wi wv1 wv7
+      wi wn wv5 wn wi wv5 wv1 wv7 wi wi wi wv5 wv3 wv3 wi wi wv2 wi wv1 wv7 wi
+      wn wv5 wn wi wv5 wv1 wv7 wi wi wi wi wv1 wv7 wi wv5 ax-3 wv1 wv7 wi wn
+      wv5 wn wi wv5 wv1 wv7 wi wi wi wv5 wv3 wv3 wi wi wv2 wi ax-1 ax-mp wv5
+      wv3 wv3 wi wi wv2 wi wv1 wv7 wi wn wv5 wn wi wv5 wv1 wv7 wi wi wi wi wv9
+      wc1 wv7 wi wc3 wn wi wi ax-1 ax-mp wv9 wc1 wv7 wi wc3 wn wi wi wv5 wv3
+      wv3 wi wi wv2 wi wv1 wv7 wi wn wv5 wn wi wv5 wv1 wv7 wi wi wi wi wi wc6
+      wv9 wi wc2 wv7 wi wi wv0 wv6 wi wc9 wi wi ax-1 ax-mp wc6 wv9 wi wc2 wv7
+      wi wi wv0 wv6 wi wc9 wi wi wv9 wc1 wv7 wi wc3 wn wi wi wv5 wv3 wv3 wi wi
+      wv2 wi wv1 wv7 wi wn wv5 wn wi wv5 wv1 wv7 wi wi wi wi wi wi wv6 wv8 wc0
+      wi wv9 wv2 wi wi wi ax-1 ax-mp wv6 wv8 wc0 wi wv9 wv2 wi wi wi wc6 wv9 wi
+      wc2 wv7 wi wi wv0 wv6 wi wc9 wi wi wv9 wc1 wv7 wi wc3 wn wi wi wv5 wv3
+      wv3 wi wi wv2 wi wv1 wv7 wi wn wv5 wn wi wv5 wv1 wv7 wi wi wi wi wi wi wi
+      wc2 ax-1 ax-mp $.
+  th142 $p |- ( ( ( ( v7 -> c9 ) -> c5 ) -> ( v1 -> v6 ) ) -> ( -. ( ( v6 -> v8 ) -> ( v5 -> c6 ) ) -> ( ( ( c6 -> ( v6 -> c6 ) ) -> -. ( v8 -> c6 ) ) -> ( ( ( c6 -> ( v7 -> v9 ) ) -> ( ( v9 -> v4 ) -> ( v6 -> v3 ) ) ) -> ( ( v9 -> ( v4 -> v4 ) ) -> ( ( ( c9 -> c9 ) -> ( c4 -> ( v4 -> v2 ) ) ) -> ( -. ( ( v7 -> v8 ) -> v4 ) -> ( -. ( c9 -> v1 ) -> ( ( v4 -> c8 ) -> ( c9 -> v1 ) ) ) ) ) ) ) ) ) ) $=
+      ( wi wc6 wn wc9 wc4 wc8 wc5 ax-g9 ax-1 ax-mp ) FHJEKJJLZKFKJJHKJLJZKGIJJI
+      DJFCJJJZIDDJJZMMJNDBJJJZGHJZDJLMAJZLDOJZUFJJJZJZJZJZJZJZGMJPJAFJJZUMJULUM
+      UKULUJUKUIUJUHUIUEDUGUFQUHUDRSUIUCRSUJUBRSUKUARSULTRSUMUNRS $.
+  th143 $p |- ( v5 -> ( ( v4 -> v6 ) -> ( c2 -> ( ( ( ( v4 -> c6 ) -> -. v3 ) -> v2 ) -> ( c2 -> -. ( v4 -> v6 ) ) ) ) ) ) $=
+      ( wv1 wi wc2 wc6 wn ax-1 ax-g5 ax-mp ) FFFGGZDCEGZHCIGBJGAGZHOJZGZGZGZGZG
+      ZFFKUBNUBGUAUBTUASTRSQROLQHKMRPKMSHKMTOKMUADKMUBNKMM $.
+  th144 $p |- ( v5 -> ( ( ( ( v9 -> v5 ) -> ( c0 -> v8 ) ) -> c7 ) -> ( ( v4 -> c1 ) -> ( v6 -> ( ( ( -. v8 -> ( v9 -> v8 ) ) -> ( ( v0 -> v6 ) -> ( v2 -> v3 ) ) ) -> ( ( ( -. v8 -> ( v9 -> v8 ) ) -> ( ( v0 -> v6 ) -> ( v2 -> v3 ) ) ) -> -. ( ( v1 -> v1 ) -> ( v1 -> v1 ) ) ) ) ) ) ) ) $=
+      wv9 wv5 wi wc0 wv8 wi wi wc7 wi wv4 wc1 wi wv6 wv8 wn wv9 wv8 wi wi wv0
+      wv6 wi wv2 wv3 wi wi wi wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi
+      wv1 wv1 wi wv1 wv1 wi wi wn wi wi wi wi wi wv5 wv9 wv5 wi wc0 wv8 wi wi
+      wc7 wi wv4 wc1 wi wv6 wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi
+      wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv1 wv1 wi wv1 wv1 wi wi
+      wn wi wi wi wi wi wi wv4 wc1 wi wv6 wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2
+      wv3 wi wi wi wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv1 wv1 wi
+      wv1 wv1 wi wi wn wi wi wi wi wv9 wv5 wi wc0 wv8 wi wi wc7 wi wv4 wc1 wi
+      wv6 wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv8 wn wv9 wv8 wi wi
+      wv0 wv6 wi wv2 wv3 wi wi wi wv1 wv1 wi wv1 wv1 wi wi wn wi wi wi wi wi
+      wv6 wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv8 wn wv9 wv8 wi wi
+      wv0 wv6 wi wv2 wv3 wi wi wi wv1 wv1 wi wv1 wv1 wi wi wn wi wi wi wv4 wc1
+      wi wv6 wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv8 wn wv9 wv8 wi
+      wi wv0 wv6 wi wv2 wv3 wi wi wi wv1 wv1 wi wv1 wv1 wi wi wn wi wi wi wi
+      wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv8 wn wv9 wv8 wi wi wv0
+      wv6 wi wv2 wv3 wi wi wi wv1 wv1 wi wv1 wv1 wi wi wn wi wi wv6 wv8 wn wv9
+      wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2
+      wv3 wi wi wi wv1 wv1 wi wv1 wv1 wi wi wn wi wi wi wv8 wn wv9 wv8 wi wi
+      wv0 wv6 wi wv2 wv3 wi wi wi wv1 wv1 wi wv1 wv1 wi wi wn wi wv8 wn wv9 wv8
+      wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3
+      wi wi wi wv1 wv1 wi wv1 wv1 wi wi wn wi wi wv1 wv1 wi wv1 wv1 wi wi wn
+      wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv1 wv1 wi wv1 wv1 wi wi
+      wn wi wv1 wv1 wv1 ax-g8 wv1 wv1 wi wv1 wv1 wi wi wn wv8 wn wv9 wv8 wi wi
+      wv0 wv6 wi wv2 wv3 wi wi wi ax-1 ax-mp wv8 wn wv9 wv8 wi wi wv0 wv6 wi
+      wv2 wv3 wi wi wi wv1 wv1 wi wv1 wv1 wi wi wn wi wv8 wn wv9 wv8 wi wi wv0
+      wv6 wi wv2 wv3 wi wi wi ax-1 ax-mp wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2
+      wv3 wi wi wi wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv1 wv1 wi
+      wv1 wv1 wi wi wn wi wi wv6 ax-1 ax-mp wv6 wv8 wn wv9 wv8 wi wi wv0 wv6 wi
+      wv2 wv3 wi wi wi wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv1 wv1
+      wi wv1 wv1 wi wi wn wi wi wi wv4 wc1 wi ax-1 ax-mp wv4 wc1 wi wv6 wv8 wn
+      wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv8 wn wv9 wv8 wi wi wv0 wv6 wi
+      wv2 wv3 wi wi wi wv1 wv1 wi wv1 wv1 wi wi wn wi wi wi wi wv9 wv5 wi wc0
+      wv8 wi wi wc7 wi ax-1 ax-mp wv9 wv5 wi wc0 wv8 wi wi wc7 wi wv4 wc1 wi
+      wv6 wv8 wn wv9 wv8 wi wi wv0 wv6 wi wv2 wv3 wi wi wi wv8 wn wv9 wv8 wi wi
+      wv0 wv6 wi wv2 wv3 wi wi wi wv1 wv1 wi wv1 wv1 wi wi wn wi wi wi wi wi
+      wv5 ax-1 ax-mp $.
+  th145 $p |- ( ( ( ( v3 -> v3 ) -> v0 ) -> ( ( v7 -> v2 ) -> ( v9 -> v3 ) ) ) -> ( v6 -> ( ( ( ( v8 -> c4 ) -> v7 ) -> c6 ) -> ( ( ( ( v4 -> v4 ) -> -. c3 ) -> ( ( c0 -> v8 ) -> ( v3 -> v0 ) ) ) -> ( -. -. ( v4 -> v8 ) -> ( v7 -> ( -. -. ( v4 -> v8 ) -> ( ( -. ( v7 -> v8 ) -> v3 ) -> ( ( v7 -> v6 ) -> ( c9 -> ( c9 -> ( c2 -> ( c2 -> ( c2 -> ( ( v9 -> c9 ) -> ( -. ( c7 -> v9 ) -> -. ( ( v9 -> c9 ) -> ( v9 -> c9 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv6 wv8 wc4 wi wv7 wi wc6 wi wv4 wv4 wi wc3 wn wi wc0 wv8 wi wv3 wv0 wi
+      wi wi wv4 wv8 wi wn wn wv7 wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6
+      wi wc9 wc9 wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi
+      wn wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv3 wv3 wi wv0 wi wv7 wv2
+      wi wv9 wv3 wi wi wi wv6 wv8 wc4 wi wv7 wi wc6 wi wv4 wv4 wi wc3 wn wi wc0
+      wv8 wi wv3 wv0 wi wi wi wv4 wv8 wi wn wn wv7 wv4 wv8 wi wn wn wv7 wv8 wi
+      wn wv3 wi wv7 wv6 wi wc9 wc9 wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9
+      wi wv9 wc9 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv8
+      wc4 wi wv7 wi wc6 wi wv4 wv4 wi wc3 wn wi wc0 wv8 wi wv3 wv0 wi wi wi wv4
+      wv8 wi wn wn wv7 wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9
+      wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi
+      wi wi wi wi wi wi wi wi wi wi wi wv6 wv8 wc4 wi wv7 wi wc6 wi wv4 wv4 wi
+      wc3 wn wi wc0 wv8 wi wv3 wv0 wi wi wi wv4 wv8 wi wn wn wv7 wv4 wv8 wi wn
+      wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9 wc2 wc2 wc2 wv9 wc9 wi wc7 wv9
+      wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi
+      wi wi wv4 wv4 wi wc3 wn wi wc0 wv8 wi wv3 wv0 wi wi wi wv4 wv8 wi wn wn
+      wv7 wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9 wc2 wc2 wc2
+      wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wv8 wc4 wi wv7 wi wc6 wi wv4 wv4 wi wc3 wn wi wc0 wv8
+      wi wv3 wv0 wi wi wi wv4 wv8 wi wn wn wv7 wv4 wv8 wi wn wn wv7 wv8 wi wn
+      wv3 wi wv7 wv6 wi wc9 wc9 wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi
+      wv9 wc9 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv4 wv8 wi wn
+      wn wv7 wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9 wc2 wc2
+      wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi wi wi
+      wi wi wi wi wi wi wi wv4 wv4 wi wc3 wn wi wc0 wv8 wi wv3 wv0 wi wi wi wv4
+      wv8 wi wn wn wv7 wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9
+      wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi
+      wi wi wi wi wi wi wi wi wi wi wv7 wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi
+      wv7 wv6 wi wc9 wc9 wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9
+      wc9 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wv4 wv8 wi wn wn wv7 wv4
+      wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9 wc2 wc2 wc2 wv9 wc9
+      wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi wi wi wi wi wi wi
+      wi wi wi wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9 wc2 wc2
+      wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi wi wi
+      wi wi wi wi wi wv7 wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9
+      wc9 wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi
+      wi wi wi wi wi wi wi wi wi wi wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9 wc2
+      wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi wi
+      wi wi wi wi wi wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9
+      wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi
+      wi wi wi wi wi wi wi wv7 wv6 wi wc9 wc9 wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi
+      wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi wi wi wi wi wi wv7 wv8 wi wn wv3
+      wi wv7 wv6 wi wc9 wc9 wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9
+      wc9 wi wi wn wi wi wi wi wi wi wi wi wi wv9 wv7 wv9 wc9 wv6 th42 wv7 wv6
+      wi wc9 wc9 wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi
+      wn wi wi wi wi wi wi wi wi wv7 wv8 wi wn wv3 wi ax-1 ax-mp wv7 wv8 wi wn
+      wv3 wi wv7 wv6 wi wc9 wc9 wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi
+      wv9 wc9 wi wi wn wi wi wi wi wi wi wi wi wi wv4 wv8 wi wn wn ax-1 ax-mp
+      wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9 wc2 wc2 wc2 wv9
+      wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi wi wi wi wi wi
+      wi wi wv7 ax-1 ax-mp wv7 wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi
+      wc9 wc9 wc2 wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn
+      wi wi wi wi wi wi wi wi wi wi wi wv4 wv8 wi wn wn ax-1 ax-mp wv4 wv8 wi
+      wn wn wv7 wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9 wc2
+      wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi wi
+      wi wi wi wi wi wi wi wi wv4 wv4 wi wc3 wn wi wc0 wv8 wi wv3 wv0 wi wi wi
+      ax-1 ax-mp wv4 wv4 wi wc3 wn wi wc0 wv8 wi wv3 wv0 wi wi wi wv4 wv8 wi wn
+      wn wv7 wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9 wc2 wc2
+      wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi wi wi
+      wi wi wi wi wi wi wi wi wv8 wc4 wi wv7 wi wc6 wi ax-1 ax-mp wv8 wc4 wi
+      wv7 wi wc6 wi wv4 wv4 wi wc3 wn wi wc0 wv8 wi wv3 wv0 wi wi wi wv4 wv8 wi
+      wn wn wv7 wv4 wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9 wc2
+      wc2 wc2 wv9 wc9 wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi wi
+      wi wi wi wi wi wi wi wi wi wi wv6 ax-1 ax-mp wv6 wv8 wc4 wi wv7 wi wc6 wi
+      wv4 wv4 wi wc3 wn wi wc0 wv8 wi wv3 wv0 wi wi wi wv4 wv8 wi wn wn wv7 wv4
+      wv8 wi wn wn wv7 wv8 wi wn wv3 wi wv7 wv6 wi wc9 wc9 wc2 wc2 wc2 wv9 wc9
+      wi wc7 wv9 wi wn wv9 wc9 wi wv9 wc9 wi wi wn wi wi wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wv3 wv3 wi wv0 wi wv7 wv2 wi wv9 wv3 wi wi wi ax-1
+      ax-mp $.
+  th146 $p |- ( -. ( ( v4 -> v8 ) -> ( v9 -> v9 ) ) -> ( v3 -> ( -. ( ( v4 -> v8 ) -> ( v9 -> v9 ) ) -> ( ( c2 -> v1 ) -> ( v3 -> ( ( c2 -> v1 ) -> v3 ) ) ) ) ) ) $=
+      wv3 wv4 wv8 wi wv9 wv9 wi wi wn wc2 wv1 wi wv3 wc2 wv1 wi wv3 wi wi wi wi
+      wi wv4 wv8 wi wv9 wv9 wi wi wn wv3 wv4 wv8 wi wv9 wv9 wi wi wn wc2 wv1 wi
+      wv3 wc2 wv1 wi wv3 wi wi wi wi wi wi wv4 wv8 wi wv9 wv9 wi wi wn wc2 wv1
+      wi wv3 wc2 wv1 wi wv3 wi wi wi wi wv3 wv4 wv8 wi wv9 wv9 wi wi wn wc2 wv1
+      wi wv3 wc2 wv1 wi wv3 wi wi wi wi wi wc2 wv1 wi wv3 wc2 wv1 wi wv3 wi wi
+      wi wv4 wv8 wi wv9 wv9 wi wi wn wc2 wv1 wi wv3 wc2 wv1 wi wv3 wi wi wi wi
+      wv3 wc2 wv1 wi wv3 wi wi wc2 wv1 wi wv3 wc2 wv1 wi wv3 wi wi wi wv3 wc2
+      wv1 wi ax-1 wv3 wc2 wv1 wi wv3 wi wi wc2 wv1 wi ax-1 ax-mp wc2 wv1 wi wv3
+      wc2 wv1 wi wv3 wi wi wi wv4 wv8 wi wv9 wv9 wi wi wn ax-1 ax-mp wv4 wv8 wi
+      wv9 wv9 wi wi wn wc2 wv1 wi wv3 wc2 wv1 wi wv3 wi wi wi wi wv3 ax-1 ax-mp
+      wv3 wv4 wv8 wi wv9 wv9 wi wi wn wc2 wv1 wi wv3 wc2 wv1 wi wv3 wi wi wi wi
+      wi wv4 wv8 wi wv9 wv9 wi wi wn ax-1 ax-mp $.
+  th147 $p |- ( ( ( ( v3 -> v6 ) -> v4 ) -> c2 ) -> ( c3 -> ( c3 -> c3 ) ) ) $=
+      wc3 wc3 wc3 wi wi wv3 wv6 wi wv4 wi wc2 wi wc3 wc3 wc3 wi wi wi wc3 wc3
+      wi wc3 wc3 wc3 wi wi wc3 wc3 wc3 wi wc3 ax-g2 wc3 wc3 ax-1 ax-mp wc3 wc3
+      wi wc3 ax-1 ax-mp wc3 wc3 wc3 wi wi wv3 wv6 wi wv4 wi wc2 wi ax-1 ax-mp
+      $.
+  th148 $p |- ( v9 -> ( v2 -> ( ( ( v1 -> ( c1 -> v7 ) ) -> ( v3 -> -. v6 ) ) -> ( ( v4 -> v8 ) -> ( -. ( ( v4 -> v8 ) -> c7 ) -> ( -. v2 -> ( ( c9 -> v6 ) -> v2 ) ) ) ) ) ) ) $=
+      wv2 wv1 wc1 wv7 wi wi wv3 wv6 wn wi wi wv4 wv8 wi wv4 wv8 wi wc7 wi wn
+      wv2 wn wc9 wv6 wi wv2 wi wi wi wi wi wi wv9 wv2 wv1 wc1 wv7 wi wi wv3 wv6
+      wn wi wi wv4 wv8 wi wv4 wv8 wi wc7 wi wn wv2 wn wc9 wv6 wi wv2 wi wi wi
+      wi wi wi wi wv1 wc1 wv7 wi wi wv3 wv6 wn wi wi wv4 wv8 wi wv4 wv8 wi wc7
+      wi wn wv2 wn wc9 wv6 wi wv2 wi wi wi wi wi wv2 wv1 wc1 wv7 wi wi wv3 wv6
+      wn wi wi wv4 wv8 wi wv4 wv8 wi wc7 wi wn wv2 wn wc9 wv6 wi wv2 wi wi wi
+      wi wi wi wv4 wv8 wi wv4 wv8 wi wc7 wi wn wv2 wn wc9 wv6 wi wv2 wi wi wi
+      wi wv1 wc1 wv7 wi wi wv3 wv6 wn wi wi wv4 wv8 wi wv4 wv8 wi wc7 wi wn wv2
+      wn wc9 wv6 wi wv2 wi wi wi wi wi wv4 wv8 wi wc7 wi wn wv2 wn wc9 wv6 wi
+      wv2 wi wi wi wv4 wv8 wi wv4 wv8 wi wc7 wi wn wv2 wn wc9 wv6 wi wv2 wi wi
+      wi wi wv4 wv8 wi wc7 wc9 wv6 wi wv2 ax-g9 wv4 wv8 wi wc7 wi wn wv2 wn wc9
+      wv6 wi wv2 wi wi wi wv4 wv8 wi ax-1 ax-mp wv4 wv8 wi wv4 wv8 wi wc7 wi wn
+      wv2 wn wc9 wv6 wi wv2 wi wi wi wi wv1 wc1 wv7 wi wi wv3 wv6 wn wi wi ax-1
+      ax-mp wv1 wc1 wv7 wi wi wv3 wv6 wn wi wi wv4 wv8 wi wv4 wv8 wi wc7 wi wn
+      wv2 wn wc9 wv6 wi wv2 wi wi wi wi wi wv2 ax-1 ax-mp wv2 wv1 wc1 wv7 wi wi
+      wv3 wv6 wn wi wi wv4 wv8 wi wv4 wv8 wi wc7 wi wn wv2 wn wc9 wv6 wi wv2 wi
+      wi wi wi wi wi wv9 ax-1 ax-mp $.
+  th149 $p |- ( ( ( v1 -> v9 ) -> ( -. v9 -> -. c3 ) ) -> ( v1 -> ( c9 -> ( ( ( -. v3 -> ( v5 -> c1 ) ) -> ( -. c8 -> -. c3 ) ) -> ( ( -. ( v0 -> c8 ) -> v9 ) -> ( ( ( -. v3 -> ( v5 -> c1 ) ) -> ( -. c8 -> -. c3 ) ) -> ( v7 -> ( ( ( ( v8 -> v5 ) -> ( v7 -> v0 ) ) -> ( -. v3 -> v4 ) ) -> ( c0 -> ( ( v3 -> ( ( c0 -> c0 ) -> ( c0 -> v3 ) ) ) -> ( ( ( v1 -> ( v2 -> c0 ) ) -> ( ( v1 -> v7 ) -> c2 ) ) -> ( c0 -> ( -. ( ( v8 -> v2 ) -> ( v7 -> v2 ) ) -> ( -. ( ( v8 -> v2 ) -> ( v7 -> v2 ) ) -> ( ( c0 -> ( c1 -> ( v7 -> v2 ) ) ) -> -. ( ( ( v1 -> c3 ) -> v3 ) -> ( -. v1 -> -. v1 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc9 wn wc1 wi wc8 wc3 wc0 wc2 th26 ax-1 ax-mp ) BJDKFLMMNKOKMMZANMKIMZU
+      AGHFMGAMMDKEMMZPDPPMPDMMMBCPMMBGMQMMPHCMGCMMKHCMGCMMKPLGCMMMBOMDMBKBKMMKM
+      MMMMMMZMZMZMZMZMZMZMZBIMIKOKMMZUKMUJUKUIUJUHUIUGUHUFUGUEUFUDUECHPPDDBGRUD
+      UCSTUEGSTUFUASTUGUBSTUHUASTUIJSTUJBSTUKULST $.
+  th150 $p |- ( v3 -> ( ( -. ( v5 -> v2 ) -> ( v0 -> -. v1 ) ) -> ( ( ( ( v9 -> v5 ) -> v2 ) -> ( ( v7 -> v1 ) -> v3 ) ) -> ( ( -. ( v5 -> v2 ) -> ( v0 -> -. v1 ) ) -> ( ( ( ( v9 -> v5 ) -> v2 ) -> ( ( v7 -> v1 ) -> v3 ) ) -> ( ( ( ( c7 -> c6 ) -> c3 ) -> -. ( v3 -> c6 ) ) -> v8 ) ) ) ) ) ) $=
+      ( wi wn wc7 wc6 wc3 ax-g6 ax-1 ax-mp ) ECIJABJIIZHEICIFBIDIIZQRKLIMIDLIJI
+      ZGIZIZIZIZIZDUDIUCUDUBUCUAUBTUAGTGNGSOPTROPUAQOPUBROPUCQOPUDDOP $.
+  ${
+    $d v2 v3 $.
+    $d v3 v8 $.
+    th151 $p |- ( -. ( ( v0 -> v9 ) -> ( c6 -> v9 ) ) -> ( -. ( ( v2 -> v8 ) -> ( v3 -> c8 ) ) -> ( v4 -> c1 ) ) ) $=
+      ( wi wc8 wn wc1 wc6 ax-g1 ax-1 ax-mp ) BEGZCHGZGIDJGZGZAFGKFGGIZRGPQOLRSM
+      N $.
+  $}
+  th152 $p |- ( -. c8 -> ( ( c8 -> ( -. v2 -> ( v8 -> c5 ) ) ) -> ( ( c8 -> c3 ) -> ( ( v0 -> v0 ) -> -. ( ( v1 -> v8 ) -> -. v1 ) ) ) ) ) $=
+      wc8 wv2 wn wv8 wc5 wi wi wi wc8 wc3 wi wv0 wv0 wi wv1 wv8 wi wv1 wn wi wn
+      wi wi wi wc8 wn wc8 wv2 wn wv8 wc5 wi wi wi wc8 wc3 wi wv0 wv0 wi wv1 wv8
+      wi wv1 wn wi wn wi wi wi wi wc8 wc3 wi wv0 wv0 wi wv1 wv8 wi wv1 wn wi wn
+      wi wi wc8 wv2 wn wv8 wc5 wi wi wi wc8 wc3 wi wv0 wv0 wi wv1 wv8 wi wv1 wn
+      wi wn wi wi wi wv0 wv0 wi wv1 wv8 wi wv1 wn wi wn wi wc8 wc3 wi wv0 wv0
+      wi wv1 wv8 wi wv1 wn wi wn wi wi wv1 wv8 wi wv1 wn wv0 wv0 ax-g0 wv0 wv0
+      wi wv1 wv8 wi wv1 wn wi wn wi wc8 wc3 wi ax-1 ax-mp wc8 wc3 wi wv0 wv0 wi
+      wv1 wv8 wi wv1 wn wi wn wi wi wc8 wv2 wn wv8 wc5 wi wi wi ax-1 ax-mp wc8
+      wv2 wn wv8 wc5 wi wi wi wc8 wc3 wi wv0 wv0 wi wv1 wv8 wi wv1 wn wi wn wi
+      wi wi wc8 wn ax-1 ax-mp $.
+  th153 $p |- ( v3 -> ( ( c9 -> ( ( v6 -> c3 ) -> ( v2 -> v7 ) ) ) -> ( -. ( -. v9 -> -. v7 ) -> ( -. ( -. v9 -> -. v7 ) -> ( v8 -> ( c9 -> ( ( ( -. v5 -> v8 ) -> c2 ) -> ( ( -. ( v8 -> c2 ) -> ( c9 -> c2 ) ) -> ( v8 -> ( -. ( ( c2 -> c4 ) -> ( c6 -> c2 ) ) -> ( ( -. ( v8 -> c4 ) -> ( -. c1 -> ( c4 -> c4 ) ) ) -> ( c9 -> ( -. c9 -> -. ( c9 -> c9 ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wc9 wv6 wc3 wi wv2 wv7 wi wi wi wv9 wn wv7 wn wi wn wv9 wn wv7 wn wi wn
+      wv8 wc9 wv5 wn wv8 wi wc2 wi wv8 wc2 wi wn wc9 wc2 wi wi wv8 wc2 wc4 wi
+      wc6 wc2 wi wi wn wv8 wc4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9
+      wi wn wi wi wi wi wi wi wi wi wi wi wi wi wv3 wc9 wv6 wc3 wi wv2 wv7 wi
+      wi wi wv9 wn wv7 wn wi wn wv9 wn wv7 wn wi wn wv8 wc9 wv5 wn wv8 wi wc2
+      wi wv8 wc2 wi wn wc9 wc2 wi wi wv8 wc2 wc4 wi wc6 wc2 wi wi wn wv8 wc4 wi
+      wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wv9 wn wv7 wn wi wn wv9 wn wv7 wn wi wn wv8 wc9 wv5 wn
+      wv8 wi wc2 wi wv8 wc2 wi wn wc9 wc2 wi wi wv8 wc2 wc4 wi wc6 wc2 wi wi wn
+      wv8 wc4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi
+      wi wi wi wi wi wi wi wi wc9 wv6 wc3 wi wv2 wv7 wi wi wi wv9 wn wv7 wn wi
+      wn wv9 wn wv7 wn wi wn wv8 wc9 wv5 wn wv8 wi wc2 wi wv8 wc2 wi wn wc9 wc2
+      wi wi wv8 wc2 wc4 wi wc6 wc2 wi wi wn wv8 wc4 wi wn wc1 wn wc4 wc4 wi wi
+      wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wv9 wn
+      wv7 wn wi wn wv8 wc9 wv5 wn wv8 wi wc2 wi wv8 wc2 wi wn wc9 wc2 wi wi wv8
+      wc2 wc4 wi wc6 wc2 wi wi wn wv8 wc4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9
+      wn wc9 wc9 wi wn wi wi wi wi wi wi wi wi wi wi wv9 wn wv7 wn wi wn wv9 wn
+      wv7 wn wi wn wv8 wc9 wv5 wn wv8 wi wc2 wi wv8 wc2 wi wn wc9 wc2 wi wi wv8
+      wc2 wc4 wi wc6 wc2 wi wi wn wv8 wc4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9
+      wn wc9 wc9 wi wn wi wi wi wi wi wi wi wi wi wi wi wv8 wc9 wv5 wn wv8 wi
+      wc2 wi wv8 wc2 wi wn wc9 wc2 wi wi wv8 wc2 wc4 wi wc6 wc2 wi wi wn wv8
+      wc4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wi wi
+      wi wi wi wi wv9 wn wv7 wn wi wn wv8 wc9 wv5 wn wv8 wi wc2 wi wv8 wc2 wi
+      wn wc9 wc2 wi wi wv8 wc2 wc4 wi wc6 wc2 wi wi wn wv8 wc4 wi wn wc1 wn wc4
+      wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wi wi wi wi wi wi wi wv8
+      wc2 wc2 wv8 wc4 wc2 wv5 th75 wv8 wc9 wv5 wn wv8 wi wc2 wi wv8 wc2 wi wn
+      wc9 wc2 wi wi wv8 wc2 wc4 wi wc6 wc2 wi wi wn wv8 wc4 wi wn wc1 wn wc4
+      wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wi wi wi wi wi wi wv9 wn
+      wv7 wn wi wn ax-1 ax-mp wv9 wn wv7 wn wi wn wv8 wc9 wv5 wn wv8 wi wc2 wi
+      wv8 wc2 wi wn wc9 wc2 wi wi wv8 wc2 wc4 wi wc6 wc2 wi wi wn wv8 wc4 wi wn
+      wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9 wc9 wi wn wi wi wi wi wi wi wi wi
+      wi wi wv9 wn wv7 wn wi wn ax-1 ax-mp wv9 wn wv7 wn wi wn wv9 wn wv7 wn wi
+      wn wv8 wc9 wv5 wn wv8 wi wc2 wi wv8 wc2 wi wn wc9 wc2 wi wi wv8 wc2 wc4
+      wi wc6 wc2 wi wi wn wv8 wc4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9 wn wc9
+      wc9 wi wn wi wi wi wi wi wi wi wi wi wi wi wc9 wv6 wc3 wi wv2 wv7 wi wi
+      wi ax-1 ax-mp wc9 wv6 wc3 wi wv2 wv7 wi wi wi wv9 wn wv7 wn wi wn wv9 wn
+      wv7 wn wi wn wv8 wc9 wv5 wn wv8 wi wc2 wi wv8 wc2 wi wn wc9 wc2 wi wi wv8
+      wc2 wc4 wi wc6 wc2 wi wi wn wv8 wc4 wi wn wc1 wn wc4 wc4 wi wi wi wc9 wc9
+      wn wc9 wc9 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wv3 ax-1 ax-mp $.
+  th154 $p |- ( -. ( ( c6 -> c0 ) -> ( v8 -> c6 ) ) -> ( v0 -> ( ( ( ( v3 -> v8 ) -> c4 ) -> ( -. v4 -> ( c9 -> c2 ) ) ) -> ( v4 -> ( ( ( ( v3 -> v8 ) -> c4 ) -> ( -. v4 -> ( c9 -> c2 ) ) ) -> ( v3 -> ( -. -. ( v5 -> c5 ) -> ( ( ( ( c9 -> c8 ) -> ( c8 -> c1 ) ) -> ( v9 -> c0 ) ) -> ( ( ( v0 -> ( c5 -> c7 ) ) -> ( -. c9 -> ( v9 -> v4 ) ) ) -> ( ( ( -. c9 -> ( c5 -> c3 ) ) -> -. ( c9 -> v9 ) ) -> ( ( ( ( c4 -> v3 ) -> ( c5 -> v9 ) ) -> ( c3 -> -. v9 ) ) -> ( -. ( -. c2 -> c8 ) -> ( -. -. ( v5 -> c5 ) -> c5 ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv0 wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi wv4 wv3 wv8 wi wc4 wi wv4
+      wn wc9 wc2 wi wi wi wv3 wv5 wc5 wi wn wn wc9 wc8 wi wc8 wc1 wi wi wv9 wc0
+      wi wi wv0 wc5 wc7 wi wi wc9 wn wv9 wv4 wi wi wi wc9 wn wc5 wc3 wi wi wc9
+      wv9 wi wn wi wc4 wv3 wi wc5 wv9 wi wi wc3 wv9 wn wi wi wc2 wn wc8 wi wn
+      wv5 wc5 wi wn wn wc5 wi wi wi wi wi wi wi wi wi wi wi wi wc6 wc0 wi wv8
+      wc6 wi wi wn wv0 wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi wv4 wv3 wv8 wi
+      wc4 wi wv4 wn wc9 wc2 wi wi wi wv3 wv5 wc5 wi wn wn wc9 wc8 wi wc8 wc1 wi
+      wi wv9 wc0 wi wi wv0 wc5 wc7 wi wi wc9 wn wv9 wv4 wi wi wi wc9 wn wc5 wc3
+      wi wi wc9 wv9 wi wn wi wc4 wv3 wi wc5 wv9 wi wi wc3 wv9 wn wi wi wc2 wn
+      wc8 wi wn wv5 wc5 wi wn wn wc5 wi wi wi wi wi wi wi wi wi wi wi wi wi wv3
+      wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi wv4 wv3 wv8 wi wc4 wi wv4 wn wc9
+      wc2 wi wi wi wv3 wv5 wc5 wi wn wn wc9 wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi
+      wv0 wc5 wc7 wi wi wc9 wn wv9 wv4 wi wi wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi
+      wn wi wc4 wv3 wi wc5 wv9 wi wi wc3 wv9 wn wi wi wc2 wn wc8 wi wn wv5 wc5
+      wi wn wn wc5 wi wi wi wi wi wi wi wi wi wi wi wv0 wv3 wv8 wi wc4 wi wv4
+      wn wc9 wc2 wi wi wi wv4 wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi wv3 wv5
+      wc5 wi wn wn wc9 wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi wv0 wc5 wc7 wi wi wc9
+      wn wv9 wv4 wi wi wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi wn wi wc4 wv3 wi wc5
+      wv9 wi wi wc3 wv9 wn wi wi wc2 wn wc8 wi wn wv5 wc5 wi wn wn wc5 wi wi wi
+      wi wi wi wi wi wi wi wi wi wv4 wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi
+      wv3 wv5 wc5 wi wn wn wc9 wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi wv0 wc5 wc7
+      wi wi wc9 wn wv9 wv4 wi wi wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi wn wi wc4
+      wv3 wi wc5 wv9 wi wi wc3 wv9 wn wi wi wc2 wn wc8 wi wn wv5 wc5 wi wn wn
+      wc5 wi wi wi wi wi wi wi wi wi wi wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi
+      wi wv4 wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi wv3 wv5 wc5 wi wn wn wc9
+      wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi wv0 wc5 wc7 wi wi wc9 wn wv9 wv4 wi wi
+      wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi wn wi wc4 wv3 wi wc5 wv9 wi wi wc3 wv9
+      wn wi wi wc2 wn wc8 wi wn wv5 wc5 wi wn wn wc5 wi wi wi wi wi wi wi wi wi
+      wi wi wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi wv3 wv5 wc5 wi wn wn wc9
+      wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi wv0 wc5 wc7 wi wi wc9 wn wv9 wv4 wi wi
+      wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi wn wi wc4 wv3 wi wc5 wv9 wi wi wc3 wv9
+      wn wi wi wc2 wn wc8 wi wn wv5 wc5 wi wn wn wc5 wi wi wi wi wi wi wi wi wi
+      wv4 wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi wv3 wv5 wc5 wi wn wn wc9
+      wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi wv0 wc5 wc7 wi wi wc9 wn wv9 wv4 wi wi
+      wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi wn wi wc4 wv3 wi wc5 wv9 wi wi wc3 wv9
+      wn wi wi wc2 wn wc8 wi wn wv5 wc5 wi wn wn wc5 wi wi wi wi wi wi wi wi wi
+      wi wv3 wv5 wc5 wi wn wn wc9 wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi wv0 wc5
+      wc7 wi wi wc9 wn wv9 wv4 wi wi wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi wn wi
+      wc4 wv3 wi wc5 wv9 wi wi wc3 wv9 wn wi wi wc2 wn wc8 wi wn wv5 wc5 wi wn
+      wn wc5 wi wi wi wi wi wi wi wi wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi
+      wv3 wv5 wc5 wi wn wn wc9 wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi wv0 wc5 wc7
+      wi wi wc9 wn wv9 wv4 wi wi wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi wn wi wc4
+      wv3 wi wc5 wv9 wi wi wc3 wv9 wn wi wi wc2 wn wc8 wi wn wv5 wc5 wi wn wn
+      wc5 wi wi wi wi wi wi wi wi wi wv5 wc5 wi wn wn wc9 wc8 wi wc8 wc1 wi wi
+      wv9 wc0 wi wi wv0 wc5 wc7 wi wi wc9 wn wv9 wv4 wi wi wi wc9 wn wc5 wc3 wi
+      wi wc9 wv9 wi wn wi wc4 wv3 wi wc5 wv9 wi wi wc3 wv9 wn wi wi wc2 wn wc8
+      wi wn wv5 wc5 wi wn wn wc5 wi wi wi wi wi wi wi wv3 wv5 wc5 wi wn wn wc9
+      wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi wv0 wc5 wc7 wi wi wc9 wn wv9 wv4 wi wi
+      wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi wn wi wc4 wv3 wi wc5 wv9 wi wi wc3 wv9
+      wn wi wi wc2 wn wc8 wi wn wv5 wc5 wi wn wn wc5 wi wi wi wi wi wi wi wi
+      wv5 wc9 wv9 wv3 wv4 wc5 wv0 th85 wv5 wc5 wi wn wn wc9 wc8 wi wc8 wc1 wi
+      wi wv9 wc0 wi wi wv0 wc5 wc7 wi wi wc9 wn wv9 wv4 wi wi wi wc9 wn wc5 wc3
+      wi wi wc9 wv9 wi wn wi wc4 wv3 wi wc5 wv9 wi wi wc3 wv9 wn wi wi wc2 wn
+      wc8 wi wn wv5 wc5 wi wn wn wc5 wi wi wi wi wi wi wi wv3 ax-1 ax-mp wv3
+      wv5 wc5 wi wn wn wc9 wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi wv0 wc5 wc7 wi wi
+      wc9 wn wv9 wv4 wi wi wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi wn wi wc4 wv3 wi
+      wc5 wv9 wi wi wc3 wv9 wn wi wi wc2 wn wc8 wi wn wv5 wc5 wi wn wn wc5 wi
+      wi wi wi wi wi wi wi wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi ax-1 ax-mp
+      wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi wv3 wv5 wc5 wi wn wn wc9 wc8 wi
+      wc8 wc1 wi wi wv9 wc0 wi wi wv0 wc5 wc7 wi wi wc9 wn wv9 wv4 wi wi wi wc9
+      wn wc5 wc3 wi wi wc9 wv9 wi wn wi wc4 wv3 wi wc5 wv9 wi wi wc3 wv9 wn wi
+      wi wc2 wn wc8 wi wn wv5 wc5 wi wn wn wc5 wi wi wi wi wi wi wi wi wi wv4
+      ax-1 ax-mp wv4 wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi wv3 wv5 wc5 wi
+      wn wn wc9 wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi wv0 wc5 wc7 wi wi wc9 wn wv9
+      wv4 wi wi wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi wn wi wc4 wv3 wi wc5 wv9 wi
+      wi wc3 wv9 wn wi wi wc2 wn wc8 wi wn wv5 wc5 wi wn wn wc5 wi wi wi wi wi
+      wi wi wi wi wi wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi ax-1 ax-mp wv3
+      wv8 wi wc4 wi wv4 wn wc9 wc2 wi wi wi wv4 wv3 wv8 wi wc4 wi wv4 wn wc9
+      wc2 wi wi wi wv3 wv5 wc5 wi wn wn wc9 wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi
+      wv0 wc5 wc7 wi wi wc9 wn wv9 wv4 wi wi wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi
+      wn wi wc4 wv3 wi wc5 wv9 wi wi wc3 wv9 wn wi wi wc2 wn wc8 wi wn wv5 wc5
+      wi wn wn wc5 wi wi wi wi wi wi wi wi wi wi wi wv0 ax-1 ax-mp wv0 wv3 wv8
+      wi wc4 wi wv4 wn wc9 wc2 wi wi wi wv4 wv3 wv8 wi wc4 wi wv4 wn wc9 wc2 wi
+      wi wi wv3 wv5 wc5 wi wn wn wc9 wc8 wi wc8 wc1 wi wi wv9 wc0 wi wi wv0 wc5
+      wc7 wi wi wc9 wn wv9 wv4 wi wi wi wc9 wn wc5 wc3 wi wi wc9 wv9 wi wn wi
+      wc4 wv3 wi wc5 wv9 wi wi wc3 wv9 wn wi wi wc2 wn wc8 wi wn wv5 wc5 wi wn
+      wn wc5 wi wi wi wi wi wi wi wi wi wi wi wi wc6 wc0 wi wv8 wc6 wi wi wn
+      ax-1 ax-mp $.
+  th155 $p |- ( ( ( ( v7 -> v7 ) -> -. v8 ) -> ( ( c5 -> v9 ) -> ( c9 -> c3 ) ) ) -> ( v1 -> ( v3 -> ( ( -. ( c8 -> c9 ) -> ( ( v1 -> v3 ) -> c6 ) ) -> ( ( c6 -> c6 ) -> ( ( c6 -> c6 ) -> ( v3 -> ( v3 -> ( ( ( ( c6 -> v3 ) -> ( c9 -> c8 ) ) -> -. ( c3 -> c6 ) ) -> ( c6 -> c6 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc8 wc9 wi wn wc6 wc3 wc5 th59 ax-1 ax-mp ) ABFGHIABHJHHJJHJJHBBJBHGFHH
+      KJHIHJJHHHHHHHHZHZCCHDIHLEHGKHHHZQHPQBAKBBJGJMPANOQRNO $.
+  th156 $p |- ( ( ( ( v2 -> v1 ) -> -. v5 ) -> ( ( v7 -> c4 ) -> ( v6 -> c8 ) ) ) -> ( ( ( ( v8 -> c2 ) -> ( v0 -> v6 ) ) -> -. ( c6 -> c2 ) ) -> ( ( ( ( v7 -> v0 ) -> v1 ) -> ( c6 -> ( c2 -> c8 ) ) ) -> ( v2 -> ( -. c8 -> ( ( ( -. c2 -> ( v9 -> v5 ) ) -> c2 ) -> ( ( v0 -> v3 ) -> ( -. c8 -> ( v0 -> v3 ) ) ) ) ) ) ) ) ) $=
+      ( wv4 wi wn wc4 wc8 wc2 wc6 ax-1 ax-mp ) JJJKKZCBKELKGMKFNKKKZHOKAFKKPOKL
+      KZGAKBKPONKKKZCNLZOLIEKKOKZADKZUCUEKKZKZKZKZKZKZKZJJQULSULKUKULUJUKUIUJUH
+      UIUGUHUFUGUEUCQUFUDQRUGUCQRUHCQRUIUBQRUJUAQRUKTQRULSQRR $.
+  th157 $p |- ( c2 -> ( c0 -> ( ( ( ( c7 -> c6 ) -> ( c6 -> c5 ) ) -> ( ( v5 -> v7 ) -> v1 ) ) -> ( c4 -> ( -. ( -. c5 -> ( c9 -> v5 ) ) -> ( ( v9 -> v2 ) -> ( ( v9 -> -. ( v2 -> v3 ) ) -> ( ( ( v9 -> v2 ) -> ( c4 -> ( v9 -> v2 ) ) ) -> ( ( ( v9 -> v2 ) -> c4 ) -> ( ( v9 -> v2 ) -> ( v9 -> v2 ) ) ) ) ) ) ) ) ) ) ) $=
+      wc0 wc7 wc6 wi wc6 wc5 wi wi wv5 wv7 wi wv1 wi wi wc4 wc5 wn wc9 wv5 wi
+      wi wn wv9 wv2 wi wv9 wv2 wv3 wi wn wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9
+      wv2 wi wc4 wi wv9 wv2 wi wv9 wv2 wi wi wi wi wi wi wi wi wi wi wc2 wc0
+      wc7 wc6 wi wc6 wc5 wi wi wv5 wv7 wi wv1 wi wi wc4 wc5 wn wc9 wv5 wi wi wn
+      wv9 wv2 wi wv9 wv2 wv3 wi wn wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2
+      wi wc4 wi wv9 wv2 wi wv9 wv2 wi wi wi wi wi wi wi wi wi wi wi wc7 wc6 wi
+      wc6 wc5 wi wi wv5 wv7 wi wv1 wi wi wc4 wc5 wn wc9 wv5 wi wi wn wv9 wv2 wi
+      wv9 wv2 wv3 wi wn wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi
+      wv9 wv2 wi wv9 wv2 wi wi wi wi wi wi wi wi wi wc0 wc7 wc6 wi wc6 wc5 wi
+      wi wv5 wv7 wi wv1 wi wi wc4 wc5 wn wc9 wv5 wi wi wn wv9 wv2 wi wv9 wv2
+      wv3 wi wn wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi
+      wv9 wv2 wi wi wi wi wi wi wi wi wi wi wc4 wc5 wn wc9 wv5 wi wi wn wv9 wv2
+      wi wv9 wv2 wv3 wi wn wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi
+      wv9 wv2 wi wv9 wv2 wi wi wi wi wi wi wi wi wc7 wc6 wi wc6 wc5 wi wi wv5
+      wv7 wi wv1 wi wi wc4 wc5 wn wc9 wv5 wi wi wn wv9 wv2 wi wv9 wv2 wv3 wi wn
+      wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi wv9 wv2
+      wi wi wi wi wi wi wi wi wi wc5 wn wc9 wv5 wi wi wn wv9 wv2 wi wv9 wv2 wv3
+      wi wn wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi wv9
+      wv2 wi wi wi wi wi wi wi wc4 wc5 wn wc9 wv5 wi wi wn wv9 wv2 wi wv9 wv2
+      wv3 wi wn wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi
+      wv9 wv2 wi wi wi wi wi wi wi wi wv9 wv2 wi wv9 wv2 wv3 wi wn wi wv9 wv2
+      wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi wv9 wv2 wi wi wi wi
+      wi wi wc5 wn wc9 wv5 wi wi wn wv9 wv2 wi wv9 wv2 wv3 wi wn wi wv9 wv2 wi
+      wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi wv9 wv2 wi wi wi wi wi
+      wi wi wv9 wv2 wv3 wi wn wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4
+      wi wv9 wv2 wi wv9 wv2 wi wi wi wi wi wv9 wv2 wi wv9 wv2 wv3 wi wn wi wv9
+      wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi wv9 wv2 wi wi wi
+      wi wi wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi wv9
+      wv2 wi wi wi wi wv9 wv2 wv3 wi wn wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9
+      wv2 wi wc4 wi wv9 wv2 wi wv9 wv2 wi wi wi wi wi wv9 wv2 wi wc4 wv9 wv2 wi
+      ax-2 wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi wv9 wv2
+      wi wi wi wi wv9 wv2 wv3 wi wn wi ax-1 ax-mp wv9 wv2 wv3 wi wn wi wv9 wv2
+      wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi wv9 wv2 wi wi wi wi
+      wi wv9 wv2 wi ax-1 ax-mp wv9 wv2 wi wv9 wv2 wv3 wi wn wi wv9 wv2 wi wc4
+      wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi wv9 wv2 wi wi wi wi wi wi
+      wc5 wn wc9 wv5 wi wi wn ax-1 ax-mp wc5 wn wc9 wv5 wi wi wn wv9 wv2 wi wv9
+      wv2 wv3 wi wn wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9
+      wv2 wi wv9 wv2 wi wi wi wi wi wi wi wc4 ax-1 ax-mp wc4 wc5 wn wc9 wv5 wi
+      wi wn wv9 wv2 wi wv9 wv2 wv3 wi wn wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9
+      wv2 wi wc4 wi wv9 wv2 wi wv9 wv2 wi wi wi wi wi wi wi wi wc7 wc6 wi wc6
+      wc5 wi wi wv5 wv7 wi wv1 wi wi ax-1 ax-mp wc7 wc6 wi wc6 wc5 wi wi wv5
+      wv7 wi wv1 wi wi wc4 wc5 wn wc9 wv5 wi wi wn wv9 wv2 wi wv9 wv2 wv3 wi wn
+      wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi wv9 wv2
+      wi wi wi wi wi wi wi wi wi wc0 ax-1 ax-mp wc0 wc7 wc6 wi wc6 wc5 wi wi
+      wv5 wv7 wi wv1 wi wi wc4 wc5 wn wc9 wv5 wi wi wn wv9 wv2 wi wv9 wv2 wv3
+      wi wn wi wv9 wv2 wi wc4 wv9 wv2 wi wi wi wv9 wv2 wi wc4 wi wv9 wv2 wi wv9
+      wv2 wi wi wi wi wi wi wi wi wi wi wc2 ax-1 ax-mp $.
+  th158 $p |- ( ( ( v3 -> ( v0 -> c5 ) ) -> c5 ) -> ( -. -. ( v7 -> v1 ) -> ( ( ( ( c1 -> v7 ) -> ( v3 -> c9 ) ) -> ( c1 -> c4 ) ) -> ( ( ( ( v6 -> c1 ) -> ( v3 -> v6 ) ) -> ( ( v5 -> c2 ) -> ( v7 -> c9 ) ) ) -> ( -. -. ( v6 -> v6 ) -> ( v2 -> v8 ) ) ) ) ) ) $=
+      wv7 wv1 wi wn wn wc1 wv7 wi wv3 wc9 wi wi wc1 wc4 wi wi wv6 wc1 wi wv3
+      wv6 wi wi wv5 wc2 wi wv7 wc9 wi wi wi wv6 wv6 wi wn wn wv2 wv8 wi wi wi
+      wi wi wv3 wv0 wc5 wi wi wc5 wi wv7 wv1 wi wn wn wc1 wv7 wi wv3 wc9 wi wi
+      wc1 wc4 wi wi wv6 wc1 wi wv3 wv6 wi wi wv5 wc2 wi wv7 wc9 wi wi wi wv6
+      wv6 wi wn wn wv2 wv8 wi wi wi wi wi wi wc1 wv7 wi wv3 wc9 wi wi wc1 wc4
+      wi wi wv6 wc1 wi wv3 wv6 wi wi wv5 wc2 wi wv7 wc9 wi wi wi wv6 wv6 wi wn
+      wn wv2 wv8 wi wi wi wi wv7 wv1 wi wn wn wc1 wv7 wi wv3 wc9 wi wi wc1 wc4
+      wi wi wv6 wc1 wi wv3 wv6 wi wi wv5 wc2 wi wv7 wc9 wi wi wi wv6 wv6 wi wn
+      wn wv2 wv8 wi wi wi wi wi wv6 wc1 wi wv3 wv6 wi wi wv5 wc2 wi wv7 wc9 wi
+      wi wi wv6 wv6 wi wn wn wv2 wv8 wi wi wi wc1 wv7 wi wv3 wc9 wi wi wc1 wc4
+      wi wi wv6 wc1 wi wv3 wv6 wi wi wv5 wc2 wi wv7 wc9 wi wi wi wv6 wv6 wi wn
+      wn wv2 wv8 wi wi wi wi wv6 wv6 wi wn wn wv2 wv8 wi wi wv6 wc1 wi wv3 wv6
+      wi wi wv5 wc2 wi wv7 wc9 wi wi wi wv6 wv6 wi wn wn wv2 wv8 wi wi wi wv2
+      wv8 wi wv6 wv6 wi wn wn wv2 wv8 wi wi wv2 wv8 wi ax-g4 wv2 wv8 wi wv6 wv6
+      wi wn wn ax-1 ax-mp wv6 wv6 wi wn wn wv2 wv8 wi wi wv6 wc1 wi wv3 wv6 wi
+      wi wv5 wc2 wi wv7 wc9 wi wi wi ax-1 ax-mp wv6 wc1 wi wv3 wv6 wi wi wv5
+      wc2 wi wv7 wc9 wi wi wi wv6 wv6 wi wn wn wv2 wv8 wi wi wi wc1 wv7 wi wv3
+      wc9 wi wi wc1 wc4 wi wi ax-1 ax-mp wc1 wv7 wi wv3 wc9 wi wi wc1 wc4 wi wi
+      wv6 wc1 wi wv3 wv6 wi wi wv5 wc2 wi wv7 wc9 wi wi wi wv6 wv6 wi wn wn wv2
+      wv8 wi wi wi wi wv7 wv1 wi wn wn ax-1 ax-mp wv7 wv1 wi wn wn wc1 wv7 wi
+      wv3 wc9 wi wi wc1 wc4 wi wi wv6 wc1 wi wv3 wv6 wi wi wv5 wc2 wi wv7 wc9
+      wi wi wi wv6 wv6 wi wn wn wv2 wv8 wi wi wi wi wi wv3 wv0 wc5 wi wi wc5 wi
+      ax-1 ax-mp $.
+  th159 $p |- ( ( ( ( c0 -> v4 ) -> -. v0 ) -> c7 ) -> ( v6 -> ( ( ( c0 -> ( v1 -> v0 ) ) -> ( v4 -> c9 ) ) -> ( ( ( ( v3 -> c1 ) -> c4 ) -> ( c6 -> -. c7 ) ) -> ( -. ( ( c0 -> c4 ) -> ( c0 -> c4 ) ) -> ( -. ( v7 -> v6 ) -> ( v4 -> ( v7 -> v6 ) ) ) ) ) ) ) ) $=
+      wv6 wc0 wv1 wv0 wi wi wv4 wc9 wi wi wv3 wc1 wi wc4 wi wc6 wc7 wn wi wi
+      wc0 wc4 wi wc0 wc4 wi wi wn wv7 wv6 wi wn wv4 wv7 wv6 wi wi wi wi wi wi
+      wi wc0 wv4 wi wv0 wn wi wc7 wi wv6 wc0 wv1 wv0 wi wi wv4 wc9 wi wi wv3
+      wc1 wi wc4 wi wc6 wc7 wn wi wi wc0 wc4 wi wc0 wc4 wi wi wn wv7 wv6 wi wn
+      wv4 wv7 wv6 wi wi wi wi wi wi wi wi wc0 wv1 wv0 wi wi wv4 wc9 wi wi wv3
+      wc1 wi wc4 wi wc6 wc7 wn wi wi wc0 wc4 wi wc0 wc4 wi wi wn wv7 wv6 wi wn
+      wv4 wv7 wv6 wi wi wi wi wi wi wv6 wc0 wv1 wv0 wi wi wv4 wc9 wi wi wv3 wc1
+      wi wc4 wi wc6 wc7 wn wi wi wc0 wc4 wi wc0 wc4 wi wi wn wv7 wv6 wi wn wv4
+      wv7 wv6 wi wi wi wi wi wi wi wv3 wc1 wi wc4 wi wc6 wc7 wn wi wi wc0 wc4
+      wi wc0 wc4 wi wi wn wv7 wv6 wi wn wv4 wv7 wv6 wi wi wi wi wi wc0 wv1 wv0
+      wi wi wv4 wc9 wi wi wv3 wc1 wi wc4 wi wc6 wc7 wn wi wi wc0 wc4 wi wc0 wc4
+      wi wi wn wv7 wv6 wi wn wv4 wv7 wv6 wi wi wi wi wi wi wc0 wc4 wi wc0 wc4
+      wi wi wn wv7 wv6 wi wn wv4 wv7 wv6 wi wi wi wi wv3 wc1 wi wc4 wi wc6 wc7
+      wn wi wi wc0 wc4 wi wc0 wc4 wi wi wn wv7 wv6 wi wn wv4 wv7 wv6 wi wi wi
+      wi wi wc0 wc4 wi wc0 wc4 wi wv4 wv7 wv6 wi ax-g9 wc0 wc4 wi wc0 wc4 wi wi
+      wn wv7 wv6 wi wn wv4 wv7 wv6 wi wi wi wi wv3 wc1 wi wc4 wi wc6 wc7 wn wi
+      wi ax-1 ax-mp wv3 wc1 wi wc4 wi wc6 wc7 wn wi wi wc0 wc4 wi wc0 wc4 wi wi
+      wn wv7 wv6 wi wn wv4 wv7 wv6 wi wi wi wi wi wc0 wv1 wv0 wi wi wv4 wc9 wi
+      wi ax-1 ax-mp wc0 wv1 wv0 wi wi wv4 wc9 wi wi wv3 wc1 wi wc4 wi wc6 wc7
+      wn wi wi wc0 wc4 wi wc0 wc4 wi wi wn wv7 wv6 wi wn wv4 wv7 wv6 wi wi wi
+      wi wi wi wv6 ax-1 ax-mp wv6 wc0 wv1 wv0 wi wi wv4 wc9 wi wi wv3 wc1 wi
+      wc4 wi wc6 wc7 wn wi wi wc0 wc4 wi wc0 wc4 wi wi wn wv7 wv6 wi wn wv4 wv7
+      wv6 wi wi wi wi wi wi wi wc0 wv4 wi wv0 wn wi wc7 wi ax-1 ax-mp $.
+  th160 $p |- ( v8 -> ( -. -. ( v8 -> v3 ) -> ( ( v2 -> v4 ) -> ( v8 -> ( v8 -> ( ( ( ( v1 -> v6 ) -> ( v9 -> v0 ) ) -> ( ( v6 -> v3 ) -> ( c8 -> c9 ) ) ) -> ( ( c6 -> ( ( v5 -> v0 ) -> ( c3 -> v3 ) ) ) -> ( ( ( ( v0 -> v5 ) -> ( v8 -> c7 ) ) -> c0 ) -> ( v8 -> ( ( ( ( c3 -> v8 ) -> ( c0 -> v2 ) ) -> c7 ) -> ( ( c0 -> c1 ) -> ( c0 -> ( ( ( -. v2 -> ( c3 -> v2 ) ) -> ( ( v6 -> c0 ) -> ( v8 -> v0 ) ) ) -> ( ( ( -. v2 -> ( c3 -> v2 ) ) -> ( ( v6 -> c0 ) -> ( v8 -> v0 ) ) ) -> -. ( ( v6 -> v6 ) -> ( v6 -> v6 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv8 wv3 wi wn wn wv2 wv4 wi wv8 wv8 wv1 wv6 wi wv9 wv0 wi wi wv6 wv3 wi
+      wc8 wc9 wi wi wi wc6 wv5 wv0 wi wc3 wv3 wi wi wi wv0 wv5 wi wv8 wc7 wi wi
+      wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1 wi wc0 wv2 wn wc3 wv2
+      wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0
+      wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi
+      wi wv8 wv8 wv3 wi wn wn wv2 wv4 wi wv8 wv8 wv1 wv6 wi wv9 wv0 wi wi wv6
+      wv3 wi wc8 wc9 wi wi wi wc6 wv5 wv0 wi wc3 wv3 wi wi wi wv0 wv5 wi wv8
+      wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1 wi wc0 wv2
+      wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi wi wv6 wc0
+      wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wv2 wv4 wi wv8 wv8 wv1 wv6 wi wv9 wv0 wi wi wv6 wv3 wi
+      wc8 wc9 wi wi wi wc6 wv5 wv0 wi wc3 wv3 wi wi wi wv0 wv5 wi wv8 wc7 wi wi
+      wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1 wi wc0 wv2 wn wc3 wv2
+      wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0
+      wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi
+      wv8 wv3 wi wn wn wv2 wv4 wi wv8 wv8 wv1 wv6 wi wv9 wv0 wi wi wv6 wv3 wi
+      wc8 wc9 wi wi wi wc6 wv5 wv0 wi wc3 wv3 wi wi wi wv0 wv5 wi wv8 wc7 wi wi
+      wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1 wi wc0 wv2 wn wc3 wv2
+      wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0
+      wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi
+      wi wv8 wv8 wv1 wv6 wi wv9 wv0 wi wi wv6 wv3 wi wc8 wc9 wi wi wi wc6 wv5
+      wv0 wi wc3 wv3 wi wi wi wv0 wv5 wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi
+      wc0 wv2 wi wi wc7 wi wc0 wc1 wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8
+      wv0 wi wi wi wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi
+      wv6 wv6 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wv2 wv4 wi wv8 wv8 wv1
+      wv6 wi wv9 wv0 wi wi wv6 wv3 wi wc8 wc9 wi wi wi wc6 wv5 wv0 wi wc3 wv3
+      wi wi wi wv0 wv5 wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7
+      wi wc0 wc1 wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn
+      wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi
+      wi wi wi wi wi wi wi wi wi wi wi wv8 wv1 wv6 wi wv9 wv0 wi wi wv6 wv3 wi
+      wc8 wc9 wi wi wi wc6 wv5 wv0 wi wc3 wv3 wi wi wi wv0 wv5 wi wv8 wc7 wi wi
+      wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1 wi wc0 wv2 wn wc3 wv2
+      wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0
+      wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi wi wi wi wi wi wv8
+      wv8 wv1 wv6 wi wv9 wv0 wi wi wv6 wv3 wi wc8 wc9 wi wi wi wc6 wv5 wv0 wi
+      wc3 wv3 wi wi wi wv0 wv5 wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2
+      wi wi wc7 wi wc0 wc1 wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi
+      wi wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi
+      wi wn wi wi wi wi wi wi wi wi wi wi wi wv1 wv6 wi wv9 wv0 wi wi wv6 wv3
+      wi wc8 wc9 wi wi wi wc6 wv5 wv0 wi wc3 wv3 wi wi wi wv0 wv5 wi wv8 wc7 wi
+      wi wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1 wi wc0 wv2 wn wc3
+      wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8
+      wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi wi wi wi wi wv8
+      wv1 wv6 wi wv9 wv0 wi wi wv6 wv3 wi wc8 wc9 wi wi wi wc6 wv5 wv0 wi wc3
+      wv3 wi wi wi wv0 wv5 wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi
+      wc7 wi wc0 wc1 wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi
+      wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi
+      wn wi wi wi wi wi wi wi wi wi wi wc6 wv5 wv0 wi wc3 wv3 wi wi wi wv0 wv5
+      wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1 wi
+      wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi wi
+      wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi wi
+      wi wi wv1 wv6 wi wv9 wv0 wi wi wv6 wv3 wi wc8 wc9 wi wi wi wc6 wv5 wv0 wi
+      wc3 wv3 wi wi wi wv0 wv5 wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2
+      wi wi wc7 wi wc0 wc1 wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi
+      wi wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi
+      wi wn wi wi wi wi wi wi wi wi wi wv0 wv5 wi wv8 wc7 wi wi wc0 wi wv8 wc3
+      wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1 wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0
+      wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv6
+      wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi wi wi wc6 wv5 wv0 wi wc3 wv3 wi wi
+      wi wv0 wv5 wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi
+      wc0 wc1 wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn
+      wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi
+      wi wi wi wi wi wi wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1 wi wc0
+      wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi wi wv6
+      wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi wi wv0
+      wv5 wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1
+      wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi
+      wi wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi
+      wi wi wv6 wv6 wv8 wv0 wc0 wv8 wc0 wv2 wc3 th144 wv8 wc3 wv8 wi wc0 wv2 wi
+      wi wc7 wi wc0 wc1 wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi
+      wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi
+      wn wi wi wi wi wi wi wv0 wv5 wi wv8 wc7 wi wi wc0 wi ax-1 ax-mp wv0 wv5
+      wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1 wi
+      wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi wi
+      wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi wi
+      wi wc6 wv5 wv0 wi wc3 wv3 wi wi wi ax-1 ax-mp wc6 wv5 wv0 wi wc3 wv3 wi
+      wi wi wv0 wv5 wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi
+      wc0 wc1 wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn
+      wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi
+      wi wi wi wi wi wi wi wv1 wv6 wi wv9 wv0 wi wi wv6 wv3 wi wc8 wc9 wi wi wi
+      ax-1 ax-mp wv1 wv6 wi wv9 wv0 wi wi wv6 wv3 wi wc8 wc9 wi wi wi wc6 wv5
+      wv0 wi wc3 wv3 wi wi wi wv0 wv5 wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi
+      wc0 wv2 wi wi wc7 wi wc0 wc1 wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8
+      wv0 wi wi wi wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi
+      wv6 wv6 wi wi wn wi wi wi wi wi wi wi wi wi wv8 ax-1 ax-mp wv8 wv1 wv6 wi
+      wv9 wv0 wi wi wv6 wv3 wi wc8 wc9 wi wi wi wc6 wv5 wv0 wi wc3 wv3 wi wi wi
+      wv0 wv5 wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0
+      wc1 wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3
+      wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi
+      wi wi wi wi wi wi wi wi wv8 ax-1 ax-mp wv8 wv8 wv1 wv6 wi wv9 wv0 wi wi
+      wv6 wv3 wi wc8 wc9 wi wi wi wc6 wv5 wv0 wi wc3 wv3 wi wi wi wv0 wv5 wi
+      wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1 wi wc0
+      wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi wi wv6
+      wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi wi wi
+      wi wi wi wi wv2 wv4 wi ax-1 ax-mp wv2 wv4 wi wv8 wv8 wv1 wv6 wi wv9 wv0
+      wi wi wv6 wv3 wi wc8 wc9 wi wi wi wc6 wv5 wv0 wi wc3 wv3 wi wi wi wv0 wv5
+      wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0 wv2 wi wi wc7 wi wc0 wc1 wi
+      wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv2 wn wc3 wv2 wi wi
+      wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6 wv6 wi wi wn wi wi wi wi wi wi
+      wi wi wi wi wi wi wv8 wv3 wi wn wn ax-1 ax-mp wv8 wv3 wi wn wn wv2 wv4 wi
+      wv8 wv8 wv1 wv6 wi wv9 wv0 wi wi wv6 wv3 wi wc8 wc9 wi wi wi wc6 wv5 wv0
+      wi wc3 wv3 wi wi wi wv0 wv5 wi wv8 wc7 wi wi wc0 wi wv8 wc3 wv8 wi wc0
+      wv2 wi wi wc7 wi wc0 wc1 wi wc0 wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0
+      wi wi wi wv2 wn wc3 wv2 wi wi wv6 wc0 wi wv8 wv0 wi wi wi wv6 wv6 wi wv6
+      wv6 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi wi wv8 ax-1 ax-mp $.
+  th161 $p |- ( -. v3 -> ( ( v3 -> v1 ) -> ( ( -. v8 -> ( v3 -> v1 ) ) -> -. ( -. c5 -> -. c3 ) ) ) ) $=
+      ( wv4 wi wn wc5 wc3 ax-1 ax-g0 ax-mp ) DDDEEZBFZBAEZCFZNEGFZHFZEFEZEZEZDD
+      ITLTESTRSPQNOJRNIKSMIKTLIKK $.
+  wth8 $p wff -. ( ( c5 -> ( c0 -> c2 ) ) -> ( ( v9 -> v8 ) -> v1 ) ) $=
+      ( wc5 wc0 wc2 wi wn ) DEFGGCBGAGGH $.
+  th162 $p |- ( ( v9 -> ( -. v2 -> ( v6 -> c6 ) ) ) -> ( ( ( ( c5 -> v9 ) -> -. v5 ) -> v8 ) -> ( -. ( ( c1 -> v3 ) -> ( c4 -> c4 ) ) -> ( -. ( ( c1 -> v3 ) -> ( c4 -> c4 ) ) -> ( -. v9 -> ( -. v9 -> ( -. v9 -> ( -. v5 -> -. ( v9 -> v9 ) ) ) ) ) ) ) ) ) $=
+      wc5 wv9 wi wv5 wn wi wv8 wi wc1 wv3 wi wc4 wc4 wi wi wn wc1 wv3 wi wc4
+      wc4 wi wi wn wv9 wn wv9 wn wv9 wn wv5 wn wv9 wv9 wi wn wi wi wi wi wi wi
+      wi wv9 wv2 wn wv6 wc6 wi wi wi wc5 wv9 wi wv5 wn wi wv8 wi wc1 wv3 wi wc4
+      wc4 wi wi wn wc1 wv3 wi wc4 wc4 wi wi wn wv9 wn wv9 wn wv9 wn wv5 wn wv9
+      wv9 wi wn wi wi wi wi wi wi wi wi wc1 wv3 wi wc4 wc4 wi wi wn wc1 wv3 wi
+      wc4 wc4 wi wi wn wv9 wn wv9 wn wv9 wn wv5 wn wv9 wv9 wi wn wi wi wi wi wi
+      wi wc5 wv9 wi wv5 wn wi wv8 wi wc1 wv3 wi wc4 wc4 wi wi wn wc1 wv3 wi wc4
+      wc4 wi wi wn wv9 wn wv9 wn wv9 wn wv5 wn wv9 wv9 wi wn wi wi wi wi wi wi
+      wi wc1 wv3 wi wc4 wc4 wi wi wn wv9 wn wv9 wn wv9 wn wv5 wn wv9 wv9 wi wn
+      wi wi wi wi wi wc1 wv3 wi wc4 wc4 wi wi wn wc1 wv3 wi wc4 wc4 wi wi wn
+      wv9 wn wv9 wn wv9 wn wv5 wn wv9 wv9 wi wn wi wi wi wi wi wi wv9 wn wv9 wn
+      wv9 wn wv5 wn wv9 wv9 wi wn wi wi wi wi wc1 wv3 wi wc4 wc4 wi wi wn wv9
+      wn wv9 wn wv9 wn wv5 wn wv9 wv9 wi wn wi wi wi wi wi wv9 wn wv9 wn wv5 wn
+      wv9 wv9 wi wn wi wi wi wv9 wn wv9 wn wv9 wn wv5 wn wv9 wv9 wi wn wi wi wi
+      wi wv9 wn wv5 wn wv9 wv9 wi wn wi wi wv9 wn wv9 wn wv5 wn wv9 wv9 wi wn
+      wi wi wi wv5 wn wv9 wv9 wi wn wi wv9 wn wv5 wn wv9 wv9 wi wn wi wi wv5
+      wv9 ax-g7 wv5 wn wv9 wv9 wi wn wi wv9 wn ax-1 ax-mp wv9 wn wv5 wn wv9 wv9
+      wi wn wi wi wv9 wn ax-1 ax-mp wv9 wn wv9 wn wv5 wn wv9 wv9 wi wn wi wi wi
+      wv9 wn ax-1 ax-mp wv9 wn wv9 wn wv9 wn wv5 wn wv9 wv9 wi wn wi wi wi wi
+      wc1 wv3 wi wc4 wc4 wi wi wn ax-1 ax-mp wc1 wv3 wi wc4 wc4 wi wi wn wv9 wn
+      wv9 wn wv9 wn wv5 wn wv9 wv9 wi wn wi wi wi wi wi wc1 wv3 wi wc4 wc4 wi
+      wi wn ax-1 ax-mp wc1 wv3 wi wc4 wc4 wi wi wn wc1 wv3 wi wc4 wc4 wi wi wn
+      wv9 wn wv9 wn wv9 wn wv5 wn wv9 wv9 wi wn wi wi wi wi wi wi wc5 wv9 wi
+      wv5 wn wi wv8 wi ax-1 ax-mp wc5 wv9 wi wv5 wn wi wv8 wi wc1 wv3 wi wc4
+      wc4 wi wi wn wc1 wv3 wi wc4 wc4 wi wi wn wv9 wn wv9 wn wv9 wn wv5 wn wv9
+      wv9 wi wn wi wi wi wi wi wi wi wv9 wv2 wn wv6 wc6 wi wi wi ax-1 ax-mp $.
+  th163 $p |- ( v7 -> ( ( ( ( c0 -> v1 ) -> ( v4 -> c6 ) ) -> ( ( c0 -> v0 ) -> ( v9 -> c2 ) ) ) -> ( v4 -> ( ( ( ( c0 -> v1 ) -> ( v4 -> c6 ) ) -> ( ( c0 -> v0 ) -> ( v9 -> c2 ) ) ) -> ( ( ( ( c0 -> v1 ) -> ( v4 -> c6 ) ) -> ( ( c0 -> v0 ) -> ( v9 -> c2 ) ) ) -> ( c2 -> ( c0 -> ( ( ( ( c7 -> c6 ) -> ( c6 -> c5 ) ) -> ( ( c5 -> c5 ) -> c0 ) ) -> ( c4 -> ( -. ( -. c5 -> ( c9 -> c5 ) ) -> ( ( c4 -> v4 ) -> ( ( c4 -> -. ( v4 -> v4 ) ) -> ( ( ( c4 -> v4 ) -> ( c4 -> ( c4 -> v4 ) ) ) -> ( ( ( c4 -> v4 ) -> c4 ) -> ( ( c4 -> v4 ) -> ( c4 -> v4 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc0 wi wc6 wc2 wc7 wc5 wc4 wn wc9 th157 ax-1 ax-mp ) FBGCHGGFAGEIGGGZCR
+      RIFJHGHKGGKKGFGGLKMNKGGMLCGLCCGMGLCGLLCGGGLCGLGLCGLCGGGGGGGGGGGZGZGZGZGZD
+      UCGUBUCUAUBTUASTFCCKKLOSRPQTRPQUACPQUBRPQUCDPQ $.
+  th164 $p |- ( v1 -> ( v5 -> ( ( ( c7 -> ( c4 -> v9 ) ) -> -. v0 ) -> ( ( v7 -> c3 ) -> ( ( ( ( v4 -> v0 ) -> -. c8 ) -> ( ( c7 -> v5 ) -> -. c8 ) ) -> -. ( ( -. c6 -> v5 ) -> ( v1 -> v1 ) ) ) ) ) ) ) $=
+      wv5 wc7 wc4 wv9 wi wi wv0 wn wi wv7 wc3 wi wv4 wv0 wi wc8 wn wi wc7 wv5
+      wi wc8 wn wi wi wc6 wn wv5 wi wv1 wv1 wi wi wn wi wi wi wi wv1 wv5 wc7
+      wc4 wv9 wi wi wv0 wn wi wv7 wc3 wi wv4 wv0 wi wc8 wn wi wc7 wv5 wi wc8 wn
+      wi wi wc6 wn wv5 wi wv1 wv1 wi wi wn wi wi wi wi wi wc7 wc4 wv9 wi wi wv0
+      wn wi wv7 wc3 wi wv4 wv0 wi wc8 wn wi wc7 wv5 wi wc8 wn wi wi wc6 wn wv5
+      wi wv1 wv1 wi wi wn wi wi wi wv5 wc7 wc4 wv9 wi wi wv0 wn wi wv7 wc3 wi
+      wv4 wv0 wi wc8 wn wi wc7 wv5 wi wc8 wn wi wi wc6 wn wv5 wi wv1 wv1 wi wi
+      wn wi wi wi wi wv7 wc3 wi wv4 wv0 wi wc8 wn wi wc7 wv5 wi wc8 wn wi wi
+      wc6 wn wv5 wi wv1 wv1 wi wi wn wi wi wc7 wc4 wv9 wi wi wv0 wn wi wv7 wc3
+      wi wv4 wv0 wi wc8 wn wi wc7 wv5 wi wc8 wn wi wi wc6 wn wv5 wi wv1 wv1 wi
+      wi wn wi wi wi wv4 wv0 wi wc8 wn wi wc7 wv5 wi wc8 wn wi wi wc6 wn wv5 wi
+      wv1 wv1 wi wi wn wi wv7 wc3 wi wv4 wv0 wi wc8 wn wi wc7 wv5 wi wc8 wn wi
+      wi wc6 wn wv5 wi wv1 wv1 wi wi wn wi wi wc6 wn wv5 wi wv1 wv1 wi wi wn
+      wv4 wv0 wi wc8 wn wi wc7 wv5 wi wc8 wn wi wi wc6 wn wv5 wi wv1 wv1 wi wi
+      wn wi wc6 wn wv1 wv5 ax-g8 wc6 wn wv5 wi wv1 wv1 wi wi wn wv4 wv0 wi wc8
+      wn wi wc7 wv5 wi wc8 wn wi wi ax-1 ax-mp wv4 wv0 wi wc8 wn wi wc7 wv5 wi
+      wc8 wn wi wi wc6 wn wv5 wi wv1 wv1 wi wi wn wi wv7 wc3 wi ax-1 ax-mp wv7
+      wc3 wi wv4 wv0 wi wc8 wn wi wc7 wv5 wi wc8 wn wi wi wc6 wn wv5 wi wv1 wv1
+      wi wi wn wi wi wc7 wc4 wv9 wi wi wv0 wn wi ax-1 ax-mp wc7 wc4 wv9 wi wi
+      wv0 wn wi wv7 wc3 wi wv4 wv0 wi wc8 wn wi wc7 wv5 wi wc8 wn wi wi wc6 wn
+      wv5 wi wv1 wv1 wi wi wn wi wi wi wv5 ax-1 ax-mp wv5 wc7 wc4 wv9 wi wi wv0
+      wn wi wv7 wc3 wi wv4 wv0 wi wc8 wn wi wc7 wv5 wi wc8 wn wi wi wc6 wn wv5
+      wi wv1 wv1 wi wi wn wi wi wi wi wv1 ax-1 ax-mp $.
+  th165 $p |- ( v1 -> ( v7 -> v7 ) ) $=
+      wv7 wv7 wi wv1 wv7 wv7 wi wi wv7 wv7 wi ax-g2 wv7 wv7 wi wv1 ax-1 ax-mp
+      $.
+  th166 $p |- ( v3 -> ( c4 -> ( v7 -> ( c4 -> ( v9 -> ( c2 -> ( c4 -> ( v7 -> ( -. ( v7 -> c8 ) -> v7 ) ) ) ) ) ) ) ) ) $=
+      ( wc4 wc2 wc8 wi wn th27 ax-1 ax-mp ) DBDCEDBBFGHBGGGGGGGZGZAMGLMBCDILDJK
+      MAJK $.
+  th167 $p |- ( ( ( v2 -> ( v9 -> v5 ) ) -> ( ( v6 -> v3 ) -> c7 ) ) -> ( -. ( v8 -> c1 ) -> -. ( ( v6 -> v8 ) -> ( v6 -> v8 ) ) ) ) $=
+      wv8 wc1 wi wn wv6 wv8 wi wv6 wv8 wi wi wn wi wv2 wv9 wv5 wi wi wv6 wv3 wi
+      wc7 wi wi wv8 wc1 wi wn wv6 wv8 wi wv6 wv8 wi wi wn wi wi wv8 wc1 wi wv6
+      wv8 wi ax-g7 wv8 wc1 wi wn wv6 wv8 wi wv6 wv8 wi wi wn wi wv2 wv9 wv5 wi
+      wi wv6 wv3 wi wc7 wi wi ax-1 ax-mp $.
+  th168 $p |- ( ( v9 -> ( ( v9 -> v5 ) -> ( c4 -> c0 ) ) ) -> ( ( v2 -> ( -. v1 -> ( c8 -> v3 ) ) ) -> ( ( ( v3 -> ( v7 -> v4 ) ) -> -. v1 ) -> ( ( ( c5 -> ( c6 -> c6 ) ) -> ( ( v8 -> c2 ) -> ( v7 -> c0 ) ) ) -> ( ( ( -. v2 -> ( v0 -> v8 ) ) -> ( ( c2 -> v2 ) -> ( c9 -> c9 ) ) ) -> ( ( ( c9 -> -. v8 ) -> ( ( v6 -> v0 ) -> ( v6 -> c1 ) ) ) -> ( ( v4 -> ( v7 -> ( v7 -> c0 ) ) ) -> ( -. ( v1 -> ( v9 -> v4 ) ) -> ( -. ( ( v5 -> c3 ) -> ( v5 -> v5 ) ) -> ( v2 -> ( -. ( ( v5 -> c3 ) -> ( v5 -> v5 ) ) -> ( ( c2 -> v6 ) -> ( v2 -> ( ( c2 -> v6 ) -> v2 ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv2 wv1 wn wc8 wv3 wi wi wi wv3 wv7 wv4 wi wi wv1 wn wi wc5 wc6 wc6 wi wi
+      wv8 wc2 wi wv7 wc0 wi wi wi wv2 wn wv0 wv8 wi wi wc2 wv2 wi wc9 wc9 wi wi
+      wi wc9 wv8 wn wi wv6 wv0 wi wv6 wc1 wi wi wi wv4 wv7 wv7 wc0 wi wi wi wv1
+      wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi
+      wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi
+      wv9 wv9 wv5 wi wc4 wc0 wi wi wi wv2 wv1 wn wc8 wv3 wi wi wi wv3 wv7 wv4
+      wi wi wv1 wn wi wc5 wc6 wc6 wi wi wv8 wc2 wi wv7 wc0 wi wi wi wv2 wn wv0
+      wv8 wi wi wc2 wv2 wi wc9 wc9 wi wi wi wc9 wv8 wn wi wv6 wv0 wi wv6 wc1 wi
+      wi wi wv4 wv7 wv7 wc0 wi wi wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi
+      wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi
+      wi wi wi wi wi wi wi wi wi wi wi wi wv3 wv7 wv4 wi wi wv1 wn wi wc5 wc6
+      wc6 wi wi wv8 wc2 wi wv7 wc0 wi wi wi wv2 wn wv0 wv8 wi wi wc2 wv2 wi wc9
+      wc9 wi wi wi wc9 wv8 wn wi wv6 wv0 wi wv6 wc1 wi wi wi wv4 wv7 wv7 wc0 wi
+      wi wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5
+      wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi wi wi
+      wi wi wv2 wv1 wn wc8 wv3 wi wi wi wv3 wv7 wv4 wi wi wv1 wn wi wc5 wc6 wc6
+      wi wi wv8 wc2 wi wv7 wc0 wi wi wi wv2 wn wv0 wv8 wi wi wc2 wv2 wi wc9 wc9
+      wi wi wi wc9 wv8 wn wi wv6 wv0 wi wv6 wc1 wi wi wi wv4 wv7 wv7 wc0 wi wi
+      wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5
+      wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi wi wi
+      wi wi wi wc5 wc6 wc6 wi wi wv8 wc2 wi wv7 wc0 wi wi wi wv2 wn wv0 wv8 wi
+      wi wc2 wv2 wi wc9 wc9 wi wi wi wc9 wv8 wn wi wv6 wv0 wi wv6 wc1 wi wi wi
+      wv4 wv7 wv7 wc0 wi wi wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn
+      wv2 wv5 wc3 wi wv5 wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi
+      wi wi wi wi wi wi wi wv3 wv7 wv4 wi wi wv1 wn wi wc5 wc6 wc6 wi wi wv8
+      wc2 wi wv7 wc0 wi wi wi wv2 wn wv0 wv8 wi wi wc2 wv2 wi wc9 wc9 wi wi wi
+      wc9 wv8 wn wi wv6 wv0 wi wv6 wc1 wi wi wi wv4 wv7 wv7 wc0 wi wi wi wv1
+      wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi
+      wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi wi wi wi wi wv2
+      wn wv0 wv8 wi wi wc2 wv2 wi wc9 wc9 wi wi wi wc9 wv8 wn wi wv6 wv0 wi wv6
+      wc1 wi wi wi wv4 wv7 wv7 wc0 wi wi wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5
+      wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi
+      wv2 wi wi wi wi wi wi wi wi wi wi wc5 wc6 wc6 wi wi wv8 wc2 wi wv7 wc0 wi
+      wi wi wv2 wn wv0 wv8 wi wi wc2 wv2 wi wc9 wc9 wi wi wi wc9 wv8 wn wi wv6
+      wv0 wi wv6 wc1 wi wi wi wv4 wv7 wv7 wc0 wi wi wi wv1 wv9 wv4 wi wi wn wv5
+      wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi wn wc2 wv6 wi wv2
+      wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi wi wi wi wc9 wv8 wn wi wv6 wv0 wi
+      wv6 wc1 wi wi wi wv4 wv7 wv7 wc0 wi wi wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi
+      wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6
+      wi wv2 wi wi wi wi wi wi wi wi wi wv2 wn wv0 wv8 wi wi wc2 wv2 wi wc9 wc9
+      wi wi wi wc9 wv8 wn wi wv6 wv0 wi wv6 wc1 wi wi wi wv4 wv7 wv7 wc0 wi wi
+      wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5
+      wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi wi wi
+      wv4 wv7 wv7 wc0 wi wi wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn
+      wv2 wv5 wc3 wi wv5 wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi
+      wi wi wi wi wc9 wv8 wn wi wv6 wv0 wi wv6 wc1 wi wi wi wv4 wv7 wv7 wc0 wi
+      wi wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5
+      wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi wi wv1
+      wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi
+      wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi wi wi wi wv4 wv7 wv7 wc0 wi
+      wi wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5
+      wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi wv5
+      wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi wn wc2 wv6 wi wv2
+      wc2 wv6 wi wv2 wi wi wi wi wi wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5
+      wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi
+      wi wi wi wi wi wi wv6 wv2 wv5 wc3 wv5 th146 wv5 wc3 wi wv5 wv5 wi wi wn
+      wv2 wv5 wc3 wi wv5 wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi
+      wi wi wv1 wv9 wv4 wi wi wn ax-1 ax-mp wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5
+      wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi
+      wv2 wi wi wi wi wi wi wi wv4 wv7 wv7 wc0 wi wi wi ax-1 ax-mp wv4 wv7 wv7
+      wc0 wi wi wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3
+      wi wv5 wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi
+      wc9 wv8 wn wi wv6 wv0 wi wv6 wc1 wi wi wi ax-1 ax-mp wc9 wv8 wn wi wv6
+      wv0 wi wv6 wc1 wi wi wi wv4 wv7 wv7 wc0 wi wi wi wv1 wv9 wv4 wi wi wn wv5
+      wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi wn wc2 wv6 wi wv2
+      wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi wi wv2 wn wv0 wv8 wi wi wc2 wv2 wi
+      wc9 wc9 wi wi wi ax-1 ax-mp wv2 wn wv0 wv8 wi wi wc2 wv2 wi wc9 wc9 wi wi
+      wi wc9 wv8 wn wi wv6 wv0 wi wv6 wc1 wi wi wi wv4 wv7 wv7 wc0 wi wi wi wv1
+      wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi
+      wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi wi wi wc5 wc6
+      wc6 wi wi wv8 wc2 wi wv7 wc0 wi wi wi ax-1 ax-mp wc5 wc6 wc6 wi wi wv8
+      wc2 wi wv7 wc0 wi wi wi wv2 wn wv0 wv8 wi wi wc2 wv2 wi wc9 wc9 wi wi wi
+      wc9 wv8 wn wi wv6 wv0 wi wv6 wc1 wi wi wi wv4 wv7 wv7 wc0 wi wi wi wv1
+      wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi
+      wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi wi wi wi wv3 wv7
+      wv4 wi wi wv1 wn wi ax-1 ax-mp wv3 wv7 wv4 wi wi wv1 wn wi wc5 wc6 wc6 wi
+      wi wv8 wc2 wi wv7 wc0 wi wi wi wv2 wn wv0 wv8 wi wi wc2 wv2 wi wc9 wc9 wi
+      wi wi wc9 wv8 wn wi wv6 wv0 wi wv6 wc1 wi wi wi wv4 wv7 wv7 wc0 wi wi wi
+      wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5 wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5
+      wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi wv2 wi wi wi wi wi wi wi wi wi wi wi
+      wi wv2 wv1 wn wc8 wv3 wi wi wi ax-1 ax-mp wv2 wv1 wn wc8 wv3 wi wi wi wv3
+      wv7 wv4 wi wi wv1 wn wi wc5 wc6 wc6 wi wi wv8 wc2 wi wv7 wc0 wi wi wi wv2
+      wn wv0 wv8 wi wi wc2 wv2 wi wc9 wc9 wi wi wi wc9 wv8 wn wi wv6 wv0 wi wv6
+      wc1 wi wi wi wv4 wv7 wv7 wc0 wi wi wi wv1 wv9 wv4 wi wi wn wv5 wc3 wi wv5
+      wv5 wi wi wn wv2 wv5 wc3 wi wv5 wv5 wi wi wn wc2 wv6 wi wv2 wc2 wv6 wi
+      wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi wv9 wv9 wv5 wi wc4 wc0 wi wi
+      wi ax-1 ax-mp $.
+  th169 $p |- ( ( v5 -> c8 ) -> ( v4 -> ( v4 -> ( c4 -> ( c4 -> ( v7 -> ( -. ( ( c6 -> v4 ) -> ( c5 -> v1 ) ) -> ( ( v5 -> c6 ) -> ( -. ( v4 -> ( v5 -> c8 ) ) -> ( -. c4 -> ( ( v5 -> c6 ) -> c4 ) ) ) ) ) ) ) ) ) ) ) $=
+      wv4 wv4 wc4 wc4 wv7 wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi
+      wi wn wc4 wn wv5 wc6 wi wc4 wi wi wi wi wi wi wi wi wi wi wv5 wc8 wi wv4
+      wv4 wc4 wc4 wv7 wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi wi
+      wn wc4 wn wv5 wc6 wi wc4 wi wi wi wi wi wi wi wi wi wi wi wv4 wc4 wc4 wv7
+      wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi wi wn wc4 wn wv5
+      wc6 wi wc4 wi wi wi wi wi wi wi wi wi wv4 wv4 wc4 wc4 wv7 wc6 wv4 wi wc5
+      wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi wi wn wc4 wn wv5 wc6 wi wc4 wi wi
+      wi wi wi wi wi wi wi wi wc4 wc4 wv7 wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6
+      wi wv4 wv5 wc8 wi wi wn wc4 wn wv5 wc6 wi wc4 wi wi wi wi wi wi wi wi wv4
+      wc4 wc4 wv7 wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi wi wn
+      wc4 wn wv5 wc6 wi wc4 wi wi wi wi wi wi wi wi wi wc4 wv7 wc6 wv4 wi wc5
+      wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi wi wn wc4 wn wv5 wc6 wi wc4 wi wi
+      wi wi wi wi wi wc4 wc4 wv7 wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5
+      wc8 wi wi wn wc4 wn wv5 wc6 wi wc4 wi wi wi wi wi wi wi wi wv7 wc6 wv4 wi
+      wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi wi wn wc4 wn wv5 wc6 wi wc4 wi
+      wi wi wi wi wi wc4 wv7 wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8
+      wi wi wn wc4 wn wv5 wc6 wi wc4 wi wi wi wi wi wi wi wc6 wv4 wi wc5 wv1 wi
+      wi wn wv5 wc6 wi wv4 wv5 wc8 wi wi wn wc4 wn wv5 wc6 wi wc4 wi wi wi wi
+      wi wv7 wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi wi wn wc4 wn
+      wv5 wc6 wi wc4 wi wi wi wi wi wi wv5 wc6 wi wv4 wv5 wc8 wi wi wn wc4 wn
+      wv5 wc6 wi wc4 wi wi wi wi wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5
+      wc8 wi wi wn wc4 wn wv5 wc6 wi wc4 wi wi wi wi wi wv4 wv5 wc8 wi wi wn
+      wc4 wn wv5 wc6 wi wc4 wi wi wi wv5 wc6 wi wv4 wv5 wc8 wi wi wn wc4 wn wv5
+      wc6 wi wc4 wi wi wi wi wv4 wv5 wc8 wi wv5 wc6 wi wc4 ax-g9 wv4 wv5 wc8 wi
+      wi wn wc4 wn wv5 wc6 wi wc4 wi wi wi wv5 wc6 wi ax-1 ax-mp wv5 wc6 wi wv4
+      wv5 wc8 wi wi wn wc4 wn wv5 wc6 wi wc4 wi wi wi wi wc6 wv4 wi wc5 wv1 wi
+      wi wn ax-1 ax-mp wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi wi
+      wn wc4 wn wv5 wc6 wi wc4 wi wi wi wi wi wv7 ax-1 ax-mp wv7 wc6 wv4 wi wc5
+      wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi wi wn wc4 wn wv5 wc6 wi wc4 wi wi
+      wi wi wi wi wc4 ax-1 ax-mp wc4 wv7 wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi
+      wv4 wv5 wc8 wi wi wn wc4 wn wv5 wc6 wi wc4 wi wi wi wi wi wi wi wc4 ax-1
+      ax-mp wc4 wc4 wv7 wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi
+      wi wn wc4 wn wv5 wc6 wi wc4 wi wi wi wi wi wi wi wi wv4 ax-1 ax-mp wv4
+      wc4 wc4 wv7 wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi wi wn
+      wc4 wn wv5 wc6 wi wc4 wi wi wi wi wi wi wi wi wi wv4 ax-1 ax-mp wv4 wv4
+      wc4 wc4 wv7 wc6 wv4 wi wc5 wv1 wi wi wn wv5 wc6 wi wv4 wv5 wc8 wi wi wn
+      wc4 wn wv5 wc6 wi wc4 wi wi wi wi wi wi wi wi wi wi wv5 wc8 wi ax-1 ax-mp
+      $.
+  ${
+    $d v2 v8 $.
+    th170 $p |- ( -. v5 -> ( -. ( ( v8 -> v8 ) -> ( c2 -> v2 ) ) -> -. v8 ) ) $=
+      wv8 wv8 wi wc2 wv2 wi wi wn wv8 wn wi wv5 wn wv8 wv8 wi wc2 wv2 wi wi wn
+      wv8 wn wi wi wc2 wv2 wi wv8 wn wv8 wv8 wi ax-g1 wv8 wv8 wi wc2 wv2 wi wi
+      wn wv8 wn wi wv5 wn ax-1 ax-mp $.
+  $}
+  th171 $p |- ( ( ( v0 -> -. c8 ) -> ( ( c1 -> c4 ) -> ( c7 -> v2 ) ) ) -> ( v9 -> c3 ) ) $=
+      ( wc3 wi wc8 wn wc1 wc4 wc7 ax-g6 ax-1 ax-mp ) CDEZAFGEHIEJBEEEZNENKNOLM
+      $.
+  th172 $p |- ( c4 -> ( ( ( ( v4 -> v2 ) -> ( v6 -> c1 ) ) -> ( c2 -> -. v6 ) ) -> ( ( v4 -> ( ( c6 -> v7 ) -> ( v3 -> c1 ) ) ) -> ( c4 -> ( -. ( ( v9 -> c2 ) -> ( v9 -> v5 ) ) -> ( ( v4 -> ( ( c6 -> v7 ) -> ( v3 -> c1 ) ) ) -> ( ( v6 -> v1 ) -> ( c4 -> ( v6 -> v1 ) ) ) ) ) ) ) ) ) $=
+      ( wi wc1 wc2 wn wc6 wc4 ax-1 ax-mp ) DBIFJIIKFLIIZDMGICJIIIZNHKIHEIILZRFA
+      IZNTIIZIZIZIZIZIZNUFIUEUFUDUEUCUDUBUCUAUBTNOUAROPUBSOPUCNOPUDROPUEQOPUFNO
+      P $.
+  th173 $p |- ( ( ( -. v7 -> ( v0 -> v0 ) ) -> -. v7 ) -> ( v7 -> ( v6 -> ( ( c5 -> v8 ) -> ( ( ( ( v3 -> v7 ) -> ( v8 -> v7 ) ) -> ( v6 -> ( c9 -> v4 ) ) ) -> ( ( ( ( v3 -> v7 ) -> ( v8 -> v7 ) ) -> ( v6 -> ( c9 -> v4 ) ) ) -> ( ( ( ( v7 -> v7 ) -> c9 ) -> -. v8 ) -> ( ( c3 -> c9 ) -> ( ( c3 -> c9 ) -> ( ( ( ( v3 -> v7 ) -> ( v8 -> v7 ) ) -> ( v6 -> ( c9 -> v4 ) ) ) -> -. ( ( ( c3 -> c9 ) -> ( c5 -> v8 ) ) -> ( ( c5 -> v8 ) -> ( c5 -> v8 ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wv9 wi wn wc5 wc9 wc3 ax-1 th91 ax-mp ) GGGHHZEIAAHHEIHZEDJFHBEHFEHHDKC
+      HHHBEHFEHHDKCHHHEEHKHFIHLKHLKHBEHFEHHDKCHHHLKHJFHHJFHJFHHHIHHHHHHHZHZHZHZ
+      GGMUAPUAHTUASTRSECEKDFFBNRDMOSEMOTQMOUAPMOO $.
+  th174 $p |- ( c2 -> ( c9 -> -. c3 ) ) $=
+      wc9 wc3 wn wi wc2 wc9 wc3 wn wi wi wc3 wn wc9 wc3 wn wi wc3 ax-g5 wc3 wn
+      wc9 ax-1 ax-mp wc9 wc3 wn wi wc2 ax-1 ax-mp $.
+  wth9 $p wff ( ( v5 -> ( v2 -> c7 ) ) -> -. ( ( v1 -> v9 ) -> ( v9 -> v8 ) ) ) $=
+      wv5 wv2 wc7 wi wi wv1 wv9 wi wv9 wv8 wi wi wn wi $.
+  th175 $p |- ( v3 -> ( v0 -> ( -. ( v1 -> v2 ) -> ( -. ( ( c4 -> v0 ) -> v6 ) -> ( ( ( ( v4 -> c9 ) -> v5 ) -> ( ( c9 -> v3 ) -> ( v2 -> v9 ) ) ) -> ( ( v9 -> ( ( c7 -> v9 ) -> ( v6 -> c2 ) ) ) -> ( c2 -> ( c9 -> -. c3 ) ) ) ) ) ) ) ) $=
+      wv0 wv1 wv2 wi wn wc4 wv0 wi wv6 wi wn wv4 wc9 wi wv5 wi wc9 wv3 wi wv2
+      wv9 wi wi wi wv9 wc7 wv9 wi wv6 wc2 wi wi wi wc2 wc9 wc3 wn wi wi wi wi
+      wi wi wi wv3 wv0 wv1 wv2 wi wn wc4 wv0 wi wv6 wi wn wv4 wc9 wi wv5 wi wc9
+      wv3 wi wv2 wv9 wi wi wi wv9 wc7 wv9 wi wv6 wc2 wi wi wi wc2 wc9 wc3 wn wi
+      wi wi wi wi wi wi wi wv1 wv2 wi wn wc4 wv0 wi wv6 wi wn wv4 wc9 wi wv5 wi
+      wc9 wv3 wi wv2 wv9 wi wi wi wv9 wc7 wv9 wi wv6 wc2 wi wi wi wc2 wc9 wc3
+      wn wi wi wi wi wi wi wv0 wv1 wv2 wi wn wc4 wv0 wi wv6 wi wn wv4 wc9 wi
+      wv5 wi wc9 wv3 wi wv2 wv9 wi wi wi wv9 wc7 wv9 wi wv6 wc2 wi wi wi wc2
+      wc9 wc3 wn wi wi wi wi wi wi wi wc4 wv0 wi wv6 wi wn wv4 wc9 wi wv5 wi
+      wc9 wv3 wi wv2 wv9 wi wi wi wv9 wc7 wv9 wi wv6 wc2 wi wi wi wc2 wc9 wc3
+      wn wi wi wi wi wi wv1 wv2 wi wn wc4 wv0 wi wv6 wi wn wv4 wc9 wi wv5 wi
+      wc9 wv3 wi wv2 wv9 wi wi wi wv9 wc7 wv9 wi wv6 wc2 wi wi wi wc2 wc9 wc3
+      wn wi wi wi wi wi wi wv4 wc9 wi wv5 wi wc9 wv3 wi wv2 wv9 wi wi wi wv9
+      wc7 wv9 wi wv6 wc2 wi wi wi wc2 wc9 wc3 wn wi wi wi wi wc4 wv0 wi wv6 wi
+      wn wv4 wc9 wi wv5 wi wc9 wv3 wi wv2 wv9 wi wi wi wv9 wc7 wv9 wi wv6 wc2
+      wi wi wi wc2 wc9 wc3 wn wi wi wi wi wi wv9 wc7 wv9 wi wv6 wc2 wi wi wi
+      wc2 wc9 wc3 wn wi wi wi wv4 wc9 wi wv5 wi wc9 wv3 wi wv2 wv9 wi wi wi wv9
+      wc7 wv9 wi wv6 wc2 wi wi wi wc2 wc9 wc3 wn wi wi wi wi wc2 wc9 wc3 wn wi
+      wi wv9 wc7 wv9 wi wv6 wc2 wi wi wi wc2 wc9 wc3 wn wi wi wi th174 wc2 wc9
+      wc3 wn wi wi wv9 wc7 wv9 wi wv6 wc2 wi wi wi ax-1 ax-mp wv9 wc7 wv9 wi
+      wv6 wc2 wi wi wi wc2 wc9 wc3 wn wi wi wi wv4 wc9 wi wv5 wi wc9 wv3 wi wv2
+      wv9 wi wi wi ax-1 ax-mp wv4 wc9 wi wv5 wi wc9 wv3 wi wv2 wv9 wi wi wi wv9
+      wc7 wv9 wi wv6 wc2 wi wi wi wc2 wc9 wc3 wn wi wi wi wi wc4 wv0 wi wv6 wi
+      wn ax-1 ax-mp wc4 wv0 wi wv6 wi wn wv4 wc9 wi wv5 wi wc9 wv3 wi wv2 wv9
+      wi wi wi wv9 wc7 wv9 wi wv6 wc2 wi wi wi wc2 wc9 wc3 wn wi wi wi wi wi
+      wv1 wv2 wi wn ax-1 ax-mp wv1 wv2 wi wn wc4 wv0 wi wv6 wi wn wv4 wc9 wi
+      wv5 wi wc9 wv3 wi wv2 wv9 wi wi wi wv9 wc7 wv9 wi wv6 wc2 wi wi wi wc2
+      wc9 wc3 wn wi wi wi wi wi wi wv0 ax-1 ax-mp wv0 wv1 wv2 wi wn wc4 wv0 wi
+      wv6 wi wn wv4 wc9 wi wv5 wi wc9 wv3 wi wv2 wv9 wi wi wi wv9 wc7 wv9 wi
+      wv6 wc2 wi wi wi wc2 wc9 wc3 wn wi wi wi wi wi wi wi wv3 ax-1 ax-mp $.
+  th176 $p |- ( v5 -> ( -. c2 -> ( v3 -> ( c7 -> ( ( ( ( v3 -> c5 ) -> -. c6 ) -> ( -. v3 -> ( c1 -> c5 ) ) ) -> ( -. ( ( v3 -> c7 ) -> -. v3 ) -> -. ( ( v3 -> c7 ) -> -. c7 ) ) ) ) ) ) ) $=
+      ( wc2 wn wc7 wc5 wi wc6 wc1 th131 ax-1 ax-mp ) CDZAEAFGHDGADIFGGGAEGADGDA
+      EGEDGDGGZGZGZGZBQGPQOPNOAEAAJNEKLOAKLPMKLQBKL $.
+  th177 $p |- ( ( -. v0 -> -. v7 ) -> ( ( v6 -> ( v2 -> ( c0 -> v6 ) ) ) -> ( -. ( ( v8 -> c7 ) -> ( c4 -> v5 ) ) -> ( ( ( v0 -> v0 ) -> ( v3 -> c1 ) ) -> -. ( ( v0 -> v0 ) -> -. v7 ) ) ) ) ) $=
+      wv6 wv2 wc0 wv6 wi wi wi wv8 wc7 wi wc4 wv5 wi wi wn wv0 wv0 wi wv3 wc1
+      wi wi wv0 wv0 wi wv7 wn wi wn wi wi wi wv0 wn wv7 wn wi wv6 wv2 wc0 wv6
+      wi wi wi wv8 wc7 wi wc4 wv5 wi wi wn wv0 wv0 wi wv3 wc1 wi wi wv0 wv0 wi
+      wv7 wn wi wn wi wi wi wi wv8 wc7 wi wc4 wv5 wi wi wn wv0 wv0 wi wv3 wc1
+      wi wi wv0 wv0 wi wv7 wn wi wn wi wi wv6 wv2 wc0 wv6 wi wi wi wv8 wc7 wi
+      wc4 wv5 wi wi wn wv0 wv0 wi wv3 wc1 wi wi wv0 wv0 wi wv7 wn wi wn wi wi
+      wi wv0 wv0 wi wv3 wc1 wi wi wv0 wv0 wi wv7 wn wi wn wi wv8 wc7 wi wc4 wv5
+      wi wi wn wv0 wv0 wi wv3 wc1 wi wi wv0 wv0 wi wv7 wn wi wn wi wi wv0 wv0
+      wi wv7 wn wv3 wc1 wi wv0 wv0 wi ax-g0 wv0 wv0 wi wv3 wc1 wi wi wv0 wv0 wi
+      wv7 wn wi wn wi wv8 wc7 wi wc4 wv5 wi wi wn ax-1 ax-mp wv8 wc7 wi wc4 wv5
+      wi wi wn wv0 wv0 wi wv3 wc1 wi wi wv0 wv0 wi wv7 wn wi wn wi wi wv6 wv2
+      wc0 wv6 wi wi wi ax-1 ax-mp wv6 wv2 wc0 wv6 wi wi wi wv8 wc7 wi wc4 wv5
+      wi wi wn wv0 wv0 wi wv3 wc1 wi wi wv0 wv0 wi wv7 wn wi wn wi wi wi wv0 wn
+      wv7 wn wi ax-1 ax-mp $.
+  th178 $p |- ( -. -. ( v8 -> c0 ) -> ( -. v4 -> ( ( ( ( v2 -> v4 ) -> ( c7 -> c9 ) ) -> ( v3 -> ( c1 -> v6 ) ) ) -> ( -. v1 -> -. v1 ) ) ) ) $=
+      wv5 wv5 wv5 wi wi wv8 wc0 wi wn wn wv4 wn wv2 wv4 wi wc7 wc9 wi wi wv3
+      wc1 wv6 wi wi wi wv1 wn wv1 wn wi wi wi wi wv5 wv5 ax-1 wv8 wc0 wi wn wn
+      wv4 wn wv2 wv4 wi wc7 wc9 wi wi wv3 wc1 wv6 wi wi wi wv1 wn wv1 wn wi wi
+      wi wi wv5 wv5 wv5 wi wi wv8 wc0 wi wn wn wv4 wn wv2 wv4 wi wc7 wc9 wi wi
+      wv3 wc1 wv6 wi wi wi wv1 wn wv1 wn wi wi wi wi wi wv4 wn wv2 wv4 wi wc7
+      wc9 wi wi wv3 wc1 wv6 wi wi wi wv1 wn wv1 wn wi wi wi wv8 wc0 wi wn wn
+      wv4 wn wv2 wv4 wi wc7 wc9 wi wi wv3 wc1 wv6 wi wi wi wv1 wn wv1 wn wi wi
+      wi wi wv2 wv4 wi wc7 wc9 wi wi wv3 wc1 wv6 wi wi wi wv1 wn wv1 wn wi wi
+      wv4 wn wv2 wv4 wi wc7 wc9 wi wi wv3 wc1 wv6 wi wi wi wv1 wn wv1 wn wi wi
+      wi wv1 wn wv1 wn wi wv2 wv4 wi wc7 wc9 wi wi wv3 wc1 wv6 wi wi wi wv1 wn
+      wv1 wn wi wi wv1 wn wv1 wn wv1 wn wi wv1 wn ax-g4 wv1 wn wv1 wn ax-1
+      ax-mp wv1 wn wv1 wn wi wv2 wv4 wi wc7 wc9 wi wi wv3 wc1 wv6 wi wi wi ax-1
+      ax-mp wv2 wv4 wi wc7 wc9 wi wi wv3 wc1 wv6 wi wi wi wv1 wn wv1 wn wi wi
+      wv4 wn ax-1 ax-mp wv4 wn wv2 wv4 wi wc7 wc9 wi wi wv3 wc1 wv6 wi wi wi
+      wv1 wn wv1 wn wi wi wi wv8 wc0 wi wn wn ax-1 ax-mp wv8 wc0 wi wn wn wv4
+      wn wv2 wv4 wi wc7 wc9 wi wi wv3 wc1 wv6 wi wi wi wv1 wn wv1 wn wi wi wi
+      wi wv5 wv5 wv5 wi wi ax-1 ax-mp ax-mp $.
+  ${
+    $d v4 v7 $.
+    $d v4 v8 $.
+    th179 $p |- ( ( ( ( v7 -> c2 ) -> v3 ) -> -. ( v8 -> v0 ) ) -> ( ( ( ( v7 -> v4 ) -> ( v0 -> v9 ) ) -> ( ( v5 -> v2 ) -> ( c6 -> c1 ) ) ) -> ( -. v1 -> ( -. v1 -> ( ( ( c2 -> -. v0 ) -> -. ( v0 -> v6 ) ) -> ( ( v5 -> -. -. c7 ) -> ( v1 -> ( -. v4 -> ( -. ( v9 -> ( v8 -> v7 ) ) -> -. ( v9 -> -. v4 ) ) ) ) ) ) ) ) ) ) $=
+      wv7 wv4 wi wv0 wv9 wi wi wv5 wv2 wi wc6 wc1 wi wi wi wv1 wn wv1 wn wc2
+      wv0 wn wi wv0 wv6 wi wn wi wv5 wc7 wn wn wi wv1 wv4 wn wv9 wv8 wv7 wi wi
+      wn wv9 wv4 wn wi wn wi wi wi wi wi wi wi wi wv7 wc2 wi wv3 wi wv8 wv0 wi
+      wn wi wv7 wv4 wi wv0 wv9 wi wi wv5 wv2 wi wc6 wc1 wi wi wi wv1 wn wv1 wn
+      wc2 wv0 wn wi wv0 wv6 wi wn wi wv5 wc7 wn wn wi wv1 wv4 wn wv9 wv8 wv7 wi
+      wi wn wv9 wv4 wn wi wn wi wi wi wi wi wi wi wi wi wv1 wn wv1 wn wc2 wv0
+      wn wi wv0 wv6 wi wn wi wv5 wc7 wn wn wi wv1 wv4 wn wv9 wv8 wv7 wi wi wn
+      wv9 wv4 wn wi wn wi wi wi wi wi wi wi wv7 wv4 wi wv0 wv9 wi wi wv5 wv2 wi
+      wc6 wc1 wi wi wi wv1 wn wv1 wn wc2 wv0 wn wi wv0 wv6 wi wn wi wv5 wc7 wn
+      wn wi wv1 wv4 wn wv9 wv8 wv7 wi wi wn wv9 wv4 wn wi wn wi wi wi wi wi wi
+      wi wi wv1 wn wc2 wv0 wn wi wv0 wv6 wi wn wi wv5 wc7 wn wn wi wv1 wv4 wn
+      wv9 wv8 wv7 wi wi wn wv9 wv4 wn wi wn wi wi wi wi wi wi wv1 wn wv1 wn wc2
+      wv0 wn wi wv0 wv6 wi wn wi wv5 wc7 wn wn wi wv1 wv4 wn wv9 wv8 wv7 wi wi
+      wn wv9 wv4 wn wi wn wi wi wi wi wi wi wi wc2 wv0 wn wi wv0 wv6 wi wn wi
+      wv5 wc7 wn wn wi wv1 wv4 wn wv9 wv8 wv7 wi wi wn wv9 wv4 wn wi wn wi wi
+      wi wi wi wv1 wn wc2 wv0 wn wi wv0 wv6 wi wn wi wv5 wc7 wn wn wi wv1 wv4
+      wn wv9 wv8 wv7 wi wi wn wv9 wv4 wn wi wn wi wi wi wi wi wi wv5 wc7 wn wn
+      wi wv1 wv4 wn wv9 wv8 wv7 wi wi wn wv9 wv4 wn wi wn wi wi wi wi wc2 wv0
+      wn wi wv0 wv6 wi wn wi wv5 wc7 wn wn wi wv1 wv4 wn wv9 wv8 wv7 wi wi wn
+      wv9 wv4 wn wi wn wi wi wi wi wi wv1 wv4 wn wv9 wv8 wv7 wi wi wn wv9 wv4
+      wn wi wn wi wi wi wv5 wc7 wn wn wi wv1 wv4 wn wv9 wv8 wv7 wi wi wn wv9
+      wv4 wn wi wn wi wi wi wi wv4 wn wv9 wv8 wv7 wi wi wn wv9 wv4 wn wi wn wi
+      wi wv1 wv4 wn wv9 wv8 wv7 wi wi wn wv9 wv4 wn wi wn wi wi wi wv9 wv8 wv7
+      wi wi wn wv9 wv4 wn wi wn wi wv4 wn wv9 wv8 wv7 wi wi wn wv9 wv4 wn wi wn
+      wi wi wv4 wn wv9 wv9 wv8 wv7 wi ax-g3 wv9 wv8 wv7 wi wi wn wv9 wv4 wn wi
+      wn wi wv4 wn ax-1 ax-mp wv4 wn wv9 wv8 wv7 wi wi wn wv9 wv4 wn wi wn wi
+      wi wv1 ax-1 ax-mp wv1 wv4 wn wv9 wv8 wv7 wi wi wn wv9 wv4 wn wi wn wi wi
+      wi wv5 wc7 wn wn wi ax-1 ax-mp wv5 wc7 wn wn wi wv1 wv4 wn wv9 wv8 wv7 wi
+      wi wn wv9 wv4 wn wi wn wi wi wi wi wc2 wv0 wn wi wv0 wv6 wi wn wi ax-1
+      ax-mp wc2 wv0 wn wi wv0 wv6 wi wn wi wv5 wc7 wn wn wi wv1 wv4 wn wv9 wv8
+      wv7 wi wi wn wv9 wv4 wn wi wn wi wi wi wi wi wv1 wn ax-1 ax-mp wv1 wn wc2
+      wv0 wn wi wv0 wv6 wi wn wi wv5 wc7 wn wn wi wv1 wv4 wn wv9 wv8 wv7 wi wi
+      wn wv9 wv4 wn wi wn wi wi wi wi wi wi wv1 wn ax-1 ax-mp wv1 wn wv1 wn wc2
+      wv0 wn wi wv0 wv6 wi wn wi wv5 wc7 wn wn wi wv1 wv4 wn wv9 wv8 wv7 wi wi
+      wn wv9 wv4 wn wi wn wi wi wi wi wi wi wi wv7 wv4 wi wv0 wv9 wi wi wv5 wv2
+      wi wc6 wc1 wi wi wi ax-1 ax-mp wv7 wv4 wi wv0 wv9 wi wi wv5 wv2 wi wc6
+      wc1 wi wi wi wv1 wn wv1 wn wc2 wv0 wn wi wv0 wv6 wi wn wi wv5 wc7 wn wn
+      wi wv1 wv4 wn wv9 wv8 wv7 wi wi wn wv9 wv4 wn wi wn wi wi wi wi wi wi wi
+      wi wv7 wc2 wi wv3 wi wv8 wv0 wi wn wi ax-1 ax-mp $.
+  $}
+  th180 $p |- ( v4 -> ( -. ( ( v5 -> v1 ) -> c3 ) -> ( -. ( ( v8 -> v3 ) -> ( v5 -> v8 ) ) -> ( ( v7 -> v4 ) -> ( v4 -> ( v7 -> v4 ) ) ) ) ) ) $=
+      ( wi wc3 wn ax-g2 ax-1 ax-mp ) DAGHGIZFBGDFGGIZECGZCOGZGZGZGZCSGRSQRPQOPO
+      JOCKLPOKLQNKLRMKLSCKL $.
+  th181 $p |- ( v7 -> ( ( ( ( c8 -> v4 ) -> v3 ) -> ( ( v2 -> v7 ) -> ( v5 -> v3 ) ) ) -> ( ( ( v3 -> ( v9 -> c8 ) ) -> -. -. v0 ) -> ( ( ( ( v8 -> v0 ) -> v2 ) -> c8 ) -> ( ( ( v5 -> ( v2 -> v0 ) ) -> -. ( v3 -> v6 ) ) -> ( v7 -> ( -. ( v4 -> v7 ) -> ( -. ( v5 -> c6 ) -> ( v7 -> ( v5 -> c6 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc8 wi wn wc6 ax-g9 ax-1 ax-mp ) JDKCKBGKECKKKZCIJKKALLKZHAKBKJKZEBAKKC
+      FKLKZGDGKLEMKZLGUAKKKZKZKZKZKZKZGUGKUFUGUEUFUDUEUCUDUBUCDGGUANUBGOPUCTOPU
+      DSOPUEROPUFQOPUGGOP $.
+  wth10 $p wff ( ( ( -. v0 -> v2 ) -> v8 ) -> -. ( -. v6 -> -. v4 ) ) $=
+      ( wn wi ) AFBGEGDFCFGFG $.
+  th182 $p |- ( v6 -> ( v7 -> ( v6 -> ( ( -. ( v7 -> v7 ) -> ( v3 -> ( c4 -> c2 ) ) ) -> ( ( -. ( v7 -> v7 ) -> ( v3 -> ( c4 -> c2 ) ) ) -> ( ( ( -. v0 -> -. c0 ) -> ( ( v0 -> v9 ) -> ( c4 -> c8 ) ) ) -> ( ( ( v9 -> v9 ) -> ( ( v0 -> v9 ) -> v0 ) ) -> ( ( v0 -> v0 ) -> ( ( ( -. v0 -> c9 ) -> ( v0 -> ( v9 -> v0 ) ) ) -> -. ( v0 -> v0 ) ) ) ) ) ) ) ) ) ) $=
+      ( wi wn wc4 wc2 wc0 wc8 wc9 th32 ax-1 ax-mp ) DCDDFGBHIFFFZPAGJGFAEFHKFFF
+      EEFAEFAFFAAFAGLFAEAFFFAAFGFFFFZFZFZFZFZCUAFTUASTRSQRAEAAEAEMQPNORPNOSCNOT
+      DNOUACNO $.
+  ${
+    $d v0 v1 $.
+    th183 $p |- ( -. -. ( v4 -> c3 ) -> ( ( ( ( v4 -> v4 ) -> -. v7 ) -> v7 ) -> ( -. ( v7 -> c5 ) -> ( ( v8 -> ( ( c6 -> c7 ) -> ( v9 -> c1 ) ) ) -> ( -. ( v7 -> c5 ) -> ( -. -. ( v4 -> c3 ) -> ( -. ( ( v0 -> c4 ) -> -. v1 ) -> -. ( -. v1 -> ( v0 -> c4 ) ) ) ) ) ) ) ) ) $=
+      ( wi wn wc5 wc6 wc7 wc1 wc3 wc4 ax-g3 ax-1 ax-mp ) CCGDHGDGZDIGHZEJKGFLGG
+      GZSCMGHHZANGZBHZGHUCUBGHGZGZGZGZGZGZUAUIGUHUIUGUHUFUGUEUFUDUEUBUCUBUCOUDU
+      APQUESPQUFTPQUGSPQUHRPQUIUAPQ $.
+  $}
+  wth11 $p wff ( ( ( -. c8 -> c3 ) -> ( v6 -> ( v4 -> v6 ) ) ) -> -. ( -. v1 -> ( c8 -> c5 ) ) ) $=
+      ( wc8 wn wc3 wi wc5 ) DEFGCBCGGGAEDHGGEG $.
+  th184 $p |- ( -. v3 -> ( v9 -> ( ( ( v8 -> c3 ) -> ( ( c9 -> c1 ) -> ( c6 -> v1 ) ) ) -> ( c1 -> ( -. ( ( c7 -> c5 ) -> ( c1 -> c9 ) ) -> ( c1 -> ( ( c2 -> ( ( c5 -> c5 ) -> ( c5 -> c9 ) ) ) -> ( ( ( -. c3 -> ( c1 -> c2 ) ) -> ( ( c5 -> c4 ) -> ( c2 -> v4 ) ) ) -> ( ( ( c2 -> c0 ) -> c0 ) -> -. ( ( c2 -> c0 ) -> ( c2 -> c0 ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc3 wi wc9 wc1 wc6 wc7 wc5 wn wc2 wc4 wc0 th119 ax-1 ax-mp ) EDFGHIGJAG
+      GGZIKLGIHGGMZINLLGLHGGGFMINGGLOGNCGGGNPGPGNPGNPGGMGGGZGZGZGZGZGZBMZUGGUFU
+      GUEUFUDUEUCUDUBUCLINLNCQUBIRSUCUARSUDIRSUETRSUFERSUGUHRS $.
+  th185 $p |- ( v8 -> ( v2 -> ( ( ( -. v1 -> c2 ) -> ( ( c9 -> c3 ) -> -. v0 ) ) -> ( -. v8 -> -. ( v8 -> v8 ) ) ) ) ) $=
+      wv6 wv6 wv6 wi wi wv8 wv2 wv1 wn wc2 wi wc9 wc3 wi wv0 wn wi wi wv8 wn
+      wv8 wv8 wi wn wi wi wi wi wv6 wv6 ax-1 wv8 wv2 wv1 wn wc2 wi wc9 wc3 wi
+      wv0 wn wi wi wv8 wn wv8 wv8 wi wn wi wi wi wi wv6 wv6 wv6 wi wi wv8 wv2
+      wv1 wn wc2 wi wc9 wc3 wi wv0 wn wi wi wv8 wn wv8 wv8 wi wn wi wi wi wi wi
+      wv2 wv1 wn wc2 wi wc9 wc3 wi wv0 wn wi wi wv8 wn wv8 wv8 wi wn wi wi wi
+      wv8 wv2 wv1 wn wc2 wi wc9 wc3 wi wv0 wn wi wi wv8 wn wv8 wv8 wi wn wi wi
+      wi wi wv1 wn wc2 wi wc9 wc3 wi wv0 wn wi wi wv8 wn wv8 wv8 wi wn wi wi
+      wv2 wv1 wn wc2 wi wc9 wc3 wi wv0 wn wi wi wv8 wn wv8 wv8 wi wn wi wi wi
+      wv8 wn wv8 wv8 wi wn wi wv1 wn wc2 wi wc9 wc3 wi wv0 wn wi wi wv8 wn wv8
+      wv8 wi wn wi wi wv8 wv8 ax-g7 wv8 wn wv8 wv8 wi wn wi wv1 wn wc2 wi wc9
+      wc3 wi wv0 wn wi wi ax-1 ax-mp wv1 wn wc2 wi wc9 wc3 wi wv0 wn wi wi wv8
+      wn wv8 wv8 wi wn wi wi wv2 ax-1 ax-mp wv2 wv1 wn wc2 wi wc9 wc3 wi wv0 wn
+      wi wi wv8 wn wv8 wv8 wi wn wi wi wi wv8 ax-1 ax-mp wv8 wv2 wv1 wn wc2 wi
+      wc9 wc3 wi wv0 wn wi wi wv8 wn wv8 wv8 wi wn wi wi wi wi wv6 wv6 wv6 wi
+      wi ax-1 ax-mp ax-mp $.
+  th186 $p |- ( -. v3 -> ( ( v0 -> ( v6 -> ( v9 -> v3 ) ) ) -> ( ( v0 -> ( v6 -> ( v9 -> v3 ) ) ) -> ( ( ( c8 -> ( c2 -> v0 ) ) -> ( ( v5 -> v6 ) -> ( v5 -> v9 ) ) ) -> ( ( c5 -> -. -. c1 ) -> -. v3 ) ) ) ) ) $=
+      wv0 wv6 wv9 wv3 wi wi wi wv0 wv6 wv9 wv3 wi wi wi wc8 wc2 wv0 wi wi wv5
+      wv6 wi wv5 wv9 wi wi wi wc5 wc1 wn wn wi wv3 wn wi wi wi wi wv3 wn wv0
+      wv6 wv9 wv3 wi wi wi wv0 wv6 wv9 wv3 wi wi wi wc8 wc2 wv0 wi wi wv5 wv6
+      wi wv5 wv9 wi wi wi wc5 wc1 wn wn wi wv3 wn wi wi wi wi wi wv0 wv6 wv9
+      wv3 wi wi wi wc8 wc2 wv0 wi wi wv5 wv6 wi wv5 wv9 wi wi wi wc5 wc1 wn wn
+      wi wv3 wn wi wi wi wv0 wv6 wv9 wv3 wi wi wi wv0 wv6 wv9 wv3 wi wi wi wc8
+      wc2 wv0 wi wi wv5 wv6 wi wv5 wv9 wi wi wi wc5 wc1 wn wn wi wv3 wn wi wi
+      wi wi wc8 wc2 wv0 wi wi wv5 wv6 wi wv5 wv9 wi wi wi wc5 wc1 wn wn wi wv3
+      wn wi wi wv0 wv6 wv9 wv3 wi wi wi wc8 wc2 wv0 wi wi wv5 wv6 wi wv5 wv9 wi
+      wi wi wc5 wc1 wn wn wi wv3 wn wi wi wi wc5 wc1 wn wn wi wv3 wn wi wc8 wc2
+      wv0 wi wi wv5 wv6 wi wv5 wv9 wi wi wi wc5 wc1 wn wn wi wv3 wn wi wi wv3
+      wn wc5 wc1 wn wn wi wv3 wn wi wv3 wn ax-g2 wv3 wn wc5 wc1 wn wn wi ax-1
+      ax-mp wc5 wc1 wn wn wi wv3 wn wi wc8 wc2 wv0 wi wi wv5 wv6 wi wv5 wv9 wi
+      wi wi ax-1 ax-mp wc8 wc2 wv0 wi wi wv5 wv6 wi wv5 wv9 wi wi wi wc5 wc1 wn
+      wn wi wv3 wn wi wi wv0 wv6 wv9 wv3 wi wi wi ax-1 ax-mp wv0 wv6 wv9 wv3 wi
+      wi wi wc8 wc2 wv0 wi wi wv5 wv6 wi wv5 wv9 wi wi wi wc5 wc1 wn wn wi wv3
+      wn wi wi wi wv0 wv6 wv9 wv3 wi wi wi ax-1 ax-mp wv0 wv6 wv9 wv3 wi wi wi
+      wv0 wv6 wv9 wv3 wi wi wi wc8 wc2 wv0 wi wi wv5 wv6 wi wv5 wv9 wi wi wi
+      wc5 wc1 wn wn wi wv3 wn wi wi wi wi wv3 wn ax-1 ax-mp $.
+  th187 $p |- ( c0 -> ( ( ( ( v2 -> c3 ) -> ( v2 -> c9 ) ) -> ( -. c7 -> ( c7 -> v9 ) ) ) -> ( ( c9 -> v9 ) -> ( ( ( v5 -> c5 ) -> ( c9 -> v9 ) ) -> -. ( -. v9 -> ( c6 -> v5 ) ) ) ) ) ) $=
+      ( wv4 wi wc0 wc3 wc9 wc7 wn wc5 wc6 ax-1 th15 ax-mp ) DDDEEZFAGEAHEEIJICE
+      EEZHCEBKEHCEECJLBEEJEEZEZEZDDMTPTESTRSBCCNRQMOSFMOTPMOO $.
+  th188 $p |- ( ( ( -. v1 -> ( v1 -> v1 ) ) -> ( ( v5 -> v7 ) -> -. c7 ) ) -> ( ( -. v1 -> -. v3 ) -> ( v3 -> v1 ) ) ) $=
+      ( wn wi wc7 ax-3 ax-1 ax-mp ) AEBEFBAFFZAEAAFFCDFGEFFZKFABHKLIJ $.
+  ${
+    $d v5 v7 $.
+    th189 $p |- ( ( c0 -> -. c3 ) -> ( ( c0 -> -. c3 ) -> ( ( ( -. v5 -> ( v9 -> v4 ) ) -> ( ( c1 -> c0 ) -> ( v5 -> v0 ) ) ) -> ( v2 -> ( ( v1 -> ( -. c4 -> ( v6 -> v8 ) ) ) -> ( c1 -> ( c1 -> ( -. ( v5 -> v7 ) -> -. ( v0 -> v5 ) ) ) ) ) ) ) ) ) $=
+      ( wc0 wc3 wn wi wc1 wc4 ax-g3 ax-1 ax-mp ) JKLMZELIDMMNJMEAMMMZCBOLFHMMMZ
+      NNEGMLAEMLMZMZMZMZMZMZMZSUHMUGUHUFUGUEUFUDUEUCUDUBUCEAEGPUBNQRUCNQRUDUAQR
+      UECQRUFTQRUGSQRUHSQR $.
+  $}
+  th190 $p |- ( ( -. c7 -> v9 ) -> ( c6 -> ( ( -. v2 -> v7 ) -> ( -. c5 -> ( -. ( c4 -> -. v1 ) -> -. ( c4 -> c4 ) ) ) ) ) ) $=
+      ( wc6 wn wi wc5 wc4 wc7 ax-g3 ax-1 ax-mp ) EBFCGZHFZIAFZGFIIGFGZGZGZGZJFD
+      GZTGSTRSQRIIIPKQOLMRNLMSELMTUALM $.
+  th191 $p |- ( ( ( ( c1 -> v7 ) -> c8 ) -> ( ( c4 -> v0 ) -> ( v0 -> c4 ) ) ) -> ( ( ( ( c1 -> v7 ) -> c8 ) -> ( ( c4 -> v0 ) -> ( v0 -> c4 ) ) ) -> ( v2 -> ( ( ( ( c1 -> v7 ) -> c8 ) -> ( ( c4 -> v0 ) -> ( v0 -> c4 ) ) ) -> ( ( ( ( c1 -> v7 ) -> c8 ) -> ( ( c4 -> v0 ) -> ( v0 -> c4 ) ) ) -> ( -. v7 -> ( v8 -> ( v8 -> ( -. ( v2 -> v9 ) -> -. ( -. v5 -> -. v5 ) ) ) ) ) ) ) ) ) ) $=
+      wv1 wv1 wv1 wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wc1 wv7
+      wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv2 wc1 wv7 wi wc8 wi wc4 wv0 wi
+      wv0 wc4 wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8
+      wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi wi wi wi wi wi wi wv1 wv1
+      ax-1 wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wc1 wv7 wi wc8 wi wc4
+      wv0 wi wv0 wc4 wi wi wi wv2 wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi
+      wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8 wv8 wv2 wv9 wi
+      wn wv5 wn wv5 wn wi wn wi wi wi wi wi wi wi wi wi wv1 wv1 wv1 wi wi wc1
+      wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi
+      wv0 wc4 wi wi wi wv2 wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wc1
+      wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8 wv8 wv2 wv9 wi wn
+      wv5 wn wv5 wn wi wn wi wi wi wi wi wi wi wi wi wi wc1 wv7 wi wc8 wi wc4
+      wv0 wi wv0 wc4 wi wi wi wv2 wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi
+      wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8 wv8 wv2 wv9 wi
+      wn wv5 wn wv5 wn wi wn wi wi wi wi wi wi wi wi wc1 wv7 wi wc8 wi wc4 wv0
+      wi wv0 wc4 wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv2 wc1
+      wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi
+      wv0 wc4 wi wi wi wv7 wn wv8 wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi
+      wi wi wi wi wi wi wi wv2 wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi
+      wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8 wv8 wv2 wv9 wi
+      wn wv5 wn wv5 wn wi wn wi wi wi wi wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi
+      wv0 wc4 wi wi wi wv2 wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wc1
+      wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8 wv8 wv2 wv9 wi wn
+      wv5 wn wv5 wn wi wn wi wi wi wi wi wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi
+      wv0 wc4 wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8
+      wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi wi wi wi wv2 wc1 wv7 wi
+      wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4
+      wi wi wi wv7 wn wv8 wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi wi wi
+      wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8 wv8 wv2
+      wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi
+      wv0 wc4 wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8
+      wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi wi wi wi wv7 wn wv8 wv8
+      wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi wi wc1 wv7 wi wc8 wi wc4 wv0
+      wi wv0 wc4 wi wi wi wv7 wn wv8 wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi
+      wi wi wi wi wv8 wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi wv7 wn wv8
+      wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi wi wv8 wv2 wv9 wi wn wv5
+      wn wv5 wn wi wn wi wi wv8 wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi
+      wv2 wv5 wv9 wv8 th53 wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi wv8 ax-1
+      ax-mp wv8 wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi wv7 wn ax-1
+      ax-mp wv7 wn wv8 wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi wi wc1
+      wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi ax-1 ax-mp wc1 wv7 wi wc8 wi
+      wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8 wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi
+      wn wi wi wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi ax-1
+      ax-mp wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wc1 wv7 wi wc8 wi wc4
+      wv0 wi wv0 wc4 wi wi wi wv7 wn wv8 wv8 wv2 wv9 wi wn wv5 wn wv5 wn wi wn
+      wi wi wi wi wi wi wv2 ax-1 ax-mp wv2 wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4
+      wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8 wv8 wv2
+      wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi wi wi wi wi wc1 wv7 wi wc8 wi wc4
+      wv0 wi wv0 wc4 wi wi wi ax-1 ax-mp wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4
+      wi wi wi wv2 wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wc1 wv7 wi wc8
+      wi wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8 wv8 wv2 wv9 wi wn wv5 wn wv5 wn
+      wi wn wi wi wi wi wi wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi
+      wi ax-1 ax-mp wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wc1 wv7 wi
+      wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv2 wc1 wv7 wi wc8 wi wc4 wv0 wi wv0
+      wc4 wi wi wi wc1 wv7 wi wc8 wi wc4 wv0 wi wv0 wc4 wi wi wi wv7 wn wv8 wv8
+      wv2 wv9 wi wn wv5 wn wv5 wn wi wn wi wi wi wi wi wi wi wi wi wv1 wv1 wv1
+      wi wi ax-1 ax-mp ax-mp $.
+  th192 $p |- ( v0 -> ( ( ( ( v3 -> c7 ) -> ( v7 -> v9 ) ) -> ( ( c3 -> v3 ) -> c1 ) ) -> ( ( ( ( v3 -> c7 ) -> ( v7 -> v9 ) ) -> ( ( c3 -> v3 ) -> c1 ) ) -> ( ( -. -. v9 -> -. ( c7 -> v1 ) ) -> ( ( c7 -> v1 ) -> -. v9 ) ) ) ) ) $=
+      wv3 wc7 wi wv7 wv9 wi wi wc3 wv3 wi wc1 wi wi wv3 wc7 wi wv7 wv9 wi wi
+      wc3 wv3 wi wc1 wi wi wv9 wn wn wc7 wv1 wi wn wi wc7 wv1 wi wv9 wn wi wi
+      wi wi wv0 wv3 wc7 wi wv7 wv9 wi wi wc3 wv3 wi wc1 wi wi wv3 wc7 wi wv7
+      wv9 wi wi wc3 wv3 wi wc1 wi wi wv9 wn wn wc7 wv1 wi wn wi wc7 wv1 wi wv9
+      wn wi wi wi wi wi wv3 wc7 wi wv7 wv9 wi wi wc3 wv3 wi wc1 wi wi wv9 wn wn
+      wc7 wv1 wi wn wi wc7 wv1 wi wv9 wn wi wi wi wv3 wc7 wi wv7 wv9 wi wi wc3
+      wv3 wi wc1 wi wi wv3 wc7 wi wv7 wv9 wi wi wc3 wv3 wi wc1 wi wi wv9 wn wn
+      wc7 wv1 wi wn wi wc7 wv1 wi wv9 wn wi wi wi wi wv9 wn wn wc7 wv1 wi wn wi
+      wc7 wv1 wi wv9 wn wi wi wv3 wc7 wi wv7 wv9 wi wi wc3 wv3 wi wc1 wi wi wv9
+      wn wn wc7 wv1 wi wn wi wc7 wv1 wi wv9 wn wi wi wi wv9 wn wc7 wv1 wi ax-3
+      wv9 wn wn wc7 wv1 wi wn wi wc7 wv1 wi wv9 wn wi wi wv3 wc7 wi wv7 wv9 wi
+      wi wc3 wv3 wi wc1 wi wi ax-1 ax-mp wv3 wc7 wi wv7 wv9 wi wi wc3 wv3 wi
+      wc1 wi wi wv9 wn wn wc7 wv1 wi wn wi wc7 wv1 wi wv9 wn wi wi wi wv3 wc7
+      wi wv7 wv9 wi wi wc3 wv3 wi wc1 wi wi ax-1 ax-mp wv3 wc7 wi wv7 wv9 wi wi
+      wc3 wv3 wi wc1 wi wi wv3 wc7 wi wv7 wv9 wi wi wc3 wv3 wi wc1 wi wi wv9 wn
+      wn wc7 wv1 wi wn wi wc7 wv1 wi wv9 wn wi wi wi wi wv0 ax-1 ax-mp $.
+  ${
+    $d v4 v5 $.
+    $d v4 v8 $.
+    th193 $p |- ( v2 -> ( -. ( -. v9 -> ( v9 -> c2 ) ) -> ( ( ( ( v8 -> v9 ) -> c1 ) -> v3 ) -> ( v6 -> ( v3 -> ( v4 -> ( -. ( v4 -> ( v5 -> v8 ) ) -> ( c3 -> c2 ) ) ) ) ) ) ) ) $=
+      ( wn wc2 wi wc1 wc3 ax-g1 ax-1 ax-mp ) GHGIJJHZFGJKJBJZEBCCDFJZJHLIJZJZJZ
+      JZJZJZJZAUEJUDUEUCUDUBUCUAUBTUARSCMTCNOUABNOUBENOUCQNOUDPNOUEANO $.
+  $}
+  th194 $p |- ( -. c6 -> ( v1 -> ( ( ( -. v2 -> ( c2 -> v3 ) ) -> ( ( c4 -> v4 ) -> ( v4 -> c2 ) ) ) -> ( ( ( -. v2 -> ( c2 -> v3 ) ) -> ( ( c4 -> v4 ) -> ( v4 -> c2 ) ) ) -> ( v7 -> ( v3 -> ( -. c6 -> ( v7 -> ( -. ( -. c6 -> ( c0 -> v8 ) ) -> ( -. v7 -> ( ( c5 -> c1 ) -> v7 ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wn wc2 wi wc4 wc6 wc0 wc5 wc1 ax-g9 ax-1 ax-mp ) ABGHCIIJDIDHIIIZRECKGZ
+      ESLFIZIGEGMNIZEIIIZIZIZIZIZIZIZIZSUIIUHUIUGUHUFUGUEUFUDUEUCUDUBUCSTUAEOUB
+      EPQUCSPQUDCPQUEEPQUFRPQUGRPQUHAPQUISPQ $.
+  th195 $p |- ( -. c5 -> ( ( ( ( c7 -> c3 ) -> -. c3 ) -> ( c5 -> v3 ) ) -> ( ( -. ( v8 -> c4 ) -> ( c9 -> v0 ) ) -> ( ( -. -. v2 -> ( ( c9 -> c5 ) -> ( c8 -> v4 ) ) ) -> ( ( ( v7 -> ( c6 -> v9 ) ) -> ( -. c1 -> ( v5 -> v4 ) ) ) -> ( ( v8 -> v8 ) -> ( v0 -> ( v1 -> ( ( v8 -> v8 ) -> ( ( v8 -> v8 ) -> ( v8 -> v8 ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc7 wc3 wi wn wc5 wc4 wc9 wc8 wc6 wc1 ax-1 ax-mp ) JKLKMLNDLLZHOLMPALLZ
+      CMMPNLQELLLZGRILLSMFELLLZHHLZABUFUFUFLLZLZLZLZLZLZLZLZNMZUNLUMUNULUMUKULU
+      JUKUIUJUHUIUGUHUFUFTUGBTUAUHATUAUIUFTUAUJUETUAUKUDTUAULUCTUAUMUBTUAUNUOTU
+      A $.
+  ${
+    $d v4 v5 $.
+    th196 $p |- ( ( v0 -> c9 ) -> ( ( -. -. v9 -> v9 ) -> ( -. ( ( c7 -> v4 ) -> ( v5 -> c3 ) ) -> -. c4 ) ) ) $=
+      wv9 wn wn wv9 wi wc7 wv4 wi wv5 wc3 wi wi wn wc4 wn wi wi wv0 wc9 wi wv9
+      wn wn wv9 wi wc7 wv4 wi wv5 wc3 wi wi wn wc4 wn wi wi wi wc7 wv4 wi wv5
+      wc3 wi wi wn wc4 wn wi wv9 wn wn wv9 wi wc7 wv4 wi wv5 wc3 wi wi wn wc4
+      wn wi wi wv5 wc3 wi wc4 wn wc7 wv4 wi ax-g1 wc7 wv4 wi wv5 wc3 wi wi wn
+      wc4 wn wi wv9 wn wn wv9 wi ax-1 ax-mp wv9 wn wn wv9 wi wc7 wv4 wi wv5 wc3
+      wi wi wn wc4 wn wi wi wv0 wc9 wi ax-1 ax-mp $.
+  $}
+  th197 $p |- ( ( ( v8 -> v2 ) -> v1 ) -> ( ( v8 -> v8 ) -> ( -. ( ( v1 -> c1 ) -> -. v0 ) -> ( -. ( v8 -> v8 ) -> ( -. v0 -> ( v8 -> v8 ) ) ) ) ) ) $=
+      wv8 wv8 wi wv1 wc1 wi wv0 wn wi wn wv8 wv8 wi wn wv0 wn wv8 wv8 wi wi wi
+      wi wi wv8 wv2 wi wv1 wi wv8 wv8 wi wv1 wc1 wi wv0 wn wi wn wv8 wv8 wi wn
+      wv0 wn wv8 wv8 wi wi wi wi wi wi wv1 wc1 wi wv0 wn wi wn wv8 wv8 wi wn
+      wv0 wn wv8 wv8 wi wi wi wi wv8 wv8 wi wv1 wc1 wi wv0 wn wi wn wv8 wv8 wi
+      wn wv0 wn wv8 wv8 wi wi wi wi wi wv1 wc1 wi wv0 wn wv0 wn wv8 wv8 wi
+      ax-g9 wv1 wc1 wi wv0 wn wi wn wv8 wv8 wi wn wv0 wn wv8 wv8 wi wi wi wi
+      wv8 wv8 wi ax-1 ax-mp wv8 wv8 wi wv1 wc1 wi wv0 wn wi wn wv8 wv8 wi wn
+      wv0 wn wv8 wv8 wi wi wi wi wi wv8 wv2 wi wv1 wi ax-1 ax-mp $.
+  th198 $p |- ( v5 -> ( ( v5 -> ( ( c8 -> v2 ) -> ( v2 -> v9 ) ) ) -> ( ( ( ( c7 -> v7 ) -> ( v3 -> v9 ) ) -> c3 ) -> ( ( ( ( v8 -> v6 ) -> v0 ) -> ( -. v5 -> -. c9 ) ) -> ( ( ( c5 -> ( v2 -> c2 ) ) -> -. ( c6 -> v3 ) ) -> ( c7 -> ( v5 -> ( -. v5 -> -. ( v5 -> v5 ) ) ) ) ) ) ) ) ) $=
+      wv1 wv1 wv1 wi wi wv5 wv5 wc8 wv2 wi wv2 wv9 wi wi wi wc7 wv7 wi wv3 wv9
+      wi wi wc3 wi wv8 wv6 wi wv0 wi wv5 wn wc9 wn wi wi wc5 wv2 wc2 wi wi wc6
+      wv3 wi wn wi wc7 wv5 wv5 wn wv5 wv5 wi wn wi wi wi wi wi wi wi wi wv1 wv1
+      ax-1 wv5 wv5 wc8 wv2 wi wv2 wv9 wi wi wi wc7 wv7 wi wv3 wv9 wi wi wc3 wi
+      wv8 wv6 wi wv0 wi wv5 wn wc9 wn wi wi wc5 wv2 wc2 wi wi wc6 wv3 wi wn wi
+      wc7 wv5 wv5 wn wv5 wv5 wi wn wi wi wi wi wi wi wi wi wv1 wv1 wv1 wi wi
+      wv5 wv5 wc8 wv2 wi wv2 wv9 wi wi wi wc7 wv7 wi wv3 wv9 wi wi wc3 wi wv8
+      wv6 wi wv0 wi wv5 wn wc9 wn wi wi wc5 wv2 wc2 wi wi wc6 wv3 wi wn wi wc7
+      wv5 wv5 wn wv5 wv5 wi wn wi wi wi wi wi wi wi wi wi wv5 wc8 wv2 wi wv2
+      wv9 wi wi wi wc7 wv7 wi wv3 wv9 wi wi wc3 wi wv8 wv6 wi wv0 wi wv5 wn wc9
+      wn wi wi wc5 wv2 wc2 wi wi wc6 wv3 wi wn wi wc7 wv5 wv5 wn wv5 wv5 wi wn
+      wi wi wi wi wi wi wi wv5 wv5 wc8 wv2 wi wv2 wv9 wi wi wi wc7 wv7 wi wv3
+      wv9 wi wi wc3 wi wv8 wv6 wi wv0 wi wv5 wn wc9 wn wi wi wc5 wv2 wc2 wi wi
+      wc6 wv3 wi wn wi wc7 wv5 wv5 wn wv5 wv5 wi wn wi wi wi wi wi wi wi wi wc7
+      wv7 wi wv3 wv9 wi wi wc3 wi wv8 wv6 wi wv0 wi wv5 wn wc9 wn wi wi wc5 wv2
+      wc2 wi wi wc6 wv3 wi wn wi wc7 wv5 wv5 wn wv5 wv5 wi wn wi wi wi wi wi wi
+      wv5 wc8 wv2 wi wv2 wv9 wi wi wi wc7 wv7 wi wv3 wv9 wi wi wc3 wi wv8 wv6
+      wi wv0 wi wv5 wn wc9 wn wi wi wc5 wv2 wc2 wi wi wc6 wv3 wi wn wi wc7 wv5
+      wv5 wn wv5 wv5 wi wn wi wi wi wi wi wi wi wv8 wv6 wi wv0 wi wv5 wn wc9 wn
+      wi wi wc5 wv2 wc2 wi wi wc6 wv3 wi wn wi wc7 wv5 wv5 wn wv5 wv5 wi wn wi
+      wi wi wi wi wc7 wv7 wi wv3 wv9 wi wi wc3 wi wv8 wv6 wi wv0 wi wv5 wn wc9
+      wn wi wi wc5 wv2 wc2 wi wi wc6 wv3 wi wn wi wc7 wv5 wv5 wn wv5 wv5 wi wn
+      wi wi wi wi wi wi wc5 wv2 wc2 wi wi wc6 wv3 wi wn wi wc7 wv5 wv5 wn wv5
+      wv5 wi wn wi wi wi wi wv8 wv6 wi wv0 wi wv5 wn wc9 wn wi wi wc5 wv2 wc2
+      wi wi wc6 wv3 wi wn wi wc7 wv5 wv5 wn wv5 wv5 wi wn wi wi wi wi wi wc7
+      wv5 wv5 wn wv5 wv5 wi wn wi wi wi wc5 wv2 wc2 wi wi wc6 wv3 wi wn wi wc7
+      wv5 wv5 wn wv5 wv5 wi wn wi wi wi wi wv5 wv5 wn wv5 wv5 wi wn wi wi wc7
+      wv5 wv5 wn wv5 wv5 wi wn wi wi wi wv5 wn wv5 wv5 wi wn wi wv5 wv5 wn wv5
+      wv5 wi wn wi wi wv5 wv5 ax-g7 wv5 wn wv5 wv5 wi wn wi wv5 ax-1 ax-mp wv5
+      wv5 wn wv5 wv5 wi wn wi wi wc7 ax-1 ax-mp wc7 wv5 wv5 wn wv5 wv5 wi wn wi
+      wi wi wc5 wv2 wc2 wi wi wc6 wv3 wi wn wi ax-1 ax-mp wc5 wv2 wc2 wi wi wc6
+      wv3 wi wn wi wc7 wv5 wv5 wn wv5 wv5 wi wn wi wi wi wi wv8 wv6 wi wv0 wi
+      wv5 wn wc9 wn wi wi ax-1 ax-mp wv8 wv6 wi wv0 wi wv5 wn wc9 wn wi wi wc5
+      wv2 wc2 wi wi wc6 wv3 wi wn wi wc7 wv5 wv5 wn wv5 wv5 wi wn wi wi wi wi
+      wi wc7 wv7 wi wv3 wv9 wi wi wc3 wi ax-1 ax-mp wc7 wv7 wi wv3 wv9 wi wi
+      wc3 wi wv8 wv6 wi wv0 wi wv5 wn wc9 wn wi wi wc5 wv2 wc2 wi wi wc6 wv3 wi
+      wn wi wc7 wv5 wv5 wn wv5 wv5 wi wn wi wi wi wi wi wi wv5 wc8 wv2 wi wv2
+      wv9 wi wi wi ax-1 ax-mp wv5 wc8 wv2 wi wv2 wv9 wi wi wi wc7 wv7 wi wv3
+      wv9 wi wi wc3 wi wv8 wv6 wi wv0 wi wv5 wn wc9 wn wi wi wc5 wv2 wc2 wi wi
+      wc6 wv3 wi wn wi wc7 wv5 wv5 wn wv5 wv5 wi wn wi wi wi wi wi wi wi wv5
+      ax-1 ax-mp wv5 wv5 wc8 wv2 wi wv2 wv9 wi wi wi wc7 wv7 wi wv3 wv9 wi wi
+      wc3 wi wv8 wv6 wi wv0 wi wv5 wn wc9 wn wi wi wc5 wv2 wc2 wi wi wc6 wv3 wi
+      wn wi wc7 wv5 wv5 wn wv5 wv5 wi wn wi wi wi wi wi wi wi wi wv1 wv1 wv1 wi
+      wi ax-1 ax-mp ax-mp $.
+  th199 $p |- ( ( ( c1 -> v6 ) -> c1 ) -> ( v8 -> ( ( -. ( v3 -> v3 ) -> ( ( c2 -> v6 ) -> ( c0 -> v2 ) ) ) -> ( ( ( ( v1 -> v6 ) -> ( v5 -> v8 ) ) -> ( ( c7 -> v9 ) -> ( v4 -> v0 ) ) ) -> ( ( v1 -> c4 ) -> ( v7 -> ( -. ( ( v1 -> c2 ) -> -. c8 ) -> v7 ) ) ) ) ) ) ) $=
+      wv8 wv3 wv3 wi wn wc2 wv6 wi wc0 wv2 wi wi wi wv1 wv6 wi wv5 wv8 wi wi
+      wc7 wv9 wi wv4 wv0 wi wi wi wv1 wc4 wi wv7 wv1 wc2 wi wc8 wn wi wn wv7 wi
+      wi wi wi wi wi wc1 wv6 wi wc1 wi wv8 wv3 wv3 wi wn wc2 wv6 wi wc0 wv2 wi
+      wi wi wv1 wv6 wi wv5 wv8 wi wi wc7 wv9 wi wv4 wv0 wi wi wi wv1 wc4 wi wv7
+      wv1 wc2 wi wc8 wn wi wn wv7 wi wi wi wi wi wi wi wv3 wv3 wi wn wc2 wv6 wi
+      wc0 wv2 wi wi wi wv1 wv6 wi wv5 wv8 wi wi wc7 wv9 wi wv4 wv0 wi wi wi wv1
+      wc4 wi wv7 wv1 wc2 wi wc8 wn wi wn wv7 wi wi wi wi wi wv8 wv3 wv3 wi wn
+      wc2 wv6 wi wc0 wv2 wi wi wi wv1 wv6 wi wv5 wv8 wi wi wc7 wv9 wi wv4 wv0
+      wi wi wi wv1 wc4 wi wv7 wv1 wc2 wi wc8 wn wi wn wv7 wi wi wi wi wi wi wv1
+      wv6 wi wv5 wv8 wi wi wc7 wv9 wi wv4 wv0 wi wi wi wv1 wc4 wi wv7 wv1 wc2
+      wi wc8 wn wi wn wv7 wi wi wi wi wv3 wv3 wi wn wc2 wv6 wi wc0 wv2 wi wi wi
+      wv1 wv6 wi wv5 wv8 wi wi wc7 wv9 wi wv4 wv0 wi wi wi wv1 wc4 wi wv7 wv1
+      wc2 wi wc8 wn wi wn wv7 wi wi wi wi wi wv1 wc4 wi wv7 wv1 wc2 wi wc8 wn
+      wi wn wv7 wi wi wi wv1 wv6 wi wv5 wv8 wi wi wc7 wv9 wi wv4 wv0 wi wi wi
+      wv1 wc4 wi wv7 wv1 wc2 wi wc8 wn wi wn wv7 wi wi wi wi wv7 wv1 wc2 wi wc8
+      wn wi wn wv7 wi wi wv1 wc4 wi wv7 wv1 wc2 wi wc8 wn wi wn wv7 wi wi wi
+      wv1 wc2 wi wc8 wn wi wn wv7 wi wv7 wv1 wc2 wi wc8 wn wi wn wv7 wi wi wc8
+      wn wv7 wv1 wc2 wi ax-g1 wv1 wc2 wi wc8 wn wi wn wv7 wi wv7 ax-1 ax-mp wv7
+      wv1 wc2 wi wc8 wn wi wn wv7 wi wi wv1 wc4 wi ax-1 ax-mp wv1 wc4 wi wv7
+      wv1 wc2 wi wc8 wn wi wn wv7 wi wi wi wv1 wv6 wi wv5 wv8 wi wi wc7 wv9 wi
+      wv4 wv0 wi wi wi ax-1 ax-mp wv1 wv6 wi wv5 wv8 wi wi wc7 wv9 wi wv4 wv0
+      wi wi wi wv1 wc4 wi wv7 wv1 wc2 wi wc8 wn wi wn wv7 wi wi wi wi wv3 wv3
+      wi wn wc2 wv6 wi wc0 wv2 wi wi wi ax-1 ax-mp wv3 wv3 wi wn wc2 wv6 wi wc0
+      wv2 wi wi wi wv1 wv6 wi wv5 wv8 wi wi wc7 wv9 wi wv4 wv0 wi wi wi wv1 wc4
+      wi wv7 wv1 wc2 wi wc8 wn wi wn wv7 wi wi wi wi wi wv8 ax-1 ax-mp wv8 wv3
+      wv3 wi wn wc2 wv6 wi wc0 wv2 wi wi wi wv1 wv6 wi wv5 wv8 wi wi wc7 wv9 wi
+      wv4 wv0 wi wi wi wv1 wc4 wi wv7 wv1 wc2 wi wc8 wn wi wn wv7 wi wi wi wi
+      wi wi wc1 wv6 wi wc1 wi ax-1 ax-mp $.
+  th200 $p |- ( ( ( ( v8 -> v4 ) -> v4 ) -> ( v2 -> v3 ) ) -> ( ( ( c9 -> v4 ) -> ( c9 -> v4 ) ) -> -. ( -. v1 -> v6 ) ) ) $=
+      wc9 wv4 wi wc9 wv4 wi wi wv1 wn wv6 wi wn wi wv8 wv4 wi wv4 wi wv2 wv3 wi
+      wi wc9 wv4 wi wc9 wv4 wi wi wv1 wn wv6 wi wn wi wi wv1 wn wv6 wc9 wv4 wi
+      wc9 wv4 wi ax-g0 wc9 wv4 wi wc9 wv4 wi wi wv1 wn wv6 wi wn wi wv8 wv4 wi
+      wv4 wi wv2 wv3 wi wi ax-1 ax-mp $.
+  th201 $p |- ( -. ( v0 -> ( c5 -> v5 ) ) -> ( v6 -> ( ( -. ( v4 -> c1 ) -> ( ( c0 -> c0 ) -> -. c4 ) ) -> -. ( ( ( v1 -> c4 ) -> c1 ) -> ( c1 -> c1 ) ) ) ) ) $=
+      ( wc1 wi wn wc0 wc4 wc5 ax-g8 ax-1 ax-mp ) ECFGHIIGJHGGZBJGZFGFFGGHZGZGZA
+      KDGGHZSGRSQRPFFLQOMNREMNSTMN $.
+  th202 $p |- ( ( v6 -> ( -. c7 -> v7 ) ) -> ( -. ( c1 -> -. v9 ) -> ( ( -. ( c7 -> v9 ) -> -. ( v8 -> c3 ) ) -> ( ( ( v4 -> ( v7 -> c5 ) ) -> ( ( v0 -> c3 ) -> ( c8 -> v7 ) ) ) -> ( ( ( v4 -> ( v7 -> c5 ) ) -> ( ( v0 -> c3 ) -> ( c8 -> v7 ) ) ) -> ( -. ( ( v1 -> v8 ) -> -. v7 ) -> ( ( ( ( c5 -> c8 ) -> ( v4 -> v7 ) ) -> ( ( v6 -> c7 ) -> ( v0 -> c0 ) ) ) -> ( v5 -> ( ( ( ( v2 -> v6 ) -> ( c8 -> c3 ) ) -> ( c4 -> ( c8 -> v0 ) ) ) -> ( v6 -> ( ( ( c9 -> -. v0 ) -> ( ( c2 -> v2 ) -> v6 ) ) -> ( ( ( v0 -> c8 ) -> ( ( c2 -> v1 ) -> ( c2 -> v1 ) ) ) -> ( v2 -> ( ( ( v0 -> c8 ) -> ( ( c2 -> v1 ) -> ( c2 -> v1 ) ) ) -> ( ( -. c7 -> c3 ) -> ( -. ( ( v2 -> c8 ) -> -. c5 ) -> -. v0 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wc1 wv9 wn wi wn wc7 wv9 wi wn wv8 wc3 wi wn wi wv4 wv7 wc5 wi wi wv0 wc3
+      wi wc8 wv7 wi wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv1 wv8
+      wi wv7 wn wi wn wc5 wc8 wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5
+      wv2 wv6 wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2
+      wi wv6 wi wi wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2
+      wv1 wi wc2 wv1 wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi
+      wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv6 wc7 wn wv7 wi wi wc1 wv9 wn
+      wi wn wc7 wv9 wi wn wv8 wc3 wi wn wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7
+      wi wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv1 wv8 wi wv7 wn
+      wi wn wc5 wc8 wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5 wv2 wv6 wi
+      wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi
+      wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1
+      wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi wi wi wi
+      wi wi wi wi wi wi wi wi wi wi wc7 wv9 wi wn wv8 wc3 wi wn wi wv4 wv7 wc5
+      wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi
+      wi wi wv1 wv8 wi wv7 wn wi wn wc5 wc8 wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0
+      wi wi wi wv5 wv2 wv6 wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn
+      wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0
+      wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn
+      wv0 wn wi wi wi wi wi wi wi wi wi wi wi wi wi wi wc1 wv9 wn wi wn wc7 wv9
+      wi wn wv8 wc3 wi wn wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv4
+      wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv1 wv8 wi wv7 wn wi wn wc5 wc8
+      wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5 wv2 wv6 wi wc8 wc3 wi wi
+      wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi
+      wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi
+      wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv4 wv7
+      wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv1 wv8 wi wv7 wn wi wn wc5 wc8 wi
+      wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5 wv2 wv6 wi wc8 wc3 wi wi
+      wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi
+      wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi
+      wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi wi wi wi wi wi wi
+      wi wi wi wi wc7 wv9 wi wn wv8 wc3 wi wn wi wv4 wv7 wc5 wi wi wv0 wc3 wi
+      wc8 wv7 wi wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv1 wv8 wi
+      wv7 wn wi wn wc5 wc8 wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5 wv2
+      wv6 wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi
+      wv6 wi wi wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1
+      wi wc2 wv1 wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi
+      wi wi wi wi wi wi wi wi wi wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi
+      wi wi wv1 wv8 wi wv7 wn wi wn wc5 wc8 wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0
+      wi wi wi wv5 wv2 wv6 wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn
+      wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0
+      wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn
+      wv0 wn wi wi wi wi wi wi wi wi wi wi wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi
+      wc8 wv7 wi wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv1 wv8 wi
+      wv7 wn wi wn wc5 wc8 wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5 wv2
+      wv6 wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi
+      wv6 wi wi wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1
+      wi wc2 wv1 wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi
+      wi wi wi wi wi wi wi wi wi wi wv1 wv8 wi wv7 wn wi wn wc5 wc8 wi wv4 wv7
+      wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5 wv2 wv6 wi wc8 wc3 wi wi wc4 wc8
+      wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi wc2 wv1 wi
+      wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wc7 wn wc3 wi
+      wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi wi wi wi wi wi wi wi wi wv4 wv7
+      wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv1 wv8 wi wv7 wn wi wn wc5 wc8 wi
+      wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5 wv2 wv6 wi wc8 wc3 wi wi
+      wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi
+      wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi
+      wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi wi wi wi wi wi wi
+      wi wi wi wc5 wc8 wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5 wv2 wv6
+      wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi
+      wi wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2
+      wv1 wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi wi wi
+      wi wi wi wi wi wv1 wv8 wi wv7 wn wi wn wc5 wc8 wi wv4 wv7 wi wi wv6 wc7
+      wi wv0 wc0 wi wi wi wv5 wv2 wv6 wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6
+      wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi
+      wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5
+      wn wi wn wv0 wn wi wi wi wi wi wi wi wi wi wi wi wv5 wv2 wv6 wi wc8 wc3
+      wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0 wc8
+      wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi
+      wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi wi wi wi wi wi wi
+      wc5 wc8 wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5 wv2 wv6 wi wc8
+      wc3 wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0
+      wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi
+      wi wi wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi wi wi wi wi
+      wi wi wi wv2 wv6 wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi
+      wc2 wv2 wi wv6 wi wi wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8
+      wi wc2 wv1 wi wc2 wv1 wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0
+      wn wi wi wi wi wi wi wi wi wv5 wv2 wv6 wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi
+      wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi wc2 wv1 wi wc2 wv1
+      wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wc7 wn wc3 wi wv2 wc8
+      wi wc5 wn wi wn wv0 wn wi wi wi wi wi wi wi wi wi wv0 wv0 wv2 wc2 wv1 wv6
+      wv0 wc3 th80 wv2 wv6 wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn
+      wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0
+      wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn
+      wv0 wn wi wi wi wi wi wi wi wi wv5 ax-1 ax-mp wv5 wv2 wv6 wi wc8 wc3 wi
+      wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi
+      wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi
+      wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi wi wi wi wi wi wi
+      wc5 wc8 wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi ax-1 ax-mp wc5 wc8
+      wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5 wv2 wv6 wi wc8 wc3 wi wi
+      wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi
+      wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi
+      wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi wi wi wi wi wi wi
+      wi wv1 wv8 wi wv7 wn wi wn ax-1 ax-mp wv1 wv8 wi wv7 wn wi wn wc5 wc8 wi
+      wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5 wv2 wv6 wi wc8 wc3 wi wi
+      wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi
+      wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi
+      wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi wi wi wi wi wi wi
+      wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi ax-1 ax-mp wv4 wv7
+      wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv1 wv8 wi wv7 wn wi wn wc5 wc8 wi
+      wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5 wv2 wv6 wi wc8 wc3 wi wi
+      wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi
+      wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi
+      wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi wi wi wi wi wi wi wi wi
+      wi wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi ax-1 ax-mp wv4 wv7
+      wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8
+      wv7 wi wi wi wv1 wv8 wi wv7 wn wi wn wc5 wc8 wi wv4 wv7 wi wi wv6 wc7 wi
+      wv0 wc0 wi wi wi wv5 wv2 wv6 wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6
+      wc9 wv0 wn wi wc2 wv2 wi wv6 wi wi wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi
+      wv2 wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5
+      wn wi wn wv0 wn wi wi wi wi wi wi wi wi wi wi wi wi wi wc7 wv9 wi wn wv8
+      wc3 wi wn wi ax-1 ax-mp wc7 wv9 wi wn wv8 wc3 wi wn wi wv4 wv7 wc5 wi wi
+      wv0 wc3 wi wc8 wv7 wi wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi
+      wv1 wv8 wi wv7 wn wi wn wc5 wc8 wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi
+      wi wv5 wv2 wv6 wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi
+      wc2 wv2 wi wv6 wi wi wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8
+      wi wc2 wv1 wi wc2 wv1 wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0
+      wn wi wi wi wi wi wi wi wi wi wi wi wi wi wi wc1 wv9 wn wi wn ax-1 ax-mp
+      wc1 wv9 wn wi wn wc7 wv9 wi wn wv8 wc3 wi wn wi wv4 wv7 wc5 wi wi wv0 wc3
+      wi wc8 wv7 wi wi wi wv4 wv7 wc5 wi wi wv0 wc3 wi wc8 wv7 wi wi wi wv1 wv8
+      wi wv7 wn wi wn wc5 wc8 wi wv4 wv7 wi wi wv6 wc7 wi wv0 wc0 wi wi wi wv5
+      wv2 wv6 wi wc8 wc3 wi wi wc4 wc8 wv0 wi wi wi wv6 wc9 wv0 wn wi wc2 wv2
+      wi wv6 wi wi wv0 wc8 wi wc2 wv1 wi wc2 wv1 wi wi wi wv2 wv0 wc8 wi wc2
+      wv1 wi wc2 wv1 wi wi wi wc7 wn wc3 wi wv2 wc8 wi wc5 wn wi wn wv0 wn wi
+      wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv6 wc7 wn wv7 wi wi ax-1 ax-mp
+      $.
+  th203 $p |- ( -. -. ( c8 -> v6 ) -> ( c8 -> ( -. v2 -> ( ( ( ( v4 -> v3 ) -> ( v3 -> c6 ) ) -> v8 ) -> ( ( ( c4 -> v8 ) -> ( -. v2 -> ( v4 -> v3 ) ) ) -> ( ( ( c4 -> v8 ) -> -. v2 ) -> ( ( c4 -> v8 ) -> ( v4 -> v3 ) ) ) ) ) ) ) ) $=
+      ( wv5 wi wc8 wn wc6 wc4 ax-1 ax-2 ax-mp ) FFFGGZHDGIIZHAIZCBGBJGGEGZKEGZQ
+      CBGZGGSQGSTGGGZGZGZGZGZFFLUEOUEGUDUEUCUDUBUCUAUBSQTMUARLNUBQLNUCHLNUDPLNU
+      EOLNN $.
+  th204 $p |- ( v1 -> ( ( c7 -> c0 ) -> ( -. ( v2 -> v9 ) -> -. ( ( c7 -> c0 ) -> c3 ) ) ) ) $=
+      wc7 wc0 wi wv2 wv9 wi wn wc7 wc0 wi wc3 wi wn wi wi wv1 wc7 wc0 wi wv2
+      wv9 wi wn wc7 wc0 wi wc3 wi wn wi wi wi wv2 wv9 wi wn wc7 wc0 wi wc3 wi
+      wn wi wc7 wc0 wi wv2 wv9 wi wn wc7 wc0 wi wc3 wi wn wi wi wc3 wc7 wc0 wi
+      wv2 wv9 ax-g3 wv2 wv9 wi wn wc7 wc0 wi wc3 wi wn wi wc7 wc0 wi ax-1 ax-mp
+      wc7 wc0 wi wv2 wv9 wi wn wc7 wc0 wi wc3 wi wn wi wi wv1 ax-1 ax-mp $.
+  wth12 $p wff ( ( ( c6 -> ( v2 -> v4 ) ) -> ( ( v5 -> v4 ) -> ( c7 -> v4 ) ) ) -> v1 ) $=
+      ( wc6 wi wc7 ) EBCFFDCFGCFFFAF $.
+  th205 $p |- ( c4 -> ( -. -. v4 -> ( c4 -> ( v8 -> -. ( ( v8 -> v8 ) -> ( v8 -> v8 ) ) ) ) ) ) $=
+      ( wn wc4 wi ax-g8 ax-1 ax-mp ) ACCZDBBBEBBEECZEZEZEZDMELMKLJKBBBFJBGHKDGH
+      LIGHMDGH $.
+  th206 $p |- ( v5 -> ( v5 -> ( -. ( ( c2 -> c8 ) -> v3 ) -> ( -. ( v5 -> v3 ) -> -. ( ( c0 -> v5 ) -> ( c0 -> v5 ) ) ) ) ) ) $=
+      ( wc2 wc8 wi wn wc0 th117 ax-1 ax-mp ) BCDEAEFBAEFGBEGBEEFEEEZBKEGBACHKBI
+      J $.
+  ${
+    sh5.0 $e |- ( v8 -> ( c6 -> ( v9 -> v8 ) ) ) $.
+    wl5.0 $f wff v10 $.
+    sth5.0 $p |- ( v10 -> ( ( ( v8 -> ( c8 -> v5 ) ) -> ( v1 -> -. c6 ) ) -> ( ( ( ( c9 -> v2 ) -> ( v9 -> v9 ) ) -> ( ( v6 -> v7 ) -> c2 ) ) -> ( v1 -> ( c2 -> ( v1 -> ( c2 -> ( v8 -> ( c6 -> ( v9 -> v8 ) ) ) ) ) ) ) ) ) ) $=
+      wv8 wc8 wv5 wi wi wv1 wc6 wn wi wi wc9 wv2 wi wv9 wv9 wi wi wv6 wv7 wi
+      wc2 wi wi wv1 wc2 wv1 wc2 wv8 wc6 wv9 wv8 wi wi wi wi wi wi wi wi wi
+      wl5.0 wv8 wc8 wv5 wi wi wv1 wc6 wn wi wi wc9 wv2 wi wv9 wv9 wi wi wv6 wv7
+      wi wc2 wi wi wv1 wc2 wv1 wc2 wv8 wc6 wv9 wv8 wi wi wi wi wi wi wi wi wi
+      wi wc9 wv2 wi wv9 wv9 wi wi wv6 wv7 wi wc2 wi wi wv1 wc2 wv1 wc2 wv8 wc6
+      wv9 wv8 wi wi wi wi wi wi wi wi wv8 wc8 wv5 wi wi wv1 wc6 wn wi wi wc9
+      wv2 wi wv9 wv9 wi wi wv6 wv7 wi wc2 wi wi wv1 wc2 wv1 wc2 wv8 wc6 wv9 wv8
+      wi wi wi wi wi wi wi wi wi wv1 wc2 wv1 wc2 wv8 wc6 wv9 wv8 wi wi wi wi wi
+      wi wi wc9 wv2 wi wv9 wv9 wi wi wv6 wv7 wi wc2 wi wi wv1 wc2 wv1 wc2 wv8
+      wc6 wv9 wv8 wi wi wi wi wi wi wi wi wc2 wv1 wc2 wv8 wc6 wv9 wv8 wi wi wi
+      wi wi wi wv1 wc2 wv1 wc2 wv8 wc6 wv9 wv8 wi wi wi wi wi wi wi wv1 wc2 wv8
+      wc6 wv9 wv8 wi wi wi wi wi wc2 wv1 wc2 wv8 wc6 wv9 wv8 wi wi wi wi wi wi
+      wc2 wv8 wc6 wv9 wv8 wi wi wi wi wv1 wc2 wv8 wc6 wv9 wv8 wi wi wi wi wi
+      wv8 wc6 wv9 wv8 wi wi wi wc2 wv8 wc6 wv9 wv8 wi wi wi wi sh5.0 wv8 wc6
+      wv9 wv8 wi wi wi wc2 ax-1 ax-mp wc2 wv8 wc6 wv9 wv8 wi wi wi wi wv1 ax-1
+      ax-mp wv1 wc2 wv8 wc6 wv9 wv8 wi wi wi wi wi wc2 ax-1 ax-mp wc2 wv1 wc2
+      wv8 wc6 wv9 wv8 wi wi wi wi wi wi wv1 ax-1 ax-mp wv1 wc2 wv1 wc2 wv8 wc6
+      wv9 wv8 wi wi wi wi wi wi wi wc9 wv2 wi wv9 wv9 wi wi wv6 wv7 wi wc2 wi
+      wi ax-1 ax-mp wc9 wv2 wi wv9 wv9 wi wi wv6 wv7 wi wc2 wi wi wv1 wc2 wv1
+      wc2 wv8 wc6 wv9 wv8 wi wi wi wi wi wi wi wi wv8 wc8 wv5 wi wi wv1 wc6 wn
+      wi wi ax-1 ax-mp wv8 wc8 wv5 wi wi wv1 wc6 wn wi wi wc9 wv2 wi wv9 wv9 wi
+      wi wv6 wv7 wi wc2 wi wi wv1 wc2 wv1 wc2 wv8 wc6 wv9 wv8 wi wi wi wi wi wi
+      wi wi wi wl5.0 ax-1 ax-mp $.
+    ${
+      sh5.1 $e |- v6 $.
+      sth5.1 $p |- ( ( ( v8 -> ( v9 -> v1 ) ) -> -. ( c2 -> v7 ) ) -> ( ( ( ( v1 -> c8 ) -> v4 ) -> ( -. v2 -> ( c0 -> c6 ) ) ) -> ( ( ( ( c4 -> v5 ) -> v4 ) -> v6 ) -> ( -. v8 -> ( -. ( ( v6 -> v6 ) -> ( v8 -> v1 ) ) -> ( v0 -> ( ( v6 -> -. ( v6 -> v9 ) ) -> ( ( v6 -> -. ( v6 -> v9 ) ) -> v6 ) ) ) ) ) ) ) ) $=
+      ( wv3 wi wc2 wn wc8 wc0 wc6 wc4 ax-1 ax-mp ) LLLMMZHIBMMNGMOMZBPMDMCOQRMM
+      MZSEMDMFMZHOZFFMHBMMOZAFFIMOMZUHFMZMZMZMZMZMZMZMZLLTUPUBUPMUOUPUNUOUMUNUL
+      UMUKULUJUKUIUJFUIKFUHTUAUIUHTUAUJATUAUKUGTUAULUFTUAUMUETUAUNUDTUAUOUCTUAU
+      PUBTUAUA $.
+      ${
+        sh5.2 $e |- ( ( ( v4 -> c8 ) -> ( c5 -> v3 ) ) -> v9 ) $.
+        sth5.2 $p |- ( ( ( ( c1 -> c8 ) -> v7 ) -> ( ( c0 -> c6 ) -> ( v4 -> v3 ) ) ) -> ( ( ( ( v6 -> v5 ) -> -. c0 ) -> -. ( v7 -> v1 ) ) -> ( ( ( ( c9 -> v1 ) -> v8 ) -> ( ( v0 -> v5 ) -> v0 ) ) -> ( v7 -> ( v7 -> ( ( ( -. c3 -> c0 ) -> v3 ) -> ( ( ( -. c3 -> c0 ) -> v3 ) -> ( ( ( v4 -> c8 ) -> ( c5 -> v3 ) ) -> v9 ) ) ) ) ) ) ) ) $=
+      wv6 wv5 wi wc0 wn wi wv7 wv1 wi wn wi wc9 wv1 wi wv8 wi wv0 wv5 wi wv0 wi
+      wi wv7 wv7 wc3 wn wc0 wi wv3 wi wc3 wn wc0 wi wv3 wi wv4 wc8 wi wc5 wv3
+      wi wi wv9 wi wi wi wi wi wi wi wc1 wc8 wi wv7 wi wc0 wc6 wi wv4 wv3 wi wi
+      wi wv6 wv5 wi wc0 wn wi wv7 wv1 wi wn wi wc9 wv1 wi wv8 wi wv0 wv5 wi wv0
+      wi wi wv7 wv7 wc3 wn wc0 wi wv3 wi wc3 wn wc0 wi wv3 wi wv4 wc8 wi wc5
+      wv3 wi wi wv9 wi wi wi wi wi wi wi wi wc9 wv1 wi wv8 wi wv0 wv5 wi wv0 wi
+      wi wv7 wv7 wc3 wn wc0 wi wv3 wi wc3 wn wc0 wi wv3 wi wv4 wc8 wi wc5 wv3
+      wi wi wv9 wi wi wi wi wi wi wv6 wv5 wi wc0 wn wi wv7 wv1 wi wn wi wc9 wv1
+      wi wv8 wi wv0 wv5 wi wv0 wi wi wv7 wv7 wc3 wn wc0 wi wv3 wi wc3 wn wc0 wi
+      wv3 wi wv4 wc8 wi wc5 wv3 wi wi wv9 wi wi wi wi wi wi wi wv7 wv7 wc3 wn
+      wc0 wi wv3 wi wc3 wn wc0 wi wv3 wi wv4 wc8 wi wc5 wv3 wi wi wv9 wi wi wi
+      wi wi wc9 wv1 wi wv8 wi wv0 wv5 wi wv0 wi wi wv7 wv7 wc3 wn wc0 wi wv3 wi
+      wc3 wn wc0 wi wv3 wi wv4 wc8 wi wc5 wv3 wi wi wv9 wi wi wi wi wi wi wv7
+      wc3 wn wc0 wi wv3 wi wc3 wn wc0 wi wv3 wi wv4 wc8 wi wc5 wv3 wi wi wv9 wi
+      wi wi wi wv7 wv7 wc3 wn wc0 wi wv3 wi wc3 wn wc0 wi wv3 wi wv4 wc8 wi wc5
+      wv3 wi wi wv9 wi wi wi wi wi wc3 wn wc0 wi wv3 wi wc3 wn wc0 wi wv3 wi
+      wv4 wc8 wi wc5 wv3 wi wi wv9 wi wi wi wv7 wc3 wn wc0 wi wv3 wi wc3 wn wc0
+      wi wv3 wi wv4 wc8 wi wc5 wv3 wi wi wv9 wi wi wi wi wc3 wn wc0 wi wv3 wi
+      wv4 wc8 wi wc5 wv3 wi wi wv9 wi wi wc3 wn wc0 wi wv3 wi wc3 wn wc0 wi wv3
+      wi wv4 wc8 wi wc5 wv3 wi wi wv9 wi wi wi wv4 wc8 wi wc5 wv3 wi wi wv9 wi
+      wc3 wn wc0 wi wv3 wi wv4 wc8 wi wc5 wv3 wi wi wv9 wi wi sh5.2 wv4 wc8 wi
+      wc5 wv3 wi wi wv9 wi wc3 wn wc0 wi wv3 wi ax-1 ax-mp wc3 wn wc0 wi wv3 wi
+      wv4 wc8 wi wc5 wv3 wi wi wv9 wi wi wc3 wn wc0 wi wv3 wi ax-1 ax-mp wc3 wn
+      wc0 wi wv3 wi wc3 wn wc0 wi wv3 wi wv4 wc8 wi wc5 wv3 wi wi wv9 wi wi wi
+      wv7 ax-1 ax-mp wv7 wc3 wn wc0 wi wv3 wi wc3 wn wc0 wi wv3 wi wv4 wc8 wi
+      wc5 wv3 wi wi wv9 wi wi wi wi wv7 ax-1 ax-mp wv7 wv7 wc3 wn wc0 wi wv3 wi
+      wc3 wn wc0 wi wv3 wi wv4 wc8 wi wc5 wv3 wi wi wv9 wi wi wi wi wi wc9 wv1
+      wi wv8 wi wv0 wv5 wi wv0 wi wi ax-1 ax-mp wc9 wv1 wi wv8 wi wv0 wv5 wi
+      wv0 wi wi wv7 wv7 wc3 wn wc0 wi wv3 wi wc3 wn wc0 wi wv3 wi wv4 wc8 wi
+      wc5 wv3 wi wi wv9 wi wi wi wi wi wi wv6 wv5 wi wc0 wn wi wv7 wv1 wi wn wi
+      ax-1 ax-mp wv6 wv5 wi wc0 wn wi wv7 wv1 wi wn wi wc9 wv1 wi wv8 wi wv0
+      wv5 wi wv0 wi wi wv7 wv7 wc3 wn wc0 wi wv3 wi wc3 wn wc0 wi wv3 wi wv4
+      wc8 wi wc5 wv3 wi wi wv9 wi wi wi wi wi wi wi wc1 wc8 wi wv7 wi wc0 wc6
+      wi wv4 wv3 wi wi wi ax-1 ax-mp $.
+      $}
+    $}
+  $}
+  wth13 $p wff ( ( ( -. v8 -> ( c9 -> v3 ) ) -> ( c9 -> ( v4 -> c5 ) ) ) -> v6 ) $=
+      ( wn wc9 wi wc5 ) DEFAGGFBHGGGCG $.
+  wth14 $p wff ( ( ( v1 -> ( v1 -> v2 ) ) -> v2 ) -> c2 ) $=
+      wv1 wv1 wv2 wi wi wv2 wi wc2 wi $.
+  ${
+    $d v0 v8 $.
+    th207 $p |- ( c6 -> ( ( ( ( v4 -> v0 ) -> ( v7 -> v1 ) ) -> ( ( v4 -> v0 ) -> -. v5 ) ) -> ( ( ( ( v5 -> v2 ) -> -. v4 ) -> ( ( v3 -> c8 ) -> ( v1 -> c9 ) ) ) -> ( v8 -> ( -. ( -. v2 -> ( v2 -> c2 ) ) -> ( ( ( ( v8 -> v2 ) -> c1 ) -> v8 ) -> ( c4 -> ( v8 -> ( v0 -> ( -. ( v0 -> ( c8 -> v8 ) ) -> ( c3 -> c2 ) ) ) ) ) ) ) ) ) ) ) $=
+      wv6 wv6 wv6 wi wi wc6 wv4 wv0 wi wv7 wv1 wi wi wv4 wv0 wi wv5 wn wi wi
+      wv5 wv2 wi wv4 wn wi wv3 wc8 wi wv1 wc9 wi wi wi wv8 wv2 wn wv2 wc2 wi wi
+      wn wv8 wv2 wi wc1 wi wv8 wi wc4 wv8 wv0 wv0 wc8 wv8 wi wi wn wc3 wc2 wi
+      wi wi wi wi wi wi wi wi wi wi wv6 wv6 ax-1 wc6 wv4 wv0 wi wv7 wv1 wi wi
+      wv4 wv0 wi wv5 wn wi wi wv5 wv2 wi wv4 wn wi wv3 wc8 wi wv1 wc9 wi wi wi
+      wv8 wv2 wn wv2 wc2 wi wi wn wv8 wv2 wi wc1 wi wv8 wi wc4 wv8 wv0 wv0 wc8
+      wv8 wi wi wn wc3 wc2 wi wi wi wi wi wi wi wi wi wi wi wv6 wv6 wv6 wi wi
+      wc6 wv4 wv0 wi wv7 wv1 wi wi wv4 wv0 wi wv5 wn wi wi wv5 wv2 wi wv4 wn wi
+      wv3 wc8 wi wv1 wc9 wi wi wi wv8 wv2 wn wv2 wc2 wi wi wn wv8 wv2 wi wc1 wi
+      wv8 wi wc4 wv8 wv0 wv0 wc8 wv8 wi wi wn wc3 wc2 wi wi wi wi wi wi wi wi
+      wi wi wi wi wv4 wv0 wi wv7 wv1 wi wi wv4 wv0 wi wv5 wn wi wi wv5 wv2 wi
+      wv4 wn wi wv3 wc8 wi wv1 wc9 wi wi wi wv8 wv2 wn wv2 wc2 wi wi wn wv8 wv2
+      wi wc1 wi wv8 wi wc4 wv8 wv0 wv0 wc8 wv8 wi wi wn wc3 wc2 wi wi wi wi wi
+      wi wi wi wi wi wc6 wv4 wv0 wi wv7 wv1 wi wi wv4 wv0 wi wv5 wn wi wi wv5
+      wv2 wi wv4 wn wi wv3 wc8 wi wv1 wc9 wi wi wi wv8 wv2 wn wv2 wc2 wi wi wn
+      wv8 wv2 wi wc1 wi wv8 wi wc4 wv8 wv0 wv0 wc8 wv8 wi wi wn wc3 wc2 wi wi
+      wi wi wi wi wi wi wi wi wi wv5 wv2 wi wv4 wn wi wv3 wc8 wi wv1 wc9 wi wi
+      wi wv8 wv2 wn wv2 wc2 wi wi wn wv8 wv2 wi wc1 wi wv8 wi wc4 wv8 wv0 wv0
+      wc8 wv8 wi wi wn wc3 wc2 wi wi wi wi wi wi wi wi wi wv4 wv0 wi wv7 wv1 wi
+      wi wv4 wv0 wi wv5 wn wi wi wv5 wv2 wi wv4 wn wi wv3 wc8 wi wv1 wc9 wi wi
+      wi wv8 wv2 wn wv2 wc2 wi wi wn wv8 wv2 wi wc1 wi wv8 wi wc4 wv8 wv0 wv0
+      wc8 wv8 wi wi wn wc3 wc2 wi wi wi wi wi wi wi wi wi wi wv8 wv2 wn wv2 wc2
+      wi wi wn wv8 wv2 wi wc1 wi wv8 wi wc4 wv8 wv0 wv0 wc8 wv8 wi wi wn wc3
+      wc2 wi wi wi wi wi wi wi wi wv5 wv2 wi wv4 wn wi wv3 wc8 wi wv1 wc9 wi wi
+      wi wv8 wv2 wn wv2 wc2 wi wi wn wv8 wv2 wi wc1 wi wv8 wi wc4 wv8 wv0 wv0
+      wc8 wv8 wi wi wn wc3 wc2 wi wi wi wi wi wi wi wi wi wv8 wv8 wv0 wc8 wc4
+      wv8 wv2 th193 wv8 wv2 wn wv2 wc2 wi wi wn wv8 wv2 wi wc1 wi wv8 wi wc4
+      wv8 wv0 wv0 wc8 wv8 wi wi wn wc3 wc2 wi wi wi wi wi wi wi wi wv5 wv2 wi
+      wv4 wn wi wv3 wc8 wi wv1 wc9 wi wi wi ax-1 ax-mp wv5 wv2 wi wv4 wn wi wv3
+      wc8 wi wv1 wc9 wi wi wi wv8 wv2 wn wv2 wc2 wi wi wn wv8 wv2 wi wc1 wi wv8
+      wi wc4 wv8 wv0 wv0 wc8 wv8 wi wi wn wc3 wc2 wi wi wi wi wi wi wi wi wi
+      wv4 wv0 wi wv7 wv1 wi wi wv4 wv0 wi wv5 wn wi wi ax-1 ax-mp wv4 wv0 wi
+      wv7 wv1 wi wi wv4 wv0 wi wv5 wn wi wi wv5 wv2 wi wv4 wn wi wv3 wc8 wi wv1
+      wc9 wi wi wi wv8 wv2 wn wv2 wc2 wi wi wn wv8 wv2 wi wc1 wi wv8 wi wc4 wv8
+      wv0 wv0 wc8 wv8 wi wi wn wc3 wc2 wi wi wi wi wi wi wi wi wi wi wc6 ax-1
+      ax-mp wc6 wv4 wv0 wi wv7 wv1 wi wi wv4 wv0 wi wv5 wn wi wi wv5 wv2 wi wv4
+      wn wi wv3 wc8 wi wv1 wc9 wi wi wi wv8 wv2 wn wv2 wc2 wi wi wn wv8 wv2 wi
+      wc1 wi wv8 wi wc4 wv8 wv0 wv0 wc8 wv8 wi wi wn wc3 wc2 wi wi wi wi wi wi
+      wi wi wi wi wi wv6 wv6 wv6 wi wi ax-1 ax-mp ax-mp $.
+  $}
+  wth15 $p wff -. ( ( ( c9 -> c9 ) -> ( v4 -> c5 ) ) -> v1 ) $=
+      wc9 wc9 wi wv4 wc5 wi wi wv1 wi wn $.
+  th208 $p |- ( v5 -> ( ( -. ( c1 -> v3 ) -> ( ( c2 -> v7 ) -> ( v7 -> v5 ) ) ) -> ( ( v9 -> ( ( v1 -> v5 ) -> -. c6 ) ) -> ( v3 -> ( v3 -> ( ( c9 -> c9 ) -> ( ( c9 -> c5 ) -> ( ( c9 -> c5 ) -> ( ( ( c5 -> ( v9 -> c9 ) ) -> ( c9 -> v3 ) ) -> ( v9 -> ( c9 -> c9 ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc1 wi wn wc2 wc6 wc9 wc5 th13 ax-1 ax-mp ) FBGHIDGDCGGGZEACGJHGGZBBKKG
+      KLGKLGLEKGGKBGGEKKGGGGGGZGZGZGZGZCUBGUAUBTUASTRSKEKKEBMRBNOSBNOTQNOUAPNOU
+      BCNO $.
+  th209 $p |- ( ( -. ( v5 -> v3 ) -> ( v9 -> ( v9 -> v8 ) ) ) -> ( c9 -> c9 ) ) $=
+      wc9 wc9 wi wv5 wv3 wi wn wv9 wv9 wv8 wi wi wi wc9 wc9 wi wi wc9 wc9 wc9
+      wi wc9 ax-g6 wc9 wc9 ax-1 ax-mp wc9 wc9 wi wv5 wv3 wi wn wv9 wv9 wv8 wi
+      wi wi ax-1 ax-mp $.
+  th210 $p |- ( ( ( ( v6 -> c5 ) -> v7 ) -> ( ( v8 -> v4 ) -> -. v1 ) ) -> ( c8 -> ( v1 -> ( -. ( -. v7 -> c4 ) -> ( v1 -> ( c3 -> ( v1 -> ( c8 -> ( -. c1 -> ( -. v5 -> ( c8 -> ( ( ( -. v2 -> ( v8 -> v8 ) ) -> ( -. v5 -> ( v5 -> v8 ) ) ) -> ( ( ( ( v8 -> v2 ) -> ( v5 -> v5 ) ) -> ( v8 -> ( v5 -> v8 ) ) ) -> -. -. v5 ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc8 wn wc4 wi wc3 wc1 wc5 th96 ax-1 ax-mp ) HAFIJKIZALAHMIDIHBIGGKKDIDG
+      KKKGBKDDKKGDGKKKDIIKKKKKZKZKZKZKZKZKZKZENKFKGCKAIKKZUFKUEUFUDUEUCUDUBUCUA
+      UBTUASTDGGBDDGOSHPQTAPQUALPQUBAPQUCRPQUDAPQUEHPQUFUGPQ $.
+  th211 $p |- ( v8 -> ( v1 -> ( ( v8 -> ( v0 -> c7 ) ) -> ( ( c6 -> c2 ) -> ( ( ( ( v8 -> v1 ) -> ( v1 -> c6 ) ) -> ( ( v5 -> c7 ) -> c8 ) ) -> ( -. ( v8 -> c4 ) -> ( ( ( ( v5 -> v9 ) -> -. c0 ) -> ( ( c0 -> c0 ) -> ( v1 -> v9 ) ) ) -> ( ( c0 -> ( c8 -> ( c0 -> c0 ) ) ) -> -. ( ( ( v0 -> v9 ) -> ( c6 -> c2 ) ) -> ( ( v0 -> v9 ) -> ( v0 -> v9 ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wv2 wi wc7 wc6 wc2 wc8 wc4 wn wc0 ax-1 th60 ax-mp ) FFFGGZDBDAHGGIJGDBG
+      BIGGCHGKGGDLGMCEGNMGNNGBEGGGNKNNGGGAEGIJGGAEGAEGGGMGGGGGGZGZGZFFOUARUAGTU
+      ASTNNBBHCDAAEPSBOQTDOQUAROQQ $.
+  th212 $p |- ( v7 -> ( -. -. -. v6 -> ( -. ( v1 -> ( v1 -> c7 ) ) -> ( -. ( v1 -> ( v1 -> c7 ) ) -> ( v1 -> ( -. c4 -> ( ( ( ( v8 -> v0 ) -> ( v8 -> v9 ) ) -> ( ( v9 -> v7 ) -> ( c1 -> v7 ) ) ) -> -. ( ( ( c2 -> v2 ) -> ( c2 -> v1 ) ) -> ( ( c0 -> c1 ) -> ( c0 -> c1 ) ) ) ) ) ) ) ) ) ) $=
+      wv6 wn wn wn wv1 wv1 wc7 wi wi wn wv1 wv1 wc7 wi wi wn wv1 wc4 wn wv8 wv0
+      wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2 wv2 wi wc2 wv1 wi wi wc0
+      wc1 wi wc0 wc1 wi wi wi wn wi wi wi wi wi wi wv7 wv6 wn wn wn wv1 wv1 wc7
+      wi wi wn wv1 wv1 wc7 wi wi wn wv1 wc4 wn wv8 wv0 wi wv8 wv9 wi wi wv9 wv7
+      wi wc1 wv7 wi wi wi wc2 wv2 wi wc2 wv1 wi wi wc0 wc1 wi wc0 wc1 wi wi wi
+      wn wi wi wi wi wi wi wi wv1 wv1 wc7 wi wi wn wv1 wv1 wc7 wi wi wn wv1 wc4
+      wn wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2 wv2 wi wc2
+      wv1 wi wi wc0 wc1 wi wc0 wc1 wi wi wi wn wi wi wi wi wi wv6 wn wn wn wv1
+      wv1 wc7 wi wi wn wv1 wv1 wc7 wi wi wn wv1 wc4 wn wv8 wv0 wi wv8 wv9 wi wi
+      wv9 wv7 wi wc1 wv7 wi wi wi wc2 wv2 wi wc2 wv1 wi wi wc0 wc1 wi wc0 wc1
+      wi wi wi wn wi wi wi wi wi wi wv1 wv1 wc7 wi wi wn wv1 wc4 wn wv8 wv0 wi
+      wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2 wv2 wi wc2 wv1 wi wi wc0
+      wc1 wi wc0 wc1 wi wi wi wn wi wi wi wi wv1 wv1 wc7 wi wi wn wv1 wv1 wc7
+      wi wi wn wv1 wc4 wn wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi
+      wc2 wv2 wi wc2 wv1 wi wi wc0 wc1 wi wc0 wc1 wi wi wi wn wi wi wi wi wi
+      wv1 wc4 wn wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2 wv2
+      wi wc2 wv1 wi wi wc0 wc1 wi wc0 wc1 wi wi wi wn wi wi wi wv1 wv1 wc7 wi
+      wi wn wv1 wc4 wn wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2
+      wv2 wi wc2 wv1 wi wi wc0 wc1 wi wc0 wc1 wi wi wi wn wi wi wi wi wc4 wn
+      wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2 wv2 wi wc2 wv1
+      wi wi wc0 wc1 wi wc0 wc1 wi wi wi wn wi wi wv1 wc4 wn wv8 wv0 wi wv8 wv9
+      wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2 wv2 wi wc2 wv1 wi wi wc0 wc1 wi wc0
+      wc1 wi wi wi wn wi wi wi wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi
+      wi wi wc2 wv2 wi wc2 wv1 wi wi wc0 wc1 wi wc0 wc1 wi wi wi wn wi wc4 wn
+      wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2 wv2 wi wc2 wv1
+      wi wi wc0 wc1 wi wc0 wc1 wi wi wi wn wi wi wc2 wv2 wi wc2 wv1 wi wi wc0
+      wc1 wi wc0 wc1 wi wi wi wn wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi
+      wi wi wc2 wv2 wi wc2 wv1 wi wi wc0 wc1 wi wc0 wc1 wi wi wi wn wi wc2 wv2
+      wi wc0 wc1 wi wc2 wv1 wi ax-g8 wc2 wv2 wi wc2 wv1 wi wi wc0 wc1 wi wc0
+      wc1 wi wi wi wn wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi ax-1
+      ax-mp wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2 wv2 wi wc2
+      wv1 wi wi wc0 wc1 wi wc0 wc1 wi wi wi wn wi wc4 wn ax-1 ax-mp wc4 wn wv8
+      wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2 wv2 wi wc2 wv1 wi wi
+      wc0 wc1 wi wc0 wc1 wi wi wi wn wi wi wv1 ax-1 ax-mp wv1 wc4 wn wv8 wv0 wi
+      wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2 wv2 wi wc2 wv1 wi wi wc0
+      wc1 wi wc0 wc1 wi wi wi wn wi wi wi wv1 wv1 wc7 wi wi wn ax-1 ax-mp wv1
+      wv1 wc7 wi wi wn wv1 wc4 wn wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7
+      wi wi wi wc2 wv2 wi wc2 wv1 wi wi wc0 wc1 wi wc0 wc1 wi wi wi wn wi wi wi
+      wi wv1 wv1 wc7 wi wi wn ax-1 ax-mp wv1 wv1 wc7 wi wi wn wv1 wv1 wc7 wi wi
+      wn wv1 wc4 wn wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2
+      wv2 wi wc2 wv1 wi wi wc0 wc1 wi wc0 wc1 wi wi wi wn wi wi wi wi wi wv6 wn
+      wn wn ax-1 ax-mp wv6 wn wn wn wv1 wv1 wc7 wi wi wn wv1 wv1 wc7 wi wi wn
+      wv1 wc4 wn wv8 wv0 wi wv8 wv9 wi wi wv9 wv7 wi wc1 wv7 wi wi wi wc2 wv2
+      wi wc2 wv1 wi wi wc0 wc1 wi wc0 wc1 wi wi wi wn wi wi wi wi wi wi wv7
+      ax-1 ax-mp $.
+  th213 $p |- ( v0 -> ( v0 -> ( c5 -> ( ( ( v4 -> ( c9 -> c9 ) ) -> ( v6 -> ( v6 -> v8 ) ) ) -> ( ( c9 -> v7 ) -> ( v0 -> ( c9 -> v7 ) ) ) ) ) ) ) $=
+      ( wc5 wc9 wi ax-g4 ax-1 ax-mp ) AFBGGHHCCEHHHZGDHZAMHZHZHZHZHZARHQRPQOPNO
+      MNMIMAJKNMJKOLJKPFJKQAJKRAJK $.
+  th214 $p |- ( ( ( v7 -> v2 ) -> ( v1 -> v6 ) ) -> ( ( ( ( v0 -> v3 ) -> v4 ) -> ( ( c7 -> v5 ) -> ( v8 -> v1 ) ) ) -> ( ( ( v7 -> v2 ) -> ( v1 -> v6 ) ) -> ( -. v7 -> ( ( -. c9 -> -. ( v5 -> v7 ) ) -> ( v1 -> ( ( v8 -> v1 ) -> ( ( ( -. c0 -> -. c2 ) -> -. ( v1 -> c1 ) ) -> -. ( ( ( v3 -> c6 ) -> ( v3 -> c6 ) ) -> ( ( v8 -> v1 ) -> ( v8 -> v1 ) ) ) ) ) ) ) ) ) ) ) $=
+      wv9 wv9 wv9 wi wi wv7 wv2 wi wv1 wv6 wi wi wv0 wv3 wi wv4 wi wc7 wv5 wi
+      wv8 wv1 wi wi wi wv7 wv2 wi wv1 wv6 wi wi wv7 wn wc9 wn wv5 wv7 wi wn wi
+      wv1 wv8 wv1 wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi
+      wv8 wv1 wi wv8 wv1 wi wi wi wn wi wi wi wi wi wi wi wi wv9 wv9 ax-1 wv7
+      wv2 wi wv1 wv6 wi wi wv0 wv3 wi wv4 wi wc7 wv5 wi wv8 wv1 wi wi wi wv7
+      wv2 wi wv1 wv6 wi wi wv7 wn wc9 wn wv5 wv7 wi wn wi wv1 wv8 wv1 wi wc0 wn
+      wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi
+      wi wi wn wi wi wi wi wi wi wi wi wv9 wv9 wv9 wi wi wv7 wv2 wi wv1 wv6 wi
+      wi wv0 wv3 wi wv4 wi wc7 wv5 wi wv8 wv1 wi wi wi wv7 wv2 wi wv1 wv6 wi wi
+      wv7 wn wc9 wn wv5 wv7 wi wn wi wv1 wv8 wv1 wi wc0 wn wc2 wn wi wv1 wc1 wi
+      wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi wn wi wi wi wi
+      wi wi wi wi wi wv0 wv3 wi wv4 wi wc7 wv5 wi wv8 wv1 wi wi wi wv7 wv2 wi
+      wv1 wv6 wi wi wv7 wn wc9 wn wv5 wv7 wi wn wi wv1 wv8 wv1 wi wc0 wn wc2 wn
+      wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi
+      wn wi wi wi wi wi wi wi wv7 wv2 wi wv1 wv6 wi wi wv0 wv3 wi wv4 wi wc7
+      wv5 wi wv8 wv1 wi wi wi wv7 wv2 wi wv1 wv6 wi wi wv7 wn wc9 wn wv5 wv7 wi
+      wn wi wv1 wv8 wv1 wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6
+      wi wi wv8 wv1 wi wv8 wv1 wi wi wi wn wi wi wi wi wi wi wi wi wv7 wv2 wi
+      wv1 wv6 wi wi wv7 wn wc9 wn wv5 wv7 wi wn wi wv1 wv8 wv1 wi wc0 wn wc2 wn
+      wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi
+      wn wi wi wi wi wi wi wv0 wv3 wi wv4 wi wc7 wv5 wi wv8 wv1 wi wi wi wv7
+      wv2 wi wv1 wv6 wi wi wv7 wn wc9 wn wv5 wv7 wi wn wi wv1 wv8 wv1 wi wc0 wn
+      wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi
+      wi wi wn wi wi wi wi wi wi wi wv7 wn wc9 wn wv5 wv7 wi wn wi wv1 wv8 wv1
+      wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi
+      wv8 wv1 wi wi wi wn wi wi wi wi wi wv7 wv2 wi wv1 wv6 wi wi wv7 wn wc9 wn
+      wv5 wv7 wi wn wi wv1 wv8 wv1 wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6
+      wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi wn wi wi wi wi wi wi wc9 wn
+      wv5 wv7 wi wn wi wv1 wv8 wv1 wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6
+      wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi wn wi wi wi wi wv7 wn wc9 wn
+      wv5 wv7 wi wn wi wv1 wv8 wv1 wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6
+      wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi wn wi wi wi wi wi wv1 wv8
+      wv1 wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1
+      wi wv8 wv1 wi wi wi wn wi wi wi wc9 wn wv5 wv7 wi wn wi wv1 wv8 wv1 wi
+      wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8
+      wv1 wi wi wi wn wi wi wi wi wv8 wv1 wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi
+      wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi wn wi wi wv1 wv8 wv1
+      wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi
+      wv8 wv1 wi wi wi wn wi wi wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi
+      wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi wn wi wv8 wv1 wi wc0 wn wc2 wn
+      wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi
+      wn wi wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi wn wc0 wn
+      wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi
+      wi wi wn wi wv3 wc6 wi wv8 wv1 wi wv3 wc6 wi ax-g8 wv3 wc6 wi wv3 wc6 wi
+      wi wv8 wv1 wi wv8 wv1 wi wi wi wn wc0 wn wc2 wn wi wv1 wc1 wi wn wi ax-1
+      ax-mp wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1
+      wi wv8 wv1 wi wi wi wn wi wv8 wv1 wi ax-1 ax-mp wv8 wv1 wi wc0 wn wc2 wn
+      wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi
+      wn wi wi wv1 ax-1 ax-mp wv1 wv8 wv1 wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi
+      wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi wn wi wi wi wc9 wn
+      wv5 wv7 wi wn wi ax-1 ax-mp wc9 wn wv5 wv7 wi wn wi wv1 wv8 wv1 wi wc0 wn
+      wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi
+      wi wi wn wi wi wi wi wv7 wn ax-1 ax-mp wv7 wn wc9 wn wv5 wv7 wi wn wi wv1
+      wv8 wv1 wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8
+      wv1 wi wv8 wv1 wi wi wi wn wi wi wi wi wi wv7 wv2 wi wv1 wv6 wi wi ax-1
+      ax-mp wv7 wv2 wi wv1 wv6 wi wi wv7 wn wc9 wn wv5 wv7 wi wn wi wv1 wv8 wv1
+      wi wc0 wn wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi
+      wv8 wv1 wi wi wi wn wi wi wi wi wi wi wv0 wv3 wi wv4 wi wc7 wv5 wi wv8
+      wv1 wi wi wi ax-1 ax-mp wv0 wv3 wi wv4 wi wc7 wv5 wi wv8 wv1 wi wi wi wv7
+      wv2 wi wv1 wv6 wi wi wv7 wn wc9 wn wv5 wv7 wi wn wi wv1 wv8 wv1 wi wc0 wn
+      wc2 wn wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi
+      wi wi wn wi wi wi wi wi wi wi wv7 wv2 wi wv1 wv6 wi wi ax-1 ax-mp wv7 wv2
+      wi wv1 wv6 wi wi wv0 wv3 wi wv4 wi wc7 wv5 wi wv8 wv1 wi wi wi wv7 wv2 wi
+      wv1 wv6 wi wi wv7 wn wc9 wn wv5 wv7 wi wn wi wv1 wv8 wv1 wi wc0 wn wc2 wn
+      wi wv1 wc1 wi wn wi wv3 wc6 wi wv3 wc6 wi wi wv8 wv1 wi wv8 wv1 wi wi wi
+      wn wi wi wi wi wi wi wi wi wv9 wv9 wv9 wi wi ax-1 ax-mp ax-mp $.
+  th215 $p |- ( v9 -> ( ( ( -. v6 -> ( v7 -> c7 ) ) -> ( -. v8 -> v3 ) ) -> ( v6 -> ( v0 -> ( v9 -> ( ( ( ( v5 -> c7 ) -> ( v4 -> v8 ) ) -> ( ( v1 -> c0 ) -> -. v0 ) ) -> ( -. ( ( v9 -> v6 ) -> c1 ) -> ( v6 -> ( ( v1 -> v8 ) -> ( c2 -> ( ( ( ( v1 -> c6 ) -> -. v3 ) -> v6 ) -> ( c2 -> -. ( v1 -> v8 ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv2 wv2 wv2 wi wi wv9 wv6 wn wv7 wc7 wi wi wv8 wn wv3 wi wi wv6 wv0 wv9
+      wv5 wc7 wi wv4 wv8 wi wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1 wi wn wv6
+      wv1 wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi
+      wi wi wi wi wi wi wi wi wv2 wv2 ax-1 wv9 wv6 wn wv7 wc7 wi wi wv8 wn wv3
+      wi wi wv6 wv0 wv9 wv5 wc7 wi wv4 wv8 wi wi wv1 wc0 wi wv0 wn wi wi wv9
+      wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1
+      wv8 wi wn wi wi wi wi wi wi wi wi wi wi wi wi wv2 wv2 wv2 wi wi wv9 wv6
+      wn wv7 wc7 wi wi wv8 wn wv3 wi wi wv6 wv0 wv9 wv5 wc7 wi wv4 wv8 wi wi
+      wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1 wc6
+      wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi wi wi wi wi wi wi wi
+      wi wv6 wn wv7 wc7 wi wi wv8 wn wv3 wi wi wv6 wv0 wv9 wv5 wc7 wi wv4 wv8
+      wi wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1
+      wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi wi wi wi wi wi
+      wi wv9 wv6 wn wv7 wc7 wi wi wv8 wn wv3 wi wi wv6 wv0 wv9 wv5 wc7 wi wv4
+      wv8 wi wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2
+      wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi wi wi wi wi
+      wi wi wi wv6 wv0 wv9 wv5 wc7 wi wv4 wv8 wi wi wv1 wc0 wi wv0 wn wi wi wv9
+      wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1
+      wv8 wi wn wi wi wi wi wi wi wi wi wi wi wv6 wn wv7 wc7 wi wi wv8 wn wv3
+      wi wi wv6 wv0 wv9 wv5 wc7 wi wv4 wv8 wi wi wv1 wc0 wi wv0 wn wi wi wv9
+      wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1
+      wv8 wi wn wi wi wi wi wi wi wi wi wi wi wi wv0 wv9 wv5 wc7 wi wv4 wv8 wi
+      wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1
+      wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi wi wi wi wi wv6
+      wv0 wv9 wv5 wc7 wi wv4 wv8 wi wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1
+      wi wn wv6 wv1 wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi
+      wi wi wi wi wi wi wi wi wi wv9 wv5 wc7 wi wv4 wv8 wi wi wv1 wc0 wi wv0 wn
+      wi wi wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi
+      wc2 wv1 wv8 wi wn wi wi wi wi wi wi wi wi wv0 wv9 wv5 wc7 wi wv4 wv8 wi
+      wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1
+      wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi wi wi wi wi wv5
+      wc7 wi wv4 wv8 wi wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1 wi wn wv6 wv1
+      wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi
+      wi wi wv9 wv5 wc7 wi wv4 wv8 wi wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1
+      wi wn wv6 wv1 wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi
+      wi wi wi wi wi wi wi wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1 wc6 wi
+      wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi wi wv5 wc7 wi wv4 wv8
+      wi wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1
+      wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi wi wi wv6 wv1
+      wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi
+      wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2
+      wv1 wv8 wi wn wi wi wi wi wi wi wv6 wv3 wv1 wv6 wv8 th143 wv6 wv1 wv8 wi
+      wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi wv9 wv6
+      wi wc1 wi wn ax-1 ax-mp wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1 wc6
+      wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi wi wv5 wc7 wi wv4
+      wv8 wi wi wv1 wc0 wi wv0 wn wi wi ax-1 ax-mp wv5 wc7 wi wv4 wv8 wi wi wv1
+      wc0 wi wv0 wn wi wi wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1 wc6 wi
+      wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi wi wi wv9 ax-1 ax-mp
+      wv9 wv5 wc7 wi wv4 wv8 wi wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1 wi wn
+      wv6 wv1 wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi
+      wi wi wi wi wi wv0 ax-1 ax-mp wv0 wv9 wv5 wc7 wi wv4 wv8 wi wi wv1 wc0 wi
+      wv0 wn wi wi wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2 wv1 wc6 wi wv3 wn wi
+      wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi wi wi wi wi wv6 ax-1 ax-mp wv6
+      wv0 wv9 wv5 wc7 wi wv4 wv8 wi wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1
+      wi wn wv6 wv1 wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi
+      wi wi wi wi wi wi wi wi wi wv6 wn wv7 wc7 wi wi wv8 wn wv3 wi wi ax-1
+      ax-mp wv6 wn wv7 wc7 wi wi wv8 wn wv3 wi wi wv6 wv0 wv9 wv5 wc7 wi wv4
+      wv8 wi wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1 wi wn wv6 wv1 wv8 wi wc2
+      wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi wi wi wi wi wi wi
+      wi wi wv9 ax-1 ax-mp wv9 wv6 wn wv7 wc7 wi wi wv8 wn wv3 wi wi wv6 wv0
+      wv9 wv5 wc7 wi wv4 wv8 wi wi wv1 wc0 wi wv0 wn wi wi wv9 wv6 wi wc1 wi wn
+      wv6 wv1 wv8 wi wc2 wv1 wc6 wi wv3 wn wi wv6 wi wc2 wv1 wv8 wi wn wi wi wi
+      wi wi wi wi wi wi wi wi wi wv2 wv2 wv2 wi wi ax-1 ax-mp ax-mp $.
+  th216 $p |- ( ( v7 -> v6 ) -> ( ( c4 -> v0 ) -> ( ( ( v8 -> v2 ) -> ( c4 -> v0 ) ) -> -. ( ( v8 -> v2 ) -> ( c0 -> v3 ) ) ) ) ) $=
+      wc4 wv0 wi wv8 wv2 wi wc4 wv0 wi wi wv8 wv2 wi wc0 wv3 wi wi wn wi wi wv7
+      wv6 wi wc4 wv0 wi wv8 wv2 wi wc4 wv0 wi wi wv8 wv2 wi wc0 wv3 wi wi wn wi
+      wi wi wv8 wv2 wi wc4 wv0 wi wi wv8 wv2 wi wc0 wv3 wi wi wn wi wc4 wv0 wi
+      wv8 wv2 wi wc4 wv0 wi wi wv8 wv2 wi wc0 wv3 wi wi wn wi wi wv8 wv2 wi wc0
+      wv3 wi wc4 wv0 wi wv8 wv2 wi ax-g0 wv8 wv2 wi wc4 wv0 wi wi wv8 wv2 wi
+      wc0 wv3 wi wi wn wi wc4 wv0 wi ax-1 ax-mp wc4 wv0 wi wv8 wv2 wi wc4 wv0
+      wi wi wv8 wv2 wi wc0 wv3 wi wi wn wi wi wv7 wv6 wi ax-1 ax-mp $.
+  th217 $p |- ( -. ( ( v8 -> v3 ) -> -. v3 ) -> ( ( v9 -> -. c7 ) -> ( c6 -> ( ( v9 -> -. c7 ) -> ( c8 -> ( ( v9 -> -. c7 ) -> ( c6 -> ( -. ( c8 -> c8 ) -> -. ( c8 -> c8 ) ) ) ) ) ) ) ) ) $=
+      wv9 wc7 wn wi wc6 wv9 wc7 wn wi wc8 wv9 wc7 wn wi wc6 wc8 wc8 wi wn wc8
+      wc8 wi wn wi wi wi wi wi wi wi wv8 wv3 wi wv3 wn wi wn wv9 wc7 wn wi wc6
+      wv9 wc7 wn wi wc8 wv9 wc7 wn wi wc6 wc8 wc8 wi wn wc8 wc8 wi wn wi wi wi
+      wi wi wi wi wi wc8 wv9 wc8 wc7 th22 wv9 wc7 wn wi wc6 wv9 wc7 wn wi wc8
+      wv9 wc7 wn wi wc6 wc8 wc8 wi wn wc8 wc8 wi wn wi wi wi wi wi wi wi wv8
+      wv3 wi wv3 wn wi wn ax-1 ax-mp $.
+  th218 $p |- ( ( ( -. v5 -> ( v9 -> v8 ) ) -> -. v9 ) -> ( ( v8 -> v1 ) -> ( c4 -> ( ( ( ( v3 -> v5 ) -> v7 ) -> v9 ) -> ( c7 -> ( ( c7 -> ( v8 -> v1 ) ) -> -. ( ( v8 -> v1 ) -> ( v8 -> v1 ) ) ) ) ) ) ) ) $=
+      wv8 wv1 wi wc4 wv3 wv5 wi wv7 wi wv9 wi wc7 wc7 wv8 wv1 wi wi wv8 wv1 wi
+      wv8 wv1 wi wi wn wi wi wi wi wi wv5 wn wv9 wv8 wi wi wv9 wn wi wv8 wv1 wi
+      wc4 wv3 wv5 wi wv7 wi wv9 wi wc7 wc7 wv8 wv1 wi wi wv8 wv1 wi wv8 wv1 wi
+      wi wn wi wi wi wi wi wi wc4 wv3 wv5 wi wv7 wi wv9 wi wc7 wc7 wv8 wv1 wi
+      wi wv8 wv1 wi wv8 wv1 wi wi wn wi wi wi wi wv8 wv1 wi wc4 wv3 wv5 wi wv7
+      wi wv9 wi wc7 wc7 wv8 wv1 wi wi wv8 wv1 wi wv8 wv1 wi wi wn wi wi wi wi
+      wi wv3 wv5 wi wv7 wi wv9 wi wc7 wc7 wv8 wv1 wi wi wv8 wv1 wi wv8 wv1 wi
+      wi wn wi wi wi wc4 wv3 wv5 wi wv7 wi wv9 wi wc7 wc7 wv8 wv1 wi wi wv8 wv1
+      wi wv8 wv1 wi wi wn wi wi wi wi wc7 wc7 wv8 wv1 wi wi wv8 wv1 wi wv8 wv1
+      wi wi wn wi wi wv3 wv5 wi wv7 wi wv9 wi wc7 wc7 wv8 wv1 wi wi wv8 wv1 wi
+      wv8 wv1 wi wi wn wi wi wi wc7 wv8 wv1 wi wi wv8 wv1 wi wv8 wv1 wi wi wn
+      wi wc7 wc7 wv8 wv1 wi wi wv8 wv1 wi wv8 wv1 wi wi wn wi wi wv8 wv1 wi wv8
+      wv1 wi wv8 wv1 wi wc7 ax-g0 wc7 wv8 wv1 wi wi wv8 wv1 wi wv8 wv1 wi wi wn
+      wi wc7 ax-1 ax-mp wc7 wc7 wv8 wv1 wi wi wv8 wv1 wi wv8 wv1 wi wi wn wi wi
+      wv3 wv5 wi wv7 wi wv9 wi ax-1 ax-mp wv3 wv5 wi wv7 wi wv9 wi wc7 wc7 wv8
+      wv1 wi wi wv8 wv1 wi wv8 wv1 wi wi wn wi wi wi wc4 ax-1 ax-mp wc4 wv3 wv5
+      wi wv7 wi wv9 wi wc7 wc7 wv8 wv1 wi wi wv8 wv1 wi wv8 wv1 wi wi wn wi wi
+      wi wi wv8 wv1 wi ax-1 ax-mp wv8 wv1 wi wc4 wv3 wv5 wi wv7 wi wv9 wi wc7
+      wc7 wv8 wv1 wi wi wv8 wv1 wi wv8 wv1 wi wi wn wi wi wi wi wi wv5 wn wv9
+      wv8 wi wi wv9 wn wi ax-1 ax-mp $.
+  ${
+    $d v5 v8 $.
+    th219 $p |- ( v4 -> ( v4 -> ( ( v3 -> ( ( v3 -> v1 ) -> ( c0 -> v0 ) ) ) -> ( v8 -> ( ( ( ( c1 -> c6 ) -> c5 ) -> ( ( v4 -> v0 ) -> ( v9 -> v8 ) ) ) -> ( -. ( -. v5 -> v8 ) -> ( v2 -> v9 ) ) ) ) ) ) ) $=
+      ( wi wc0 wc1 wc6 wc5 wn ax-g1 ax-1 ax-mp ) EDDBIJAIIIZGKLIMIEAIHGIIIZFNZG
+      INCHIZIZIZIZIZIZEUFIUEUFUDUEUCUDUBUCGUATOUBSPQUCGPQUDRPQUEEPQUFEPQ $.
+  $}
+  th220 $p |- ( v6 -> ( ( ( ( v2 -> v1 ) -> c9 ) -> v0 ) -> ( v7 -> ( ( v6 -> v2 ) -> ( ( v6 -> v2 ) -> -. ( ( ( v4 -> v5 ) -> ( v6 -> v2 ) ) -> ( ( v3 -> v9 ) -> ( v3 -> v9 ) ) ) ) ) ) ) ) $=
+      wv2 wv1 wi wc9 wi wv0 wi wv7 wv6 wv2 wi wv6 wv2 wi wv4 wv5 wi wv6 wv2 wi
+      wi wv3 wv9 wi wv3 wv9 wi wi wi wn wi wi wi wi wv6 wv2 wv1 wi wc9 wi wv0
+      wi wv7 wv6 wv2 wi wv6 wv2 wi wv4 wv5 wi wv6 wv2 wi wi wv3 wv9 wi wv3 wv9
+      wi wi wi wn wi wi wi wi wi wv7 wv6 wv2 wi wv6 wv2 wi wv4 wv5 wi wv6 wv2
+      wi wi wv3 wv9 wi wv3 wv9 wi wi wi wn wi wi wi wv2 wv1 wi wc9 wi wv0 wi
+      wv7 wv6 wv2 wi wv6 wv2 wi wv4 wv5 wi wv6 wv2 wi wi wv3 wv9 wi wv3 wv9 wi
+      wi wi wn wi wi wi wi wv6 wv2 wi wv6 wv2 wi wv4 wv5 wi wv6 wv2 wi wi wv3
+      wv9 wi wv3 wv9 wi wi wi wn wi wi wv7 wv6 wv2 wi wv6 wv2 wi wv4 wv5 wi wv6
+      wv2 wi wi wv3 wv9 wi wv3 wv9 wi wi wi wn wi wi wi wv6 wv2 wi wv4 wv5 wi
+      wv6 wv2 wi wi wv3 wv9 wi wv3 wv9 wi wi wi wn wi wv6 wv2 wi wv6 wv2 wi wv4
+      wv5 wi wv6 wv2 wi wi wv3 wv9 wi wv3 wv9 wi wi wi wn wi wi wv4 wv5 wi wv6
+      wv2 wi wi wv3 wv9 wi wv3 wv9 wi wi wi wn wv6 wv2 wi wv4 wv5 wi wv6 wv2 wi
+      wi wv3 wv9 wi wv3 wv9 wi wi wi wn wi wv4 wv5 wi wv3 wv9 wi wv6 wv2 wi
+      ax-g8 wv4 wv5 wi wv6 wv2 wi wi wv3 wv9 wi wv3 wv9 wi wi wi wn wv6 wv2 wi
+      ax-1 ax-mp wv6 wv2 wi wv4 wv5 wi wv6 wv2 wi wi wv3 wv9 wi wv3 wv9 wi wi
+      wi wn wi wv6 wv2 wi ax-1 ax-mp wv6 wv2 wi wv6 wv2 wi wv4 wv5 wi wv6 wv2
+      wi wi wv3 wv9 wi wv3 wv9 wi wi wi wn wi wi wv7 ax-1 ax-mp wv7 wv6 wv2 wi
+      wv6 wv2 wi wv4 wv5 wi wv6 wv2 wi wi wv3 wv9 wi wv3 wv9 wi wi wi wn wi wi
+      wi wv2 wv1 wi wc9 wi wv0 wi ax-1 ax-mp wv2 wv1 wi wc9 wi wv0 wi wv7 wv6
+      wv2 wi wv6 wv2 wi wv4 wv5 wi wv6 wv2 wi wi wv3 wv9 wi wv3 wv9 wi wi wi wn
+      wi wi wi wi wv6 ax-1 ax-mp $.
+  th221 $p |- ( -. c9 -> ( v4 -> ( ( v5 -> v4 ) -> ( ( ( v7 -> ( v8 -> c0 ) ) -> v7 ) -> ( ( -. ( v0 -> c1 ) -> -. ( v2 -> v1 ) ) -> ( ( -. ( v0 -> c1 ) -> -. ( v2 -> v1 ) ) -> ( c2 -> ( ( ( v5 -> v4 ) -> ( ( v5 -> v4 ) -> c8 ) ) -> ( ( ( v5 -> v4 ) -> ( v5 -> v4 ) ) -> ( ( v5 -> v4 ) -> c8 ) ) ) ) ) ) ) ) ) ) $=
+      wv4 wv5 wv4 wi wv7 wv8 wc0 wi wi wv7 wi wv0 wc1 wi wn wv2 wv1 wi wn wi
+      wv0 wc1 wi wn wv2 wv1 wi wn wi wc2 wv5 wv4 wi wv5 wv4 wi wc8 wi wi wv5
+      wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi wi wi wi wi wi wi wc9 wn wv4
+      wv5 wv4 wi wv7 wv8 wc0 wi wi wv7 wi wv0 wc1 wi wn wv2 wv1 wi wn wi wv0
+      wc1 wi wn wv2 wv1 wi wn wi wc2 wv5 wv4 wi wv5 wv4 wi wc8 wi wi wv5 wv4 wi
+      wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi wi wi wi wi wi wi wi wv5 wv4 wi wv7
+      wv8 wc0 wi wi wv7 wi wv0 wc1 wi wn wv2 wv1 wi wn wi wv0 wc1 wi wn wv2 wv1
+      wi wn wi wc2 wv5 wv4 wi wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5
+      wv4 wi wc8 wi wi wi wi wi wi wi wi wv4 wv5 wv4 wi wv7 wv8 wc0 wi wi wv7
+      wi wv0 wc1 wi wn wv2 wv1 wi wn wi wv0 wc1 wi wn wv2 wv1 wi wn wi wc2 wv5
+      wv4 wi wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi
+      wi wi wi wi wi wi wi wv7 wv8 wc0 wi wi wv7 wi wv0 wc1 wi wn wv2 wv1 wi wn
+      wi wv0 wc1 wi wn wv2 wv1 wi wn wi wc2 wv5 wv4 wi wv5 wv4 wi wc8 wi wi wv5
+      wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi wi wi wi wi wv5 wv4 wi wv7
+      wv8 wc0 wi wi wv7 wi wv0 wc1 wi wn wv2 wv1 wi wn wi wv0 wc1 wi wn wv2 wv1
+      wi wn wi wc2 wv5 wv4 wi wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5
+      wv4 wi wc8 wi wi wi wi wi wi wi wi wv0 wc1 wi wn wv2 wv1 wi wn wi wv0 wc1
+      wi wn wv2 wv1 wi wn wi wc2 wv5 wv4 wi wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5
+      wv4 wi wi wv5 wv4 wi wc8 wi wi wi wi wi wi wv7 wv8 wc0 wi wi wv7 wi wv0
+      wc1 wi wn wv2 wv1 wi wn wi wv0 wc1 wi wn wv2 wv1 wi wn wi wc2 wv5 wv4 wi
+      wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi wi
+      wi wi wi wv0 wc1 wi wn wv2 wv1 wi wn wi wc2 wv5 wv4 wi wv5 wv4 wi wc8 wi
+      wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi wi wi wv0 wc1 wi wn
+      wv2 wv1 wi wn wi wv0 wc1 wi wn wv2 wv1 wi wn wi wc2 wv5 wv4 wi wv5 wv4 wi
+      wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi wi wi wi wc2
+      wv5 wv4 wi wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8
+      wi wi wi wi wv0 wc1 wi wn wv2 wv1 wi wn wi wc2 wv5 wv4 wi wv5 wv4 wi wc8
+      wi wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi wi wi wv5 wv4 wi
+      wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi wc2
+      wv5 wv4 wi wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8
+      wi wi wi wi wv5 wv4 wi wv5 wv4 wi wc8 ax-2 wv5 wv4 wi wv5 wv4 wi wc8 wi
+      wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi wc2 ax-1 ax-mp wc2
+      wv5 wv4 wi wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8
+      wi wi wi wi wv0 wc1 wi wn wv2 wv1 wi wn wi ax-1 ax-mp wv0 wc1 wi wn wv2
+      wv1 wi wn wi wc2 wv5 wv4 wi wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi
+      wv5 wv4 wi wc8 wi wi wi wi wi wv0 wc1 wi wn wv2 wv1 wi wn wi ax-1 ax-mp
+      wv0 wc1 wi wn wv2 wv1 wi wn wi wv0 wc1 wi wn wv2 wv1 wi wn wi wc2 wv5 wv4
+      wi wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi
+      wi wi wi wv7 wv8 wc0 wi wi wv7 wi ax-1 ax-mp wv7 wv8 wc0 wi wi wv7 wi wv0
+      wc1 wi wn wv2 wv1 wi wn wi wv0 wc1 wi wn wv2 wv1 wi wn wi wc2 wv5 wv4 wi
+      wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi wi
+      wi wi wi wv5 wv4 wi ax-1 ax-mp wv5 wv4 wi wv7 wv8 wc0 wi wi wv7 wi wv0
+      wc1 wi wn wv2 wv1 wi wn wi wv0 wc1 wi wn wv2 wv1 wi wn wi wc2 wv5 wv4 wi
+      wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi wi
+      wi wi wi wi wv4 ax-1 ax-mp wv4 wv5 wv4 wi wv7 wv8 wc0 wi wi wv7 wi wv0
+      wc1 wi wn wv2 wv1 wi wn wi wv0 wc1 wi wn wv2 wv1 wi wn wi wc2 wv5 wv4 wi
+      wv5 wv4 wi wc8 wi wi wv5 wv4 wi wv5 wv4 wi wi wv5 wv4 wi wc8 wi wi wi wi
+      wi wi wi wi wi wc9 wn ax-1 ax-mp $.
+  th222 $p |- ( ( ( ( v6 -> v7 ) -> v9 ) -> ( ( v3 -> c2 ) -> -. v2 ) ) -> ( ( ( -. v8 -> ( v1 -> v6 ) ) -> v1 ) -> ( c4 -> ( c5 -> ( ( ( ( v7 -> v8 ) -> ( c6 -> c4 ) ) -> ( c5 -> v6 ) ) -> -. ( ( ( v9 -> v4 ) -> c5 ) -> ( ( v4 -> v7 ) -> ( v4 -> v7 ) ) ) ) ) ) ) ) $=
+      wv8 wn wv1 wv6 wi wi wv1 wi wc4 wc5 wv7 wv8 wi wc6 wc4 wi wi wc5 wv6 wi
+      wi wv9 wv4 wi wc5 wi wv4 wv7 wi wv4 wv7 wi wi wi wn wi wi wi wi wv6 wv7
+      wi wv9 wi wv3 wc2 wi wv2 wn wi wi wv8 wn wv1 wv6 wi wi wv1 wi wc4 wc5 wv7
+      wv8 wi wc6 wc4 wi wi wc5 wv6 wi wi wv9 wv4 wi wc5 wi wv4 wv7 wi wv4 wv7
+      wi wi wi wn wi wi wi wi wi wc4 wc5 wv7 wv8 wi wc6 wc4 wi wi wc5 wv6 wi wi
+      wv9 wv4 wi wc5 wi wv4 wv7 wi wv4 wv7 wi wi wi wn wi wi wi wv8 wn wv1 wv6
+      wi wi wv1 wi wc4 wc5 wv7 wv8 wi wc6 wc4 wi wi wc5 wv6 wi wi wv9 wv4 wi
+      wc5 wi wv4 wv7 wi wv4 wv7 wi wi wi wn wi wi wi wi wc5 wv7 wv8 wi wc6 wc4
+      wi wi wc5 wv6 wi wi wv9 wv4 wi wc5 wi wv4 wv7 wi wv4 wv7 wi wi wi wn wi
+      wi wc4 wc5 wv7 wv8 wi wc6 wc4 wi wi wc5 wv6 wi wi wv9 wv4 wi wc5 wi wv4
+      wv7 wi wv4 wv7 wi wi wi wn wi wi wi wv7 wv8 wi wc6 wc4 wi wi wc5 wv6 wi
+      wi wv9 wv4 wi wc5 wi wv4 wv7 wi wv4 wv7 wi wi wi wn wi wc5 wv7 wv8 wi wc6
+      wc4 wi wi wc5 wv6 wi wi wv9 wv4 wi wc5 wi wv4 wv7 wi wv4 wv7 wi wi wi wn
+      wi wi wv9 wv4 wi wc5 wi wv4 wv7 wi wv4 wv7 wi wi wi wn wv7 wv8 wi wc6 wc4
+      wi wi wc5 wv6 wi wi wv9 wv4 wi wc5 wi wv4 wv7 wi wv4 wv7 wi wi wi wn wi
+      wv9 wv4 wi wv4 wv7 wi wc5 ax-g8 wv9 wv4 wi wc5 wi wv4 wv7 wi wv4 wv7 wi
+      wi wi wn wv7 wv8 wi wc6 wc4 wi wi wc5 wv6 wi wi ax-1 ax-mp wv7 wv8 wi wc6
+      wc4 wi wi wc5 wv6 wi wi wv9 wv4 wi wc5 wi wv4 wv7 wi wv4 wv7 wi wi wi wn
+      wi wc5 ax-1 ax-mp wc5 wv7 wv8 wi wc6 wc4 wi wi wc5 wv6 wi wi wv9 wv4 wi
+      wc5 wi wv4 wv7 wi wv4 wv7 wi wi wi wn wi wi wc4 ax-1 ax-mp wc4 wc5 wv7
+      wv8 wi wc6 wc4 wi wi wc5 wv6 wi wi wv9 wv4 wi wc5 wi wv4 wv7 wi wv4 wv7
+      wi wi wi wn wi wi wi wv8 wn wv1 wv6 wi wi wv1 wi ax-1 ax-mp wv8 wn wv1
+      wv6 wi wi wv1 wi wc4 wc5 wv7 wv8 wi wc6 wc4 wi wi wc5 wv6 wi wi wv9 wv4
+      wi wc5 wi wv4 wv7 wi wv4 wv7 wi wi wi wn wi wi wi wi wv6 wv7 wi wv9 wi
+      wv3 wc2 wi wv2 wn wi wi ax-1 ax-mp $.
+  th223 $p |- ( c5 -> ( ( ( ( c4 -> c2 ) -> c2 ) -> c8 ) -> ( ( ( v7 -> ( v7 -> v7 ) ) -> ( v6 -> ( v8 -> v4 ) ) ) -> ( ( -. ( v4 -> v5 ) -> v1 ) -> ( ( ( v9 -> -. c5 ) -> v8 ) -> ( ( ( v9 -> -. c5 ) -> v8 ) -> ( ( ( v9 -> -. c5 ) -> v8 ) -> ( ( -. ( v4 -> v5 ) -> v1 ) -> ( ( -. c7 -> -. ( v5 -> c9 ) ) -> ( ( v5 -> c9 ) -> c7 ) ) ) ) ) ) ) ) ) ) $=
+      ( wv3 wi wc5 wc4 wc2 wc8 wn wc7 wc9 ax-1 ax-3 ax-mp ) HHHIIZJKLILIMIZEEEI
+      IDFBIIIZBCINAIZGJNIFIZUDUDUCONCPIZNIUEOIIZIZIZIZIZIZIZIZIZHHQUNTUNIUMUNUL
+      UMUKULUJUKUIUJUHUIUGUHUFUGOUERUFUCQSUGUDQSUHUDQSUIUDQSUJUCQSUKUBQSULUAQSU
+      MJQSUNTQSS $.
+  th224 $p |- ( ( ( v6 -> -. v4 ) -> ( ( v4 -> v0 ) -> ( v2 -> v5 ) ) ) -> ( -. c0 -> ( ( ( c8 -> v7 ) -> c0 ) -> -. ( ( c6 -> c1 ) -> ( v0 -> c9 ) ) ) ) ) $=
+      ( wc0 wn wc8 wi wc6 wc1 wc9 ax-g0 ax-1 ax-mp ) GHZIFJZGJKLJZAMJZJHJZJZECH
+      JCAJBDJJJZUBJUAUBSTGRNUAQOPUBUCOP $.
+  th225 $p |- ( c9 -> ( c9 -> ( -. ( ( v9 -> v9 ) -> -. v6 ) -> -. ( ( v5 -> c2 ) -> c9 ) ) ) ) $=
+      ( wc9 wi wn wc2 ax-g3 ax-1 ax-mp ) DCCEZBFZEFAGEZDEFEZEZDOENODMKLHNDIJODI
+      J $.
+  th226 $p |- ( ( -. ( v2 -> c3 ) -> ( ( c6 -> v5 ) -> ( c3 -> v2 ) ) ) -> ( v0 -> ( -. -. ( v5 -> v8 ) -> ( ( ( ( v1 -> c3 ) -> ( v0 -> v6 ) ) -> ( ( v5 -> c4 ) -> ( v0 -> v7 ) ) ) -> ( ( -. ( c3 -> v2 ) -> c1 ) -> ( ( v0 -> ( ( v7 -> c1 ) -> v0 ) ) -> ( ( v0 -> ( v7 -> c1 ) ) -> ( v0 -> v0 ) ) ) ) ) ) ) ) $=
+      ( wi wn wc3 wc4 wc1 wc6 ax-2 ax-1 ax-mp ) ADGHIIZBJHAEHHDKHAFHHHZJCHILHZA
+      FLHZAHHATHAAHHHZHZHZHZHZCJHIMDHJCHHHZUEHUDUEUCUDUBUCUAUBATANUASOPUBROPUCQ
+      OPUDAOPUEUFOP $.
+  th227 $p |- ( ( ( ( v9 -> v7 ) -> ( v6 -> c0 ) ) -> ( v9 -> ( v2 -> v1 ) ) ) -> ( ( v1 -> c4 ) -> ( ( v1 -> c4 ) -> ( v1 -> c4 ) ) ) ) $=
+      ( wc4 wi wc0 ax-1 ax-mp ) AFGZKKGGZEDGCHGGEBAGGGZLGKKILMIJ $.
+  ${
+    $d v6 v9 $.
+    th228 $p |- ( v5 -> ( ( v1 -> ( ( v3 -> v9 ) -> -. v1 ) ) -> ( ( ( ( v9 -> v0 ) -> ( c1 -> c6 ) ) -> ( ( v8 -> c4 ) -> -. v1 ) ) -> ( ( -. -. v9 -> v5 ) -> ( ( v5 -> ( ( v9 -> v6 ) -> ( c7 -> v9 ) ) ) -> ( -. ( ( c6 -> v6 ) -> ( v6 -> v6 ) ) -> -. ( ( c3 -> c8 ) -> ( v9 -> c7 ) ) ) ) ) ) ) ) $=
+      ( wi wn wc1 wc6 wc4 wc7 wc3 wc8 th100 ax-1 ax-mp ) BCGHBIHHZGAHJKHHFLHBIH
+      HZGIIDHDGEHMGHHHKEHEEHHINOHGMHHIHHHZHZHZDUCHUBUCUAUBGGDEMPUATQRUBSQRUCDQR
+      $.
+  $}
+  th229 $p |- ( ( ( ( v1 -> v0 ) -> v7 ) -> ( ( v2 -> v9 ) -> c6 ) ) -> -. ( ( c5 -> ( c0 -> c9 ) ) -> ( ( c8 -> v8 ) -> ( c8 -> v8 ) ) ) ) $=
+      wc5 wc0 wc9 wi wi wc8 wv8 wi wc8 wv8 wi wi wi wn wv1 wv0 wi wv7 wi wv2
+      wv9 wi wc6 wi wi wc5 wc0 wc9 wi wi wc8 wv8 wi wc8 wv8 wi wi wi wn wi wc5
+      wc8 wv8 wi wc0 wc9 wi ax-g8 wc5 wc0 wc9 wi wi wc8 wv8 wi wc8 wv8 wi wi wi
+      wn wv1 wv0 wi wv7 wi wv2 wv9 wi wc6 wi wi ax-1 ax-mp $.
+  th230 $p |- ( ( ( ( v0 -> c3 ) -> ( v8 -> v5 ) ) -> -. -. v2 ) -> ( ( c6 -> ( ( c0 -> v4 ) -> ( v5 -> v7 ) ) ) -> ( ( c6 -> ( ( c0 -> v4 ) -> ( v5 -> v7 ) ) ) -> ( c9 -> ( ( c6 -> ( ( c0 -> v4 ) -> ( v5 -> v7 ) ) ) -> ( v7 -> ( c2 -> ( ( v3 -> ( ( v3 -> c0 ) -> ( v4 -> v7 ) ) ) -> ( ( ( ( c6 -> v4 ) -> ( c2 -> c5 ) ) -> ( ( v8 -> v3 ) -> c9 ) ) -> ( ( v4 -> ( ( c1 -> c5 ) -> -. c3 ) ) -> ( ( ( v1 -> ( c4 -> c4 ) ) -> v7 ) -> ( ( -. ( v2 -> c5 ) -> -. v1 ) -> ( v1 -> ( v2 -> c5 ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc6 wc0 wi wc9 wc2 wc5 wc1 wc3 wn wc4 th141 ax-1 ax-mp ) IJEKFGKKKZUBLU
+      BGMDDJKEGKKKIEKMNKKHDKLKKEONKPQKKBRRKKGKCNKQBQKBCNKKKKKKKKZKZKZKZKZKZAPKH
+      FKKCQQKZUHKUGUHUFUGUEUFUDUEUCUDHCGRBDNDESUCGTUAUDUBTUAUELTUAUFUBTUAUGUBTU
+      AUHUITUA $.
+  th231 $p |- ( ( v1 -> -. ( v6 -> c1 ) ) -> ( v4 -> v8 ) ) $=
+      wv4 wv8 wi wv1 wv6 wc1 wi wn wi wv4 wv8 wi wi wv4 wv8 wi ax-g4 wv4 wv8 wi
+      wv1 wv6 wc1 wi wn wi ax-1 ax-mp $.
+  th232 $p |- ( ( ( ( v1 -> v9 ) -> ( v4 -> v0 ) ) -> ( c2 -> ( c7 -> v9 ) ) ) -> ( c8 -> ( ( ( ( c0 -> v3 ) -> ( v0 -> v3 ) ) -> ( ( v4 -> v0 ) -> ( v7 -> c8 ) ) ) -> ( ( ( ( v2 -> v4 ) -> ( c0 -> c3 ) ) -> c6 ) -> -. ( ( ( v8 -> c9 ) -> ( v8 -> c9 ) ) -> ( c9 -> c9 ) ) ) ) ) ) $=
+      wc8 wc0 wv3 wi wv0 wv3 wi wi wv4 wv0 wi wv7 wc8 wi wi wi wv2 wv4 wi wc0
+      wc3 wi wi wc6 wi wv8 wc9 wi wv8 wc9 wi wi wc9 wc9 wi wi wn wi wi wi wv1
+      wv9 wi wv4 wv0 wi wi wc2 wc7 wv9 wi wi wi wc8 wc0 wv3 wi wv0 wv3 wi wi
+      wv4 wv0 wi wv7 wc8 wi wi wi wv2 wv4 wi wc0 wc3 wi wi wc6 wi wv8 wc9 wi
+      wv8 wc9 wi wi wc9 wc9 wi wi wn wi wi wi wi wc0 wv3 wi wv0 wv3 wi wi wv4
+      wv0 wi wv7 wc8 wi wi wi wv2 wv4 wi wc0 wc3 wi wi wc6 wi wv8 wc9 wi wv8
+      wc9 wi wi wc9 wc9 wi wi wn wi wi wc8 wc0 wv3 wi wv0 wv3 wi wi wv4 wv0 wi
+      wv7 wc8 wi wi wi wv2 wv4 wi wc0 wc3 wi wi wc6 wi wv8 wc9 wi wv8 wc9 wi wi
+      wc9 wc9 wi wi wn wi wi wi wv2 wv4 wi wc0 wc3 wi wi wc6 wi wv8 wc9 wi wv8
+      wc9 wi wi wc9 wc9 wi wi wn wi wc0 wv3 wi wv0 wv3 wi wi wv4 wv0 wi wv7 wc8
+      wi wi wi wv2 wv4 wi wc0 wc3 wi wi wc6 wi wv8 wc9 wi wv8 wc9 wi wi wc9 wc9
+      wi wi wn wi wi wv8 wc9 wi wv8 wc9 wi wi wc9 wc9 wi wi wn wv2 wv4 wi wc0
+      wc3 wi wi wc6 wi wv8 wc9 wi wv8 wc9 wi wi wc9 wc9 wi wi wn wi wv8 wc9 wi
+      wc9 wv8 wc9 wi ax-g8 wv8 wc9 wi wv8 wc9 wi wi wc9 wc9 wi wi wn wv2 wv4 wi
+      wc0 wc3 wi wi wc6 wi ax-1 ax-mp wv2 wv4 wi wc0 wc3 wi wi wc6 wi wv8 wc9
+      wi wv8 wc9 wi wi wc9 wc9 wi wi wn wi wc0 wv3 wi wv0 wv3 wi wi wv4 wv0 wi
+      wv7 wc8 wi wi wi ax-1 ax-mp wc0 wv3 wi wv0 wv3 wi wi wv4 wv0 wi wv7 wc8
+      wi wi wi wv2 wv4 wi wc0 wc3 wi wi wc6 wi wv8 wc9 wi wv8 wc9 wi wi wc9 wc9
+      wi wi wn wi wi wc8 ax-1 ax-mp wc8 wc0 wv3 wi wv0 wv3 wi wi wv4 wv0 wi wv7
+      wc8 wi wi wi wv2 wv4 wi wc0 wc3 wi wi wc6 wi wv8 wc9 wi wv8 wc9 wi wi wc9
+      wc9 wi wi wn wi wi wi wv1 wv9 wi wv4 wv0 wi wi wc2 wc7 wv9 wi wi wi ax-1
+      ax-mp $.
+  th233 $p |- ( v8 -> ( v0 -> ( ( ( ( c4 -> v3 ) -> v2 ) -> v3 ) -> ( ( v9 -> ( ( c6 -> v8 ) -> ( v7 -> c6 ) ) ) -> ( v3 -> ( v8 -> v3 ) ) ) ) ) ) $=
+      wv0 wc4 wv3 wi wv2 wi wv3 wi wv9 wc6 wv8 wi wv7 wc6 wi wi wi wv3 wv8 wv3
+      wi wi wi wi wi wv8 wv0 wc4 wv3 wi wv2 wi wv3 wi wv9 wc6 wv8 wi wv7 wc6 wi
+      wi wi wv3 wv8 wv3 wi wi wi wi wi wi wc4 wv3 wi wv2 wi wv3 wi wv9 wc6 wv8
+      wi wv7 wc6 wi wi wi wv3 wv8 wv3 wi wi wi wi wv0 wc4 wv3 wi wv2 wi wv3 wi
+      wv9 wc6 wv8 wi wv7 wc6 wi wi wi wv3 wv8 wv3 wi wi wi wi wi wv9 wc6 wv8 wi
+      wv7 wc6 wi wi wi wv3 wv8 wv3 wi wi wi wc4 wv3 wi wv2 wi wv3 wi wv9 wc6
+      wv8 wi wv7 wc6 wi wi wi wv3 wv8 wv3 wi wi wi wi wv3 wv8 wv3 wi wi wv9 wc6
+      wv8 wi wv7 wc6 wi wi wi wv3 wv8 wv3 wi wi wi wv8 wv3 wi wv3 wv8 wv3 wi wi
+      wv3 wv8 wv3 wi wv3 ax-g6 wv3 wv8 ax-1 ax-mp wv8 wv3 wi wv3 ax-1 ax-mp wv3
+      wv8 wv3 wi wi wv9 wc6 wv8 wi wv7 wc6 wi wi wi ax-1 ax-mp wv9 wc6 wv8 wi
+      wv7 wc6 wi wi wi wv3 wv8 wv3 wi wi wi wc4 wv3 wi wv2 wi wv3 wi ax-1 ax-mp
+      wc4 wv3 wi wv2 wi wv3 wi wv9 wc6 wv8 wi wv7 wc6 wi wi wi wv3 wv8 wv3 wi
+      wi wi wi wv0 ax-1 ax-mp wv0 wc4 wv3 wi wv2 wi wv3 wi wv9 wc6 wv8 wi wv7
+      wc6 wi wi wi wv3 wv8 wv3 wi wi wi wi wi wv8 ax-1 ax-mp $.
+  ${
+    $d v1 v7 $.
+    $d v4 v7 $.
+    th234 $p |- ( ( ( v0 -> ( v2 -> c1 ) ) -> ( ( v5 -> v6 ) -> ( v6 -> v6 ) ) ) -> ( ( ( ( v4 -> c5 ) -> ( v6 -> v4 ) ) -> ( ( v0 -> v1 ) -> -. v8 ) ) -> ( c9 -> ( ( c6 -> ( ( v5 -> c7 ) -> ( c8 -> v0 ) ) ) -> ( ( v6 -> ( ( v6 -> v6 ) -> c5 ) ) -> ( ( v1 -> v4 ) -> ( ( v6 -> c4 ) -> ( -. ( ( v7 -> c3 ) -> ( v1 -> v4 ) ) -> ( v6 -> c4 ) ) ) ) ) ) ) ) ) $=
+      wv4 wc5 wi wv6 wv4 wi wi wv0 wv1 wi wv8 wn wi wi wc9 wc6 wv5 wc7 wi wc8
+      wv0 wi wi wi wv6 wv6 wv6 wi wc5 wi wi wv1 wv4 wi wv6 wc4 wi wv7 wc3 wi
+      wv1 wv4 wi wi wn wv6 wc4 wi wi wi wi wi wi wi wi wv0 wv2 wc1 wi wi wv5
+      wv6 wi wv6 wv6 wi wi wi wv4 wc5 wi wv6 wv4 wi wi wv0 wv1 wi wv8 wn wi wi
+      wc9 wc6 wv5 wc7 wi wc8 wv0 wi wi wi wv6 wv6 wv6 wi wc5 wi wi wv1 wv4 wi
+      wv6 wc4 wi wv7 wc3 wi wv1 wv4 wi wi wn wv6 wc4 wi wi wi wi wi wi wi wi wi
+      wc9 wc6 wv5 wc7 wi wc8 wv0 wi wi wi wv6 wv6 wv6 wi wc5 wi wi wv1 wv4 wi
+      wv6 wc4 wi wv7 wc3 wi wv1 wv4 wi wi wn wv6 wc4 wi wi wi wi wi wi wi wv4
+      wc5 wi wv6 wv4 wi wi wv0 wv1 wi wv8 wn wi wi wc9 wc6 wv5 wc7 wi wc8 wv0
+      wi wi wi wv6 wv6 wv6 wi wc5 wi wi wv1 wv4 wi wv6 wc4 wi wv7 wc3 wi wv1
+      wv4 wi wi wn wv6 wc4 wi wi wi wi wi wi wi wi wc6 wv5 wc7 wi wc8 wv0 wi wi
+      wi wv6 wv6 wv6 wi wc5 wi wi wv1 wv4 wi wv6 wc4 wi wv7 wc3 wi wv1 wv4 wi
+      wi wn wv6 wc4 wi wi wi wi wi wi wc9 wc6 wv5 wc7 wi wc8 wv0 wi wi wi wv6
+      wv6 wv6 wi wc5 wi wi wv1 wv4 wi wv6 wc4 wi wv7 wc3 wi wv1 wv4 wi wi wn
+      wv6 wc4 wi wi wi wi wi wi wi wv6 wv6 wv6 wi wc5 wi wi wv1 wv4 wi wv6 wc4
+      wi wv7 wc3 wi wv1 wv4 wi wi wn wv6 wc4 wi wi wi wi wi wc6 wv5 wc7 wi wc8
+      wv0 wi wi wi wv6 wv6 wv6 wi wc5 wi wi wv1 wv4 wi wv6 wc4 wi wv7 wc3 wi
+      wv1 wv4 wi wi wn wv6 wc4 wi wi wi wi wi wi wv1 wv4 wi wv6 wc4 wi wv7 wc3
+      wi wv1 wv4 wi wi wn wv6 wc4 wi wi wi wi wv6 wv6 wv6 wi wc5 wi wi wv1 wv4
+      wi wv6 wc4 wi wv7 wc3 wi wv1 wv4 wi wi wn wv6 wc4 wi wi wi wi wi wv6 wc4
+      wi wv7 wc3 wi wv1 wv4 wi wi wn wv6 wc4 wi wi wi wv1 wv4 wi wv6 wc4 wi wv7
+      wc3 wi wv1 wv4 wi wi wn wv6 wc4 wi wi wi wi wv7 wc3 wi wv1 wv4 wi wi wn
+      wv6 wc4 wi wi wv6 wc4 wi wv7 wc3 wi wv1 wv4 wi wi wn wv6 wc4 wi wi wi wv1
+      wv4 wi wv6 wc4 wi wv7 wc3 wi ax-g1 wv7 wc3 wi wv1 wv4 wi wi wn wv6 wc4 wi
+      wi wv6 wc4 wi ax-1 ax-mp wv6 wc4 wi wv7 wc3 wi wv1 wv4 wi wi wn wv6 wc4
+      wi wi wi wv1 wv4 wi ax-1 ax-mp wv1 wv4 wi wv6 wc4 wi wv7 wc3 wi wv1 wv4
+      wi wi wn wv6 wc4 wi wi wi wi wv6 wv6 wv6 wi wc5 wi wi ax-1 ax-mp wv6 wv6
+      wv6 wi wc5 wi wi wv1 wv4 wi wv6 wc4 wi wv7 wc3 wi wv1 wv4 wi wi wn wv6
+      wc4 wi wi wi wi wi wc6 wv5 wc7 wi wc8 wv0 wi wi wi ax-1 ax-mp wc6 wv5 wc7
+      wi wc8 wv0 wi wi wi wv6 wv6 wv6 wi wc5 wi wi wv1 wv4 wi wv6 wc4 wi wv7
+      wc3 wi wv1 wv4 wi wi wn wv6 wc4 wi wi wi wi wi wi wc9 ax-1 ax-mp wc9 wc6
+      wv5 wc7 wi wc8 wv0 wi wi wi wv6 wv6 wv6 wi wc5 wi wi wv1 wv4 wi wv6 wc4
+      wi wv7 wc3 wi wv1 wv4 wi wi wn wv6 wc4 wi wi wi wi wi wi wi wv4 wc5 wi
+      wv6 wv4 wi wi wv0 wv1 wi wv8 wn wi wi ax-1 ax-mp wv4 wc5 wi wv6 wv4 wi wi
+      wv0 wv1 wi wv8 wn wi wi wc9 wc6 wv5 wc7 wi wc8 wv0 wi wi wi wv6 wv6 wv6
+      wi wc5 wi wi wv1 wv4 wi wv6 wc4 wi wv7 wc3 wi wv1 wv4 wi wi wn wv6 wc4 wi
+      wi wi wi wi wi wi wi wv0 wv2 wc1 wi wi wv5 wv6 wi wv6 wv6 wi wi wi ax-1
+      ax-mp $.
+  $}
+  th235 $p |- ( ( ( v5 -> ( c2 -> v4 ) ) -> -. ( v6 -> c2 ) ) -> ( c6 -> ( ( v2 -> ( -. v0 -> c2 ) ) -> ( ( ( v0 -> v3 ) -> c2 ) -> ( -. ( ( v4 -> c2 ) -> v1 ) -> ( c4 -> -. v7 ) ) ) ) ) ) $=
+      ( wc6 wn wc2 wi wc4 ax-g2 ax-1 ax-mp ) ICAJKLLZADLKLZEKLBLJZMHJZLZLZLZLZL
+      ZFKELLGKLJLZUELUDUEUCUDUBUCUAUBTUATNTMOPUASOPUBROPUCQOPUDIOPUEUFOP $.
+  th236 $p |- ( ( ( ( v8 -> c8 ) -> ( v1 -> v6 ) ) -> v9 ) -> ( ( ( ( v2 -> v1 ) -> c7 ) -> -. v0 ) -> ( ( v9 -> v0 ) -> ( ( ( ( c3 -> v8 ) -> c8 ) -> ( v8 -> ( c5 -> v8 ) ) ) -> ( ( ( v1 -> c3 ) -> ( ( c7 -> v2 ) -> ( v1 -> c3 ) ) ) -> ( ( ( v1 -> c3 ) -> ( c7 -> v2 ) ) -> ( ( v1 -> c3 ) -> ( v1 -> c3 ) ) ) ) ) ) ) ) $=
+      ( wi wc7 wn wc3 wc8 wc5 ax-2 ax-1 ax-mp ) CBGHGAIGZFAGZJEGKGELEGGGZBJGZHC
+      GZSGGSTGSSGGGZGZGZGZEKGBDGGFGZUDGUCUDUBUCUAUBSTSMUARNOUBQNOUCPNOUDUENO $.
+  th237 $p |- ( -. c1 -> ( v6 -> ( -. c1 -> ( v6 -> ( ( ( c0 -> ( v8 -> c7 ) ) -> v4 ) -> ( ( ( c0 -> v9 ) -> ( ( v9 -> c6 ) -> ( v7 -> v8 ) ) ) -> -. c1 ) ) ) ) ) ) $=
+      ( wc1 wn wc0 wc7 wi wc6 ax-g2 ax-1 ax-mp ) BFGZBHDIJJAJZHEJEKJCDJJJZOJZJZ
+      JZJZJZOUBJUAUBTUASTRSOROLOQMNRPMNSBMNTOMNUABMNUBOMN $.
+  wth16 $p wff v8 $=
+      ( ) A $.
+  th238 $p |- ( ( v8 -> -. ( v6 -> c2 ) ) -> ( v3 -> ( ( -. v4 -> ( ( v2 -> v1 ) -> -. v4 ) ) -> ( ( -. v4 -> ( v2 -> v1 ) ) -> ( -. v4 -> -. v4 ) ) ) ) ) $=
+      wv3 wv4 wn wv2 wv1 wi wv4 wn wi wi wv4 wn wv2 wv1 wi wi wv4 wn wv4 wn wi
+      wi wi wi wv8 wv6 wc2 wi wn wi wv3 wv4 wn wv2 wv1 wi wv4 wn wi wi wv4 wn
+      wv2 wv1 wi wi wv4 wn wv4 wn wi wi wi wi wi wv4 wn wv2 wv1 wi wv4 wn wi wi
+      wv4 wn wv2 wv1 wi wi wv4 wn wv4 wn wi wi wi wv3 wv4 wn wv2 wv1 wi wv4 wn
+      wi wi wv4 wn wv2 wv1 wi wi wv4 wn wv4 wn wi wi wi wi wv4 wn wv2 wv1 wi
+      wv4 wn ax-2 wv4 wn wv2 wv1 wi wv4 wn wi wi wv4 wn wv2 wv1 wi wi wv4 wn
+      wv4 wn wi wi wi wv3 ax-1 ax-mp wv3 wv4 wn wv2 wv1 wi wv4 wn wi wi wv4 wn
+      wv2 wv1 wi wi wv4 wn wv4 wn wi wi wi wi wv8 wv6 wc2 wi wn wi ax-1 ax-mp
+      $.
+  th239 $p |- ( ( ( ( v7 -> c3 ) -> -. c5 ) -> ( v9 -> v4 ) ) -> ( c5 -> ( -. ( ( v1 -> c0 ) -> v6 ) -> ( ( ( v7 -> ( v7 -> v0 ) ) -> -. ( v1 -> c7 ) ) -> ( v6 -> ( c9 -> ( ( ( ( c4 -> v8 ) -> ( v6 -> v6 ) ) -> -. ( v2 -> v3 ) ) -> ( ( ( -. v8 -> -. c0 ) -> ( ( v0 -> v8 ) -> ( c4 -> c8 ) ) ) -> ( ( ( v8 -> v6 ) -> ( ( c5 -> v6 ) -> v0 ) ) -> ( ( v8 -> c5 ) -> ( ( ( -. v8 -> c9 ) -> ( v8 -> ( v8 -> v0 ) ) ) -> -. ( v8 -> c5 ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wc5 wv1 wc0 wi wv6 wi wn wv7 wv7 wv0 wi wi wv1 wc7 wi wn wi wv6 wc9 wc4
+      wv8 wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8
+      wi wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8
+      wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wi wi wi wi wv7 wc3 wi wc5
+      wn wi wv9 wv4 wi wi wc5 wv1 wc0 wi wv6 wi wn wv7 wv7 wv0 wi wi wv1 wc7 wi
+      wn wi wv6 wc9 wc4 wv8 wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi
+      wv0 wv8 wi wc4 wc8 wi wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi
+      wv8 wn wc9 wi wv8 wv8 wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wi wi
+      wi wi wi wv1 wc0 wi wv6 wi wn wv7 wv7 wv0 wi wi wv1 wc7 wi wn wi wv6 wc9
+      wc4 wv8 wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4
+      wc8 wi wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8
+      wv8 wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wi wi wi wc5 wv1 wc0 wi
+      wv6 wi wn wv7 wv7 wv0 wi wi wv1 wc7 wi wn wi wv6 wc9 wc4 wv8 wi wv6 wv6
+      wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8 wi wi wi wv8
+      wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8 wv0 wi wi wi
+      wv8 wc5 wi wn wi wi wi wi wi wi wi wi wi wi wv7 wv7 wv0 wi wi wv1 wc7 wi
+      wn wi wv6 wc9 wc4 wv8 wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi
+      wv0 wv8 wi wc4 wc8 wi wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi
+      wv8 wn wc9 wi wv8 wv8 wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wi wi
+      wv1 wc0 wi wv6 wi wn wv7 wv7 wv0 wi wi wv1 wc7 wi wn wi wv6 wc9 wc4 wv8
+      wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8 wi
+      wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8
+      wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wi wi wi wv6 wc9 wc4 wv8 wi
+      wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8 wi wi
+      wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8 wv0
+      wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wi wv7 wv7 wv0 wi wi wv1 wc7 wi
+      wn wi wv6 wc9 wc4 wv8 wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi
+      wv0 wv8 wi wc4 wc8 wi wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi
+      wv8 wn wc9 wi wv8 wv8 wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wi wi
+      wc9 wc4 wv8 wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi
+      wc4 wc8 wi wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi
+      wv8 wv8 wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wv6 wc9 wc4 wv8 wi
+      wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8 wi wi
+      wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8 wv0
+      wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wi wc4 wv8 wi wv6 wv6 wi wi wv2
+      wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8 wi wi wi wv8 wv6 wi wc5
+      wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8 wv0 wi wi wi wv8 wc5 wi
+      wn wi wi wi wi wi wc9 wc4 wv8 wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn
+      wc0 wn wi wv0 wv8 wi wc4 wc8 wi wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8
+      wc5 wi wv8 wn wc9 wi wv8 wv8 wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi
+      wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8 wi wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi
+      wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8 wv0 wi wi wi wv8 wc5 wi wn wi wi wi
+      wi wc4 wv8 wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi
+      wc4 wc8 wi wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi
+      wv8 wv8 wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wv8 wv8 wc5 wv8 wv8 wv0
+      wv6 th32 wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8 wi wi wi wv8 wv6 wi wc5 wv6
+      wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8 wv0 wi wi wi wv8 wc5 wi wn
+      wi wi wi wi wc4 wv8 wi wv6 wv6 wi wi wv2 wv3 wi wn wi ax-1 ax-mp wc4 wv8
+      wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8 wi
+      wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8
+      wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wc9 ax-1 ax-mp wc9 wc4 wv8 wi
+      wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8 wi wi
+      wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8 wv0
+      wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wv6 ax-1 ax-mp wv6 wc9 wc4 wv8
+      wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8 wi
+      wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8
+      wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wi wv7 wv7 wv0 wi wi wv1 wc7
+      wi wn wi ax-1 ax-mp wv7 wv7 wv0 wi wi wv1 wc7 wi wn wi wv6 wc9 wc4 wv8 wi
+      wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8 wi wi
+      wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8 wv0
+      wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wi wi wv1 wc0 wi wv6 wi wn ax-1
+      ax-mp wv1 wc0 wi wv6 wi wn wv7 wv7 wv0 wi wi wv1 wc7 wi wn wi wv6 wc9 wc4
+      wv8 wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8
+      wi wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8
+      wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wi wi wi wc5 ax-1 ax-mp wc5
+      wv1 wc0 wi wv6 wi wn wv7 wv7 wv0 wi wi wv1 wc7 wi wn wi wv6 wc9 wc4 wv8
+      wi wv6 wv6 wi wi wv2 wv3 wi wn wi wv8 wn wc0 wn wi wv0 wv8 wi wc4 wc8 wi
+      wi wi wv8 wv6 wi wc5 wv6 wi wv0 wi wi wv8 wc5 wi wv8 wn wc9 wi wv8 wv8
+      wv0 wi wi wi wv8 wc5 wi wn wi wi wi wi wi wi wi wi wi wi wv7 wc3 wi wc5
+      wn wi wv9 wv4 wi wi ax-1 ax-mp $.
+  th240 $p |- ( ( ( ( v0 -> c7 ) -> ( v1 -> v7 ) ) -> ( ( v5 -> v3 ) -> ( v5 -> c7 ) ) ) -> ( v9 -> ( c8 -> ( v6 -> ( c8 -> c8 ) ) ) ) ) $=
+      wv8 wv8 wv8 wi wi wv0 wc7 wi wv1 wv7 wi wi wv5 wv3 wi wv5 wc7 wi wi wi
+      wv9 wc8 wv6 wc8 wc8 wi wi wi wi wi wv8 wv8 ax-1 wv0 wc7 wi wv1 wv7 wi wi
+      wv5 wv3 wi wv5 wc7 wi wi wi wv9 wc8 wv6 wc8 wc8 wi wi wi wi wi wv8 wv8
+      wv8 wi wi wv0 wc7 wi wv1 wv7 wi wi wv5 wv3 wi wv5 wc7 wi wi wi wv9 wc8
+      wv6 wc8 wc8 wi wi wi wi wi wi wv9 wc8 wv6 wc8 wc8 wi wi wi wi wv0 wc7 wi
+      wv1 wv7 wi wi wv5 wv3 wi wv5 wc7 wi wi wi wv9 wc8 wv6 wc8 wc8 wi wi wi wi
+      wi wc8 wv6 wc8 wc8 wi wi wi wv9 wc8 wv6 wc8 wc8 wi wi wi wi wv6 wc8 wc8
+      wi wi wc8 wv6 wc8 wc8 wi wi wi wc8 wc8 wi wv6 wc8 wc8 wi wi wc8 wc8 wc8
+      wi wc8 ax-g6 wc8 wc8 ax-1 ax-mp wc8 wc8 wi wv6 ax-1 ax-mp wv6 wc8 wc8 wi
+      wi wc8 ax-1 ax-mp wc8 wv6 wc8 wc8 wi wi wi wv9 ax-1 ax-mp wv9 wc8 wv6 wc8
+      wc8 wi wi wi wi wv0 wc7 wi wv1 wv7 wi wi wv5 wv3 wi wv5 wc7 wi wi wi ax-1
+      ax-mp wv0 wc7 wi wv1 wv7 wi wi wv5 wv3 wi wv5 wc7 wi wi wi wv9 wc8 wv6
+      wc8 wc8 wi wi wi wi wi wv8 wv8 wv8 wi wi ax-1 ax-mp ax-mp $.
+  ${
+    sh6.0 $e |- v1 $.
+    sth6.0 $p |- ( ( ( v3 -> ( v5 -> v7 ) ) -> ( -. v5 -> c9 ) ) -> ( ( ( ( v5 -> v2 ) -> ( c8 -> v0 ) ) -> ( v0 -> -. v2 ) ) -> ( ( -. c5 -> -. ( v8 -> v1 ) ) -> ( ( -. c5 -> -. ( v8 -> v1 ) ) -> ( ( ( v3 -> ( v5 -> v7 ) ) -> ( -. v5 -> c9 ) ) -> v1 ) ) ) ) ) $=
+      wv5 wv2 wi wc8 wv0 wi wi wv0 wv2 wn wi wi wc5 wn wv8 wv1 wi wn wi wc5 wn
+      wv8 wv1 wi wn wi wv3 wv5 wv7 wi wi wv5 wn wc9 wi wi wv1 wi wi wi wi wv3
+      wv5 wv7 wi wi wv5 wn wc9 wi wi wv5 wv2 wi wc8 wv0 wi wi wv0 wv2 wn wi wi
+      wc5 wn wv8 wv1 wi wn wi wc5 wn wv8 wv1 wi wn wi wv3 wv5 wv7 wi wi wv5 wn
+      wc9 wi wi wv1 wi wi wi wi wi wc5 wn wv8 wv1 wi wn wi wc5 wn wv8 wv1 wi wn
+      wi wv3 wv5 wv7 wi wi wv5 wn wc9 wi wi wv1 wi wi wi wv5 wv2 wi wc8 wv0 wi
+      wi wv0 wv2 wn wi wi wc5 wn wv8 wv1 wi wn wi wc5 wn wv8 wv1 wi wn wi wv3
+      wv5 wv7 wi wi wv5 wn wc9 wi wi wv1 wi wi wi wi wc5 wn wv8 wv1 wi wn wi
+      wv3 wv5 wv7 wi wi wv5 wn wc9 wi wi wv1 wi wi wc5 wn wv8 wv1 wi wn wi wc5
+      wn wv8 wv1 wi wn wi wv3 wv5 wv7 wi wi wv5 wn wc9 wi wi wv1 wi wi wi wv3
+      wv5 wv7 wi wi wv5 wn wc9 wi wi wv1 wi wc5 wn wv8 wv1 wi wn wi wv3 wv5 wv7
+      wi wi wv5 wn wc9 wi wi wv1 wi wi wv1 wv3 wv5 wv7 wi wi wv5 wn wc9 wi wi
+      wv1 wi sh6.0 wv1 wv3 wv5 wv7 wi wi wv5 wn wc9 wi wi ax-1 ax-mp wv3 wv5
+      wv7 wi wi wv5 wn wc9 wi wi wv1 wi wc5 wn wv8 wv1 wi wn wi ax-1 ax-mp wc5
+      wn wv8 wv1 wi wn wi wv3 wv5 wv7 wi wi wv5 wn wc9 wi wi wv1 wi wi wc5 wn
+      wv8 wv1 wi wn wi ax-1 ax-mp wc5 wn wv8 wv1 wi wn wi wc5 wn wv8 wv1 wi wn
+      wi wv3 wv5 wv7 wi wi wv5 wn wc9 wi wi wv1 wi wi wi wv5 wv2 wi wc8 wv0 wi
+      wi wv0 wv2 wn wi wi ax-1 ax-mp wv5 wv2 wi wc8 wv0 wi wi wv0 wv2 wn wi wi
+      wc5 wn wv8 wv1 wi wn wi wc5 wn wv8 wv1 wi wn wi wv3 wv5 wv7 wi wi wv5 wn
+      wc9 wi wi wv1 wi wi wi wi wv3 wv5 wv7 wi wi wv5 wn wc9 wi wi ax-1 ax-mp
+      $.
+    ${
+      sh6.1 $e |- ( -. v4 -> ( ( v1 -> v6 ) -> ( v3 -> c3 ) ) ) $.
+      wl6.1 $f wff v10 $.
+      sth6.1 $p |- ( v10 -> ( v8 -> ( ( ( ( c8 -> v7 ) -> -. v3 ) -> ( ( c9 -> v3 ) -> ( v4 -> c8 ) ) ) -> ( ( ( ( v9 -> v3 ) -> v2 ) -> ( ( v6 -> v7 ) -> ( v0 -> v6 ) ) ) -> ( -. v4 -> ( ( v1 -> v6 ) -> ( v3 -> c3 ) ) ) ) ) ) ) $=
+      ( wc8 wi wn wc9 wc3 ax-1 ax-mp ) HMGNDONPDNEMNNNZIDNCNFGNAFNNNZEOBFNDQNNN
+      ZNZNZNZLUENUDUEUCUDUBUCKUBUARSUCTRSUDHRSUELRS $.
+      ${
+        sh6.2 $e |- ( v1 -> ( ( c9 -> v1 ) -> v6 ) ) $.
+        sth6.2 $p |- ( ( -. ( v4 -> v8 ) -> v4 ) -> ( -. ( ( v5 -> v3 ) -> ( c5 -> c6 ) ) -> ( -. ( ( v5 -> v3 ) -> ( c5 -> c6 ) ) -> ( v8 -> ( v8 -> ( v8 -> ( v8 -> ( v1 -> ( ( c9 -> v1 ) -> v6 ) ) ) ) ) ) ) ) ) $=
+      wv2 wv2 wv2 wi wi wv4 wv8 wi wn wv4 wi wv5 wv3 wi wc5 wc6 wi wi wn wv5
+      wv3 wi wc5 wc6 wi wi wn wv8 wv8 wv8 wv8 wv1 wc9 wv1 wi wv6 wi wi wi wi wi
+      wi wi wi wi wv2 wv2 ax-1 wv4 wv8 wi wn wv4 wi wv5 wv3 wi wc5 wc6 wi wi wn
+      wv5 wv3 wi wc5 wc6 wi wi wn wv8 wv8 wv8 wv8 wv1 wc9 wv1 wi wv6 wi wi wi
+      wi wi wi wi wi wi wv2 wv2 wv2 wi wi wv4 wv8 wi wn wv4 wi wv5 wv3 wi wc5
+      wc6 wi wi wn wv5 wv3 wi wc5 wc6 wi wi wn wv8 wv8 wv8 wv8 wv1 wc9 wv1 wi
+      wv6 wi wi wi wi wi wi wi wi wi wi wv5 wv3 wi wc5 wc6 wi wi wn wv5 wv3 wi
+      wc5 wc6 wi wi wn wv8 wv8 wv8 wv8 wv1 wc9 wv1 wi wv6 wi wi wi wi wi wi wi
+      wi wv4 wv8 wi wn wv4 wi wv5 wv3 wi wc5 wc6 wi wi wn wv5 wv3 wi wc5 wc6 wi
+      wi wn wv8 wv8 wv8 wv8 wv1 wc9 wv1 wi wv6 wi wi wi wi wi wi wi wi wi wv5
+      wv3 wi wc5 wc6 wi wi wn wv8 wv8 wv8 wv8 wv1 wc9 wv1 wi wv6 wi wi wi wi wi
+      wi wi wv5 wv3 wi wc5 wc6 wi wi wn wv5 wv3 wi wc5 wc6 wi wi wn wv8 wv8 wv8
+      wv8 wv1 wc9 wv1 wi wv6 wi wi wi wi wi wi wi wi wv8 wv8 wv8 wv8 wv1 wc9
+      wv1 wi wv6 wi wi wi wi wi wi wv5 wv3 wi wc5 wc6 wi wi wn wv8 wv8 wv8 wv8
+      wv1 wc9 wv1 wi wv6 wi wi wi wi wi wi wi wv8 wv8 wv8 wv1 wc9 wv1 wi wv6 wi
+      wi wi wi wi wv8 wv8 wv8 wv8 wv1 wc9 wv1 wi wv6 wi wi wi wi wi wi wv8 wv8
+      wv1 wc9 wv1 wi wv6 wi wi wi wi wv8 wv8 wv8 wv1 wc9 wv1 wi wv6 wi wi wi wi
+      wi wv8 wv1 wc9 wv1 wi wv6 wi wi wi wv8 wv8 wv1 wc9 wv1 wi wv6 wi wi wi wi
+      wv1 wc9 wv1 wi wv6 wi wi wv8 wv1 wc9 wv1 wi wv6 wi wi wi sh6.2 wv1 wc9
+      wv1 wi wv6 wi wi wv8 ax-1 ax-mp wv8 wv1 wc9 wv1 wi wv6 wi wi wi wv8 ax-1
+      ax-mp wv8 wv8 wv1 wc9 wv1 wi wv6 wi wi wi wi wv8 ax-1 ax-mp wv8 wv8 wv8
+      wv1 wc9 wv1 wi wv6 wi wi wi wi wi wv8 ax-1 ax-mp wv8 wv8 wv8 wv8 wv1 wc9
+      wv1 wi wv6 wi wi wi wi wi wi wv5 wv3 wi wc5 wc6 wi wi wn ax-1 ax-mp wv5
+      wv3 wi wc5 wc6 wi wi wn wv8 wv8 wv8 wv8 wv1 wc9 wv1 wi wv6 wi wi wi wi wi
+      wi wi wv5 wv3 wi wc5 wc6 wi wi wn ax-1 ax-mp wv5 wv3 wi wc5 wc6 wi wi wn
+      wv5 wv3 wi wc5 wc6 wi wi wn wv8 wv8 wv8 wv8 wv1 wc9 wv1 wi wv6 wi wi wi
+      wi wi wi wi wi wv4 wv8 wi wn wv4 wi ax-1 ax-mp wv4 wv8 wi wn wv4 wi wv5
+      wv3 wi wc5 wc6 wi wi wn wv5 wv3 wi wc5 wc6 wi wi wn wv8 wv8 wv8 wv8 wv1
+      wc9 wv1 wi wv6 wi wi wi wi wi wi wi wi wi wv2 wv2 wv2 wi wi ax-1 ax-mp
+      ax-mp $.
+      $}
+    $}
+  $}
+  th241 $p |- ( ( ( ( v7 -> v2 ) -> ( v3 -> v7 ) ) -> ( ( v1 -> v0 ) -> -. v9 ) ) -> ( v0 -> ( ( v6 -> v2 ) -> ( -. ( ( v6 -> v2 ) -> v2 ) -> ( -. v2 -> ( ( v0 -> v5 ) -> v2 ) ) ) ) ) ) $=
+      wv8 wv8 wv8 wi wi wv7 wv2 wi wv3 wv7 wi wi wv1 wv0 wi wv9 wn wi wi wv0
+      wv6 wv2 wi wv6 wv2 wi wv2 wi wn wv2 wn wv0 wv5 wi wv2 wi wi wi wi wi wi
+      wv8 wv8 ax-1 wv7 wv2 wi wv3 wv7 wi wi wv1 wv0 wi wv9 wn wi wi wv0 wv6 wv2
+      wi wv6 wv2 wi wv2 wi wn wv2 wn wv0 wv5 wi wv2 wi wi wi wi wi wi wv8 wv8
+      wv8 wi wi wv7 wv2 wi wv3 wv7 wi wi wv1 wv0 wi wv9 wn wi wi wv0 wv6 wv2 wi
+      wv6 wv2 wi wv2 wi wn wv2 wn wv0 wv5 wi wv2 wi wi wi wi wi wi wi wv0 wv6
+      wv2 wi wv6 wv2 wi wv2 wi wn wv2 wn wv0 wv5 wi wv2 wi wi wi wi wi wv7 wv2
+      wi wv3 wv7 wi wi wv1 wv0 wi wv9 wn wi wi wv0 wv6 wv2 wi wv6 wv2 wi wv2 wi
+      wn wv2 wn wv0 wv5 wi wv2 wi wi wi wi wi wi wv6 wv2 wi wv6 wv2 wi wv2 wi
+      wn wv2 wn wv0 wv5 wi wv2 wi wi wi wi wv0 wv6 wv2 wi wv6 wv2 wi wv2 wi wn
+      wv2 wn wv0 wv5 wi wv2 wi wi wi wi wi wv6 wv2 wi wv2 wi wn wv2 wn wv0 wv5
+      wi wv2 wi wi wi wv6 wv2 wi wv6 wv2 wi wv2 wi wn wv2 wn wv0 wv5 wi wv2 wi
+      wi wi wi wv6 wv2 wi wv2 wv0 wv5 wi wv2 ax-g9 wv6 wv2 wi wv2 wi wn wv2 wn
+      wv0 wv5 wi wv2 wi wi wi wv6 wv2 wi ax-1 ax-mp wv6 wv2 wi wv6 wv2 wi wv2
+      wi wn wv2 wn wv0 wv5 wi wv2 wi wi wi wi wv0 ax-1 ax-mp wv0 wv6 wv2 wi wv6
+      wv2 wi wv2 wi wn wv2 wn wv0 wv5 wi wv2 wi wi wi wi wi wv7 wv2 wi wv3 wv7
+      wi wi wv1 wv0 wi wv9 wn wi wi ax-1 ax-mp wv7 wv2 wi wv3 wv7 wi wi wv1 wv0
+      wi wv9 wn wi wi wv0 wv6 wv2 wi wv6 wv2 wi wv2 wi wn wv2 wn wv0 wv5 wi wv2
+      wi wi wi wi wi wi wv8 wv8 wv8 wi wi ax-1 ax-mp ax-mp $.
+  th242 $p |- ( v0 -> ( ( ( -. v7 -> ( v3 -> c3 ) ) -> ( ( v9 -> v4 ) -> v5 ) ) -> ( -. v6 -> ( ( ( c2 -> v8 ) -> c7 ) -> ( ( c2 -> c2 ) -> ( -. ( ( c7 -> c1 ) -> -. v0 ) -> ( -. ( c2 -> c2 ) -> ( -. v0 -> ( c2 -> c2 ) ) ) ) ) ) ) ) ) $=
+      wv7 wn wv3 wc3 wi wi wv9 wv4 wi wv5 wi wi wv6 wn wc2 wv8 wi wc7 wi wc2
+      wc2 wi wc7 wc1 wi wv0 wn wi wn wc2 wc2 wi wn wv0 wn wc2 wc2 wi wi wi wi
+      wi wi wi wi wv0 wv7 wn wv3 wc3 wi wi wv9 wv4 wi wv5 wi wi wv6 wn wc2 wv8
+      wi wc7 wi wc2 wc2 wi wc7 wc1 wi wv0 wn wi wn wc2 wc2 wi wn wv0 wn wc2 wc2
+      wi wi wi wi wi wi wi wi wi wv6 wn wc2 wv8 wi wc7 wi wc2 wc2 wi wc7 wc1 wi
+      wv0 wn wi wn wc2 wc2 wi wn wv0 wn wc2 wc2 wi wi wi wi wi wi wi wv7 wn wv3
+      wc3 wi wi wv9 wv4 wi wv5 wi wi wv6 wn wc2 wv8 wi wc7 wi wc2 wc2 wi wc7
+      wc1 wi wv0 wn wi wn wc2 wc2 wi wn wv0 wn wc2 wc2 wi wi wi wi wi wi wi wi
+      wc2 wv8 wi wc7 wi wc2 wc2 wi wc7 wc1 wi wv0 wn wi wn wc2 wc2 wi wn wv0 wn
+      wc2 wc2 wi wi wi wi wi wi wv6 wn wc2 wv8 wi wc7 wi wc2 wc2 wi wc7 wc1 wi
+      wv0 wn wi wn wc2 wc2 wi wn wv0 wn wc2 wc2 wi wi wi wi wi wi wi wv0 wc7
+      wv8 wc2 th197 wc2 wv8 wi wc7 wi wc2 wc2 wi wc7 wc1 wi wv0 wn wi wn wc2
+      wc2 wi wn wv0 wn wc2 wc2 wi wi wi wi wi wi wv6 wn ax-1 ax-mp wv6 wn wc2
+      wv8 wi wc7 wi wc2 wc2 wi wc7 wc1 wi wv0 wn wi wn wc2 wc2 wi wn wv0 wn wc2
+      wc2 wi wi wi wi wi wi wi wv7 wn wv3 wc3 wi wi wv9 wv4 wi wv5 wi wi ax-1
+      ax-mp wv7 wn wv3 wc3 wi wi wv9 wv4 wi wv5 wi wi wv6 wn wc2 wv8 wi wc7 wi
+      wc2 wc2 wi wc7 wc1 wi wv0 wn wi wn wc2 wc2 wi wn wv0 wn wc2 wc2 wi wi wi
+      wi wi wi wi wi wv0 ax-1 ax-mp $.
+  th243 $p |- ( -. ( -. v2 -> ( v2 -> c9 ) ) -> ( v5 -> ( -. c2 -> ( ( ( v0 -> ( c4 -> v8 ) ) -> ( ( v3 -> v8 ) -> ( c2 -> c5 ) ) ) -> ( ( ( v0 -> ( c4 -> v8 ) ) -> ( ( v3 -> v8 ) -> ( c2 -> c5 ) ) ) -> ( ( ( v0 -> ( c4 -> v8 ) ) -> ( ( v3 -> v8 ) -> ( c2 -> c5 ) ) ) -> -. c2 ) ) ) ) ) ) $=
+      ( wc2 wn wc4 wi wc5 wc9 ax-g4 ax-1 ax-mp ) DFGZAHEIICEIFJIIIZPPOIZIZIZIZI
+      ZBGBKIIGZUAITUASTRSQROQOLOPMNQPMNRPMNSOMNTDMNUAUBMN $.
+  th244 $p |- ( ( ( ( v8 -> v2 ) -> ( c0 -> v0 ) ) -> ( v5 -> v1 ) ) -> ( ( v1 -> -. -. v8 ) -> ( ( v1 -> -. -. v8 ) -> ( ( v1 -> -. -. v8 ) -> -. ( ( ( v5 -> v8 ) -> v8 ) -> ( v8 -> v8 ) ) ) ) ) ) $=
+      wv7 wv7 wv7 wi wi wv8 wv2 wi wc0 wv0 wi wi wv5 wv1 wi wi wv1 wv8 wn wn wi
+      wv1 wv8 wn wn wi wv1 wv8 wn wn wi wv5 wv8 wi wv8 wi wv8 wv8 wi wi wn wi
+      wi wi wi wv7 wv7 ax-1 wv8 wv2 wi wc0 wv0 wi wi wv5 wv1 wi wi wv1 wv8 wn
+      wn wi wv1 wv8 wn wn wi wv1 wv8 wn wn wi wv5 wv8 wi wv8 wi wv8 wv8 wi wi
+      wn wi wi wi wi wv7 wv7 wv7 wi wi wv8 wv2 wi wc0 wv0 wi wi wv5 wv1 wi wi
+      wv1 wv8 wn wn wi wv1 wv8 wn wn wi wv1 wv8 wn wn wi wv5 wv8 wi wv8 wi wv8
+      wv8 wi wi wn wi wi wi wi wi wv1 wv8 wn wn wi wv1 wv8 wn wn wi wv1 wv8 wn
+      wn wi wv5 wv8 wi wv8 wi wv8 wv8 wi wi wn wi wi wi wv8 wv2 wi wc0 wv0 wi
+      wi wv5 wv1 wi wi wv1 wv8 wn wn wi wv1 wv8 wn wn wi wv1 wv8 wn wn wi wv5
+      wv8 wi wv8 wi wv8 wv8 wi wi wn wi wi wi wi wv1 wv8 wn wn wi wv1 wv8 wn wn
+      wi wv5 wv8 wi wv8 wi wv8 wv8 wi wi wn wi wi wv1 wv8 wn wn wi wv1 wv8 wn
+      wn wi wv1 wv8 wn wn wi wv5 wv8 wi wv8 wi wv8 wv8 wi wi wn wi wi wi wv1
+      wv8 wn wn wi wv5 wv8 wi wv8 wi wv8 wv8 wi wi wn wi wv1 wv8 wn wn wi wv1
+      wv8 wn wn wi wv5 wv8 wi wv8 wi wv8 wv8 wi wi wn wi wi wv5 wv8 wi wv8 wi
+      wv8 wv8 wi wi wn wv1 wv8 wn wn wi wv5 wv8 wi wv8 wi wv8 wv8 wi wi wn wi
+      wv5 wv8 wi wv8 wv8 ax-g8 wv5 wv8 wi wv8 wi wv8 wv8 wi wi wn wv1 wv8 wn wn
+      wi ax-1 ax-mp wv1 wv8 wn wn wi wv5 wv8 wi wv8 wi wv8 wv8 wi wi wn wi wv1
+      wv8 wn wn wi ax-1 ax-mp wv1 wv8 wn wn wi wv1 wv8 wn wn wi wv5 wv8 wi wv8
+      wi wv8 wv8 wi wi wn wi wi wv1 wv8 wn wn wi ax-1 ax-mp wv1 wv8 wn wn wi
+      wv1 wv8 wn wn wi wv1 wv8 wn wn wi wv5 wv8 wi wv8 wi wv8 wv8 wi wi wn wi
+      wi wi wv8 wv2 wi wc0 wv0 wi wi wv5 wv1 wi wi ax-1 ax-mp wv8 wv2 wi wc0
+      wv0 wi wi wv5 wv1 wi wi wv1 wv8 wn wn wi wv1 wv8 wn wn wi wv1 wv8 wn wn
+      wi wv5 wv8 wi wv8 wi wv8 wv8 wi wi wn wi wi wi wi wv7 wv7 wv7 wi wi ax-1
+      ax-mp ax-mp $.
+  wth17 $p wff v3 $=
+      ( ) A $.
+  th245 $p |- ( ( ( ( v7 -> v4 ) -> -. v4 ) -> -. v6 ) -> ( ( v4 -> v8 ) -> ( ( ( c3 -> -. v8 ) -> ( ( v0 -> v2 ) -> ( v9 -> c9 ) ) ) -> ( ( ( ( v1 -> v4 ) -> v9 ) -> v3 ) -> ( ( ( v3 -> ( c7 -> c4 ) ) -> ( ( c3 -> c9 ) -> ( v3 -> c1 ) ) ) -> ( ( c3 -> c8 ) -> ( -. ( ( v5 -> c2 ) -> ( c3 -> c8 ) ) -> -. ( ( c3 -> c8 ) -> ( v4 -> v8 ) ) ) ) ) ) ) ) ) $=
+      wv4 wv8 wi wc3 wv8 wn wi wv0 wv2 wi wv9 wc9 wi wi wi wv1 wv4 wi wv9 wi
+      wv3 wi wv3 wc7 wc4 wi wi wc3 wc9 wi wv3 wc1 wi wi wi wc3 wc8 wi wv5 wc2
+      wi wc3 wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi wi wn wi wi wi wi wi wi wv7 wv4
+      wi wv4 wn wi wv6 wn wi wv4 wv8 wi wc3 wv8 wn wi wv0 wv2 wi wv9 wc9 wi wi
+      wi wv1 wv4 wi wv9 wi wv3 wi wv3 wc7 wc4 wi wi wc3 wc9 wi wv3 wc1 wi wi wi
+      wc3 wc8 wi wv5 wc2 wi wc3 wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi wi wn wi wi
+      wi wi wi wi wi wc3 wv8 wn wi wv0 wv2 wi wv9 wc9 wi wi wi wv1 wv4 wi wv9
+      wi wv3 wi wv3 wc7 wc4 wi wi wc3 wc9 wi wv3 wc1 wi wi wi wc3 wc8 wi wv5
+      wc2 wi wc3 wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi wi wn wi wi wi wi wi wv4
+      wv8 wi wc3 wv8 wn wi wv0 wv2 wi wv9 wc9 wi wi wi wv1 wv4 wi wv9 wi wv3 wi
+      wv3 wc7 wc4 wi wi wc3 wc9 wi wv3 wc1 wi wi wi wc3 wc8 wi wv5 wc2 wi wc3
+      wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi wi wn wi wi wi wi wi wi wv1 wv4 wi wv9
+      wi wv3 wi wv3 wc7 wc4 wi wi wc3 wc9 wi wv3 wc1 wi wi wi wc3 wc8 wi wv5
+      wc2 wi wc3 wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi wi wn wi wi wi wi wc3 wv8
+      wn wi wv0 wv2 wi wv9 wc9 wi wi wi wv1 wv4 wi wv9 wi wv3 wi wv3 wc7 wc4 wi
+      wi wc3 wc9 wi wv3 wc1 wi wi wi wc3 wc8 wi wv5 wc2 wi wc3 wc8 wi wi wn wc3
+      wc8 wi wv4 wv8 wi wi wn wi wi wi wi wi wv3 wc7 wc4 wi wi wc3 wc9 wi wv3
+      wc1 wi wi wi wc3 wc8 wi wv5 wc2 wi wc3 wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi
+      wi wn wi wi wi wv1 wv4 wi wv9 wi wv3 wi wv3 wc7 wc4 wi wi wc3 wc9 wi wv3
+      wc1 wi wi wi wc3 wc8 wi wv5 wc2 wi wc3 wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi
+      wi wn wi wi wi wi wc3 wc8 wi wv5 wc2 wi wc3 wc8 wi wi wn wc3 wc8 wi wv4
+      wv8 wi wi wn wi wi wv3 wc7 wc4 wi wi wc3 wc9 wi wv3 wc1 wi wi wi wc3 wc8
+      wi wv5 wc2 wi wc3 wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi wi wn wi wi wi wv5
+      wc2 wi wc3 wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi wi wn wi wc3 wc8 wi wv5 wc2
+      wi wc3 wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi wi wn wi wi wv4 wv8 wi wc3 wc8
+      wi wv5 wc2 wi wc3 wc8 wi ax-g3 wv5 wc2 wi wc3 wc8 wi wi wn wc3 wc8 wi wv4
+      wv8 wi wi wn wi wc3 wc8 wi ax-1 ax-mp wc3 wc8 wi wv5 wc2 wi wc3 wc8 wi wi
+      wn wc3 wc8 wi wv4 wv8 wi wi wn wi wi wv3 wc7 wc4 wi wi wc3 wc9 wi wv3 wc1
+      wi wi wi ax-1 ax-mp wv3 wc7 wc4 wi wi wc3 wc9 wi wv3 wc1 wi wi wi wc3 wc8
+      wi wv5 wc2 wi wc3 wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi wi wn wi wi wi wv1
+      wv4 wi wv9 wi wv3 wi ax-1 ax-mp wv1 wv4 wi wv9 wi wv3 wi wv3 wc7 wc4 wi
+      wi wc3 wc9 wi wv3 wc1 wi wi wi wc3 wc8 wi wv5 wc2 wi wc3 wc8 wi wi wn wc3
+      wc8 wi wv4 wv8 wi wi wn wi wi wi wi wc3 wv8 wn wi wv0 wv2 wi wv9 wc9 wi
+      wi wi ax-1 ax-mp wc3 wv8 wn wi wv0 wv2 wi wv9 wc9 wi wi wi wv1 wv4 wi wv9
+      wi wv3 wi wv3 wc7 wc4 wi wi wc3 wc9 wi wv3 wc1 wi wi wi wc3 wc8 wi wv5
+      wc2 wi wc3 wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi wi wn wi wi wi wi wi wv4
+      wv8 wi ax-1 ax-mp wv4 wv8 wi wc3 wv8 wn wi wv0 wv2 wi wv9 wc9 wi wi wi
+      wv1 wv4 wi wv9 wi wv3 wi wv3 wc7 wc4 wi wi wc3 wc9 wi wv3 wc1 wi wi wi
+      wc3 wc8 wi wv5 wc2 wi wc3 wc8 wi wi wn wc3 wc8 wi wv4 wv8 wi wi wn wi wi
+      wi wi wi wi wv7 wv4 wi wv4 wn wi wv6 wn wi ax-1 ax-mp $.
+  th246 $p |- ( v8 -> ( ( c4 -> -. ( v6 -> v5 ) ) -> ( ( ( -. c1 -> ( c0 -> v8 ) ) -> v6 ) -> ( ( -. c9 -> v8 ) -> ( ( -. c9 -> v8 ) -> ( -. -. v8 -> ( -. ( -. c8 -> v8 ) -> ( -. ( v9 -> c7 ) -> ( ( v0 -> c9 ) -> ( v9 -> c7 ) ) ) ) ) ) ) ) ) ) $=
+      wc4 wv6 wv5 wi wn wi wc1 wn wc0 wv8 wi wi wv6 wi wc9 wn wv8 wi wc9 wn wv8
+      wi wv8 wn wn wc8 wn wv8 wi wn wv9 wc7 wi wn wv0 wc9 wi wv9 wc7 wi wi wi
+      wi wi wi wi wi wi wv8 wc4 wv6 wv5 wi wn wi wc1 wn wc0 wv8 wi wi wv6 wi
+      wc9 wn wv8 wi wc9 wn wv8 wi wv8 wn wn wc8 wn wv8 wi wn wv9 wc7 wi wn wv0
+      wc9 wi wv9 wc7 wi wi wi wi wi wi wi wi wi wi wc1 wn wc0 wv8 wi wi wv6 wi
+      wc9 wn wv8 wi wc9 wn wv8 wi wv8 wn wn wc8 wn wv8 wi wn wv9 wc7 wi wn wv0
+      wc9 wi wv9 wc7 wi wi wi wi wi wi wi wi wc4 wv6 wv5 wi wn wi wc1 wn wc0
+      wv8 wi wi wv6 wi wc9 wn wv8 wi wc9 wn wv8 wi wv8 wn wn wc8 wn wv8 wi wn
+      wv9 wc7 wi wn wv0 wc9 wi wv9 wc7 wi wi wi wi wi wi wi wi wi wc9 wn wv8 wi
+      wc9 wn wv8 wi wv8 wn wn wc8 wn wv8 wi wn wv9 wc7 wi wn wv0 wc9 wi wv9 wc7
+      wi wi wi wi wi wi wi wc1 wn wc0 wv8 wi wi wv6 wi wc9 wn wv8 wi wc9 wn wv8
+      wi wv8 wn wn wc8 wn wv8 wi wn wv9 wc7 wi wn wv0 wc9 wi wv9 wc7 wi wi wi
+      wi wi wi wi wi wc9 wn wv8 wi wv8 wn wn wc8 wn wv8 wi wn wv9 wc7 wi wn wv0
+      wc9 wi wv9 wc7 wi wi wi wi wi wi wc9 wn wv8 wi wc9 wn wv8 wi wv8 wn wn
+      wc8 wn wv8 wi wn wv9 wc7 wi wn wv0 wc9 wi wv9 wc7 wi wi wi wi wi wi wi
+      wv8 wn wn wc8 wn wv8 wi wn wv9 wc7 wi wn wv0 wc9 wi wv9 wc7 wi wi wi wi
+      wi wc9 wn wv8 wi wv8 wn wn wc8 wn wv8 wi wn wv9 wc7 wi wn wv0 wc9 wi wv9
+      wc7 wi wi wi wi wi wi wc8 wn wv8 wi wn wv9 wc7 wi wn wv0 wc9 wi wv9 wc7
+      wi wi wi wi wv8 wn wn wc8 wn wv8 wi wn wv9 wc7 wi wn wv0 wc9 wi wv9 wc7
+      wi wi wi wi wi wc8 wn wv8 wv0 wc9 wi wv9 wc7 wi ax-g9 wc8 wn wv8 wi wn
+      wv9 wc7 wi wn wv0 wc9 wi wv9 wc7 wi wi wi wi wv8 wn wn ax-1 ax-mp wv8 wn
+      wn wc8 wn wv8 wi wn wv9 wc7 wi wn wv0 wc9 wi wv9 wc7 wi wi wi wi wi wc9
+      wn wv8 wi ax-1 ax-mp wc9 wn wv8 wi wv8 wn wn wc8 wn wv8 wi wn wv9 wc7 wi
+      wn wv0 wc9 wi wv9 wc7 wi wi wi wi wi wi wc9 wn wv8 wi ax-1 ax-mp wc9 wn
+      wv8 wi wc9 wn wv8 wi wv8 wn wn wc8 wn wv8 wi wn wv9 wc7 wi wn wv0 wc9 wi
+      wv9 wc7 wi wi wi wi wi wi wi wc1 wn wc0 wv8 wi wi wv6 wi ax-1 ax-mp wc1
+      wn wc0 wv8 wi wi wv6 wi wc9 wn wv8 wi wc9 wn wv8 wi wv8 wn wn wc8 wn wv8
+      wi wn wv9 wc7 wi wn wv0 wc9 wi wv9 wc7 wi wi wi wi wi wi wi wi wc4 wv6
+      wv5 wi wn wi ax-1 ax-mp wc4 wv6 wv5 wi wn wi wc1 wn wc0 wv8 wi wi wv6 wi
+      wc9 wn wv8 wi wc9 wn wv8 wi wv8 wn wn wc8 wn wv8 wi wn wv9 wc7 wi wn wv0
+      wc9 wi wv9 wc7 wi wi wi wi wi wi wi wi wi wv8 ax-1 ax-mp $.
+  ${
+    $d v2 v3 $.
+    $d v2 v6 $.
+    $d v3 v4 $.
+    $d v4 v6 $.
+    th247 $p |- ( ( ( -. c1 -> -. v5 ) -> v9 ) -> ( ( v6 -> v3 ) -> ( ( ( -. c1 -> -. v5 ) -> v9 ) -> ( ( v1 -> v5 ) -> ( -. ( ( v2 -> v4 ) -> ( v6 -> v3 ) ) -> ( v1 -> v5 ) ) ) ) ) ) $=
+      ( wi wc1 wn ax-g1 ax-1 ax-mp ) FCHZIJEJHGHZAEHZBDHZNHJPHZHZHZHZOUAHTUASTR
+      SNPQKRPLMSOLMTNLMUAOLM $.
+  $}
+  th248 $p |- ( v0 -> ( ( -. ( v3 -> v0 ) -> -. -. v0 ) -> ( -. v0 -> ( v3 -> v0 ) ) ) ) $=
+      ( wv9 wi wn ax-1 ax-3 ax-mp ) CCCDDZABADZEAEZEDKJDDZDZCCFMIMDLMJKGLAFHMIF
+      HH $.
+  th249 $p |- ( ( ( v8 -> ( c5 -> v9 ) ) -> v6 ) -> ( v4 -> ( ( ( ( c8 -> c7 ) -> ( c1 -> v2 ) ) -> ( ( v4 -> v6 ) -> v0 ) ) -> ( ( v5 -> v0 ) -> ( -. ( ( v0 -> v9 ) -> ( v2 -> c1 ) ) -> ( ( ( ( c7 -> v2 ) -> ( v2 -> v4 ) ) -> -. ( v6 -> v6 ) ) -> ( ( ( ( v8 -> v7 ) -> ( v5 -> v0 ) ) -> c0 ) -> ( ( -. c0 -> v7 ) -> -. ( v7 -> ( v5 -> c3 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc8 wc7 wi wc1 wn wc0 wc3 wc5 ax-g0 ax-1 ax-mp ) CIJKLBKKCEKAKKZDAKZAHK
+      BLKKMZJBKBCKKEEKMKZGFKDAKKNKZNMZFKFDOKZKMKZKZKZKZKZKZKZGPHKKEKZUMKULUMUKU
+      LUJUKUIUJUHUIUGUHFUFFUEQUGUDRSUHUCRSUIUBRSUJUARSUKTRSULCRSUMUNRS $.
+  wth18 $p wff ( ( -. ( c2 -> v1 ) -> ( ( v6 -> v3 ) -> v7 ) ) -> c5 ) $=
+      ( wc2 wi wn wc5 ) EAFGCBFDFFHF $.
+  wth19 $p wff -. -. ( -. v6 -> ( v0 -> v9 ) ) $=
+      wv6 wn wv0 wv9 wi wi wn wn $.
+  th250 $p |- ( ( ( ( c1 -> v6 ) -> ( c3 -> v7 ) ) -> ( ( v6 -> c6 ) -> ( v1 -> c5 ) ) ) -> ( ( ( -. v7 -> ( c4 -> v5 ) ) -> ( ( v7 -> v8 ) -> v7 ) ) -> ( ( ( v6 -> ( v3 -> v9 ) ) -> ( c2 -> ( c4 -> c5 ) ) ) -> ( -. ( ( c2 -> v7 ) -> v7 ) -> ( -. ( c5 -> v8 ) -> ( v7 -> ( c5 -> v8 ) ) ) ) ) ) ) $=
+      wv7 wn wc4 wv5 wi wi wv7 wv8 wi wv7 wi wi wv6 wv3 wv9 wi wi wc2 wc4 wc5
+      wi wi wi wc2 wv7 wi wv7 wi wn wc5 wv8 wi wn wv7 wc5 wv8 wi wi wi wi wi wi
+      wc1 wv6 wi wc3 wv7 wi wi wv6 wc6 wi wv1 wc5 wi wi wi wv7 wn wc4 wv5 wi wi
+      wv7 wv8 wi wv7 wi wi wv6 wv3 wv9 wi wi wc2 wc4 wc5 wi wi wi wc2 wv7 wi
+      wv7 wi wn wc5 wv8 wi wn wv7 wc5 wv8 wi wi wi wi wi wi wi wv6 wv3 wv9 wi
+      wi wc2 wc4 wc5 wi wi wi wc2 wv7 wi wv7 wi wn wc5 wv8 wi wn wv7 wc5 wv8 wi
+      wi wi wi wi wv7 wn wc4 wv5 wi wi wv7 wv8 wi wv7 wi wi wv6 wv3 wv9 wi wi
+      wc2 wc4 wc5 wi wi wi wc2 wv7 wi wv7 wi wn wc5 wv8 wi wn wv7 wc5 wv8 wi wi
+      wi wi wi wi wc2 wv7 wi wv7 wi wn wc5 wv8 wi wn wv7 wc5 wv8 wi wi wi wi
+      wv6 wv3 wv9 wi wi wc2 wc4 wc5 wi wi wi wc2 wv7 wi wv7 wi wn wc5 wv8 wi wn
+      wv7 wc5 wv8 wi wi wi wi wi wc2 wv7 wi wv7 wv7 wc5 wv8 wi ax-g9 wc2 wv7 wi
+      wv7 wi wn wc5 wv8 wi wn wv7 wc5 wv8 wi wi wi wi wv6 wv3 wv9 wi wi wc2 wc4
+      wc5 wi wi wi ax-1 ax-mp wv6 wv3 wv9 wi wi wc2 wc4 wc5 wi wi wi wc2 wv7 wi
+      wv7 wi wn wc5 wv8 wi wn wv7 wc5 wv8 wi wi wi wi wi wv7 wn wc4 wv5 wi wi
+      wv7 wv8 wi wv7 wi wi ax-1 ax-mp wv7 wn wc4 wv5 wi wi wv7 wv8 wi wv7 wi wi
+      wv6 wv3 wv9 wi wi wc2 wc4 wc5 wi wi wi wc2 wv7 wi wv7 wi wn wc5 wv8 wi wn
+      wv7 wc5 wv8 wi wi wi wi wi wi wc1 wv6 wi wc3 wv7 wi wi wv6 wc6 wi wv1 wc5
+      wi wi wi ax-1 ax-mp $.
+  th251 $p |- ( -. -. ( v3 -> v4 ) -> ( ( ( ( v1 -> c7 ) -> ( v4 -> c7 ) ) -> ( -. c4 -> -. v3 ) ) -> ( -. -. c7 -> ( ( ( c0 -> v7 ) -> ( v6 -> c8 ) ) -> -. ( ( v0 -> v3 ) -> ( v6 -> v2 ) ) ) ) ) ) $=
+      wv1 wc7 wi wv4 wc7 wi wi wc4 wn wv3 wn wi wi wc7 wn wn wc0 wv7 wi wv6 wc8
+      wi wi wv0 wv3 wi wv6 wv2 wi wi wn wi wi wi wv3 wv4 wi wn wn wv1 wc7 wi
+      wv4 wc7 wi wi wc4 wn wv3 wn wi wi wc7 wn wn wc0 wv7 wi wv6 wc8 wi wi wv0
+      wv3 wi wv6 wv2 wi wi wn wi wi wi wi wc7 wn wn wc0 wv7 wi wv6 wc8 wi wi
+      wv0 wv3 wi wv6 wv2 wi wi wn wi wi wv1 wc7 wi wv4 wc7 wi wi wc4 wn wv3 wn
+      wi wi wc7 wn wn wc0 wv7 wi wv6 wc8 wi wi wv0 wv3 wi wv6 wv2 wi wi wn wi
+      wi wi wc0 wv7 wi wv6 wc8 wi wi wv0 wv3 wi wv6 wv2 wi wi wn wi wc7 wn wn
+      wc0 wv7 wi wv6 wc8 wi wi wv0 wv3 wi wv6 wv2 wi wi wn wi wi wv0 wv3 wi wv6
+      wv2 wi wv6 wc8 wi wc0 wv7 wi ax-g0 wc0 wv7 wi wv6 wc8 wi wi wv0 wv3 wi
+      wv6 wv2 wi wi wn wi wc7 wn wn ax-1 ax-mp wc7 wn wn wc0 wv7 wi wv6 wc8 wi
+      wi wv0 wv3 wi wv6 wv2 wi wi wn wi wi wv1 wc7 wi wv4 wc7 wi wi wc4 wn wv3
+      wn wi wi ax-1 ax-mp wv1 wc7 wi wv4 wc7 wi wi wc4 wn wv3 wn wi wi wc7 wn
+      wn wc0 wv7 wi wv6 wc8 wi wi wv0 wv3 wi wv6 wv2 wi wi wn wi wi wi wv3 wv4
+      wi wn wn ax-1 ax-mp $.
+  wth20 $p wff ( ( v0 -> ( -. c7 -> ( v3 -> v3 ) ) ) -> ( ( v5 -> ( v3 -> v5 ) ) -> -. v1 ) ) $=
+      wv0 wc7 wn wv3 wv3 wi wi wi wv5 wv3 wv5 wi wi wv1 wn wi wi $.
+  th252 $p |- ( ( ( ( v5 -> v8 ) -> v0 ) -> c1 ) -> ( -. ( v2 -> -. c9 ) -> ( -. ( c5 -> v8 ) -> ( ( c6 -> c1 ) -> ( c5 -> v8 ) ) ) ) ) $=
+      ( wc9 wn wi wc5 wc6 wc1 ax-g9 ax-1 ax-mp ) BEFZGFHDGZFIJGZOGGGZCDGAGJGZQG
+      BNPOKQRLM $.
+  th253 $p |- ( ( ( -. v4 -> v9 ) -> v6 ) -> ( v0 -> ( ( ( ( c9 -> v6 ) -> -. v6 ) -> ( ( v3 -> v3 ) -> v9 ) ) -> ( -. ( ( v6 -> c2 ) -> ( v3 -> v2 ) ) -> ( -. ( ( v6 -> c2 ) -> ( v3 -> v2 ) ) -> ( -. ( -. v2 -> v5 ) -> ( -. v5 -> ( -. v2 -> v5 ) ) ) ) ) ) ) ) $=
+      wv0 wc9 wv6 wi wv6 wn wi wv3 wv3 wi wv9 wi wi wv6 wc2 wi wv3 wv2 wi wi wn
+      wv6 wc2 wi wv3 wv2 wi wi wn wv2 wn wv5 wi wn wv5 wn wv2 wn wv5 wi wi wi
+      wi wi wi wi wv4 wn wv9 wi wv6 wi wv0 wc9 wv6 wi wv6 wn wi wv3 wv3 wi wv9
+      wi wi wv6 wc2 wi wv3 wv2 wi wi wn wv6 wc2 wi wv3 wv2 wi wi wn wv2 wn wv5
+      wi wn wv5 wn wv2 wn wv5 wi wi wi wi wi wi wi wi wc9 wv6 wi wv6 wn wi wv3
+      wv3 wi wv9 wi wi wv6 wc2 wi wv3 wv2 wi wi wn wv6 wc2 wi wv3 wv2 wi wi wn
+      wv2 wn wv5 wi wn wv5 wn wv2 wn wv5 wi wi wi wi wi wi wv0 wc9 wv6 wi wv6
+      wn wi wv3 wv3 wi wv9 wi wi wv6 wc2 wi wv3 wv2 wi wi wn wv6 wc2 wi wv3 wv2
+      wi wi wn wv2 wn wv5 wi wn wv5 wn wv2 wn wv5 wi wi wi wi wi wi wi wv6 wc2
+      wi wv3 wv2 wi wi wn wv6 wc2 wi wv3 wv2 wi wi wn wv2 wn wv5 wi wn wv5 wn
+      wv2 wn wv5 wi wi wi wi wi wc9 wv6 wi wv6 wn wi wv3 wv3 wi wv9 wi wi wv6
+      wc2 wi wv3 wv2 wi wi wn wv6 wc2 wi wv3 wv2 wi wi wn wv2 wn wv5 wi wn wv5
+      wn wv2 wn wv5 wi wi wi wi wi wi wv6 wc2 wi wv3 wv2 wi wi wn wv2 wn wv5 wi
+      wn wv5 wn wv2 wn wv5 wi wi wi wi wv6 wc2 wi wv3 wv2 wi wi wn wv6 wc2 wi
+      wv3 wv2 wi wi wn wv2 wn wv5 wi wn wv5 wn wv2 wn wv5 wi wi wi wi wi wv2 wn
+      wv5 wi wn wv5 wn wv2 wn wv5 wi wi wi wv6 wc2 wi wv3 wv2 wi wi wn wv2 wn
+      wv5 wi wn wv5 wn wv2 wn wv5 wi wi wi wi wv2 wn wv5 wv2 wn wv5 ax-g9 wv2
+      wn wv5 wi wn wv5 wn wv2 wn wv5 wi wi wi wv6 wc2 wi wv3 wv2 wi wi wn ax-1
+      ax-mp wv6 wc2 wi wv3 wv2 wi wi wn wv2 wn wv5 wi wn wv5 wn wv2 wn wv5 wi
+      wi wi wi wv6 wc2 wi wv3 wv2 wi wi wn ax-1 ax-mp wv6 wc2 wi wv3 wv2 wi wi
+      wn wv6 wc2 wi wv3 wv2 wi wi wn wv2 wn wv5 wi wn wv5 wn wv2 wn wv5 wi wi
+      wi wi wi wc9 wv6 wi wv6 wn wi wv3 wv3 wi wv9 wi wi ax-1 ax-mp wc9 wv6 wi
+      wv6 wn wi wv3 wv3 wi wv9 wi wi wv6 wc2 wi wv3 wv2 wi wi wn wv6 wc2 wi wv3
+      wv2 wi wi wn wv2 wn wv5 wi wn wv5 wn wv2 wn wv5 wi wi wi wi wi wi wv0
+      ax-1 ax-mp wv0 wc9 wv6 wi wv6 wn wi wv3 wv3 wi wv9 wi wi wv6 wc2 wi wv3
+      wv2 wi wi wn wv6 wc2 wi wv3 wv2 wi wi wn wv2 wn wv5 wi wn wv5 wn wv2 wn
+      wv5 wi wi wi wi wi wi wi wv4 wn wv9 wi wv6 wi ax-1 ax-mp $.
+  wth21 $p wff ( ( ( ( v4 -> v3 ) -> ( v4 -> c0 ) ) -> ( ( c3 -> c5 ) -> v4 ) ) -> ( ( v1 -> -. v2 ) -> ( ( c5 -> c4 ) -> ( v4 -> v7 ) ) ) ) $=
+      wv4 wv3 wi wv4 wc0 wi wi wc3 wc5 wi wv4 wi wi wv1 wv2 wn wi wc5 wc4 wi
+      wv4 wv7 wi wi wi wi $.
+  wth22 $p wff ( -. ( ( v3 -> c0 ) -> -. c9 ) -> ( ( ( c9 -> v9 ) -> -. v2 ) -> ( ( v9 -> v9 ) -> ( v9 -> v0 ) ) ) ) $=
+      wv3 wc0 wi wc9 wn wi wn wc9 wv9 wi wv2 wn wi wv9 wv9 wi wv9 wv0 wi wi wi
+      wi $.
+  th254 $p |- ( v7 -> ( v7 -> ( -. ( ( c1 -> v7 ) -> c0 ) -> ( ( ( ( v3 -> v0 ) -> -. v0 ) -> -. ( v9 -> c7 ) ) -> ( ( c0 -> v7 ) -> ( v7 -> ( v7 -> ( c6 -> ( -. c3 -> ( ( c1 -> v6 ) -> ( c8 -> ( -. -. c3 -> -. ( ( c1 -> v6 ) -> ( c1 -> v6 ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv7 wc1 wv7 wi wc0 wi wn wv3 wv0 wi wv0 wn wi wv9 wc7 wi wn wi wc0 wv7 wi
+      wv7 wv7 wc6 wc3 wn wc1 wv6 wi wc8 wc3 wn wn wc1 wv6 wi wc1 wv6 wi wi wn
+      wi wi wi wi wi wi wi wi wi wi wi wv7 wv7 wc1 wv7 wi wc0 wi wn wv3 wv0 wi
+      wv0 wn wi wv9 wc7 wi wn wi wc0 wv7 wi wv7 wv7 wc6 wc3 wn wc1 wv6 wi wc8
+      wc3 wn wn wc1 wv6 wi wc1 wv6 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi
+      wc1 wv7 wi wc0 wi wn wv3 wv0 wi wv0 wn wi wv9 wc7 wi wn wi wc0 wv7 wi wv7
+      wv7 wc6 wc3 wn wc1 wv6 wi wc8 wc3 wn wn wc1 wv6 wi wc1 wv6 wi wi wn wi wi
+      wi wi wi wi wi wi wi wi wv7 wc1 wv7 wi wc0 wi wn wv3 wv0 wi wv0 wn wi wv9
+      wc7 wi wn wi wc0 wv7 wi wv7 wv7 wc6 wc3 wn wc1 wv6 wi wc8 wc3 wn wn wc1
+      wv6 wi wc1 wv6 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wv3 wv0 wi wv0
+      wn wi wv9 wc7 wi wn wi wc0 wv7 wi wv7 wv7 wc6 wc3 wn wc1 wv6 wi wc8 wc3
+      wn wn wc1 wv6 wi wc1 wv6 wi wi wn wi wi wi wi wi wi wi wi wi wc1 wv7 wi
+      wc0 wi wn wv3 wv0 wi wv0 wn wi wv9 wc7 wi wn wi wc0 wv7 wi wv7 wv7 wc6
+      wc3 wn wc1 wv6 wi wc8 wc3 wn wn wc1 wv6 wi wc1 wv6 wi wi wn wi wi wi wi
+      wi wi wi wi wi wi wc0 wv7 wi wv7 wv7 wc6 wc3 wn wc1 wv6 wi wc8 wc3 wn wn
+      wc1 wv6 wi wc1 wv6 wi wi wn wi wi wi wi wi wi wi wi wv3 wv0 wi wv0 wn wi
+      wv9 wc7 wi wn wi wc0 wv7 wi wv7 wv7 wc6 wc3 wn wc1 wv6 wi wc8 wc3 wn wn
+      wc1 wv6 wi wc1 wv6 wi wi wn wi wi wi wi wi wi wi wi wi wv6 wv7 wv7 th47
+      wc0 wv7 wi wv7 wv7 wc6 wc3 wn wc1 wv6 wi wc8 wc3 wn wn wc1 wv6 wi wc1 wv6
+      wi wi wn wi wi wi wi wi wi wi wi wv3 wv0 wi wv0 wn wi wv9 wc7 wi wn wi
+      ax-1 ax-mp wv3 wv0 wi wv0 wn wi wv9 wc7 wi wn wi wc0 wv7 wi wv7 wv7 wc6
+      wc3 wn wc1 wv6 wi wc8 wc3 wn wn wc1 wv6 wi wc1 wv6 wi wi wn wi wi wi wi
+      wi wi wi wi wi wc1 wv7 wi wc0 wi wn ax-1 ax-mp wc1 wv7 wi wc0 wi wn wv3
+      wv0 wi wv0 wn wi wv9 wc7 wi wn wi wc0 wv7 wi wv7 wv7 wc6 wc3 wn wc1 wv6
+      wi wc8 wc3 wn wn wc1 wv6 wi wc1 wv6 wi wi wn wi wi wi wi wi wi wi wi wi
+      wi wv7 ax-1 ax-mp wv7 wc1 wv7 wi wc0 wi wn wv3 wv0 wi wv0 wn wi wv9 wc7
+      wi wn wi wc0 wv7 wi wv7 wv7 wc6 wc3 wn wc1 wv6 wi wc8 wc3 wn wn wc1 wv6
+      wi wc1 wv6 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wv7 ax-1 ax-mp $.
+  th255 $p |- ( ( ( v3 -> ( v9 -> v1 ) ) -> v9 ) -> ( ( ( ( v0 -> v2 ) -> ( c2 -> v4 ) ) -> -. -. c3 ) -> ( ( ( c8 -> c2 ) -> ( ( v0 -> v2 ) -> ( c5 -> c3 ) ) ) -> ( c8 -> ( c8 -> ( ( c7 -> v3 ) -> ( v5 -> -. v5 ) ) ) ) ) ) ) $=
+      ( wi wc2 wc3 wn wc8 wc5 wc7 ax-g5 ax-1 ax-mp ) ACHIEHHJKKHZLIHACHMJHHHZLL
+      NDHZFFKZHZHZHZHZHZHZDGBHHGHZUGHUFUGUEUFUDUEUCUDUBUCUAUBFOUAFPQUBTPQUCLPQU
+      DLPQUESPQUFRPQUGUHPQ $.
+  th256 $p |- ( ( ( ( c2 -> c9 ) -> ( v1 -> c3 ) ) -> ( -. v5 -> v8 ) ) -> ( ( v1 -> v1 ) -> ( ( v1 -> v1 ) -> ( v9 -> ( -. ( ( v1 -> v1 ) -> ( c7 -> c2 ) ) -> -. ( v4 -> v4 ) ) ) ) ) ) $=
+      ( wi wc7 wc2 wn wc9 wc3 ax-g3 ax-1 ax-mp ) AAFZOEOGHFZFIBBFIFZFZFZFZHJFAK
+      FFCIDFFZTFSTRSQRBBOPLQEMNROMNSOMNTUAMN $.
+  th257 $p |- ( ( ( v7 -> -. v6 ) -> ( ( v8 -> v1 ) -> v2 ) ) -> ( ( ( ( v4 -> v5 ) -> -. v9 ) -> ( ( v0 -> c2 ) -> v8 ) ) -> ( ( ( ( c7 -> c1 ) -> v4 ) -> -. ( c6 -> v1 ) ) -> ( v1 -> ( v9 -> ( -. c0 -> ( ( v1 -> v2 ) -> ( ( v2 -> v2 ) -> ( -. ( v2 -> v2 ) -> -. ( ( v2 -> v2 ) -> ( v2 -> v2 ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wi wn wc2 wc7 wc1 wc6 wc0 th6 ax-1 ax-mp ) DEJIKJALJHJJZMNJDJOBJKJZBIPK
+      ZBCJCCJCCJKCCJCCJJKJJJZJZJZJZJZJZGFKJHBJCJJZUHJUGUHUFUGUEUFUDUEUCUDCCCBQU
+      CUBRSUDIRSUEBRSUFUARSUGTRSUHUIRS $.
+  th258 $p |- ( ( ( ( v0 -> v0 ) -> ( v7 -> c6 ) ) -> -. ( v8 -> v8 ) ) -> ( c8 -> ( c5 -> ( -. v7 -> ( -. v7 -> ( -. v7 -> ( v9 -> ( v1 -> ( ( v1 -> c8 ) -> ( c3 -> ( ( c1 -> ( ( v1 -> c3 ) -> ( c9 -> v1 ) ) ) -> ( c3 -> ( ( c1 -> ( ( v1 -> c3 ) -> ( c9 -> v1 ) ) ) -> ( v1 -> c8 ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc8 wc5 wn wi wc3 wc1 wc9 wc6 th129 ax-1 ax-mp ) FGCHZQQEBBFIJKBJILBIII
+      JKBJILBIIIBFIIIIIIZIZIZIZIZIZIZIZAAICMIIDDIHIZUEIUDUEUCUDUBUCUAUBTUASTRSB
+      BFNRBOPSEOPTQOPUAQOPUBQOPUCGOPUDFOPUEUFOP $.
+  th259 $p |- ( ( ( ( v0 -> v3 ) -> c2 ) -> v3 ) -> ( ( ( -. c4 -> c1 ) -> v2 ) -> ( ( ( v1 -> ( v0 -> c8 ) ) -> ( ( v8 -> c2 ) -> v7 ) ) -> ( v5 -> ( -. v4 -> ( ( ( c4 -> v2 ) -> ( ( c4 -> v2 ) -> ( c4 -> v2 ) ) ) -> ( ( ( c4 -> v2 ) -> ( c4 -> v2 ) ) -> ( ( c4 -> v2 ) -> ( c4 -> v2 ) ) ) ) ) ) ) ) ) $=
+      wc4 wn wc1 wi wv2 wi wv1 wv0 wc8 wi wi wv8 wc2 wi wv7 wi wi wv5 wv4 wn
+      wc4 wv2 wi wc4 wv2 wi wc4 wv2 wi wi wi wc4 wv2 wi wc4 wv2 wi wi wc4 wv2
+      wi wc4 wv2 wi wi wi wi wi wi wi wi wv0 wv3 wi wc2 wi wv3 wi wc4 wn wc1 wi
+      wv2 wi wv1 wv0 wc8 wi wi wv8 wc2 wi wv7 wi wi wv5 wv4 wn wc4 wv2 wi wc4
+      wv2 wi wc4 wv2 wi wi wi wc4 wv2 wi wc4 wv2 wi wi wc4 wv2 wi wc4 wv2 wi wi
+      wi wi wi wi wi wi wi wv1 wv0 wc8 wi wi wv8 wc2 wi wv7 wi wi wv5 wv4 wn
+      wc4 wv2 wi wc4 wv2 wi wc4 wv2 wi wi wi wc4 wv2 wi wc4 wv2 wi wi wc4 wv2
+      wi wc4 wv2 wi wi wi wi wi wi wi wc4 wn wc1 wi wv2 wi wv1 wv0 wc8 wi wi
+      wv8 wc2 wi wv7 wi wi wv5 wv4 wn wc4 wv2 wi wc4 wv2 wi wc4 wv2 wi wi wi
+      wc4 wv2 wi wc4 wv2 wi wi wc4 wv2 wi wc4 wv2 wi wi wi wi wi wi wi wi wv5
+      wv4 wn wc4 wv2 wi wc4 wv2 wi wc4 wv2 wi wi wi wc4 wv2 wi wc4 wv2 wi wi
+      wc4 wv2 wi wc4 wv2 wi wi wi wi wi wi wv1 wv0 wc8 wi wi wv8 wc2 wi wv7 wi
+      wi wv5 wv4 wn wc4 wv2 wi wc4 wv2 wi wc4 wv2 wi wi wi wc4 wv2 wi wc4 wv2
+      wi wi wc4 wv2 wi wc4 wv2 wi wi wi wi wi wi wi wv4 wn wc4 wv2 wi wc4 wv2
+      wi wc4 wv2 wi wi wi wc4 wv2 wi wc4 wv2 wi wi wc4 wv2 wi wc4 wv2 wi wi wi
+      wi wi wv5 wv4 wn wc4 wv2 wi wc4 wv2 wi wc4 wv2 wi wi wi wc4 wv2 wi wc4
+      wv2 wi wi wc4 wv2 wi wc4 wv2 wi wi wi wi wi wi wc4 wv2 wi wc4 wv2 wi wc4
+      wv2 wi wi wi wc4 wv2 wi wc4 wv2 wi wi wc4 wv2 wi wc4 wv2 wi wi wi wi wv4
+      wn wc4 wv2 wi wc4 wv2 wi wc4 wv2 wi wi wi wc4 wv2 wi wc4 wv2 wi wi wc4
+      wv2 wi wc4 wv2 wi wi wi wi wi wc4 wv2 wi wc4 wv2 wi wc4 wv2 wi ax-2 wc4
+      wv2 wi wc4 wv2 wi wc4 wv2 wi wi wi wc4 wv2 wi wc4 wv2 wi wi wc4 wv2 wi
+      wc4 wv2 wi wi wi wi wv4 wn ax-1 ax-mp wv4 wn wc4 wv2 wi wc4 wv2 wi wc4
+      wv2 wi wi wi wc4 wv2 wi wc4 wv2 wi wi wc4 wv2 wi wc4 wv2 wi wi wi wi wi
+      wv5 ax-1 ax-mp wv5 wv4 wn wc4 wv2 wi wc4 wv2 wi wc4 wv2 wi wi wi wc4 wv2
+      wi wc4 wv2 wi wi wc4 wv2 wi wc4 wv2 wi wi wi wi wi wi wv1 wv0 wc8 wi wi
+      wv8 wc2 wi wv7 wi wi ax-1 ax-mp wv1 wv0 wc8 wi wi wv8 wc2 wi wv7 wi wi
+      wv5 wv4 wn wc4 wv2 wi wc4 wv2 wi wc4 wv2 wi wi wi wc4 wv2 wi wc4 wv2 wi
+      wi wc4 wv2 wi wc4 wv2 wi wi wi wi wi wi wi wc4 wn wc1 wi wv2 wi ax-1
+      ax-mp wc4 wn wc1 wi wv2 wi wv1 wv0 wc8 wi wi wv8 wc2 wi wv7 wi wi wv5 wv4
+      wn wc4 wv2 wi wc4 wv2 wi wc4 wv2 wi wi wi wc4 wv2 wi wc4 wv2 wi wi wc4
+      wv2 wi wc4 wv2 wi wi wi wi wi wi wi wi wv0 wv3 wi wc2 wi wv3 wi ax-1
+      ax-mp $.
+  th260 $p |- ( -. ( ( c1 -> v1 ) -> ( v9 -> v3 ) ) -> ( ( -. ( v3 -> v2 ) -> ( ( v0 -> c8 ) -> ( v6 -> c6 ) ) ) -> ( -. ( v2 -> ( v0 -> v3 ) ) -> ( v9 -> ( v9 -> ( -. ( ( v0 -> c8 ) -> v9 ) -> ( -. ( v9 -> v9 ) -> -. ( ( c8 -> v9 ) -> ( c8 -> v9 ) ) ) ) ) ) ) ) ) $=
+      ( wi wn wc8 wc6 wc1 th117 ax-1 ax-mp ) DCGHAIGEJGGGZCADGGHZFFAIGFGHFFGHIF
+      GIFGGHGGGZGZGZGZKBGFDGGHZTGSTRSQRIFFALQFMNRPMNSOMNTUAMN $.
+  th261 $p |- ( ( -. v5 -> ( ( v0 -> c9 ) -> ( v4 -> v3 ) ) ) -> ( v0 -> ( c4 -> ( -. ( ( c7 -> c4 ) -> ( c7 -> c7 ) ) -> ( v0 -> ( -. ( ( c7 -> c4 ) -> ( c7 -> c7 ) ) -> ( -. ( ( c7 -> c4 ) -> ( c7 -> c7 ) ) -> ( -. ( v7 -> v7 ) -> -. ( ( v7 -> v7 ) -> ( v7 -> v7 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc4 wc7 wi wn wc9 th4 ax-1 ax-mp ) AFGFHGGHHIAGFHGGHHIGFHGGHHIEEHIEEHEE
+      HHIHHHHHZHZHZDIAJHCBHHHZPHOPNOFEGEAGKNFLMOALMPQLM $.
+  th262 $p |- ( ( ( v8 -> -. v0 ) -> v9 ) -> ( ( v7 -> v4 ) -> ( ( ( v0 -> v4 ) -> ( ( v8 -> v1 ) -> v5 ) ) -> ( ( v7 -> v4 ) -> ( ( -. ( v7 -> v4 ) -> -. ( v7 -> v4 ) ) -> ( ( v7 -> v4 ) -> ( v7 -> v4 ) ) ) ) ) ) ) $=
+      ( wv3 wi wn ax-1 ax-3 ax-mp ) HHHIIZFAJIGIZECIZACIFBIDIIZPPJPJIPPIIZIZIZI
+      ZIZHHKUBNUBIUAUBTUASTRSPPLRPKMSQKMTPKMUAOKMUBNKMM $.
+  th263 $p |- ( -. ( ( v5 -> v7 ) -> ( c5 -> v7 ) ) -> ( ( -. ( v9 -> v3 ) -> -. v3 ) -> ( ( ( v4 -> ( v8 -> v1 ) ) -> ( ( c0 -> v3 ) -> ( v5 -> v0 ) ) ) -> ( ( ( -. c7 -> v9 ) -> ( c0 -> ( v0 -> c8 ) ) ) -> ( c8 -> ( ( v9 -> c2 ) -> ( ( -. v7 -> ( ( c5 -> v5 ) -> ( v9 -> c2 ) ) ) -> ( ( -. v7 -> ( c5 -> v5 ) ) -> ( -. v7 -> ( v9 -> c2 ) ) ) ) ) ) ) ) ) ) $=
+      wv2 wv2 wv2 wi wi wv5 wv7 wi wc5 wv7 wi wi wn wv9 wv3 wi wn wv3 wn wi wv4
+      wv8 wv1 wi wi wc0 wv3 wi wv5 wv0 wi wi wi wc7 wn wv9 wi wc0 wv0 wc8 wi wi
+      wi wc8 wv9 wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi wv7 wn wc5 wv5 wi wi
+      wv7 wn wv9 wc2 wi wi wi wi wi wi wi wi wi wi wv2 wv2 ax-1 wv5 wv7 wi wc5
+      wv7 wi wi wn wv9 wv3 wi wn wv3 wn wi wv4 wv8 wv1 wi wi wc0 wv3 wi wv5 wv0
+      wi wi wi wc7 wn wv9 wi wc0 wv0 wc8 wi wi wi wc8 wv9 wc2 wi wv7 wn wc5 wv5
+      wi wv9 wc2 wi wi wi wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wi wi
+      wi wi wi wi wv2 wv2 wv2 wi wi wv5 wv7 wi wc5 wv7 wi wi wn wv9 wv3 wi wn
+      wv3 wn wi wv4 wv8 wv1 wi wi wc0 wv3 wi wv5 wv0 wi wi wi wc7 wn wv9 wi wc0
+      wv0 wc8 wi wi wi wc8 wv9 wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi wv7 wn
+      wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wi wi wi wi wi wi wi wv9 wv3 wi
+      wn wv3 wn wi wv4 wv8 wv1 wi wi wc0 wv3 wi wv5 wv0 wi wi wi wc7 wn wv9 wi
+      wc0 wv0 wc8 wi wi wi wc8 wv9 wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi
+      wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wi wi wi wi wi wv5 wv7 wi
+      wc5 wv7 wi wi wn wv9 wv3 wi wn wv3 wn wi wv4 wv8 wv1 wi wi wc0 wv3 wi wv5
+      wv0 wi wi wi wc7 wn wv9 wi wc0 wv0 wc8 wi wi wi wc8 wv9 wc2 wi wv7 wn wc5
+      wv5 wi wv9 wc2 wi wi wi wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi
+      wi wi wi wi wi wi wv4 wv8 wv1 wi wi wc0 wv3 wi wv5 wv0 wi wi wi wc7 wn
+      wv9 wi wc0 wv0 wc8 wi wi wi wc8 wv9 wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi
+      wi wi wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wi wi wi wi wv9 wv3
+      wi wn wv3 wn wi wv4 wv8 wv1 wi wi wc0 wv3 wi wv5 wv0 wi wi wi wc7 wn wv9
+      wi wc0 wv0 wc8 wi wi wi wc8 wv9 wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi
+      wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wi wi wi wi wi wc7 wn wv9
+      wi wc0 wv0 wc8 wi wi wi wc8 wv9 wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi
+      wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wi wi wi wv4 wv8 wv1 wi
+      wi wc0 wv3 wi wv5 wv0 wi wi wi wc7 wn wv9 wi wc0 wv0 wc8 wi wi wi wc8 wv9
+      wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi wv7 wn wc5 wv5 wi wi wv7 wn wv9
+      wc2 wi wi wi wi wi wi wi wi wc8 wv9 wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi
+      wi wi wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wi wi wc7 wn wv9 wi
+      wc0 wv0 wc8 wi wi wi wc8 wv9 wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi
+      wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wi wi wi wv9 wc2 wi wv7
+      wn wc5 wv5 wi wv9 wc2 wi wi wi wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi
+      wi wi wi wc8 wv9 wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi wv7 wn wc5 wv5
+      wi wi wv7 wn wv9 wc2 wi wi wi wi wi wi wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi
+      wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wv9 wc2 wi wv7 wn wc5 wv5
+      wi wv9 wc2 wi wi wi wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wi
+      wv7 wn wc5 wv5 wi wv9 wc2 wi ax-2 wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi wv7
+      wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wv9 wc2 wi ax-1 ax-mp wv9 wc2
+      wi wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2
+      wi wi wi wi wi wc8 ax-1 ax-mp wc8 wv9 wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi
+      wi wi wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wi wi wc7 wn wv9 wi
+      wc0 wv0 wc8 wi wi wi ax-1 ax-mp wc7 wn wv9 wi wc0 wv0 wc8 wi wi wi wc8
+      wv9 wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi wv7 wn wc5 wv5 wi wi wv7 wn
+      wv9 wc2 wi wi wi wi wi wi wi wv4 wv8 wv1 wi wi wc0 wv3 wi wv5 wv0 wi wi
+      wi ax-1 ax-mp wv4 wv8 wv1 wi wi wc0 wv3 wi wv5 wv0 wi wi wi wc7 wn wv9 wi
+      wc0 wv0 wc8 wi wi wi wc8 wv9 wc2 wi wv7 wn wc5 wv5 wi wv9 wc2 wi wi wi
+      wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wi wi wi wi wv9 wv3 wi wn
+      wv3 wn wi ax-1 ax-mp wv9 wv3 wi wn wv3 wn wi wv4 wv8 wv1 wi wi wc0 wv3 wi
+      wv5 wv0 wi wi wi wc7 wn wv9 wi wc0 wv0 wc8 wi wi wi wc8 wv9 wc2 wi wv7 wn
+      wc5 wv5 wi wv9 wc2 wi wi wi wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi
+      wi wi wi wi wi wi wv5 wv7 wi wc5 wv7 wi wi wn ax-1 ax-mp wv5 wv7 wi wc5
+      wv7 wi wi wn wv9 wv3 wi wn wv3 wn wi wv4 wv8 wv1 wi wi wc0 wv3 wi wv5 wv0
+      wi wi wi wc7 wn wv9 wi wc0 wv0 wc8 wi wi wi wc8 wv9 wc2 wi wv7 wn wc5 wv5
+      wi wv9 wc2 wi wi wi wv7 wn wc5 wv5 wi wi wv7 wn wv9 wc2 wi wi wi wi wi wi
+      wi wi wi wi wv2 wv2 wv2 wi wi ax-1 ax-mp ax-mp $.
+  th264 $p |- ( ( v2 -> c8 ) -> ( -. c5 -> ( -. v3 -> ( -. -. ( c4 -> c5 ) -> -. ( v2 -> c8 ) ) ) ) ) $=
+      wc5 wn wv3 wn wc4 wc5 wi wn wn wv2 wc8 wi wn wi wi wi wv2 wc8 wi wc5 wn
+      wv3 wn wc4 wc5 wi wn wn wv2 wc8 wi wn wi wi wi wi wv3 wn wc4 wc5 wi wn wn
+      wv2 wc8 wi wn wi wi wc5 wn wv3 wn wc4 wc5 wi wn wn wv2 wc8 wi wn wi wi wi
+      wc4 wc5 wi wn wn wv2 wc8 wi wn wi wv3 wn wc4 wc5 wi wn wn wv2 wc8 wi wn
+      wi wi wv2 wc8 wi wn wc4 wc5 wi wn wn wv2 wc8 wi wn wi wv2 wc8 wi ax-g5
+      wv2 wc8 wi wn wc4 wc5 wi wn wn ax-1 ax-mp wc4 wc5 wi wn wn wv2 wc8 wi wn
+      wi wv3 wn ax-1 ax-mp wv3 wn wc4 wc5 wi wn wn wv2 wc8 wi wn wi wi wc5 wn
+      ax-1 ax-mp wc5 wn wv3 wn wc4 wc5 wi wn wn wv2 wc8 wi wn wi wi wi wv2 wc8
+      wi ax-1 ax-mp $.
+  th265 $p |- ( ( ( c2 -> ( v2 -> v8 ) ) -> ( ( v6 -> v6 ) -> ( v2 -> v8 ) ) ) -> ( v8 -> ( v7 -> ( -. c4 -> ( c9 -> ( c9 -> ( -. ( ( v8 -> v8 ) -> -. c6 ) -> -. ( ( v1 -> c2 ) -> c9 ) ) ) ) ) ) ) ) $=
+      wv8 wv7 wc4 wn wc9 wc9 wv8 wv8 wi wc6 wn wi wn wv1 wc2 wi wc9 wi wn wi wi
+      wi wi wi wi wc2 wv2 wv8 wi wi wv6 wv6 wi wv2 wv8 wi wi wi wv8 wv7 wc4 wn
+      wc9 wc9 wv8 wv8 wi wc6 wn wi wn wv1 wc2 wi wc9 wi wn wi wi wi wi wi wi wi
+      wv7 wc4 wn wc9 wc9 wv8 wv8 wi wc6 wn wi wn wv1 wc2 wi wc9 wi wn wi wi wi
+      wi wi wv8 wv7 wc4 wn wc9 wc9 wv8 wv8 wi wc6 wn wi wn wv1 wc2 wi wc9 wi wn
+      wi wi wi wi wi wi wc4 wn wc9 wc9 wv8 wv8 wi wc6 wn wi wn wv1 wc2 wi wc9
+      wi wn wi wi wi wi wv7 wc4 wn wc9 wc9 wv8 wv8 wi wc6 wn wi wn wv1 wc2 wi
+      wc9 wi wn wi wi wi wi wi wc9 wc9 wv8 wv8 wi wc6 wn wi wn wv1 wc2 wi wc9
+      wi wn wi wi wi wc4 wn wc9 wc9 wv8 wv8 wi wc6 wn wi wn wv1 wc2 wi wc9 wi
+      wn wi wi wi wi wv1 wc6 wv8 th225 wc9 wc9 wv8 wv8 wi wc6 wn wi wn wv1 wc2
+      wi wc9 wi wn wi wi wi wc4 wn ax-1 ax-mp wc4 wn wc9 wc9 wv8 wv8 wi wc6 wn
+      wi wn wv1 wc2 wi wc9 wi wn wi wi wi wi wv7 ax-1 ax-mp wv7 wc4 wn wc9 wc9
+      wv8 wv8 wi wc6 wn wi wn wv1 wc2 wi wc9 wi wn wi wi wi wi wi wv8 ax-1
+      ax-mp wv8 wv7 wc4 wn wc9 wc9 wv8 wv8 wi wc6 wn wi wn wv1 wc2 wi wc9 wi wn
+      wi wi wi wi wi wi wc2 wv2 wv8 wi wi wv6 wv6 wi wv2 wv8 wi wi wi ax-1
+      ax-mp $.
+  th266 $p |- ( v1 -> ( v1 -> ( v8 -> ( v8 -> ( v6 -> ( ( ( c7 -> ( c4 -> v1 ) ) -> -. v7 ) -> ( ( v1 -> c3 ) -> ( ( ( ( v6 -> v7 ) -> -. c8 ) -> ( ( c7 -> v6 ) -> -. c8 ) ) -> -. ( ( -. c6 -> v6 ) -> ( v8 -> v8 ) ) ) ) ) ) ) ) ) ) $=
+      wv1 wv8 wv8 wv6 wc7 wc4 wv1 wi wi wv7 wn wi wv1 wc3 wi wv6 wv7 wi wc8 wn
+      wi wc7 wv6 wi wc8 wn wi wi wc6 wn wv6 wi wv8 wv8 wi wi wn wi wi wi wi wi
+      wi wi wv1 wv1 wv8 wv8 wv6 wc7 wc4 wv1 wi wi wv7 wn wi wv1 wc3 wi wv6 wv7
+      wi wc8 wn wi wc7 wv6 wi wc8 wn wi wi wc6 wn wv6 wi wv8 wv8 wi wi wn wi wi
+      wi wi wi wi wi wi wv8 wv8 wv6 wc7 wc4 wv1 wi wi wv7 wn wi wv1 wc3 wi wv6
+      wv7 wi wc8 wn wi wc7 wv6 wi wc8 wn wi wi wc6 wn wv6 wi wv8 wv8 wi wi wn
+      wi wi wi wi wi wi wv1 wv8 wv8 wv6 wc7 wc4 wv1 wi wi wv7 wn wi wv1 wc3 wi
+      wv6 wv7 wi wc8 wn wi wc7 wv6 wi wc8 wn wi wi wc6 wn wv6 wi wv8 wv8 wi wi
+      wn wi wi wi wi wi wi wi wv8 wv6 wc7 wc4 wv1 wi wi wv7 wn wi wv1 wc3 wi
+      wv6 wv7 wi wc8 wn wi wc7 wv6 wi wc8 wn wi wi wc6 wn wv6 wi wv8 wv8 wi wi
+      wn wi wi wi wi wi wv8 wv8 wv6 wc7 wc4 wv1 wi wi wv7 wn wi wv1 wc3 wi wv6
+      wv7 wi wc8 wn wi wc7 wv6 wi wc8 wn wi wi wc6 wn wv6 wi wv8 wv8 wi wi wn
+      wi wi wi wi wi wi wv7 wv8 wv6 wv6 wv1 wv1 th164 wv8 wv6 wc7 wc4 wv1 wi wi
+      wv7 wn wi wv1 wc3 wi wv6 wv7 wi wc8 wn wi wc7 wv6 wi wc8 wn wi wi wc6 wn
+      wv6 wi wv8 wv8 wi wi wn wi wi wi wi wi wv8 ax-1 ax-mp wv8 wv8 wv6 wc7 wc4
+      wv1 wi wi wv7 wn wi wv1 wc3 wi wv6 wv7 wi wc8 wn wi wc7 wv6 wi wc8 wn wi
+      wi wc6 wn wv6 wi wv8 wv8 wi wi wn wi wi wi wi wi wi wv1 ax-1 ax-mp wv1
+      wv8 wv8 wv6 wc7 wc4 wv1 wi wi wv7 wn wi wv1 wc3 wi wv6 wv7 wi wc8 wn wi
+      wc7 wv6 wi wc8 wn wi wi wc6 wn wv6 wi wv8 wv8 wi wi wn wi wi wi wi wi wi
+      wi wv1 ax-1 ax-mp $.
+  th267 $p |- ( ( c7 -> ( v1 -> ( c1 -> v1 ) ) ) -> ( ( ( ( c1 -> c3 ) -> -. c2 ) -> ( v0 -> ( v9 -> v2 ) ) ) -> ( ( v5 -> v0 ) -> ( ( ( ( c4 -> c8 ) -> c0 ) -> ( ( v8 -> c6 ) -> c4 ) ) -> ( ( v1 -> -. ( v2 -> v7 ) ) -> ( ( -. v8 -> -. v8 ) -> ( v8 -> v8 ) ) ) ) ) ) ) $=
+      ( wc1 wc3 wi wc2 wn wc4 wc8 wc0 wc6 wc7 ax-3 ax-1 ax-mp ) HIJKLJAGCJJJZDA
+      JZMNJOJFPJMJJZBCEJLJZFLFLJFFJJZJZJZJZJZQBHBJJJZUIJUHUIUGUHUFUGUEUFFFRUEUD
+      STUFUCSTUGUBSTUHUASTUIUJST $.
+  th268 $p |- ( ( v1 -> ( v7 -> ( v5 -> v2 ) ) ) -> ( v2 -> ( ( ( ( c7 -> v5 ) -> c9 ) -> c7 ) -> ( v0 -> ( ( v2 -> c7 ) -> ( ( v2 -> c7 ) -> -. ( ( ( v1 -> v2 ) -> ( v2 -> c7 ) ) -> ( ( v5 -> v4 ) -> ( v5 -> v4 ) ) ) ) ) ) ) ) ) $=
+      wv2 wc7 wv5 wi wc9 wi wc7 wi wv0 wv2 wc7 wi wv2 wc7 wi wv1 wv2 wi wv2 wc7
+      wi wi wv5 wv4 wi wv5 wv4 wi wi wi wn wi wi wi wi wi wv1 wv7 wv5 wv2 wi wi
+      wi wv2 wc7 wv5 wi wc9 wi wc7 wi wv0 wv2 wc7 wi wv2 wc7 wi wv1 wv2 wi wv2
+      wc7 wi wi wv5 wv4 wi wv5 wv4 wi wi wi wn wi wi wi wi wi wi wc7 wv5 wc7
+      wv5 wv1 wv2 wv2 wv0 wv4 th220 wv2 wc7 wv5 wi wc9 wi wc7 wi wv0 wv2 wc7 wi
+      wv2 wc7 wi wv1 wv2 wi wv2 wc7 wi wi wv5 wv4 wi wv5 wv4 wi wi wi wn wi wi
+      wi wi wi wv1 wv7 wv5 wv2 wi wi wi ax-1 ax-mp $.
+  th269 $p |- ( ( ( ( c5 -> v7 ) -> -. c3 ) -> ( ( c9 -> v1 ) -> -. v1 ) ) -> ( ( ( c3 -> ( v6 -> v4 ) ) -> ( ( v4 -> c2 ) -> ( v0 -> v6 ) ) ) -> ( ( -. -. c8 -> v9 ) -> ( ( ( -. v2 -> ( v0 -> v9 ) ) -> ( ( c3 -> c8 ) -> ( v0 -> v7 ) ) ) -> ( ( ( ( c5 -> v7 ) -> -. c3 ) -> ( ( c9 -> v1 ) -> -. v1 ) ) -> -. ( v3 -> v3 ) ) ) ) ) ) $=
+      wv8 wv8 wv8 wi wi wc5 wv7 wi wc3 wn wi wc9 wv1 wi wv1 wn wi wi wc3 wv6
+      wv4 wi wi wv4 wc2 wi wv0 wv6 wi wi wi wc8 wn wn wv9 wi wv2 wn wv0 wv9 wi
+      wi wc3 wc8 wi wv0 wv7 wi wi wi wc5 wv7 wi wc3 wn wi wc9 wv1 wi wv1 wn wi
+      wi wv3 wv3 wi wn wi wi wi wi wi wv8 wv8 ax-1 wc5 wv7 wi wc3 wn wi wc9 wv1
+      wi wv1 wn wi wi wc3 wv6 wv4 wi wi wv4 wc2 wi wv0 wv6 wi wi wi wc8 wn wn
+      wv9 wi wv2 wn wv0 wv9 wi wi wc3 wc8 wi wv0 wv7 wi wi wi wc5 wv7 wi wc3 wn
+      wi wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi wn wi wi wi wi wi wv8 wv8 wv8 wi wi
+      wc5 wv7 wi wc3 wn wi wc9 wv1 wi wv1 wn wi wi wc3 wv6 wv4 wi wi wv4 wc2 wi
+      wv0 wv6 wi wi wi wc8 wn wn wv9 wi wv2 wn wv0 wv9 wi wi wc3 wc8 wi wv0 wv7
+      wi wi wi wc5 wv7 wi wc3 wn wi wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi wn wi wi
+      wi wi wi wi wc3 wv6 wv4 wi wi wv4 wc2 wi wv0 wv6 wi wi wi wc8 wn wn wv9
+      wi wv2 wn wv0 wv9 wi wi wc3 wc8 wi wv0 wv7 wi wi wi wc5 wv7 wi wc3 wn wi
+      wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi wn wi wi wi wi wc5 wv7 wi wc3 wn wi
+      wc9 wv1 wi wv1 wn wi wi wc3 wv6 wv4 wi wi wv4 wc2 wi wv0 wv6 wi wi wi wc8
+      wn wn wv9 wi wv2 wn wv0 wv9 wi wi wc3 wc8 wi wv0 wv7 wi wi wi wc5 wv7 wi
+      wc3 wn wi wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi wn wi wi wi wi wi wc8 wn wn
+      wv9 wi wv2 wn wv0 wv9 wi wi wc3 wc8 wi wv0 wv7 wi wi wi wc5 wv7 wi wc3 wn
+      wi wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi wn wi wi wi wc3 wv6 wv4 wi wi wv4
+      wc2 wi wv0 wv6 wi wi wi wc8 wn wn wv9 wi wv2 wn wv0 wv9 wi wi wc3 wc8 wi
+      wv0 wv7 wi wi wi wc5 wv7 wi wc3 wn wi wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi
+      wn wi wi wi wi wv2 wn wv0 wv9 wi wi wc3 wc8 wi wv0 wv7 wi wi wi wc5 wv7
+      wi wc3 wn wi wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi wn wi wi wc8 wn wn wv9 wi
+      wv2 wn wv0 wv9 wi wi wc3 wc8 wi wv0 wv7 wi wi wi wc5 wv7 wi wc3 wn wi wc9
+      wv1 wi wv1 wn wi wi wv3 wv3 wi wn wi wi wi wc5 wv7 wi wc3 wn wi wc9 wv1
+      wi wv1 wn wi wi wv3 wv3 wi wn wi wv2 wn wv0 wv9 wi wi wc3 wc8 wi wv0 wv7
+      wi wi wi wc5 wv7 wi wc3 wn wi wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi wn wi wi
+      wv3 wv3 wi wn wc5 wv7 wi wc3 wn wi wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi wn
+      wi wv3 wv3 wi ax-g5 wv3 wv3 wi wn wc5 wv7 wi wc3 wn wi wc9 wv1 wi wv1 wn
+      wi wi ax-1 ax-mp wc5 wv7 wi wc3 wn wi wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi
+      wn wi wv2 wn wv0 wv9 wi wi wc3 wc8 wi wv0 wv7 wi wi wi ax-1 ax-mp wv2 wn
+      wv0 wv9 wi wi wc3 wc8 wi wv0 wv7 wi wi wi wc5 wv7 wi wc3 wn wi wc9 wv1 wi
+      wv1 wn wi wi wv3 wv3 wi wn wi wi wc8 wn wn wv9 wi ax-1 ax-mp wc8 wn wn
+      wv9 wi wv2 wn wv0 wv9 wi wi wc3 wc8 wi wv0 wv7 wi wi wi wc5 wv7 wi wc3 wn
+      wi wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi wn wi wi wi wc3 wv6 wv4 wi wi wv4
+      wc2 wi wv0 wv6 wi wi wi ax-1 ax-mp wc3 wv6 wv4 wi wi wv4 wc2 wi wv0 wv6
+      wi wi wi wc8 wn wn wv9 wi wv2 wn wv0 wv9 wi wi wc3 wc8 wi wv0 wv7 wi wi
+      wi wc5 wv7 wi wc3 wn wi wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi wn wi wi wi wi
+      wc5 wv7 wi wc3 wn wi wc9 wv1 wi wv1 wn wi wi ax-1 ax-mp wc5 wv7 wi wc3 wn
+      wi wc9 wv1 wi wv1 wn wi wi wc3 wv6 wv4 wi wi wv4 wc2 wi wv0 wv6 wi wi wi
+      wc8 wn wn wv9 wi wv2 wn wv0 wv9 wi wi wc3 wc8 wi wv0 wv7 wi wi wi wc5 wv7
+      wi wc3 wn wi wc9 wv1 wi wv1 wn wi wi wv3 wv3 wi wn wi wi wi wi wi wv8 wv8
+      wv8 wi wi ax-1 ax-mp ax-mp $.
+  th270 $p |- ( ( ( c4 -> ( c9 -> v3 ) ) -> ( ( v3 -> v0 ) -> ( c2 -> v5 ) ) ) -> ( v6 -> ( v7 -> ( c2 -> ( v7 -> -. v7 ) ) ) ) ) $=
+      wv6 wv7 wc2 wv7 wv7 wn wi wi wi wi wc4 wc9 wv3 wi wi wv3 wv0 wi wc2 wv5
+      wi wi wi wv6 wv7 wc2 wv7 wv7 wn wi wi wi wi wi wv7 wc2 wv7 wv7 wn wi wi
+      wi wv6 wv7 wc2 wv7 wv7 wn wi wi wi wi wc2 wv7 wv7 wn wi wi wv7 wc2 wv7
+      wv7 wn wi wi wi wv7 wv7 wn wi wc2 wv7 wv7 wn wi wi wv7 wn wv7 wv7 wn wi
+      wv7 ax-g5 wv7 wn wv7 ax-1 ax-mp wv7 wv7 wn wi wc2 ax-1 ax-mp wc2 wv7 wv7
+      wn wi wi wv7 ax-1 ax-mp wv7 wc2 wv7 wv7 wn wi wi wi wv6 ax-1 ax-mp wv6
+      wv7 wc2 wv7 wv7 wn wi wi wi wi wc4 wc9 wv3 wi wi wv3 wv0 wi wc2 wv5 wi wi
+      wi ax-1 ax-mp $.
+  ${
+    $d v1 v6 $.
+    $d v1 v7 $.
+    th271 $p |- ( ( ( -. v4 -> -. v9 ) -> ( ( v6 -> v8 ) -> ( v5 -> c9 ) ) ) -> ( -. ( -. v3 -> -. v1 ) -> -. ( ( v6 -> v7 ) -> ( v6 -> v7 ) ) ) ) $=
+      wv3 wn wv1 wn wi wn wv6 wv7 wi wv6 wv7 wi wi wn wi wv4 wn wv9 wn wi wv6
+      wv8 wi wv5 wc9 wi wi wi wv3 wn wv1 wn wi wn wv6 wv7 wi wv6 wv7 wi wi wn
+      wi wi wv6 wv7 wi wv6 wv7 wi wv3 wn wv1 wn ax-g3 wv3 wn wv1 wn wi wn wv6
+      wv7 wi wv6 wv7 wi wi wn wi wv4 wn wv9 wn wi wv6 wv8 wi wv5 wc9 wi wi wi
+      ax-1 ax-mp $.
+  $}
+  ${
+    $d v1 v6 $.
+    $d v6 v8 $.
+    th272 $p |- ( -. ( -. v3 -> c3 ) -> ( ( v8 -> v1 ) -> ( ( ( v7 -> ( v8 -> v9 ) ) -> ( v6 -> -. c9 ) ) -> ( ( -. v1 -> ( ( c2 -> v4 ) -> ( c0 -> v5 ) ) ) -> ( ( ( ( c9 -> v9 ) -> -. v5 ) -> v7 ) -> ( ( c3 -> v3 ) -> ( -. ( ( c3 -> v3 ) -> v6 ) -> -. ( v6 -> ( v8 -> v1 ) ) ) ) ) ) ) ) ) $=
+      wv8 wv1 wi wv7 wv8 wv9 wi wi wv6 wc9 wn wi wi wv1 wn wc2 wv4 wi wc0 wv5
+      wi wi wi wc9 wv9 wi wv5 wn wi wv7 wi wc3 wv3 wi wc3 wv3 wi wv6 wi wn wv6
+      wv8 wv1 wi wi wn wi wi wi wi wi wi wv3 wn wc3 wi wn wv8 wv1 wi wv7 wv8
+      wv9 wi wi wv6 wc9 wn wi wi wv1 wn wc2 wv4 wi wc0 wv5 wi wi wi wc9 wv9 wi
+      wv5 wn wi wv7 wi wc3 wv3 wi wc3 wv3 wi wv6 wi wn wv6 wv8 wv1 wi wi wn wi
+      wi wi wi wi wi wi wv7 wv8 wv9 wi wi wv6 wc9 wn wi wi wv1 wn wc2 wv4 wi
+      wc0 wv5 wi wi wi wc9 wv9 wi wv5 wn wi wv7 wi wc3 wv3 wi wc3 wv3 wi wv6 wi
+      wn wv6 wv8 wv1 wi wi wn wi wi wi wi wi wv8 wv1 wi wv7 wv8 wv9 wi wi wv6
+      wc9 wn wi wi wv1 wn wc2 wv4 wi wc0 wv5 wi wi wi wc9 wv9 wi wv5 wn wi wv7
+      wi wc3 wv3 wi wc3 wv3 wi wv6 wi wn wv6 wv8 wv1 wi wi wn wi wi wi wi wi wi
+      wv1 wn wc2 wv4 wi wc0 wv5 wi wi wi wc9 wv9 wi wv5 wn wi wv7 wi wc3 wv3 wi
+      wc3 wv3 wi wv6 wi wn wv6 wv8 wv1 wi wi wn wi wi wi wi wv7 wv8 wv9 wi wi
+      wv6 wc9 wn wi wi wv1 wn wc2 wv4 wi wc0 wv5 wi wi wi wc9 wv9 wi wv5 wn wi
+      wv7 wi wc3 wv3 wi wc3 wv3 wi wv6 wi wn wv6 wv8 wv1 wi wi wn wi wi wi wi
+      wi wc9 wv9 wi wv5 wn wi wv7 wi wc3 wv3 wi wc3 wv3 wi wv6 wi wn wv6 wv8
+      wv1 wi wi wn wi wi wi wv1 wn wc2 wv4 wi wc0 wv5 wi wi wi wc9 wv9 wi wv5
+      wn wi wv7 wi wc3 wv3 wi wc3 wv3 wi wv6 wi wn wv6 wv8 wv1 wi wi wn wi wi
+      wi wi wc3 wv3 wi wc3 wv3 wi wv6 wi wn wv6 wv8 wv1 wi wi wn wi wi wc9 wv9
+      wi wv5 wn wi wv7 wi wc3 wv3 wi wc3 wv3 wi wv6 wi wn wv6 wv8 wv1 wi wi wn
+      wi wi wi wc3 wv3 wi wv6 wi wn wv6 wv8 wv1 wi wi wn wi wc3 wv3 wi wc3 wv3
+      wi wv6 wi wn wv6 wv8 wv1 wi wi wn wi wi wv8 wv1 wi wv6 wc3 wv3 wi wv6
+      ax-g3 wc3 wv3 wi wv6 wi wn wv6 wv8 wv1 wi wi wn wi wc3 wv3 wi ax-1 ax-mp
+      wc3 wv3 wi wc3 wv3 wi wv6 wi wn wv6 wv8 wv1 wi wi wn wi wi wc9 wv9 wi wv5
+      wn wi wv7 wi ax-1 ax-mp wc9 wv9 wi wv5 wn wi wv7 wi wc3 wv3 wi wc3 wv3 wi
+      wv6 wi wn wv6 wv8 wv1 wi wi wn wi wi wi wv1 wn wc2 wv4 wi wc0 wv5 wi wi
+      wi ax-1 ax-mp wv1 wn wc2 wv4 wi wc0 wv5 wi wi wi wc9 wv9 wi wv5 wn wi wv7
+      wi wc3 wv3 wi wc3 wv3 wi wv6 wi wn wv6 wv8 wv1 wi wi wn wi wi wi wi wv7
+      wv8 wv9 wi wi wv6 wc9 wn wi wi ax-1 ax-mp wv7 wv8 wv9 wi wi wv6 wc9 wn wi
+      wi wv1 wn wc2 wv4 wi wc0 wv5 wi wi wi wc9 wv9 wi wv5 wn wi wv7 wi wc3 wv3
+      wi wc3 wv3 wi wv6 wi wn wv6 wv8 wv1 wi wi wn wi wi wi wi wi wv8 wv1 wi
+      ax-1 ax-mp wv8 wv1 wi wv7 wv8 wv9 wi wi wv6 wc9 wn wi wi wv1 wn wc2 wv4
+      wi wc0 wv5 wi wi wi wc9 wv9 wi wv5 wn wi wv7 wi wc3 wv3 wi wc3 wv3 wi wv6
+      wi wn wv6 wv8 wv1 wi wi wn wi wi wi wi wi wi wv3 wn wc3 wi wn ax-1 ax-mp
+      $.
+  $}
+  th273 $p |- ( -. ( v0 -> ( c1 -> v6 ) ) -> ( ( c8 -> ( ( v0 -> v8 ) -> v4 ) ) -> ( v6 -> ( ( v7 -> ( ( v4 -> v8 ) -> ( v6 -> v9 ) ) ) -> ( v6 -> -. v5 ) ) ) ) ) $=
+      wc8 wv0 wv8 wi wv4 wi wi wv6 wv7 wv4 wv8 wi wv6 wv9 wi wi wi wv6 wv5 wn
+      wi wi wi wi wv0 wc1 wv6 wi wi wn wc8 wv0 wv8 wi wv4 wi wi wv6 wv7 wv4 wv8
+      wi wv6 wv9 wi wi wi wv6 wv5 wn wi wi wi wi wi wv6 wv7 wv4 wv8 wi wv6 wv9
+      wi wi wi wv6 wv5 wn wi wi wi wc8 wv0 wv8 wi wv4 wi wi wv6 wv7 wv4 wv8 wi
+      wv6 wv9 wi wi wi wv6 wv5 wn wi wi wi wi wv7 wv4 wv8 wi wv6 wv9 wi wi wi
+      wv6 wv5 wn wi wi wv6 wv7 wv4 wv8 wi wv6 wv9 wi wi wi wv6 wv5 wn wi wi wi
+      wv6 wv5 wn wi wv7 wv4 wv8 wi wv6 wv9 wi wi wi wv6 wv5 wn wi wi wv5 wn wv6
+      wv5 wn wi wv5 ax-g5 wv5 wn wv6 ax-1 ax-mp wv6 wv5 wn wi wv7 wv4 wv8 wi
+      wv6 wv9 wi wi wi ax-1 ax-mp wv7 wv4 wv8 wi wv6 wv9 wi wi wi wv6 wv5 wn wi
+      wi wv6 ax-1 ax-mp wv6 wv7 wv4 wv8 wi wv6 wv9 wi wi wi wv6 wv5 wn wi wi wi
+      wc8 wv0 wv8 wi wv4 wi wi ax-1 ax-mp wc8 wv0 wv8 wi wv4 wi wi wv6 wv7 wv4
+      wv8 wi wv6 wv9 wi wi wi wv6 wv5 wn wi wi wi wi wv0 wc1 wv6 wi wi wn ax-1
+      ax-mp $.
+  th274 $p |- ( ( ( v0 -> ( c6 -> v1 ) ) -> ( ( v6 -> c6 ) -> ( v7 -> c8 ) ) ) -> ( ( ( ( v5 -> v5 ) -> -. c7 ) -> c4 ) -> ( v6 -> ( ( ( c2 -> v4 ) -> ( ( c8 -> v2 ) -> ( v7 -> v6 ) ) ) -> ( ( ( c2 -> v4 ) -> ( c8 -> v2 ) ) -> ( ( c2 -> v4 ) -> ( v7 -> v6 ) ) ) ) ) ) ) $=
+      ( wv8 wi wc6 wc8 wc7 wn wc4 wc2 ax-1 ax-2 ax-mp ) HHHIIZAJBIIFJIGKIIIZEEI
+      LMINIZFODIZKCIZGFIZIIUBUCIUBUDIIIZIZIZIZHHPUHSUHIUGUHUFUGUEUFUBUCUDQUEFPR
+      UFUAPRUGTPRUHSPRR $.
+  th275 $p |- ( ( v9 -> ( ( v0 -> v8 ) -> v4 ) ) -> ( ( c9 -> v3 ) -> ( ( ( ( v5 -> c8 ) -> v9 ) -> v9 ) -> ( ( ( ( c2 -> v1 ) -> ( v6 -> c0 ) ) -> c2 ) -> ( ( -. ( v6 -> v6 ) -> v0 ) -> ( c9 -> v3 ) ) ) ) ) ) $=
+      wc9 wv3 wi wv5 wc8 wi wv9 wi wv9 wi wc2 wv1 wi wv6 wc0 wi wi wc2 wi wv6
+      wv6 wi wn wv0 wi wc9 wv3 wi wi wi wi wi wv9 wv0 wv8 wi wv4 wi wi wc9 wv3
+      wi wv5 wc8 wi wv9 wi wv9 wi wc2 wv1 wi wv6 wc0 wi wi wc2 wi wv6 wv6 wi wn
+      wv0 wi wc9 wv3 wi wi wi wi wi wi wv5 wc8 wi wv9 wi wv9 wi wc2 wv1 wi wv6
+      wc0 wi wi wc2 wi wv6 wv6 wi wn wv0 wi wc9 wv3 wi wi wi wi wc9 wv3 wi wv5
+      wc8 wi wv9 wi wv9 wi wc2 wv1 wi wv6 wc0 wi wi wc2 wi wv6 wv6 wi wn wv0 wi
+      wc9 wv3 wi wi wi wi wi wc2 wv1 wi wv6 wc0 wi wi wc2 wi wv6 wv6 wi wn wv0
+      wi wc9 wv3 wi wi wi wv5 wc8 wi wv9 wi wv9 wi wc2 wv1 wi wv6 wc0 wi wi wc2
+      wi wv6 wv6 wi wn wv0 wi wc9 wv3 wi wi wi wi wv6 wv6 wi wn wv0 wi wc9 wv3
+      wi wi wc2 wv1 wi wv6 wc0 wi wi wc2 wi wv6 wv6 wi wn wv0 wi wc9 wv3 wi wi
+      wi wc9 wv3 wi wv6 wv6 wi wn wv0 wi wc9 wv3 wi wi wc9 wv3 wi ax-g6 wc9 wv3
+      wi wv6 wv6 wi wn wv0 wi ax-1 ax-mp wv6 wv6 wi wn wv0 wi wc9 wv3 wi wi wc2
+      wv1 wi wv6 wc0 wi wi wc2 wi ax-1 ax-mp wc2 wv1 wi wv6 wc0 wi wi wc2 wi
+      wv6 wv6 wi wn wv0 wi wc9 wv3 wi wi wi wv5 wc8 wi wv9 wi wv9 wi ax-1 ax-mp
+      wv5 wc8 wi wv9 wi wv9 wi wc2 wv1 wi wv6 wc0 wi wi wc2 wi wv6 wv6 wi wn
+      wv0 wi wc9 wv3 wi wi wi wi wc9 wv3 wi ax-1 ax-mp wc9 wv3 wi wv5 wc8 wi
+      wv9 wi wv9 wi wc2 wv1 wi wv6 wc0 wi wi wc2 wi wv6 wv6 wi wn wv0 wi wc9
+      wv3 wi wi wi wi wi wv9 wv0 wv8 wi wv4 wi wi ax-1 ax-mp $.
+  th276 $p |- ( ( -. ( c1 -> v4 ) -> ( v9 -> ( v0 -> c2 ) ) ) -> ( ( -. v0 -> ( ( v3 -> v7 ) -> ( v1 -> v1 ) ) ) -> ( ( c1 -> -. ( c7 -> v0 ) ) -> ( c7 -> ( ( ( v7 -> v4 ) -> c7 ) -> -. ( c2 -> -. c6 ) ) ) ) ) ) $=
+      ( wn wi wc1 wc7 wc2 wc6 ax-g0 ax-1 ax-mp ) AGCEHBBHHHZIJAHGHZJEDHZJHKLGZH
+      GHZHZHZHZIDHGFAKHHHZUCHUBUCUAUBTUAKSJRMTJNOUAQNOUBPNOUCUDNO $.
+  wth23 $p wff -. v1 $=
+      wv1 wn $.
+  th277 $p |- ( ( ( ( v1 -> v1 ) -> ( c2 -> v0 ) ) -> v3 ) -> ( ( ( -. c1 -> ( c3 -> v8 ) ) -> ( -. v5 -> ( c9 -> v6 ) ) ) -> ( -. c7 -> -. ( ( v9 -> v2 ) -> ( v9 -> v2 ) ) ) ) ) $=
+      wc1 wn wc3 wv8 wi wi wv5 wn wc9 wv6 wi wi wi wc7 wn wv9 wv2 wi wv9 wv2 wi
+      wi wn wi wi wv1 wv1 wi wc2 wv0 wi wi wv3 wi wc1 wn wc3 wv8 wi wi wv5 wn
+      wc9 wv6 wi wi wi wc7 wn wv9 wv2 wi wv9 wv2 wi wi wn wi wi wi wc7 wn wv9
+      wv2 wi wv9 wv2 wi wi wn wi wc1 wn wc3 wv8 wi wi wv5 wn wc9 wv6 wi wi wi
+      wc7 wn wv9 wv2 wi wv9 wv2 wi wi wn wi wi wc7 wv9 wv2 wi ax-g7 wc7 wn wv9
+      wv2 wi wv9 wv2 wi wi wn wi wc1 wn wc3 wv8 wi wi wv5 wn wc9 wv6 wi wi wi
+      ax-1 ax-mp wc1 wn wc3 wv8 wi wi wv5 wn wc9 wv6 wi wi wi wc7 wn wv9 wv2 wi
+      wv9 wv2 wi wi wn wi wi wv1 wv1 wi wc2 wv0 wi wi wv3 wi ax-1 ax-mp $.
+  th278 $p |- ( ( ( ( c8 -> v5 ) -> ( v3 -> v6 ) ) -> ( ( v6 -> c1 ) -> ( v1 -> v2 ) ) ) -> ( v9 -> ( ( -. ( v5 -> v5 ) -> ( v9 -> ( v4 -> v2 ) ) ) -> ( ( ( -. v5 -> ( v6 -> v3 ) ) -> -. v8 ) -> ( ( ( ( v8 -> v4 ) -> ( v2 -> v7 ) ) -> -. v5 ) -> ( ( ( ( c6 -> c6 ) -> c6 ) -> ( ( v2 -> v2 ) -> c6 ) ) -> -. ( ( c5 -> ( c0 -> c9 ) ) -> ( ( c8 -> v2 ) -> ( c8 -> v2 ) ) ) ) ) ) ) ) ) $=
+      ( wi wn wc6 wc5 wc0 wc9 wc8 wc1 th229 ax-1 ax-mp ) IEEJKIDBJJJZEKFCJJHKJZ
+      HDJBGJJEKJZLLJLJBBJLJJMNOJJPBJPBJJJKJZJZJZJZJZPEJCFJJFQJABJJJZUHJUGUHUFUG
+      UEUFUDUELLBLBBRUDUCSTUEUBSTUFUASTUGISTUHUIST $.
+  th279 $p |- ( ( ( ( v8 -> v1 ) -> v4 ) -> -. -. v0 ) -> ( ( ( ( v8 -> v1 ) -> v4 ) -> -. -. v0 ) -> ( ( -. c7 -> ( ( v5 -> v6 ) -> ( v3 -> v4 ) ) ) -> ( v3 -> c4 ) ) ) ) $=
+      ( wv2 wi wn wc7 wc4 ax-1 ax-g2 ax-mp ) HHHIIZGBIDIAJJIZQKJEFICDIIIZCLIZIZ
+      IZIZHHMUBPUBIUAUBTUASTSNSRMOTQMOUAQMOUBPMOO $.
+  th280 $p |- ( v6 -> ( ( ( -. v9 -> -. v7 ) -> -. -. v2 ) -> ( c8 -> ( ( ( -. v9 -> -. v7 ) -> -. -. v2 ) -> ( v6 -> ( c2 -> ( -. c9 -> c2 ) ) ) ) ) ) ) $=
+      wv3 wv3 wv3 wi wi wv6 wv9 wn wv7 wn wi wv2 wn wn wi wc8 wv9 wn wv7 wn wi
+      wv2 wn wn wi wv6 wc2 wc9 wn wc2 wi wi wi wi wi wi wi wv3 wv3 ax-1 wv6 wv9
+      wn wv7 wn wi wv2 wn wn wi wc8 wv9 wn wv7 wn wi wv2 wn wn wi wv6 wc2 wc9
+      wn wc2 wi wi wi wi wi wi wi wv3 wv3 wv3 wi wi wv6 wv9 wn wv7 wn wi wv2 wn
+      wn wi wc8 wv9 wn wv7 wn wi wv2 wn wn wi wv6 wc2 wc9 wn wc2 wi wi wi wi wi
+      wi wi wi wv9 wn wv7 wn wi wv2 wn wn wi wc8 wv9 wn wv7 wn wi wv2 wn wn wi
+      wv6 wc2 wc9 wn wc2 wi wi wi wi wi wi wv6 wv9 wn wv7 wn wi wv2 wn wn wi
+      wc8 wv9 wn wv7 wn wi wv2 wn wn wi wv6 wc2 wc9 wn wc2 wi wi wi wi wi wi wi
+      wc8 wv9 wn wv7 wn wi wv2 wn wn wi wv6 wc2 wc9 wn wc2 wi wi wi wi wi wv9
+      wn wv7 wn wi wv2 wn wn wi wc8 wv9 wn wv7 wn wi wv2 wn wn wi wv6 wc2 wc9
+      wn wc2 wi wi wi wi wi wi wv9 wn wv7 wn wi wv2 wn wn wi wv6 wc2 wc9 wn wc2
+      wi wi wi wi wc8 wv9 wn wv7 wn wi wv2 wn wn wi wv6 wc2 wc9 wn wc2 wi wi wi
+      wi wi wv6 wc2 wc9 wn wc2 wi wi wi wv9 wn wv7 wn wi wv2 wn wn wi wv6 wc2
+      wc9 wn wc2 wi wi wi wi wc2 wc9 wn wc2 wi wi wv6 wc2 wc9 wn wc2 wi wi wi
+      wc9 wn wc2 wi wc2 wc9 wn wc2 wi wi wc2 wc9 wn wc2 wi wc2 ax-g6 wc2 wc9 wn
+      ax-1 ax-mp wc9 wn wc2 wi wc2 ax-1 ax-mp wc2 wc9 wn wc2 wi wi wv6 ax-1
+      ax-mp wv6 wc2 wc9 wn wc2 wi wi wi wv9 wn wv7 wn wi wv2 wn wn wi ax-1
+      ax-mp wv9 wn wv7 wn wi wv2 wn wn wi wv6 wc2 wc9 wn wc2 wi wi wi wi wc8
+      ax-1 ax-mp wc8 wv9 wn wv7 wn wi wv2 wn wn wi wv6 wc2 wc9 wn wc2 wi wi wi
+      wi wi wv9 wn wv7 wn wi wv2 wn wn wi ax-1 ax-mp wv9 wn wv7 wn wi wv2 wn wn
+      wi wc8 wv9 wn wv7 wn wi wv2 wn wn wi wv6 wc2 wc9 wn wc2 wi wi wi wi wi wi
+      wv6 ax-1 ax-mp wv6 wv9 wn wv7 wn wi wv2 wn wn wi wc8 wv9 wn wv7 wn wi wv2
+      wn wn wi wv6 wc2 wc9 wn wc2 wi wi wi wi wi wi wi wv3 wv3 wv3 wi wi ax-1
+      ax-mp ax-mp $.
+  wth24 $p wff c5 $=
+      wc5 $.
+  wth25 $p wff ( v2 -> v5 ) $=
+      ( wi ) ABC $.
+  th281 $p |- ( ( ( ( v5 -> v9 ) -> ( c1 -> c5 ) ) -> c4 ) -> ( c1 -> ( -. ( -. v4 -> -. c0 ) -> ( ( ( ( v5 -> v9 ) -> ( c1 -> c5 ) ) -> c4 ) -> ( ( ( ( v5 -> v9 ) -> ( c1 -> c5 ) ) -> c4 ) -> ( ( ( ( v3 -> c4 ) -> ( c8 -> v8 ) ) -> ( ( c2 -> v2 ) -> ( v6 -> v3 ) ) ) -> ( ( c7 -> v8 ) -> ( ( v8 -> c8 ) -> ( c7 -> v8 ) ) ) ) ) ) ) ) ) $=
+      ( wc1 wn wc0 wi wc5 wc4 wc8 wc2 wc7 ax-1 ax-mp ) HCIJIKIZDGKHLKKMKZTBMKNF
+      KKOAKEBKKKZPFKZFNKZUBKKZKZKZKZKZKZTUIKUHUIUGUHUFUGUEUFUDUEUBUCQUDUAQRUETQ
+      RUFTQRUGSQRUHHQRUITQR $.
+  th282 $p |- ( ( ( ( v8 -> v8 ) -> c5 ) -> v1 ) -> ( ( ( ( v9 -> v2 ) -> ( v4 -> c1 ) ) -> ( -. v9 -> -. v6 ) ) -> ( -. v7 -> ( ( ( ( v4 -> c5 ) -> ( v4 -> v9 ) ) -> ( ( c6 -> v4 ) -> ( c7 -> c7 ) ) ) -> ( ( ( -. c3 -> ( c7 -> v9 ) ) -> ( ( c6 -> v4 ) -> ( c5 -> v4 ) ) ) -> ( c5 -> ( c8 -> ( ( c5 -> ( ( c5 -> c8 ) -> ( v4 -> c8 ) ) ) -> ( -. ( c8 -> ( c4 -> c5 ) ) -> c0 ) ) ) ) ) ) ) ) ) $=
+      wv0 wv0 wv0 wi wi wv8 wv8 wi wc5 wi wv1 wi wv9 wv2 wi wv4 wc1 wi wi wv9
+      wn wv6 wn wi wi wv7 wn wv4 wc5 wi wv4 wv9 wi wi wc6 wv4 wi wc7 wc7 wi wi
+      wi wc3 wn wc7 wv9 wi wi wc6 wv4 wi wc5 wv4 wi wi wi wc5 wc8 wc5 wc5 wc8
+      wi wv4 wc8 wi wi wi wc8 wc4 wc5 wi wi wn wc0 wi wi wi wi wi wi wi wi wi
+      wv0 wv0 ax-1 wv8 wv8 wi wc5 wi wv1 wi wv9 wv2 wi wv4 wc1 wi wi wv9 wn wv6
+      wn wi wi wv7 wn wv4 wc5 wi wv4 wv9 wi wi wc6 wv4 wi wc7 wc7 wi wi wi wc3
+      wn wc7 wv9 wi wi wc6 wv4 wi wc5 wv4 wi wi wi wc5 wc8 wc5 wc5 wc8 wi wv4
+      wc8 wi wi wi wc8 wc4 wc5 wi wi wn wc0 wi wi wi wi wi wi wi wi wi wv0 wv0
+      wv0 wi wi wv8 wv8 wi wc5 wi wv1 wi wv9 wv2 wi wv4 wc1 wi wi wv9 wn wv6 wn
+      wi wi wv7 wn wv4 wc5 wi wv4 wv9 wi wi wc6 wv4 wi wc7 wc7 wi wi wi wc3 wn
+      wc7 wv9 wi wi wc6 wv4 wi wc5 wv4 wi wi wi wc5 wc8 wc5 wc5 wc8 wi wv4 wc8
+      wi wi wi wc8 wc4 wc5 wi wi wn wc0 wi wi wi wi wi wi wi wi wi wi wv9 wv2
+      wi wv4 wc1 wi wi wv9 wn wv6 wn wi wi wv7 wn wv4 wc5 wi wv4 wv9 wi wi wc6
+      wv4 wi wc7 wc7 wi wi wi wc3 wn wc7 wv9 wi wi wc6 wv4 wi wc5 wv4 wi wi wi
+      wc5 wc8 wc5 wc5 wc8 wi wv4 wc8 wi wi wi wc8 wc4 wc5 wi wi wn wc0 wi wi wi
+      wi wi wi wi wi wv8 wv8 wi wc5 wi wv1 wi wv9 wv2 wi wv4 wc1 wi wi wv9 wn
+      wv6 wn wi wi wv7 wn wv4 wc5 wi wv4 wv9 wi wi wc6 wv4 wi wc7 wc7 wi wi wi
+      wc3 wn wc7 wv9 wi wi wc6 wv4 wi wc5 wv4 wi wi wi wc5 wc8 wc5 wc5 wc8 wi
+      wv4 wc8 wi wi wi wc8 wc4 wc5 wi wi wn wc0 wi wi wi wi wi wi wi wi wi wv7
+      wn wv4 wc5 wi wv4 wv9 wi wi wc6 wv4 wi wc7 wc7 wi wi wi wc3 wn wc7 wv9 wi
+      wi wc6 wv4 wi wc5 wv4 wi wi wi wc5 wc8 wc5 wc5 wc8 wi wv4 wc8 wi wi wi
+      wc8 wc4 wc5 wi wi wn wc0 wi wi wi wi wi wi wi wv9 wv2 wi wv4 wc1 wi wi
+      wv9 wn wv6 wn wi wi wv7 wn wv4 wc5 wi wv4 wv9 wi wi wc6 wv4 wi wc7 wc7 wi
+      wi wi wc3 wn wc7 wv9 wi wi wc6 wv4 wi wc5 wv4 wi wi wi wc5 wc8 wc5 wc5
+      wc8 wi wv4 wc8 wi wi wi wc8 wc4 wc5 wi wi wn wc0 wi wi wi wi wi wi wi wi
+      wv4 wc5 wi wv4 wv9 wi wi wc6 wv4 wi wc7 wc7 wi wi wi wc3 wn wc7 wv9 wi wi
+      wc6 wv4 wi wc5 wv4 wi wi wi wc5 wc8 wc5 wc5 wc8 wi wv4 wc8 wi wi wi wc8
+      wc4 wc5 wi wi wn wc0 wi wi wi wi wi wi wv7 wn wv4 wc5 wi wv4 wv9 wi wi
+      wc6 wv4 wi wc7 wc7 wi wi wi wc3 wn wc7 wv9 wi wi wc6 wv4 wi wc5 wv4 wi wi
+      wi wc5 wc8 wc5 wc5 wc8 wi wv4 wc8 wi wi wi wc8 wc4 wc5 wi wi wn wc0 wi wi
+      wi wi wi wi wi wv4 wv4 wv4 wv9 wc5 wc4 wc5 wc7 wc6 wc8 th43 wv4 wc5 wi
+      wv4 wv9 wi wi wc6 wv4 wi wc7 wc7 wi wi wi wc3 wn wc7 wv9 wi wi wc6 wv4 wi
+      wc5 wv4 wi wi wi wc5 wc8 wc5 wc5 wc8 wi wv4 wc8 wi wi wi wc8 wc4 wc5 wi
+      wi wn wc0 wi wi wi wi wi wi wv7 wn ax-1 ax-mp wv7 wn wv4 wc5 wi wv4 wv9
+      wi wi wc6 wv4 wi wc7 wc7 wi wi wi wc3 wn wc7 wv9 wi wi wc6 wv4 wi wc5 wv4
+      wi wi wi wc5 wc8 wc5 wc5 wc8 wi wv4 wc8 wi wi wi wc8 wc4 wc5 wi wi wn wc0
+      wi wi wi wi wi wi wi wv9 wv2 wi wv4 wc1 wi wi wv9 wn wv6 wn wi wi ax-1
+      ax-mp wv9 wv2 wi wv4 wc1 wi wi wv9 wn wv6 wn wi wi wv7 wn wv4 wc5 wi wv4
+      wv9 wi wi wc6 wv4 wi wc7 wc7 wi wi wi wc3 wn wc7 wv9 wi wi wc6 wv4 wi wc5
+      wv4 wi wi wi wc5 wc8 wc5 wc5 wc8 wi wv4 wc8 wi wi wi wc8 wc4 wc5 wi wi wn
+      wc0 wi wi wi wi wi wi wi wi wv8 wv8 wi wc5 wi wv1 wi ax-1 ax-mp wv8 wv8
+      wi wc5 wi wv1 wi wv9 wv2 wi wv4 wc1 wi wi wv9 wn wv6 wn wi wi wv7 wn wv4
+      wc5 wi wv4 wv9 wi wi wc6 wv4 wi wc7 wc7 wi wi wi wc3 wn wc7 wv9 wi wi wc6
+      wv4 wi wc5 wv4 wi wi wi wc5 wc8 wc5 wc5 wc8 wi wv4 wc8 wi wi wi wc8 wc4
+      wc5 wi wi wn wc0 wi wi wi wi wi wi wi wi wi wv0 wv0 wv0 wi wi ax-1 ax-mp
+      ax-mp $.
+  th283 $p |- ( ( ( ( v9 -> v5 ) -> v6 ) -> v2 ) -> ( -. v7 -> ( ( ( ( c6 -> v5 ) -> c5 ) -> c0 ) -> ( ( ( ( v2 -> c6 ) -> ( v9 -> v7 ) ) -> ( ( v2 -> v4 ) -> v8 ) ) -> ( -. v0 -> -. v7 ) ) ) ) ) $=
+      wv3 wv3 wv3 wi wi wv9 wv5 wi wv6 wi wv2 wi wv7 wn wc6 wv5 wi wc5 wi wc0
+      wi wv2 wc6 wi wv9 wv7 wi wi wv2 wv4 wi wv8 wi wi wv0 wn wv7 wn wi wi wi
+      wi wi wv3 wv3 ax-1 wv9 wv5 wi wv6 wi wv2 wi wv7 wn wc6 wv5 wi wc5 wi wc0
+      wi wv2 wc6 wi wv9 wv7 wi wi wv2 wv4 wi wv8 wi wi wv0 wn wv7 wn wi wi wi
+      wi wi wv3 wv3 wv3 wi wi wv9 wv5 wi wv6 wi wv2 wi wv7 wn wc6 wv5 wi wc5 wi
+      wc0 wi wv2 wc6 wi wv9 wv7 wi wi wv2 wv4 wi wv8 wi wi wv0 wn wv7 wn wi wi
+      wi wi wi wi wv7 wn wc6 wv5 wi wc5 wi wc0 wi wv2 wc6 wi wv9 wv7 wi wi wv2
+      wv4 wi wv8 wi wi wv0 wn wv7 wn wi wi wi wi wv9 wv5 wi wv6 wi wv2 wi wv7
+      wn wc6 wv5 wi wc5 wi wc0 wi wv2 wc6 wi wv9 wv7 wi wi wv2 wv4 wi wv8 wi wi
+      wv0 wn wv7 wn wi wi wi wi wi wc6 wv5 wi wc5 wi wc0 wi wv2 wc6 wi wv9 wv7
+      wi wi wv2 wv4 wi wv8 wi wi wv0 wn wv7 wn wi wi wi wv7 wn wc6 wv5 wi wc5
+      wi wc0 wi wv2 wc6 wi wv9 wv7 wi wi wv2 wv4 wi wv8 wi wi wv0 wn wv7 wn wi
+      wi wi wi wv2 wc6 wi wv9 wv7 wi wi wv2 wv4 wi wv8 wi wi wv0 wn wv7 wn wi
+      wi wc6 wv5 wi wc5 wi wc0 wi wv2 wc6 wi wv9 wv7 wi wi wv2 wv4 wi wv8 wi wi
+      wv0 wn wv7 wn wi wi wi wv0 wn wv7 wn wi wv2 wc6 wi wv9 wv7 wi wi wv2 wv4
+      wi wv8 wi wi wv0 wn wv7 wn wi wi wv7 wn wv0 wn wv7 wn wi wv7 wn ax-g2 wv7
+      wn wv0 wn ax-1 ax-mp wv0 wn wv7 wn wi wv2 wc6 wi wv9 wv7 wi wi wv2 wv4 wi
+      wv8 wi wi ax-1 ax-mp wv2 wc6 wi wv9 wv7 wi wi wv2 wv4 wi wv8 wi wi wv0 wn
+      wv7 wn wi wi wc6 wv5 wi wc5 wi wc0 wi ax-1 ax-mp wc6 wv5 wi wc5 wi wc0 wi
+      wv2 wc6 wi wv9 wv7 wi wi wv2 wv4 wi wv8 wi wi wv0 wn wv7 wn wi wi wi wv7
+      wn ax-1 ax-mp wv7 wn wc6 wv5 wi wc5 wi wc0 wi wv2 wc6 wi wv9 wv7 wi wi
+      wv2 wv4 wi wv8 wi wi wv0 wn wv7 wn wi wi wi wi wv9 wv5 wi wv6 wi wv2 wi
+      ax-1 ax-mp wv9 wv5 wi wv6 wi wv2 wi wv7 wn wc6 wv5 wi wc5 wi wc0 wi wv2
+      wc6 wi wv9 wv7 wi wi wv2 wv4 wi wv8 wi wi wv0 wn wv7 wn wi wi wi wi wi
+      wv3 wv3 wv3 wi wi ax-1 ax-mp ax-mp $.
+  th284 $p |- ( v7 -> ( ( v4 -> ( v1 -> v6 ) ) -> ( v3 -> ( ( -. c5 -> ( ( v9 -> v4 ) -> ( v6 -> c1 ) ) ) -> ( ( ( ( v6 -> v5 ) -> ( c8 -> c3 ) ) -> ( ( v4 -> v9 ) -> -. c3 ) ) -> ( ( -. c5 -> ( ( v9 -> v4 ) -> ( v6 -> c1 ) ) ) -> ( -. ( ( c5 -> c3 ) -> ( c5 -> c3 ) ) -> -. ( ( v6 -> v5 ) -> ( v6 -> v5 ) ) ) ) ) ) ) ) ) $=
+      ( wv0 wi wc5 wn wc1 wc8 wc3 ax-1 ax-g3 ax-mp ) HHHIIZFCAEIIZBJKGCIELIIIZE
+      DIMNIICGINKIIZTJNIZUBIKEDIZUCIKIZIZIZIZIZIZIZHHOUJRUJIUIUJUHUIUGUHUFUGUEU
+      FUDUEUCUCUBUBPUDTOQUEUAOQUFTOQUGBOQUHSOQUIFOQUJROQQ $.
+  th285 $p |- ( c9 -> ( ( v4 -> c1 ) -> ( ( v4 -> c1 ) -> -. ( v4 -> c1 ) ) ) ) $=
+      ( wv6 wi wc9 wc1 wn ax-1 ax-g5 ax-mp ) BBBCCZDAECZKKFZCZCZCZBBGOJOCNOMNLM
+      KHLKGIMKGINDGIOJGII $.
+  th286 $p |- ( -. ( ( c6 -> v8 ) -> ( c7 -> v9 ) ) -> ( ( ( ( c1 -> c8 ) -> ( v3 -> v3 ) ) -> ( ( c5 -> v2 ) -> v8 ) ) -> ( ( ( -. v0 -> ( v3 -> c1 ) ) -> v3 ) -> ( -. ( ( c6 -> v8 ) -> ( c7 -> v9 ) ) -> ( -. ( ( c6 -> v8 ) -> ( c7 -> v9 ) ) -> ( v9 -> ( ( c6 -> c0 ) -> -. ( ( ( v8 -> v9 ) -> ( c2 -> c5 ) ) -> ( ( v8 -> v9 ) -> ( v8 -> v9 ) ) ) ) ) ) ) ) ) ) $=
+      wc1 wc8 wi wv3 wv3 wi wi wc5 wv2 wi wv8 wi wi wv0 wn wv3 wc1 wi wi wv3 wi
+      wc6 wv8 wi wc7 wv9 wi wi wn wc6 wv8 wi wc7 wv9 wi wi wn wv9 wc6 wc0 wi
+      wv8 wv9 wi wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi wi wi wi wi wi
+      wc6 wv8 wi wc7 wv9 wi wi wn wc1 wc8 wi wv3 wv3 wi wi wc5 wv2 wi wv8 wi wi
+      wv0 wn wv3 wc1 wi wi wv3 wi wc6 wv8 wi wc7 wv9 wi wi wn wc6 wv8 wi wc7
+      wv9 wi wi wn wv9 wc6 wc0 wi wv8 wv9 wi wc2 wc5 wi wi wv8 wv9 wi wv8 wv9
+      wi wi wi wn wi wi wi wi wi wi wi wv0 wn wv3 wc1 wi wi wv3 wi wc6 wv8 wi
+      wc7 wv9 wi wi wn wc6 wv8 wi wc7 wv9 wi wi wn wv9 wc6 wc0 wi wv8 wv9 wi
+      wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi wi wi wi wi wc1 wc8 wi
+      wv3 wv3 wi wi wc5 wv2 wi wv8 wi wi wv0 wn wv3 wc1 wi wi wv3 wi wc6 wv8 wi
+      wc7 wv9 wi wi wn wc6 wv8 wi wc7 wv9 wi wi wn wv9 wc6 wc0 wi wv8 wv9 wi
+      wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi wi wi wi wi wi wc6 wv8 wi
+      wc7 wv9 wi wi wn wc6 wv8 wi wc7 wv9 wi wi wn wv9 wc6 wc0 wi wv8 wv9 wi
+      wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi wi wi wi wv0 wn wv3 wc1
+      wi wi wv3 wi wc6 wv8 wi wc7 wv9 wi wi wn wc6 wv8 wi wc7 wv9 wi wi wn wv9
+      wc6 wc0 wi wv8 wv9 wi wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi wi
+      wi wi wi wc6 wv8 wi wc7 wv9 wi wi wn wv9 wc6 wc0 wi wv8 wv9 wi wc2 wc5 wi
+      wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi wi wi wc6 wv8 wi wc7 wv9 wi wi wn
+      wc6 wv8 wi wc7 wv9 wi wi wn wv9 wc6 wc0 wi wv8 wv9 wi wc2 wc5 wi wi wv8
+      wv9 wi wv8 wv9 wi wi wi wn wi wi wi wi wv9 wc6 wc0 wi wv8 wv9 wi wc2 wc5
+      wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi wi wc6 wv8 wi wc7 wv9 wi wi wn
+      wv9 wc6 wc0 wi wv8 wv9 wi wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi
+      wi wi wc6 wc0 wi wv8 wv9 wi wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn
+      wi wv9 wc6 wc0 wi wv8 wv9 wi wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn
+      wi wi wv8 wv9 wi wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wc6 wc0 wi
+      wv8 wv9 wi wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi wv8 wv9 wi wv8
+      wv9 wi wc2 wc5 wi ax-g8 wv8 wv9 wi wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi
+      wi wn wc6 wc0 wi ax-1 ax-mp wc6 wc0 wi wv8 wv9 wi wc2 wc5 wi wi wv8 wv9
+      wi wv8 wv9 wi wi wi wn wi wv9 ax-1 ax-mp wv9 wc6 wc0 wi wv8 wv9 wi wc2
+      wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi wi wc6 wv8 wi wc7 wv9 wi wi
+      wn ax-1 ax-mp wc6 wv8 wi wc7 wv9 wi wi wn wv9 wc6 wc0 wi wv8 wv9 wi wc2
+      wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi wi wi wc6 wv8 wi wc7 wv9 wi
+      wi wn ax-1 ax-mp wc6 wv8 wi wc7 wv9 wi wi wn wc6 wv8 wi wc7 wv9 wi wi wn
+      wv9 wc6 wc0 wi wv8 wv9 wi wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi
+      wi wi wi wv0 wn wv3 wc1 wi wi wv3 wi ax-1 ax-mp wv0 wn wv3 wc1 wi wi wv3
+      wi wc6 wv8 wi wc7 wv9 wi wi wn wc6 wv8 wi wc7 wv9 wi wi wn wv9 wc6 wc0 wi
+      wv8 wv9 wi wc2 wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi wi wi wi wi
+      wc1 wc8 wi wv3 wv3 wi wi wc5 wv2 wi wv8 wi wi ax-1 ax-mp wc1 wc8 wi wv3
+      wv3 wi wi wc5 wv2 wi wv8 wi wi wv0 wn wv3 wc1 wi wi wv3 wi wc6 wv8 wi wc7
+      wv9 wi wi wn wc6 wv8 wi wc7 wv9 wi wi wn wv9 wc6 wc0 wi wv8 wv9 wi wc2
+      wc5 wi wi wv8 wv9 wi wv8 wv9 wi wi wi wn wi wi wi wi wi wi wc6 wv8 wi wc7
+      wv9 wi wi wn ax-1 ax-mp $.
+  th287 $p |- ( -. v1 -> ( ( ( v3 -> c4 ) -> ( -. c9 -> c1 ) ) -> ( v0 -> ( -. v7 -> ( -. ( ( c6 -> c0 ) -> ( v2 -> v7 ) ) -> ( -. ( -. v7 -> ( v8 -> c6 ) ) -> ( -. -. v0 -> ( ( v8 -> c6 ) -> -. v0 ) ) ) ) ) ) ) ) $=
+      ( wv5 wi wn wc4 wc9 wc1 wc6 wc0 ax-1 ax-g9 ax-mp ) GGGHHZBIZDJHKILHHZAEIZ
+      MNHCEHHIZUAFMHZHIAIZIUCUDHHHZHZHZHZHZHZGGOUJRUJHUIUJUHUIUGUHUFUGUEUFUAUCU
+      CUDPUEUBOQUFUAOQUGAOQUHTOQUISOQUJROQQ $.
+  th288 $p |- ( -. v0 -> ( ( -. v0 -> ( v2 -> c7 ) ) -> -. ( -. c4 -> ( v7 -> v1 ) ) ) ) $=
+      ( wn wc7 wi wc4 ax-g0 ax-1 ax-mp ) AEZCFGZGHEZDBGZGEGZLPGNOMLIPLJK $.
+  th289 $p |- ( v2 -> ( -. -. ( c9 -> v2 ) -> ( ( v8 -> v3 ) -> ( v2 -> ( ( ( v1 -> v7 ) -> ( v5 -> v0 ) ) -> -. ( ( c4 -> c1 ) -> ( v8 -> v3 ) ) ) ) ) ) ) $=
+      wc9 wv2 wi wn wn wv8 wv3 wi wv2 wv1 wv7 wi wv5 wv0 wi wi wc4 wc1 wi wv8
+      wv3 wi wi wn wi wi wi wi wv2 wc9 wv2 wi wn wn wv8 wv3 wi wv2 wv1 wv7 wi
+      wv5 wv0 wi wi wc4 wc1 wi wv8 wv3 wi wi wn wi wi wi wi wi wv8 wv3 wi wv2
+      wv1 wv7 wi wv5 wv0 wi wi wc4 wc1 wi wv8 wv3 wi wi wn wi wi wi wc9 wv2 wi
+      wn wn wv8 wv3 wi wv2 wv1 wv7 wi wv5 wv0 wi wi wc4 wc1 wi wv8 wv3 wi wi wn
+      wi wi wi wi wv2 wv1 wv7 wi wv5 wv0 wi wi wc4 wc1 wi wv8 wv3 wi wi wn wi
+      wi wv8 wv3 wi wv2 wv1 wv7 wi wv5 wv0 wi wi wc4 wc1 wi wv8 wv3 wi wi wn wi
+      wi wi wv1 wv7 wi wv5 wv0 wi wi wc4 wc1 wi wv8 wv3 wi wi wn wi wv2 wv1 wv7
+      wi wv5 wv0 wi wi wc4 wc1 wi wv8 wv3 wi wi wn wi wi wc4 wc1 wi wv8 wv3 wi
+      wv5 wv0 wi wv1 wv7 wi ax-g0 wv1 wv7 wi wv5 wv0 wi wi wc4 wc1 wi wv8 wv3
+      wi wi wn wi wv2 ax-1 ax-mp wv2 wv1 wv7 wi wv5 wv0 wi wi wc4 wc1 wi wv8
+      wv3 wi wi wn wi wi wv8 wv3 wi ax-1 ax-mp wv8 wv3 wi wv2 wv1 wv7 wi wv5
+      wv0 wi wi wc4 wc1 wi wv8 wv3 wi wi wn wi wi wi wc9 wv2 wi wn wn ax-1
+      ax-mp wc9 wv2 wi wn wn wv8 wv3 wi wv2 wv1 wv7 wi wv5 wv0 wi wi wc4 wc1 wi
+      wv8 wv3 wi wi wn wi wi wi wi wv2 ax-1 ax-mp $.
+  th290 $p |- ( c6 -> ( c7 -> ( v5 -> ( ( -. c1 -> ( v3 -> v5 ) ) -> ( ( -. c1 -> ( v3 -> v5 ) ) -> ( ( v9 -> v1 ) -> ( ( v9 -> v1 ) -> -. ( v9 -> v1 ) ) ) ) ) ) ) ) $=
+      wc7 wv5 wc1 wn wv3 wv5 wi wi wc1 wn wv3 wv5 wi wi wv9 wv1 wi wv9 wv1 wi
+      wv9 wv1 wi wn wi wi wi wi wi wi wc6 wc7 wv5 wc1 wn wv3 wv5 wi wi wc1 wn
+      wv3 wv5 wi wi wv9 wv1 wi wv9 wv1 wi wv9 wv1 wi wn wi wi wi wi wi wi wi
+      wv5 wc1 wn wv3 wv5 wi wi wc1 wn wv3 wv5 wi wi wv9 wv1 wi wv9 wv1 wi wv9
+      wv1 wi wn wi wi wi wi wi wc7 wv5 wc1 wn wv3 wv5 wi wi wc1 wn wv3 wv5 wi
+      wi wv9 wv1 wi wv9 wv1 wi wv9 wv1 wi wn wi wi wi wi wi wi wc1 wn wv3 wv5
+      wi wi wc1 wn wv3 wv5 wi wi wv9 wv1 wi wv9 wv1 wi wv9 wv1 wi wn wi wi wi
+      wi wv5 wc1 wn wv3 wv5 wi wi wc1 wn wv3 wv5 wi wi wv9 wv1 wi wv9 wv1 wi
+      wv9 wv1 wi wn wi wi wi wi wi wc1 wn wv3 wv5 wi wi wv9 wv1 wi wv9 wv1 wi
+      wv9 wv1 wi wn wi wi wi wc1 wn wv3 wv5 wi wi wc1 wn wv3 wv5 wi wi wv9 wv1
+      wi wv9 wv1 wi wv9 wv1 wi wn wi wi wi wi wv9 wv1 wi wv9 wv1 wi wv9 wv1 wi
+      wn wi wi wc1 wn wv3 wv5 wi wi wv9 wv1 wi wv9 wv1 wi wv9 wv1 wi wn wi wi
+      wi wv9 wv1 wi wv9 wv1 wi wn wi wv9 wv1 wi wv9 wv1 wi wv9 wv1 wi wn wi wi
+      wv9 wv1 wi wn wv9 wv1 wi wv9 wv1 wi wn wi wv9 wv1 wi ax-g5 wv9 wv1 wi wn
+      wv9 wv1 wi ax-1 ax-mp wv9 wv1 wi wv9 wv1 wi wn wi wv9 wv1 wi ax-1 ax-mp
+      wv9 wv1 wi wv9 wv1 wi wv9 wv1 wi wn wi wi wc1 wn wv3 wv5 wi wi ax-1 ax-mp
+      wc1 wn wv3 wv5 wi wi wv9 wv1 wi wv9 wv1 wi wv9 wv1 wi wn wi wi wi wc1 wn
+      wv3 wv5 wi wi ax-1 ax-mp wc1 wn wv3 wv5 wi wi wc1 wn wv3 wv5 wi wi wv9
+      wv1 wi wv9 wv1 wi wv9 wv1 wi wn wi wi wi wi wv5 ax-1 ax-mp wv5 wc1 wn wv3
+      wv5 wi wi wc1 wn wv3 wv5 wi wi wv9 wv1 wi wv9 wv1 wi wv9 wv1 wi wn wi wi
+      wi wi wi wc7 ax-1 ax-mp wc7 wv5 wc1 wn wv3 wv5 wi wi wc1 wn wv3 wv5 wi wi
+      wv9 wv1 wi wv9 wv1 wi wv9 wv1 wi wn wi wi wi wi wi wi wc6 ax-1 ax-mp $.
+  th291 $p |- ( ( ( ( c7 -> v8 ) -> v9 ) -> ( ( v0 -> v7 ) -> ( v6 -> v1 ) ) ) -> ( ( ( ( c7 -> v8 ) -> v9 ) -> ( ( v0 -> v7 ) -> ( v6 -> v1 ) ) ) -> ( -. ( ( v8 -> c9 ) -> ( v9 -> v3 ) ) -> ( ( -. c8 -> ( ( v0 -> v8 ) -> ( v5 -> c8 ) ) ) -> ( ( ( v1 -> c7 ) -> ( v8 -> ( c3 -> c1 ) ) ) -> ( ( -. ( c0 -> v0 ) -> ( ( c6 -> v1 ) -> c9 ) ) -> ( ( ( c1 -> -. v0 ) -> ( ( v3 -> v4 ) -> -. v0 ) ) -> ( ( c2 -> v0 ) -> ( c1 -> ( ( ( c1 -> c8 ) -> ( v8 -> ( c1 -> c9 ) ) ) -> ( -. -. ( c0 -> c2 ) -> ( ( c3 -> ( ( v9 -> v9 ) -> ( v8 -> c6 ) ) ) -> ( ( -. c6 -> ( c9 -> c8 ) ) -> -. ( ( c0 -> c6 ) -> ( c0 -> c6 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wc7 wv8 wi wv9 wi wv0 wv7 wi wv6 wv1 wi wi wi wv8 wc9 wi wv9 wv3 wi wi wn
+      wc8 wn wv0 wv8 wi wv5 wc8 wi wi wi wv1 wc7 wi wv8 wc3 wc1 wi wi wi wc0
+      wv0 wi wn wc6 wv1 wi wc9 wi wi wc1 wv0 wn wi wv3 wv4 wi wv0 wn wi wi wc2
+      wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9
+      wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi
+      wi wi wi wi wi wi wi wi wi wi wi wc7 wv8 wi wv9 wi wv0 wv7 wi wv6 wv1 wi
+      wi wi wc7 wv8 wi wv9 wi wv0 wv7 wi wv6 wv1 wi wi wi wv8 wc9 wi wv9 wv3 wi
+      wi wn wc8 wn wv0 wv8 wi wv5 wc8 wi wi wi wv1 wc7 wi wv8 wc3 wc1 wi wi wi
+      wc0 wv0 wi wn wc6 wv1 wi wc9 wi wi wc1 wv0 wn wi wv3 wv4 wi wv0 wn wi wi
+      wc2 wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9
+      wv9 wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn
+      wi wi wi wi wi wi wi wi wi wi wi wi wi wv8 wc9 wi wv9 wv3 wi wi wn wc8 wn
+      wv0 wv8 wi wv5 wc8 wi wi wi wv1 wc7 wi wv8 wc3 wc1 wi wi wi wc0 wv0 wi wn
+      wc6 wv1 wi wc9 wi wi wc1 wv0 wn wi wv3 wv4 wi wv0 wn wi wi wc2 wv0 wi wc1
+      wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9 wi wv8 wc6
+      wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi wi wi wi wi
+      wi wi wi wi wi wi wc7 wv8 wi wv9 wi wv0 wv7 wi wv6 wv1 wi wi wi wv8 wc9
+      wi wv9 wv3 wi wi wn wc8 wn wv0 wv8 wi wv5 wc8 wi wi wi wv1 wc7 wi wv8 wc3
+      wc1 wi wi wi wc0 wv0 wi wn wc6 wv1 wi wc9 wi wi wc1 wv0 wn wi wv3 wv4 wi
+      wv0 wn wi wi wc2 wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn
+      wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0
+      wc6 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi wc8 wn wv0 wv8 wi wv5
+      wc8 wi wi wi wv1 wc7 wi wv8 wc3 wc1 wi wi wi wc0 wv0 wi wn wc6 wv1 wi wc9
+      wi wi wc1 wv0 wn wi wv3 wv4 wi wv0 wn wi wi wc2 wv0 wi wc1 wc1 wc8 wi wv8
+      wc1 wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn
+      wc9 wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi wi wi wi wi wi wi wi wi wi
+      wv8 wc9 wi wv9 wv3 wi wi wn wc8 wn wv0 wv8 wi wv5 wc8 wi wi wi wv1 wc7 wi
+      wv8 wc3 wc1 wi wi wi wc0 wv0 wi wn wc6 wv1 wi wc9 wi wi wc1 wv0 wn wi wv3
+      wv4 wi wv0 wn wi wi wc2 wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0
+      wc2 wi wn wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6
+      wi wc0 wc6 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wv1 wc7 wi wv8 wc3
+      wc1 wi wi wi wc0 wv0 wi wn wc6 wv1 wi wc9 wi wi wc1 wv0 wn wi wv3 wv4 wi
+      wv0 wn wi wi wc2 wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn
+      wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0
+      wc6 wi wi wn wi wi wi wi wi wi wi wi wi wc8 wn wv0 wv8 wi wv5 wc8 wi wi
+      wi wv1 wc7 wi wv8 wc3 wc1 wi wi wi wc0 wv0 wi wn wc6 wv1 wi wc9 wi wi wc1
+      wv0 wn wi wv3 wv4 wi wv0 wn wi wi wc2 wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9
+      wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn wc9 wc8
+      wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi wi wi wi wi wi wi wi wi wi wc0 wv0
+      wi wn wc6 wv1 wi wc9 wi wi wc1 wv0 wn wi wv3 wv4 wi wv0 wn wi wi wc2 wv0
+      wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9 wi
+      wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi wi
+      wi wi wi wi wi wi wv1 wc7 wi wv8 wc3 wc1 wi wi wi wc0 wv0 wi wn wc6 wv1
+      wi wc9 wi wi wc1 wv0 wn wi wv3 wv4 wi wv0 wn wi wi wc2 wv0 wi wc1 wc1 wc8
+      wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi
+      wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi wi wi wi wi wi wi wi
+      wi wc1 wv0 wn wi wv3 wv4 wi wv0 wn wi wi wc2 wv0 wi wc1 wc1 wc8 wi wv8
+      wc1 wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn
+      wc9 wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi wi wi wi wi wi wi wc0 wv0 wi
+      wn wc6 wv1 wi wc9 wi wi wc1 wv0 wn wi wv3 wv4 wi wv0 wn wi wi wc2 wv0 wi
+      wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9 wi wv8
+      wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi wi wi wi
+      wi wi wi wi wc2 wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn
+      wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0
+      wc6 wi wi wn wi wi wi wi wi wi wc1 wv0 wn wi wv3 wv4 wi wv0 wn wi wi wc2
+      wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9
+      wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi
+      wi wi wi wi wi wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn wn
+      wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0 wc6
+      wi wi wn wi wi wi wi wi wc2 wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi
+      wc0 wc2 wi wn wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0
+      wc6 wi wc0 wc6 wi wi wn wi wi wi wi wi wi wc0 wv9 wv8 wc2 wc0 wc6 wc6 wc1
+      wc9 th69 wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9
+      wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi
+      wi wi wi wi wc2 wv0 wi ax-1 ax-mp wc2 wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9
+      wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn wc9 wc8
+      wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi wi wi wi wi wi wc1 wv0 wn wi wv3 wv4
+      wi wv0 wn wi wi ax-1 ax-mp wc1 wv0 wn wi wv3 wv4 wi wv0 wn wi wi wc2 wv0
+      wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9 wi
+      wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi wi
+      wi wi wi wi wi wc0 wv0 wi wn wc6 wv1 wi wc9 wi wi ax-1 ax-mp wc0 wv0 wi
+      wn wc6 wv1 wi wc9 wi wi wc1 wv0 wn wi wv3 wv4 wi wv0 wn wi wi wc2 wv0 wi
+      wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9 wi wv8
+      wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi wi wi wi
+      wi wi wi wi wv1 wc7 wi wv8 wc3 wc1 wi wi wi ax-1 ax-mp wv1 wc7 wi wv8 wc3
+      wc1 wi wi wi wc0 wv0 wi wn wc6 wv1 wi wc9 wi wi wc1 wv0 wn wi wv3 wv4 wi
+      wv0 wn wi wi wc2 wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn
+      wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0
+      wc6 wi wi wn wi wi wi wi wi wi wi wi wi wc8 wn wv0 wv8 wi wv5 wc8 wi wi
+      wi ax-1 ax-mp wc8 wn wv0 wv8 wi wv5 wc8 wi wi wi wv1 wc7 wi wv8 wc3 wc1
+      wi wi wi wc0 wv0 wi wn wc6 wv1 wi wc9 wi wi wc1 wv0 wn wi wv3 wv4 wi wv0
+      wn wi wi wc2 wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi wc0 wc2 wi wn wn
+      wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0 wc6 wi wc0 wc6
+      wi wi wn wi wi wi wi wi wi wi wi wi wi wv8 wc9 wi wv9 wv3 wi wi wn ax-1
+      ax-mp wv8 wc9 wi wv9 wv3 wi wi wn wc8 wn wv0 wv8 wi wv5 wc8 wi wi wi wv1
+      wc7 wi wv8 wc3 wc1 wi wi wi wc0 wv0 wi wn wc6 wv1 wi wc9 wi wi wc1 wv0 wn
+      wi wv3 wv4 wi wv0 wn wi wi wc2 wv0 wi wc1 wc1 wc8 wi wv8 wc1 wc9 wi wi wi
+      wc0 wc2 wi wn wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn wc9 wc8 wi wi wc0
+      wc6 wi wc0 wc6 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wc7 wv8 wi wv9
+      wi wv0 wv7 wi wv6 wv1 wi wi wi ax-1 ax-mp wc7 wv8 wi wv9 wi wv0 wv7 wi
+      wv6 wv1 wi wi wi wv8 wc9 wi wv9 wv3 wi wi wn wc8 wn wv0 wv8 wi wv5 wc8 wi
+      wi wi wv1 wc7 wi wv8 wc3 wc1 wi wi wi wc0 wv0 wi wn wc6 wv1 wi wc9 wi wi
+      wc1 wv0 wn wi wv3 wv4 wi wv0 wn wi wi wc2 wv0 wi wc1 wc1 wc8 wi wv8 wc1
+      wc9 wi wi wi wc0 wc2 wi wn wn wc3 wv9 wv9 wi wv8 wc6 wi wi wi wc6 wn wc9
+      wc8 wi wi wc0 wc6 wi wc0 wc6 wi wi wn wi wi wi wi wi wi wi wi wi wi wi wi
+      wc7 wv8 wi wv9 wi wv0 wv7 wi wv6 wv1 wi wi wi ax-1 ax-mp $.
+  wth26 $p wff ( c8 -> ( ( ( v2 -> v8 ) -> ( v1 -> v4 ) ) -> c0 ) ) $=
+      ( wc8 wi wc0 ) EBDFACFFGFF $.
+  th292 $p |- ( ( -. ( v2 -> v9 ) -> c3 ) -> ( -. c4 -> ( -. c9 -> ( v3 -> ( ( ( -. v1 -> ( c1 -> c1 ) ) -> v8 ) -> ( v8 -> ( ( ( ( v2 -> v4 ) -> v8 ) -> ( -. v7 -> ( v1 -> v1 ) ) ) -> -. ( ( v1 -> -. c4 ) -> ( ( v4 -> v2 ) -> ( v4 -> v2 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc4 wn wc9 wc1 wi wc3 ax-g8 ax-1 ax-mp ) HIZJIZCAIKKLLFLZFBDLFLEIAALLLZ
+      AQLDBLZUALLIZLZLZLZLZLZLZBGLIMLZUHLUGUHUFUGUEUFUDUEUCUDUBUCAUAQNUBTOPUCFO
+      PUDSOPUECOPUFROPUGQOPUHUIOP $.
+  th293 $p |- ( -. v8 -> -. -. v8 ) $=
+      wv8 wn wn wv8 wn wv8 wn wn wi wv8 wn ax-g5 wv8 wn wn wv8 wn ax-1 ax-mp $.
+  wth27 $p wff v8 $=
+      wv8 $.
+  th294 $p |- ( v5 -> ( v4 -> ( c4 -> ( ( c9 -> ( c8 -> c8 ) ) -> ( ( -. ( c9 -> c4 ) -> ( c5 -> ( v3 -> v3 ) ) ) -> ( ( c3 -> ( v4 -> ( v8 -> v4 ) ) ) -> ( v5 -> ( ( -. ( c9 -> c4 ) -> ( c5 -> ( v3 -> v3 ) ) ) -> ( ( v4 -> -. ( c6 -> v8 ) ) -> ( v6 -> v4 ) ) ) ) ) ) ) ) ) ) $=
+      wv4 wc4 wc9 wc8 wc8 wi wi wc9 wc4 wi wn wc5 wv3 wv3 wi wi wi wc3 wv4 wv8
+      wv4 wi wi wi wv5 wc9 wc4 wi wn wc5 wv3 wv3 wi wi wi wv4 wc6 wv8 wi wn wi
+      wv6 wv4 wi wi wi wi wi wi wi wi wi wv5 wv4 wc4 wc9 wc8 wc8 wi wi wc9 wc4
+      wi wn wc5 wv3 wv3 wi wi wi wc3 wv4 wv8 wv4 wi wi wi wv5 wc9 wc4 wi wn wc5
+      wv3 wv3 wi wi wi wv4 wc6 wv8 wi wn wi wv6 wv4 wi wi wi wi wi wi wi wi wi
+      wi wc4 wc9 wc8 wc8 wi wi wc9 wc4 wi wn wc5 wv3 wv3 wi wi wi wc3 wv4 wv8
+      wv4 wi wi wi wv5 wc9 wc4 wi wn wc5 wv3 wv3 wi wi wi wv4 wc6 wv8 wi wn wi
+      wv6 wv4 wi wi wi wi wi wi wi wi wv4 wc4 wc9 wc8 wc8 wi wi wc9 wc4 wi wn
+      wc5 wv3 wv3 wi wi wi wc3 wv4 wv8 wv4 wi wi wi wv5 wc9 wc4 wi wn wc5 wv3
+      wv3 wi wi wi wv4 wc6 wv8 wi wn wi wv6 wv4 wi wi wi wi wi wi wi wi wi wc9
+      wc8 wc8 wi wi wc9 wc4 wi wn wc5 wv3 wv3 wi wi wi wc3 wv4 wv8 wv4 wi wi wi
+      wv5 wc9 wc4 wi wn wc5 wv3 wv3 wi wi wi wv4 wc6 wv8 wi wn wi wv6 wv4 wi wi
+      wi wi wi wi wi wc4 wc9 wc8 wc8 wi wi wc9 wc4 wi wn wc5 wv3 wv3 wi wi wi
+      wc3 wv4 wv8 wv4 wi wi wi wv5 wc9 wc4 wi wn wc5 wv3 wv3 wi wi wi wv4 wc6
+      wv8 wi wn wi wv6 wv4 wi wi wi wi wi wi wi wi wv6 wv4 wv3 wv8 wv5 th74 wc9
+      wc8 wc8 wi wi wc9 wc4 wi wn wc5 wv3 wv3 wi wi wi wc3 wv4 wv8 wv4 wi wi wi
+      wv5 wc9 wc4 wi wn wc5 wv3 wv3 wi wi wi wv4 wc6 wv8 wi wn wi wv6 wv4 wi wi
+      wi wi wi wi wi wc4 ax-1 ax-mp wc4 wc9 wc8 wc8 wi wi wc9 wc4 wi wn wc5 wv3
+      wv3 wi wi wi wc3 wv4 wv8 wv4 wi wi wi wv5 wc9 wc4 wi wn wc5 wv3 wv3 wi wi
+      wi wv4 wc6 wv8 wi wn wi wv6 wv4 wi wi wi wi wi wi wi wi wv4 ax-1 ax-mp
+      wv4 wc4 wc9 wc8 wc8 wi wi wc9 wc4 wi wn wc5 wv3 wv3 wi wi wi wc3 wv4 wv8
+      wv4 wi wi wi wv5 wc9 wc4 wi wn wc5 wv3 wv3 wi wi wi wv4 wc6 wv8 wi wn wi
+      wv6 wv4 wi wi wi wi wi wi wi wi wi wv5 ax-1 ax-mp $.
+  th295 $p |- ( -. ( -. c5 -> ( v6 -> c0 ) ) -> ( c4 -> ( ( v0 -> ( v7 -> ( c2 -> v6 ) ) ) -> ( ( ( ( c7 -> c4 ) -> -. v9 ) -> v6 ) -> ( ( v3 -> v8 ) -> ( ( ( ( v9 -> v9 ) -> ( v8 -> v1 ) ) -> ( ( v4 -> c7 ) -> ( v3 -> v5 ) ) ) -> ( -. v4 -> ( -. ( ( v3 -> v8 ) -> c4 ) -> ( v3 -> v8 ) ) ) ) ) ) ) ) ) $=
+      ( wc4 wc2 wi wc7 wn wc5 wc0 ax-g1 ax-1 ax-mp ) JAGKFLLLZMJLINLFLZCHLZIILH
+      BLLDMLCELLLZDNZUBJLNUBLZLZLZLZLZLZLZONFPLLNZUKLUJUKUIUJUHUIUGUHUFUGUEUFJU
+      BUBQUEUDRSUFUCRSUGUBRSUHUARSUITRSUJJRSUKULRS $.
+  wth28 $p wff ( ( ( ( c0 -> v8 ) -> ( c8 -> c8 ) ) -> v9 ) -> ( ( ( v2 -> v1 ) -> ( c3 -> v6 ) ) -> ( ( v7 -> c7 ) -> ( c3 -> v2 ) ) ) ) $=
+      ( wc0 wi wc8 wc3 wc7 ) GEHIIHHFHBAHJCHHDKHJBHHHH $.
+  wth29 $p wff c1 $=
+      ( wc1 ) A $.
+  wth30 $p wff v8 $=
+      wv8 $.
+  th296 $p |- ( ( -. v7 -> ( ( v9 -> v2 ) -> ( v7 -> v7 ) ) ) -> ( -. ( c7 -> c7 ) -> -. ( ( v9 -> v3 ) -> ( v9 -> v3 ) ) ) ) $=
+      wc7 wc7 wi wn wv9 wv3 wi wv9 wv3 wi wi wn wi wv7 wn wv9 wv2 wi wv7 wv7 wi
+      wi wi wc7 wc7 wi wn wv9 wv3 wi wv9 wv3 wi wi wn wi wi wv9 wv3 wi wv9 wv3
+      wi wc7 wc7 ax-g3 wc7 wc7 wi wn wv9 wv3 wi wv9 wv3 wi wi wn wi wv7 wn wv9
+      wv2 wi wv7 wv7 wi wi wi ax-1 ax-mp $.
+  th297 $p |- ( v5 -> ( ( c2 -> c0 ) -> ( ( -. ( v2 -> c5 ) -> -. -. v1 ) -> ( -. ( v0 -> v0 ) -> ( ( -. v8 -> -. -. v9 ) -> ( ( -. ( v0 -> v9 ) -> -. ( v3 -> v3 ) ) -> ( ( v3 -> v3 ) -> ( v0 -> v9 ) ) ) ) ) ) ) ) $=
+      ( wc2 wc0 wi wc5 wn ax-3 ax-1 ax-mp ) HIJZCKJLBLLJZAAJLZFLGLLJZAGJZLDDJZL
+      JUATJJZJZJZJZJZEUFJUEUFUDUEUCUDUBUCTUAMUBSNOUCRNOUDQNOUEPNOUFENO $.
+  th298 $p |- ( -. v2 -> ( -. v2 -> ( ( ( ( c1 -> v1 ) -> ( v0 -> v9 ) ) -> ( ( v4 -> c4 ) -> -. c1 ) ) -> -. v2 ) ) ) $=
+      ( wn wc1 wi wc4 ax-g2 ax-1 ax-mp ) CFZGBHAEHHDIHGFHHZMHZHZMPHOPMOMJMNKLOM
+      KLPMKL $.
+  wth31 $p wff ( -. ( c0 -> ( c5 -> v8 ) ) -> ( ( v3 -> ( v2 -> c3 ) ) -> v9 ) ) $=
+      wc0 wc5 wv8 wi wi wn wv3 wv2 wc3 wi wi wv9 wi wi $.
+  th299 $p |- ( c8 -> -. c6 ) $=
+      wc6 wn wc8 wc6 wn wi wc6 ax-g5 wc6 wn wc8 ax-1 ax-mp $.
+  th300 $p |- ( ( ( ( v5 -> v5 ) -> ( c9 -> c6 ) ) -> ( ( v2 -> v8 ) -> ( v4 -> c6 ) ) ) -> ( v0 -> ( ( v6 -> ( ( v0 -> v1 ) -> ( c5 -> c9 ) ) ) -> ( ( ( -. c3 -> ( v0 -> v3 ) ) -> ( ( c5 -> c4 ) -> ( v6 -> v6 ) ) ) -> ( ( ( v3 -> c0 ) -> c0 ) -> -. ( ( v3 -> c0 ) -> ( v3 -> c0 ) ) ) ) ) ) ) $=
+      ( wi wc5 wc9 wc3 wn wc4 wc0 wc6 th119 ax-1 ax-mp ) AGABIJKIIILMADIIJNIGGI
+      IIDOIOIDOIDOIIMIIIZIZFFIKPIICHIEPIIIZUAITUAAAGBDGQTARSUAUBRS $.
+  th301 $p |- ( ( c4 -> c4 ) -> ( ( ( ( v2 -> v1 ) -> v0 ) -> ( ( c8 -> v0 ) -> ( c0 -> v9 ) ) ) -> ( ( ( v8 -> v6 ) -> v6 ) -> ( ( ( v7 -> -. v2 ) -> -. c1 ) -> ( -. ( ( v3 -> c8 ) -> -. c6 ) -> ( ( -. -. v5 -> c3 ) -> ( ( ( v7 -> -. v2 ) -> -. c1 ) -> ( -. c1 -> ( -. c1 -> ( ( ( ( c1 -> c1 ) -> ( v3 -> v7 ) ) -> ( ( c4 -> c4 ) -> -. c1 ) ) -> -. c1 ) ) ) ) ) ) ) ) ) ) $=
+      wv4 wv4 wv4 wi wi wc4 wc4 wi wv2 wv1 wi wv0 wi wc8 wv0 wi wc0 wv9 wi wi
+      wi wv8 wv6 wi wv6 wi wv7 wv2 wn wi wc1 wn wi wv3 wc8 wi wc6 wn wi wn wv5
+      wn wn wc3 wi wv7 wv2 wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi
+      wi wc4 wc4 wi wc1 wn wi wi wc1 wn wi wi wi wi wi wi wi wi wi wi wv4 wv4
+      ax-1 wc4 wc4 wi wv2 wv1 wi wv0 wi wc8 wv0 wi wc0 wv9 wi wi wi wv8 wv6 wi
+      wv6 wi wv7 wv2 wn wi wc1 wn wi wv3 wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi
+      wv7 wv2 wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi
+      wc1 wn wi wi wc1 wn wi wi wi wi wi wi wi wi wi wi wv4 wv4 wv4 wi wi wc4
+      wc4 wi wv2 wv1 wi wv0 wi wc8 wv0 wi wc0 wv9 wi wi wi wv8 wv6 wi wv6 wi
+      wv7 wv2 wn wi wc1 wn wi wv3 wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi wv7 wv2
+      wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn
+      wi wi wc1 wn wi wi wi wi wi wi wi wi wi wi wi wv2 wv1 wi wv0 wi wc8 wv0
+      wi wc0 wv9 wi wi wi wv8 wv6 wi wv6 wi wv7 wv2 wn wi wc1 wn wi wv3 wc8 wi
+      wc6 wn wi wn wv5 wn wn wc3 wi wv7 wv2 wn wi wc1 wn wi wc1 wn wc1 wn wc1
+      wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn wi wi wc1 wn wi wi wi wi wi wi wi
+      wi wi wc4 wc4 wi wv2 wv1 wi wv0 wi wc8 wv0 wi wc0 wv9 wi wi wi wv8 wv6 wi
+      wv6 wi wv7 wv2 wn wi wc1 wn wi wv3 wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi
+      wv7 wv2 wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi
+      wc1 wn wi wi wc1 wn wi wi wi wi wi wi wi wi wi wi wv8 wv6 wi wv6 wi wv7
+      wv2 wn wi wc1 wn wi wv3 wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi wv7 wv2 wn
+      wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn wi
+      wi wc1 wn wi wi wi wi wi wi wi wi wv2 wv1 wi wv0 wi wc8 wv0 wi wc0 wv9 wi
+      wi wi wv8 wv6 wi wv6 wi wv7 wv2 wn wi wc1 wn wi wv3 wc8 wi wc6 wn wi wn
+      wv5 wn wn wc3 wi wv7 wv2 wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7
+      wi wi wc4 wc4 wi wc1 wn wi wi wc1 wn wi wi wi wi wi wi wi wi wi wv7 wv2
+      wn wi wc1 wn wi wv3 wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi wv7 wv2 wn wi
+      wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn wi wi
+      wc1 wn wi wi wi wi wi wi wi wv8 wv6 wi wv6 wi wv7 wv2 wn wi wc1 wn wi wv3
+      wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi wv7 wv2 wn wi wc1 wn wi wc1 wn wc1
+      wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn wi wi wc1 wn wi wi wi wi wi
+      wi wi wi wv3 wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi wv7 wv2 wn wi wc1 wn wi
+      wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn wi wi wc1 wn wi
+      wi wi wi wi wi wv7 wv2 wn wi wc1 wn wi wv3 wc8 wi wc6 wn wi wn wv5 wn wn
+      wc3 wi wv7 wv2 wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4
+      wc4 wi wc1 wn wi wi wc1 wn wi wi wi wi wi wi wi wv5 wn wn wc3 wi wv7 wv2
+      wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn
+      wi wi wc1 wn wi wi wi wi wi wv3 wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi wv7
+      wv2 wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1
+      wn wi wi wc1 wn wi wi wi wi wi wi wv7 wv2 wn wi wc1 wn wi wc1 wn wc1 wn
+      wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn wi wi wc1 wn wi wi wi wi wv5
+      wn wn wc3 wi wv7 wv2 wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi
+      wi wc4 wc4 wi wc1 wn wi wi wc1 wn wi wi wi wi wi wc1 wn wc1 wn wc1 wc1 wi
+      wv3 wv7 wi wi wc4 wc4 wi wc1 wn wi wi wc1 wn wi wi wi wv7 wv2 wn wi wc1
+      wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn wi wi wc1
+      wn wi wi wi wi wv3 wc1 wc1 wc4 wv7 th298 wc1 wn wc1 wn wc1 wc1 wi wv3 wv7
+      wi wi wc4 wc4 wi wc1 wn wi wi wc1 wn wi wi wi wv7 wv2 wn wi wc1 wn wi
+      ax-1 ax-mp wv7 wv2 wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi
+      wc4 wc4 wi wc1 wn wi wi wc1 wn wi wi wi wi wv5 wn wn wc3 wi ax-1 ax-mp
+      wv5 wn wn wc3 wi wv7 wv2 wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7
+      wi wi wc4 wc4 wi wc1 wn wi wi wc1 wn wi wi wi wi wi wv3 wc8 wi wc6 wn wi
+      wn ax-1 ax-mp wv3 wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi wv7 wv2 wn wi wc1
+      wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn wi wi wc1
+      wn wi wi wi wi wi wi wv7 wv2 wn wi wc1 wn wi ax-1 ax-mp wv7 wv2 wn wi wc1
+      wn wi wv3 wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi wv7 wv2 wn wi wc1 wn wi
+      wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn wi wi wc1 wn wi
+      wi wi wi wi wi wi wv8 wv6 wi wv6 wi ax-1 ax-mp wv8 wv6 wi wv6 wi wv7 wv2
+      wn wi wc1 wn wi wv3 wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi wv7 wv2 wn wi
+      wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn wi wi
+      wc1 wn wi wi wi wi wi wi wi wi wv2 wv1 wi wv0 wi wc8 wv0 wi wc0 wv9 wi wi
+      wi ax-1 ax-mp wv2 wv1 wi wv0 wi wc8 wv0 wi wc0 wv9 wi wi wi wv8 wv6 wi
+      wv6 wi wv7 wv2 wn wi wc1 wn wi wv3 wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi
+      wv7 wv2 wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi
+      wc1 wn wi wi wc1 wn wi wi wi wi wi wi wi wi wi wc4 wc4 wi ax-1 ax-mp wc4
+      wc4 wi wv2 wv1 wi wv0 wi wc8 wv0 wi wc0 wv9 wi wi wi wv8 wv6 wi wv6 wi
+      wv7 wv2 wn wi wc1 wn wi wv3 wc8 wi wc6 wn wi wn wv5 wn wn wc3 wi wv7 wv2
+      wn wi wc1 wn wi wc1 wn wc1 wn wc1 wc1 wi wv3 wv7 wi wi wc4 wc4 wi wc1 wn
+      wi wi wc1 wn wi wi wi wi wi wi wi wi wi wi wv4 wv4 wv4 wi wi ax-1 ax-mp
+      ax-mp $.
+  th302 $p |- ( ( ( ( v4 -> c6 ) -> -. c6 ) -> c6 ) -> ( ( ( -. c5 -> v1 ) -> v5 ) -> ( v0 -> ( -. v0 -> ( ( ( v4 -> ( v4 -> c0 ) ) -> ( ( c0 -> c2 ) -> ( v5 -> v5 ) ) ) -> ( ( ( ( v7 -> c7 ) -> ( c5 -> c1 ) ) -> -. -. v9 ) -> ( v9 -> ( v4 -> ( -. ( ( v4 -> v3 ) -> -. v4 ) -> ( -. -. v0 -> ( ( v4 -> v3 ) -> -. v0 ) ) ) ) ) ) ) ) ) ) ) $=
+      wv2 wv2 wv2 wi wi wv4 wc6 wi wc6 wn wi wc6 wi wc5 wn wv1 wi wv5 wi wv0
+      wv0 wn wv4 wv4 wc0 wi wi wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi wc5 wc1
+      wi wi wv9 wn wn wi wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi
+      wv0 wn wi wi wi wi wi wi wi wi wi wi wi wv2 wv2 ax-1 wv4 wc6 wi wc6 wn wi
+      wc6 wi wc5 wn wv1 wi wv5 wi wv0 wv0 wn wv4 wv4 wc0 wi wi wc0 wc2 wi wv5
+      wv5 wi wi wi wv7 wc7 wi wc5 wc1 wi wi wv9 wn wn wi wv9 wv4 wv4 wv3 wi wv4
+      wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wi wi wi wi wi wi wi wi wv2
+      wv2 wv2 wi wi wv4 wc6 wi wc6 wn wi wc6 wi wc5 wn wv1 wi wv5 wi wv0 wv0 wn
+      wv4 wv4 wc0 wi wi wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi wc5 wc1 wi wi
+      wv9 wn wn wi wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn
+      wi wi wi wi wi wi wi wi wi wi wi wi wc5 wn wv1 wi wv5 wi wv0 wv0 wn wv4
+      wv4 wc0 wi wi wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi wc5 wc1 wi wi wv9 wn
+      wn wi wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi
+      wi wi wi wi wi wi wi wi wv4 wc6 wi wc6 wn wi wc6 wi wc5 wn wv1 wi wv5 wi
+      wv0 wv0 wn wv4 wv4 wc0 wi wi wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi wc5
+      wc1 wi wi wv9 wn wn wi wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3
+      wi wv0 wn wi wi wi wi wi wi wi wi wi wi wi wv0 wv0 wn wv4 wv4 wc0 wi wi
+      wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi wc5 wc1 wi wi wv9 wn wn wi wv9 wv4
+      wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wi wi wi wi
+      wi wi wc5 wn wv1 wi wv5 wi wv0 wv0 wn wv4 wv4 wc0 wi wi wc0 wc2 wi wv5
+      wv5 wi wi wi wv7 wc7 wi wc5 wc1 wi wi wv9 wn wn wi wv9 wv4 wv4 wv3 wi wv4
+      wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wi wi wi wi wi wi wi wv0 wn
+      wv4 wv4 wc0 wi wi wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi wc5 wc1 wi wi
+      wv9 wn wn wi wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn
+      wi wi wi wi wi wi wi wi wv0 wv0 wn wv4 wv4 wc0 wi wi wc0 wc2 wi wv5 wv5
+      wi wi wi wv7 wc7 wi wc5 wc1 wi wi wv9 wn wn wi wv9 wv4 wv4 wv3 wi wv4 wn
+      wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wi wi wi wi wi wi wv4 wv4 wc0
+      wi wi wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi wc5 wc1 wi wi wv9 wn wn wi
+      wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wi
+      wi wi wi wv0 wn wv4 wv4 wc0 wi wi wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi
+      wc5 wc1 wi wi wv9 wn wn wi wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4
+      wv3 wi wv0 wn wi wi wi wi wi wi wi wi wv7 wc7 wi wc5 wc1 wi wi wv9 wn wn
+      wi wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi
+      wi wi wi wv4 wv4 wc0 wi wi wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi wc5 wc1
+      wi wi wv9 wn wn wi wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi
+      wv0 wn wi wi wi wi wi wi wi wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4
+      wv3 wi wv0 wn wi wi wi wi wi wv7 wc7 wi wc5 wc1 wi wi wv9 wn wn wi wv9
+      wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wi wi wi
+      wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wi wv9
+      wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wi wi
+      wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wv4 wv4 wv3
+      wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wi wv4 wv3 wi wv4 wn
+      wv4 wv3 wi wv0 wn ax-g9 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0
+      wn wi wi wi wv4 ax-1 ax-mp wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3
+      wi wv0 wn wi wi wi wi wv9 ax-1 ax-mp wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0
+      wn wn wv4 wv3 wi wv0 wn wi wi wi wi wi wv7 wc7 wi wc5 wc1 wi wi wv9 wn wn
+      wi ax-1 ax-mp wv7 wc7 wi wc5 wc1 wi wi wv9 wn wn wi wv9 wv4 wv4 wv3 wi
+      wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wi wi wi wv4 wv4 wc0 wi
+      wi wc0 wc2 wi wv5 wv5 wi wi wi ax-1 ax-mp wv4 wv4 wc0 wi wi wc0 wc2 wi
+      wv5 wv5 wi wi wi wv7 wc7 wi wc5 wc1 wi wi wv9 wn wn wi wv9 wv4 wv4 wv3 wi
+      wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wi wi wi wi wv0 wn ax-1
+      ax-mp wv0 wn wv4 wv4 wc0 wi wi wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi wc5
+      wc1 wi wi wv9 wn wn wi wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3
+      wi wv0 wn wi wi wi wi wi wi wi wi wv0 ax-1 ax-mp wv0 wv0 wn wv4 wv4 wc0
+      wi wi wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi wc5 wc1 wi wi wv9 wn wn wi
+      wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi wi
+      wi wi wi wi wi wc5 wn wv1 wi wv5 wi ax-1 ax-mp wc5 wn wv1 wi wv5 wi wv0
+      wv0 wn wv4 wv4 wc0 wi wi wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi wc5 wc1
+      wi wi wv9 wn wn wi wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi
+      wv0 wn wi wi wi wi wi wi wi wi wi wi wv4 wc6 wi wc6 wn wi wc6 wi ax-1
+      ax-mp wv4 wc6 wi wc6 wn wi wc6 wi wc5 wn wv1 wi wv5 wi wv0 wv0 wn wv4 wv4
+      wc0 wi wi wc0 wc2 wi wv5 wv5 wi wi wi wv7 wc7 wi wc5 wc1 wi wi wv9 wn wn
+      wi wv9 wv4 wv4 wv3 wi wv4 wn wi wn wv0 wn wn wv4 wv3 wi wv0 wn wi wi wi
+      wi wi wi wi wi wi wi wi wv2 wv2 wv2 wi wi ax-1 ax-mp ax-mp $.
+  th303 $p |- ( -. ( v6 -> c9 ) -> ( v1 -> ( c4 -> ( v1 -> ( v1 -> ( v1 -> ( v8 -> v1 ) ) ) ) ) ) ) $=
+      ( wc4 wi wc9 wn ax-1 ax-mp ) ADAAACAEEZEZEZEZEZBFEGZNEMNLMKLJKACHJAHIKAHI
+      LDHIMAHINOHI $.
+  th304 $p |- ( v1 -> ( c2 -> ( -. ( v0 -> c8 ) -> -. ( ( v2 -> c4 ) -> ( v2 -> c4 ) ) ) ) ) $=
+      ( wc2 wc8 wi wn wc4 ax-g7 ax-1 ax-mp ) DAEFZGCHFZMFGFZFZBOFNOLMINDJKOBJK
+      $.
+  th305 $p |- ( ( ( ( c2 -> c7 ) -> ( v2 -> c6 ) ) -> ( ( v8 -> v8 ) -> ( v2 -> v8 ) ) ) -> ( -. c6 -> ( v1 -> ( ( c5 -> v2 ) -> ( ( ( ( c2 -> v1 ) -> ( v2 -> c1 ) ) -> ( ( c7 -> v8 ) -> ( c3 -> v8 ) ) ) -> ( v6 -> c6 ) ) ) ) ) ) $=
+      ( wv3 wi wc2 wc7 wc6 wn wc5 wc1 wc3 ax-1 ax-g2 ax-mp ) EEEFFZGHFBIFFDDFBD
+      FFFZIJZAKBFZGAFBLFFHDFMDFFFZCIFZFZFZFZFZFZEENUGQUGFUFUGUEUFUDUEUCUDUBUCUB
+      OUBUANPUCTNPUDANPUESNPUFRNPUGQNPP $.
+  th306 $p |- ( ( ( ( v6 -> c0 ) -> ( v8 -> v2 ) ) -> ( ( v7 -> v0 ) -> ( c2 -> v3 ) ) ) -> ( c5 -> ( ( ( ( v3 -> c4 ) -> ( v2 -> v7 ) ) -> v6 ) -> ( c9 -> ( ( ( ( v6 -> c0 ) -> ( v8 -> v2 ) ) -> ( ( v7 -> v0 ) -> ( c2 -> v3 ) ) ) -> ( ( -. c5 -> v0 ) -> ( v2 -> ( c9 -> ( c1 -> ( ( ( ( c8 -> c9 ) -> c5 ) -> ( ( c0 -> c1 ) -> ( v3 -> c5 ) ) ) -> ( ( ( c5 -> ( v6 -> c8 ) ) -> -. -. v3 ) -> ( ( ( ( c2 -> v3 ) -> c0 ) -> c8 ) -> ( ( ( v3 -> ( c0 -> v3 ) ) -> -. ( c5 -> c4 ) ) -> ( c1 -> ( -. ( c9 -> c1 ) -> ( -. ( v3 -> c6 ) -> ( c1 -> ( v3 -> c6 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc5 wc4 wi wc9 wc0 wc2 wn wc1 wc8 wc6 th181 ax-1 ax-mp ) GCHIBEIIDIZJDK
+      IFBIIEAILCIIIZGMAIZBJNOJIGIKNICGIIIGDOIICMMILCIKIOICKCIIGHIMINJNIMCPIMNCP
+      IIIIIIIIIIZIZIZIZIZIZIZIZUAUJIUIUJUHUIUGUHUFUGUEUFUDUEUCUDCKGJCHNLDQUCJRS
+      UDBRSUEUBRSUFUARSUGJRSUHTRSUIGRSUJUARS $.
+  th307 $p |- ( v4 -> ( -. v8 -> ( -. ( ( v7 -> v5 ) -> v9 ) -> ( v6 -> ( ( ( -. v3 -> c1 ) -> v4 ) -> ( -. ( ( v4 -> v1 ) -> v5 ) -> ( ( v3 -> v3 ) -> ( ( c5 -> v7 ) -> ( v3 -> v3 ) ) ) ) ) ) ) ) ) $=
+      ( wn wi wc1 wc5 ax-1 ax-mp ) GIZFDJHJIZEBIKJCJZCAJDJIZBBJZLFJZSJJZJZJZJZJ
+      ZJZCUFJUEUFUDUEUCUDUBUCUAUBSTMUARMNUBQMNUCEMNUDPMNUEOMNUFCMN $.
+  th308 $p |- ( ( -. ( v2 -> v2 ) -> ( v1 -> ( c7 -> v8 ) ) ) -> ( ( v3 -> ( v4 -> v4 ) ) -> ( ( c6 -> c2 ) -> ( ( ( ( v3 -> v4 ) -> ( v4 -> c6 ) ) -> ( ( v8 -> c7 ) -> c8 ) ) -> ( -. ( v3 -> c4 ) -> ( ( ( ( v8 -> v8 ) -> -. c0 ) -> ( ( c0 -> v2 ) -> ( v2 -> v8 ) ) ) -> ( ( v4 -> ( c8 -> ( v2 -> v4 ) ) ) -> -. ( ( ( v3 -> v8 ) -> ( c6 -> c2 ) ) -> ( ( v3 -> v8 ) -> ( v3 -> v8 ) ) ) ) ) ) ) ) ) ) $=
+      wv3 wv4 wv4 wi wi wc6 wc2 wi wv3 wv4 wi wv4 wc6 wi wi wv8 wc7 wi wc8 wi
+      wi wv3 wc4 wi wn wv8 wv8 wi wc0 wn wi wc0 wv2 wi wv2 wv8 wi wi wi wv4 wc8
+      wv2 wv4 wi wi wi wv3 wv8 wi wc6 wc2 wi wi wv3 wv8 wi wv3 wv8 wi wi wi wn
+      wi wi wi wi wi wi wv2 wv2 wi wn wv1 wc7 wv8 wi wi wi wv3 wv4 wv4 wi wi
+      wc6 wc2 wi wv3 wv4 wi wv4 wc6 wi wi wv8 wc7 wi wc8 wi wi wv3 wc4 wi wn
+      wv8 wv8 wi wc0 wn wi wc0 wv2 wi wv2 wv8 wi wi wi wv4 wc8 wv2 wv4 wi wi wi
+      wv3 wv8 wi wc6 wc2 wi wi wv3 wv8 wi wv3 wv8 wi wi wi wn wi wi wi wi wi wi
+      wi wv4 wv2 wv2 wv4 wv4 wv8 wv3 wv4 wv3 wv8 th60 wv3 wv4 wv4 wi wi wc6 wc2
+      wi wv3 wv4 wi wv4 wc6 wi wi wv8 wc7 wi wc8 wi wi wv3 wc4 wi wn wv8 wv8 wi
+      wc0 wn wi wc0 wv2 wi wv2 wv8 wi wi wi wv4 wc8 wv2 wv4 wi wi wi wv3 wv8 wi
+      wc6 wc2 wi wi wv3 wv8 wi wv3 wv8 wi wi wi wn wi wi wi wi wi wi wv2 wv2 wi
+      wn wv1 wc7 wv8 wi wi wi ax-1 ax-mp $.
+  th309 $p |- ( ( v5 -> c7 ) -> ( v1 -> ( ( c7 -> ( v6 -> ( v6 -> v5 ) ) ) -> ( v5 -> -. ( ( ( v8 -> v8 ) -> v8 ) -> ( ( v5 -> c7 ) -> ( v5 -> c7 ) ) ) ) ) ) ) $=
+      wv7 wv7 wv7 wi wi wv5 wc7 wi wv1 wc7 wv6 wv6 wv5 wi wi wi wv5 wv8 wv8 wi
+      wv8 wi wv5 wc7 wi wv5 wc7 wi wi wi wn wi wi wi wi wv7 wv7 ax-1 wv5 wc7 wi
+      wv1 wc7 wv6 wv6 wv5 wi wi wi wv5 wv8 wv8 wi wv8 wi wv5 wc7 wi wv5 wc7 wi
+      wi wi wn wi wi wi wi wv7 wv7 wv7 wi wi wv5 wc7 wi wv1 wc7 wv6 wv6 wv5 wi
+      wi wi wv5 wv8 wv8 wi wv8 wi wv5 wc7 wi wv5 wc7 wi wi wi wn wi wi wi wi wi
+      wv1 wc7 wv6 wv6 wv5 wi wi wi wv5 wv8 wv8 wi wv8 wi wv5 wc7 wi wv5 wc7 wi
+      wi wi wn wi wi wi wv5 wc7 wi wv1 wc7 wv6 wv6 wv5 wi wi wi wv5 wv8 wv8 wi
+      wv8 wi wv5 wc7 wi wv5 wc7 wi wi wi wn wi wi wi wi wc7 wv6 wv6 wv5 wi wi
+      wi wv5 wv8 wv8 wi wv8 wi wv5 wc7 wi wv5 wc7 wi wi wi wn wi wi wv1 wc7 wv6
+      wv6 wv5 wi wi wi wv5 wv8 wv8 wi wv8 wi wv5 wc7 wi wv5 wc7 wi wi wi wn wi
+      wi wi wv5 wv8 wv8 wi wv8 wi wv5 wc7 wi wv5 wc7 wi wi wi wn wi wc7 wv6 wv6
+      wv5 wi wi wi wv5 wv8 wv8 wi wv8 wi wv5 wc7 wi wv5 wc7 wi wi wi wn wi wi
+      wv8 wv8 wi wv8 wi wv5 wc7 wi wv5 wc7 wi wi wi wn wv5 wv8 wv8 wi wv8 wi
+      wv5 wc7 wi wv5 wc7 wi wi wi wn wi wv8 wv8 wi wv5 wc7 wi wv8 ax-g8 wv8 wv8
+      wi wv8 wi wv5 wc7 wi wv5 wc7 wi wi wi wn wv5 ax-1 ax-mp wv5 wv8 wv8 wi
+      wv8 wi wv5 wc7 wi wv5 wc7 wi wi wi wn wi wc7 wv6 wv6 wv5 wi wi wi ax-1
+      ax-mp wc7 wv6 wv6 wv5 wi wi wi wv5 wv8 wv8 wi wv8 wi wv5 wc7 wi wv5 wc7
+      wi wi wi wn wi wi wv1 ax-1 ax-mp wv1 wc7 wv6 wv6 wv5 wi wi wi wv5 wv8 wv8
+      wi wv8 wi wv5 wc7 wi wv5 wc7 wi wi wi wn wi wi wi wv5 wc7 wi ax-1 ax-mp
+      wv5 wc7 wi wv1 wc7 wv6 wv6 wv5 wi wi wi wv5 wv8 wv8 wi wv8 wi wv5 wc7 wi
+      wv5 wc7 wi wi wi wn wi wi wi wi wv7 wv7 wv7 wi wi ax-1 ax-mp ax-mp $.
+  th310 $p |- ( ( ( ( c5 -> v4 ) -> ( c2 -> c5 ) ) -> ( ( c0 -> v3 ) -> -. v2 ) ) -> ( c3 -> ( ( ( ( v6 -> v5 ) -> -. v9 ) -> v4 ) -> ( c2 -> ( ( v5 -> v1 ) -> ( ( c3 -> ( c3 -> ( v9 -> c1 ) ) ) -> ( ( c3 -> c3 ) -> ( c3 -> ( v9 -> c1 ) ) ) ) ) ) ) ) ) $=
+      ( wv8 wi wc5 wc2 wc0 wn wc3 wc1 ax-1 ax-2 ax-mp ) HHHIIZJDIKJIILCIBMIIZNF
+      EIGMIDIZKEAIZNNGOIZIINNINUCIIIZIZIZIZIZIZHHPUISUIIUHUIUGUHUFUGUEUFUDUENNU
+      CQUDUBPRUEKPRUFUAPRUGNPRUHTPRUISPRR $.
+  th311 $p |- ( ( v2 -> v6 ) -> ( ( ( v0 -> ( c2 -> c8 ) ) -> ( -. v8 -> -. v9 ) ) -> ( ( ( v0 -> ( c2 -> c8 ) ) -> ( -. v8 -> -. v9 ) ) -> ( v2 -> v6 ) ) ) ) $=
+      ( wv3 wi wc2 wc8 wn ax-1 ax-g4 ax-mp ) FFFGGZBCGZAHIGGDJEJGGZPOGZGZGZFFKS
+      NSGRSQROQOLOPKMQPKMROKMSNKMM $.
+  th312 $p |- ( v1 -> ( ( ( -. v2 -> -. v5 ) -> ( v1 -> ( c1 -> c1 ) ) ) -> ( -. ( ( c1 -> v4 ) -> -. v7 ) -> ( -. ( v5 -> v0 ) -> ( ( ( v1 -> -. v9 ) -> ( ( v4 -> v2 ) -> ( v5 -> v5 ) ) ) -> ( ( v3 -> ( ( c5 -> c6 ) -> ( v0 -> v1 ) ) ) -> ( ( ( -. v2 -> -. v5 ) -> ( v1 -> ( c1 -> c1 ) ) ) -> -. ( c7 -> c4 ) ) ) ) ) ) ) ) $=
+      wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc1 wv4 wi wv7 wn wi wn wv5 wv0 wi
+      wn wv1 wv9 wn wi wv4 wv2 wi wv5 wv5 wi wi wi wv3 wc5 wc6 wi wv0 wv1 wi wi
+      wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi wn wi wi wi wi wi wi
+      wv1 wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc1 wv4 wi wv7 wn wi wn wv5 wv0
+      wi wn wv1 wv9 wn wi wv4 wv2 wi wv5 wv5 wi wi wi wv3 wc5 wc6 wi wv0 wv1 wi
+      wi wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi wn wi wi wi wi wi
+      wi wi wc1 wv4 wi wv7 wn wi wn wv5 wv0 wi wn wv1 wv9 wn wi wv4 wv2 wi wv5
+      wv5 wi wi wi wv3 wc5 wc6 wi wv0 wv1 wi wi wi wv2 wn wv5 wn wi wv1 wc1 wc1
+      wi wi wi wc7 wc4 wi wn wi wi wi wi wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi
+      wi wc1 wv4 wi wv7 wn wi wn wv5 wv0 wi wn wv1 wv9 wn wi wv4 wv2 wi wv5 wv5
+      wi wi wi wv3 wc5 wc6 wi wv0 wv1 wi wi wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi
+      wi wi wc7 wc4 wi wn wi wi wi wi wi wi wv5 wv0 wi wn wv1 wv9 wn wi wv4 wv2
+      wi wv5 wv5 wi wi wi wv3 wc5 wc6 wi wv0 wv1 wi wi wi wv2 wn wv5 wn wi wv1
+      wc1 wc1 wi wi wi wc7 wc4 wi wn wi wi wi wi wc1 wv4 wi wv7 wn wi wn wv5
+      wv0 wi wn wv1 wv9 wn wi wv4 wv2 wi wv5 wv5 wi wi wi wv3 wc5 wc6 wi wv0
+      wv1 wi wi wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi wn wi wi wi
+      wi wi wv1 wv9 wn wi wv4 wv2 wi wv5 wv5 wi wi wi wv3 wc5 wc6 wi wv0 wv1 wi
+      wi wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi wn wi wi wi wv5
+      wv0 wi wn wv1 wv9 wn wi wv4 wv2 wi wv5 wv5 wi wi wi wv3 wc5 wc6 wi wv0
+      wv1 wi wi wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi wn wi wi wi
+      wi wv3 wc5 wc6 wi wv0 wv1 wi wi wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi
+      wc7 wc4 wi wn wi wi wv1 wv9 wn wi wv4 wv2 wi wv5 wv5 wi wi wi wv3 wc5 wc6
+      wi wv0 wv1 wi wi wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi wn
+      wi wi wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi wn wi wv3 wc5
+      wc6 wi wv0 wv1 wi wi wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi
+      wn wi wi wc7 wc4 wi wn wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi
+      wn wi wc7 wc4 wi ax-g5 wc7 wc4 wi wn wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi
+      wi ax-1 ax-mp wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi wn wi wv3
+      wc5 wc6 wi wv0 wv1 wi wi wi ax-1 ax-mp wv3 wc5 wc6 wi wv0 wv1 wi wi wi
+      wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi wn wi wi wv1 wv9 wn wi
+      wv4 wv2 wi wv5 wv5 wi wi wi ax-1 ax-mp wv1 wv9 wn wi wv4 wv2 wi wv5 wv5
+      wi wi wi wv3 wc5 wc6 wi wv0 wv1 wi wi wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi
+      wi wi wc7 wc4 wi wn wi wi wi wv5 wv0 wi wn ax-1 ax-mp wv5 wv0 wi wn wv1
+      wv9 wn wi wv4 wv2 wi wv5 wv5 wi wi wi wv3 wc5 wc6 wi wv0 wv1 wi wi wi wv2
+      wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi wn wi wi wi wi wc1 wv4 wi
+      wv7 wn wi wn ax-1 ax-mp wc1 wv4 wi wv7 wn wi wn wv5 wv0 wi wn wv1 wv9 wn
+      wi wv4 wv2 wi wv5 wv5 wi wi wi wv3 wc5 wc6 wi wv0 wv1 wi wi wi wv2 wn wv5
+      wn wi wv1 wc1 wc1 wi wi wi wc7 wc4 wi wn wi wi wi wi wi wv2 wn wv5 wn wi
+      wv1 wc1 wc1 wi wi wi ax-1 ax-mp wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi wc1
+      wv4 wi wv7 wn wi wn wv5 wv0 wi wn wv1 wv9 wn wi wv4 wv2 wi wv5 wv5 wi wi
+      wi wv3 wc5 wc6 wi wv0 wv1 wi wi wi wv2 wn wv5 wn wi wv1 wc1 wc1 wi wi wi
+      wc7 wc4 wi wn wi wi wi wi wi wi wv1 ax-1 ax-mp $.
+  th313 $p |- ( v7 -> ( -. -. v8 -> ( v8 -> ( ( -. ( v3 -> c9 ) -> v6 ) -> ( v8 -> ( -. ( v0 -> ( v9 -> v6 ) ) -> ( ( -. v9 -> ( v6 -> ( v5 -> v9 ) ) ) -> ( ( v3 -> c1 ) -> ( v3 -> c1 ) ) ) ) ) ) ) ) ) $=
+      ( wn wc9 wi wc1 ax-g6 ax-1 ax-mp ) FHHZFBIJHDJZFAGDJJHZGHDCGJJJZBKJZSJZJZ
+      JZJZJZJZJZEUFJUEUFUDUEUCUDUBUCUAUBTUASTSLSSMNTRMNUAQMNUBFMNUCPMNUDFMNUEOM
+      NUFEMN $.
+  th314 $p |- ( ( -. ( v6 -> v9 ) -> ( ( v5 -> v5 ) -> v6 ) ) -> ( ( c7 -> v2 ) -> ( -. c0 -> ( ( -. ( v6 -> v7 ) -> ( v6 -> v2 ) ) -> ( v2 -> ( -. c0 -> ( c0 -> ( ( ( ( c8 -> c2 ) -> ( c8 -> c2 ) ) -> -. v2 ) -> ( ( ( -. v2 -> ( c6 -> c0 ) ) -> ( ( c7 -> v0 ) -> v2 ) ) -> ( ( ( ( v2 -> c0 ) -> ( v2 -> v0 ) ) -> ( ( c9 -> c6 ) -> ( c8 -> c8 ) ) ) -> ( -. c8 -> ( ( c6 -> c4 ) -> ( ( c6 -> c4 ) -> ( ( c6 -> c4 ) -> ( c6 -> c4 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc7 wi wc0 wn wc8 wc2 wc6 wc9 wc4 th138 ax-1 ax-mp ) GBHZIJZDEHJDBHHZBT
+      IKLHKLHHBJHBJMIHHGAHBHHBIHBAHHNMHKKHHHKJMOHMOHMOHMOHHHHHHHHZHZHZHZHZHZHZD
+      FHJCCHDHHZUHHUGUHUFUGUEUFUDUEUCUDUBUCKKBKBIBAPUBIQRUCTQRUDBQRUEUAQRUFTQRU
+      GSQRUHUIQR $.
+  th315 $p |- ( v5 -> ( v5 -> ( v3 -> ( ( c1 -> c2 ) -> ( ( ( -. c1 -> v8 ) -> ( ( v8 -> v7 ) -> -. v6 ) ) -> ( ( -. ( v9 -> v4 ) -> ( v5 -> -. c6 ) ) -> ( v7 -> ( ( ( c1 -> c2 ) -> v7 ) -> -. ( ( c1 -> c2 ) -> v1 ) ) ) ) ) ) ) ) ) $=
+      wv5 wv3 wc1 wc2 wi wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi wi wv9 wv4 wi wn
+      wv5 wc6 wn wi wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi wi wi wi
+      wi wi wi wv5 wv5 wv3 wc1 wc2 wi wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi wi wv9
+      wv4 wi wn wv5 wc6 wn wi wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi
+      wi wi wi wi wi wi wi wv3 wc1 wc2 wi wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi wi
+      wv9 wv4 wi wn wv5 wc6 wn wi wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn
+      wi wi wi wi wi wi wv5 wv3 wc1 wc2 wi wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi
+      wi wv9 wv4 wi wn wv5 wc6 wn wi wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi
+      wn wi wi wi wi wi wi wi wc1 wc2 wi wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi wi
+      wv9 wv4 wi wn wv5 wc6 wn wi wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn
+      wi wi wi wi wi wv3 wc1 wc2 wi wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi wi wv9
+      wv4 wi wn wv5 wc6 wn wi wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi
+      wi wi wi wi wi wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi wi wv9 wv4 wi wn wv5
+      wc6 wn wi wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi wi wi wi wc1
+      wc2 wi wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi wi wv9 wv4 wi wn wv5 wc6 wn wi
+      wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi wi wi wi wi wv9 wv4 wi
+      wn wv5 wc6 wn wi wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi wi wi
+      wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi wi wv9 wv4 wi wn wv5 wc6 wn wi wi wv7
+      wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi wi wi wi wv7 wc1 wc2 wi wv7 wi
+      wc1 wc2 wi wv1 wi wn wi wi wv9 wv4 wi wn wv5 wc6 wn wi wi wv7 wc1 wc2 wi
+      wv7 wi wc1 wc2 wi wv1 wi wn wi wi wi wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi
+      wn wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi wi wc1 wc2 wi wv1 wv7
+      wc1 wc2 wi ax-g0 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi wv7 ax-1 ax-mp
+      wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi wi wv9 wv4 wi wn wv5 wc6 wn
+      wi wi ax-1 ax-mp wv9 wv4 wi wn wv5 wc6 wn wi wi wv7 wc1 wc2 wi wv7 wi wc1
+      wc2 wi wv1 wi wn wi wi wi wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi wi ax-1
+      ax-mp wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi wi wv9 wv4 wi wn wv5 wc6 wn wi
+      wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi wi wi wi wc1 wc2 wi ax-1
+      ax-mp wc1 wc2 wi wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi wi wv9 wv4 wi wn wv5
+      wc6 wn wi wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi wi wi wi wi
+      wv3 ax-1 ax-mp wv3 wc1 wc2 wi wc1 wn wv8 wi wv8 wv7 wi wv6 wn wi wi wv9
+      wv4 wi wn wv5 wc6 wn wi wi wv7 wc1 wc2 wi wv7 wi wc1 wc2 wi wv1 wi wn wi
+      wi wi wi wi wi wv5 ax-1 ax-mp wv5 wv3 wc1 wc2 wi wc1 wn wv8 wi wv8 wv7 wi
+      wv6 wn wi wi wv9 wv4 wi wn wv5 wc6 wn wi wi wv7 wc1 wc2 wi wv7 wi wc1 wc2
+      wi wv1 wi wn wi wi wi wi wi wi wi wv5 ax-1 ax-mp $.
+  th316 $p |- ( ( c7 -> ( ( v6 -> c1 ) -> ( c8 -> v4 ) ) ) -> ( ( ( -. v9 -> v0 ) -> ( v6 -> v7 ) ) -> ( ( -. ( v3 -> c0 ) -> ( v8 -> c6 ) ) -> ( -. ( ( v0 -> v2 ) -> ( v6 -> v4 ) ) -> ( -. v2 -> ( ( v6 -> ( -. v2 -> ( c2 -> v5 ) ) ) -> ( ( v6 -> -. v2 ) -> ( v6 -> ( c2 -> v5 ) ) ) ) ) ) ) ) ) $=
+      ( wn wi wc0 wc6 wc2 wc7 wc1 wc8 ax-2 ax-1 ax-mp ) IJAKFGKKZCLKJHMKKZABKFD
+      KKJZBJZFUDNEKZKKFUDKFUEKKKZKZKZKZKZOFPKQDKKKZUJKUIUJUHUIUGUHUFUGFUDUERUFU
+      DSTUGUCSTUHUBSTUIUASTUJUKST $.
+  th317 $p |- ( -. ( ( v7 -> v1 ) -> ( c8 -> c0 ) ) -> ( v3 -> ( ( v9 -> ( ( v0 -> v7 ) -> -. v9 ) ) -> ( ( v5 -> v7 ) -> ( ( v5 -> v7 ) -> ( v5 -> v7 ) ) ) ) ) ) $=
+      ( wi wn wc8 wc0 ax-g6 ax-1 ax-mp ) CFAEGFHGGZDEGZOOGZGZGZGZEBGIJGGHZSGRSQ
+      RPQOPOKOOLMPOLMQNLMRCLMSTLM $.
+  th318 $p |- ( v4 -> ( ( v3 -> v9 ) -> ( ( ( ( c3 -> v7 ) -> ( v0 -> c7 ) ) -> ( ( v4 -> c1 ) -> v6 ) ) -> ( v4 -> ( ( v2 -> v3 ) -> ( ( ( c1 -> v6 ) -> ( v8 -> c4 ) ) -> -. ( ( v3 -> v6 ) -> ( v3 -> v9 ) ) ) ) ) ) ) ) $=
+      wv3 wv9 wi wc3 wv7 wi wv0 wc7 wi wi wv4 wc1 wi wv6 wi wi wv4 wv2 wv3 wi
+      wc1 wv6 wi wv8 wc4 wi wi wv3 wv6 wi wv3 wv9 wi wi wn wi wi wi wi wi wv4
+      wv3 wv9 wi wc3 wv7 wi wv0 wc7 wi wi wv4 wc1 wi wv6 wi wi wv4 wv2 wv3 wi
+      wc1 wv6 wi wv8 wc4 wi wi wv3 wv6 wi wv3 wv9 wi wi wn wi wi wi wi wi wi
+      wc3 wv7 wi wv0 wc7 wi wi wv4 wc1 wi wv6 wi wi wv4 wv2 wv3 wi wc1 wv6 wi
+      wv8 wc4 wi wi wv3 wv6 wi wv3 wv9 wi wi wn wi wi wi wi wv3 wv9 wi wc3 wv7
+      wi wv0 wc7 wi wi wv4 wc1 wi wv6 wi wi wv4 wv2 wv3 wi wc1 wv6 wi wv8 wc4
+      wi wi wv3 wv6 wi wv3 wv9 wi wi wn wi wi wi wi wi wv4 wv2 wv3 wi wc1 wv6
+      wi wv8 wc4 wi wi wv3 wv6 wi wv3 wv9 wi wi wn wi wi wi wc3 wv7 wi wv0 wc7
+      wi wi wv4 wc1 wi wv6 wi wi wv4 wv2 wv3 wi wc1 wv6 wi wv8 wc4 wi wi wv3
+      wv6 wi wv3 wv9 wi wi wn wi wi wi wi wv2 wv3 wi wc1 wv6 wi wv8 wc4 wi wi
+      wv3 wv6 wi wv3 wv9 wi wi wn wi wi wv4 wv2 wv3 wi wc1 wv6 wi wv8 wc4 wi wi
+      wv3 wv6 wi wv3 wv9 wi wi wn wi wi wi wc1 wv6 wi wv8 wc4 wi wi wv3 wv6 wi
+      wv3 wv9 wi wi wn wi wv2 wv3 wi wc1 wv6 wi wv8 wc4 wi wi wv3 wv6 wi wv3
+      wv9 wi wi wn wi wi wv3 wv6 wi wv3 wv9 wi wv8 wc4 wi wc1 wv6 wi ax-g0 wc1
+      wv6 wi wv8 wc4 wi wi wv3 wv6 wi wv3 wv9 wi wi wn wi wv2 wv3 wi ax-1 ax-mp
+      wv2 wv3 wi wc1 wv6 wi wv8 wc4 wi wi wv3 wv6 wi wv3 wv9 wi wi wn wi wi wv4
+      ax-1 ax-mp wv4 wv2 wv3 wi wc1 wv6 wi wv8 wc4 wi wi wv3 wv6 wi wv3 wv9 wi
+      wi wn wi wi wi wc3 wv7 wi wv0 wc7 wi wi wv4 wc1 wi wv6 wi wi ax-1 ax-mp
+      wc3 wv7 wi wv0 wc7 wi wi wv4 wc1 wi wv6 wi wi wv4 wv2 wv3 wi wc1 wv6 wi
+      wv8 wc4 wi wi wv3 wv6 wi wv3 wv9 wi wi wn wi wi wi wi wv3 wv9 wi ax-1
+      ax-mp wv3 wv9 wi wc3 wv7 wi wv0 wc7 wi wi wv4 wc1 wi wv6 wi wi wv4 wv2
+      wv3 wi wc1 wv6 wi wv8 wc4 wi wi wv3 wv6 wi wv3 wv9 wi wi wn wi wi wi wi
+      wi wv4 ax-1 ax-mp $.
+  th319 $p |- ( -. -. ( v4 -> c1 ) -> ( -. ( v2 -> ( v0 -> c0 ) ) -> ( ( v4 -> c0 ) -> ( ( v1 -> ( v4 -> c0 ) ) -> -. ( ( v4 -> c0 ) -> v1 ) ) ) ) ) $=
+      ( wc0 wi wn wc1 ax-g0 ax-1 ax-mp ) CAEFFGZDEFZBMFMBFGFZFZFZDHFGGZPFOPNOMB
+      MBINMJKOLJKPQJK $.
+  ${
+    $d v1 v2 $.
+    th320 $p |- ( ( v7 -> ( ( v9 -> v4 ) -> v7 ) ) -> ( v1 -> ( ( ( v0 -> ( v2 -> v4 ) ) -> v2 ) -> ( c1 -> ( ( -. v6 -> ( -. v2 -> ( v3 -> v9 ) ) ) -> ( ( -. v6 -> ( -. v2 -> ( v3 -> v9 ) ) ) -> ( ( -. -. c5 -> c1 ) -> ( ( c1 -> ( ( c1 -> v1 ) -> ( v2 -> c5 ) ) ) -> ( -. ( ( c6 -> v1 ) -> ( v1 -> v1 ) ) -> -. ( ( c3 -> c8 ) -> ( c1 -> v2 ) ) ) ) ) ) ) ) ) ) ) $=
+      wv1 wv0 wv2 wv4 wi wi wv2 wi wc1 wv6 wn wv2 wn wv3 wv9 wi wi wi wv6 wn
+      wv2 wn wv3 wv9 wi wi wi wc5 wn wn wc1 wi wc1 wc1 wv1 wi wv2 wc5 wi wi wi
+      wc6 wv1 wi wv1 wv1 wi wi wn wc3 wc8 wi wc1 wv2 wi wi wn wi wi wi wi wi wi
+      wi wi wv7 wv9 wv4 wi wv7 wi wi wv1 wv0 wv2 wv4 wi wi wv2 wi wc1 wv6 wn
+      wv2 wn wv3 wv9 wi wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi wc5 wn wn wc1 wi
+      wc1 wc1 wv1 wi wv2 wc5 wi wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3 wc8 wi
+      wc1 wv2 wi wi wn wi wi wi wi wi wi wi wi wi wv0 wv2 wv4 wi wi wv2 wi wc1
+      wv6 wn wv2 wn wv3 wv9 wi wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi wc5 wn wn
+      wc1 wi wc1 wc1 wv1 wi wv2 wc5 wi wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3
+      wc8 wi wc1 wv2 wi wi wn wi wi wi wi wi wi wi wv1 wv0 wv2 wv4 wi wi wv2 wi
+      wc1 wv6 wn wv2 wn wv3 wv9 wi wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi wc5 wn
+      wn wc1 wi wc1 wc1 wv1 wi wv2 wc5 wi wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3
+      wc8 wi wc1 wv2 wi wi wn wi wi wi wi wi wi wi wi wc1 wv6 wn wv2 wn wv3 wv9
+      wi wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi wc5 wn wn wc1 wi wc1 wc1 wv1 wi
+      wv2 wc5 wi wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3 wc8 wi wc1 wv2 wi wi wn
+      wi wi wi wi wi wi wv0 wv2 wv4 wi wi wv2 wi wc1 wv6 wn wv2 wn wv3 wv9 wi
+      wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi wc5 wn wn wc1 wi wc1 wc1 wv1 wi wv2
+      wc5 wi wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3 wc8 wi wc1 wv2 wi wi wn wi
+      wi wi wi wi wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi wv6 wn wv2 wn wv3 wv9 wi
+      wi wi wc5 wn wn wc1 wi wc1 wc1 wv1 wi wv2 wc5 wi wi wi wc6 wv1 wi wv1 wv1
+      wi wi wn wc3 wc8 wi wc1 wv2 wi wi wn wi wi wi wi wi wc1 wv6 wn wv2 wn wv3
+      wv9 wi wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi wc5 wn wn wc1 wi wc1 wc1 wv1
+      wi wv2 wc5 wi wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3 wc8 wi wc1 wv2 wi wi
+      wn wi wi wi wi wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi wc5 wn wn wc1 wi wc1
+      wc1 wv1 wi wv2 wc5 wi wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3 wc8 wi wc1
+      wv2 wi wi wn wi wi wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi wv6 wn wv2 wn wv3
+      wv9 wi wi wi wc5 wn wn wc1 wi wc1 wc1 wv1 wi wv2 wc5 wi wi wi wc6 wv1 wi
+      wv1 wv1 wi wi wn wc3 wc8 wi wc1 wv2 wi wi wn wi wi wi wi wi wc5 wn wn wc1
+      wi wc1 wc1 wv1 wi wv2 wc5 wi wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3 wc8 wi
+      wc1 wv2 wi wi wn wi wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi wc5 wn wn wc1 wi
+      wc1 wc1 wv1 wi wv2 wc5 wi wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3 wc8 wi
+      wc1 wv2 wi wi wn wi wi wi wi wc1 wc5 wc1 wv1 wv2 th100 wc5 wn wn wc1 wi
+      wc1 wc1 wv1 wi wv2 wc5 wi wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3 wc8 wi
+      wc1 wv2 wi wi wn wi wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi ax-1 ax-mp wv6
+      wn wv2 wn wv3 wv9 wi wi wi wc5 wn wn wc1 wi wc1 wc1 wv1 wi wv2 wc5 wi wi
+      wi wc6 wv1 wi wv1 wv1 wi wi wn wc3 wc8 wi wc1 wv2 wi wi wn wi wi wi wi
+      wv6 wn wv2 wn wv3 wv9 wi wi wi ax-1 ax-mp wv6 wn wv2 wn wv3 wv9 wi wi wi
+      wv6 wn wv2 wn wv3 wv9 wi wi wi wc5 wn wn wc1 wi wc1 wc1 wv1 wi wv2 wc5 wi
+      wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3 wc8 wi wc1 wv2 wi wi wn wi wi wi wi
+      wi wc1 ax-1 ax-mp wc1 wv6 wn wv2 wn wv3 wv9 wi wi wi wv6 wn wv2 wn wv3
+      wv9 wi wi wi wc5 wn wn wc1 wi wc1 wc1 wv1 wi wv2 wc5 wi wi wi wc6 wv1 wi
+      wv1 wv1 wi wi wn wc3 wc8 wi wc1 wv2 wi wi wn wi wi wi wi wi wi wv0 wv2
+      wv4 wi wi wv2 wi ax-1 ax-mp wv0 wv2 wv4 wi wi wv2 wi wc1 wv6 wn wv2 wn
+      wv3 wv9 wi wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi wc5 wn wn wc1 wi wc1 wc1
+      wv1 wi wv2 wc5 wi wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3 wc8 wi wc1 wv2 wi
+      wi wn wi wi wi wi wi wi wi wv1 ax-1 ax-mp wv1 wv0 wv2 wv4 wi wi wv2 wi
+      wc1 wv6 wn wv2 wn wv3 wv9 wi wi wi wv6 wn wv2 wn wv3 wv9 wi wi wi wc5 wn
+      wn wc1 wi wc1 wc1 wv1 wi wv2 wc5 wi wi wi wc6 wv1 wi wv1 wv1 wi wi wn wc3
+      wc8 wi wc1 wv2 wi wi wn wi wi wi wi wi wi wi wi wv7 wv9 wv4 wi wv7 wi wi
+      ax-1 ax-mp $.
+  $}
+  th321 $p |- ( ( ( -. c3 -> ( v2 -> v0 ) ) -> v6 ) -> ( -. ( ( c1 -> c1 ) -> ( v6 -> v0 ) ) -> ( -. -. ( v6 -> v9 ) -> ( v8 -> ( ( ( c6 -> ( v4 -> v3 ) ) -> c2 ) -> ( c5 -> ( ( ( ( v1 -> v1 ) -> v3 ) -> v7 ) -> ( ( v1 -> v4 ) -> ( c0 -> ( ( v1 -> v4 ) -> c0 ) ) ) ) ) ) ) ) ) ) $=
+      wc1 wc1 wi wv6 wv0 wi wi wn wv6 wv9 wi wn wn wv8 wc6 wv4 wv3 wi wi wc2 wi
+      wc5 wv1 wv1 wi wv3 wi wv7 wi wv1 wv4 wi wc0 wv1 wv4 wi wc0 wi wi wi wi wi
+      wi wi wi wi wc3 wn wv2 wv0 wi wi wv6 wi wc1 wc1 wi wv6 wv0 wi wi wn wv6
+      wv9 wi wn wn wv8 wc6 wv4 wv3 wi wi wc2 wi wc5 wv1 wv1 wi wv3 wi wv7 wi
+      wv1 wv4 wi wc0 wv1 wv4 wi wc0 wi wi wi wi wi wi wi wi wi wi wv6 wv9 wi wn
+      wn wv8 wc6 wv4 wv3 wi wi wc2 wi wc5 wv1 wv1 wi wv3 wi wv7 wi wv1 wv4 wi
+      wc0 wv1 wv4 wi wc0 wi wi wi wi wi wi wi wi wc1 wc1 wi wv6 wv0 wi wi wn
+      wv6 wv9 wi wn wn wv8 wc6 wv4 wv3 wi wi wc2 wi wc5 wv1 wv1 wi wv3 wi wv7
+      wi wv1 wv4 wi wc0 wv1 wv4 wi wc0 wi wi wi wi wi wi wi wi wi wv8 wc6 wv4
+      wv3 wi wi wc2 wi wc5 wv1 wv1 wi wv3 wi wv7 wi wv1 wv4 wi wc0 wv1 wv4 wi
+      wc0 wi wi wi wi wi wi wi wv6 wv9 wi wn wn wv8 wc6 wv4 wv3 wi wi wc2 wi
+      wc5 wv1 wv1 wi wv3 wi wv7 wi wv1 wv4 wi wc0 wv1 wv4 wi wc0 wi wi wi wi wi
+      wi wi wi wc6 wv4 wv3 wi wi wc2 wi wc5 wv1 wv1 wi wv3 wi wv7 wi wv1 wv4 wi
+      wc0 wv1 wv4 wi wc0 wi wi wi wi wi wi wv8 wc6 wv4 wv3 wi wi wc2 wi wc5 wv1
+      wv1 wi wv3 wi wv7 wi wv1 wv4 wi wc0 wv1 wv4 wi wc0 wi wi wi wi wi wi wi
+      wc5 wv1 wv1 wi wv3 wi wv7 wi wv1 wv4 wi wc0 wv1 wv4 wi wc0 wi wi wi wi wi
+      wc6 wv4 wv3 wi wi wc2 wi wc5 wv1 wv1 wi wv3 wi wv7 wi wv1 wv4 wi wc0 wv1
+      wv4 wi wc0 wi wi wi wi wi wi wv1 wv1 wi wv3 wi wv7 wi wv1 wv4 wi wc0 wv1
+      wv4 wi wc0 wi wi wi wi wc5 wv1 wv1 wi wv3 wi wv7 wi wv1 wv4 wi wc0 wv1
+      wv4 wi wc0 wi wi wi wi wi wv1 wv4 wi wc0 wv1 wv4 wi wc0 wi wi wi wv1 wv1
+      wi wv3 wi wv7 wi wv1 wv4 wi wc0 wv1 wv4 wi wc0 wi wi wi wi wc0 wv1 wv4 wi
+      wc0 wi wi wv1 wv4 wi wc0 wv1 wv4 wi wc0 wi wi wi wc0 wv1 wv4 wi ax-1 wc0
+      wv1 wv4 wi wc0 wi wi wv1 wv4 wi ax-1 ax-mp wv1 wv4 wi wc0 wv1 wv4 wi wc0
+      wi wi wi wv1 wv1 wi wv3 wi wv7 wi ax-1 ax-mp wv1 wv1 wi wv3 wi wv7 wi wv1
+      wv4 wi wc0 wv1 wv4 wi wc0 wi wi wi wi wc5 ax-1 ax-mp wc5 wv1 wv1 wi wv3
+      wi wv7 wi wv1 wv4 wi wc0 wv1 wv4 wi wc0 wi wi wi wi wi wc6 wv4 wv3 wi wi
+      wc2 wi ax-1 ax-mp wc6 wv4 wv3 wi wi wc2 wi wc5 wv1 wv1 wi wv3 wi wv7 wi
+      wv1 wv4 wi wc0 wv1 wv4 wi wc0 wi wi wi wi wi wi wv8 ax-1 ax-mp wv8 wc6
+      wv4 wv3 wi wi wc2 wi wc5 wv1 wv1 wi wv3 wi wv7 wi wv1 wv4 wi wc0 wv1 wv4
+      wi wc0 wi wi wi wi wi wi wi wv6 wv9 wi wn wn ax-1 ax-mp wv6 wv9 wi wn wn
+      wv8 wc6 wv4 wv3 wi wi wc2 wi wc5 wv1 wv1 wi wv3 wi wv7 wi wv1 wv4 wi wc0
+      wv1 wv4 wi wc0 wi wi wi wi wi wi wi wi wc1 wc1 wi wv6 wv0 wi wi wn ax-1
+      ax-mp wc1 wc1 wi wv6 wv0 wi wi wn wv6 wv9 wi wn wn wv8 wc6 wv4 wv3 wi wi
+      wc2 wi wc5 wv1 wv1 wi wv3 wi wv7 wi wv1 wv4 wi wc0 wv1 wv4 wi wc0 wi wi
+      wi wi wi wi wi wi wi wc3 wn wv2 wv0 wi wi wv6 wi ax-1 ax-mp $.
+  th322 $p |- ( ( ( ( v3 -> v5 ) -> -. v5 ) -> ( ( v3 -> v5 ) -> ( c0 -> v4 ) ) ) -> ( ( ( ( c8 -> v2 ) -> ( v1 -> v0 ) ) -> ( ( c3 -> c7 ) -> v9 ) ) -> ( ( c7 -> c3 ) -> ( v6 -> ( ( -. -. v4 -> ( v8 -> ( v3 -> v6 ) ) ) -> ( -. ( ( v2 -> c8 ) -> ( c5 -> c3 ) ) -> ( c5 -> ( -. ( ( v3 -> v8 ) -> ( c7 -> c3 ) ) -> ( v3 -> v8 ) ) ) ) ) ) ) ) ) $=
+      ( wc8 wi wc3 wc7 wn wc5 wc0 ax-g1 ax-1 ax-mp ) JCKBAKKLMKIKKZMLKZGENNHDGK
+      KKZCJKOLKKNZODHKZUAKNUDKZKZKZKZKZKZKZDFKFNKDFKPEKKKZUKKUJUKUIUJUHUIUGUHUF
+      UGUEUFUAUDUDQUEORSUFUCRSUGUBRSUHGRSUIUARSUJTRSUKULRS $.
+  th323 $p |- ( v3 -> ( ( ( ( v5 -> v4 ) -> v7 ) -> -. c7 ) -> ( ( -. ( v9 -> v2 ) -> -. -. v7 ) -> ( -. v7 -> ( v9 -> v2 ) ) ) ) ) $=
+      wv5 wv4 wi wv7 wi wc7 wn wi wv9 wv2 wi wn wv7 wn wn wi wv7 wn wv9 wv2 wi
+      wi wi wi wv3 wv5 wv4 wi wv7 wi wc7 wn wi wv9 wv2 wi wn wv7 wn wn wi wv7
+      wn wv9 wv2 wi wi wi wi wi wv9 wv2 wi wn wv7 wn wn wi wv7 wn wv9 wv2 wi wi
+      wi wv5 wv4 wi wv7 wi wc7 wn wi wv9 wv2 wi wn wv7 wn wn wi wv7 wn wv9 wv2
+      wi wi wi wi wv9 wv2 wi wv7 wn ax-3 wv9 wv2 wi wn wv7 wn wn wi wv7 wn wv9
+      wv2 wi wi wi wv5 wv4 wi wv7 wi wc7 wn wi ax-1 ax-mp wv5 wv4 wi wv7 wi wc7
+      wn wi wv9 wv2 wi wn wv7 wn wn wi wv7 wn wv9 wv2 wi wi wi wi wv3 ax-1
+      ax-mp $.
+  th324 $p |- ( ( v1 -> ( -. v4 -> v7 ) ) -> ( ( c0 -> c3 ) -> ( v1 -> c3 ) ) ) $=
+      ( wv8 wi wn wc0 wc3 ax-1 ax-g4 ax-mp ) DDDEEZABFCEEZGHEZAHEZEZEZDDIQLQEPQ
+      OPOJONIKPMIKQLIKK $.
+  th325 $p |- ( ( -. ( v4 -> v4 ) -> ( v2 -> v0 ) ) -> ( -. ( c8 -> -. c4 ) -> ( -. ( c8 -> -. c4 ) -> ( ( c5 -> ( ( c5 -> v6 ) -> -. v8 ) ) -> ( ( v8 -> v7 ) -> ( ( v8 -> v7 ) -> ( v8 -> v7 ) ) ) ) ) ) ) $=
+      ( wc8 wc4 wn wi wc5 ax-g6 ax-1 ax-mp ) GHIJIZOKKDJFIJJZFEJZQQJZJZJZJZJZCC
+      JIBAJJZUBJUAUBTUASTRSQRQLQQMNRQMNSPMNTOMNUAOMNUBUCMN $.
+  th326 $p |- ( v0 -> ( ( v6 -> ( ( v6 -> v8 ) -> ( v1 -> v3 ) ) ) -> ( c2 -> ( -. ( v0 -> ( c3 -> v1 ) ) -> ( -. ( c3 -> v1 ) -> ( v0 -> ( c3 -> v1 ) ) ) ) ) ) ) $=
+      ( wv2 wi wc2 wc3 wn ax-1 ax-g9 ax-mp ) FFFGGZADDEGBCGGGZHAIBGZGJPJAPGGGZG
+      ZGZGZFFKTNTGSTRSQRAPAPLQHKMROKMSAKMTNKMM $.
+  th327 $p |- ( ( -. v9 -> ( ( c3 -> v9 ) -> ( v4 -> v2 ) ) ) -> ( ( ( ( v4 -> v4 ) -> ( v9 -> c6 ) ) -> c5 ) -> ( ( -. ( v4 -> v9 ) -> ( ( v0 -> c7 ) -> ( c6 -> v4 ) ) ) -> ( -. ( c9 -> ( v0 -> v7 ) ) -> ( ( -. -. v9 -> ( ( v5 -> v4 ) -> ( v5 -> v4 ) ) ) -> ( ( -. v9 -> ( ( c3 -> v9 ) -> ( v4 -> v2 ) ) ) -> ( ( ( ( v4 -> v4 ) -> ( v9 -> c6 ) ) -> c5 ) -> ( ( ( ( v5 -> v3 ) -> -. v8 ) -> ( ( c6 -> c4 ) -> ( v5 -> c8 ) ) ) -> ( ( ( ( v3 -> c2 ) -> ( v5 -> v5 ) ) -> -. ( c6 -> c2 ) ) -> ( ( ( ( c6 -> v5 ) -> v3 ) -> ( c6 -> ( c2 -> c8 ) ) ) -> ( v5 -> ( -. c8 -> ( ( ( -. c2 -> ( v3 -> v8 ) ) -> c2 ) -> ( ( v5 -> c6 ) -> ( -. c8 -> ( v5 -> c6 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv4 wv9 wi wn wv0 wc7 wi wc6 wv4 wi wi wi
+      wc9 wv0 wv7 wi wi wn wv9 wn wn wv5 wv4 wi wv5 wv4 wi wi wi wv9 wn wc3 wv9
+      wi wv4 wv2 wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv5 wv3 wi wv8 wn wi
+      wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi wn wi wc6
+      wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi wi wc2 wi
+      wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi
+      wv9 wn wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv4
+      wv9 wi wn wv0 wc7 wi wc6 wv4 wi wi wi wc9 wv0 wv7 wi wi wn wv9 wn wn wv5
+      wv4 wi wv5 wv4 wi wi wi wv9 wn wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4 wi wv9
+      wc6 wi wi wc5 wi wv5 wv3 wi wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2
+      wi wv5 wv5 wi wi wc6 wc2 wi wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi
+      wv5 wc8 wn wc2 wn wv3 wv8 wi wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi
+      wi wi wi wi wi wi wi wi wi wi wi wi wi wv4 wv9 wi wn wv0 wc7 wi wc6 wv4
+      wi wi wi wc9 wv0 wv7 wi wi wn wv9 wn wn wv5 wv4 wi wv5 wv4 wi wi wi wv9
+      wn wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv5 wv3 wi
+      wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi
+      wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi
+      wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi wi wi wi wi wi wi wi
+      wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv4 wv9 wi wn wv0 wc7 wi wc6 wv4 wi
+      wi wi wc9 wv0 wv7 wi wi wn wv9 wn wn wv5 wv4 wi wv5 wv4 wi wi wi wv9 wn
+      wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv5 wv3 wi
+      wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi
+      wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi
+      wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi wi wi wi wi wi wi wi
+      wi wi wi wc9 wv0 wv7 wi wi wn wv9 wn wn wv5 wv4 wi wv5 wv4 wi wi wi wv9
+      wn wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv5 wv3 wi
+      wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi
+      wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi
+      wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi wi wi wi wi wi wi wi
+      wi wv4 wv9 wi wn wv0 wc7 wi wc6 wv4 wi wi wi wc9 wv0 wv7 wi wi wn wv9 wn
+      wn wv5 wv4 wi wv5 wv4 wi wi wi wv9 wn wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4
+      wi wv9 wc6 wi wi wc5 wi wv5 wv3 wi wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi
+      wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8
+      wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6
+      wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv9 wn wn wv5 wv4 wi wv5 wv4 wi
+      wi wi wv9 wn wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi
+      wv5 wv3 wi wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5 wv5 wi wi
+      wc6 wc2 wi wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn
+      wv3 wv8 wi wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi wi wi wi wi
+      wi wi wi wc9 wv0 wv7 wi wi wn wv9 wn wn wv5 wv4 wi wv5 wv4 wi wi wi wv9
+      wn wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv5 wv3 wi
+      wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi
+      wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi
+      wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi wi wi wi wi wi wi wi
+      wi wv9 wn wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv5
+      wv3 wi wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5 wv5 wi wi wc6
+      wc2 wi wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn wv3
+      wv8 wi wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi wi wi wi wi wi
+      wi wv9 wn wn wv5 wv4 wi wv5 wv4 wi wi wi wv9 wn wc3 wv9 wi wv4 wv2 wi wi
+      wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv5 wv3 wi wv8 wn wi wc6 wc4 wi wv5
+      wc8 wi wi wi wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi wn wi wc6 wv5 wi wv3 wi
+      wc6 wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi wi wc2 wi wv5 wc6 wi
+      wc8 wn wv5 wc6 wi wi wi wi wi wi wi wi wi wi wi wi wv4 wv4 wi wv9 wc6 wi
+      wi wc5 wi wv5 wv3 wi wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5
+      wv5 wi wi wc6 wc2 wi wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8
+      wn wc2 wn wv3 wv8 wi wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi
+      wi wi wi wi wi wv9 wn wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4 wi wv9 wc6 wi
+      wi wc5 wi wv5 wv3 wi wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5
+      wv5 wi wi wc6 wc2 wi wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8
+      wn wc2 wn wv3 wv8 wi wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi
+      wi wi wi wi wi wi wv5 wv3 wi wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi wv3
+      wc2 wi wv5 wv5 wi wi wc6 wc2 wi wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8 wi wi
+      wi wv5 wc8 wn wc2 wn wv3 wv8 wi wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6 wi wi
+      wi wi wi wi wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv5 wv3 wi wv8 wn wi
+      wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi wn wi wc6
+      wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi wi wc2 wi
+      wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi wi wi wi wi wi wv5 wv3 wv5 wc6
+      wv8 wv5 wc6 wv3 wv3 th156 wv5 wv3 wi wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi
+      wi wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi wn wi wc6 wv5 wi wv3 wi wc6 wc2
+      wc8 wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi wi wc2 wi wv5 wc6 wi wc8 wn wv5
+      wc6 wi wi wi wi wi wi wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi ax-1 ax-mp
+      wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv5 wv3 wi wv8 wn wi wc6 wc4 wi wv5 wc8
+      wi wi wi wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi wn wi wc6 wv5 wi wv3 wi wc6
+      wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi wi wc2 wi wv5 wc6 wi wc8 wn
+      wv5 wc6 wi wi wi wi wi wi wi wi wi wi wv9 wn wc3 wv9 wi wv4 wv2 wi wi wi
+      ax-1 ax-mp wv9 wn wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4 wi wv9 wc6 wi wi
+      wc5 wi wv5 wv3 wi wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5
+      wv5 wi wi wc6 wc2 wi wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8
+      wn wc2 wn wv3 wv8 wi wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi
+      wi wi wi wi wi wi wv9 wn wn wv5 wv4 wi wv5 wv4 wi wi wi ax-1 ax-mp wv9 wn
+      wn wv5 wv4 wi wv5 wv4 wi wi wi wv9 wn wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4
+      wi wv9 wc6 wi wi wc5 wi wv5 wv3 wi wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi
+      wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8
+      wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6
+      wi wi wi wi wi wi wi wi wi wi wi wi wc9 wv0 wv7 wi wi wn ax-1 ax-mp wc9
+      wv0 wv7 wi wi wn wv9 wn wn wv5 wv4 wi wv5 wv4 wi wi wi wv9 wn wc3 wv9 wi
+      wv4 wv2 wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv5 wv3 wi wv8 wn wi wc6
+      wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi wn wi wc6 wv5
+      wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi wi wc2 wi wv5
+      wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi wi wi wi wi wi wi wi wi wv4 wv9 wi
+      wn wv0 wc7 wi wc6 wv4 wi wi wi ax-1 ax-mp wv4 wv9 wi wn wv0 wc7 wi wc6
+      wv4 wi wi wi wc9 wv0 wv7 wi wi wn wv9 wn wn wv5 wv4 wi wv5 wv4 wi wi wi
+      wv9 wn wc3 wv9 wi wv4 wv2 wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv5
+      wv3 wi wv8 wn wi wc6 wc4 wi wv5 wc8 wi wi wi wv3 wc2 wi wv5 wv5 wi wi wc6
+      wc2 wi wn wi wc6 wv5 wi wv3 wi wc6 wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn wv3
+      wv8 wi wi wc2 wi wv5 wc6 wi wc8 wn wv5 wc6 wi wi wi wi wi wi wi wi wi wi
+      wi wi wi wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi ax-1 ax-mp wv4 wv4 wi wv9 wc6
+      wi wi wc5 wi wv4 wv9 wi wn wv0 wc7 wi wc6 wv4 wi wi wi wc9 wv0 wv7 wi wi
+      wn wv9 wn wn wv5 wv4 wi wv5 wv4 wi wi wi wv9 wn wc3 wv9 wi wv4 wv2 wi wi
+      wi wv4 wv4 wi wv9 wc6 wi wi wc5 wi wv5 wv3 wi wv8 wn wi wc6 wc4 wi wv5
+      wc8 wi wi wi wv3 wc2 wi wv5 wv5 wi wi wc6 wc2 wi wn wi wc6 wv5 wi wv3 wi
+      wc6 wc2 wc8 wi wi wi wv5 wc8 wn wc2 wn wv3 wv8 wi wi wc2 wi wv5 wc6 wi
+      wc8 wn wv5 wc6 wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv9 wn wc3
+      wv9 wi wv4 wv2 wi wi wi ax-1 ax-mp $.
+  th328 $p |- ( ( ( ( c0 -> c7 ) -> ( v3 -> v5 ) ) -> v1 ) -> ( v1 -> ( ( v0 -> ( ( c0 -> c0 ) -> ( v8 -> c8 ) ) ) -> ( ( v3 -> c9 ) -> ( v7 -> ( -. v5 -> ( -. v5 -> ( ( -. v5 -> ( v3 -> c9 ) ) -> -. ( ( v4 -> v8 ) -> ( v4 -> v8 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc0 wi wc8 wc9 wn wc7 ax-g0 ax-1 ax-mp ) BAHHIGJIIIZCKIZFELZSSRIDGIZTIL
+      IZIZIZIZIZIZIZHMICEIIBIZUGIUFUGUEUFUDUEUCUDUBUCUAUBTTRSNUASOPUBSOPUCFOPUD
+      ROPUEQOPUFBOPUGUHOP $.
+  th329 $p |- ( ( ( ( v9 -> c8 ) -> ( v9 -> v3 ) ) -> ( v8 -> ( v1 -> v6 ) ) ) -> ( ( ( c1 -> v5 ) -> c1 ) -> ( v1 -> ( ( -. ( v8 -> v8 ) -> ( ( c2 -> v5 ) -> ( c0 -> v6 ) ) ) -> ( ( ( ( v9 -> v5 ) -> ( c7 -> v1 ) ) -> ( ( c7 -> c4 ) -> ( c5 -> v9 ) ) ) -> ( ( v9 -> c4 ) -> ( v5 -> ( -. ( ( v9 -> c2 ) -> -. c8 ) -> v5 ) ) ) ) ) ) ) ) $=
+      wc1 wv5 wi wc1 wi wv1 wv8 wv8 wi wn wc2 wv5 wi wc0 wv6 wi wi wi wv9 wv5
+      wi wc7 wv1 wi wi wc7 wc4 wi wc5 wv9 wi wi wi wv9 wc4 wi wv5 wv9 wc2 wi
+      wc8 wn wi wn wv5 wi wi wi wi wi wi wi wv9 wc8 wi wv9 wv3 wi wi wv8 wv1
+      wv6 wi wi wi wc1 wv5 wi wc1 wi wv1 wv8 wv8 wi wn wc2 wv5 wi wc0 wv6 wi wi
+      wi wv9 wv5 wi wc7 wv1 wi wi wc7 wc4 wi wc5 wv9 wi wi wi wv9 wc4 wi wv5
+      wv9 wc2 wi wc8 wn wi wn wv5 wi wi wi wi wi wi wi wi wv9 wv9 wv6 wv8 wc5
+      wc7 wv5 wv5 wv1 wc4 th199 wc1 wv5 wi wc1 wi wv1 wv8 wv8 wi wn wc2 wv5 wi
+      wc0 wv6 wi wi wi wv9 wv5 wi wc7 wv1 wi wi wc7 wc4 wi wc5 wv9 wi wi wi wv9
+      wc4 wi wv5 wv9 wc2 wi wc8 wn wi wn wv5 wi wi wi wi wi wi wi wv9 wc8 wi
+      wv9 wv3 wi wi wv8 wv1 wv6 wi wi wi ax-1 ax-mp $.
+  th330 $p |- ( ( -. -. v6 -> v0 ) -> ( c7 -> ( v8 -> ( v4 -> ( v4 -> ( v0 -> ( v6 -> ( ( ( v7 -> ( c8 -> v5 ) ) -> ( ( v8 -> c0 ) -> ( v2 -> v2 ) ) ) -> ( ( v5 -> c2 ) -> ( ( v5 -> c2 ) -> ( v7 -> ( -. ( ( v5 -> c2 ) -> ( v5 -> c2 ) ) -> ( -. v7 -> ( ( v5 -> c2 ) -> v7 ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc7 wc8 wi wc0 wc2 wn th35 ax-1 ax-mp ) HGCCAEFIDJJGKJBBJJJDLJDLJFDLJDL
+      JJMFMDLJFJJJJJJJZJZJZJZJZJZJZEMMAJZUCJUBUCUAUBTUASTRSQRBBDGDFNQEOPRAOPSCO
+      PTCOPUAGOPUBHOPUCUDOP $.
+  th331 $p |- ( c4 -> ( c6 -> ( c9 -> v1 ) ) ) $=
+      wv5 wv5 wv5 wi wi wc4 wc6 wc9 wv1 wi wi wi wv5 wv5 ax-1 wc4 wc6 wc9 wv1
+      wi wi wi wv5 wv5 wv5 wi wi wc4 wc6 wc9 wv1 wi wi wi wi wc6 wc9 wv1 wi wi
+      wc4 wc6 wc9 wv1 wi wi wi wc9 wv1 wi wc6 wc9 wv1 wi wi wc9 wv1 wi ax-g6
+      wc9 wv1 wi wc6 ax-1 ax-mp wc6 wc9 wv1 wi wi wc4 ax-1 ax-mp wc4 wc6 wc9
+      wv1 wi wi wi wv5 wv5 wv5 wi wi ax-1 ax-mp ax-mp $.
+  th332 $p |- ( ( ( ( v5 -> c1 ) -> -. c4 ) -> ( ( v0 -> c7 ) -> ( c1 -> v2 ) ) ) -> ( v2 -> ( ( v1 -> ( ( v8 -> v8 ) -> ( c8 -> c8 ) ) ) -> ( ( v1 -> v1 ) -> -. ( v1 -> v1 ) ) ) ) ) $=
+      ( wv6 wi wc1 wc4 wn wc7 wc8 ax-1 ax-g5 ax-mp ) FFFGGZDHGIJGAKGHCGGGZCBEEG
+      LLGGGZBBGZSJZGZGZGZGZFFMUDPUDGUCUDUBUCUAUBTUASNTSMOUARMOUBCMOUCQMOUDPMOO
+      $.
+  th333 $p |- ( v2 -> ( -. -. ( v3 -> v6 ) -> ( c6 -> -. ( ( ( c6 -> v4 ) -> v2 ) -> ( ( v7 -> v4 ) -> ( v7 -> v4 ) ) ) ) ) ) $=
+      wv3 wv6 wi wn wn wc6 wc6 wv4 wi wv2 wi wv7 wv4 wi wv7 wv4 wi wi wi wn wi
+      wi wv2 wv3 wv6 wi wn wn wc6 wc6 wv4 wi wv2 wi wv7 wv4 wi wv7 wv4 wi wi wi
+      wn wi wi wi wc6 wc6 wv4 wi wv2 wi wv7 wv4 wi wv7 wv4 wi wi wi wn wi wv3
+      wv6 wi wn wn wc6 wc6 wv4 wi wv2 wi wv7 wv4 wi wv7 wv4 wi wi wi wn wi wi
+      wc6 wv4 wi wv2 wi wv7 wv4 wi wv7 wv4 wi wi wi wn wc6 wc6 wv4 wi wv2 wi
+      wv7 wv4 wi wv7 wv4 wi wi wi wn wi wc6 wv4 wi wv7 wv4 wi wv2 ax-g8 wc6 wv4
+      wi wv2 wi wv7 wv4 wi wv7 wv4 wi wi wi wn wc6 ax-1 ax-mp wc6 wc6 wv4 wi
+      wv2 wi wv7 wv4 wi wv7 wv4 wi wi wi wn wi wv3 wv6 wi wn wn ax-1 ax-mp wv3
+      wv6 wi wn wn wc6 wc6 wv4 wi wv2 wi wv7 wv4 wi wv7 wv4 wi wi wi wn wi wi
+      wv2 ax-1 ax-mp $.
+  th334 $p |- ( -. ( -. v9 -> v7 ) -> ( -. -. ( v4 -> c3 ) -> ( ( ( ( v4 -> v4 ) -> -. v7 ) -> v7 ) -> ( -. ( v7 -> c5 ) -> ( ( v9 -> ( ( c6 -> c7 ) -> ( v1 -> c1 ) ) ) -> ( -. ( v7 -> c5 ) -> ( -. -. ( v4 -> c3 ) -> ( -. ( ( v4 -> c4 ) -> -. c6 ) -> -. ( -. c6 -> ( v4 -> c4 ) ) ) ) ) ) ) ) ) ) $=
+      ( wc3 wi wn wc5 wc6 wc7 wc1 wc4 th183 ax-1 ax-mp ) BEFGGBBFCGFCFCHFGDIJFA
+      KFFFCHFGBEFGGBLFIGFGIGBLFFGFFFFFFFZDGCFGZPFBIBCDAMPQNO $.
+  wth32 $p wff v4 $=
+      wv4 $.
+  th335 $p |- ( ( ( -. v0 -> ( v5 -> v6 ) ) -> -. v0 ) -> ( ( ( -. v0 -> ( v5 -> v6 ) ) -> -. v0 ) -> ( ( c5 -> v2 ) -> ( ( c5 -> v2 ) -> ( ( c5 -> v2 ) -> ( c5 -> v2 ) ) ) ) ) ) $=
+      wv9 wv9 wv9 wi wi wv0 wn wv5 wv6 wi wi wv0 wn wi wv0 wn wv5 wv6 wi wi wv0
+      wn wi wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi wi wi wi wi wi wv9 wv9
+      ax-1 wv0 wn wv5 wv6 wi wi wv0 wn wi wv0 wn wv5 wv6 wi wi wv0 wn wi wc5
+      wv2 wi wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi wi wi wi wi wi wv9 wv9 wv9 wi wi
+      wv0 wn wv5 wv6 wi wi wv0 wn wi wv0 wn wv5 wv6 wi wi wv0 wn wi wc5 wv2 wi
+      wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi wi wi wi wi wi wi wv0 wn wv5 wv6 wi wi
+      wv0 wn wi wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi wi wi wi wi wv0 wn
+      wv5 wv6 wi wi wv0 wn wi wv0 wn wv5 wv6 wi wi wv0 wn wi wc5 wv2 wi wc5 wv2
+      wi wc5 wv2 wi wc5 wv2 wi wi wi wi wi wi wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi
+      wc5 wv2 wi wi wi wi wv0 wn wv5 wv6 wi wi wv0 wn wi wc5 wv2 wi wc5 wv2 wi
+      wc5 wv2 wi wc5 wv2 wi wi wi wi wi wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi wi wi
+      wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi wi wi wi wc5 wv2 wi wc5 wv2
+      wi ax-1 wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi wi wi wc5 wv2 wi ax-1 ax-mp wc5
+      wv2 wi wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi wi wi wi wv0 wn wv5 wv6 wi wi wv0
+      wn wi ax-1 ax-mp wv0 wn wv5 wv6 wi wi wv0 wn wi wc5 wv2 wi wc5 wv2 wi wc5
+      wv2 wi wc5 wv2 wi wi wi wi wi wv0 wn wv5 wv6 wi wi wv0 wn wi ax-1 ax-mp
+      wv0 wn wv5 wv6 wi wi wv0 wn wi wv0 wn wv5 wv6 wi wi wv0 wn wi wc5 wv2 wi
+      wc5 wv2 wi wc5 wv2 wi wc5 wv2 wi wi wi wi wi wi wv9 wv9 wv9 wi wi ax-1
+      ax-mp ax-mp $.
+  th336 $p |- ( ( ( ( v1 -> v3 ) -> -. v5 ) -> ( -. v7 -> -. v4 ) ) -> ( ( -. ( v5 -> v2 ) -> ( ( c2 -> v0 ) -> ( v3 -> v7 ) ) ) -> ( v7 -> ( -. ( ( v2 -> c7 ) -> v0 ) -> ( v3 -> ( c2 -> v7 ) ) ) ) ) ) $=
+      wv5 wv2 wi wn wc2 wv0 wi wv3 wv7 wi wi wi wv7 wv2 wc7 wi wv0 wi wn wv3
+      wc2 wv7 wi wi wi wi wi wv1 wv3 wi wv5 wn wi wv7 wn wv4 wn wi wi wv5 wv2
+      wi wn wc2 wv0 wi wv3 wv7 wi wi wi wv7 wv2 wc7 wi wv0 wi wn wv3 wc2 wv7 wi
+      wi wi wi wi wi wv7 wv2 wc7 wi wv0 wi wn wv3 wc2 wv7 wi wi wi wi wv5 wv2
+      wi wn wc2 wv0 wi wv3 wv7 wi wi wi wv7 wv2 wc7 wi wv0 wi wn wv3 wc2 wv7 wi
+      wi wi wi wi wv2 wc7 wi wv0 wi wn wv3 wc2 wv7 wi wi wi wv7 wv2 wc7 wi wv0
+      wi wn wv3 wc2 wv7 wi wi wi wi wv3 wc2 wv7 wi wi wv2 wc7 wi wv0 wi wn wv3
+      wc2 wv7 wi wi wi wc2 wv7 wi wv3 wc2 wv7 wi wi wc2 wv7 wi ax-g2 wc2 wv7 wi
+      wv3 ax-1 ax-mp wv3 wc2 wv7 wi wi wv2 wc7 wi wv0 wi wn ax-1 ax-mp wv2 wc7
+      wi wv0 wi wn wv3 wc2 wv7 wi wi wi wv7 ax-1 ax-mp wv7 wv2 wc7 wi wv0 wi wn
+      wv3 wc2 wv7 wi wi wi wi wv5 wv2 wi wn wc2 wv0 wi wv3 wv7 wi wi wi ax-1
+      ax-mp wv5 wv2 wi wn wc2 wv0 wi wv3 wv7 wi wi wi wv7 wv2 wc7 wi wv0 wi wn
+      wv3 wc2 wv7 wi wi wi wi wi wv1 wv3 wi wv5 wn wi wv7 wn wv4 wn wi wi ax-1
+      ax-mp $.
+  th337 $p |- ( ( v5 -> ( ( v1 -> v6 ) -> ( v4 -> v6 ) ) ) -> ( v5 -> ( ( ( c1 -> v3 ) -> ( v0 -> v1 ) ) -> -. ( -. v7 -> ( v9 -> v2 ) ) ) ) ) $=
+      ( wc1 wi wn ax-g0 ax-1 ax-mp ) FJDKZABKZKHLZICKZKLKZKZFBGKEGKKKZUAKTUARSQ
+      PMTFNOUAUBNO $.
+  th338 $p |- ( -. v0 -> ( ( ( ( v6 -> c1 ) -> -. c2 ) -> ( ( c9 -> v7 ) -> -. v4 ) ) -> ( -. ( ( v3 -> v6 ) -> v5 ) -> ( ( ( ( v6 -> c1 ) -> -. c2 ) -> ( ( c9 -> v7 ) -> -. v4 ) ) -> ( v8 -> v8 ) ) ) ) ) $=
+      wv6 wc1 wi wc2 wn wi wc9 wv7 wi wv4 wn wi wi wv3 wv6 wi wv5 wi wn wv6 wc1
+      wi wc2 wn wi wc9 wv7 wi wv4 wn wi wi wv8 wv8 wi wi wi wi wv0 wn wv6 wc1
+      wi wc2 wn wi wc9 wv7 wi wv4 wn wi wi wv3 wv6 wi wv5 wi wn wv6 wc1 wi wc2
+      wn wi wc9 wv7 wi wv4 wn wi wi wv8 wv8 wi wi wi wi wi wv3 wv6 wi wv5 wi wn
+      wv6 wc1 wi wc2 wn wi wc9 wv7 wi wv4 wn wi wi wv8 wv8 wi wi wi wv6 wc1 wi
+      wc2 wn wi wc9 wv7 wi wv4 wn wi wi wv3 wv6 wi wv5 wi wn wv6 wc1 wi wc2 wn
+      wi wc9 wv7 wi wv4 wn wi wi wv8 wv8 wi wi wi wi wv6 wc1 wi wc2 wn wi wc9
+      wv7 wi wv4 wn wi wi wv8 wv8 wi wi wv3 wv6 wi wv5 wi wn wv6 wc1 wi wc2 wn
+      wi wc9 wv7 wi wv4 wn wi wi wv8 wv8 wi wi wi wv8 wv8 wi wv6 wc1 wi wc2 wn
+      wi wc9 wv7 wi wv4 wn wi wi wv8 wv8 wi wi wv8 wv8 wv8 wi wv8 ax-g2 wv8 wv8
+      ax-1 ax-mp wv8 wv8 wi wv6 wc1 wi wc2 wn wi wc9 wv7 wi wv4 wn wi wi ax-1
+      ax-mp wv6 wc1 wi wc2 wn wi wc9 wv7 wi wv4 wn wi wi wv8 wv8 wi wi wv3 wv6
+      wi wv5 wi wn ax-1 ax-mp wv3 wv6 wi wv5 wi wn wv6 wc1 wi wc2 wn wi wc9 wv7
+      wi wv4 wn wi wi wv8 wv8 wi wi wi wv6 wc1 wi wc2 wn wi wc9 wv7 wi wv4 wn
+      wi wi ax-1 ax-mp wv6 wc1 wi wc2 wn wi wc9 wv7 wi wv4 wn wi wi wv3 wv6 wi
+      wv5 wi wn wv6 wc1 wi wc2 wn wi wc9 wv7 wi wv4 wn wi wi wv8 wv8 wi wi wi
+      wi wv0 wn ax-1 ax-mp $.
+  th339 $p |- ( ( c5 -> ( ( v9 -> c9 ) -> -. v4 ) ) -> ( -. c3 -> ( -. c3 -> ( ( v7 -> c5 ) -> ( ( v7 -> c5 ) -> ( -. c3 -> ( -. ( c7 -> v8 ) -> -. ( -. c3 -> -. c3 ) ) ) ) ) ) ) ) $=
+      ( wc3 wn wc5 wi wc7 wc9 ax-g7 ax-1 ax-mp ) EFZNBGHZONICHZFNNHFHZHZHZHZHZH
+      ZGDJHAFHHZUBHUAUBTUASTRSQRPNKQNLMROLMSOLMTNLMUANLMUBUCLM $.
+  th340 $p |- ( ( ( ( v9 -> v2 ) -> ( c2 -> c1 ) ) -> c0 ) -> ( ( ( ( v9 -> v2 ) -> ( c2 -> c1 ) ) -> c0 ) -> ( ( ( v9 -> ( c4 -> v7 ) ) -> ( ( v7 -> v7 ) -> ( c0 -> v3 ) ) ) -> ( ( ( ( v8 -> c5 ) -> ( c3 -> v6 ) ) -> ( ( v7 -> v7 ) -> ( c5 -> v0 ) ) ) -> ( ( v6 -> ( ( c1 -> v3 ) -> ( v4 -> v8 ) ) ) -> ( ( -. -. v9 -> ( c9 -> v6 ) ) -> ( ( ( v0 -> -. v7 ) -> ( ( v4 -> v6 ) -> ( c7 -> v3 ) ) ) -> ( -. ( ( v4 -> v3 ) -> v4 ) -> ( v8 -> v5 ) ) ) ) ) ) ) ) ) $=
+      wv9 wv2 wi wc2 wc1 wi wi wc0 wi wv9 wc4 wv7 wi wi wv7 wv7 wi wc0 wv3 wi
+      wi wi wv8 wc5 wi wc3 wv6 wi wi wv7 wv7 wi wc5 wv0 wi wi wi wv6 wc1 wv3 wi
+      wv4 wv8 wi wi wi wv9 wn wn wc9 wv6 wi wi wv0 wv7 wn wi wv4 wv6 wi wc7 wv3
+      wi wi wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi wi wi wi wi wi wi wi wv9 wv2 wi
+      wc2 wc1 wi wi wc0 wi wv9 wv2 wi wc2 wc1 wi wi wc0 wi wv9 wc4 wv7 wi wi
+      wv7 wv7 wi wc0 wv3 wi wi wi wv8 wc5 wi wc3 wv6 wi wi wv7 wv7 wi wc5 wv0
+      wi wi wi wv6 wc1 wv3 wi wv4 wv8 wi wi wi wv9 wn wn wc9 wv6 wi wi wv0 wv7
+      wn wi wv4 wv6 wi wc7 wv3 wi wi wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi wi wi
+      wi wi wi wi wi wi wv9 wc4 wv7 wi wi wv7 wv7 wi wc0 wv3 wi wi wi wv8 wc5
+      wi wc3 wv6 wi wi wv7 wv7 wi wc5 wv0 wi wi wi wv6 wc1 wv3 wi wv4 wv8 wi wi
+      wi wv9 wn wn wc9 wv6 wi wi wv0 wv7 wn wi wv4 wv6 wi wc7 wv3 wi wi wi wv4
+      wv3 wi wv4 wi wn wv8 wv5 wi wi wi wi wi wi wi wv9 wv2 wi wc2 wc1 wi wi
+      wc0 wi wv9 wc4 wv7 wi wi wv7 wv7 wi wc0 wv3 wi wi wi wv8 wc5 wi wc3 wv6
+      wi wi wv7 wv7 wi wc5 wv0 wi wi wi wv6 wc1 wv3 wi wv4 wv8 wi wi wi wv9 wn
+      wn wc9 wv6 wi wi wv0 wv7 wn wi wv4 wv6 wi wc7 wv3 wi wi wi wv4 wv3 wi wv4
+      wi wn wv8 wv5 wi wi wi wi wi wi wi wi wv8 wc5 wi wc3 wv6 wi wi wv7 wv7 wi
+      wc5 wv0 wi wi wi wv6 wc1 wv3 wi wv4 wv8 wi wi wi wv9 wn wn wc9 wv6 wi wi
+      wv0 wv7 wn wi wv4 wv6 wi wc7 wv3 wi wi wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi
+      wi wi wi wi wi wv9 wc4 wv7 wi wi wv7 wv7 wi wc0 wv3 wi wi wi wv8 wc5 wi
+      wc3 wv6 wi wi wv7 wv7 wi wc5 wv0 wi wi wi wv6 wc1 wv3 wi wv4 wv8 wi wi wi
+      wv9 wn wn wc9 wv6 wi wi wv0 wv7 wn wi wv4 wv6 wi wc7 wv3 wi wi wi wv4 wv3
+      wi wv4 wi wn wv8 wv5 wi wi wi wi wi wi wi wv6 wc1 wv3 wi wv4 wv8 wi wi wi
+      wv9 wn wn wc9 wv6 wi wi wv0 wv7 wn wi wv4 wv6 wi wc7 wv3 wi wi wi wv4 wv3
+      wi wv4 wi wn wv8 wv5 wi wi wi wi wi wv8 wc5 wi wc3 wv6 wi wi wv7 wv7 wi
+      wc5 wv0 wi wi wi wv6 wc1 wv3 wi wv4 wv8 wi wi wi wv9 wn wn wc9 wv6 wi wi
+      wv0 wv7 wn wi wv4 wv6 wi wc7 wv3 wi wi wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi
+      wi wi wi wi wi wv9 wn wn wc9 wv6 wi wi wv0 wv7 wn wi wv4 wv6 wi wc7 wv3
+      wi wi wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi wi wi wi wv6 wc1 wv3 wi wv4 wv8
+      wi wi wi wv9 wn wn wc9 wv6 wi wi wv0 wv7 wn wi wv4 wv6 wi wc7 wv3 wi wi
+      wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi wi wi wi wi wv0 wv7 wn wi wv4 wv6 wi
+      wc7 wv3 wi wi wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi wi wi wv9 wn wn wc9 wv6
+      wi wi wv0 wv7 wn wi wv4 wv6 wi wc7 wv3 wi wi wi wv4 wv3 wi wv4 wi wn wv8
+      wv5 wi wi wi wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi wi wv0 wv7 wn wi wv4 wv6
+      wi wc7 wv3 wi wi wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi wi wi wv8 wv5 wi wv4
+      wv3 wi wv4 wi wn wv8 wv5 wi wi wv8 wv5 wi ax-g2 wv8 wv5 wi wv4 wv3 wi wv4
+      wi wn ax-1 ax-mp wv4 wv3 wi wv4 wi wn wv8 wv5 wi wi wv0 wv7 wn wi wv4 wv6
+      wi wc7 wv3 wi wi wi ax-1 ax-mp wv0 wv7 wn wi wv4 wv6 wi wc7 wv3 wi wi wi
+      wv4 wv3 wi wv4 wi wn wv8 wv5 wi wi wi wv9 wn wn wc9 wv6 wi wi ax-1 ax-mp
+      wv9 wn wn wc9 wv6 wi wi wv0 wv7 wn wi wv4 wv6 wi wc7 wv3 wi wi wi wv4 wv3
+      wi wv4 wi wn wv8 wv5 wi wi wi wi wv6 wc1 wv3 wi wv4 wv8 wi wi wi ax-1
+      ax-mp wv6 wc1 wv3 wi wv4 wv8 wi wi wi wv9 wn wn wc9 wv6 wi wi wv0 wv7 wn
+      wi wv4 wv6 wi wc7 wv3 wi wi wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi wi wi wi
+      wi wv8 wc5 wi wc3 wv6 wi wi wv7 wv7 wi wc5 wv0 wi wi wi ax-1 ax-mp wv8
+      wc5 wi wc3 wv6 wi wi wv7 wv7 wi wc5 wv0 wi wi wi wv6 wc1 wv3 wi wv4 wv8
+      wi wi wi wv9 wn wn wc9 wv6 wi wi wv0 wv7 wn wi wv4 wv6 wi wc7 wv3 wi wi
+      wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi wi wi wi wi wi wv9 wc4 wv7 wi wi wv7
+      wv7 wi wc0 wv3 wi wi wi ax-1 ax-mp wv9 wc4 wv7 wi wi wv7 wv7 wi wc0 wv3
+      wi wi wi wv8 wc5 wi wc3 wv6 wi wi wv7 wv7 wi wc5 wv0 wi wi wi wv6 wc1 wv3
+      wi wv4 wv8 wi wi wi wv9 wn wn wc9 wv6 wi wi wv0 wv7 wn wi wv4 wv6 wi wc7
+      wv3 wi wi wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi wi wi wi wi wi wi wv9 wv2 wi
+      wc2 wc1 wi wi wc0 wi ax-1 ax-mp wv9 wv2 wi wc2 wc1 wi wi wc0 wi wv9 wc4
+      wv7 wi wi wv7 wv7 wi wc0 wv3 wi wi wi wv8 wc5 wi wc3 wv6 wi wi wv7 wv7 wi
+      wc5 wv0 wi wi wi wv6 wc1 wv3 wi wv4 wv8 wi wi wi wv9 wn wn wc9 wv6 wi wi
+      wv0 wv7 wn wi wv4 wv6 wi wc7 wv3 wi wi wi wv4 wv3 wi wv4 wi wn wv8 wv5 wi
+      wi wi wi wi wi wi wi wv9 wv2 wi wc2 wc1 wi wi wc0 wi ax-1 ax-mp $.
+  wth33 $p wff ( c6 -> v4 ) $=
+      wc6 wv4 wi $.
+  th341 $p |- ( v6 -> ( ( -. ( v1 -> c5 ) -> ( v3 -> c4 ) ) -> ( ( ( v2 -> ( v3 -> v2 ) ) -> ( ( v1 -> v7 ) -> -. v9 ) ) -> ( ( ( ( v4 -> v9 ) -> ( v0 -> v7 ) ) -> ( ( v9 -> v1 ) -> ( v3 -> v8 ) ) ) -> ( -. c5 -> ( ( -. c2 -> -. -. c5 ) -> ( -. c5 -> c2 ) ) ) ) ) ) ) $=
+      wv1 wc5 wi wn wv3 wc4 wi wi wv2 wv3 wv2 wi wi wv1 wv7 wi wv9 wn wi wi wv4
+      wv9 wi wv0 wv7 wi wi wv9 wv1 wi wv3 wv8 wi wi wi wc5 wn wc2 wn wc5 wn wn
+      wi wc5 wn wc2 wi wi wi wi wi wi wv6 wv1 wc5 wi wn wv3 wc4 wi wi wv2 wv3
+      wv2 wi wi wv1 wv7 wi wv9 wn wi wi wv4 wv9 wi wv0 wv7 wi wi wv9 wv1 wi wv3
+      wv8 wi wi wi wc5 wn wc2 wn wc5 wn wn wi wc5 wn wc2 wi wi wi wi wi wi wi
+      wv2 wv3 wv2 wi wi wv1 wv7 wi wv9 wn wi wi wv4 wv9 wi wv0 wv7 wi wi wv9
+      wv1 wi wv3 wv8 wi wi wi wc5 wn wc2 wn wc5 wn wn wi wc5 wn wc2 wi wi wi wi
+      wi wv1 wc5 wi wn wv3 wc4 wi wi wv2 wv3 wv2 wi wi wv1 wv7 wi wv9 wn wi wi
+      wv4 wv9 wi wv0 wv7 wi wi wv9 wv1 wi wv3 wv8 wi wi wi wc5 wn wc2 wn wc5 wn
+      wn wi wc5 wn wc2 wi wi wi wi wi wi wv4 wv9 wi wv0 wv7 wi wi wv9 wv1 wi
+      wv3 wv8 wi wi wi wc5 wn wc2 wn wc5 wn wn wi wc5 wn wc2 wi wi wi wi wv2
+      wv3 wv2 wi wi wv1 wv7 wi wv9 wn wi wi wv4 wv9 wi wv0 wv7 wi wi wv9 wv1 wi
+      wv3 wv8 wi wi wi wc5 wn wc2 wn wc5 wn wn wi wc5 wn wc2 wi wi wi wi wi wc5
+      wn wc2 wn wc5 wn wn wi wc5 wn wc2 wi wi wi wv4 wv9 wi wv0 wv7 wi wi wv9
+      wv1 wi wv3 wv8 wi wi wi wc5 wn wc2 wn wc5 wn wn wi wc5 wn wc2 wi wi wi wi
+      wc2 wn wc5 wn wn wi wc5 wn wc2 wi wi wc5 wn wc2 wn wc5 wn wn wi wc5 wn
+      wc2 wi wi wi wc2 wc5 wn ax-3 wc2 wn wc5 wn wn wi wc5 wn wc2 wi wi wc5 wn
+      ax-1 ax-mp wc5 wn wc2 wn wc5 wn wn wi wc5 wn wc2 wi wi wi wv4 wv9 wi wv0
+      wv7 wi wi wv9 wv1 wi wv3 wv8 wi wi wi ax-1 ax-mp wv4 wv9 wi wv0 wv7 wi wi
+      wv9 wv1 wi wv3 wv8 wi wi wi wc5 wn wc2 wn wc5 wn wn wi wc5 wn wc2 wi wi
+      wi wi wv2 wv3 wv2 wi wi wv1 wv7 wi wv9 wn wi wi ax-1 ax-mp wv2 wv3 wv2 wi
+      wi wv1 wv7 wi wv9 wn wi wi wv4 wv9 wi wv0 wv7 wi wi wv9 wv1 wi wv3 wv8 wi
+      wi wi wc5 wn wc2 wn wc5 wn wn wi wc5 wn wc2 wi wi wi wi wi wv1 wc5 wi wn
+      wv3 wc4 wi wi ax-1 ax-mp wv1 wc5 wi wn wv3 wc4 wi wi wv2 wv3 wv2 wi wi
+      wv1 wv7 wi wv9 wn wi wi wv4 wv9 wi wv0 wv7 wi wi wv9 wv1 wi wv3 wv8 wi wi
+      wi wc5 wn wc2 wn wc5 wn wn wi wc5 wn wc2 wi wi wi wi wi wi wv6 ax-1 ax-mp
+      $.
+  th342 $p |- ( ( ( v9 -> c4 ) -> ( ( v3 -> v3 ) -> ( v0 -> v3 ) ) ) -> ( v1 -> ( ( v0 -> ( c7 -> c0 ) ) -> ( ( ( v2 -> ( v4 -> v2 ) ) -> -. ( v0 -> c9 ) ) -> ( ( ( ( v7 -> c0 ) -> ( v8 -> c0 ) ) -> v9 ) -> ( -. c1 -> ( -. c8 -> ( c8 -> ( ( ( -. v1 -> ( c2 -> c3 ) ) -> ( -. c8 -> ( v8 -> c3 ) ) ) -> ( ( ( ( c3 -> v1 ) -> ( v1 -> v1 ) ) -> ( v2 -> ( c8 -> v2 ) ) ) -> -. -. c8 ) ) ) ) ) ) ) ) ) ) $=
+      wv1 wv0 wc7 wc0 wi wi wv2 wv4 wv2 wi wi wv0 wc9 wi wn wi wv7 wc0 wi wv8
+      wc0 wi wi wv9 wi wc1 wn wc8 wn wc8 wv1 wn wc2 wc3 wi wi wc8 wn wv8 wc3 wi
+      wi wi wc3 wv1 wi wv1 wv1 wi wi wv2 wc8 wv2 wi wi wi wc8 wn wn wi wi wi wi
+      wi wi wi wi wi wv9 wc4 wi wv3 wv3 wi wv0 wv3 wi wi wi wv1 wv0 wc7 wc0 wi
+      wi wv2 wv4 wv2 wi wi wv0 wc9 wi wn wi wv7 wc0 wi wv8 wc0 wi wi wv9 wi wc1
+      wn wc8 wn wc8 wv1 wn wc2 wc3 wi wi wc8 wn wv8 wc3 wi wi wi wc3 wv1 wi wv1
+      wv1 wi wi wv2 wc8 wv2 wi wi wi wc8 wn wn wi wi wi wi wi wi wi wi wi wi
+      wv0 wc7 wc0 wi wi wv2 wv4 wv2 wi wi wv0 wc9 wi wn wi wv7 wc0 wi wv8 wc0
+      wi wi wv9 wi wc1 wn wc8 wn wc8 wv1 wn wc2 wc3 wi wi wc8 wn wv8 wc3 wi wi
+      wi wc3 wv1 wi wv1 wv1 wi wi wv2 wc8 wv2 wi wi wi wc8 wn wn wi wi wi wi wi
+      wi wi wi wv1 wv0 wc7 wc0 wi wi wv2 wv4 wv2 wi wi wv0 wc9 wi wn wi wv7 wc0
+      wi wv8 wc0 wi wi wv9 wi wc1 wn wc8 wn wc8 wv1 wn wc2 wc3 wi wi wc8 wn wv8
+      wc3 wi wi wi wc3 wv1 wi wv1 wv1 wi wi wv2 wc8 wv2 wi wi wi wc8 wn wn wi
+      wi wi wi wi wi wi wi wi wv2 wv4 wv2 wi wi wv0 wc9 wi wn wi wv7 wc0 wi wv8
+      wc0 wi wi wv9 wi wc1 wn wc8 wn wc8 wv1 wn wc2 wc3 wi wi wc8 wn wv8 wc3 wi
+      wi wi wc3 wv1 wi wv1 wv1 wi wi wv2 wc8 wv2 wi wi wi wc8 wn wn wi wi wi wi
+      wi wi wi wv0 wc7 wc0 wi wi wv2 wv4 wv2 wi wi wv0 wc9 wi wn wi wv7 wc0 wi
+      wv8 wc0 wi wi wv9 wi wc1 wn wc8 wn wc8 wv1 wn wc2 wc3 wi wi wc8 wn wv8
+      wc3 wi wi wi wc3 wv1 wi wv1 wv1 wi wi wv2 wc8 wv2 wi wi wi wc8 wn wn wi
+      wi wi wi wi wi wi wi wv7 wc0 wi wv8 wc0 wi wi wv9 wi wc1 wn wc8 wn wc8
+      wv1 wn wc2 wc3 wi wi wc8 wn wv8 wc3 wi wi wi wc3 wv1 wi wv1 wv1 wi wi wv2
+      wc8 wv2 wi wi wi wc8 wn wn wi wi wi wi wi wi wv2 wv4 wv2 wi wi wv0 wc9 wi
+      wn wi wv7 wc0 wi wv8 wc0 wi wi wv9 wi wc1 wn wc8 wn wc8 wv1 wn wc2 wc3 wi
+      wi wc8 wn wv8 wc3 wi wi wi wc3 wv1 wi wv1 wv1 wi wi wv2 wc8 wv2 wi wi wi
+      wc8 wn wn wi wi wi wi wi wi wi wc1 wn wc8 wn wc8 wv1 wn wc2 wc3 wi wi wc8
+      wn wv8 wc3 wi wi wi wc3 wv1 wi wv1 wv1 wi wi wv2 wc8 wv2 wi wi wi wc8 wn
+      wn wi wi wi wi wi wv7 wc0 wi wv8 wc0 wi wi wv9 wi wc1 wn wc8 wn wc8 wv1
+      wn wc2 wc3 wi wi wc8 wn wv8 wc3 wi wi wi wc3 wv1 wi wv1 wv1 wi wi wv2 wc8
+      wv2 wi wi wi wc8 wn wn wi wi wi wi wi wi wv1 wv2 wc3 wv1 wc8 wv8 wc2 th96
+      wc1 wn wc8 wn wc8 wv1 wn wc2 wc3 wi wi wc8 wn wv8 wc3 wi wi wi wc3 wv1 wi
+      wv1 wv1 wi wi wv2 wc8 wv2 wi wi wi wc8 wn wn wi wi wi wi wi wv7 wc0 wi
+      wv8 wc0 wi wi wv9 wi ax-1 ax-mp wv7 wc0 wi wv8 wc0 wi wi wv9 wi wc1 wn
+      wc8 wn wc8 wv1 wn wc2 wc3 wi wi wc8 wn wv8 wc3 wi wi wi wc3 wv1 wi wv1
+      wv1 wi wi wv2 wc8 wv2 wi wi wi wc8 wn wn wi wi wi wi wi wi wv2 wv4 wv2 wi
+      wi wv0 wc9 wi wn wi ax-1 ax-mp wv2 wv4 wv2 wi wi wv0 wc9 wi wn wi wv7 wc0
+      wi wv8 wc0 wi wi wv9 wi wc1 wn wc8 wn wc8 wv1 wn wc2 wc3 wi wi wc8 wn wv8
+      wc3 wi wi wi wc3 wv1 wi wv1 wv1 wi wi wv2 wc8 wv2 wi wi wi wc8 wn wn wi
+      wi wi wi wi wi wi wv0 wc7 wc0 wi wi ax-1 ax-mp wv0 wc7 wc0 wi wi wv2 wv4
+      wv2 wi wi wv0 wc9 wi wn wi wv7 wc0 wi wv8 wc0 wi wi wv9 wi wc1 wn wc8 wn
+      wc8 wv1 wn wc2 wc3 wi wi wc8 wn wv8 wc3 wi wi wi wc3 wv1 wi wv1 wv1 wi wi
+      wv2 wc8 wv2 wi wi wi wc8 wn wn wi wi wi wi wi wi wi wi wv1 ax-1 ax-mp wv1
+      wv0 wc7 wc0 wi wi wv2 wv4 wv2 wi wi wv0 wc9 wi wn wi wv7 wc0 wi wv8 wc0
+      wi wi wv9 wi wc1 wn wc8 wn wc8 wv1 wn wc2 wc3 wi wi wc8 wn wv8 wc3 wi wi
+      wi wc3 wv1 wi wv1 wv1 wi wi wv2 wc8 wv2 wi wi wi wc8 wn wn wi wi wi wi wi
+      wi wi wi wi wv9 wc4 wi wv3 wv3 wi wv0 wv3 wi wi wi ax-1 ax-mp $.
+  wth34 $p wff ( v4 -> ( -. ( v2 -> v9 ) -> ( ( v1 -> v7 ) -> ( v1 -> v9 ) ) ) ) $=
+      wv4 wv2 wv9 wi wn wv1 wv7 wi wv1 wv9 wi wi wi wi $.
+  th343 $p |- ( -. ( ( v2 -> c4 ) -> ( c9 -> c9 ) ) -> ( c2 -> ( ( ( -. v5 -> -. v1 ) -> ( ( c1 -> v1 ) -> ( c9 -> c7 ) ) ) -> ( ( -. ( v4 -> c9 ) -> -. ( v8 -> c5 ) ) -> ( ( ( v0 -> -. c4 ) -> ( ( v9 -> c8 ) -> ( v2 -> v7 ) ) ) -> ( c9 -> ( -. -. -. v3 -> ( -. ( ( v2 -> c4 ) -> ( c9 -> c9 ) ) -> ( -. ( ( v1 -> v1 ) -> c0 ) -> v4 ) ) ) ) ) ) ) ) ) $=
+      ( wv6 wi wc4 wc9 wn wc2 wc1 wc7 wc5 wc8 wc0 ax-1 ax-g1 ax-mp ) JJJKKZCLKM
+      MKKNZOFNBNKPBKMQKKKZEMKNHRKNKZALNKISKCGKKKZMDNNNZUEBBKZTKNEKZKZKZKZKZKZKZ
+      KZKZJJUAUSUDUSKURUSUQURUPUQUOUPUNUOUMUNULUMUKULTEUJUBUKUEUAUCULUIUAUCUMMU
+      AUCUNUHUAUCUOUGUAUCUPUFUAUCUQOUAUCURUEUAUCUSUDUAUCUC $.
+  wth35 $p wff ( v4 -> ( ( v9 -> -. v4 ) -> ( ( v9 -> v7 ) -> ( v1 -> v0 ) ) ) ) $=
+      ( wn wi ) CECFGEDGBAGGGG $.
+  th344 $p |- ( -. v2 -> ( v8 -> ( ( ( -. v3 -> ( v0 -> c3 ) ) -> ( ( v7 -> v2 ) -> ( c7 -> v2 ) ) ) -> ( ( ( ( v0 -> v4 ) -> v1 ) -> ( ( v1 -> v4 ) -> ( c2 -> v8 ) ) ) -> ( ( v8 -> ( ( v3 -> v1 ) -> ( c0 -> v3 ) ) ) -> ( ( ( -. v8 -> -. c0 ) -> ( ( v8 -> c1 ) -> ( c4 -> c8 ) ) ) -> ( ( ( c5 -> v4 ) -> ( ( v3 -> v4 ) -> v8 ) ) -> ( ( v8 -> v3 ) -> ( ( ( -. v2 -> c9 ) -> ( v8 -> ( c1 -> v8 ) ) ) -> -. ( v8 -> v3 ) ) ) ) ) ) ) ) ) ) $=
+      wv8 wv3 wn wv0 wc3 wi wi wv7 wv2 wi wc7 wv2 wi wi wi wv0 wv4 wi wv1 wi
+      wv1 wv4 wi wc2 wv8 wi wi wi wv8 wv3 wv1 wi wc0 wv3 wi wi wi wv8 wn wc0 wn
+      wi wv8 wc1 wi wc4 wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi wv8 wv3 wi
+      wv2 wn wc9 wi wv8 wc1 wv8 wi wi wi wv8 wv3 wi wn wi wi wi wi wi wi wi wi
+      wv2 wn wv8 wv3 wn wv0 wc3 wi wi wv7 wv2 wi wc7 wv2 wi wi wi wv0 wv4 wi
+      wv1 wi wv1 wv4 wi wc2 wv8 wi wi wi wv8 wv3 wv1 wi wc0 wv3 wi wi wi wv8 wn
+      wc0 wn wi wv8 wc1 wi wc4 wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi wv8
+      wv3 wi wv2 wn wc9 wi wv8 wc1 wv8 wi wi wi wv8 wv3 wi wn wi wi wi wi wi wi
+      wi wi wi wv3 wn wv0 wc3 wi wi wv7 wv2 wi wc7 wv2 wi wi wi wv0 wv4 wi wv1
+      wi wv1 wv4 wi wc2 wv8 wi wi wi wv8 wv3 wv1 wi wc0 wv3 wi wi wi wv8 wn wc0
+      wn wi wv8 wc1 wi wc4 wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi wv8 wv3
+      wi wv2 wn wc9 wi wv8 wc1 wv8 wi wi wi wv8 wv3 wi wn wi wi wi wi wi wi wi
+      wv8 wv3 wn wv0 wc3 wi wi wv7 wv2 wi wc7 wv2 wi wi wi wv0 wv4 wi wv1 wi
+      wv1 wv4 wi wc2 wv8 wi wi wi wv8 wv3 wv1 wi wc0 wv3 wi wi wi wv8 wn wc0 wn
+      wi wv8 wc1 wi wc4 wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi wv8 wv3 wi
+      wv2 wn wc9 wi wv8 wc1 wv8 wi wi wi wv8 wv3 wi wn wi wi wi wi wi wi wi wi
+      wv0 wv4 wi wv1 wi wv1 wv4 wi wc2 wv8 wi wi wi wv8 wv3 wv1 wi wc0 wv3 wi
+      wi wi wv8 wn wc0 wn wi wv8 wc1 wi wc4 wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi
+      wv8 wi wi wv8 wv3 wi wv2 wn wc9 wi wv8 wc1 wv8 wi wi wi wv8 wv3 wi wn wi
+      wi wi wi wi wi wv3 wn wv0 wc3 wi wi wv7 wv2 wi wc7 wv2 wi wi wi wv0 wv4
+      wi wv1 wi wv1 wv4 wi wc2 wv8 wi wi wi wv8 wv3 wv1 wi wc0 wv3 wi wi wi wv8
+      wn wc0 wn wi wv8 wc1 wi wc4 wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi
+      wv8 wv3 wi wv2 wn wc9 wi wv8 wc1 wv8 wi wi wi wv8 wv3 wi wn wi wi wi wi
+      wi wi wi wv8 wv3 wv1 wi wc0 wv3 wi wi wi wv8 wn wc0 wn wi wv8 wc1 wi wc4
+      wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi wv8 wv3 wi wv2 wn wc9 wi wv8
+      wc1 wv8 wi wi wi wv8 wv3 wi wn wi wi wi wi wi wv0 wv4 wi wv1 wi wv1 wv4
+      wi wc2 wv8 wi wi wi wv8 wv3 wv1 wi wc0 wv3 wi wi wi wv8 wn wc0 wn wi wv8
+      wc1 wi wc4 wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi wv8 wv3 wi wv2 wn
+      wc9 wi wv8 wc1 wv8 wi wi wi wv8 wv3 wi wn wi wi wi wi wi wi wv8 wn wc0 wn
+      wi wv8 wc1 wi wc4 wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi wv8 wv3 wi
+      wv2 wn wc9 wi wv8 wc1 wv8 wi wi wi wv8 wv3 wi wn wi wi wi wi wv8 wv3 wv1
+      wi wc0 wv3 wi wi wi wv8 wn wc0 wn wi wv8 wc1 wi wc4 wc8 wi wi wi wc5 wv4
+      wi wv3 wv4 wi wv8 wi wi wv8 wv3 wi wv2 wn wc9 wi wv8 wc1 wv8 wi wi wi wv8
+      wv3 wi wn wi wi wi wi wi wv8 wc1 wv3 wv2 wc5 wv8 wv4 th32 wv8 wn wc0 wn
+      wi wv8 wc1 wi wc4 wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi wv8 wv3 wi
+      wv2 wn wc9 wi wv8 wc1 wv8 wi wi wi wv8 wv3 wi wn wi wi wi wi wv8 wv3 wv1
+      wi wc0 wv3 wi wi wi ax-1 ax-mp wv8 wv3 wv1 wi wc0 wv3 wi wi wi wv8 wn wc0
+      wn wi wv8 wc1 wi wc4 wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi wv8 wv3
+      wi wv2 wn wc9 wi wv8 wc1 wv8 wi wi wi wv8 wv3 wi wn wi wi wi wi wi wv0
+      wv4 wi wv1 wi wv1 wv4 wi wc2 wv8 wi wi wi ax-1 ax-mp wv0 wv4 wi wv1 wi
+      wv1 wv4 wi wc2 wv8 wi wi wi wv8 wv3 wv1 wi wc0 wv3 wi wi wi wv8 wn wc0 wn
+      wi wv8 wc1 wi wc4 wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi wv8 wv3 wi
+      wv2 wn wc9 wi wv8 wc1 wv8 wi wi wi wv8 wv3 wi wn wi wi wi wi wi wi wv3 wn
+      wv0 wc3 wi wi wv7 wv2 wi wc7 wv2 wi wi wi ax-1 ax-mp wv3 wn wv0 wc3 wi wi
+      wv7 wv2 wi wc7 wv2 wi wi wi wv0 wv4 wi wv1 wi wv1 wv4 wi wc2 wv8 wi wi wi
+      wv8 wv3 wv1 wi wc0 wv3 wi wi wi wv8 wn wc0 wn wi wv8 wc1 wi wc4 wc8 wi wi
+      wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi wv8 wv3 wi wv2 wn wc9 wi wv8 wc1 wv8
+      wi wi wi wv8 wv3 wi wn wi wi wi wi wi wi wi wv8 ax-1 ax-mp wv8 wv3 wn wv0
+      wc3 wi wi wv7 wv2 wi wc7 wv2 wi wi wi wv0 wv4 wi wv1 wi wv1 wv4 wi wc2
+      wv8 wi wi wi wv8 wv3 wv1 wi wc0 wv3 wi wi wi wv8 wn wc0 wn wi wv8 wc1 wi
+      wc4 wc8 wi wi wi wc5 wv4 wi wv3 wv4 wi wv8 wi wi wv8 wv3 wi wv2 wn wc9 wi
+      wv8 wc1 wv8 wi wi wi wv8 wv3 wi wn wi wi wi wi wi wi wi wi wv2 wn ax-1
+      ax-mp $.
+  ${
+    $d v3 v8 $.
+    th345 $p |- ( c8 -> ( ( ( -. v4 -> ( c8 -> v9 ) ) -> ( ( v3 -> v2 ) -> v6 ) ) -> ( -. ( ( v2 -> v8 ) -> ( v1 -> v1 ) ) -> ( -. ( ( v2 -> v8 ) -> ( v1 -> v1 ) ) -> ( v8 -> ( -. ( v8 -> ( v3 -> c9 ) ) -> ( v3 -> c9 ) ) ) ) ) ) ) $=
+      wv0 wv0 wv0 wi wi wc8 wv4 wn wc8 wv9 wi wi wv3 wv2 wi wv6 wi wi wv2 wv8
+      wi wv1 wv1 wi wi wn wv2 wv8 wi wv1 wv1 wi wi wn wv8 wv8 wv3 wc9 wi wi wn
+      wv3 wc9 wi wi wi wi wi wi wi wv0 wv0 ax-1 wc8 wv4 wn wc8 wv9 wi wi wv3
+      wv2 wi wv6 wi wi wv2 wv8 wi wv1 wv1 wi wi wn wv2 wv8 wi wv1 wv1 wi wi wn
+      wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi wi wi wi wi wi wv0 wv0 wv0 wi wi
+      wc8 wv4 wn wc8 wv9 wi wi wv3 wv2 wi wv6 wi wi wv2 wv8 wi wv1 wv1 wi wi wn
+      wv2 wv8 wi wv1 wv1 wi wi wn wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi wi wi
+      wi wi wi wi wv4 wn wc8 wv9 wi wi wv3 wv2 wi wv6 wi wi wv2 wv8 wi wv1 wv1
+      wi wi wn wv2 wv8 wi wv1 wv1 wi wi wn wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi
+      wi wi wi wi wi wc8 wv4 wn wc8 wv9 wi wi wv3 wv2 wi wv6 wi wi wv2 wv8 wi
+      wv1 wv1 wi wi wn wv2 wv8 wi wv1 wv1 wi wi wn wv8 wv8 wv3 wc9 wi wi wn wv3
+      wc9 wi wi wi wi wi wi wi wv2 wv8 wi wv1 wv1 wi wi wn wv2 wv8 wi wv1 wv1
+      wi wi wn wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi wi wi wi wv4 wn wc8 wv9
+      wi wi wv3 wv2 wi wv6 wi wi wv2 wv8 wi wv1 wv1 wi wi wn wv2 wv8 wi wv1 wv1
+      wi wi wn wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi wi wi wi wi wv2 wv8 wi
+      wv1 wv1 wi wi wn wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi wi wi wv2 wv8 wi
+      wv1 wv1 wi wi wn wv2 wv8 wi wv1 wv1 wi wi wn wv8 wv8 wv3 wc9 wi wi wn wv3
+      wc9 wi wi wi wi wi wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi wi wv2 wv8 wi
+      wv1 wv1 wi wi wn wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi wi wi wv8 wv3 wc9
+      wi wi wn wv3 wc9 wi wi wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi wi wv3 wc9
+      wi wv3 wc9 wi wv8 ax-g1 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi wv8 ax-1 ax-mp
+      wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi wi wv2 wv8 wi wv1 wv1 wi wi wn
+      ax-1 ax-mp wv2 wv8 wi wv1 wv1 wi wi wn wv8 wv8 wv3 wc9 wi wi wn wv3 wc9
+      wi wi wi wi wv2 wv8 wi wv1 wv1 wi wi wn ax-1 ax-mp wv2 wv8 wi wv1 wv1 wi
+      wi wn wv2 wv8 wi wv1 wv1 wi wi wn wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi
+      wi wi wi wv4 wn wc8 wv9 wi wi wv3 wv2 wi wv6 wi wi ax-1 ax-mp wv4 wn wc8
+      wv9 wi wi wv3 wv2 wi wv6 wi wi wv2 wv8 wi wv1 wv1 wi wi wn wv2 wv8 wi wv1
+      wv1 wi wi wn wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi wi wi wi wi wc8 ax-1
+      ax-mp wc8 wv4 wn wc8 wv9 wi wi wv3 wv2 wi wv6 wi wi wv2 wv8 wi wv1 wv1 wi
+      wi wn wv2 wv8 wi wv1 wv1 wi wi wn wv8 wv8 wv3 wc9 wi wi wn wv3 wc9 wi wi
+      wi wi wi wi wi wv0 wv0 wv0 wi wi ax-1 ax-mp ax-mp $.
+  $}
+  th346 $p |- ( -. ( -. c3 -> ( c7 -> v2 ) ) -> ( ( ( ( v5 -> v1 ) -> c5 ) -> ( -. v4 -> ( v9 -> v3 ) ) ) -> ( ( ( ( v0 -> v7 ) -> v0 ) -> ( ( v8 -> c6 ) -> ( v3 -> c7 ) ) ) -> ( ( v4 -> v2 ) -> ( ( v4 -> v2 ) -> ( v8 -> ( ( v7 -> v0 ) -> ( ( ( v7 -> v0 ) -> v8 ) -> -. ( ( v4 -> v2 ) -> v8 ) ) ) ) ) ) ) ) ) $=
+      wv5 wv1 wi wc5 wi wv4 wn wv9 wv3 wi wi wi wv0 wv7 wi wv0 wi wv8 wc6 wi
+      wv3 wc7 wi wi wi wv4 wv2 wi wv4 wv2 wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi
+      wv4 wv2 wi wv8 wi wn wi wi wi wi wi wi wi wc3 wn wc7 wv2 wi wi wn wv5 wv1
+      wi wc5 wi wv4 wn wv9 wv3 wi wi wi wv0 wv7 wi wv0 wi wv8 wc6 wi wv3 wc7 wi
+      wi wi wv4 wv2 wi wv4 wv2 wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi wv4 wv2 wi
+      wv8 wi wn wi wi wi wi wi wi wi wi wv0 wv7 wi wv0 wi wv8 wc6 wi wv3 wc7 wi
+      wi wi wv4 wv2 wi wv4 wv2 wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi wv4 wv2 wi
+      wv8 wi wn wi wi wi wi wi wi wv5 wv1 wi wc5 wi wv4 wn wv9 wv3 wi wi wi wv0
+      wv7 wi wv0 wi wv8 wc6 wi wv3 wc7 wi wi wi wv4 wv2 wi wv4 wv2 wi wv8 wv7
+      wv0 wi wv7 wv0 wi wv8 wi wv4 wv2 wi wv8 wi wn wi wi wi wi wi wi wi wv4
+      wv2 wi wv4 wv2 wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi wv4 wv2 wi wv8 wi wn
+      wi wi wi wi wi wv0 wv7 wi wv0 wi wv8 wc6 wi wv3 wc7 wi wi wi wv4 wv2 wi
+      wv4 wv2 wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi wv4 wv2 wi wv8 wi wn wi wi wi
+      wi wi wi wv4 wv2 wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi wv4 wv2 wi wv8 wi wn
+      wi wi wi wi wv4 wv2 wi wv4 wv2 wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi wv4
+      wv2 wi wv8 wi wn wi wi wi wi wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi wv4 wv2
+      wi wv8 wi wn wi wi wi wv4 wv2 wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi wv4 wv2
+      wi wv8 wi wn wi wi wi wi wv7 wv0 wi wv7 wv0 wi wv8 wi wv4 wv2 wi wv8 wi
+      wn wi wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi wv4 wv2 wi wv8 wi wn wi wi wi
+      wv7 wv0 wi wv8 wi wv4 wv2 wi wv8 wi wn wi wv7 wv0 wi wv7 wv0 wi wv8 wi
+      wv4 wv2 wi wv8 wi wn wi wi wv4 wv2 wi wv8 wv8 wv7 wv0 wi ax-g0 wv7 wv0 wi
+      wv8 wi wv4 wv2 wi wv8 wi wn wi wv7 wv0 wi ax-1 ax-mp wv7 wv0 wi wv7 wv0
+      wi wv8 wi wv4 wv2 wi wv8 wi wn wi wi wv8 ax-1 ax-mp wv8 wv7 wv0 wi wv7
+      wv0 wi wv8 wi wv4 wv2 wi wv8 wi wn wi wi wi wv4 wv2 wi ax-1 ax-mp wv4 wv2
+      wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi wv4 wv2 wi wv8 wi wn wi wi wi wi wv4
+      wv2 wi ax-1 ax-mp wv4 wv2 wi wv4 wv2 wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi
+      wv4 wv2 wi wv8 wi wn wi wi wi wi wi wv0 wv7 wi wv0 wi wv8 wc6 wi wv3 wc7
+      wi wi wi ax-1 ax-mp wv0 wv7 wi wv0 wi wv8 wc6 wi wv3 wc7 wi wi wi wv4 wv2
+      wi wv4 wv2 wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi wv4 wv2 wi wv8 wi wn wi wi
+      wi wi wi wi wv5 wv1 wi wc5 wi wv4 wn wv9 wv3 wi wi wi ax-1 ax-mp wv5 wv1
+      wi wc5 wi wv4 wn wv9 wv3 wi wi wi wv0 wv7 wi wv0 wi wv8 wc6 wi wv3 wc7 wi
+      wi wi wv4 wv2 wi wv4 wv2 wi wv8 wv7 wv0 wi wv7 wv0 wi wv8 wi wv4 wv2 wi
+      wv8 wi wn wi wi wi wi wi wi wi wc3 wn wc7 wv2 wi wi wn ax-1 ax-mp $.
+  th347 $p |- ( -. v4 -> ( v5 -> -. ( c4 -> v7 ) ) ) $=
+      wv5 wc4 wv7 wi wn wi wv4 wn wv5 wc4 wv7 wi wn wi wi wc4 wv7 wi wn wv5 wc4
+      wv7 wi wn wi wc4 wv7 wi ax-g5 wc4 wv7 wi wn wv5 ax-1 ax-mp wv5 wc4 wv7 wi
+      wn wi wv4 wn ax-1 ax-mp $.
+  th348 $p |- ( v2 -> -. -. c5 ) $=
+      wc5 wn wn wv2 wc5 wn wn wi wc5 wn ax-g5 wc5 wn wn wv2 ax-1 ax-mp $.
+  th349 $p |- ( v3 -> ( ( c6 -> v8 ) -> -. ( ( ( c6 -> v8 ) -> ( v1 -> v0 ) ) -> ( -. c0 -> -. c0 ) ) ) ) $=
+      ( wc6 wi wc0 wn ax-g8 ax-1 ax-mp ) EDFZLBAFZFGHZNFFHZFZCPFOPLNMIOLJKPCJK
+      $.
+  th350 $p |- ( v1 -> ( c4 -> ( ( ( -. c6 -> v6 ) -> ( -. v2 -> ( v1 -> c2 ) ) ) -> ( v1 -> ( ( v1 -> v0 ) -> ( ( -. c8 -> ( ( c4 -> v5 ) -> -. v2 ) ) -> ( ( v1 -> v0 ) -> ( ( v1 -> v0 ) -> ( -. ( c4 -> c4 ) -> ( v1 -> v0 ) ) ) ) ) ) ) ) ) ) $=
+      ( wv9 wi wc4 wc6 wn wc2 wc8 ax-1 ax-g1 ax-mp ) FFFGGZBHIJEGCJBKGGGZBBAGZL
+      JHDGCJGGZRRHHGJRGZGZGZGZGZGZGZGZGZFFMUHPUHGUGUHUFUGUEUFUDUEUCUDUBUCUAUBTU
+      AHRHNTRMOUARMOUBSMOUCRMOUDBMOUEQMOUFHMOUGBMOUHPMOO $.
+  ${
+    $d v0 v4 $.
+    $d v0 v7 $.
+    th351 $p |- ( ( v4 -> v7 ) -> ( -. -. -. c2 -> ( ( v4 -> v7 ) -> ( v0 -> ( ( v2 -> ( ( v5 -> c8 ) -> -. c2 ) ) -> ( ( ( v8 -> ( v7 -> v3 ) ) -> v2 ) -> ( ( c7 -> ( ( c4 -> v7 ) -> -. v6 ) ) -> ( -. ( v2 -> ( v4 -> v7 ) ) -> -. ( ( v6 -> v7 ) -> v0 ) ) ) ) ) ) ) ) ) $=
+      ( wv1 wi wc2 wn wc8 wc7 wc4 ax-1 ax-g3 ax-mp ) IIIJJZDGJZKLLLZDGJZABEMJKL
+      JJZHGCJJBJZNOGJFLJJZBTJLFGJZAJLJZJZJZJZJZJZJZJZIIPUNSUNJUMUNULUMUKULUJUKU
+      IUJUHUIUGUHAUFBTQUGUEPRUHUDPRUIUCPRUJAPRUKUBPRULUAPRUMTPRUNSPRR $.
+  $}
+  th352 $p |- ( ( ( ( c4 -> v5 ) -> ( v2 -> v6 ) ) -> v4 ) -> ( ( ( -. c3 -> ( c2 -> v3 ) ) -> ( c7 -> ( v0 -> c8 ) ) ) -> ( -. -. v6 -> ( ( v0 -> ( ( v9 -> v0 ) -> v9 ) ) -> ( ( v0 -> ( ( v9 -> v0 ) -> v9 ) ) -> ( c7 -> ( ( c0 -> c5 ) -> ( ( -. ( c0 -> c5 ) -> -. ( v4 -> v9 ) ) -> ( ( v4 -> v9 ) -> ( c0 -> c5 ) ) ) ) ) ) ) ) ) ) $=
+      ( wv1 wi wc4 wc3 wn wc2 wc7 wc8 wc0 wc5 ax-1 ax-3 ax-mp ) HHHIIZJEIBFIIDI
+      ZKLMCIINAOIIIZFLLZAGAIGIIZUENPQIZUFLDGIZLIUGUFIIZIZIZIZIZIZIZIZHHRUOUAUOI
+      UNUOUMUNULUMUKULUJUKUIUJUHUIUFUGSUHUFRTUINRTUJUERTUKUERTULUDRTUMUCRTUNUBR
+      TUOUARTT $.
+  th353 $p |- ( ( ( ( c0 -> c5 ) -> ( v1 -> c8 ) ) -> ( ( c5 -> v9 ) -> ( v3 -> v4 ) ) ) -> ( v9 -> ( c1 -> ( -. ( ( c3 -> v9 ) -> c8 ) -> ( ( ( ( v2 -> v2 ) -> ( v4 -> v5 ) ) -> ( v7 -> ( v5 -> c2 ) ) ) -> ( ( v5 -> ( v4 -> ( v6 -> v2 ) ) ) -> ( c1 -> ( c1 -> ( -. ( ( v9 -> c6 ) -> c3 ) -> ( -. ( ( v2 -> v9 ) -> ( v9 -> v2 ) ) -> ( ( c2 -> c1 ) -> ( c1 -> ( c2 -> c1 ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv9 wc1 wc3 wv9 wi wc8 wi wn wv2 wv2 wi wv4 wv5 wi wi wv7 wv5 wc2 wi wi
+      wi wv5 wv4 wv6 wv2 wi wi wi wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9
+      wv2 wi wi wn wc2 wc1 wi wc1 wc2 wc1 wi wi wi wi wi wi wi wi wi wi wi wi
+      wc0 wc5 wi wv1 wc8 wi wi wc5 wv9 wi wv3 wv4 wi wi wi wv9 wc1 wc3 wv9 wi
+      wc8 wi wn wv2 wv2 wi wv4 wv5 wi wi wv7 wv5 wc2 wi wi wi wv5 wv4 wv6 wv2
+      wi wi wi wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn wc2 wc1
+      wi wc1 wc2 wc1 wi wi wi wi wi wi wi wi wi wi wi wi wi wc1 wc3 wv9 wi wc8
+      wi wn wv2 wv2 wi wv4 wv5 wi wi wv7 wv5 wc2 wi wi wi wv5 wv4 wv6 wv2 wi wi
+      wi wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn wc2 wc1 wi
+      wc1 wc2 wc1 wi wi wi wi wi wi wi wi wi wi wi wv9 wc1 wc3 wv9 wi wc8 wi wn
+      wv2 wv2 wi wv4 wv5 wi wi wv7 wv5 wc2 wi wi wi wv5 wv4 wv6 wv2 wi wi wi
+      wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn wc2 wc1 wi wc1
+      wc2 wc1 wi wi wi wi wi wi wi wi wi wi wi wi wc3 wv9 wi wc8 wi wn wv2 wv2
+      wi wv4 wv5 wi wi wv7 wv5 wc2 wi wi wi wv5 wv4 wv6 wv2 wi wi wi wc1 wc1
+      wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn wc2 wc1 wi wc1 wc2 wc1
+      wi wi wi wi wi wi wi wi wi wi wc1 wc3 wv9 wi wc8 wi wn wv2 wv2 wi wv4 wv5
+      wi wi wv7 wv5 wc2 wi wi wi wv5 wv4 wv6 wv2 wi wi wi wc1 wc1 wv9 wc6 wi
+      wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn wc2 wc1 wi wc1 wc2 wc1 wi wi wi wi
+      wi wi wi wi wi wi wi wv2 wv2 wi wv4 wv5 wi wi wv7 wv5 wc2 wi wi wi wv5
+      wv4 wv6 wv2 wi wi wi wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi
+      wi wn wc2 wc1 wi wc1 wc2 wc1 wi wi wi wi wi wi wi wi wi wc3 wv9 wi wc8 wi
+      wn wv2 wv2 wi wv4 wv5 wi wi wv7 wv5 wc2 wi wi wi wv5 wv4 wv6 wv2 wi wi wi
+      wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn wc2 wc1 wi wc1
+      wc2 wc1 wi wi wi wi wi wi wi wi wi wi wv5 wv4 wv6 wv2 wi wi wi wc1 wc1
+      wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn wc2 wc1 wi wc1 wc2 wc1
+      wi wi wi wi wi wi wi wi wv2 wv2 wi wv4 wv5 wi wi wv7 wv5 wc2 wi wi wi wv5
+      wv4 wv6 wv2 wi wi wi wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi
+      wi wn wc2 wc1 wi wc1 wc2 wc1 wi wi wi wi wi wi wi wi wi wc1 wc1 wv9 wc6
+      wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn wc2 wc1 wi wc1 wc2 wc1 wi wi wi
+      wi wi wi wi wv5 wv4 wv6 wv2 wi wi wi wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9
+      wi wv9 wv2 wi wi wn wc2 wc1 wi wc1 wc2 wc1 wi wi wi wi wi wi wi wi wc1
+      wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn wc2 wc1 wi wc1 wc2 wc1
+      wi wi wi wi wi wi wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi
+      wn wc2 wc1 wi wc1 wc2 wc1 wi wi wi wi wi wi wi wc6 wv9 wc1 wv9 wc2 wv2
+      th180 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn wc2 wc1 wi wc1
+      wc2 wc1 wi wi wi wi wi wi wc1 ax-1 ax-mp wc1 wc1 wv9 wc6 wi wc3 wi wn wv2
+      wv9 wi wv9 wv2 wi wi wn wc2 wc1 wi wc1 wc2 wc1 wi wi wi wi wi wi wi wv5
+      wv4 wv6 wv2 wi wi wi ax-1 ax-mp wv5 wv4 wv6 wv2 wi wi wi wc1 wc1 wv9 wc6
+      wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn wc2 wc1 wi wc1 wc2 wc1 wi wi wi
+      wi wi wi wi wi wv2 wv2 wi wv4 wv5 wi wi wv7 wv5 wc2 wi wi wi ax-1 ax-mp
+      wv2 wv2 wi wv4 wv5 wi wi wv7 wv5 wc2 wi wi wi wv5 wv4 wv6 wv2 wi wi wi
+      wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn wc2 wc1 wi wc1
+      wc2 wc1 wi wi wi wi wi wi wi wi wi wc3 wv9 wi wc8 wi wn ax-1 ax-mp wc3
+      wv9 wi wc8 wi wn wv2 wv2 wi wv4 wv5 wi wi wv7 wv5 wc2 wi wi wi wv5 wv4
+      wv6 wv2 wi wi wi wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi wi wn
+      wc2 wc1 wi wc1 wc2 wc1 wi wi wi wi wi wi wi wi wi wi wc1 ax-1 ax-mp wc1
+      wc3 wv9 wi wc8 wi wn wv2 wv2 wi wv4 wv5 wi wi wv7 wv5 wc2 wi wi wi wv5
+      wv4 wv6 wv2 wi wi wi wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi wv9 wv2 wi
+      wi wn wc2 wc1 wi wc1 wc2 wc1 wi wi wi wi wi wi wi wi wi wi wi wv9 ax-1
+      ax-mp wv9 wc1 wc3 wv9 wi wc8 wi wn wv2 wv2 wi wv4 wv5 wi wi wv7 wv5 wc2
+      wi wi wi wv5 wv4 wv6 wv2 wi wi wi wc1 wc1 wv9 wc6 wi wc3 wi wn wv2 wv9 wi
+      wv9 wv2 wi wi wn wc2 wc1 wi wc1 wc2 wc1 wi wi wi wi wi wi wi wi wi wi wi
+      wi wc0 wc5 wi wv1 wc8 wi wi wc5 wv9 wi wv3 wv4 wi wi wi ax-1 ax-mp $.
+  th354 $p |- ( c5 -> ( v1 -> ( ( ( ( v5 -> c3 ) -> -. v2 ) -> c3 ) -> ( ( ( ( v1 -> v1 ) -> v2 ) -> ( ( c4 -> c9 ) -> ( v2 -> c1 ) ) ) -> v2 ) ) ) ) $=
+      wv1 wv5 wc3 wi wv2 wn wi wc3 wi wv1 wv1 wi wv2 wi wc4 wc9 wi wv2 wc1 wi
+      wi wi wv2 wi wi wi wc5 wv1 wv5 wc3 wi wv2 wn wi wc3 wi wv1 wv1 wi wv2 wi
+      wc4 wc9 wi wv2 wc1 wi wi wi wv2 wi wi wi wi wv5 wc3 wi wv2 wn wi wc3 wi
+      wv1 wv1 wi wv2 wi wc4 wc9 wi wv2 wc1 wi wi wi wv2 wi wi wv1 wv5 wc3 wi
+      wv2 wn wi wc3 wi wv1 wv1 wi wv2 wi wc4 wc9 wi wv2 wc1 wi wi wi wv2 wi wi
+      wi wv2 wv2 wv1 wv5 wv2 wv1 th52 wv5 wc3 wi wv2 wn wi wc3 wi wv1 wv1 wi
+      wv2 wi wc4 wc9 wi wv2 wc1 wi wi wi wv2 wi wi wv1 ax-1 ax-mp wv1 wv5 wc3
+      wi wv2 wn wi wc3 wi wv1 wv1 wi wv2 wi wc4 wc9 wi wv2 wc1 wi wi wi wv2 wi
+      wi wi wc5 ax-1 ax-mp $.
+  wth36 $p wff ( v8 -> -. ( ( v5 -> c4 ) -> ( v5 -> c7 ) ) ) $=
+      wv8 wv5 wc4 wi wv5 wc7 wi wi wn wi $.
+  th355 $p |- ( ( -. ( v7 -> v9 ) -> ( ( v9 -> c6 ) -> v7 ) ) -> ( ( ( -. c4 -> ( v8 -> c2 ) ) -> ( ( v3 -> c1 ) -> -. v3 ) ) -> ( c1 -> ( v1 -> ( ( ( -. v7 -> -. v5 ) -> v2 ) -> ( c3 -> ( c2 -> ( c3 -> ( v2 -> ( ( ( ( c2 -> c2 ) -> c0 ) -> ( ( c2 -> c9 ) -> -. v2 ) ) -> ( c2 -> ( v2 -> ( v2 -> ( ( ( ( c2 -> v9 ) -> c1 ) -> ( v1 -> -. c3 ) ) -> ( ( ( ( v1 -> v1 ) -> v1 ) -> ( v2 -> v1 ) ) -> ( ( v2 -> ( v2 -> v2 ) ) -> ( ( v2 -> v2 ) -> ( v2 -> v2 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wc4 wn wv8 wc2 wi wi wv3 wc1 wi wv3 wn wi wi wc1 wv1 wv7 wn wv5 wn wi wv2
+      wi wc3 wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi wc2 wv2 wv2
+      wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1 wi wi wv2
+      wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi
+      wi wi wi wi wv7 wv9 wi wn wv9 wc6 wi wv7 wi wi wc4 wn wv8 wc2 wi wi wv3
+      wc1 wi wv3 wn wi wi wc1 wv1 wv7 wn wv5 wn wi wv2 wi wc3 wc2 wc3 wv2 wc2
+      wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi wc2 wv2 wv2 wc2 wv9 wi wc1 wi wv1
+      wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1 wi wi wv2 wv2 wv2 wi wi wv2 wv2 wi
+      wv2 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi wc1 wv1 wv7
+      wn wv5 wn wi wv2 wi wc3 wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn
+      wi wi wc2 wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi
+      wv2 wv1 wi wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wi wi wi wc4 wn wv8 wc2 wi wi wv3 wc1 wi wv3 wn wi wi
+      wc1 wv1 wv7 wn wv5 wn wi wv2 wi wc3 wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9
+      wi wv2 wn wi wi wc2 wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi
+      wv1 wi wv2 wv1 wi wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi
+      wi wi wi wi wi wi wi wi wi wi wi wi wv1 wv7 wn wv5 wn wi wv2 wi wc3 wc2
+      wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi wc2 wv2 wv2 wc2 wv9 wi
+      wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1 wi wi wv2 wv2 wv2 wi wi
+      wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi wi wi wc1 wv1
+      wv7 wn wv5 wn wi wv2 wi wc3 wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2
+      wn wi wi wc2 wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi
+      wv2 wv1 wi wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wi wi wi wv7 wn wv5 wn wi wv2 wi wc3 wc2 wc3 wv2 wc2
+      wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi wc2 wv2 wv2 wc2 wv9 wi wc1 wi wv1
+      wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1 wi wi wv2 wv2 wv2 wi wi wv2 wv2 wi
+      wv2 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi wi wv1 wv7 wn wv5 wn wi
+      wv2 wi wc3 wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi wc2 wv2
+      wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1 wi wi
+      wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi wi wi wi
+      wi wi wi wc3 wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi wc2
+      wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1 wi
+      wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi wi wi
+      wi wi wv7 wn wv5 wn wi wv2 wi wc3 wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9
+      wi wv2 wn wi wi wc2 wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi
+      wv1 wi wv2 wv1 wi wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi
+      wi wi wi wi wi wi wi wi wi wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2
+      wn wi wi wc2 wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi
+      wv2 wv1 wi wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi
+      wi wi wi wi wi wc3 wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi
+      wc2 wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1
+      wi wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi wi
+      wi wi wi wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi wc2 wv2 wv2
+      wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1 wi wi wv2
+      wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi wi wi wc2 wc3
+      wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi wc2 wv2 wv2 wc2 wv9 wi wc1
+      wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1 wi wi wv2 wv2 wv2 wi wi wv2
+      wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wv2 wc3 wv2 wc2 wv2
+      wv1 wv9 wv2 th116 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi wc2
+      wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1 wi
+      wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi wi wi
+      wc2 ax-1 ax-mp wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi wc2
+      wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1 wi
+      wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi wi wi
+      wi wc3 ax-1 ax-mp wc3 wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi
+      wi wc2 wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2
+      wv1 wi wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi
+      wi wi wi wi wv7 wn wv5 wn wi wv2 wi ax-1 ax-mp wv7 wn wv5 wn wi wv2 wi
+      wc3 wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi wc2 wv2 wv2 wc2
+      wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1 wi wi wv2 wv2
+      wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi wi wi wi wi wi
+      wv1 ax-1 ax-mp wv1 wv7 wn wv5 wn wi wv2 wi wc3 wc2 wc3 wv2 wc2 wc2 wi wc0
+      wi wc2 wc9 wi wv2 wn wi wi wc2 wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi
+      wv1 wv1 wi wv1 wi wv2 wv1 wi wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi
+      wi wi wi wi wi wi wi wi wi wi wi wi wi wi wc1 ax-1 ax-mp wc1 wv1 wv7 wn
+      wv5 wn wi wv2 wi wc3 wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi
+      wi wc2 wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2
+      wv1 wi wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wi wc4 wn wv8 wc2 wi wi wv3 wc1 wi wv3 wn wi wi ax-1
+      ax-mp wc4 wn wv8 wc2 wi wi wv3 wc1 wi wv3 wn wi wi wc1 wv1 wv7 wn wv5 wn
+      wi wv2 wi wc3 wc2 wc3 wv2 wc2 wc2 wi wc0 wi wc2 wc9 wi wv2 wn wi wi wc2
+      wv2 wv2 wc2 wv9 wi wc1 wi wv1 wc3 wn wi wi wv1 wv1 wi wv1 wi wv2 wv1 wi
+      wi wv2 wv2 wv2 wi wi wv2 wv2 wi wv2 wv2 wi wi wi wi wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wv7 wv9 wi wn wv9 wc6 wi wv7 wi wi ax-1 ax-mp $.
+  th356 $p |- ( v8 -> ( v4 -> ( -. ( ( c4 -> v8 ) -> ( v3 -> v4 ) ) -> ( v0 -> ( ( c4 -> v8 ) -> ( c2 -> ( ( ( ( c4 -> c6 ) -> -. v4 ) -> c1 ) -> ( c2 -> -. ( c4 -> v8 ) ) ) ) ) ) ) ) ) $=
+      wv4 wc4 wv8 wi wv3 wv4 wi wi wn wv0 wc4 wv8 wi wc2 wc4 wc6 wi wv4 wn wi
+      wc1 wi wc2 wc4 wv8 wi wn wi wi wi wi wi wi wi wv8 wv4 wc4 wv8 wi wv3 wv4
+      wi wi wn wv0 wc4 wv8 wi wc2 wc4 wc6 wi wv4 wn wi wc1 wi wc2 wc4 wv8 wi wn
+      wi wi wi wi wi wi wi wi wc4 wv8 wi wv3 wv4 wi wi wn wv0 wc4 wv8 wi wc2
+      wc4 wc6 wi wv4 wn wi wc1 wi wc2 wc4 wv8 wi wn wi wi wi wi wi wi wv4 wc4
+      wv8 wi wv3 wv4 wi wi wn wv0 wc4 wv8 wi wc2 wc4 wc6 wi wv4 wn wi wc1 wi
+      wc2 wc4 wv8 wi wn wi wi wi wi wi wi wi wv0 wc4 wv8 wi wc2 wc4 wc6 wi wv4
+      wn wi wc1 wi wc2 wc4 wv8 wi wn wi wi wi wi wi wc4 wv8 wi wv3 wv4 wi wi wn
+      wv0 wc4 wv8 wi wc2 wc4 wc6 wi wv4 wn wi wc1 wi wc2 wc4 wv8 wi wn wi wi wi
+      wi wi wi wc1 wv4 wc4 wv0 wv8 th143 wv0 wc4 wv8 wi wc2 wc4 wc6 wi wv4 wn
+      wi wc1 wi wc2 wc4 wv8 wi wn wi wi wi wi wi wc4 wv8 wi wv3 wv4 wi wi wn
+      ax-1 ax-mp wc4 wv8 wi wv3 wv4 wi wi wn wv0 wc4 wv8 wi wc2 wc4 wc6 wi wv4
+      wn wi wc1 wi wc2 wc4 wv8 wi wn wi wi wi wi wi wi wv4 ax-1 ax-mp wv4 wc4
+      wv8 wi wv3 wv4 wi wi wn wv0 wc4 wv8 wi wc2 wc4 wc6 wi wv4 wn wi wc1 wi
+      wc2 wc4 wv8 wi wn wi wi wi wi wi wi wi wv8 ax-1 ax-mp $.
+  th357 $p |- ( v8 -> ( v4 -> ( -. ( ( c1 -> c6 ) -> ( v1 -> v7 ) ) -> ( c3 -> ( v7 -> ( v8 -> ( ( c7 -> c0 ) -> ( -. ( c3 -> v3 ) -> -. ( ( c7 -> c0 ) -> c3 ) ) ) ) ) ) ) ) ) $=
+      ( wc1 wc6 wi wn wc3 wc7 wc0 th204 ax-1 ax-mp ) CFGHADHHIZJDEKLHJBHIKLHJHI
+      HHHZHZHZHZHZEUAHTUASTRSQREJBMQDNORJNOSPNOTCNOUAENO $.
+  th358 $p |- ( ( ( ( v5 -> v1 ) -> ( v4 -> v3 ) ) -> v9 ) -> ( ( v0 -> v8 ) -> ( ( -. -. v9 -> ( -. v4 -> c3 ) ) -> ( -. v8 -> ( c3 -> ( v4 -> ( ( -. v8 -> ( v4 -> ( v0 -> v8 ) ) ) -> ( ( -. v8 -> v4 ) -> ( -. v8 -> ( v0 -> v8 ) ) ) ) ) ) ) ) ) ) $=
+      ( wi wn wc3 ax-2 ax-1 ax-mp ) AFHZGIIDIJHHZFIZJDPDNHHPDHPNHHHZHZHZHZHZHZE
+      BHDCHHGHZUBHUAUBTUASTRSQRPDNKQDLMRJLMSPLMTOLMUANLMUBUCLM $.
+  th359 $p |- ( ( v4 -> ( ( c9 -> c8 ) -> -. c3 ) ) -> ( ( ( ( v6 -> v3 ) -> ( v2 -> c5 ) ) -> ( ( v8 -> v4 ) -> ( c7 -> v7 ) ) ) -> ( ( v9 -> v9 ) -> ( c2 -> ( v9 -> v9 ) ) ) ) ) $=
+      wv6 wv3 wi wv2 wc5 wi wi wv8 wv4 wi wc7 wv7 wi wi wi wv9 wv9 wi wc2 wv9
+      wv9 wi wi wi wi wv4 wc9 wc8 wi wc3 wn wi wi wv6 wv3 wi wv2 wc5 wi wi wv8
+      wv4 wi wc7 wv7 wi wi wi wv9 wv9 wi wc2 wv9 wv9 wi wi wi wi wi wv9 wv9 wi
+      wc2 wv9 wv9 wi wi wi wv6 wv3 wi wv2 wc5 wi wi wv8 wv4 wi wc7 wv7 wi wi wi
+      wv9 wv9 wi wc2 wv9 wv9 wi wi wi wi wc2 wv9 wv9 wi wi wv9 wv9 wi wc2 wv9
+      wv9 wi wi wi wv9 wv9 wi wc2 wv9 wv9 wi wi wv9 wv9 wi ax-g4 wv9 wv9 wi wc2
+      ax-1 ax-mp wc2 wv9 wv9 wi wi wv9 wv9 wi ax-1 ax-mp wv9 wv9 wi wc2 wv9 wv9
+      wi wi wi wv6 wv3 wi wv2 wc5 wi wi wv8 wv4 wi wc7 wv7 wi wi wi ax-1 ax-mp
+      wv6 wv3 wi wv2 wc5 wi wi wv8 wv4 wi wc7 wv7 wi wi wi wv9 wv9 wi wc2 wv9
+      wv9 wi wi wi wi wv4 wc9 wc8 wi wc3 wn wi wi ax-1 ax-mp $.
+  th360 $p |- ( v1 -> ( -. v2 -> ( ( c4 -> -. ( v4 -> c8 ) ) -> ( v8 -> ( ( -. ( v6 -> v1 ) -> c7 ) -> ( v8 -> ( -. v3 -> ( -. v3 -> -. v3 ) ) ) ) ) ) ) ) $=
+      ( wn wc4 wc8 wi wc7 ax-1 ax-mp ) BGZHDIJGJZFEAJGKJZFCGZQQJJZJZJZJZJZJZAUC
+      JUBUCUAUBTUASTRSQQLRFLMSPLMTFLMUAOLMUBNLMUCALM $.
+  th361 $p |- ( ( -. ( v0 -> v4 ) -> ( v0 -> -. v4 ) ) -> ( ( ( ( v9 -> v1 ) -> -. v3 ) -> -. ( v6 -> c1 ) ) -> ( v2 -> ( ( v4 -> ( c3 -> v5 ) ) -> c8 ) ) ) ) $=
+      wv7 wv7 wv7 wi wi wv0 wv4 wi wn wv0 wv4 wn wi wi wv9 wv1 wi wv3 wn wi wv6
+      wc1 wi wn wi wv2 wv4 wc3 wv5 wi wi wc8 wi wi wi wi wv7 wv7 ax-1 wv0 wv4
+      wi wn wv0 wv4 wn wi wi wv9 wv1 wi wv3 wn wi wv6 wc1 wi wn wi wv2 wv4 wc3
+      wv5 wi wi wc8 wi wi wi wi wv7 wv7 wv7 wi wi wv0 wv4 wi wn wv0 wv4 wn wi
+      wi wv9 wv1 wi wv3 wn wi wv6 wc1 wi wn wi wv2 wv4 wc3 wv5 wi wi wc8 wi wi
+      wi wi wi wv9 wv1 wi wv3 wn wi wv6 wc1 wi wn wi wv2 wv4 wc3 wv5 wi wi wc8
+      wi wi wi wv0 wv4 wi wn wv0 wv4 wn wi wi wv9 wv1 wi wv3 wn wi wv6 wc1 wi
+      wn wi wv2 wv4 wc3 wv5 wi wi wc8 wi wi wi wi wv2 wv4 wc3 wv5 wi wi wc8 wi
+      wi wv9 wv1 wi wv3 wn wi wv6 wc1 wi wn wi wv2 wv4 wc3 wv5 wi wi wc8 wi wi
+      wi wv4 wc3 wv5 wi wi wc8 wi wv2 wv4 wc3 wv5 wi wi wc8 wi wi wc8 wv4 wc3
+      wv5 wi wi wc8 wi wc8 ax-g2 wc8 wv4 wc3 wv5 wi wi ax-1 ax-mp wv4 wc3 wv5
+      wi wi wc8 wi wv2 ax-1 ax-mp wv2 wv4 wc3 wv5 wi wi wc8 wi wi wv9 wv1 wi
+      wv3 wn wi wv6 wc1 wi wn wi ax-1 ax-mp wv9 wv1 wi wv3 wn wi wv6 wc1 wi wn
+      wi wv2 wv4 wc3 wv5 wi wi wc8 wi wi wi wv0 wv4 wi wn wv0 wv4 wn wi wi ax-1
+      ax-mp wv0 wv4 wi wn wv0 wv4 wn wi wi wv9 wv1 wi wv3 wn wi wv6 wc1 wi wn
+      wi wv2 wv4 wc3 wv5 wi wi wc8 wi wi wi wi wv7 wv7 wv7 wi wi ax-1 ax-mp
+      ax-mp $.
+  th362 $p |- ( c6 -> ( v4 -> ( ( ( ( c7 -> c1 ) -> ( v9 -> v5 ) ) -> ( ( v9 -> v4 ) -> v0 ) ) -> -. ( ( v4 -> v0 ) -> ( v0 -> v0 ) ) ) ) ) $=
+      ( wc7 wc1 wi wn wc6 ax-g8 ax-1 ax-mp ) BEFGDCGGDBGAGGZBAGAAGGHZGZGZIPGOPN
+      OBAAJNMKLOBKLPIKL $.
+  wth37 $p wff v2 $=
+      wv2 $.
+  th363 $p |- ( ( v8 -> v3 ) -> ( ( v8 -> v3 ) -> ( ( ( ( c4 -> v3 ) -> ( v7 -> v5 ) ) -> v8 ) -> ( -. ( ( v5 -> v1 ) -> ( v0 -> v6 ) ) -> ( -. ( ( v5 -> v1 ) -> ( v0 -> v6 ) ) -> ( ( ( c3 -> ( v9 -> v5 ) ) -> v9 ) -> ( v8 -> v3 ) ) ) ) ) ) ) $=
+      wv8 wv3 wi wc4 wv3 wi wv7 wv5 wi wi wv8 wi wv5 wv1 wi wv0 wv6 wi wi wn
+      wv5 wv1 wi wv0 wv6 wi wi wn wc3 wv9 wv5 wi wi wv9 wi wv8 wv3 wi wi wi wi
+      wi wi wv8 wv3 wi wv8 wv3 wi wc4 wv3 wi wv7 wv5 wi wi wv8 wi wv5 wv1 wi
+      wv0 wv6 wi wi wn wv5 wv1 wi wv0 wv6 wi wi wn wc3 wv9 wv5 wi wi wv9 wi wv8
+      wv3 wi wi wi wi wi wi wi wc4 wv3 wi wv7 wv5 wi wi wv8 wi wv5 wv1 wi wv0
+      wv6 wi wi wn wv5 wv1 wi wv0 wv6 wi wi wn wc3 wv9 wv5 wi wi wv9 wi wv8 wv3
+      wi wi wi wi wi wv8 wv3 wi wc4 wv3 wi wv7 wv5 wi wi wv8 wi wv5 wv1 wi wv0
+      wv6 wi wi wn wv5 wv1 wi wv0 wv6 wi wi wn wc3 wv9 wv5 wi wi wv9 wi wv8 wv3
+      wi wi wi wi wi wi wv5 wv1 wi wv0 wv6 wi wi wn wv5 wv1 wi wv0 wv6 wi wi wn
+      wc3 wv9 wv5 wi wi wv9 wi wv8 wv3 wi wi wi wi wc4 wv3 wi wv7 wv5 wi wi wv8
+      wi wv5 wv1 wi wv0 wv6 wi wi wn wv5 wv1 wi wv0 wv6 wi wi wn wc3 wv9 wv5 wi
+      wi wv9 wi wv8 wv3 wi wi wi wi wi wv5 wv1 wi wv0 wv6 wi wi wn wc3 wv9 wv5
+      wi wi wv9 wi wv8 wv3 wi wi wi wv5 wv1 wi wv0 wv6 wi wi wn wv5 wv1 wi wv0
+      wv6 wi wi wn wc3 wv9 wv5 wi wi wv9 wi wv8 wv3 wi wi wi wi wc3 wv9 wv5 wi
+      wi wv9 wi wv8 wv3 wi wi wv5 wv1 wi wv0 wv6 wi wi wn wc3 wv9 wv5 wi wi wv9
+      wi wv8 wv3 wi wi wi wv8 wv3 wi wc3 wv9 wv5 wi wi wv9 wi wv8 wv3 wi wi wv8
+      wv3 wi ax-g2 wv8 wv3 wi wc3 wv9 wv5 wi wi wv9 wi ax-1 ax-mp wc3 wv9 wv5
+      wi wi wv9 wi wv8 wv3 wi wi wv5 wv1 wi wv0 wv6 wi wi wn ax-1 ax-mp wv5 wv1
+      wi wv0 wv6 wi wi wn wc3 wv9 wv5 wi wi wv9 wi wv8 wv3 wi wi wi wv5 wv1 wi
+      wv0 wv6 wi wi wn ax-1 ax-mp wv5 wv1 wi wv0 wv6 wi wi wn wv5 wv1 wi wv0
+      wv6 wi wi wn wc3 wv9 wv5 wi wi wv9 wi wv8 wv3 wi wi wi wi wc4 wv3 wi wv7
+      wv5 wi wi wv8 wi ax-1 ax-mp wc4 wv3 wi wv7 wv5 wi wi wv8 wi wv5 wv1 wi
+      wv0 wv6 wi wi wn wv5 wv1 wi wv0 wv6 wi wi wn wc3 wv9 wv5 wi wi wv9 wi wv8
+      wv3 wi wi wi wi wi wv8 wv3 wi ax-1 ax-mp wv8 wv3 wi wc4 wv3 wi wv7 wv5 wi
+      wi wv8 wi wv5 wv1 wi wv0 wv6 wi wi wn wv5 wv1 wi wv0 wv6 wi wi wn wc3 wv9
+      wv5 wi wi wv9 wi wv8 wv3 wi wi wi wi wi wi wv8 wv3 wi ax-1 ax-mp $.
+  th364 $p |- ( v9 -> ( -. ( ( v7 -> v2 ) -> v0 ) -> ( -. ( ( v2 -> v2 ) -> ( v4 -> v2 ) ) -> ( -. v4 -> -. -. v4 ) ) ) ) $=
+      wv7 wv2 wi wv0 wi wn wv2 wv2 wi wv4 wv2 wi wi wn wv4 wn wv4 wn wn wi wi
+      wi wv9 wv7 wv2 wi wv0 wi wn wv2 wv2 wi wv4 wv2 wi wi wn wv4 wn wv4 wn wn
+      wi wi wi wi wv2 wv2 wi wv4 wv2 wi wi wn wv4 wn wv4 wn wn wi wi wv7 wv2 wi
+      wv0 wi wn wv2 wv2 wi wv4 wv2 wi wi wn wv4 wn wv4 wn wn wi wi wi wv2 wv2
+      wv4 th112 wv2 wv2 wi wv4 wv2 wi wi wn wv4 wn wv4 wn wn wi wi wv7 wv2 wi
+      wv0 wi wn ax-1 ax-mp wv7 wv2 wi wv0 wi wn wv2 wv2 wi wv4 wv2 wi wi wn wv4
+      wn wv4 wn wn wi wi wi wv9 ax-1 ax-mp $.
+  th365 $p |- ( ( v7 -> ( ( v0 -> v8 ) -> v5 ) ) -> ( v1 -> ( ( ( v7 -> v4 ) -> ( ( v7 -> v4 ) -> ( v4 -> v6 ) ) ) -> ( ( ( v7 -> v4 ) -> ( v7 -> v4 ) ) -> ( ( v7 -> v4 ) -> ( v4 -> v6 ) ) ) ) ) ) $=
+      wv1 wv7 wv4 wi wv7 wv4 wi wv4 wv6 wi wi wi wv7 wv4 wi wv7 wv4 wi wi wv7
+      wv4 wi wv4 wv6 wi wi wi wi wi wv7 wv0 wv8 wi wv5 wi wi wv1 wv7 wv4 wi wv7
+      wv4 wi wv4 wv6 wi wi wi wv7 wv4 wi wv7 wv4 wi wi wv7 wv4 wi wv4 wv6 wi wi
+      wi wi wi wi wv7 wv4 wi wv7 wv4 wi wv4 wv6 wi wi wi wv7 wv4 wi wv7 wv4 wi
+      wi wv7 wv4 wi wv4 wv6 wi wi wi wi wv1 wv7 wv4 wi wv7 wv4 wi wv4 wv6 wi wi
+      wi wv7 wv4 wi wv7 wv4 wi wi wv7 wv4 wi wv4 wv6 wi wi wi wi wi wv7 wv4 wi
+      wv7 wv4 wi wv4 wv6 wi ax-2 wv7 wv4 wi wv7 wv4 wi wv4 wv6 wi wi wi wv7 wv4
+      wi wv7 wv4 wi wi wv7 wv4 wi wv4 wv6 wi wi wi wi wv1 ax-1 ax-mp wv1 wv7
+      wv4 wi wv7 wv4 wi wv4 wv6 wi wi wi wv7 wv4 wi wv7 wv4 wi wi wv7 wv4 wi
+      wv4 wv6 wi wi wi wi wi wv7 wv0 wv8 wi wv5 wi wi ax-1 ax-mp $.
+  th366 $p |- ( ( ( v9 -> ( v9 -> c7 ) ) -> c3 ) -> ( ( ( ( c7 -> v8 ) -> -. c3 ) -> -. v2 ) -> ( ( c3 -> c0 ) -> ( ( c3 -> c0 ) -> -. ( ( ( c3 -> c0 ) -> ( v9 -> v5 ) ) -> ( ( c3 -> c0 ) -> ( c3 -> c0 ) ) ) ) ) ) ) $=
+      wc7 wv8 wi wc3 wn wi wv2 wn wi wc3 wc0 wi wc3 wc0 wi wc3 wc0 wi wv9 wv5
+      wi wi wc3 wc0 wi wc3 wc0 wi wi wi wn wi wi wi wv9 wv9 wc7 wi wi wc3 wi
+      wc7 wv8 wi wc3 wn wi wv2 wn wi wc3 wc0 wi wc3 wc0 wi wc3 wc0 wi wv9 wv5
+      wi wi wc3 wc0 wi wc3 wc0 wi wi wi wn wi wi wi wi wc3 wc0 wi wc3 wc0 wi
+      wc3 wc0 wi wv9 wv5 wi wi wc3 wc0 wi wc3 wc0 wi wi wi wn wi wi wc7 wv8 wi
+      wc3 wn wi wv2 wn wi wc3 wc0 wi wc3 wc0 wi wc3 wc0 wi wv9 wv5 wi wi wc3
+      wc0 wi wc3 wc0 wi wi wi wn wi wi wi wc3 wc0 wi wc3 wc0 wi wv9 wv5 wi wi
+      wc3 wc0 wi wc3 wc0 wi wi wi wn wi wc3 wc0 wi wc3 wc0 wi wc3 wc0 wi wv9
+      wv5 wi wi wc3 wc0 wi wc3 wc0 wi wi wi wn wi wi wc3 wc0 wi wv9 wv5 wi wi
+      wc3 wc0 wi wc3 wc0 wi wi wi wn wc3 wc0 wi wc3 wc0 wi wv9 wv5 wi wi wc3
+      wc0 wi wc3 wc0 wi wi wi wn wi wc3 wc0 wi wc3 wc0 wi wv9 wv5 wi ax-g8 wc3
+      wc0 wi wv9 wv5 wi wi wc3 wc0 wi wc3 wc0 wi wi wi wn wc3 wc0 wi ax-1 ax-mp
+      wc3 wc0 wi wc3 wc0 wi wv9 wv5 wi wi wc3 wc0 wi wc3 wc0 wi wi wi wn wi wc3
+      wc0 wi ax-1 ax-mp wc3 wc0 wi wc3 wc0 wi wc3 wc0 wi wv9 wv5 wi wi wc3 wc0
+      wi wc3 wc0 wi wi wi wn wi wi wc7 wv8 wi wc3 wn wi wv2 wn wi ax-1 ax-mp
+      wc7 wv8 wi wc3 wn wi wv2 wn wi wc3 wc0 wi wc3 wc0 wi wc3 wc0 wi wv9 wv5
+      wi wi wc3 wc0 wi wc3 wc0 wi wi wi wn wi wi wi wv9 wv9 wc7 wi wi wc3 wi
+      ax-1 ax-mp $.
+  th367 $p |- ( ( v2 -> ( ( v3 -> v8 ) -> v2 ) ) -> ( -. ( ( v8 -> v6 ) -> ( v2 -> c6 ) ) -> ( ( v2 -> ( ( v3 -> v8 ) -> v2 ) ) -> ( -. ( v0 -> ( c3 -> c8 ) ) -> ( -. v0 -> ( ( c3 -> c8 ) -> v0 ) ) ) ) ) ) $=
+      ( wi wc6 wn wc3 wc8 ax-g9 ax-1 ax-mp ) EDFBGFFHZBCEFBFFZAIJFZFHAHPAFFFZFZ
+      FZOSFRSQRAPPAKQOLMRNLMSOLM $.
+  th368 $p |- ( ( ( ( c5 -> v5 ) -> ( v1 -> c5 ) ) -> ( c2 -> c7 ) ) -> ( ( v2 -> ( ( v6 -> c3 ) -> ( v5 -> c2 ) ) ) -> ( ( c5 -> ( v5 -> ( v7 -> v1 ) ) ) -> ( ( v5 -> ( c5 -> ( c1 -> v9 ) ) ) -> ( ( ( -. v0 -> c4 ) -> ( ( v0 -> v8 ) -> ( v1 -> c8 ) ) ) -> ( ( v2 -> ( ( v6 -> c3 ) -> ( v5 -> c2 ) ) ) -> ( ( ( ( v7 -> v7 ) -> -. v3 ) -> ( ( v7 -> c4 ) -> ( v3 -> c8 ) ) ) -> ( ( ( ( v3 -> c2 ) -> ( v7 -> v3 ) ) -> -. ( c6 -> c2 ) ) -> ( ( ( ( v7 -> v7 ) -> v7 ) -> ( c6 -> ( c2 -> c8 ) ) ) -> ( v7 -> ( -. c8 -> ( ( ( -. c2 -> ( c3 -> v3 ) ) -> c2 ) -> ( ( v7 -> v3 ) -> ( -. c8 -> ( v7 -> v3 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc3 wi wc2 wc5 wc1 wn wc4 wc8 wc6 wc7 th156 ax-1 ax-mp ) CFJKELKKKZMEGB
+      KKKZEMNIKKKZAOPKAHKBQKKKZUCGGKDOKGPKDQKKKDLKGDKKRLKOKGGKGKRLQKKKGQOLOJDKK
+      LKGDKQOGDKKKKKKKKKZKZKZKZKZKZMEKBMKKLSKKZULKUKULUJUKUIUJUHUIUGUHGGGDDDGDJ
+      TUGUCUAUBUHUFUAUBUIUEUAUBUJUDUAUBUKUCUAUBULUMUAUB $.
+  th369 $p |- ( c1 -> ( -. ( v8 -> ( v8 -> v6 ) ) -> ( v7 -> v7 ) ) ) $=
+      ( wi wn wc1 ax-g2 ax-1 ax-mp ) CCADDEZBBDZDZFLDKLKGKJHILFHI $.
+  th370 $p |- ( ( c3 -> c8 ) -> ( v6 -> ( ( ( c3 -> c8 ) -> ( ( v3 -> c0 ) -> v8 ) ) -> ( ( ( c3 -> c8 ) -> ( v3 -> c0 ) ) -> ( ( c3 -> c8 ) -> v8 ) ) ) ) ) $=
+      ( wc3 wc8 wi wc0 ax-2 ax-1 ax-mp ) BDEFZAGFZCFFKLFKCFFFZFZKNFMNKLCHMBIJNK
+      IJ $.
+  th371 $p |- ( ( ( c8 -> v4 ) -> ( ( v3 -> v3 ) -> ( v2 -> v3 ) ) ) -> ( ( ( ( v2 -> c2 ) -> ( v9 -> v5 ) ) -> ( ( v9 -> c7 ) -> ( c4 -> v9 ) ) ) -> ( ( v5 -> v2 ) -> ( ( v5 -> v2 ) -> ( c3 -> ( -. ( ( c3 -> v1 ) -> ( c3 -> c3 ) ) -> ( c9 -> ( -. ( ( c3 -> v1 ) -> ( c3 -> c3 ) ) -> ( ( c2 -> c9 ) -> ( c9 -> ( ( c2 -> c9 ) -> c9 ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc2 wi wc7 wc4 wc3 wn wc9 wc8 th146 ax-1 ax-mp ) BGHFEHHFIHJFHHHZEBHZSK
+      KAHKKHHLMKAHKKHHLGMHMGMHMHHHHHHZHZHZHZHZNDHCCHBCHHHZUDHUCUDUBUCUAUBTUAMMK
+      AKOTKPQUASPQUBSPQUCRPQUDUEPQ $.
+  th372 $p |- ( c5 -> ( c8 -> ( ( ( v6 -> ( v4 -> v9 ) ) -> ( v2 -> ( c2 -> v3 ) ) ) -> ( c9 -> ( ( ( ( v4 -> v8 ) -> ( v0 -> v2 ) ) -> ( -. c3 -> ( v2 -> v5 ) ) ) -> ( c8 -> ( ( c5 -> v0 ) -> ( ( c5 -> v0 ) -> ( ( ( ( c4 -> v0 ) -> ( v8 -> v2 ) ) -> c5 ) -> ( -. ( ( v2 -> c8 ) -> ( c8 -> v9 ) ) -> ( -. ( ( v2 -> c8 ) -> ( c8 -> v9 ) ) -> ( ( ( c3 -> ( v0 -> v2 ) ) -> v0 ) -> ( c5 -> v0 ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wv7 wi wc5 wc8 wc2 wc9 wc3 wn wc4 ax-1 th363 ax-mp ) IIIJJZKLFDHJJBMCJJ
+      JZNDGJABJJOPBEJJJZLKAJKAJQAJGBJJKJBLJLHJJPBLJLHJJPOABJJAJKAJJJJJJJZJZJZJZ
+      JZJZJZIIRUJUAUJJUIUJUHUIUGUHUFUGUEUFUDUELLABHGKASUDLRTUEUCRTUFNRTUGUBRTUH
+      LRTUIKRTUJUARTT $.
+  th373 $p |- ( ( ( v6 -> v2 ) -> ( -. c2 -> ( v4 -> v5 ) ) ) -> ( -. v6 -> ( v2 -> ( v2 -> ( v3 -> v5 ) ) ) ) ) $=
+      ( wn wi wc2 ax-g6 ax-1 ax-mp ) EFZAABDGZGZGZGZEAGHFCDGGGZPGOPNOMNMIMAJKNA
+      JKOLJKPQJK $.
+  th374 $p |- ( v6 -> ( -. ( ( v7 -> v0 ) -> -. v9 ) -> ( ( ( c7 -> -. v7 ) -> -. ( v5 -> v0 ) ) -> ( ( c5 -> ( v5 -> ( c6 -> v3 ) ) ) -> ( ( ( ( v1 -> v9 ) -> ( v1 -> v8 ) ) -> ( -. v3 -> ( c3 -> c5 ) ) ) -> ( ( ( ( v7 -> v8 ) -> c2 ) -> ( ( c4 -> v2 ) -> v8 ) ) -> -. v9 ) ) ) ) ) ) $=
+      wv4 wv4 wv4 wi wi wv6 wv7 wv0 wi wv9 wn wi wn wc7 wv7 wn wi wv5 wv0 wi wn
+      wi wc5 wv5 wc6 wv3 wi wi wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi wi
+      wi wv7 wv8 wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wi wi wi wi wi wv4
+      wv4 ax-1 wv6 wv7 wv0 wi wv9 wn wi wn wc7 wv7 wn wi wv5 wv0 wi wn wi wc5
+      wv5 wc6 wv3 wi wi wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi wi wi wv7
+      wv8 wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wi wi wi wi wi wv4 wv4 wv4
+      wi wi wv6 wv7 wv0 wi wv9 wn wi wn wc7 wv7 wn wi wv5 wv0 wi wn wi wc5 wv5
+      wc6 wv3 wi wi wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi wi wi wv7 wv8
+      wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wi wi wi wi wi wi wv7 wv0 wi wv9
+      wn wi wn wc7 wv7 wn wi wv5 wv0 wi wn wi wc5 wv5 wc6 wv3 wi wi wi wv1 wv9
+      wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi wi wi wv7 wv8 wi wc2 wi wc4 wv2 wi wv8
+      wi wi wv9 wn wi wi wi wi wi wv6 wv7 wv0 wi wv9 wn wi wn wc7 wv7 wn wi wv5
+      wv0 wi wn wi wc5 wv5 wc6 wv3 wi wi wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3
+      wc5 wi wi wi wv7 wv8 wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wi wi wi wi
+      wi wc7 wv7 wn wi wv5 wv0 wi wn wi wc5 wv5 wc6 wv3 wi wi wi wv1 wv9 wi wv1
+      wv8 wi wi wv3 wn wc3 wc5 wi wi wi wv7 wv8 wi wc2 wi wc4 wv2 wi wv8 wi wi
+      wv9 wn wi wi wi wi wv7 wv0 wi wv9 wn wi wn wc7 wv7 wn wi wv5 wv0 wi wn wi
+      wc5 wv5 wc6 wv3 wi wi wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi wi wi
+      wv7 wv8 wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wi wi wi wi wc5 wv5 wc6
+      wv3 wi wi wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi wi wi wv7 wv8 wi
+      wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wi wi wc7 wv7 wn wi wv5 wv0 wi wn
+      wi wc5 wv5 wc6 wv3 wi wi wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi wi
+      wi wv7 wv8 wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wi wi wi wv1 wv9 wi
+      wv1 wv8 wi wi wv3 wn wc3 wc5 wi wi wi wv7 wv8 wi wc2 wi wc4 wv2 wi wv8 wi
+      wi wv9 wn wi wi wc5 wv5 wc6 wv3 wi wi wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn
+      wc3 wc5 wi wi wi wv7 wv8 wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wi wi
+      wv7 wv8 wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wv1 wv9 wi wv1 wv8 wi wi
+      wv3 wn wc3 wc5 wi wi wi wv7 wv8 wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi
+      wi wv9 wn wv7 wv8 wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wv9 ax-g5 wv9
+      wn wv7 wv8 wi wc2 wi wc4 wv2 wi wv8 wi wi ax-1 ax-mp wv7 wv8 wi wc2 wi
+      wc4 wv2 wi wv8 wi wi wv9 wn wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi
+      wi wi ax-1 ax-mp wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi wi wi wv7 wv8
+      wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wi wc5 wv5 wc6 wv3 wi wi wi ax-1
+      ax-mp wc5 wv5 wc6 wv3 wi wi wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi
+      wi wi wv7 wv8 wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wi wi wc7 wv7 wn
+      wi wv5 wv0 wi wn wi ax-1 ax-mp wc7 wv7 wn wi wv5 wv0 wi wn wi wc5 wv5 wc6
+      wv3 wi wi wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi wi wi wv7 wv8 wi
+      wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wi wi wi wv7 wv0 wi wv9 wn wi wn
+      ax-1 ax-mp wv7 wv0 wi wv9 wn wi wn wc7 wv7 wn wi wv5 wv0 wi wn wi wc5 wv5
+      wc6 wv3 wi wi wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi wi wi wv7 wv8
+      wi wc2 wi wc4 wv2 wi wv8 wi wi wv9 wn wi wi wi wi wi wv6 ax-1 ax-mp wv6
+      wv7 wv0 wi wv9 wn wi wn wc7 wv7 wn wi wv5 wv0 wi wn wi wc5 wv5 wc6 wv3 wi
+      wi wi wv1 wv9 wi wv1 wv8 wi wi wv3 wn wc3 wc5 wi wi wi wv7 wv8 wi wc2 wi
+      wc4 wv2 wi wv8 wi wi wv9 wn wi wi wi wi wi wi wv4 wv4 wv4 wi wi ax-1
+      ax-mp ax-mp $.
+  th375 $p |- ( v7 -> -. v3 ) $=
+      ( wn wi ax-g5 ax-1 ax-mp ) ACZBHDAEHBFG $.
+  th376 $p |- ( ( ( v0 -> v9 ) -> ( ( c3 -> v8 ) -> ( v3 -> v1 ) ) ) -> ( ( ( ( c3 -> v3 ) -> ( v6 -> c4 ) ) -> c9 ) -> ( -. ( -. v0 -> ( v3 -> v7 ) ) -> ( -. ( v8 -> c3 ) -> ( -. v7 -> ( ( -. ( v9 -> c1 ) -> v7 ) -> ( -. -. ( v7 -> c3 ) -> ( -. ( v3 -> ( v6 -> v9 ) ) -> ( ( v4 -> ( ( v2 -> v8 ) -> v6 ) ) -> ( v7 -> ( ( ( v4 -> v3 ) -> ( ( v4 -> v3 ) -> ( v3 -> c9 ) ) ) -> ( ( ( v4 -> v3 ) -> ( v4 -> v3 ) ) -> ( ( v4 -> v3 ) -> ( v3 -> c9 ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wc3 wv3 wi wv6 wc4 wi wi wc9 wi wv0 wn wv3 wv7 wi wi wn wv8 wc3 wi wn wv7
+      wn wv9 wc1 wi wn wv7 wi wv7 wc3 wi wn wn wv3 wv6 wv9 wi wi wn wv4 wv2 wv8
+      wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4
+      wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi wi wi wi wi wi wi wi wi wi wi wv0
+      wv9 wi wc3 wv8 wi wv3 wv1 wi wi wi wc3 wv3 wi wv6 wc4 wi wi wc9 wi wv0 wn
+      wv3 wv7 wi wi wn wv8 wc3 wi wn wv7 wn wv9 wc1 wi wn wv7 wi wv7 wc3 wi wn
+      wn wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3
+      wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi
+      wi wi wi wi wi wi wi wi wi wi wi wv0 wn wv3 wv7 wi wi wn wv8 wc3 wi wn
+      wv7 wn wv9 wc1 wi wn wv7 wi wv7 wc3 wi wn wn wv3 wv6 wv9 wi wi wn wv4 wv2
+      wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi
+      wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi wi wi wi wi wi wi wi wi wi wc3
+      wv3 wi wv6 wc4 wi wi wc9 wi wv0 wn wv3 wv7 wi wi wn wv8 wc3 wi wn wv7 wn
+      wv9 wc1 wi wn wv7 wi wv7 wc3 wi wn wn wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi
+      wv6 wi wi wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3
+      wi wi wv4 wv3 wi wv3 wc9 wi wi wi wi wi wi wi wi wi wi wi wi wi wv8 wc3
+      wi wn wv7 wn wv9 wc1 wi wn wv7 wi wv7 wc3 wi wn wn wv3 wv6 wv9 wi wi wn
+      wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9 wi wi wi wv4
+      wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi wi wi wi wi wi wi wi wi
+      wv0 wn wv3 wv7 wi wi wn wv8 wc3 wi wn wv7 wn wv9 wc1 wi wn wv7 wi wv7 wc3
+      wi wn wn wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4
+      wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi
+      wi wi wi wi wi wi wi wi wi wi wv7 wn wv9 wc1 wi wn wv7 wi wv7 wc3 wi wn
+      wn wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3
+      wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi
+      wi wi wi wi wi wi wi wv8 wc3 wi wn wv7 wn wv9 wc1 wi wn wv7 wi wv7 wc3 wi
+      wn wn wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4
+      wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi
+      wi wi wi wi wi wi wi wi wi wv9 wc1 wi wn wv7 wi wv7 wc3 wi wn wn wv3 wv6
+      wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9
+      wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi wi wi wi wi
+      wi wi wv7 wn wv9 wc1 wi wn wv7 wi wv7 wc3 wi wn wn wv3 wv6 wv9 wi wi wn
+      wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9 wi wi wi wv4
+      wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi wi wi wi wi wi wi wi wv7
+      wc3 wi wn wn wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi
+      wv4 wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9
+      wi wi wi wi wi wi wi wi wv9 wc1 wi wn wv7 wi wv7 wc3 wi wn wn wv3 wv6 wv9
+      wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9 wi wi
+      wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi wi wi wi wi wi wi
+      wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3 wi
+      wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi wi
+      wi wi wi wv7 wc3 wi wn wn wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi
+      wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4
+      wv3 wi wv3 wc9 wi wi wi wi wi wi wi wi wv4 wv2 wv8 wi wv6 wi wi wv7 wv4
+      wv3 wi wv4 wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi
+      wv3 wc9 wi wi wi wi wi wi wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi
+      wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4
+      wv3 wi wv3 wc9 wi wi wi wi wi wi wi wv2 wv7 wv3 wv6 wc9 wv4 wv8 th365 wv4
+      wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9 wi wi wi wv4 wv3
+      wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi wi wi wi wv3 wv6 wv9 wi wi
+      wn ax-1 ax-mp wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3
+      wi wv4 wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3
+      wc9 wi wi wi wi wi wi wi wv7 wc3 wi wn wn ax-1 ax-mp wv7 wc3 wi wn wn wv3
+      wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3 wi wv3
+      wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi wi wi
+      wi wi wi wv9 wc1 wi wn wv7 wi ax-1 ax-mp wv9 wc1 wi wn wv7 wi wv7 wc3 wi
+      wn wn wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4
+      wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi
+      wi wi wi wi wi wi wi wv7 wn ax-1 ax-mp wv7 wn wv9 wc1 wi wn wv7 wi wv7
+      wc3 wi wn wn wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi
+      wv4 wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9
+      wi wi wi wi wi wi wi wi wi wi wv8 wc3 wi wn ax-1 ax-mp wv8 wc3 wi wn wv7
+      wn wv9 wc1 wi wn wv7 wi wv7 wc3 wi wn wn wv3 wv6 wv9 wi wi wn wv4 wv2 wv8
+      wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4
+      wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi wi wi wi wi wi wi wi wi wv0 wn wv3
+      wv7 wi wi wn ax-1 ax-mp wv0 wn wv3 wv7 wi wi wn wv8 wc3 wi wn wv7 wn wv9
+      wc1 wi wn wv7 wi wv7 wc3 wi wn wn wv3 wv6 wv9 wi wi wn wv4 wv2 wv8 wi wv6
+      wi wi wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9 wi wi wi wv4 wv3 wi wv4 wv3 wi wi
+      wv4 wv3 wi wv3 wc9 wi wi wi wi wi wi wi wi wi wi wi wi wc3 wv3 wi wv6 wc4
+      wi wi wc9 wi ax-1 ax-mp wc3 wv3 wi wv6 wc4 wi wi wc9 wi wv0 wn wv3 wv7 wi
+      wi wn wv8 wc3 wi wn wv7 wn wv9 wc1 wi wn wv7 wi wv7 wc3 wi wn wn wv3 wv6
+      wv9 wi wi wn wv4 wv2 wv8 wi wv6 wi wi wv7 wv4 wv3 wi wv4 wv3 wi wv3 wc9
+      wi wi wi wv4 wv3 wi wv4 wv3 wi wi wv4 wv3 wi wv3 wc9 wi wi wi wi wi wi wi
+      wi wi wi wi wi wi wv0 wv9 wi wc3 wv8 wi wv3 wv1 wi wi wi ax-1 ax-mp $.
+  th377 $p |- ( -. -. ( v6 -> c7 ) -> -. ( ( ( v1 -> v5 ) -> ( v9 -> v0 ) ) -> ( ( v1 -> v5 ) -> ( v1 -> v5 ) ) ) ) $=
+      wv1 wv5 wi wv9 wv0 wi wi wv1 wv5 wi wv1 wv5 wi wi wi wn wv6 wc7 wi wn wn
+      wv1 wv5 wi wv9 wv0 wi wi wv1 wv5 wi wv1 wv5 wi wi wi wn wi wv1 wv5 wi wv1
+      wv5 wi wv9 wv0 wi ax-g8 wv1 wv5 wi wv9 wv0 wi wi wv1 wv5 wi wv1 wv5 wi wi
+      wi wn wv6 wc7 wi wn wn ax-1 ax-mp $.
+  th378 $p |- ( ( -. v6 -> v2 ) -> ( v3 -> ( v3 -> v4 ) ) ) $=
+      wv3 wv3 wv4 wi wi wv6 wn wv2 wi wv3 wv3 wv4 wi wi wi wv3 wv4 wi wv3 wv3
+      wv4 wi wi wv4 wv3 wv4 wi wv4 ax-g6 wv4 wv3 ax-1 ax-mp wv3 wv4 wi wv3 ax-1
+      ax-mp wv3 wv3 wv4 wi wi wv6 wn wv2 wi ax-1 ax-mp $.
+  th379 $p |- ( ( c4 -> ( c5 -> -. v1 ) ) -> -. ( c3 -> v6 ) ) $=
+      wc3 wv6 wi wn wc4 wc5 wv1 wn wi wi wc3 wv6 wi wn wi wc3 wv6 wi ax-g5 wc3
+      wv6 wi wn wc4 wc5 wv1 wn wi wi ax-1 ax-mp $.
+  th380 $p |- ( ( ( ( v8 -> v4 ) -> ( v6 -> v3 ) ) -> v0 ) -> ( c7 -> ( ( v1 -> v3 ) -> ( c7 -> ( ( ( ( v8 -> v4 ) -> ( v6 -> v3 ) ) -> v0 ) -> ( -. ( v6 -> -. v1 ) -> ( v6 -> ( v1 -> v3 ) ) ) ) ) ) ) ) $=
+      wc7 wv1 wv3 wi wc7 wv8 wv4 wi wv6 wv3 wi wi wv0 wi wv6 wv1 wn wi wn wv6
+      wv1 wv3 wi wi wi wi wi wi wi wv8 wv4 wi wv6 wv3 wi wi wv0 wi wc7 wv1 wv3
+      wi wc7 wv8 wv4 wi wv6 wv3 wi wi wv0 wi wv6 wv1 wn wi wn wv6 wv1 wv3 wi wi
+      wi wi wi wi wi wi wv1 wv3 wi wc7 wv8 wv4 wi wv6 wv3 wi wi wv0 wi wv6 wv1
+      wn wi wn wv6 wv1 wv3 wi wi wi wi wi wi wc7 wv1 wv3 wi wc7 wv8 wv4 wi wv6
+      wv3 wi wi wv0 wi wv6 wv1 wn wi wn wv6 wv1 wv3 wi wi wi wi wi wi wi wc7
+      wv8 wv4 wi wv6 wv3 wi wi wv0 wi wv6 wv1 wn wi wn wv6 wv1 wv3 wi wi wi wi
+      wi wv1 wv3 wi wc7 wv8 wv4 wi wv6 wv3 wi wi wv0 wi wv6 wv1 wn wi wn wv6
+      wv1 wv3 wi wi wi wi wi wi wv8 wv4 wi wv6 wv3 wi wi wv0 wi wv6 wv1 wn wi
+      wn wv6 wv1 wv3 wi wi wi wi wc7 wv8 wv4 wi wv6 wv3 wi wi wv0 wi wv6 wv1 wn
+      wi wn wv6 wv1 wv3 wi wi wi wi wi wv6 wv1 wn wi wn wv6 wv1 wv3 wi wi wi
+      wv8 wv4 wi wv6 wv3 wi wi wv0 wi wv6 wv1 wn wi wn wv6 wv1 wv3 wi wi wi wi
+      wv6 wv1 wv3 wi wi wv6 wv1 wn wi wn wv6 wv1 wv3 wi wi wi wv1 wv3 wi wv6
+      wv1 wv3 wi wi wv1 wv3 wi ax-g4 wv1 wv3 wi wv6 ax-1 ax-mp wv6 wv1 wv3 wi
+      wi wv6 wv1 wn wi wn ax-1 ax-mp wv6 wv1 wn wi wn wv6 wv1 wv3 wi wi wi wv8
+      wv4 wi wv6 wv3 wi wi wv0 wi ax-1 ax-mp wv8 wv4 wi wv6 wv3 wi wi wv0 wi
+      wv6 wv1 wn wi wn wv6 wv1 wv3 wi wi wi wi wc7 ax-1 ax-mp wc7 wv8 wv4 wi
+      wv6 wv3 wi wi wv0 wi wv6 wv1 wn wi wn wv6 wv1 wv3 wi wi wi wi wi wv1 wv3
+      wi ax-1 ax-mp wv1 wv3 wi wc7 wv8 wv4 wi wv6 wv3 wi wi wv0 wi wv6 wv1 wn
+      wi wn wv6 wv1 wv3 wi wi wi wi wi wi wc7 ax-1 ax-mp wc7 wv1 wv3 wi wc7 wv8
+      wv4 wi wv6 wv3 wi wi wv0 wi wv6 wv1 wn wi wn wv6 wv1 wv3 wi wi wi wi wi
+      wi wi wv8 wv4 wi wv6 wv3 wi wi wv0 wi ax-1 ax-mp $.
+  th381 $p |- ( c9 -> ( ( ( -. v6 -> v1 ) -> ( ( v6 -> c5 ) -> ( v9 -> c2 ) ) ) -> ( -. c7 -> ( ( v4 -> v4 ) -> ( ( ( ( c2 -> v1 ) -> -. v0 ) -> ( ( v1 -> c2 ) -> v7 ) ) -> ( ( ( v4 -> ( c5 -> c2 ) ) -> ( v4 -> ( v7 -> v7 ) ) ) -> -. ( ( c7 -> -. c7 ) -> ( v7 -> v7 ) ) ) ) ) ) ) ) $=
+      wv6 wn wv1 wi wv6 wc5 wi wv9 wc2 wi wi wi wc7 wn wv4 wv4 wi wc2 wv1 wi
+      wv0 wn wi wv1 wc2 wi wv7 wi wi wv4 wc5 wc2 wi wi wv4 wv7 wv7 wi wi wi wc7
+      wc7 wn wi wv7 wv7 wi wi wn wi wi wi wi wi wc9 wv6 wn wv1 wi wv6 wc5 wi
+      wv9 wc2 wi wi wi wc7 wn wv4 wv4 wi wc2 wv1 wi wv0 wn wi wv1 wc2 wi wv7 wi
+      wi wv4 wc5 wc2 wi wi wv4 wv7 wv7 wi wi wi wc7 wc7 wn wi wv7 wv7 wi wi wn
+      wi wi wi wi wi wi wc7 wn wv4 wv4 wi wc2 wv1 wi wv0 wn wi wv1 wc2 wi wv7
+      wi wi wv4 wc5 wc2 wi wi wv4 wv7 wv7 wi wi wi wc7 wc7 wn wi wv7 wv7 wi wi
+      wn wi wi wi wi wv6 wn wv1 wi wv6 wc5 wi wv9 wc2 wi wi wi wc7 wn wv4 wv4
+      wi wc2 wv1 wi wv0 wn wi wv1 wc2 wi wv7 wi wi wv4 wc5 wc2 wi wi wv4 wv7
+      wv7 wi wi wi wc7 wc7 wn wi wv7 wv7 wi wi wn wi wi wi wi wi wv4 wv4 wi wc2
+      wv1 wi wv0 wn wi wv1 wc2 wi wv7 wi wi wv4 wc5 wc2 wi wi wv4 wv7 wv7 wi wi
+      wi wc7 wc7 wn wi wv7 wv7 wi wi wn wi wi wi wc7 wn wv4 wv4 wi wc2 wv1 wi
+      wv0 wn wi wv1 wc2 wi wv7 wi wi wv4 wc5 wc2 wi wi wv4 wv7 wv7 wi wi wi wc7
+      wc7 wn wi wv7 wv7 wi wi wn wi wi wi wi wc2 wv1 wi wv0 wn wi wv1 wc2 wi
+      wv7 wi wi wv4 wc5 wc2 wi wi wv4 wv7 wv7 wi wi wi wc7 wc7 wn wi wv7 wv7 wi
+      wi wn wi wi wv4 wv4 wi wc2 wv1 wi wv0 wn wi wv1 wc2 wi wv7 wi wi wv4 wc5
+      wc2 wi wi wv4 wv7 wv7 wi wi wi wc7 wc7 wn wi wv7 wv7 wi wi wn wi wi wi
+      wv4 wc5 wc2 wi wi wv4 wv7 wv7 wi wi wi wc7 wc7 wn wi wv7 wv7 wi wi wn wi
+      wc2 wv1 wi wv0 wn wi wv1 wc2 wi wv7 wi wi wv4 wc5 wc2 wi wi wv4 wv7 wv7
+      wi wi wi wc7 wc7 wn wi wv7 wv7 wi wi wn wi wi wc7 wc7 wn wi wv7 wv7 wi wi
+      wn wv4 wc5 wc2 wi wi wv4 wv7 wv7 wi wi wi wc7 wc7 wn wi wv7 wv7 wi wi wn
+      wi wc7 wv7 wc7 wn ax-g8 wc7 wc7 wn wi wv7 wv7 wi wi wn wv4 wc5 wc2 wi wi
+      wv4 wv7 wv7 wi wi wi ax-1 ax-mp wv4 wc5 wc2 wi wi wv4 wv7 wv7 wi wi wi
+      wc7 wc7 wn wi wv7 wv7 wi wi wn wi wc2 wv1 wi wv0 wn wi wv1 wc2 wi wv7 wi
+      wi ax-1 ax-mp wc2 wv1 wi wv0 wn wi wv1 wc2 wi wv7 wi wi wv4 wc5 wc2 wi wi
+      wv4 wv7 wv7 wi wi wi wc7 wc7 wn wi wv7 wv7 wi wi wn wi wi wv4 wv4 wi ax-1
+      ax-mp wv4 wv4 wi wc2 wv1 wi wv0 wn wi wv1 wc2 wi wv7 wi wi wv4 wc5 wc2 wi
+      wi wv4 wv7 wv7 wi wi wi wc7 wc7 wn wi wv7 wv7 wi wi wn wi wi wi wc7 wn
+      ax-1 ax-mp wc7 wn wv4 wv4 wi wc2 wv1 wi wv0 wn wi wv1 wc2 wi wv7 wi wi
+      wv4 wc5 wc2 wi wi wv4 wv7 wv7 wi wi wi wc7 wc7 wn wi wv7 wv7 wi wi wn wi
+      wi wi wi wv6 wn wv1 wi wv6 wc5 wi wv9 wc2 wi wi wi ax-1 ax-mp wv6 wn wv1
+      wi wv6 wc5 wi wv9 wc2 wi wi wi wc7 wn wv4 wv4 wi wc2 wv1 wi wv0 wn wi wv1
+      wc2 wi wv7 wi wi wv4 wc5 wc2 wi wi wv4 wv7 wv7 wi wi wi wc7 wc7 wn wi wv7
+      wv7 wi wi wn wi wi wi wi wi wc9 ax-1 ax-mp $.
+  th382 $p |- ( -. ( ( c0 -> c1 ) -> v0 ) -> ( ( v3 -> ( ( c0 -> v7 ) -> c6 ) ) -> ( v4 -> ( -. ( ( c0 -> c3 ) -> -. v8 ) -> ( ( -. -. v1 -> -. ( v1 -> c2 ) ) -> ( v6 -> ( ( ( ( v3 -> c0 ) -> ( c3 -> v3 ) ) -> c3 ) -> ( ( ( ( c3 -> v1 ) -> ( v2 -> v6 ) ) -> ( ( c4 -> c4 ) -> ( v9 -> v4 ) ) ) -> ( c9 -> ( v6 -> ( c9 -> ( c4 -> ( c0 -> ( v6 -> ( c9 -> ( ( v6 -> ( v6 -> c0 ) ) -> ( ( v6 -> v6 ) -> ( v6 -> c0 ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wc0 wi wc6 wc3 wn wc2 wc4 wc9 wc1 th19 ax-1 ax-mp ) DJGKLKKZEJMKHNKNZBN
+      NBOKNKZFDJKMDKKMKZMBKCFKKPPKIEKKKZQFQPJFQFFJKKFFKFJKKKKKKKKKKZKZKZKZKZKZK
+      ZKZJRKAKNZUNKUMUNULUMUKULUJUKUIUJUHUIUGUHFQFPSUGUFTUAUHUETUAUIFTUAUJUDTUA
+      UKUCTUAULETUAUMUBTUAUNUOTUA $.
+  th383 $p |- ( c3 -> ( ( ( c3 -> ( c6 -> v2 ) ) -> ( -. v8 -> ( v5 -> v7 ) ) ) -> ( c2 -> ( v6 -> ( ( -. ( v8 -> c7 ) -> ( -. v6 -> ( v4 -> v8 ) ) ) -> ( -. ( c4 -> v3 ) -> ( v3 -> v3 ) ) ) ) ) ) ) $=
+      ( wc3 wc6 wi wn wc2 wc7 wc4 ax-g4 ax-1 ax-mp ) HIAJJGKDFJJJZLEGMJKEKCGJJJ
+      ZNBJKZBBJZJZJZJZJZJZHUFJUEUFUDUEUCUDUBUCUAUBUAOUATPQUBSPQUCEPQUDLPQUERPQU
+      FHPQ $.
+  th384 $p |- ( ( ( -. v7 -> -. v0 ) -> v6 ) -> ( ( v8 -> v3 ) -> ( ( v8 -> v3 ) -> ( ( ( v8 -> v3 ) -> ( ( v2 -> v1 ) -> ( v2 -> v1 ) ) ) -> ( ( ( v8 -> v3 ) -> ( v2 -> v1 ) ) -> ( ( v8 -> v3 ) -> ( v2 -> v1 ) ) ) ) ) ) ) $=
+      wv8 wv3 wi wv8 wv3 wi wv8 wv3 wi wv2 wv1 wi wv2 wv1 wi wi wi wv8 wv3 wi
+      wv2 wv1 wi wi wv8 wv3 wi wv2 wv1 wi wi wi wi wi wi wv7 wn wv0 wn wi wv6
+      wi wv8 wv3 wi wv8 wv3 wi wv8 wv3 wi wv2 wv1 wi wv2 wv1 wi wi wi wv8 wv3
+      wi wv2 wv1 wi wi wv8 wv3 wi wv2 wv1 wi wi wi wi wi wi wi wv8 wv3 wi wv8
+      wv3 wi wv2 wv1 wi wv2 wv1 wi wi wi wv8 wv3 wi wv2 wv1 wi wi wv8 wv3 wi
+      wv2 wv1 wi wi wi wi wi wv8 wv3 wi wv8 wv3 wi wv8 wv3 wi wv2 wv1 wi wv2
+      wv1 wi wi wi wv8 wv3 wi wv2 wv1 wi wi wv8 wv3 wi wv2 wv1 wi wi wi wi wi
+      wi wv8 wv3 wi wv2 wv1 wi wv2 wv1 wi wi wi wv8 wv3 wi wv2 wv1 wi wi wv8
+      wv3 wi wv2 wv1 wi wi wi wi wv8 wv3 wi wv8 wv3 wi wv2 wv1 wi wv2 wv1 wi wi
+      wi wv8 wv3 wi wv2 wv1 wi wi wv8 wv3 wi wv2 wv1 wi wi wi wi wi wv8 wv3 wi
+      wv2 wv1 wi wv2 wv1 wi ax-2 wv8 wv3 wi wv2 wv1 wi wv2 wv1 wi wi wi wv8 wv3
+      wi wv2 wv1 wi wi wv8 wv3 wi wv2 wv1 wi wi wi wi wv8 wv3 wi ax-1 ax-mp wv8
+      wv3 wi wv8 wv3 wi wv2 wv1 wi wv2 wv1 wi wi wi wv8 wv3 wi wv2 wv1 wi wi
+      wv8 wv3 wi wv2 wv1 wi wi wi wi wi wv8 wv3 wi ax-1 ax-mp wv8 wv3 wi wv8
+      wv3 wi wv8 wv3 wi wv2 wv1 wi wv2 wv1 wi wi wi wv8 wv3 wi wv2 wv1 wi wi
+      wv8 wv3 wi wv2 wv1 wi wi wi wi wi wi wv7 wn wv0 wn wi wv6 wi ax-1 ax-mp
+      $.
+  th385 $p |- ( ( ( -. v9 -> ( v9 -> v0 ) ) -> ( ( v5 -> v3 ) -> ( v7 -> v3 ) ) ) -> ( ( v2 -> ( -. v2 -> ( c0 -> c3 ) ) ) -> ( -. c3 -> ( -. ( ( v2 -> v6 ) -> -. c9 ) -> ( ( ( -. c6 -> ( c8 -> v1 ) ) -> c5 ) -> ( ( ( -. c6 -> ( c8 -> v1 ) ) -> c5 ) -> ( c2 -> ( c8 -> ( ( ( c4 -> c3 ) -> ( ( v6 -> v5 ) -> ( c4 -> v7 ) ) ) -> ( ( ( c4 -> c3 ) -> ( v6 -> v5 ) ) -> ( ( c4 -> c3 ) -> ( c4 -> v7 ) ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wn wc0 wc3 wi wc9 wc6 wc8 wc5 wc2 wc4 ax-2 ax-1 ax-mp ) CCIJKLLLZKIZCFL
+      MILIZNIOBLLPLZUEQORKLZFELZRGLZLLUFUGLUFUHLLLZLZLZLZLZLZLZLZHIHALLEDLGDLLL
+      ZUPLUOUPUNUOUMUNULUMUKULUJUKUIUJUFUGUHSUIOTUAUJQTUAUKUETUAULUETUAUMUDTUAU
+      NUCTUAUOUBTUAUPUQTUA $.
+  th386 $p |- ( ( v9 -> ( ( v3 -> v3 ) -> v8 ) ) -> ( ( ( ( v6 -> v8 ) -> -. v5 ) -> ( ( v0 -> c4 ) -> ( c5 -> v7 ) ) ) -> ( -. ( c4 -> ( v8 -> v3 ) ) -> ( v8 -> v3 ) ) ) ) $=
+      ( wi wn wc4 wc5 ax-g1 ax-1 ax-mp ) DFHCIHAJHKEHHHZJFBHZHIPHZHZGBBHFHHZRHQ
+      RPPJLQOMNRSMN $.
+  th387 $p |- ( ( -. ( v2 -> v7 ) -> v7 ) -> ( -. v1 -> ( ( c6 -> v1 ) -> ( ( ( -. c4 -> ( v5 -> v0 ) ) -> ( ( v8 -> v2 ) -> ( c9 -> v6 ) ) ) -> ( -. v1 -> ( ( c6 -> v1 ) -> ( -. v1 -> ( ( c6 -> v1 ) -> ( c2 -> ( c9 -> -. c3 ) ) ) ) ) ) ) ) ) ) $=
+      wv1 wn wc6 wv1 wi wc4 wn wv5 wv0 wi wi wv8 wv2 wi wc9 wv6 wi wi wi wv1 wn
+      wc6 wv1 wi wv1 wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wi wi wi wi wi wi
+      wv2 wv7 wi wn wv7 wi wv1 wn wc6 wv1 wi wc4 wn wv5 wv0 wi wi wv8 wv2 wi
+      wc9 wv6 wi wi wi wv1 wn wc6 wv1 wi wv1 wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi
+      wi wi wi wi wi wi wi wi wc6 wv1 wi wc4 wn wv5 wv0 wi wi wv8 wv2 wi wc9
+      wv6 wi wi wi wv1 wn wc6 wv1 wi wv1 wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi
+      wi wi wi wi wi wv1 wn wc6 wv1 wi wc4 wn wv5 wv0 wi wi wv8 wv2 wi wc9 wv6
+      wi wi wi wv1 wn wc6 wv1 wi wv1 wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wi
+      wi wi wi wi wi wc4 wn wv5 wv0 wi wi wv8 wv2 wi wc9 wv6 wi wi wi wv1 wn
+      wc6 wv1 wi wv1 wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wi wi wi wi wc6 wv1
+      wi wc4 wn wv5 wv0 wi wi wv8 wv2 wi wc9 wv6 wi wi wi wv1 wn wc6 wv1 wi wv1
+      wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wi wi wi wi wi wv1 wn wc6 wv1 wi
+      wv1 wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wi wi wi wc4 wn wv5 wv0 wi wi
+      wv8 wv2 wi wc9 wv6 wi wi wi wv1 wn wc6 wv1 wi wv1 wn wc6 wv1 wi wc2 wc9
+      wc3 wn wi wi wi wi wi wi wi wc6 wv1 wi wv1 wn wc6 wv1 wi wc2 wc9 wc3 wn
+      wi wi wi wi wi wv1 wn wc6 wv1 wi wv1 wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi
+      wi wi wi wi wv1 wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wi wc6 wv1 wi wv1
+      wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wi wi wc6 wv1 wi wc2 wc9 wc3 wn wi
+      wi wi wv1 wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wi wc2 wc9 wc3 wn wi wi
+      wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi th174 wc2 wc9 wc3 wn wi wi wc6 wv1 wi
+      ax-1 ax-mp wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wv1 wn ax-1 ax-mp wv1 wn
+      wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wi wc6 wv1 wi ax-1 ax-mp wc6 wv1 wi
+      wv1 wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wi wi wv1 wn ax-1 ax-mp wv1 wn
+      wc6 wv1 wi wv1 wn wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wi wi wi wc4 wn wv5
+      wv0 wi wi wv8 wv2 wi wc9 wv6 wi wi wi ax-1 ax-mp wc4 wn wv5 wv0 wi wi wv8
+      wv2 wi wc9 wv6 wi wi wi wv1 wn wc6 wv1 wi wv1 wn wc6 wv1 wi wc2 wc9 wc3
+      wn wi wi wi wi wi wi wi wc6 wv1 wi ax-1 ax-mp wc6 wv1 wi wc4 wn wv5 wv0
+      wi wi wv8 wv2 wi wc9 wv6 wi wi wi wv1 wn wc6 wv1 wi wv1 wn wc6 wv1 wi wc2
+      wc9 wc3 wn wi wi wi wi wi wi wi wi wv1 wn ax-1 ax-mp wv1 wn wc6 wv1 wi
+      wc4 wn wv5 wv0 wi wi wv8 wv2 wi wc9 wv6 wi wi wi wv1 wn wc6 wv1 wi wv1 wn
+      wc6 wv1 wi wc2 wc9 wc3 wn wi wi wi wi wi wi wi wi wi wv2 wv7 wi wn wv7 wi
+      ax-1 ax-mp $.
+  th388 $p |- ( v7 -> ( -. ( v3 -> ( v9 -> c7 ) ) -> ( ( c1 -> v1 ) -> ( -. c5 -> ( -. ( -. c1 -> -. c5 ) -> ( -. ( c1 -> v3 ) -> ( ( c1 -> v1 ) -> ( c1 -> v3 ) ) ) ) ) ) ) ) $=
+      wv3 wv9 wc7 wi wi wn wc1 wv1 wi wc5 wn wc1 wn wc5 wn wi wn wc1 wv3 wi wn
+      wc1 wv1 wi wc1 wv3 wi wi wi wi wi wi wi wv7 wv3 wv9 wc7 wi wi wn wc1 wv1
+      wi wc5 wn wc1 wn wc5 wn wi wn wc1 wv3 wi wn wc1 wv1 wi wc1 wv3 wi wi wi
+      wi wi wi wi wi wc1 wv1 wi wc5 wn wc1 wn wc5 wn wi wn wc1 wv3 wi wn wc1
+      wv1 wi wc1 wv3 wi wi wi wi wi wi wv3 wv9 wc7 wi wi wn wc1 wv1 wi wc5 wn
+      wc1 wn wc5 wn wi wn wc1 wv3 wi wn wc1 wv1 wi wc1 wv3 wi wi wi wi wi wi wi
+      wc5 wn wc1 wn wc5 wn wi wn wc1 wv3 wi wn wc1 wv1 wi wc1 wv3 wi wi wi wi
+      wi wc1 wv1 wi wc5 wn wc1 wn wc5 wn wi wn wc1 wv3 wi wn wc1 wv1 wi wc1 wv3
+      wi wi wi wi wi wi wc1 wn wc5 wn wi wn wc1 wv3 wi wn wc1 wv1 wi wc1 wv3 wi
+      wi wi wi wc5 wn wc1 wn wc5 wn wi wn wc1 wv3 wi wn wc1 wv1 wi wc1 wv3 wi
+      wi wi wi wi wc1 wn wc5 wn wc1 wv1 wi wc1 wv3 wi ax-g9 wc1 wn wc5 wn wi wn
+      wc1 wv3 wi wn wc1 wv1 wi wc1 wv3 wi wi wi wi wc5 wn ax-1 ax-mp wc5 wn wc1
+      wn wc5 wn wi wn wc1 wv3 wi wn wc1 wv1 wi wc1 wv3 wi wi wi wi wi wc1 wv1
+      wi ax-1 ax-mp wc1 wv1 wi wc5 wn wc1 wn wc5 wn wi wn wc1 wv3 wi wn wc1 wv1
+      wi wc1 wv3 wi wi wi wi wi wi wv3 wv9 wc7 wi wi wn ax-1 ax-mp wv3 wv9 wc7
+      wi wi wn wc1 wv1 wi wc5 wn wc1 wn wc5 wn wi wn wc1 wv3 wi wn wc1 wv1 wi
+      wc1 wv3 wi wi wi wi wi wi wi wv7 ax-1 ax-mp $.
+  th389 $p |- ( -. v5 -> ( ( ( ( c5 -> c1 ) -> c7 ) -> ( -. v3 -> ( c6 -> v4 ) ) ) -> ( ( v8 -> v2 ) -> ( ( ( ( c5 -> c1 ) -> c7 ) -> ( -. v3 -> ( c6 -> v4 ) ) ) -> ( v4 -> ( ( ( ( c5 -> c1 ) -> c7 ) -> ( -. v3 -> ( c6 -> v4 ) ) ) -> ( ( ( ( c5 -> c1 ) -> c7 ) -> ( -. v3 -> ( c6 -> v4 ) ) ) -> -. ( ( ( v1 -> v3 ) -> ( v8 -> v2 ) ) -> ( ( v8 -> c9 ) -> ( v8 -> c9 ) ) ) ) ) ) ) ) ) ) $=
+      wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv8 wv2 wi wc5 wc1 wi wc7 wi
+      wv3 wn wc6 wv4 wi wi wi wv4 wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wc5
+      wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi
+      wv8 wc9 wi wi wi wn wi wi wi wi wi wi wv5 wn wc5 wc1 wi wc7 wi wv3 wn wc6
+      wv4 wi wi wi wv8 wv2 wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv4 wc5
+      wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi
+      wi wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn wi wi wi wi
+      wi wi wi wv8 wv2 wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv4 wc5 wc1
+      wi wc7 wi wv3 wn wc6 wv4 wi wi wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi
+      wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn wi wi wi wi wi
+      wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv8 wv2 wi wc5 wc1 wi wc7 wi
+      wv3 wn wc6 wv4 wi wi wi wv4 wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wc5
+      wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi
+      wv8 wc9 wi wi wi wn wi wi wi wi wi wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi
+      wi wi wv4 wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wc5 wc1 wi wc7 wi wv3
+      wn wc6 wv4 wi wi wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi
+      wn wi wi wi wi wv8 wv2 wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv4
+      wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wc5 wc1 wi wc7 wi wv3 wn wc6
+      wv4 wi wi wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn wi
+      wi wi wi wi wv4 wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wc5 wc1 wi wc7
+      wi wv3 wn wc6 wv4 wi wi wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi
+      wi wi wn wi wi wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv4 wc5 wc1
+      wi wc7 wi wv3 wn wc6 wv4 wi wi wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi
+      wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn wi wi wi wi
+      wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wc5 wc1 wi wc7 wi wv3 wn wc6
+      wv4 wi wi wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn wi
+      wi wv4 wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wc5 wc1 wi wc7 wi wv3 wn
+      wc6 wv4 wi wi wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn
+      wi wi wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv1 wv3 wi wv8 wv2 wi
+      wi wv8 wc9 wi wv8 wc9 wi wi wi wn wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi
+      wi wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv1 wv3 wi wv8 wv2 wi wi
+      wv8 wc9 wi wv8 wc9 wi wi wi wn wi wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi
+      wv8 wc9 wi wi wi wn wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv1 wv3 wi
+      wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn wi wv1 wv3 wi wv8 wc9 wi wv8
+      wv2 wi ax-g8 wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn wc5
+      wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi ax-1 ax-mp wc5 wc1 wi wc7 wi wv3 wn
+      wc6 wv4 wi wi wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn
+      wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi ax-1 ax-mp wc5 wc1 wi wc7 wi
+      wv3 wn wc6 wv4 wi wi wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv1 wv3
+      wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn wi wi wv4 ax-1 ax-mp wv4
+      wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wc5 wc1 wi wc7 wi wv3 wn wc6
+      wv4 wi wi wi wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn wi
+      wi wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi ax-1 ax-mp wc5 wc1 wi wc7
+      wi wv3 wn wc6 wv4 wi wi wi wv4 wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi
+      wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv1 wv3 wi wv8 wv2 wi wi wv8
+      wc9 wi wv8 wc9 wi wi wi wn wi wi wi wi wv8 wv2 wi ax-1 ax-mp wv8 wv2 wi
+      wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv4 wc5 wc1 wi wc7 wi wv3 wn
+      wc6 wv4 wi wi wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv1 wv3 wi wv8
+      wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn wi wi wi wi wi wc5 wc1 wi wc7 wi
+      wv3 wn wc6 wv4 wi wi wi ax-1 ax-mp wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi
+      wi wv8 wv2 wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi wv4 wc5 wc1 wi
+      wc7 wi wv3 wn wc6 wv4 wi wi wi wc5 wc1 wi wc7 wi wv3 wn wc6 wv4 wi wi wi
+      wv1 wv3 wi wv8 wv2 wi wi wv8 wc9 wi wv8 wc9 wi wi wi wn wi wi wi wi wi wi
+      wv5 wn ax-1 ax-mp $.
+  th390 $p |- ( ( ( ( v6 -> v9 ) -> ( c4 -> v9 ) ) -> ( ( v5 -> v3 ) -> -. v4 ) ) -> ( ( ( ( v0 -> v3 ) -> ( v0 -> v4 ) ) -> c5 ) -> ( v5 -> ( ( c5 -> ( ( c5 -> v0 ) -> v6 ) ) -> ( ( ( -. v1 -> ( v6 -> v2 ) ) -> v2 ) -> ( ( -. v6 -> -. c7 ) -> ( ( ( -. v1 -> ( v6 -> v2 ) ) -> v2 ) -> ( c4 -> ( -. ( ( v4 -> v3 ) -> -. v0 ) -> ( -. v0 -> ( -. v7 -> v0 ) ) ) ) ) ) ) ) ) ) ) $=
+      ( wi wc5 wn wc7 wc4 ax-g9 ax-1 ax-mp ) ADJAEJJKJZFKKAJGJJZBLGCJJCJZGLMLJZ
+      TNEDJZALZJLALHLZAJJJZJZJZJZJZJZJZJZGIJNIJJFDJELJJZULJUKULUJUKUIUJUHUIUGUH
+      UFUGUEUFUBUCUDAOUENPQUFTPQUGUAPQUHTPQUISPQUJFPQUKRPQULUMPQ $.
+  ${
+    $d v2 v7 $.
+    $d v2 v9 $.
+    th391 $p |- ( -. v2 -> ( v9 -> ( ( ( ( v3 -> c9 ) -> ( v5 -> c7 ) ) -> v6 ) -> ( v2 -> ( ( -. ( v6 -> v7 ) -> -. ( v2 -> c2 ) ) -> ( ( c9 -> ( ( v8 -> v3 ) -> ( v3 -> v7 ) ) ) -> ( ( ( ( c4 -> v3 ) -> ( v5 -> v3 ) ) -> ( ( v9 -> v4 ) -> ( v2 -> c9 ) ) ) -> ( -. ( ( v7 -> v9 ) -> -. v2 ) -> -. ( ( v7 -> v9 ) -> ( v7 -> v9 ) ) ) ) ) ) ) ) ) ) $=
+      wv9 wv3 wc9 wi wv5 wc7 wi wi wv6 wi wv2 wv6 wv7 wi wn wv2 wc2 wi wn wi
+      wc9 wv8 wv3 wi wv3 wv7 wi wi wi wc4 wv3 wi wv5 wv3 wi wi wv9 wv4 wi wv2
+      wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7 wv9 wi wi wn wi wi wi
+      wi wi wi wi wv2 wn wv9 wv3 wc9 wi wv5 wc7 wi wi wv6 wi wv2 wv6 wv7 wi wn
+      wv2 wc2 wi wn wi wc9 wv8 wv3 wi wv3 wv7 wi wi wi wc4 wv3 wi wv5 wv3 wi wi
+      wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7 wv9 wi
+      wi wn wi wi wi wi wi wi wi wi wv3 wc9 wi wv5 wc7 wi wi wv6 wi wv2 wv6 wv7
+      wi wn wv2 wc2 wi wn wi wc9 wv8 wv3 wi wv3 wv7 wi wi wi wc4 wv3 wi wv5 wv3
+      wi wi wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7
+      wv9 wi wi wn wi wi wi wi wi wi wv9 wv3 wc9 wi wv5 wc7 wi wi wv6 wi wv2
+      wv6 wv7 wi wn wv2 wc2 wi wn wi wc9 wv8 wv3 wi wv3 wv7 wi wi wi wc4 wv3 wi
+      wv5 wv3 wi wi wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9
+      wi wv7 wv9 wi wi wn wi wi wi wi wi wi wi wv2 wv6 wv7 wi wn wv2 wc2 wi wn
+      wi wc9 wv8 wv3 wi wv3 wv7 wi wi wi wc4 wv3 wi wv5 wv3 wi wi wv9 wv4 wi
+      wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7 wv9 wi wi wn wi
+      wi wi wi wi wv3 wc9 wi wv5 wc7 wi wi wv6 wi wv2 wv6 wv7 wi wn wv2 wc2 wi
+      wn wi wc9 wv8 wv3 wi wv3 wv7 wi wi wi wc4 wv3 wi wv5 wv3 wi wi wv9 wv4 wi
+      wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7 wv9 wi wi wn wi
+      wi wi wi wi wi wv6 wv7 wi wn wv2 wc2 wi wn wi wc9 wv8 wv3 wi wv3 wv7 wi
+      wi wi wc4 wv3 wi wv5 wv3 wi wi wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2
+      wn wi wn wv7 wv9 wi wv7 wv9 wi wi wn wi wi wi wi wv2 wv6 wv7 wi wn wv2
+      wc2 wi wn wi wc9 wv8 wv3 wi wv3 wv7 wi wi wi wc4 wv3 wi wv5 wv3 wi wi wv9
+      wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7 wv9 wi wi
+      wn wi wi wi wi wi wc9 wv8 wv3 wi wv3 wv7 wi wi wi wc4 wv3 wi wv5 wv3 wi
+      wi wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7 wv9
+      wi wi wn wi wi wi wv6 wv7 wi wn wv2 wc2 wi wn wi wc9 wv8 wv3 wi wv3 wv7
+      wi wi wi wc4 wv3 wi wv5 wv3 wi wi wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi
+      wv2 wn wi wn wv7 wv9 wi wv7 wv9 wi wi wn wi wi wi wi wc4 wv3 wi wv5 wv3
+      wi wi wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7
+      wv9 wi wi wn wi wi wc9 wv8 wv3 wi wv3 wv7 wi wi wi wc4 wv3 wi wv5 wv3 wi
+      wi wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7 wv9
+      wi wi wn wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7 wv9 wi wi wn wi
+      wc4 wv3 wi wv5 wv3 wi wi wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi
+      wn wv7 wv9 wi wv7 wv9 wi wi wn wi wi wv7 wv9 wi wv7 wv9 wi wv7 wv9 wi wv2
+      wn ax-g3 wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7 wv9 wi wi wn wi wc4 wv3
+      wi wv5 wv3 wi wi wv9 wv4 wi wv2 wc9 wi wi wi ax-1 ax-mp wc4 wv3 wi wv5
+      wv3 wi wi wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi
+      wv7 wv9 wi wi wn wi wi wc9 wv8 wv3 wi wv3 wv7 wi wi wi ax-1 ax-mp wc9 wv8
+      wv3 wi wv3 wv7 wi wi wi wc4 wv3 wi wv5 wv3 wi wi wv9 wv4 wi wv2 wc9 wi wi
+      wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7 wv9 wi wi wn wi wi wi wv6 wv7
+      wi wn wv2 wc2 wi wn wi ax-1 ax-mp wv6 wv7 wi wn wv2 wc2 wi wn wi wc9 wv8
+      wv3 wi wv3 wv7 wi wi wi wc4 wv3 wi wv5 wv3 wi wi wv9 wv4 wi wv2 wc9 wi wi
+      wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7 wv9 wi wi wn wi wi wi wi wv2
+      ax-1 ax-mp wv2 wv6 wv7 wi wn wv2 wc2 wi wn wi wc9 wv8 wv3 wi wv3 wv7 wi
+      wi wi wc4 wv3 wi wv5 wv3 wi wi wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2
+      wn wi wn wv7 wv9 wi wv7 wv9 wi wi wn wi wi wi wi wi wv3 wc9 wi wv5 wc7 wi
+      wi wv6 wi ax-1 ax-mp wv3 wc9 wi wv5 wc7 wi wi wv6 wi wv2 wv6 wv7 wi wn
+      wv2 wc2 wi wn wi wc9 wv8 wv3 wi wv3 wv7 wi wi wi wc4 wv3 wi wv5 wv3 wi wi
+      wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn wv7 wv9 wi wv7 wv9 wi
+      wi wn wi wi wi wi wi wi wv9 ax-1 ax-mp wv9 wv3 wc9 wi wv5 wc7 wi wi wv6
+      wi wv2 wv6 wv7 wi wn wv2 wc2 wi wn wi wc9 wv8 wv3 wi wv3 wv7 wi wi wi wc4
+      wv3 wi wv5 wv3 wi wi wv9 wv4 wi wv2 wc9 wi wi wi wv7 wv9 wi wv2 wn wi wn
+      wv7 wv9 wi wv7 wv9 wi wi wn wi wi wi wi wi wi wi wv2 wn ax-1 ax-mp $.
+  $}
+  th392 $p |- ( c9 -> ( ( ( c4 -> -. v2 ) -> ( ( v1 -> c8 ) -> ( c6 -> v8 ) ) ) -> ( ( ( ( v3 -> v0 ) -> ( c5 -> v2 ) ) -> ( v9 -> -. v0 ) ) -> ( ( v3 -> v0 ) -> ( v3 -> v0 ) ) ) ) ) $=
+      wc4 wv2 wn wi wv1 wc8 wi wc6 wv8 wi wi wi wv3 wv0 wi wc5 wv2 wi wi wv9
+      wv0 wn wi wi wv3 wv0 wi wv3 wv0 wi wi wi wi wc9 wc4 wv2 wn wi wv1 wc8 wi
+      wc6 wv8 wi wi wi wv3 wv0 wi wc5 wv2 wi wi wv9 wv0 wn wi wi wv3 wv0 wi wv3
+      wv0 wi wi wi wi wi wv3 wv0 wi wc5 wv2 wi wi wv9 wv0 wn wi wi wv3 wv0 wi
+      wv3 wv0 wi wi wi wc4 wv2 wn wi wv1 wc8 wi wc6 wv8 wi wi wi wv3 wv0 wi wc5
+      wv2 wi wi wv9 wv0 wn wi wi wv3 wv0 wi wv3 wv0 wi wi wi wi wv3 wv0 wi wv3
+      wv0 wi wi wv3 wv0 wi wc5 wv2 wi wi wv9 wv0 wn wi wi wv3 wv0 wi wv3 wv0 wi
+      wi wi wv3 wv0 wi wv3 wv0 wi wv3 wv0 wi wi wv3 wv0 wi ax-g6 wv3 wv0 wi wv3
+      wv0 wi ax-1 ax-mp wv3 wv0 wi wv3 wv0 wi wi wv3 wv0 wi wc5 wv2 wi wi wv9
+      wv0 wn wi wi ax-1 ax-mp wv3 wv0 wi wc5 wv2 wi wi wv9 wv0 wn wi wi wv3 wv0
+      wi wv3 wv0 wi wi wi wc4 wv2 wn wi wv1 wc8 wi wc6 wv8 wi wi wi ax-1 ax-mp
+      wc4 wv2 wn wi wv1 wc8 wi wc6 wv8 wi wi wi wv3 wv0 wi wc5 wv2 wi wi wv9
+      wv0 wn wi wi wv3 wv0 wi wv3 wv0 wi wi wi wi wc9 ax-1 ax-mp $.
+  th393 $p |- ( ( v2 -> v1 ) -> ( ( v8 -> v3 ) -> ( ( c0 -> v8 ) -> ( c3 -> ( -. -. ( c7 -> v5 ) -> ( ( ( ( v6 -> v7 ) -> ( v7 -> v3 ) ) -> ( ( v1 -> v9 ) -> ( c4 -> v0 ) ) ) -> ( v3 -> ( v0 -> ( ( ( c0 -> v8 ) -> ( ( v4 -> c5 ) -> v9 ) ) -> ( ( ( c0 -> v8 ) -> ( v4 -> c5 ) ) -> ( ( c0 -> v8 ) -> v9 ) ) ) ) ) ) ) ) ) ) ) $=
+      wv8 wv3 wi wc0 wv8 wi wc3 wc7 wv5 wi wn wn wv6 wv7 wi wv7 wv3 wi wi wv1
+      wv9 wi wc4 wv0 wi wi wi wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8
+      wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi wi wi wi wi wi wi wv2 wv1 wi
+      wv8 wv3 wi wc0 wv8 wi wc3 wc7 wv5 wi wn wn wv6 wv7 wi wv7 wv3 wi wi wv1
+      wv9 wi wc4 wv0 wi wi wi wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8
+      wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi wi wi wi wi wi wi wi wc0 wv8
+      wi wc3 wc7 wv5 wi wn wn wv6 wv7 wi wv7 wv3 wi wi wv1 wv9 wi wc4 wv0 wi wi
+      wi wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi wc0
+      wv8 wi wv9 wi wi wi wi wi wi wi wi wi wv8 wv3 wi wc0 wv8 wi wc3 wc7 wv5
+      wi wn wn wv6 wv7 wi wv7 wv3 wi wi wv1 wv9 wi wc4 wv0 wi wi wi wv3 wv0 wc0
+      wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi
+      wi wi wi wi wi wi wi wi wc3 wc7 wv5 wi wn wn wv6 wv7 wi wv7 wv3 wi wi wv1
+      wv9 wi wc4 wv0 wi wi wi wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8
+      wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi wi wi wi wi wc0 wv8 wi wc3
+      wc7 wv5 wi wn wn wv6 wv7 wi wv7 wv3 wi wi wv1 wv9 wi wc4 wv0 wi wi wi wv3
+      wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi wc0 wv8 wi
+      wv9 wi wi wi wi wi wi wi wi wi wc7 wv5 wi wn wn wv6 wv7 wi wv7 wv3 wi wi
+      wv1 wv9 wi wc4 wv0 wi wi wi wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0
+      wv8 wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi wi wi wi wc3 wc7 wv5 wi
+      wn wn wv6 wv7 wi wv7 wv3 wi wi wv1 wv9 wi wc4 wv0 wi wi wi wv3 wv0 wc0
+      wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi
+      wi wi wi wi wi wi wv6 wv7 wi wv7 wv3 wi wi wv1 wv9 wi wc4 wv0 wi wi wi
+      wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi wc0 wv8
+      wi wv9 wi wi wi wi wi wi wc7 wv5 wi wn wn wv6 wv7 wi wv7 wv3 wi wi wv1
+      wv9 wi wc4 wv0 wi wi wi wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8
+      wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi wi wi wi wv3 wv0 wc0 wv8 wi
+      wv4 wc5 wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi
+      wi wv6 wv7 wi wv7 wv3 wi wi wv1 wv9 wi wc4 wv0 wi wi wi wv3 wv0 wc0 wv8
+      wi wv4 wc5 wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi
+      wi wi wi wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi wc0
+      wv8 wi wv9 wi wi wi wi wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8 wi
+      wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi wi wc0 wv8 wi wv4 wc5 wi wv9 wi
+      wi wc0 wv8 wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wv0 wc0 wv8 wi wv4
+      wc5 wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi wc0
+      wv8 wi wv4 wc5 wi wv9 ax-2 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8 wi wv4
+      wc5 wi wi wc0 wv8 wi wv9 wi wi wi wv0 ax-1 ax-mp wv0 wc0 wv8 wi wv4 wc5
+      wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi wv3 ax-1
+      ax-mp wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi
+      wc0 wv8 wi wv9 wi wi wi wi wi wv6 wv7 wi wv7 wv3 wi wi wv1 wv9 wi wc4 wv0
+      wi wi wi ax-1 ax-mp wv6 wv7 wi wv7 wv3 wi wi wv1 wv9 wi wc4 wv0 wi wi wi
+      wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi wc0 wv8
+      wi wv9 wi wi wi wi wi wi wc7 wv5 wi wn wn ax-1 ax-mp wc7 wv5 wi wn wn wv6
+      wv7 wi wv7 wv3 wi wi wv1 wv9 wi wc4 wv0 wi wi wi wv3 wv0 wc0 wv8 wi wv4
+      wc5 wi wv9 wi wi wc0 wv8 wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi wi
+      wi wi wc3 ax-1 ax-mp wc3 wc7 wv5 wi wn wn wv6 wv7 wi wv7 wv3 wi wi wv1
+      wv9 wi wc4 wv0 wi wi wi wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8
+      wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi wi wi wi wi wc0 wv8 wi ax-1
+      ax-mp wc0 wv8 wi wc3 wc7 wv5 wi wn wn wv6 wv7 wi wv7 wv3 wi wi wv1 wv9 wi
+      wc4 wv0 wi wi wi wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8 wi wv4
+      wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi wi wi wi wi wi wv8 wv3 wi ax-1 ax-mp
+      wv8 wv3 wi wc0 wv8 wi wc3 wc7 wv5 wi wn wn wv6 wv7 wi wv7 wv3 wi wi wv1
+      wv9 wi wc4 wv0 wi wi wi wv3 wv0 wc0 wv8 wi wv4 wc5 wi wv9 wi wi wc0 wv8
+      wi wv4 wc5 wi wi wc0 wv8 wi wv9 wi wi wi wi wi wi wi wi wi wi wv2 wv1 wi
+      ax-1 ax-mp $.
+  th394 $p |- ( ( ( ( v8 -> c5 ) -> ( c6 -> c4 ) ) -> v7 ) -> ( -. v5 -> ( -. ( -. c1 -> c7 ) -> ( ( ( ( v9 -> c1 ) -> -. c9 ) -> -. ( c2 -> v0 ) ) -> ( ( ( ( v8 -> c5 ) -> ( c6 -> c4 ) ) -> v7 ) -> ( v5 -> ( ( ( ( v8 -> c5 ) -> ( c6 -> c4 ) ) -> v7 ) -> ( -. v7 -> ( ( c6 -> c6 ) -> -. ( c4 -> -. v7 ) ) ) ) ) ) ) ) ) ) $=
+      wv5 wn wc1 wn wc7 wi wn wv9 wc1 wi wc9 wn wi wc2 wv0 wi wn wi wv8 wc5 wi
+      wc6 wc4 wi wi wv7 wi wv5 wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv7 wn wc6 wc6
+      wi wc4 wv7 wn wi wn wi wi wi wi wi wi wi wi wv8 wc5 wi wc6 wc4 wi wi wv7
+      wi wv5 wn wc1 wn wc7 wi wn wv9 wc1 wi wc9 wn wi wc2 wv0 wi wn wi wv8 wc5
+      wi wc6 wc4 wi wi wv7 wi wv5 wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv7 wn wc6
+      wc6 wi wc4 wv7 wn wi wn wi wi wi wi wi wi wi wi wi wc1 wn wc7 wi wn wv9
+      wc1 wi wc9 wn wi wc2 wv0 wi wn wi wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv5 wv8
+      wc5 wi wc6 wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi wi
+      wi wi wi wi wv5 wn wc1 wn wc7 wi wn wv9 wc1 wi wc9 wn wi wc2 wv0 wi wn wi
+      wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv5 wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv7
+      wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi wi wi wi wi wi wi wv9 wc1 wi wc9 wn
+      wi wc2 wv0 wi wn wi wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv5 wv8 wc5 wi wc6
+      wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi wi wi wi wi wc1
+      wn wc7 wi wn wv9 wc1 wi wc9 wn wi wc2 wv0 wi wn wi wv8 wc5 wi wc6 wc4 wi
+      wi wv7 wi wv5 wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7
+      wn wi wn wi wi wi wi wi wi wi wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv5 wv8 wc5
+      wi wc6 wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi wi wi wi
+      wv9 wc1 wi wc9 wn wi wc2 wv0 wi wn wi wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv5
+      wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi
+      wi wi wi wi wv5 wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7
+      wn wi wn wi wi wi wi wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv5 wv8 wc5 wi wc6
+      wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi wi wi wi wv8
+      wc5 wi wc6 wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi wi
+      wv5 wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi
+      wi wi wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi wv8 wc5 wi wc6 wc4 wi
+      wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi wi wc6 wc6 wi wc4 wv7
+      wn wi wn wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi wc4 wv7 wn wc6 wc6
+      ax-g0 wc6 wc6 wi wc4 wv7 wn wi wn wi wv7 wn ax-1 ax-mp wv7 wn wc6 wc6 wi
+      wc4 wv7 wn wi wn wi wi wv8 wc5 wi wc6 wc4 wi wi wv7 wi ax-1 ax-mp wv8 wc5
+      wi wc6 wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi wi wv5
+      ax-1 ax-mp wv5 wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7
+      wn wi wn wi wi wi wi wv8 wc5 wi wc6 wc4 wi wi wv7 wi ax-1 ax-mp wv8 wc5
+      wi wc6 wc4 wi wi wv7 wi wv5 wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv7 wn wc6
+      wc6 wi wc4 wv7 wn wi wn wi wi wi wi wi wv9 wc1 wi wc9 wn wi wc2 wv0 wi wn
+      wi ax-1 ax-mp wv9 wc1 wi wc9 wn wi wc2 wv0 wi wn wi wv8 wc5 wi wc6 wc4 wi
+      wi wv7 wi wv5 wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7
+      wn wi wn wi wi wi wi wi wi wc1 wn wc7 wi wn ax-1 ax-mp wc1 wn wc7 wi wn
+      wv9 wc1 wi wc9 wn wi wc2 wv0 wi wn wi wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv5
+      wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi
+      wi wi wi wi wi wv5 wn ax-1 ax-mp wv5 wn wc1 wn wc7 wi wn wv9 wc1 wi wc9
+      wn wi wc2 wv0 wi wn wi wv8 wc5 wi wc6 wc4 wi wi wv7 wi wv5 wv8 wc5 wi wc6
+      wc4 wi wi wv7 wi wv7 wn wc6 wc6 wi wc4 wv7 wn wi wn wi wi wi wi wi wi wi
+      wi wv8 wc5 wi wc6 wc4 wi wi wv7 wi ax-1 ax-mp $.
+  th395 $p |- ( -. ( ( c5 -> v0 ) -> v0 ) -> ( c5 -> -. c9 ) ) $=
+      ( wv4 wi wc5 wn wc9 ax-1 ax-g5 ax-mp ) BBBCCZDACACEZDFEZCZCZBBGNJNCMNLMFH
+      LDGIMKGINJGII $.
+  wth38 $p wff ( ( ( c3 -> ( v2 -> v1 ) ) -> ( v2 -> ( c2 -> v7 ) ) ) -> ( ( ( v8 -> v2 ) -> ( v3 -> c2 ) ) -> ( ( v1 -> c5 ) -> c5 ) ) ) $=
+      wc3 wv2 wv1 wi wi wv2 wc2 wv7 wi wi wi wv8 wv2 wi wv3 wc2 wi wi wv1 wc5
+      wi wc5 wi wi wi $.
+  th396 $p |- ( v8 -> ( ( ( ( v0 -> c2 ) -> ( v3 -> v6 ) ) -> v9 ) -> ( ( ( ( v4 -> c2 ) -> ( v6 -> v3 ) ) -> ( v6 -> v5 ) ) -> ( ( ( ( v0 -> c2 ) -> ( v3 -> v6 ) ) -> v9 ) -> ( ( c6 -> v6 ) -> ( -. v9 -> ( -. v9 -> ( ( -. c7 -> -. ( c6 -> v6 ) ) -> ( ( c6 -> v6 ) -> c7 ) ) ) ) ) ) ) ) ) $=
+      wv0 wc2 wi wv3 wv6 wi wi wv9 wi wv4 wc2 wi wv6 wv3 wi wi wv6 wv5 wi wi
+      wv0 wc2 wi wv3 wv6 wi wi wv9 wi wc6 wv6 wi wv9 wn wv9 wn wc7 wn wc6 wv6
+      wi wn wi wc6 wv6 wi wc7 wi wi wi wi wi wi wi wi wv8 wv0 wc2 wi wv3 wv6 wi
+      wi wv9 wi wv4 wc2 wi wv6 wv3 wi wi wv6 wv5 wi wi wv0 wc2 wi wv3 wv6 wi wi
+      wv9 wi wc6 wv6 wi wv9 wn wv9 wn wc7 wn wc6 wv6 wi wn wi wc6 wv6 wi wc7 wi
+      wi wi wi wi wi wi wi wi wv4 wc2 wi wv6 wv3 wi wi wv6 wv5 wi wi wv0 wc2 wi
+      wv3 wv6 wi wi wv9 wi wc6 wv6 wi wv9 wn wv9 wn wc7 wn wc6 wv6 wi wn wi wc6
+      wv6 wi wc7 wi wi wi wi wi wi wi wv0 wc2 wi wv3 wv6 wi wi wv9 wi wv4 wc2
+      wi wv6 wv3 wi wi wv6 wv5 wi wi wv0 wc2 wi wv3 wv6 wi wi wv9 wi wc6 wv6 wi
+      wv9 wn wv9 wn wc7 wn wc6 wv6 wi wn wi wc6 wv6 wi wc7 wi wi wi wi wi wi wi
+      wi wv0 wc2 wi wv3 wv6 wi wi wv9 wi wc6 wv6 wi wv9 wn wv9 wn wc7 wn wc6
+      wv6 wi wn wi wc6 wv6 wi wc7 wi wi wi wi wi wi wv4 wc2 wi wv6 wv3 wi wi
+      wv6 wv5 wi wi wv0 wc2 wi wv3 wv6 wi wi wv9 wi wc6 wv6 wi wv9 wn wv9 wn
+      wc7 wn wc6 wv6 wi wn wi wc6 wv6 wi wc7 wi wi wi wi wi wi wi wc6 wv6 wi
+      wv9 wn wv9 wn wc7 wn wc6 wv6 wi wn wi wc6 wv6 wi wc7 wi wi wi wi wi wv0
+      wc2 wi wv3 wv6 wi wi wv9 wi wc6 wv6 wi wv9 wn wv9 wn wc7 wn wc6 wv6 wi wn
+      wi wc6 wv6 wi wc7 wi wi wi wi wi wi wv9 wn wv9 wn wc7 wn wc6 wv6 wi wn wi
+      wc6 wv6 wi wc7 wi wi wi wi wc6 wv6 wi wv9 wn wv9 wn wc7 wn wc6 wv6 wi wn
+      wi wc6 wv6 wi wc7 wi wi wi wi wi wv9 wn wc7 wn wc6 wv6 wi wn wi wc6 wv6
+      wi wc7 wi wi wi wv9 wn wv9 wn wc7 wn wc6 wv6 wi wn wi wc6 wv6 wi wc7 wi
+      wi wi wi wc7 wn wc6 wv6 wi wn wi wc6 wv6 wi wc7 wi wi wv9 wn wc7 wn wc6
+      wv6 wi wn wi wc6 wv6 wi wc7 wi wi wi wc7 wc6 wv6 wi ax-3 wc7 wn wc6 wv6
+      wi wn wi wc6 wv6 wi wc7 wi wi wv9 wn ax-1 ax-mp wv9 wn wc7 wn wc6 wv6 wi
+      wn wi wc6 wv6 wi wc7 wi wi wi wv9 wn ax-1 ax-mp wv9 wn wv9 wn wc7 wn wc6
+      wv6 wi wn wi wc6 wv6 wi wc7 wi wi wi wi wc6 wv6 wi ax-1 ax-mp wc6 wv6 wi
+      wv9 wn wv9 wn wc7 wn wc6 wv6 wi wn wi wc6 wv6 wi wc7 wi wi wi wi wi wv0
+      wc2 wi wv3 wv6 wi wi wv9 wi ax-1 ax-mp wv0 wc2 wi wv3 wv6 wi wi wv9 wi
+      wc6 wv6 wi wv9 wn wv9 wn wc7 wn wc6 wv6 wi wn wi wc6 wv6 wi wc7 wi wi wi
+      wi wi wi wv4 wc2 wi wv6 wv3 wi wi wv6 wv5 wi wi ax-1 ax-mp wv4 wc2 wi wv6
+      wv3 wi wi wv6 wv5 wi wi wv0 wc2 wi wv3 wv6 wi wi wv9 wi wc6 wv6 wi wv9 wn
+      wv9 wn wc7 wn wc6 wv6 wi wn wi wc6 wv6 wi wc7 wi wi wi wi wi wi wi wv0
+      wc2 wi wv3 wv6 wi wi wv9 wi ax-1 ax-mp wv0 wc2 wi wv3 wv6 wi wi wv9 wi
+      wv4 wc2 wi wv6 wv3 wi wi wv6 wv5 wi wi wv0 wc2 wi wv3 wv6 wi wi wv9 wi
+      wc6 wv6 wi wv9 wn wv9 wn wc7 wn wc6 wv6 wi wn wi wc6 wv6 wi wc7 wi wi wi
+      wi wi wi wi wi wv8 ax-1 ax-mp $.
+  ${
+    sh7.0 $e |- ( ( -. v8 -> ( v5 -> c7 ) ) -> v5 ) $.
+    sth7.0 $p |- ( ( ( c6 -> ( c0 -> c5 ) ) -> ( -. c4 -> -. v3 ) ) -> ( ( ( c6 -> ( c0 -> c5 ) ) -> ( -. c4 -> -. v3 ) ) -> ( ( ( c6 -> ( c0 -> c5 ) ) -> ( -. c4 -> -. v3 ) ) -> ( ( ( c6 -> ( c0 -> c5 ) ) -> ( -. c4 -> -. v3 ) ) -> ( ( -. v8 -> ( v5 -> c7 ) ) -> v5 ) ) ) ) ) $=
+      ( wc6 wc0 wc5 wi wc4 wn wc7 ax-1 ax-mp ) EFGHHIJAJHHZNNCJBKHHBHZHZHZHZNRH
+      QRPQOPDONLMPNLMQNLMRNLM $.
+    ${
+      sh7.1 $e |- c4 $.
+      sth7.1 $p |- ( v4 -> ( ( ( ( v6 -> v2 ) -> ( v4 -> v8 ) ) -> ( ( v2 -> v0 ) -> ( v1 -> v9 ) ) ) -> ( ( v1 -> c5 ) -> ( v2 -> ( ( v1 -> c5 ) -> ( ( v1 -> c5 ) -> ( ( c4 -> ( ( v3 -> v1 ) -> v0 ) ) -> c4 ) ) ) ) ) ) ) $=
+      ( wi wc5 wc4 ax-1 ax-mp ) GCLEHLLCALBILLLZBMLZCRRNDBLALLZNLZLZLZLZLZLZEUE
+      LUDUEUCUDUBUCUAUBTUANTKNSOPTROPUAROPUBCOPUCROPUDQOPUEEOP $.
+      ${
+        sh7.2 $e |- ( ( ( v1 -> c7 ) -> v6 ) -> -. ( v9 -> v9 ) ) $.
+        sth7.2 $p |- ( v6 -> ( v6 -> ( v6 -> ( ( ( v1 -> c7 ) -> v6 ) -> -. ( v9 -> v9 ) ) ) ) ) $=
+      wv6 wv6 wv1 wc7 wi wv6 wi wv9 wv9 wi wn wi wi wi wv6 wv6 wv6 wv1 wc7 wi
+      wv6 wi wv9 wv9 wi wn wi wi wi wi wv6 wv1 wc7 wi wv6 wi wv9 wv9 wi wn wi
+      wi wv6 wv6 wv1 wc7 wi wv6 wi wv9 wv9 wi wn wi wi wi wv1 wc7 wi wv6 wi wv9
+      wv9 wi wn wi wv6 wv1 wc7 wi wv6 wi wv9 wv9 wi wn wi wi sh7.2 wv1 wc7 wi
+      wv6 wi wv9 wv9 wi wn wi wv6 ax-1 ax-mp wv6 wv1 wc7 wi wv6 wi wv9 wv9 wi
+      wn wi wi wv6 ax-1 ax-mp wv6 wv6 wv1 wc7 wi wv6 wi wv9 wv9 wi wn wi wi wi
+      wv6 ax-1 ax-mp $.
+      $}
+    $}
+  $}
+  wth39 $p wff ( v9 -> ( ( ( c6 -> c9 ) -> -. v2 ) -> ( ( v4 -> c3 ) -> v9 ) ) ) $=
+      wv9 wc6 wc9 wi wv2 wn wi wv4 wc3 wi wv9 wi wi wi $.
+  th397 $p |- ( -. ( ( v6 -> v5 ) -> v2 ) -> ( ( ( ( v8 -> c4 ) -> ( c6 -> v2 ) ) -> ( ( c4 -> v2 ) -> -. v5 ) ) -> ( c1 -> ( -. c4 -> ( v7 -> ( v7 -> ( -. c4 -> ( c7 -> ( -. c4 -> ( -. c4 -> -. c4 ) ) ) ) ) ) ) ) ) ) $=
+      wv8 wc4 wi wc6 wv2 wi wi wc4 wv2 wi wv5 wn wi wi wc1 wc4 wn wv7 wv7 wc4
+      wn wc7 wc4 wn wc4 wn wc4 wn wi wi wi wi wi wi wi wi wi wv6 wv5 wi wv2 wi
+      wn wv8 wc4 wi wc6 wv2 wi wi wc4 wv2 wi wv5 wn wi wi wc1 wc4 wn wv7 wv7
+      wc4 wn wc7 wc4 wn wc4 wn wc4 wn wi wi wi wi wi wi wi wi wi wi wc1 wc4 wn
+      wv7 wv7 wc4 wn wc7 wc4 wn wc4 wn wc4 wn wi wi wi wi wi wi wi wi wv8 wc4
+      wi wc6 wv2 wi wi wc4 wv2 wi wv5 wn wi wi wc1 wc4 wn wv7 wv7 wc4 wn wc7
+      wc4 wn wc4 wn wc4 wn wi wi wi wi wi wi wi wi wi wc4 wn wv7 wv7 wc4 wn wc7
+      wc4 wn wc4 wn wc4 wn wi wi wi wi wi wi wi wc1 wc4 wn wv7 wv7 wc4 wn wc7
+      wc4 wn wc4 wn wc4 wn wi wi wi wi wi wi wi wi wv7 wv7 wc4 wn wc7 wc4 wn
+      wc4 wn wc4 wn wi wi wi wi wi wi wc4 wn wv7 wv7 wc4 wn wc7 wc4 wn wc4 wn
+      wc4 wn wi wi wi wi wi wi wi wv7 wc4 wn wc7 wc4 wn wc4 wn wc4 wn wi wi wi
+      wi wi wv7 wv7 wc4 wn wc7 wc4 wn wc4 wn wc4 wn wi wi wi wi wi wi wc4 wn
+      wc7 wc4 wn wc4 wn wc4 wn wi wi wi wi wv7 wc4 wn wc7 wc4 wn wc4 wn wc4 wn
+      wi wi wi wi wi wc7 wc4 wn wc4 wn wc4 wn wi wi wi wc4 wn wc7 wc4 wn wc4 wn
+      wc4 wn wi wi wi wi wc4 wn wc4 wn wc4 wn wi wi wc7 wc4 wn wc4 wn wc4 wn wi
+      wi wi wc4 wn wc4 wn ax-1 wc4 wn wc4 wn wc4 wn wi wi wc7 ax-1 ax-mp wc7
+      wc4 wn wc4 wn wc4 wn wi wi wi wc4 wn ax-1 ax-mp wc4 wn wc7 wc4 wn wc4 wn
+      wc4 wn wi wi wi wi wv7 ax-1 ax-mp wv7 wc4 wn wc7 wc4 wn wc4 wn wc4 wn wi
+      wi wi wi wi wv7 ax-1 ax-mp wv7 wv7 wc4 wn wc7 wc4 wn wc4 wn wc4 wn wi wi
+      wi wi wi wi wc4 wn ax-1 ax-mp wc4 wn wv7 wv7 wc4 wn wc7 wc4 wn wc4 wn wc4
+      wn wi wi wi wi wi wi wi wc1 ax-1 ax-mp wc1 wc4 wn wv7 wv7 wc4 wn wc7 wc4
+      wn wc4 wn wc4 wn wi wi wi wi wi wi wi wi wv8 wc4 wi wc6 wv2 wi wi wc4 wv2
+      wi wv5 wn wi wi ax-1 ax-mp wv8 wc4 wi wc6 wv2 wi wi wc4 wv2 wi wv5 wn wi
+      wi wc1 wc4 wn wv7 wv7 wc4 wn wc7 wc4 wn wc4 wn wc4 wn wi wi wi wi wi wi
+      wi wi wi wv6 wv5 wi wv2 wi wn ax-1 ax-mp $.
+  th398 $p |- ( c1 -> ( -. v0 -> ( ( c1 -> ( v7 -> ( v8 -> v0 ) ) ) -> ( ( c1 -> ( v7 -> ( v8 -> v0 ) ) ) -> ( ( ( c8 -> ( c2 -> c1 ) ) -> ( ( v5 -> v7 ) -> ( v5 -> v8 ) ) ) -> ( ( c5 -> -. -. c1 ) -> -. v0 ) ) ) ) ) ) $=
+      ( wn wc1 wi wc8 wc2 wc5 th186 ax-1 ax-mp ) AEFCDAGGGFCDAGGGHIFGGBCGBDGGGJ
+      FEEGAEGGGGGZFNGFABCDKNFLM $.
+  th399 $p |- ( ( ( ( v4 -> v6 ) -> ( v7 -> v5 ) ) -> -. ( v0 -> v2 ) ) -> ( -. ( v8 -> ( v1 -> v4 ) ) -> ( v8 -> ( ( ( ( v9 -> c8 ) -> ( c5 -> c7 ) ) -> ( ( v0 -> v0 ) -> v2 ) ) -> ( ( ( -. v2 -> -. v6 ) -> ( ( v0 -> v4 ) -> ( v4 -> v4 ) ) ) -> ( c2 -> ( ( ( v0 -> -. v0 ) -> ( ( v8 -> v8 ) -> v8 ) ) -> ( -. c0 -> ( ( ( ( c7 -> c7 ) -> ( v0 -> c0 ) ) -> ( c7 -> ( c6 -> v1 ) ) ) -> ( ( v1 -> c4 ) -> ( ( v1 -> c4 ) -> ( v1 -> c4 ) ) ) ) ) ) ) ) ) ) ) ) $=
+      wv8 wv1 wv4 wi wi wn wv8 wv9 wc8 wi wc5 wc7 wi wi wv0 wv0 wi wv2 wi wi
+      wv2 wn wv6 wn wi wv0 wv4 wi wv4 wv4 wi wi wi wc2 wv0 wv0 wn wi wv8 wv8 wi
+      wv8 wi wi wc0 wn wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi wv1 wc4 wi
+      wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi wi wi wi wi wv4 wv6 wi wv7 wv5 wi
+      wi wv0 wv2 wi wn wi wv8 wv1 wv4 wi wi wn wv8 wv9 wc8 wi wc5 wc7 wi wi wv0
+      wv0 wi wv2 wi wi wv2 wn wv6 wn wi wv0 wv4 wi wv4 wv4 wi wi wi wc2 wv0 wv0
+      wn wi wv8 wv8 wi wv8 wi wi wc0 wn wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi
+      wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi wi wi wi wi wi
+      wv8 wv9 wc8 wi wc5 wc7 wi wi wv0 wv0 wi wv2 wi wi wv2 wn wv6 wn wi wv0
+      wv4 wi wv4 wv4 wi wi wi wc2 wv0 wv0 wn wi wv8 wv8 wi wv8 wi wi wc0 wn wc7
+      wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4
+      wi wi wi wi wi wi wi wi wi wi wv8 wv1 wv4 wi wi wn wv8 wv9 wc8 wi wc5 wc7
+      wi wi wv0 wv0 wi wv2 wi wi wv2 wn wv6 wn wi wv0 wv4 wi wv4 wv4 wi wi wi
+      wc2 wv0 wv0 wn wi wv8 wv8 wi wv8 wi wi wc0 wn wc7 wc7 wi wv0 wc0 wi wi
+      wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi
+      wi wi wi wi wv9 wc8 wi wc5 wc7 wi wi wv0 wv0 wi wv2 wi wi wv2 wn wv6 wn
+      wi wv0 wv4 wi wv4 wv4 wi wi wi wc2 wv0 wv0 wn wi wv8 wv8 wi wv8 wi wi wc0
+      wn wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi
+      wv1 wc4 wi wi wi wi wi wi wi wi wi wv8 wv9 wc8 wi wc5 wc7 wi wi wv0 wv0
+      wi wv2 wi wi wv2 wn wv6 wn wi wv0 wv4 wi wv4 wv4 wi wi wi wc2 wv0 wv0 wn
+      wi wv8 wv8 wi wv8 wi wi wc0 wn wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi
+      wi wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi wi wi wi wv2 wn wv6
+      wn wi wv0 wv4 wi wv4 wv4 wi wi wi wc2 wv0 wv0 wn wi wv8 wv8 wi wv8 wi wi
+      wc0 wn wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1 wc4
+      wi wv1 wc4 wi wi wi wi wi wi wi wi wv9 wc8 wi wc5 wc7 wi wi wv0 wv0 wi
+      wv2 wi wi wv2 wn wv6 wn wi wv0 wv4 wi wv4 wv4 wi wi wi wc2 wv0 wv0 wn wi
+      wv8 wv8 wi wv8 wi wi wc0 wn wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi
+      wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi wi wi wc2 wv0 wv0 wn
+      wi wv8 wv8 wi wv8 wi wi wc0 wn wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi
+      wi wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi wv2 wn wv6 wn wi
+      wv0 wv4 wi wv4 wv4 wi wi wi wc2 wv0 wv0 wn wi wv8 wv8 wi wv8 wi wi wc0 wn
+      wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi wv1
+      wc4 wi wi wi wi wi wi wi wi wv0 wv0 wn wi wv8 wv8 wi wv8 wi wi wc0 wn wc7
+      wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4
+      wi wi wi wi wi wi wc2 wv0 wv0 wn wi wv8 wv8 wi wv8 wi wi wc0 wn wc7 wc7
+      wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi
+      wi wi wi wi wi wc0 wn wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi wv1
+      wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wi wv0 wv0 wn wi wv8 wv8 wi wv8 wi
+      wi wc0 wn wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1
+      wc4 wi wv1 wc4 wi wi wi wi wi wi wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi
+      wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wc0 wn wc7 wc7 wi wv0 wc0
+      wi wi wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wi
+      wv1 wc6 wv0 wc7 wc7 th227 wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi
+      wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wc0 wn ax-1 ax-mp wc0 wn wc7
+      wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4
+      wi wi wi wi wi wv0 wv0 wn wi wv8 wv8 wi wv8 wi wi ax-1 ax-mp wv0 wv0 wn
+      wi wv8 wv8 wi wv8 wi wi wc0 wn wc7 wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi
+      wi wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wc2 ax-1 ax-mp wc2 wv0
+      wv0 wn wi wv8 wv8 wi wv8 wi wi wc0 wn wc7 wc7 wi wv0 wc0 wi wi wc7 wc6
+      wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi wv2 wn
+      wv6 wn wi wv0 wv4 wi wv4 wv4 wi wi wi ax-1 ax-mp wv2 wn wv6 wn wi wv0 wv4
+      wi wv4 wv4 wi wi wi wc2 wv0 wv0 wn wi wv8 wv8 wi wv8 wi wi wc0 wn wc7 wc7
+      wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi
+      wi wi wi wi wi wi wv9 wc8 wi wc5 wc7 wi wi wv0 wv0 wi wv2 wi wi ax-1
+      ax-mp wv9 wc8 wi wc5 wc7 wi wi wv0 wv0 wi wv2 wi wi wv2 wn wv6 wn wi wv0
+      wv4 wi wv4 wv4 wi wi wi wc2 wv0 wv0 wn wi wv8 wv8 wi wv8 wi wi wc0 wn wc7
+      wc7 wi wv0 wc0 wi wi wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4
+      wi wi wi wi wi wi wi wi wi wv8 ax-1 ax-mp wv8 wv9 wc8 wi wc5 wc7 wi wi
+      wv0 wv0 wi wv2 wi wi wv2 wn wv6 wn wi wv0 wv4 wi wv4 wv4 wi wi wi wc2 wv0
+      wv0 wn wi wv8 wv8 wi wv8 wi wi wc0 wn wc7 wc7 wi wv0 wc0 wi wi wc7 wc6
+      wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi wi wi wi
+      wv8 wv1 wv4 wi wi wn ax-1 ax-mp wv8 wv1 wv4 wi wi wn wv8 wv9 wc8 wi wc5
+      wc7 wi wi wv0 wv0 wi wv2 wi wi wv2 wn wv6 wn wi wv0 wv4 wi wv4 wv4 wi wi
+      wi wc2 wv0 wv0 wn wi wv8 wv8 wi wv8 wi wi wc0 wn wc7 wc7 wi wv0 wc0 wi wi
+      wc7 wc6 wv1 wi wi wi wv1 wc4 wi wv1 wc4 wi wv1 wc4 wi wi wi wi wi wi wi
+      wi wi wi wi wv4 wv6 wi wv7 wv5 wi wi wv0 wv2 wi wn wi ax-1 ax-mp $.
@@ -0,0 +1,709 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "proof_minimizer.h"
+#include "expression_parser.h"
+#include "proof_tree.h"
+#include "proof_verifier.h"
+#include "span_tracer.h"
+#include "subproof_table.h"
+#include "thread_pool.h"
+#include "unification_index.h"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+using tree_span = std::span<const parse_node>;
+/*----------------------------------------------------------------------------*/
+struct statement
+{
+    /* number of the typecode constant */
+    index typecode;
+    parse_tree tree;
+
+    bool operator==(const statement &) const = default;
+};
+/*----------------------------------------------------------------------------*/
+struct statement_hash
+{
+    std::size_t operator()(const statement &statement_0) const
+    {
+        std::size_t hash = statement_0.typecode;
+        for (const auto &node : statement_0.tree)
+            hash =
+                    hash * 1000003
+                    ^ (
+                        static_cast<std::size_t>(node.index_0) * 2
+                        + static_cast<std::size_t>(node.type));
+        return hash;
+    }
+};
+/*----------------------------------------------------------------------------*/
+/* Proof of a single theorem as a graph of distinct subproofs. Nodes of the
+ * original proof are numbered in post-order, so logical children have lower
+ * numbers than their parents; replacements keep it that way. Nodes added
+ * later are syntax proofs and hypotheses, which have no logical children. */
+class proof_minimizer
+{
+private:
+    struct node
+    {
+        proof_step step;
+        std::vector<index> children;
+        statement statement_0;
+        /* proves a statement with the provable typecode */
+        bool is_logical;
+    };
+
+    const metamath_database &database;
+    const parse_tree_cache &trees;
+    const unification_index &unification_index_0;
+    const std::vector<index> &arities;
+    const proof_minimizer_options &options;
+    const assertion_index theorem_index;
+    const assertion &theorem;
+    std::vector<floating_hypothesis> scope_hypotheses;
+    std::vector<node> nodes;
+    index original_count = 0;
+    std::unordered_map<statement, index, statement_hash> statement_nodes;
+
+public:
+    proof_minimizer(
+            const metamath_database &database_in,
+            const parse_tree_cache &trees_in,
+            const unification_index &unification_index_in,
+            const std::vector<index> &arities_in,
+            const proof_minimizer_options &options_in,
+            assertion_index theorem_index_in);
+
+    /* Returns the shortened proof, none if no replacement was kept. */
+    std::optional<proof> minimize(index &original_length, index &length);
+
+private:
+    index get_length() const;
+    std::vector<bool> get_reachable() const;
+    std::vector<proof_step> pack() const;
+    bool verify(const std::vector<proof_step> &steps) const;
+    bool try_candidate(
+            index node_index,
+            assertion_index candidate,
+            index &length);
+    void bind(
+            index node_index,
+            const assertion &applied,
+            assertion_index applied_index,
+            tree_substitution &substitution_0,
+            index &bindings_count,
+            std::vector<tree_substitution> &substitutions) const;
+    index add_node(node &&node_0);
+    /* -1 if a variable is not in scope */
+    index get_syntax_node(index typecode, tree_span tree);
+    /* -1 if no node of a lower number or hypothesis has the statement */
+    index find_logical_node(const statement &statement_0, index below) const;
+    bool is_available(index fact, index node_index) const
+    {
+        return
+                fact < node_index
+                || nodes[fact].step.type
+                    == proof_step::type_t::essential_hypothesis;
+    }
+};
+/*----------------------------------------------------------------------------*/
+proof_minimizer::proof_minimizer(
+        const metamath_database &database_in,
+        const parse_tree_cache &trees_in,
+        const unification_index &unification_index_in,
+        const std::vector<index> &arities_in,
+        const proof_minimizer_options &options_in,
+        const assertion_index theorem_index_in):
+    database(database_in),
+    trees(trees_in),
+    unification_index_0(unification_index_in),
+    arities(arities_in),
+    options(options_in),
+    theorem_index(theorem_index_in),
+    theorem(database_in.get_assertion(theorem_index_in))
+{
+    scope_hypotheses = theorem.floating_hypotheses;
+    scope_hypotheses.insert(
+                scope_hypotheses.end(),
+                theorem.proof_0.floating_hypotheses.begin(),
+                theorem.proof_0.floating_hypotheses.end());
+}
+/*----------------------------------------------------------------------------*/
+std::optional<proof> proof_minimizer::minimize(
+        index &original_length,
+        index &length)
+{
+    const std::vector<proof_step> &steps = theorem.proof_0.steps;
+    if (
+            steps.empty()
+            || std::any_of(
+                steps.begin(),
+                steps.end(),
+                [] (const proof_step &step)
+                {
+                    return step.type == proof_step::type_t::unknown;
+                }))
+        return std::nullopt;
+    if (!trees.is_parsed(theorem_index))
+        return std::nullopt;
+    std::vector<expression> results;
+    try
+    {
+        verify_proof(database, theorem);
+        results = evaluate_proof(database, theorem);
+    }
+    catch (const std::runtime_error &)
+    {
+        return std::nullopt;
+    }
+
+    const grammar &grammar_0 = unification_index_0.get_grammar();
+    const proof_tree tree(steps);
+    const subproof_table subproofs(tree);
+    for (index i = 0; i < subproofs.size(); ++i)
+    {
+        const index representative = subproofs.get_representative(i);
+        node node_0;
+        node_0.step = tree.get_step(representative);
+        for (const index child : subproofs.get_children(i))
+            node_0.children.push_back(subproofs.get_subproof(child));
+        const expression &expression_0 = results[representative];
+        node_0.statement_0.typecode = expression_0[0].second;
+        node_0.is_logical =
+                node_0.statement_0.typecode
+                == grammar_0.get_provable_typecode();
+        try
+        {
+            node_0.statement_0.tree =
+                    parse_expression(
+                        grammar_0,
+                        expression_0,
+                        scope_hypotheses);
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        add_node(std::move(node_0));
+    }
+    original_count = nodes.size();
+    for (index i = 0; i < static_cast<index>(
+             theorem.essential_hypotheses.size()); ++i)
+    {
+        const tree_span hypothesis =
+                trees.get_hypothesis_tree(theorem_index, i);
+        statement statement_0{
+            theorem.essential_hypotheses[i].expression_0[0].second,
+            parse_tree(hypothesis.begin(), hypothesis.end())};
+        if (find_logical_node(statement_0, 0) != -1)
+            continue;
+        add_node(
+                    node{
+                        proof_step{
+                            proof_step::type_t::essential_hypothesis,
+                            i,
+                            0},
+                        {},
+                        std::move(statement_0),
+                        true});
+    }
+
+    original_length = get_length();
+    length = original_length;
+    bool shortened = false;
+    std::vector<bool> reachable = get_reachable();
+    std::vector<assertion_index> candidates;
+    for (index i = original_count - 1; i >= 0; --i)
+    {
+        const node &node_0 = nodes[i];
+        if (
+                !reachable[i]
+                || !node_0.is_logical
+                || node_0.step.type != proof_step::type_t::assertion
+                || node_0.statement_0.tree.empty())
+            continue;
+        candidates.clear();
+        unification_index_0.find_candidates(
+                    symbol_index(
+                        symbol::type_t::constant,
+                        node_0.statement_0.typecode),
+                    node_0.statement_0.tree,
+                    {},
+                    candidates);
+        index tried = 0;
+        for (const auto candidate : candidates)
+        {
+            if (
+                    candidate.get_index() >= theorem_index.get_index()
+                    || tried++ >= options.max_candidates)
+                break;
+            if (try_candidate(i, candidate, length))
+            {
+                shortened = true;
+                reachable = get_reachable();
+                break;
+            }
+        }
+    }
+    if (!shortened)
+        return std::nullopt;
+    proof result = theorem.proof_0;
+    result.steps = pack();
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+/* Each reference to a subproof after the first one is a single step, a
+ * recall or a repeated hypothesis, so the length is one step for the root
+ * and one for each reference. */
+index proof_minimizer::get_length() const
+{
+    const std::vector<bool> reachable = get_reachable();
+    index result = 1;
+    for (index i = 0; i < static_cast<index>(nodes.size()); ++i)
+        if (reachable[i])
+            result += nodes[i].children.size();
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+std::vector<bool> proof_minimizer::get_reachable() const
+{
+    std::vector<bool> result(nodes.size(), false);
+    std::vector<index> stack{original_count - 1};
+    result[original_count - 1] = true;
+    while (!stack.empty())
+    {
+        const index node_index = stack.back();
+        stack.pop_back();
+        for (const index child : nodes[node_index].children)
+        {
+            if (result[child])
+                continue;
+            result[child] = true;
+            stack.push_back(child);
+        }
+    }
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+std::vector<proof_step> proof_minimizer::pack() const
+{
+    struct stack_entry
+    {
+        index node_index;
+        index child_position;
+    };
+
+    std::vector<proof_step> steps;
+    /* step of the first occurrence of each subproof with children */
+    std::vector<index> positions(nodes.size(), -1);
+    std::vector<stack_entry> stack{{original_count - 1, 0}};
+    while (!stack.empty())
+    {
+        stack_entry &entry = stack.back();
+        const node &node_0 = nodes[entry.node_index];
+        if (entry.child_position == 0 && positions[entry.node_index] != -1)
+        {
+            steps.push_back(
+                        proof_step{
+                            proof_step::type_t::recall,
+                            positions[entry.node_index],
+                            0});
+            stack.pop_back();
+            continue;
+        }
+        if (entry.child_position < static_cast<index>(node_0.children.size()))
+        {
+            const index child = node_0.children[entry.child_position++];
+            /* invalidates entry */
+            stack.push_back(stack_entry{child, 0});
+            continue;
+        }
+        proof_step step = node_0.step;
+        if (step.type == proof_step::type_t::assertion)
+            step.assumptions_count = node_0.children.size();
+        steps.push_back(step);
+        if (!node_0.children.empty())
+            positions[entry.node_index] = steps.size() - 1;
+        stack.pop_back();
+    }
+    return steps;
+}
+/*----------------------------------------------------------------------------*/
+bool proof_minimizer::verify(const std::vector<proof_step> &steps) const
+{
+    assertion candidate = theorem;
+    candidate.proof_0.steps = steps;
+    try
+    {
+        verify_proof(database, candidate);
+    }
+    catch (const std::runtime_error &)
+    {
+        return false;
+    }
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+bool proof_minimizer::try_candidate(
+        const index node_index,
+        const assertion_index candidate,
+        index &length)
+{
+    const assertion &applied = database.get_assertion(candidate);
+    const statement &target = nodes[node_index].statement_0;
+    if (
+            applied.expression_0[0].second != target.typecode
+            || !trees.is_parsed(candidate))
+        return false;
+    tree_substitution substitution_0(applied.floating_hypotheses.size());
+    if (
+            !match_tree(
+                applied,
+                trees.get_expression_tree(candidate),
+                target.tree,
+                get_subtree_sizes(target.tree, arities),
+                substitution_0))
+        return false;
+    index bindings_count = 0;
+    std::vector<tree_substitution> substitutions;
+    bind(
+                node_index,
+                applied,
+                candidate,
+                substitution_0,
+                bindings_count,
+                substitutions);
+
+    for (const auto &complete : substitutions)
+    {
+        std::vector<index> children;
+        for (index i = 0; i < static_cast<index>(complete.size()); ++i)
+        {
+            const index child =
+                    get_syntax_node(
+                        applied.floating_hypotheses[i].type.second,
+                        complete[i]);
+            if (child == -1)
+                break;
+            children.push_back(child);
+        }
+        for (index i = 0; i < static_cast<index>(
+                 applied.essential_hypotheses.size()); ++i)
+        {
+            if (children.size() < complete.size() + i)
+                break;
+            const index child =
+                    find_logical_node(
+                        statement{
+                            applied.essential_hypotheses[i]
+                                .expression_0[0].second,
+                            substitute_tree(
+                                applied,
+                                trees.get_hypothesis_tree(candidate, i),
+                                complete)},
+                        node_index);
+            if (child == -1)
+                break;
+            children.push_back(child);
+        }
+        if (
+                children.size()
+                < complete.size() + applied.essential_hypotheses.size())
+            continue;
+
+        node &replaced = nodes[node_index];
+        const proof_step original_step = replaced.step;
+        std::vector<index> original_children =
+                std::exchange(replaced.children, std::move(children));
+        replaced.step =
+                proof_step{
+                    proof_step::type_t::assertion,
+                    candidate.get_index(),
+                    static_cast<index>(replaced.children.size())};
+        const index new_length = get_length();
+        if (new_length < length && verify(pack()))
+        {
+            length = new_length;
+            return true;
+        }
+        nodes[node_index].step = original_step;
+        nodes[node_index].children = std::move(original_children);
+    }
+    return false;
+}
+/*----------------------------------------------------------------------------*/
+/* Variables which occur only in hypotheses are bound by matching the
+ * hypotheses against statements of available subproofs. */
+void proof_minimizer::bind(
+        const index node_index,
+        const assertion &applied,
+        const assertion_index applied_index,
+        tree_substitution &substitution_0,
+        index &bindings_count,
+        std::vector<tree_substitution> &substitutions) const
+{
+    const auto is_unbound =
+            [&] (const parse_node &node_0)
+            {
+                return
+                        node_0.type == parse_node::type_t::variable
+                        && substitution_0[
+                            find_floating_hypothesis(
+                                applied.floating_hypotheses,
+                                node_0.index_0)].empty();
+            };
+    index chosen = -1;
+    index chosen_size = 0;
+    for (index i = 0; i < static_cast<index>(
+             applied.essential_hypotheses.size()); ++i)
+    {
+        const tree_span tree = trees.get_hypothesis_tree(applied_index, i);
+        if (
+                static_cast<index>(tree.size()) > chosen_size
+                && std::any_of(tree.begin(), tree.end(), is_unbound))
+        {
+            chosen = i;
+            chosen_size = tree.size();
+        }
+    }
+    if (chosen == -1)
+    {
+        if (
+                std::none_of(
+                    substitution_0.begin(),
+                    substitution_0.end(),
+                    [] (const parse_tree &value)
+                    {
+                        return value.empty();
+                    }))
+            substitutions.push_back(substitution_0);
+        return;
+    }
+
+    const index typecode =
+            applied.essential_hypotheses[chosen].expression_0[0].second;
+    const tree_span pattern = trees.get_hypothesis_tree(applied_index, chosen);
+    for (index i = 0; i < static_cast<index>(nodes.size()); ++i)
+    {
+        const node &fact = nodes[i];
+        if (
+                !fact.is_logical
+                || fact.statement_0.typecode != typecode
+                || fact.statement_0.tree.empty()
+                || !is_available(i, node_index))
+            continue;
+        if (bindings_count++ >= options.max_bindings)
+            return;
+        tree_substitution extended = substitution_0;
+        if (
+                match_tree(
+                    applied,
+                    pattern,
+                    fact.statement_0.tree,
+                    get_subtree_sizes(fact.statement_0.tree, arities),
+                    extended))
+            bind(
+                        node_index,
+                        applied,
+                        applied_index,
+                        extended,
+                        bindings_count,
+                        substitutions);
+    }
+}
+/*----------------------------------------------------------------------------*/
+index proof_minimizer::add_node(node &&node_0)
+{
+    const index node_index = nodes.size();
+    if (!node_0.statement_0.tree.empty())
+        statement_nodes.try_emplace(node_0.statement_0, node_index);
+    nodes.push_back(std::move(node_0));
+    return node_index;
+}
+/*----------------------------------------------------------------------------*/
+index proof_minimizer::get_syntax_node(
+        const index typecode,
+        const tree_span tree)
+{
+    statement statement_0{typecode, parse_tree(tree.begin(), tree.end())};
+    const auto found = statement_nodes.find(statement_0);
+    if (found != statement_nodes.end() && !nodes[found->second].is_logical)
+        return found->second;
+
+    const parse_node &root = tree.back();
+    node node_0;
+    if (root.type == parse_node::type_t::variable)
+    {
+        const index hypothesis =
+                find_floating_hypothesis(scope_hypotheses, root.index_0);
+        if (hypothesis == -1)
+            return -1;
+        node_0.step =
+                proof_step{
+                    proof_step::type_t::floating_hypothesis,
+                    hypothesis,
+                    0};
+    }
+    else
+    {
+        const assertion &axiom =
+                database.get_assertion(assertion_index(root.index_0));
+        const std::vector<index> sizes = get_subtree_sizes(tree, arities);
+        /* children are found from the last one */
+        std::vector<index> ends;
+        for (
+                index child = tree.size() - 2;
+                static_cast<index>(ends.size()) < arities[root.index_0];
+                child -= sizes[child])
+            ends.push_back(child);
+        for (index i = 0; i < static_cast<index>(ends.size()); ++i)
+        {
+            const index end = ends[ends.size() - 1 - i];
+            const index child =
+                    get_syntax_node(
+                        axiom.floating_hypotheses[i].type.second,
+                        tree.subspan(end + 1 - sizes[end], sizes[end]));
+            if (child == -1)
+                return -1;
+            node_0.children.push_back(child);
+        }
+        node_0.step =
+                proof_step{
+                    proof_step::type_t::assertion,
+                    root.index_0,
+                    static_cast<index>(node_0.children.size())};
+    }
+    node_0.statement_0 = std::move(statement_0);
+    node_0.is_logical = false;
+    return add_node(std::move(node_0));
+}
+/*----------------------------------------------------------------------------*/
+index proof_minimizer::find_logical_node(
+        const statement &statement_0,
+        const index below) const
+{
+    const auto found = statement_nodes.find(statement_0);
+    if (
+            found == statement_nodes.end()
+            || !nodes[found->second].is_logical
+            || !is_available(found->second, below))
+        return -1;
+    return found->second;
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+proof_minimizer_result minimize_proofs(
+        metamath_database &database,
+        const std::vector<assertion_index> &theorems,
+        const proof_minimizer_options &options)
+{
+    const trace_span span("minimize_proofs");
+    std::vector<assertion_index> selected = theorems;
+    if (selected.empty())
+        for (
+                auto i = database.assertions_begin();
+                i != database.assertions_end();
+                ++i)
+            if (database.get_assertion(*i).type == assertion::type_t::theorem)
+                selected.push_back(*i);
+    for (const auto theorem : selected)
+        if (database.get_assertion(theorem).type != assertion::type_t::theorem)
+            throw std::runtime_error("only theorems have proofs");
+    /* Longest proofs first, so that they do not delay the end of the
+     * parallel loop, which hands out theorems as threads become free. */
+    std::stable_sort(
+                selected.begin(),
+                selected.end(),
+                [&] (const assertion_index lhs, const assertion_index rhs)
+                {
+                    return
+                            database.get_assertion(lhs).proof_0.steps.size()
+                            > database.get_assertion(rhs).proof_0.steps.size();
+                });
+
+    const parse_tree_cache &trees =
+            get_parse_trees(database, options.threads_count);
+    std::unique_ptr<unification_index> own_index;
+    const unification_index *unification_index_0 =
+            database.get_unification_index();
+    if (unification_index_0 == nullptr)
+    {
+        own_index =
+                std::make_unique<unification_index>(
+                    database,
+                    options.threads_count);
+        unification_index_0 = own_index.get();
+    }
+    std::vector<index> arities;
+    for (
+            auto i = database.assertions_begin();
+            i != database.assertions_end();
+            ++i)
+        arities.push_back(
+                    database.get_assertion(*i).floating_hypotheses.size());
+
+    /* proofs are replaced after the loop, the database is read only in it */
+    const index selected_count = selected.size();
+    std::vector<std::optional<proof>> proofs(selected_count);
+    std::vector<index> original_lengths(selected_count, 0);
+    std::vector<index> lengths(selected_count, 0);
+    thread_pool pool(options.threads_count);
+    parallel_for(
+                pool,
+                selected_count,
+                [&] (const index i)
+                {
+                    proof_minimizer minimizer(
+                                database,
+                                trees,
+                                *unification_index_0,
+                                arities,
+                                options,
+                                selected[i]);
+                    proofs[i] =
+                            minimizer.minimize(
+                                original_lengths[i],
+                                lengths[i]);
+                });
+
+    proof_minimizer_result result;
+    result.theorems_count = selected_count;
+    for (index i = 0; i < selected_count; ++i)
+    {
+        result.original_length += original_lengths[i];
+        result.minimized_length += lengths[i];
+        if (!proofs[i].has_value())
+            continue;
+        ++result.shortened_count;
+        database.set_proof(selected[i], std::move(*proofs[i]));
+    }
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PROOF_MINIMIZER_H
+#define PROOF_MINIMIZER_H
+
+#include "metamath_database.h"
+
+#include <vector>
+
+namespace metamath_playground {
+
+struct proof_minimizer_options
+{
+    /* Theorems are minimized in parallel. 0 means one thread per hardware
+     * thread. */
+    unsigned threads_count = 0;
+    /* Limits of assertions tried for each step and of alternatives for
+     * variables of their hypotheses which do not occur in the statement. */
+    index max_candidates = 64;
+    index max_bindings = 64;
+};
+
+struct proof_minimizer_result
+{
+    index theorems_count = 0;
+    index shortened_count = 0;
+    /* steps of the proofs in the compressed form, summed over theorems */
+    index original_length = 0;
+    index minimized_length = 0;
+};
+
+/* Shortens proofs of the theorems, or of all theorems if the list is empty,
+ * and writes them with set_proof.
+ *
+ * A subproof is replaced by an application of an earlier assertion with the
+ * same statement after substitution, whose hypotheses are proved by other
+ * subproofs of the proof or are hypotheses of the theorem. A replacement is
+ * kept only if the proof in the compressed form gets shorter and still
+ * verifies. Steps are tried from the root, so large subproofs go first.
+ * Works on parse trees of statements, see get_parse_trees: assertions whose
+ * statements do not parse are not applied. Proofs of such theorems, with
+ * unknown steps, or which do not verify are left unchanged. */
+proof_minimizer_result minimize_proofs(
+        metamath_database &database,
+        const std::vector<assertion_index> &theorems,
+        const proof_minimizer_options &options = proof_minimizer_options());
+
+} /* namespace metamath_playground */
+
+#endif /* PROOF_MINIMIZER_H */
@@ -0,0 +1,1045 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "proof_search.h"
+#include "expression_parser.h"
+#include "proof_tree.h"
+#include "proof_verifier.h"
+#include "span_tracer.h"
+#include "thread_pool.h"
+#include "unification_index.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+using tree_span = std::span<const parse_node>;
+struct goal
+{
+    /* number of the typecode constant */
+    index typecode;
+    parse_tree tree;
+
+    bool operator==(const goal &) const = default;
+};
+/*----------------------------------------------------------------------------*/
+struct goal_hash
+{
+    std::size_t operator()(const goal &goal_0) const
+    {
+        std::size_t hash = goal_0.typecode;
+        for (const auto &node : goal_0.tree)
+            hash =
+                    hash * 1000003
+                    ^ (
+                        static_cast<std::size_t>(node.index_0) * 2
+                        + static_cast<std::size_t>(node.type));
+        return hash;
+    }
+};
+/*----------------------------------------------------------------------------*/
+struct expansion
+{
+    assertion_index assertion_index_0;
+    tree_substitution substitution_0;
+    std::vector<goal> subgoals;
+    index score;
+};
+/*----------------------------------------------------------------------------*/
+/* Syntactic unification of two trees. Variables numbered from
+ * first_metavariable may be substituted, other variables are fixed. */
+class unifier
+{
+private:
+    struct term
+    {
+        index tree;
+        index position;
+    };
+
+    const std::vector<index> &arities;
+    const index first_metavariable;
+    std::array<tree_span, 2> trees;
+    std::array<std::vector<index>, 2> sizes;
+    std::vector<std::pair<index, term>> bindings;
+
+public:
+    unifier(
+            const std::vector<index> &arities_in,
+            const index first_metavariable_in,
+            const tree_span first,
+            const tree_span second):
+        arities(arities_in),
+        first_metavariable(first_metavariable_in),
+        trees{first, second},
+        sizes{
+            get_subtree_sizes(first, arities_in),
+            get_subtree_sizes(second, arities_in)}
+    {
+    }
+
+    bool unify()
+    {
+        return
+                unify(
+                    term{0, static_cast<index>(trees[0].size()) - 1},
+                    term{1, static_cast<index>(trees[1].size()) - 1});
+    }
+
+    /* Writes the value of the metavariable, false if it is not ground. */
+    bool resolve(const index metavariable, parse_tree &result) const
+    {
+        const term *const bound = find_binding(metavariable);
+        return bound != nullptr && resolve(*bound, result);
+    }
+
+private:
+    const parse_node &get_node(const term term_0) const
+    {
+        return trees[term_0.tree][term_0.position];
+    }
+
+    bool is_metavariable(const parse_node &node) const
+    {
+        return
+                node.type == parse_node::type_t::variable
+                && node.index_0 >= first_metavariable;
+    }
+
+    const term *find_binding(const index metavariable) const
+    {
+        for (const auto &binding : bindings)
+            if (binding.first == metavariable)
+                return &binding.second;
+        return nullptr;
+    }
+
+    term dereference(term term_0) const
+    {
+        while (is_metavariable(get_node(term_0)))
+        {
+            const term *const bound = find_binding(get_node(term_0).index_0);
+            if (bound == nullptr)
+                break;
+            term_0 = *bound;
+        }
+        return term_0;
+    }
+
+    /* Children from the last one. */
+    std::vector<term> get_children(const term term_0) const
+    {
+        std::vector<term> children;
+        const parse_node &node = get_node(term_0);
+        if (node.type != parse_node::type_t::syntax_axiom)
+            return children;
+        index child = term_0.position - 1;
+        for (index i = 0; i < arities[node.index_0]; ++i)
+        {
+            children.push_back(term{term_0.tree, child});
+            child -= sizes[term_0.tree][child];
+        }
+        return children;
+    }
+
+    bool occurs(const index metavariable, const term term_0) const
+    {
+        const term found = dereference(term_0);
+        const parse_node &node = get_node(found);
+        if (is_metavariable(node))
+            return node.index_0 == metavariable;
+        for (const term child : get_children(found))
+            if (occurs(metavariable, child))
+                return true;
+        return false;
+    }
+
+    bool unify(const term lhs_in, const term rhs_in)
+    {
+        const term lhs = dereference(lhs_in);
+        const term rhs = dereference(rhs_in);
+        const parse_node &lhs_node = get_node(lhs);
+        const parse_node &rhs_node = get_node(rhs);
+        if (is_metavariable(lhs_node) || is_metavariable(rhs_node))
+        {
+            if (lhs_node == rhs_node)
+                return true;
+            const bool bind_lhs = is_metavariable(lhs_node);
+            const index metavariable =
+                    bind_lhs ? lhs_node.index_0 : rhs_node.index_0;
+            const term value = bind_lhs ? rhs : lhs;
+            if (occurs(metavariable, value))
+                return false;
+            bindings.emplace_back(metavariable, value);
+            return true;
+        }
+        if (lhs_node != rhs_node)
+            return false;
+        const std::vector<term> lhs_children = get_children(lhs);
+        const std::vector<term> rhs_children = get_children(rhs);
+        for (std::size_t i = 0; i < lhs_children.size(); ++i)
+            if (!unify(lhs_children[i], rhs_children[i]))
+                return false;
+        return true;
+    }
+
+    bool resolve(const term term_0, parse_tree &result) const
+    {
+        const term found = dereference(term_0);
+        const parse_node &node = get_node(found);
+        if (is_metavariable(node))
+            return false;
+        const std::vector<term> children = get_children(found);
+        for (auto child = children.rbegin(); child != children.rend(); ++child)
+            if (!resolve(*child, result))
+                return false;
+        result.push_back(node);
+        return true;
+    }
+};
+/*----------------------------------------------------------------------------*/
+class proof_searcher
+{
+private:
+    struct memo_entry
+    {
+        bool proven = false;
+        /* greatest depth at which the goal was not proven, -1 if none */
+        index failed_depth = -1;
+        std::vector<proof_step> steps;
+    };
+
+    /* Proven goals used to bind variables, the most recent ones. */
+    static constexpr index max_facts = 256;
+
+    const metamath_database &database;
+    const parse_tree_cache &trees;
+    const unification_index &unification_index_0;
+    const proof_search_options &options;
+    const assertion_index theorem_index;
+    const assertion &theorem;
+    const index variables_count;
+    std::vector<index> arities;
+    /* mandatory floating hypotheses of the theorem and those of its proof */
+    std::vector<floating_hypothesis> scope_hypotheses;
+    std::set<std::pair<index, index>> allowed_pairs;
+    std::vector<goal> hypotheses;
+    /* constant during a deepening */
+    std::vector<goal> facts;
+    thread_pool &pool;
+    const std::chrono::steady_clock::time_point deadline;
+
+    std::mutex mutex;
+    std::unordered_map<goal, memo_entry, goal_hash> memo;
+    std::vector<goal> proven_goals;
+    std::atomic<bool> stopped{false};
+    std::atomic<bool> budget_exceeded{false};
+    std::atomic<std::size_t> memory_used{0};
+
+public:
+    proof_searcher(
+            const metamath_database &database_in,
+            const parse_tree_cache &trees_in,
+            const unification_index &unification_index_in,
+            thread_pool &pool_in,
+            const proof_search_options &options_in,
+            assertion_index theorem_index_in);
+
+    bool is_budget_exceeded() const
+    {
+        return budget_exceeded;
+    }
+
+    /* Goals of unknown steps of the proof, indexed by step, whose
+     * statements can be inferred. Sets is_syntax for goals of floating
+     * hypotheses. */
+    std::vector<std::optional<goal>> infer_goals(std::vector<bool> &is_syntax);
+
+    bool prove(const goal &goal_0, std::vector<proof_step> &steps);
+    /* A parse tree is a proof of the syntax of its expression. */
+    bool write_syntax_proof(
+            tree_span tree,
+            std::vector<proof_step> &steps) const;
+
+private:
+    bool solve(const goal &goal_0, index depth, std::vector<proof_step> &steps);
+    bool apply(
+            const expansion &expansion_0,
+            index depth,
+            std::vector<proof_step> &steps);
+    std::vector<expansion> expand(const goal &goal_0);
+    void bind(
+            assertion_index applied_index,
+            tree_substitution &substitution_0,
+            std::vector<expansion> &expansions) const;
+    bool check_restrictions(
+            const assertion &applied,
+            const tree_substitution &substitution_0) const;
+    /* true if the goal is a hypothesis or was proven, steps are written
+     * then */
+    bool find_known(const goal &goal_0, std::vector<proof_step> &steps);
+    /* steps is null if the goal was not proven */
+    void remember(
+            const goal &goal_0,
+            index depth,
+            const std::vector<proof_step> *steps);
+    bool check_time();
+    tree_span get_expression_tree(assertion_index assertion_index_0) const
+    {
+        return trees.get_expression_tree(assertion_index_0);
+    }
+};
+/*----------------------------------------------------------------------------*/
+proof_searcher::proof_searcher(
+        const metamath_database &database_in,
+        const parse_tree_cache &trees_in,
+        const unification_index &unification_index_in,
+        thread_pool &pool_in,
+        const proof_search_options &options_in,
+        const assertion_index theorem_index_in):
+    database(database_in),
+    trees(trees_in),
+    unification_index_0(unification_index_in),
+    options(options_in),
+    theorem_index(theorem_index_in),
+    theorem(database_in.get_assertion(theorem_index_in)),
+    variables_count((*database_in.variables_end()).second),
+    pool(pool_in),
+    deadline(
+        std::chrono::steady_clock::now()
+        + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(options_in.time_limit_seconds)))
+{
+    for (
+            auto i = database.assertions_begin();
+            i != database.assertions_end();
+            ++i)
+        arities.push_back(
+                    database.get_assertion(*i).floating_hypotheses.size());
+
+    scope_hypotheses = theorem.floating_hypotheses;
+    scope_hypotheses.insert(
+                scope_hypotheses.end(),
+                theorem.proof_0.floating_hypotheses.begin(),
+                theorem.proof_0.floating_hypotheses.end());
+    for (const auto *restrictions : {
+             &theorem.disjoint_variable_restrictions,
+             &theorem.proof_0.disjoint_variable_restrictions})
+        for (const auto &restriction : *restrictions)
+            allowed_pairs.emplace(
+                        std::min(
+                            restriction[0].second,
+                            restriction[1].second),
+                        std::max(
+                            restriction[0].second,
+                            restriction[1].second));
+
+    for (index i = 0; i < static_cast<index>(
+             theorem.essential_hypotheses.size()); ++i)
+    {
+        const tree_span tree = trees.get_hypothesis_tree(theorem_index, i);
+        hypotheses.push_back(
+                    goal{
+                        theorem.essential_hypotheses[i].expression_0[0].second,
+                        parse_tree(tree.begin(), tree.end())});
+    }
+}
+/*----------------------------------------------------------------------------*/
+std::vector<std::optional<goal>> proof_searcher::infer_goals(
+        std::vector<bool> &is_syntax)
+{
+    const std::vector<proof_step> &steps = theorem.proof_0.steps;
+    std::vector<std::optional<goal>> goals(steps.size());
+    is_syntax.assign(steps.size(), false);
+    if (steps.empty())
+        return goals;
+    const std::vector<expression> results = evaluate_proof(database, theorem);
+    const grammar &grammar_0 = unification_index_0.get_grammar();
+    const auto parse =
+            [&] (const expression &expression_0)
+            {
+                return
+                        parse_expression(
+                            grammar_0,
+                            expression_0,
+                            scope_hypotheses);
+            };
+
+    const proof_tree tree(steps);
+    const tree_span statement = get_expression_tree(theorem_index);
+    goals[tree.get_root()] =
+            goal{
+                theorem.expression_0[0].second,
+                parse_tree(statement.begin(), statement.end())};
+    for (const index node : tree.pre_order())
+    {
+        const proof_step &step = tree.get_step(node);
+        if (
+                !goals[node].has_value()
+                || step.type != proof_step::type_t::assertion
+                || !results[node].empty())
+            continue;
+
+        const assertion_index applied_index(step.index_0);
+        if (!trees.is_parsed(applied_index))
+            continue;
+        const assertion &applied = database.get_assertion(applied_index);
+        const auto children = tree.get_children(node);
+        const index floating_count = applied.floating_hypotheses.size();
+        tree_substitution substitution_0(floating_count);
+        const parse_tree &target = goals[node]->tree;
+        if (
+                !match_tree(
+                    applied,
+                    get_expression_tree(applied_index),
+                    target,
+                    get_subtree_sizes(target, arities),
+                    substitution_0))
+            continue;
+
+        bool consistent = true;
+        for (index i = 0; i < static_cast<index>(children.size()); ++i)
+        {
+            const expression &known = results[children[i]];
+            if (known.empty())
+                continue;
+            parse_tree known_tree;
+            try
+            {
+                known_tree = parse(known);
+            }
+            catch (const std::runtime_error &)
+            {
+                consistent = false;
+                break;
+            }
+            if (i < floating_count)
+            {
+                if (substitution_0[i].empty())
+                    substitution_0[i] = known_tree;
+                consistent = consistent && substitution_0[i] == known_tree;
+            }
+            else
+                consistent =
+                        consistent
+                        && match_tree(
+                            applied,
+                            trees.get_hypothesis_tree(
+                                applied_index,
+                                i - floating_count),
+                            known_tree,
+                            get_subtree_sizes(known_tree, arities),
+                            substitution_0);
+        }
+        if (
+                !consistent
+                || std::any_of(
+                    substitution_0.begin(),
+                    substitution_0.end(),
+                    [] (const parse_tree &value)
+                    {
+                        return value.empty();
+                    }))
+            continue;
+
+        for (index i = 0; i < static_cast<index>(children.size()); ++i)
+        {
+            const index child = children[i];
+            if (!results[child].empty())
+                continue;
+            if (i < floating_count)
+            {
+                goals[child] =
+                        goal{
+                            applied.floating_hypotheses[i].type.second,
+                            substitution_0[i]};
+                is_syntax[child] = true;
+                continue;
+            }
+            const index hypothesis = i - floating_count;
+            goals[child] =
+                    goal{
+                        applied.essential_hypotheses[hypothesis]
+                            .expression_0[0].second,
+                        substitute_tree(
+                            applied,
+                            trees.get_hypothesis_tree(
+                                applied_index,
+                                hypothesis),
+                            substitution_0)};
+        }
+    }
+
+    for (index i = 0; i < static_cast<index>(steps.size()); ++i)
+        if (steps[i].type != proof_step::type_t::unknown)
+            goals[i].reset();
+    return goals;
+}
+/*----------------------------------------------------------------------------*/
+bool proof_searcher::prove(const goal &goal_0, std::vector<proof_step> &steps)
+{
+    for (index depth = 1; depth <= options.max_depth && !stopped; ++depth)
+    {
+        if (find_known(goal_0, steps))
+            return true;
+
+        facts = hypotheses;
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            const index first =
+                    std::max<index>(0, proven_goals.size() - max_facts);
+            facts.insert(
+                        facts.end(),
+                        proven_goals.begin() + first,
+                        proven_goals.end());
+        }
+
+        /* expansions of the goal are tried in parallel, the first one which
+         * succeeds is used */
+        const std::vector<expansion> expansions = expand(goal_0);
+        const index expansions_count = expansions.size();
+        std::vector<std::vector<proof_step>> proofs(expansions_count);
+        std::atomic<index> found{expansions_count};
+        parallel_for(
+                    pool,
+                    expansions_count,
+                    [&] (const index i)
+                    {
+                        if (i > found)
+                            return;
+                        if (!apply(expansions[i], depth, proofs[i]))
+                            return;
+                        index current = found;
+                        while (
+                                i < current
+                                && !found.compare_exchange_weak(current, i))
+                            ;
+                    });
+
+        if (found < expansions_count)
+        {
+            remember(goal_0, depth, &proofs[found]);
+            steps.insert(
+                        steps.end(),
+                        proofs[found].begin(),
+                        proofs[found].end());
+            return true;
+        }
+        if (!stopped)
+            remember(goal_0, depth, nullptr);
+    }
+    return false;
+}
+/*----------------------------------------------------------------------------*/
+bool proof_searcher::write_syntax_proof(
+        const tree_span tree,
+        std::vector<proof_step> &steps) const
+{
+    for (const auto &node : tree)
+    {
+        if (node.type == parse_node::type_t::syntax_axiom)
+        {
+            steps.push_back(
+                        proof_step{
+                            proof_step::type_t::assertion,
+                            node.index_0,
+                            arities[node.index_0]});
+            continue;
+        }
+        const index hypothesis =
+                find_floating_hypothesis(scope_hypotheses, node.index_0);
+        if (hypothesis == -1)
+            return false;
+        steps.push_back(
+                    proof_step{
+                        proof_step::type_t::floating_hypothesis,
+                        hypothesis,
+                        0});
+    }
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+bool proof_searcher::solve(
+        const goal &goal_0,
+        const index depth,
+        std::vector<proof_step> &steps)
+{
+    if (!check_time())
+        return false;
+    if (find_known(goal_0, steps))
+        return true;
+    if (depth == 0)
+        return false;
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        const auto found = memo.find(goal_0);
+        if (found != memo.end() && found->second.failed_depth >= depth)
+            return false;
+    }
+
+    const std::size_t steps_count = steps.size();
+    for (const auto &expansion_0 : expand(goal_0))
+    {
+        if (apply(expansion_0, depth, steps))
+        {
+            const std::vector<proof_step> proof_steps(
+                        steps.begin() + steps_count,
+                        steps.end());
+            remember(goal_0, depth, &proof_steps);
+            return true;
+        }
+        steps.resize(steps_count);
+        if (stopped)
+            return false;
+    }
+    remember(goal_0, depth, nullptr);
+    return false;
+}
+/*----------------------------------------------------------------------------*/
+bool proof_searcher::apply(
+        const expansion &expansion_0,
+        const index depth,
+        std::vector<proof_step> &steps)
+{
+    for (const auto &value : expansion_0.substitution_0)
+        if (!write_syntax_proof(value, steps))
+            return false;
+    for (const auto &subgoal : expansion_0.subgoals)
+        if (!solve(subgoal, depth - 1, steps))
+            return false;
+    const index applied = expansion_0.assertion_index_0.get_index();
+    steps.push_back(
+                proof_step{
+                    proof_step::type_t::assertion,
+                    applied,
+                    static_cast<index>(
+                        expansion_0.substitution_0.size()
+                        + expansion_0.subgoals.size())});
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+std::vector<expansion> proof_searcher::expand(const goal &goal_0)
+{
+    std::vector<assertion_index> candidates;
+    unification_index_0.find_candidates(
+                symbol_index(symbol::type_t::constant, goal_0.typecode),
+                goal_0.tree,
+                {},
+                candidates);
+    const std::vector<index> sizes = get_subtree_sizes(goal_0.tree, arities);
+
+    std::vector<expansion> expansions;
+    for (const auto candidate : candidates)
+    {
+        if (
+                candidate.get_index() >= theorem_index.get_index()
+                || static_cast<index>(expansions.size())
+                    >= options.max_expansions)
+            break;
+        const assertion &applied = database.get_assertion(candidate);
+        if (
+                applied.expression_0[0].second != goal_0.typecode
+                || !trees.is_parsed(candidate))
+            continue;
+        tree_substitution substitution_0(applied.floating_hypotheses.size());
+        if (
+                match_tree(
+                    applied,
+                    get_expression_tree(candidate),
+                    goal_0.tree,
+                    sizes,
+                    substitution_0))
+            bind(candidate, substitution_0, expansions);
+    }
+
+    /* best first: expansions with smallest unknown subgoals */
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        for (auto &expansion_0 : expansions)
+        {
+            expansion_0.score = 0;
+            for (const auto &subgoal : expansion_0.subgoals)
+            {
+                const auto found = memo.find(subgoal);
+                if (
+                        (found == memo.end() || !found->second.proven)
+                        && std::find(
+                            hypotheses.begin(),
+                            hypotheses.end(),
+                            subgoal) == hypotheses.end())
+                    expansion_0.score += subgoal.tree.size();
+            }
+        }
+    }
+    std::stable_sort(
+                expansions.begin(),
+                expansions.end(),
+                [] (const expansion &lhs, const expansion &rhs)
+                {
+                    return lhs.score < rhs.score;
+                });
+    return expansions;
+}
+/*----------------------------------------------------------------------------*/
+void proof_searcher::bind(
+        const assertion_index applied_index,
+        tree_substitution &substitution_0,
+        std::vector<expansion> &expansions) const
+{
+    if (static_cast<index>(expansions.size()) >= options.max_expansions)
+        return;
+    const assertion &applied = database.get_assertion(applied_index);
+    const index floating_count = applied.floating_hypotheses.size();
+    const auto is_unbound =
+            [&] (const parse_node &node)
+            {
+                return
+                        node.type == parse_node::type_t::variable
+                        && substitution_0[
+                            find_floating_hypothesis(
+                                applied.floating_hypotheses,
+                                node.index_0)].empty();
+            };
+
+    /* the largest hypothesis with unbound variables is the most
+     * constrained */
+    index chosen = -1;
+    index chosen_size = 0;
+    for (index i = 0; i < static_cast<index>(
+             applied.essential_hypotheses.size()); ++i)
+    {
+        const tree_span tree = trees.get_hypothesis_tree(applied_index, i);
+        if (
+                static_cast<index>(tree.size()) > chosen_size
+                && std::any_of(tree.begin(), tree.end(), is_unbound))
+        {
+            chosen = i;
+            chosen_size = tree.size();
+        }
+    }
+
+    if (chosen == -1)
+    {
+        for (const auto &value : substitution_0)
+            if (value.empty())
+                return;
+        if (!check_restrictions(applied, substitution_0))
+            return;
+        expansion expansion_0{applied_index, substitution_0, {}, 0};
+        for (index i = 0; i < static_cast<index>(
+                 applied.essential_hypotheses.size()); ++i)
+            expansion_0.subgoals.push_back(
+                        goal{
+                            applied.essential_hypotheses[i]
+                                .expression_0[0].second,
+                            substitute_tree(
+                                applied,
+                                trees.get_hypothesis_tree(applied_index, i),
+                                substitution_0)});
+        expansions.push_back(std::move(expansion_0));
+        return;
+    }
+
+    /* Unbound variables of the hypothesis become metavariables numbered
+     * after all variables, variables of statements unified with it after
+     * these. */
+    const index typecode =
+            applied.essential_hypotheses[chosen].expression_0[0].second;
+    const parse_tree pattern =
+            substitute_tree(
+                applied,
+                trees.get_hypothesis_tree(applied_index, chosen),
+                substitution_0,
+                variables_count);
+    const auto try_binding =
+            [&] (const tree_span other)
+            {
+                unifier unifier_0(arities, variables_count, pattern, other);
+                if (!unifier_0.unify())
+                    return;
+                tree_substitution extended = substitution_0;
+                bool progress = false;
+                for (index i = 0; i < floating_count; ++i)
+                {
+                    if (!extended[i].empty())
+                        continue;
+                    progress =
+                            unifier_0.resolve(
+                                variables_count
+                                + applied.floating_hypotheses[i]
+                                    .variable.second,
+                                extended[i])
+                            || progress;
+                }
+                if (progress)
+                    bind(applied_index, extended, expansions);
+            };
+
+    for (const auto &fact : facts)
+        if (fact.typecode == typecode)
+            try_binding(fact.tree);
+
+    /* a lone variable unifies with every statement */
+    if (pattern.size() == 1)
+        return;
+    std::vector<index> metavariables;
+    for (const auto &node : pattern)
+        if (
+                node.type == parse_node::type_t::variable
+                && node.index_0 >= variables_count)
+            metavariables.push_back(node.index_0);
+    std::vector<assertion_index> candidates;
+    unification_index_0.find_candidates(
+                symbol_index(symbol::type_t::constant, typecode),
+                pattern,
+                metavariables,
+                candidates);
+    index tried = 0;
+    for (const auto candidate : candidates)
+    {
+        if (
+                candidate.get_index() >= theorem_index.get_index()
+                || tried++ >= options.max_bindings)
+            break;
+        if (!trees.is_parsed(candidate))
+            continue;
+        parse_tree statement;
+        for (const auto &node : get_expression_tree(candidate))
+            statement.push_back(
+                        node.type == parse_node::type_t::variable
+                        ? parse_node{
+                            node.type,
+                            2 * variables_count + node.index_0}
+                        : node);
+        try_binding(statement);
+    }
+}
+/*----------------------------------------------------------------------------*/
+bool proof_searcher::check_restrictions(
+        const assertion &applied,
+        const tree_substitution &substitution_0) const
+{
+    for (const auto &restriction : applied.disjoint_variable_restrictions)
+    {
+        const parse_tree &lhs =
+                substitution_0[
+                    find_floating_hypothesis(
+                        applied.floating_hypotheses,
+                        restriction[0].second)];
+        const parse_tree &rhs =
+                substitution_0[
+                    find_floating_hypothesis(
+                        applied.floating_hypotheses,
+                        restriction[1].second)];
+        for (const auto &lhs_node : lhs)
+        {
+            if (lhs_node.type != parse_node::type_t::variable)
+                continue;
+            for (const auto &rhs_node : rhs)
+            {
+                if (rhs_node.type != parse_node::type_t::variable)
+                    continue;
+                if (
+                        lhs_node.index_0 == rhs_node.index_0
+                        || allowed_pairs.count(
+                            {
+                                std::min(lhs_node.index_0, rhs_node.index_0),
+                                std::max(
+                                    lhs_node.index_0,
+                                    rhs_node.index_0)}) == 0)
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+bool proof_searcher::find_known(
+        const goal &goal_0,
+        std::vector<proof_step> &steps)
+{
+    for (index i = 0; i < static_cast<index>(hypotheses.size()); ++i)
+        if (hypotheses[i] == goal_0)
+        {
+            steps.push_back(
+                        proof_step{
+                            proof_step::type_t::essential_hypothesis,
+                            i,
+                            0});
+            return true;
+        }
+    const std::lock_guard<std::mutex> lock(mutex);
+    const auto found = memo.find(goal_0);
+    if (found == memo.end() || !found->second.proven)
+        return false;
+    steps.insert(
+                steps.end(),
+                found->second.steps.begin(),
+                found->second.steps.end());
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+void proof_searcher::remember(
+        const goal &goal_0,
+        const index depth,
+        const std::vector<proof_step> *const steps)
+{
+    const std::lock_guard<std::mutex> lock(mutex);
+    const auto [entry, inserted] = memo.try_emplace(goal_0);
+    std::size_t bytes = 0;
+    if (inserted)
+        bytes += sizeof(memo_entry) + goal_0.tree.size() * sizeof(parse_node);
+    if (steps != nullptr && !entry->second.proven)
+    {
+        entry->second.proven = true;
+        entry->second.steps = *steps;
+        proven_goals.push_back(goal_0);
+        bytes += steps->size() * sizeof(proof_step) + sizeof(goal);
+    }
+    else if (steps == nullptr)
+        entry->second.failed_depth =
+                std::max(entry->second.failed_depth, depth);
+    if (memory_used += bytes; memory_used > options.memory_limit_bytes)
+    {
+        budget_exceeded = true;
+        stopped = true;
+    }
+}
+/*----------------------------------------------------------------------------*/
+bool proof_searcher::check_time()
+{
+    if (stopped)
+        return false;
+    if (std::chrono::steady_clock::now() > deadline)
+    {
+        budget_exceeded = true;
+        stopped = true;
+        return false;
+    }
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+proof_search_result search_unknown_steps(
+        metamath_database &database,
+        const assertion_index theorem_index,
+        thread_pool &pool,
+        const proof_search_options &options)
+{
+    const trace_span span("search_unknown_steps");
+    const assertion &theorem = database.get_assertion(theorem_index);
+    if (theorem.type != assertion::type_t::theorem)
+        throw std::runtime_error("only theorems have proofs");
+    const std::vector<proof_step> &steps = theorem.proof_0.steps;
+    proof_search_result result;
+    result.goals_count =
+            std::count_if(
+                steps.begin(),
+                steps.end(),
+                [] (const proof_step &step)
+                {
+                    return step.type == proof_step::type_t::unknown;
+                });
+    if (result.goals_count == 0)
+        return result;
+
+    const parse_tree_cache &trees =
+            get_parse_trees(database, options.threads_count);
+    if (!trees.is_parsed(theorem_index))
+        return result;
+    std::unique_ptr<unification_index> own_index;
+    const unification_index *unification_index_0 =
+            database.get_unification_index();
+    if (unification_index_0 == nullptr)
+    {
+        own_index =
+                std::make_unique<unification_index>(
+                    database,
+                    options.threads_count);
+        unification_index_0 = own_index.get();
+    }
+
+    proof_searcher searcher(
+                database,
+                trees,
+                *unification_index_0,
+                pool,
+                options,
+                theorem_index);
+    std::vector<bool> is_syntax;
+    const std::vector<std::optional<goal>> goals =
+            searcher.infer_goals(is_syntax);
+    std::vector<std::optional<std::vector<proof_step>>> proofs(steps.size());
+    for (index i = 0; i < static_cast<index>(steps.size()); ++i)
+    {
+        if (!goals[i].has_value())
+            continue;
+        std::vector<proof_step> proof_steps;
+        const bool proven =
+                is_syntax[i]
+                ? searcher.write_syntax_proof(goals[i]->tree, proof_steps)
+                : searcher.prove(*goals[i], proof_steps);
+        if (!proven)
+            continue;
+        ++result.proven_count;
+        proofs[i] = std::move(proof_steps);
+    }
+    result.budget_exceeded = searcher.is_budget_exceeded();
+    if (result.proven_count == 0)
+        return result;
+
+    /* steps move, so recall steps are renumbered */
+    proof completed = theorem.proof_0;
+    completed.steps.clear();
+    std::vector<index> new_positions(steps.size());
+    for (index i = 0; i < static_cast<index>(steps.size()); ++i)
+    {
+        if (proofs[i].has_value())
+            completed.steps.insert(
+                        completed.steps.end(),
+                        proofs[i]->begin(),
+                        proofs[i]->end());
+        else if (steps[i].type == proof_step::type_t::recall)
+            completed.steps.push_back(
+                        proof_step{
+                            proof_step::type_t::recall,
+                            new_positions[steps[i].index_0],
+                            0});
+        else
+            completed.steps.push_back(steps[i]);
+        new_positions[i] = static_cast<index>(completed.steps.size()) - 1;
+    }
+    database.set_proof(theorem_index, std::move(completed));
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
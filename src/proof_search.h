@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PROOF_SEARCH_H
+#define PROOF_SEARCH_H
+
+#include "metamath_database.h"
+#include "thread_pool.h"
+
+#include <cstddef>
+
+namespace metamath_playground {
+
+struct proof_search_options
+{
+    /* Iterative deepening stops at this number of nested assertion steps. */
+    index max_depth = 4;
+    /* Budgets per theorem. The search stops when either is exceeded. */
+    double time_limit_seconds = 10.0;
+    std::size_t memory_limit_bytes = std::size_t(256) << 20;
+    /* Threads building parse trees and the unification index if the
+     * database has none. 0 means one thread per hardware thread. */
+    unsigned threads_count = 0;
+    /* Limits of alternatives for variables of hypotheses which do not occur
+     * in the statement of the applied assertion. */
+    index max_bindings = 64;
+    index max_expansions = 256;
+};
+
+struct proof_search_result
+{
+    /* unknown steps of the proof, including those whose statements could
+     * not be inferred and which are never proven */
+    index goals_count = 0;
+    index proven_count = 0;
+    bool budget_exceeded = false;
+};
+
+/* Searches proofs of "unknown" steps of the proof of a theorem and writes the
+ * completed proof with set_proof if any was found.
+ *
+ * Statements of unknown steps are inferred from the statement of the theorem
+ * and from known siblings. Search works on parse trees of statements, see
+ * get_parse_trees: theorems whose statements do not parse are left unchanged
+ * and other such assertions are not applied. A goal is proved by an essential
+ * hypothesis or by an earlier assertion whose statement matches it, found
+ * through the unification index of the database, or a temporary one if the
+ * database has none. Variables of the hypotheses of an applied assertion
+ * which do not occur in its statement are bound by unification with
+ * hypotheses of the theorem, goals proved before, or statements of other
+ * assertions. Subgoals are searched best-first, smallest first, with
+ * iterative deepening; proved and failed goals are memoized. Expansions of a
+ * goal are tried in parallel on the pool at the top level of each
+ * deepening, the pool is shared by searches of several theorems.
+ *
+ * With more than one thread the proof found may depend on timing. */
+proof_search_result search_unknown_steps(
+        metamath_database &database,
+        assertion_index theorem_index,
+        thread_pool &pool,
+        const proof_search_options &options = proof_search_options());
+
+} /* namespace metamath_playground */
+
+#endif /* PROOF_SEARCH_H */
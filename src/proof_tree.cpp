@@ -0,0 +1,103 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "proof_tree.h"
+#include "allocation_tracker.h"
+
+#include <iterator>
+#include <stdexcept>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+proof_tree::proof_tree(const std::vector<proof_step> &post_order_steps)
+{
+    assign(post_order_steps);
+}
+/*----------------------------------------------------------------------------*/
+void proof_tree::assign(const std::vector<proof_step> &post_order_steps)
+{
+    steps.assign(post_order_steps.begin(), post_order_steps.end());
+    subtree_sizes.resize(post_order_steps.size());
+    child_offsets.resize(post_order_steps.size() + 1);
+    children.clear();
+    pre_order_nodes.clear();
+
+    /* Roots of subtrees not yet consumed by any parent. */
+    dangling_proofs.clear();
+    for (index i = 0; i < size(); ++i)
+    {
+        const index children_count = steps[i].assumptions_count;
+        if (static_cast<index>(dangling_proofs.size()) < children_count)
+            throw std::runtime_error("insufficient number of dangling proofs");
+
+        child_offsets[i] = static_cast<index>(children.size());
+        const auto first_child = dangling_proofs.end() - children_count;
+        children.insert(children.end(), first_child, dangling_proofs.end());
+        dangling_proofs.erase(first_child, dangling_proofs.end());
+
+        /* Subtrees of children are adjacent and directly precede the node. */
+        subtree_sizes[i] =
+                children_count == 0
+                ? 1
+                : i + 1 - get_subtree_begin(children[child_offsets[i]]);
+        dangling_proofs.push_back(i);
+    }
+    child_offsets[size()] = static_cast<index>(children.size());
+
+    if (!empty() && dangling_proofs.size() != 1)
+        throw std::runtime_error("invalid packed proof");
+
+    pre_order_nodes.reserve(steps.size());
+    /* dangling_proofs is reused as traversal stack */
+    while (!dangling_proofs.empty())
+    {
+        const index node = dangling_proofs.back();
+        dangling_proofs.pop_back();
+        pre_order_nodes.push_back(node);
+        const auto node_children = get_children(node);
+        dangling_proofs.insert(
+                    dangling_proofs.end(),
+                    std::make_reverse_iterator(node_children.end()),
+                    std::make_reverse_iterator(node_children.begin()));
+    }
+}
+/*----------------------------------------------------------------------------*/
+unpacked_proof unpack_proof(const proof &proof_0)
+{
+    const allocation_phase_scope phase(allocation_phase::unpack);
+    unpacked_proof result;
+    result.disjoint_variable_restrictions =
+            proof_0.disjoint_variable_restrictions;
+    result.floating_hypotheses = proof_0.floating_hypotheses;
+    result.steps = proof_tree(proof_0.steps);
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+proof unpack_proof(const unpacked_proof &proof_0)
+{
+    const allocation_phase_scope phase(allocation_phase::unpack);
+    proof result;
+    result.disjoint_variable_restrictions =
+            proof_0.disjoint_variable_restrictions;
+    result.floating_hypotheses = proof_0.floating_hypotheses;
+    result.steps = proof_0.steps.get_steps();
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PROOF_TREE_H
+#define PROOF_TREE_H
+
+#include "metamath_database.h"
+
+#include <boost/range/counting_range.hpp>
+#include <boost/range/iterator_range_core.hpp>
+
+#include <vector>
+
+namespace metamath_playground {
+
+/* Flat, index based representation of a proof tree.
+ *
+ * Nodes are identified by their position in post-order, which is the order of
+ * steps in a packed proof. Subtree of node n occupies the range
+ * [n + 1 - subtree size, n + 1). Children of each node are stored in a single
+ * array, so iterating over a tree does not allocate. "recall" and "unknown"
+ * steps are leaves. */
+class proof_tree
+{
+public:
+    using node_range =
+            boost::iterator_range<std::vector<index>::const_iterator>;
+    using post_order_range =
+            boost::iterator_range<boost::counting_iterator<index>>;
+
+private:
+    std::vector<proof_step> steps;
+    std::vector<index> subtree_sizes;
+    /* Children of node n are children[child_offsets[n]] ...
+     * children[child_offsets[n + 1] - 1]. */
+    std::vector<index> child_offsets;
+    std::vector<index> children;
+    std::vector<index> pre_order_nodes;
+    /* scratch of assign, kept so that reused trees do not allocate */
+    std::vector<index> dangling_proofs;
+
+public:
+    proof_tree() = default;
+    explicit proof_tree(const std::vector<proof_step> &post_order_steps);
+
+    /* Rebuilds the tree for other steps, reusing its storage. */
+    void assign(const std::vector<proof_step> &post_order_steps);
+
+    index size() const
+    {
+        return static_cast<index>(steps.size());
+    }
+
+    bool empty() const
+    {
+        return steps.empty();
+    }
+
+    /* Valid only for non-empty tree. */
+    index get_root() const
+    {
+        return size() - 1;
+    }
+
+    const proof_step &get_step(const index node) const
+    {
+        return steps[node];
+    }
+
+    index get_subtree_size(const index node) const
+    {
+        return subtree_sizes[node];
+    }
+
+    index get_subtree_begin(const index node) const
+    {
+        return node + 1 - subtree_sizes[node];
+    }
+
+    index get_children_count(const index node) const
+    {
+        return child_offsets[node + 1] - child_offsets[node];
+    }
+
+    node_range get_children(const index node) const
+    {
+        return boost::make_iterator_range(
+                    children.begin() + child_offsets[node],
+                    children.begin() + child_offsets[node + 1]);
+    }
+
+    post_order_range post_order() const
+    {
+        return boost::counting_range(index(0), size());
+    }
+
+    node_range pre_order() const
+    {
+        return boost::make_iterator_range(
+                    pre_order_nodes.begin(),
+                    pre_order_nodes.end());
+    }
+
+    /* Steps in post-order, i.e. in the form used by packed proof. */
+    const std::vector<proof_step> &get_steps() const
+    {
+        return steps;
+    }
+};
+
+struct unpacked_proof
+{
+    std::vector<disjoint_variable_restriction>
+        disjoint_variable_restrictions;
+    std::vector<floating_hypothesis> floating_hypotheses;
+    proof_tree steps;
+};
+
+unpacked_proof unpack_proof(const proof &proof_0);
+proof unpack_proof(const unpacked_proof &proof_0);
+
+} /* namespace metamath_playground */
+
+#endif /* PROOF_TREE_H */
@@ -0,0 +1,305 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "proof_verifier.h"
+#include "span_tracer.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+class disjoint_variable_pairs
+{
+private:
+    std::unordered_set<index> pairs;
+    index variables_count;
+
+public:
+    explicit disjoint_variable_pairs(const index variables_count_in) :
+        variables_count(variables_count_in)
+    { }
+
+    void add(const std::vector<disjoint_variable_restriction> &restrictions)
+    {
+        for (const auto &restriction : restrictions)
+            pairs.insert(get_key(restriction[0], restriction[1]));
+    }
+
+    bool contains(const symbol_index lhs, const symbol_index rhs) const
+    {
+        return pairs.count(get_key(lhs, rhs)) != 0;
+    }
+
+private:
+    index get_key(const symbol_index lhs, const symbol_index rhs) const
+    {
+        const index low = std::min(lhs.second, rhs.second);
+        const index high = std::max(lhs.second, rhs.second);
+        return low * variables_count + high;
+    }
+};
+/*----------------------------------------------------------------------------*/
+void check_disjoint_variables(
+        const disjoint_variable_restriction &restriction,
+        const std::vector<const expression *> &substitution,
+        const disjoint_variable_pairs &allowed_pairs)
+{
+    const expression *const lhs_expression =
+            substitution[restriction[0].second];
+    const expression *const rhs_expression =
+            substitution[restriction[1].second];
+    if (lhs_expression == nullptr || rhs_expression == nullptr)
+        throw std::runtime_error(
+                "disjoint variable restriction on a variable without "
+                "floating hypothesis");
+    for (const auto &lhs : *lhs_expression)
+    {
+        if (lhs.first != symbol::type_t::variable)
+            continue;
+        for (const auto &rhs : *rhs_expression)
+        {
+            if (rhs.first != symbol::type_t::variable)
+                continue;
+            if (lhs == rhs)
+                throw std::runtime_error(
+                        "disjoint variable restriction violated: the same "
+                        "variable substituted");
+            if (!allowed_pairs.contains(lhs, rhs))
+                throw std::runtime_error(
+                        "disjoint variable restriction violated: missing "
+                        "restriction in proved assertion");
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
+std::vector<expression> evaluate_proof(
+        const metamath_database &database,
+        const assertion &assertion_0,
+        const bool check_restrictions,
+        index &final_stack_size)
+{
+    const proof &proof_0 = assertion_0.proof_0;
+    const index variables_count = (*database.variables_end()).second;
+
+    disjoint_variable_pairs allowed_pairs(variables_count);
+    if (check_restrictions)
+    {
+        allowed_pairs.add(assertion_0.disjoint_variable_restrictions);
+        allowed_pairs.add(proof_0.disjoint_variable_restrictions);
+    }
+
+    std::vector<expression> results;
+    results.reserve(proof_0.steps.size());
+    /* indices of results not yet used as hypotheses */
+    std::vector<index> stack;
+    std::vector<const expression *> substitution(variables_count, nullptr);
+    /* Only earlier assertions may be used. An assertion which is not in the
+     * database, e.g. a copy with a candidate proof, is found by its label. */
+    const assertion_index found = database.find_assertion(assertion_0.label);
+    const index assertions_limit =
+            database.is_valid(found)
+            ? found.get_index()
+            : (*database.assertions_end()).get_index();
+
+    for (const auto &step : proof_0.steps)
+    {
+        switch (step.type)
+        {
+        case proof_step::type_t::floating_hypothesis: {
+            const index mandatory_count =
+                    assertion_0.floating_hypotheses.size();
+            if (
+                    step.index_0 < 0
+                    || step.index_0
+                    >= mandatory_count
+                    + static_cast<index>(proof_0.floating_hypotheses.size()))
+                throw std::runtime_error(
+                        "invalid floating hypothesis in proof");
+            const floating_hypothesis &hypothesis =
+                    step.index_0 < mandatory_count
+                    ? assertion_0.floating_hypotheses[step.index_0]
+                    : proof_0.floating_hypotheses[
+                        step.index_0 - mandatory_count];
+            results.push_back(expression{hypothesis.type, hypothesis.variable});
+            break; }
+        case proof_step::type_t::essential_hypothesis:
+            if (
+                    step.index_0 < 0
+                    || step.index_0
+                    >= static_cast<index>(
+                        assertion_0.essential_hypotheses.size()))
+                throw std::runtime_error(
+                        "invalid essential hypothesis in proof");
+            results.push_back(
+                        assertion_0.essential_hypotheses[step.index_0]
+                        .expression_0);
+            break;
+        case proof_step::type_t::assertion: {
+            if (step.index_0 < 0 || step.index_0 >= assertions_limit)
+                throw std::runtime_error(
+                        "invalid or later assertion in proof of "
+                        + assertion_0.label);
+            const assertion &used =
+                    database.get_assertion(assertion_index(step.index_0));
+            const index floating_count = used.floating_hypotheses.size();
+            const index hypotheses_count =
+                    floating_count + used.essential_hypotheses.size();
+            if (static_cast<index>(stack.size()) < hypotheses_count)
+                throw std::runtime_error(
+                        "stack underflow in proof of " + assertion_0.label);
+            const auto first = stack.end() - hypotheses_count;
+
+            /* results of incomplete subproofs are empty */
+            if (
+                    std::any_of(
+                        first,
+                        stack.end(),
+                        [&results] (const index i)
+                        {
+                            return results[i].empty();
+                        }))
+            {
+                results.emplace_back();
+                stack.erase(first, stack.end());
+                break;
+            }
+
+            /* Substituted expressions are tails of the proved ones, without
+             * the type. */
+            std::vector<expression> substituted_variables(floating_count);
+            for (index i = 0; i < floating_count; ++i)
+            {
+                const auto &hypothesis = used.floating_hypotheses[i];
+                const expression &proved = results[first[i]];
+                if (proved.empty() || proved.front() != hypothesis.type)
+                    throw std::runtime_error(
+                            "floating hypothesis type mismatch in proof of "
+                            + assertion_0.label);
+                substituted_variables[i].assign(
+                            proved.begin() + 1,
+                            proved.end());
+                substitution[hypothesis.variable.second] =
+                        &substituted_variables[i];
+            }
+
+            for (index i = floating_count; i < hypotheses_count; ++i)
+            {
+                const auto &hypothesis =
+                        used.essential_hypotheses[i - floating_count];
+                if (
+                        substitute(hypothesis.expression_0, substitution)
+                        != results[first[i]])
+                    throw std::runtime_error(
+                            "essential hypothesis mismatch in proof of "
+                            + assertion_0.label);
+            }
+
+            if (check_restrictions)
+                for (const auto &restriction :
+                     used.disjoint_variable_restrictions)
+                    check_disjoint_variables(
+                                restriction,
+                                substitution,
+                                allowed_pairs);
+
+            results.push_back(substitute(used.expression_0, substitution));
+            for (const auto &hypothesis : used.floating_hypotheses)
+                substitution[hypothesis.variable.second] = nullptr;
+            stack.erase(first, stack.end());
+            break; }
+        case proof_step::type_t::recall:
+            if (
+                    step.index_0 < 0
+                    || step.index_0 >= static_cast<index>(results.size()))
+                throw std::runtime_error("invalid recall step in proof");
+            results.push_back(results[step.index_0]);
+            break;
+        case proof_step::type_t::unknown:
+            if (check_restrictions)
+                throw std::runtime_error(
+                        "proof of " + assertion_0.label + " is incomplete");
+            results.emplace_back();
+            break;
+        }
+        stack.push_back(static_cast<index>(results.size() - 1));
+    }
+
+    final_stack_size = static_cast<index>(stack.size());
+    return results;
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+std::vector<expression> evaluate_proof(
+        const metamath_database &database,
+        const assertion &assertion_0)
+{
+    index final_stack_size;
+    return evaluate_proof(database, assertion_0, false, final_stack_size);
+}
+/*----------------------------------------------------------------------------*/
+void verify_proof(
+        const metamath_database &database,
+        const assertion &assertion_0)
+{
+    const trace_span span("verify_proof");
+    if (assertion_0.type == assertion::type_t::axiom)
+        return;
+
+    index final_stack_size;
+    const auto results =
+            evaluate_proof(database, assertion_0, true, final_stack_size);
+    if (final_stack_size != 1)
+        throw std::runtime_error(
+                "proof of " + assertion_0.label
+                + " does not leave exactly one expression on the stack");
+    if (results.back() != assertion_0.expression_0)
+        throw std::runtime_error(
+                "proof of " + assertion_0.label
+                + " proves a different expression");
+}
+/*----------------------------------------------------------------------------*/
+expression substitute(
+        const expression &expression_0,
+        const std::vector<const expression *> &substitution)
+{
+    expression result;
+    result.reserve(expression_0.size());
+    for (const auto &symbol : expression_0)
+    {
+        const expression *replacement =
+                symbol.first == symbol::type_t::variable
+                ? substitution[symbol.second]
+                : nullptr;
+        if (replacement)
+            result.insert(
+                        result.end(),
+                        replacement->begin(),
+                        replacement->end());
+        else
+            result.push_back(symbol);
+    }
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PROOF_VERIFIER_H
+#define PROOF_VERIFIER_H
+
+#include "metamath_database.h"
+
+#include <vector>
+
+namespace metamath_playground {
+
+/* Returns expressions proved by consecutive steps of the proof of given
+ * assertion. Hypotheses of assertion steps are checked, disjoint variable
+ * restrictions are not. "unknown" steps and steps depending on them get empty
+ * expressions. Throws std::runtime_error if the proof is invalid. */
+std::vector<expression> evaluate_proof(
+        const metamath_database &database,
+        const assertion &assertion_0);
+
+/* Checks the proof completely, including disjoint variable restrictions,
+ * absence of "unknown" steps and the final expression. Throws
+ * std::runtime_error describing the first problem found. Axioms are always
+ * valid. */
+void verify_proof(
+        const metamath_database &database,
+        const assertion &assertion_0);
+
+/* Applies substitution to expression. substitution is indexed by variable
+ * number, null entries leave variables unchanged. */
+expression substitute(
+        const expression &expression_0,
+        const std::vector<const expression *> &substitution);
+
+} /* namespace metamath_playground */
+
+#endif /* PROOF_VERIFIER_H */
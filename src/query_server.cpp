@@ -0,0 +1,566 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "query_server.h"
+#include "proof_verifier.h"
+#include "thread_pool.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+const std::uint32_t max_frame_size = 1 << 20;
+/*----------------------------------------------------------------------------*/
+std::runtime_error system_error(const std::string &message)
+{
+    return std::runtime_error(message + ": " + std::strerror(errno));
+}
+/*----------------------------------------------------------------------------*/
+/* Appends the bytes available on the connection to buffer without waiting
+ * for more. Returns false if the peer closed the connection. */
+bool receive_available(const int file_descriptor, std::string &buffer)
+{
+    char data[4096];
+    for (;;)
+    {
+        const ssize_t received =
+                ::recv(file_descriptor, data, sizeof(data), MSG_DONTWAIT);
+        if (received > 0)
+        {
+            buffer.append(data, received);
+            continue;
+        }
+        if (received == 0)
+            return false;
+        if (errno == EINTR)
+            continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+            return true;
+        throw system_error("receiving request failed");
+    }
+}
+/*----------------------------------------------------------------------------*/
+void write_exact(const int file_descriptor, const char *data, std::size_t size)
+{
+    while (size > 0)
+    {
+        const ssize_t sent = ::send(file_descriptor, data, size, MSG_NOSIGNAL);
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw system_error("sending response failed");
+        }
+        data += sent;
+        size -= sent;
+    }
+}
+/*----------------------------------------------------------------------------*/
+/* Moves the first frame of buffer to frame. Returns false if the frame is
+ * not complete yet. */
+bool extract_frame(std::string &buffer, std::string &frame)
+{
+    if (buffer.size() < 4)
+        return false;
+    const auto header = reinterpret_cast<const unsigned char *>(buffer.data());
+    const std::uint32_t size =
+            std::uint32_t(header[0]) << 24 | std::uint32_t(header[1]) << 16
+            | std::uint32_t(header[2]) << 8 | std::uint32_t(header[3]);
+    if (size > max_frame_size)
+        throw std::runtime_error("request too long");
+    if (buffer.size() - 4 < size)
+        return false;
+    frame.assign(buffer, 4, size);
+    buffer.erase(0, 4 + size);
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+void write_frame(const int file_descriptor, const std::string &frame)
+{
+    const std::uint32_t size = frame.size();
+    const char header[4] = {
+        char(size >> 24), char(size >> 16), char(size >> 8), char(size)};
+    write_exact(file_descriptor, header, 4);
+    write_exact(file_descriptor, frame.data(), frame.size());
+}
+/*----------------------------------------------------------------------------*/
+/* Listening socket bound to a path, removed when the server ends. */
+class listening_socket
+{
+private:
+    int file_descriptor = -1;
+    std::string path;
+
+public:
+    explicit listening_socket(const std::string &path_in):
+        path(path_in)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path))
+            throw std::runtime_error("socket path too long: " + path);
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+        /* a socket left by a previous server which was killed */
+        struct stat status;
+        if (::lstat(path.c_str(), &status) == 0 && S_ISSOCK(status.st_mode))
+            ::unlink(path.c_str());
+
+        file_descriptor = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (file_descriptor < 0)
+            throw system_error("creating socket failed");
+        if (
+                ::bind(
+                    file_descriptor,
+                    reinterpret_cast<const sockaddr *>(&address),
+                    sizeof(address)) != 0)
+        {
+            const std::runtime_error error =
+                    system_error("binding socket to " + path + " failed");
+            ::close(file_descriptor);
+            throw error;
+        }
+        if (::listen(file_descriptor, SOMAXCONN) != 0)
+        {
+            const std::runtime_error error =
+                    system_error("listening on " + path + " failed");
+            ::close(file_descriptor);
+            ::unlink(path.c_str());
+            throw error;
+        }
+    }
+    listening_socket(const listening_socket &) = delete;
+    listening_socket &operator=(const listening_socket &) = delete;
+    ~listening_socket()
+    {
+        ::close(file_descriptor);
+        ::unlink(path.c_str());
+    }
+
+    int get_file_descriptor() const
+    {
+        return file_descriptor;
+    }
+};
+/*----------------------------------------------------------------------------*/
+/* Received bytes of a connection, polled only while no request of the
+ * connection is being answered, so that responses keep the order of
+ * requests. */
+struct connection
+{
+    std::string buffer;
+    bool busy = false;
+    bool peer_closed = false;
+};
+/*----------------------------------------------------------------------------*/
+/* Connections of the server by file descriptor, closed when it ends. */
+class connection_set
+{
+private:
+    std::map<int, connection> connections;
+
+public:
+    connection_set() = default;
+    connection_set(const connection_set &) = delete;
+    connection_set &operator=(const connection_set &) = delete;
+    ~connection_set()
+    {
+        for (const auto &entry : connections)
+            ::close(entry.first);
+    }
+
+    void add(const int file_descriptor)
+    {
+        connections.emplace(file_descriptor, connection());
+    }
+
+    void remove(const int file_descriptor)
+    {
+        ::close(file_descriptor);
+        connections.erase(file_descriptor);
+    }
+
+    connection &get(const int file_descriptor)
+    {
+        return connections.at(file_descriptor);
+    }
+
+    const std::map<int, connection> &get_all() const
+    {
+        return connections;
+    }
+};
+/*----------------------------------------------------------------------------*/
+/* Connections whose request was answered by the pool, handed back to the
+ * polling thread, which is woken up through a pipe. */
+class finished_requests
+{
+private:
+    std::mutex mutex;
+    /* file descriptor, false if sending the response failed */
+    std::vector<std::pair<int, bool>> finished;
+    int pipe_descriptors[2];
+
+public:
+    finished_requests()
+    {
+        if (::pipe2(pipe_descriptors, O_CLOEXEC | O_NONBLOCK) != 0)
+            throw system_error("creating pipe failed");
+    }
+    finished_requests(const finished_requests &) = delete;
+    finished_requests &operator=(const finished_requests &) = delete;
+    ~finished_requests()
+    {
+        ::close(pipe_descriptors[0]);
+        ::close(pipe_descriptors[1]);
+    }
+
+    int get_file_descriptor() const
+    {
+        return pipe_descriptors[0];
+    }
+
+    void add(const int file_descriptor, const bool succeeded)
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            finished.emplace_back(file_descriptor, succeeded);
+        }
+        /* a full pipe wakes up the polling thread anyway */
+        const char byte = 0;
+        while (::write(pipe_descriptors[1], &byte, 1) < 0 && errno == EINTR)
+            ;
+    }
+
+    std::vector<std::pair<int, bool>> take()
+    {
+        char data[256];
+        while (
+                ::read(pipe_descriptors[0], data, sizeof(data)) > 0
+                || errno == EINTR)
+            ;
+        const std::lock_guard<std::mutex> lock(mutex);
+        std::vector<std::pair<int, bool>> result;
+        result.swap(finished);
+        return result;
+    }
+};
+/*----------------------------------------------------------------------------*/
+void write_expression(
+        const metamath_database &database,
+        const expression &expression_0,
+        std::ostream &output_stream)
+{
+    for (const auto &symbol_0 : expression_0)
+        output_stream << ' ' << database.get_symbol_label(symbol_0);
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+assertion_users::assertion_users(const metamath_database &database)
+{
+    const index assertions_count = (*database.assertions_end()).get_index();
+    users.resize(assertions_count);
+    /* last theorem added to users of each assertion, to skip repetitions */
+    std::vector<index> last_user(assertions_count, assertions_count);
+    for (index i = 0; i < assertions_count; ++i)
+    {
+        const assertion &assertion_0 =
+                database.get_assertion(assertion_index(i));
+        for (const auto &step : assertion_0.proof_0.steps)
+        {
+            if (
+                    step.type != proof_step::type_t::assertion
+                    || last_user[step.index_0] == i)
+                continue;
+            last_user[step.index_0] = i;
+            users[step.index_0].push_back(assertion_index(i));
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
+const std::vector<assertion_index> &assertion_users::get_users(
+        const assertion_index assertion_index_0) const
+{
+    return users.at(assertion_index_0.get_index());
+}
+/*----------------------------------------------------------------------------*/
+void write_assertion_statement(
+        const metamath_database &database,
+        const assertion &assertion_0,
+        std::ostream &output_stream,
+        const std::string &prefix)
+{
+    for (const auto &hypothesis : assertion_0.floating_hypotheses)
+        output_stream
+                << prefix << hypothesis.label << " $f "
+                << database.get_symbol_label(hypothesis.type) << ' '
+                << database.get_symbol_label(hypothesis.variable) << " $.\n";
+    for (const auto &hypothesis : assertion_0.essential_hypotheses)
+    {
+        output_stream << prefix << hypothesis.label << " $e";
+        write_expression(database, hypothesis.expression_0, output_stream);
+        output_stream << " $.\n";
+    }
+    for (const auto &restriction : assertion_0.disjoint_variable_restrictions)
+        output_stream
+                << prefix << "$d "
+                << database.get_symbol_label(restriction[0]) << ' '
+                << database.get_symbol_label(restriction[1]) << " $.\n";
+    output_stream
+            << assertion_0.label
+            << (assertion_0.type == assertion::type_t::axiom
+                ? " $a"
+                : " $p");
+    write_expression(database, assertion_0.expression_0, output_stream);
+    output_stream << " $.\n";
+}
+/*----------------------------------------------------------------------------*/
+bool answer_query(
+        const metamath_database &database,
+        const assertion_users &users,
+        const std::string &request,
+        std::string &response)
+{
+    std::istringstream request_stream(request);
+    std::string command;
+    std::string label;
+    std::string rest;
+    if (!(request_stream >> command >> label) || request_stream >> rest)
+    {
+        response += "malformed request";
+        return false;
+    }
+
+    const assertion_index found = database.find_assertion(label);
+    if (command == "find" && !database.is_valid(found))
+    {
+        const symbol_index symbol_0 = database.find_symbol(label);
+        if (!database.is_valid(symbol_0))
+        {
+            response += "not found";
+            return false;
+        }
+        response +=
+                symbol_0.first == symbol::type_t::constant
+                ? "constant "
+                : "variable ";
+        response += std::to_string(symbol_0.second);
+        return true;
+    }
+    if (
+            command != "find" && command != "statement"
+            && command != "users" && command != "verify")
+    {
+        response += "unknown request " + command;
+        return false;
+    }
+    if (!database.is_valid(found))
+    {
+        response += "not found";
+        return false;
+    }
+
+    const assertion &assertion_0 = database.get_assertion(found);
+    if (command == "find")
+    {
+        response +=
+                assertion_0.type == assertion::type_t::axiom
+                ? "axiom "
+                : "theorem ";
+        response += std::to_string(found.get_index());
+    }
+    else if (command == "statement")
+    {
+        std::ostringstream statement;
+        write_assertion_statement(database, assertion_0, statement);
+        response += statement.str();
+    }
+    else if (command == "users")
+    {
+        for (const auto user : users.get_users(found))
+        {
+            response += database.get_assertion(user).label;
+            response += '\n';
+        }
+    }
+    else
+    {
+        try
+        {
+            verify_proof(database, assertion_0);
+        }
+        catch (const std::runtime_error &error)
+        {
+            response += error.what();
+            return false;
+        }
+        response += "valid";
+    }
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+void serve_queries(
+        const metamath_database &database,
+        const std::string &socket_path,
+        const unsigned threads_count)
+{
+    const assertion_users users(database);
+    const listening_socket socket_0(socket_path);
+    connection_set connections;
+    finished_requests finished;
+    /* destroyed first, after the tasks using the connections are done */
+    thread_pool pool(threads_count);
+
+    /* Submits the next complete request of the connection to the pool, or
+     * closes the connection if the peer is gone or broke the protocol.
+     * Returns true on "stop". */
+    const auto dispatch =
+            [&] (const int file_descriptor)
+            {
+                connection &connection_0 = connections.get(file_descriptor);
+                std::string request;
+                try
+                {
+                    if (!extract_frame(connection_0.buffer, request))
+                    {
+                        if (connection_0.peer_closed)
+                            connections.remove(file_descriptor);
+                        return false;
+                    }
+                    if (request == "stop")
+                    {
+                        write_frame(file_descriptor, "+stopping");
+                        return true;
+                    }
+                }
+                catch (const std::runtime_error &)
+                {
+                    connections.remove(file_descriptor);
+                    return false;
+                }
+                connection_0.busy = true;
+                pool.submit(
+                            [&database, &users, &finished, file_descriptor,
+                             request = std::move(request)] ()
+                            {
+                                std::string response(1, '+');
+                                if (
+                                        !answer_query(
+                                            database,
+                                            users,
+                                            request,
+                                            response))
+                                    response[0] = '-';
+                                bool succeeded = true;
+                                try
+                                {
+                                    write_frame(file_descriptor, response);
+                                }
+                                catch (const std::runtime_error &)
+                                {
+                                    succeeded = false;
+                                }
+                                finished.add(file_descriptor, succeeded);
+                            });
+                return false;
+            };
+
+    bool stopping = false;
+    std::vector<pollfd> descriptors;
+    while (!stopping)
+    {
+        descriptors.clear();
+        descriptors.push_back(
+                    pollfd{socket_0.get_file_descriptor(), POLLIN, 0});
+        descriptors.push_back(
+                    pollfd{finished.get_file_descriptor(), POLLIN, 0});
+        for (const auto &entry : connections.get_all())
+            if (!entry.second.busy)
+                descriptors.push_back(pollfd{entry.first, POLLIN, 0});
+        if (::poll(descriptors.data(), descriptors.size(), -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw system_error("polling sockets failed");
+        }
+
+        for (const auto &entry : finished.take())
+        {
+            connections.get(entry.first).busy = false;
+            if (!entry.second)
+                connections.remove(entry.first);
+            else
+                stopping = dispatch(entry.first) || stopping;
+        }
+
+        for (std::size_t i = 2; i < descriptors.size() && !stopping; ++i)
+        {
+            if (descriptors[i].revents == 0)
+                continue;
+            const int file_descriptor = descriptors[i].fd;
+            connection &connection_0 = connections.get(file_descriptor);
+            try
+            {
+                if (!receive_available(file_descriptor, connection_0.buffer))
+                    connection_0.peer_closed = true;
+            }
+            catch (const std::runtime_error &)
+            {
+                connections.remove(file_descriptor);
+                continue;
+            }
+            stopping = dispatch(file_descriptor);
+        }
+
+        if (descriptors[0].revents != 0 && !stopping)
+        {
+            const int connection_0 =
+                    ::accept4(
+                        socket_0.get_file_descriptor(),
+                        nullptr,
+                        nullptr,
+                        SOCK_CLOEXEC);
+            if (connection_0 >= 0)
+                connections.add(connection_0);
+            else if (errno != EINTR && errno != ECONNABORTED)
+                throw system_error("accepting connection failed");
+        }
+    }
+    pool.wait();
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef QUERY_SERVER_H
+#define QUERY_SERVER_H
+
+#include "metamath_database.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace metamath_playground {
+
+/* Theorems referring to each assertion in their proofs. */
+class assertion_users
+{
+private:
+    std::vector<std::vector<assertion_index>> users;
+
+public:
+    explicit assertion_users(const metamath_database &database);
+
+    /* Theorems in database order, each listed once. */
+    const std::vector<assertion_index> &get_users(
+            assertion_index assertion_index_0) const;
+};
+
+/* Writes hypotheses, disjoint variable restrictions and the statement of the
+ * assertion in source syntax, one per line. Lines of hypotheses and
+ * restrictions start with prefix. */
+void write_assertion_statement(
+        const metamath_database &database,
+        const assertion &assertion_0,
+        std::ostream &output_stream,
+        const std::string &prefix = "");
+
+/* Answers a single request of the query protocol:
+ * - "find label": type and number of the assertion,
+ * - "statement label": as written by write_assertion_statement,
+ * - "users label": labels of theorems using the assertion, one per line,
+ * - "verify label": "valid" or the verification error.
+ * Returns false, with the error in the response, for malformed requests and
+ * unknown labels. */
+bool answer_query(
+        const metamath_database &database,
+        const assertion_users &users,
+        const std::string &request,
+        std::string &response);
+
+/* Serves queries on a Unix domain socket at socket_path until a "stop"
+ * request arrives. Both requests and responses are frames of a 4 byte
+ * big-endian length followed by that many bytes. A response starts with '+'
+ * on success or '-' on failure. The calling thread polls the connections,
+ * requests are answered by a pool of threads_count threads, 0 meaning one
+ * per hardware thread. Requests of a connection are answered in order, idle
+ * connections occupy no thread. */
+void serve_queries(
+        const metamath_database &database,
+        const std::string &socket_path,
+        unsigned threads_count = 0);
+
+} /* namespace metamath_playground */
+
+#endif /* QUERY_SERVER_H */
@@ -0,0 +1,248 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "scope_groups.h"
+#include "variable_marks.h"
+
+#include <algorithm>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+/* Checking all members after each change of the shared statements is
+ * quadratic in the size of the group, so groups are limited. */
+const index maximal_group_size = 256;
+/*----------------------------------------------------------------------------*/
+bool have_same_essential_hypotheses(
+        const assertion &assertion_0,
+        const scope_group &group)
+{
+    return std::equal(
+                assertion_0.essential_hypotheses.begin(),
+                assertion_0.essential_hypotheses.end(),
+                group.essential_hypotheses.begin(),
+                group.essential_hypotheses.end(),
+                [] (
+                    const essential_hypothesis &lhs,
+                    const essential_hypothesis &rhs)
+                {
+                    return lhs.expression_0 == rhs.expression_0;
+                });
+}
+/*----------------------------------------------------------------------------*/
+class group_checker
+{
+private:
+    variable_marks mandatory_variables;
+    variable_marks proof_variables;
+
+public:
+    /* Simulates reading the assertion in the scope of the group. */
+    bool is_read_back_unchanged(
+            const assertion &assertion_0,
+            const scope_group &group);
+};
+/*----------------------------------------------------------------------------*/
+bool group_checker::is_read_back_unchanged(
+        const assertion &assertion_0,
+        const scope_group &group)
+{
+    mandatory_variables.clear();
+    for (const auto &hypothesis : assertion_0.essential_hypotheses)
+        mandatory_variables.mark(hypothesis.expression_0);
+    mandatory_variables.mark(assertion_0.expression_0);
+
+    auto expected_floating = assertion_0.floating_hypotheses.begin();
+    for (const auto &hypothesis : group.floating_hypotheses)
+    {
+        if (!mandatory_variables.is_marked(hypothesis.variable))
+            continue;
+        if (
+                expected_floating == assertion_0.floating_hypotheses.end()
+                || expected_floating->type != hypothesis.type
+                || expected_floating->variable != hypothesis.variable)
+            return false;
+        ++expected_floating;
+    }
+    if (expected_floating != assertion_0.floating_hypotheses.end())
+        return false;
+
+    auto expected_restriction =
+            assertion_0.disjoint_variable_restrictions.begin();
+    for (const auto &restriction : group.disjoint_variable_restrictions)
+    {
+        if (
+                !mandatory_variables.is_marked(restriction[0])
+                || !mandatory_variables.is_marked(restriction[1]))
+            continue;
+        if (
+                expected_restriction
+                    == assertion_0.disjoint_variable_restrictions.end()
+                || *expected_restriction != restriction)
+            return false;
+        ++expected_restriction;
+    }
+    if (
+            expected_restriction
+            != assertion_0.disjoint_variable_restrictions.end())
+        return false;
+
+    /* Variables of non-mandatory hypotheses are declared in the own scope of
+     * the assertion and must not be touched by the shared statements. */
+    proof_variables.clear();
+    for (const auto &hypothesis : assertion_0.proof_0.floating_hypotheses)
+        proof_variables.mark(hypothesis.variable);
+    for (const auto &hypothesis : group.floating_hypotheses)
+        if (proof_variables.is_marked(hypothesis.variable))
+            return false;
+    for (const auto &restriction : group.disjoint_variable_restrictions)
+        if (
+                proof_variables.is_marked(restriction[0])
+                || proof_variables.is_marked(restriction[1]))
+            return false;
+
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+scope_group make_group(const assertion &assertion_0, const index begin)
+{
+    return scope_group{
+                begin,
+                begin + 1,
+                assertion_0.floating_hypotheses,
+                assertion_0.essential_hypotheses,
+                assertion_0.disjoint_variable_restrictions};
+}
+/*----------------------------------------------------------------------------*/
+/* Returns false if the assertion needs a variable with another type. */
+bool add_statements(const assertion &assertion_0, scope_group &group)
+{
+    for (const auto &hypothesis : assertion_0.floating_hypotheses)
+    {
+        const auto found =
+                std::find_if(
+                    group.floating_hypotheses.begin(),
+                    group.floating_hypotheses.end(),
+                    [&] (const floating_hypothesis &other)
+                    {
+                        return other.variable == hypothesis.variable;
+                    });
+        if (found == group.floating_hypotheses.end())
+            group.floating_hypotheses.push_back(hypothesis);
+        else if (found->type != hypothesis.type)
+            return false;
+    }
+    for (const auto &restriction : assertion_0.disjoint_variable_restrictions)
+        if (
+                std::find(
+                    group.disjoint_variable_restrictions.begin(),
+                    group.disjoint_variable_restrictions.end(),
+                    restriction)
+                == group.disjoint_variable_restrictions.end())
+            group.disjoint_variable_restrictions.push_back(restriction);
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+void drop_shared_statements(scope_group &group)
+{
+    group.floating_hypotheses.clear();
+    group.essential_hypotheses.clear();
+    group.disjoint_variable_restrictions.clear();
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+std::vector<scope_group> find_scope_groups(const metamath_database &database)
+{
+    const index assertions_count = (*database.assertions_end()).get_index();
+    std::vector<scope_group> groups;
+    if (assertions_count == 0)
+        return groups;
+
+    group_checker checker;
+    const auto get_assertion =
+            [&] (const index i) -> const assertion &
+            {
+                return database.get_assertion(assertion_index(i));
+            };
+
+    const auto close_group =
+            [&] (scope_group &&group)
+            {
+                if (group.end - group.begin == 1)
+                    drop_shared_statements(group);
+                groups.push_back(std::move(group));
+            };
+
+    scope_group group = make_group(get_assertion(0), 0);
+    for (index i = 1; i < assertions_count; ++i)
+    {
+        const assertion &assertion_0 = get_assertion(i);
+
+        bool accepted =
+                group.end - group.begin < maximal_group_size
+                && have_same_essential_hypotheses(assertion_0, group);
+        scope_group extended;
+        if (accepted)
+        {
+            extended.floating_hypotheses = group.floating_hypotheses;
+            extended.disjoint_variable_restrictions =
+                    group.disjoint_variable_restrictions;
+            accepted = add_statements(assertion_0, extended);
+        }
+        if (accepted)
+        {
+            const bool statements_added =
+                    extended.floating_hypotheses.size()
+                        != group.floating_hypotheses.size()
+                    || extended.disjoint_variable_restrictions.size()
+                        != group.disjoint_variable_restrictions.size();
+            extended.begin = group.begin;
+            extended.end = i + 1;
+            extended.essential_hypotheses =
+                    std::move(group.essential_hypotheses);
+
+            /* Earlier members are affected only by new statements. */
+            for (
+                    index j = statements_added ? group.begin : i;
+                    accepted && j <= i;
+                    ++j)
+                accepted =
+                        checker.is_read_back_unchanged(
+                            get_assertion(j),
+                            extended);
+
+            if (accepted)
+            {
+                group = std::move(extended);
+                continue;
+            }
+            group.essential_hypotheses =
+                    std::move(extended.essential_hypotheses);
+        }
+
+        close_group(std::move(group));
+        group = make_group(assertion_0, i);
+    }
+    close_group(std::move(group));
+    return groups;
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
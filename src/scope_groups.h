@@ -0,0 +1,51 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SCOPE_GROUPS_H
+#define SCOPE_GROUPS_H
+
+#include "metamath_database.h"
+
+#include <vector>
+
+namespace metamath_playground {
+
+/* Consecutive assertions [begin, end), which can be written in a single
+ * scope declaring their hypotheses and disjoint variable restrictions once.
+ * Groups of a single assertion have no shared statements and are written as
+ * usual. */
+struct scope_group
+{
+    index begin;
+    index end;
+    std::vector<floating_hypothesis> floating_hypotheses;
+    std::vector<essential_hypothesis> essential_hypotheses;
+    std::vector<disjoint_variable_restriction> disjoint_variable_restrictions;
+};
+
+/* Splits all assertions of the database into groups. Members of a group have
+ * the same essential hypotheses. Reading the shared scope back gives each
+ * member exactly its frame, in the same order, and does not change the
+ * restrictions of its proof, so the database read back is equivalent up to
+ * labels of hypotheses. */
+std::vector<scope_group> find_scope_groups(const metamath_database &database);
+
+} /* namespace metamath_playground */
+
+#endif /* SCOPE_GROUPS_H */
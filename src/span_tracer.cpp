@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "span_tracer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+std::atomic<bool> tracing_enabled{false};
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+struct trace_event
+{
+    const char *name;
+    std::int64_t begin;
+    std::int64_t end;
+};
+/*----------------------------------------------------------------------------*/
+/* Ring buffer of a single thread. It is kept after the thread ends, so the
+ * trace can be written after worker threads are joined. */
+struct thread_trace
+{
+    index thread_number;
+    std::vector<trace_event> events;
+    /* position of the next event, the oldest one once the buffer is full */
+    index next = 0;
+};
+/*----------------------------------------------------------------------------*/
+std::mutex traces_mutex;
+std::vector<std::shared_ptr<thread_trace>> traces;
+std::atomic<index> trace_capacity{0};
+std::chrono::steady_clock::time_point trace_epoch;
+/*----------------------------------------------------------------------------*/
+thread_trace &get_thread_trace()
+{
+    thread_local std::shared_ptr<thread_trace> current;
+    if (current == nullptr)
+    {
+        current = std::make_shared<thread_trace>();
+        current->events.reserve(trace_capacity.load());
+        const std::lock_guard<std::mutex> lock(traces_mutex);
+        current->thread_number = traces.size();
+        traces.push_back(current);
+    }
+    return *current;
+}
+/*----------------------------------------------------------------------------*/
+} /* anonymous namespace */
+/*----------------------------------------------------------------------------*/
+void enable_tracing(const index events_per_thread)
+{
+    {
+        const std::lock_guard<std::mutex> lock(traces_mutex);
+        trace_epoch = std::chrono::steady_clock::now();
+        trace_capacity = std::max<index>(events_per_thread, 1);
+    }
+    tracing_enabled = true;
+}
+/*----------------------------------------------------------------------------*/
+std::int64_t get_trace_time()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - trace_epoch).count();
+}
+/*----------------------------------------------------------------------------*/
+void record_span(
+        const char *const name,
+        const std::int64_t begin,
+        const std::int64_t end)
+{
+    thread_trace &trace = get_thread_trace();
+    const index capacity = trace_capacity.load(std::memory_order_relaxed);
+    const trace_event event{name, begin, end};
+    if (static_cast<index>(trace.events.size()) < capacity)
+    {
+        trace.events.push_back(event);
+        return;
+    }
+    trace.events[trace.next] = event;
+    trace.next = (trace.next + 1) % capacity;
+}
+/*----------------------------------------------------------------------------*/
+void write_chrome_trace(std::ostream &output_stream)
+{
+    const std::lock_guard<std::mutex> lock(traces_mutex);
+    output_stream << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+    bool first = true;
+    char buffer[256];
+    for (const auto &trace : traces)
+    {
+        const index events_count = trace->events.size();
+        for (index i = 0; i < events_count; ++i)
+        {
+            const trace_event &event =
+                    trace->events[(trace->next + i) % events_count];
+            /* timestamps are in microseconds */
+            std::snprintf(
+                        buffer,
+                        sizeof(buffer),
+                        "\"ph\": \"X\", \"pid\": 1, \"tid\": %lld, "
+                        "\"ts\": %.3f, \"dur\": %.3f}",
+                        static_cast<long long>(trace->thread_number),
+                        event.begin / 1000.0,
+                        (event.end - event.begin) / 1000.0);
+            output_stream
+                    << (first ? "\n" : ",\n")
+                    << "{\"name\": \"" << event.name << "\", " << buffer;
+            first = false;
+        }
+    }
+    output_stream << "\n]}\n";
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SPAN_TRACER_H
+#define SPAN_TRACER_H
+
+#include "typed_indices.h"
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+
+namespace metamath_playground {
+
+/* Named time intervals recorded per thread, to be inspected in a trace viewer
+ * (chrome://tracing, ui.perfetto.dev). Each thread keeps its last events in a
+ * ring buffer. While tracing is disabled a span costs a single relaxed atomic
+ * load. */
+
+extern std::atomic<bool> tracing_enabled;
+
+/* Starts recording, keeping up to events_per_thread last spans of each
+ * thread. */
+void enable_tracing(index events_per_thread = index(1) << 20);
+
+/* Nanoseconds since tracing was enabled. */
+std::int64_t get_trace_time();
+
+void record_span(const char *name, std::int64_t begin, std::int64_t end);
+
+/* Records the lifetime of the object. name must be a string literal or
+ * otherwise outlive the trace. */
+class trace_span
+{
+private:
+    const char *name;
+    std::int64_t begin = -1;
+
+public:
+    explicit trace_span(const char *name_in):
+        name(name_in)
+    {
+        if (tracing_enabled.load(std::memory_order_relaxed))
+            begin = get_trace_time();
+    }
+
+    trace_span(const trace_span &) = delete;
+    trace_span &operator=(const trace_span &) = delete;
+
+    ~trace_span()
+    {
+        if (begin >= 0)
+            record_span(name, begin, get_trace_time());
+    }
+};
+
+/* Writes spans of all threads in Chrome trace-event JSON format. Must not be
+ * called while other threads record spans. */
+void write_chrome_trace(std::ostream &output_stream);
+
+} /* namespace metamath_playground */
+
+#endif /* SPAN_TRACER_H */
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "subproof_table.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+subproof_table::subproof_table(const proof_tree &tree_in)
+{
+    assign(tree_in);
+}
+/*----------------------------------------------------------------------------*/
+void subproof_table::assign(const proof_tree &tree_in)
+{
+    tree = &tree_in;
+    node_subproofs.resize(tree->size());
+    representatives.clear();
+    hashes.clear();
+
+    /* at most half of the slots are used */
+    int slot_bits = 1;
+    while ((index(1) << slot_bits) < 2 * tree->size())
+        ++slot_bits;
+    slots.assign(std::size_t(1) << slot_bits, -1);
+    const std::size_t slot_mask = slots.size() - 1;
+    const auto get_slot =
+            [slot_bits] (const std::size_t hash) -> std::size_t
+            {
+                return
+                        (std::uint64_t(hash) * 0x9e3779b97f4a7c15)
+                        >> (64 - slot_bits);
+            };
+
+    for (const index node : tree->post_order())
+    {
+        const proof_step &step = tree->get_step(node);
+
+        if (step.type == proof_step::type_t::recall)
+        {
+            if (step.index_0 < 0 || step.index_0 >= node)
+                throw std::runtime_error(
+                        "recall step does not refer backwards");
+            node_subproofs[node] = node_subproofs[step.index_0];
+            continue;
+        }
+
+        if (step.type == proof_step::type_t::unknown)
+        {
+            node_subproofs[node] = size();
+            representatives.push_back(node);
+            hashes.push_back(0);
+            continue;
+        }
+
+        const auto children = tree->get_children(node);
+        std::size_t hash =
+                std::hash<index>()(static_cast<index>(step.type))
+                ^ (std::hash<index>()(step.index_0) << 1);
+        for (const index child : children)
+            hash =
+                    hash * 1000003
+                    ^ std::hash<index>()(node_subproofs[child]);
+
+        const auto is_same =
+                [&] (const index subproof)
+                {
+                    const index other = representatives[subproof];
+                    const proof_step &other_step = tree->get_step(other);
+                    const auto other_children = tree->get_children(other);
+                    return
+                            hashes[subproof] == hash
+                            && other_step.type == step.type
+                            && other_step.index_0 == step.index_0
+                            && std::equal(
+                                children.begin(),
+                                children.end(),
+                                other_children.begin(),
+                                other_children.end(),
+                                [this] (const index lhs, const index rhs)
+                                {
+                                    return
+                                            node_subproofs[lhs]
+                                            == node_subproofs[rhs];
+                                });
+                };
+
+        index subproof = -1;
+        std::size_t slot = get_slot(hash);
+        for (; slots[slot] != -1; slot = (slot + 1) & slot_mask)
+        {
+            if (is_same(slots[slot]))
+            {
+                subproof = slots[slot];
+                break;
+            }
+        }
+        if (subproof == -1)
+        {
+            subproof = size();
+            representatives.push_back(node);
+            hashes.push_back(hash);
+            slots[slot] = subproof;
+        }
+        node_subproofs[node] = subproof;
+    }
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
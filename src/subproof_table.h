@@ -0,0 +1,87 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SUBPROOF_TABLE_H
+#define SUBPROOF_TABLE_H
+
+#include "proof_tree.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace metamath_playground {
+
+/* Identifies distinct subproofs of a single proof.
+ *
+ * Two nodes of the tree get the same subproof number if and only if their
+ * subtrees are identical, after replacing "recall" steps with the recalled
+ * subtrees. "unknown" steps are never identical to each other. Subproofs are
+ * numbered in post-order of their first occurrence, so children always have
+ * lower numbers than their parents and the whole proof has the highest
+ * number. */
+class subproof_table
+{
+private:
+    const proof_tree *tree = nullptr;
+    std::vector<index> node_subproofs;
+    /* For each subproof: first node (not a "recall" step) having it. */
+    std::vector<index> representatives;
+    /* hash of each subproof, "unknown" steps are not hashed */
+    std::vector<std::size_t> hashes;
+    /* open addressing hash table of subproofs, -1 for empty slots */
+    std::vector<index> slots;
+
+public:
+    subproof_table() = default;
+    explicit subproof_table(const proof_tree &tree_in);
+
+    /* Rebuilds the table for another tree, reusing its storage. The tree
+     * must outlive the table. */
+    void assign(const proof_tree &tree_in);
+
+    index size() const
+    {
+        return static_cast<index>(representatives.size());
+    }
+
+    index get_subproof(const index node) const
+    {
+        return node_subproofs[node];
+    }
+
+    index get_representative(const index subproof) const
+    {
+        return representatives[subproof];
+    }
+
+    const proof_step &get_step(const index subproof) const
+    {
+        return tree->get_step(representatives[subproof]);
+    }
+
+    /* Nodes of the representative's children; use get_subproof on them. */
+    proof_tree::node_range get_children(const index subproof) const
+    {
+        return tree->get_children(representatives[subproof]);
+    }
+};
+
+} /* namespace metamath_playground */
+
+#endif /* SUBPROOF_TABLE_H */
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+thread_pool::thread_pool(unsigned threads_count)
+{
+    if (threads_count == 0)
+        threads_count = std::max(1u, std::thread::hardware_concurrency());
+    workers.reserve(threads_count);
+    for (unsigned i = 0; i < threads_count; ++i)
+        workers.emplace_back([this] { run_worker(); });
+}
+/*----------------------------------------------------------------------------*/
+thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    task_available.notify_all();
+    for (auto &worker : workers)
+        worker.join();
+}
+/*----------------------------------------------------------------------------*/
+void thread_pool::submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+        ++pending_count;
+    }
+    task_available.notify_one();
+}
+/*----------------------------------------------------------------------------*/
+void thread_pool::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    all_done.wait(lock, [this] { return pending_count == 0; });
+    if (first_exception)
+    {
+        auto exception = first_exception;
+        first_exception = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+/*----------------------------------------------------------------------------*/
+void thread_pool::run_worker()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            task_available.wait(
+                        lock,
+                        [this] { return stopping || !tasks.empty(); });
+            if (tasks.empty())
+                return;
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+
+        std::exception_ptr exception;
+        try
+        {
+            task();
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (exception && !first_exception)
+            first_exception = exception;
+        if (--pending_count == 0)
+            all_done.notify_all();
+    }
+}
+/*----------------------------------------------------------------------------*/
+void parallel_for(
+        thread_pool &pool,
+        const index count,
+        const std::function<void(index)> &function)
+{
+    /* Small chunks balance the load, shared counter keeps it cheap. */
+    const index chunk_size =
+            std::max<index>(1, count / (pool.get_threads_count() * 16));
+    std::atomic<index> next{0};
+    for (index i = 0; i < pool.get_threads_count(); ++i)
+    {
+        pool.submit(
+                    [&]
+                    {
+                        while (true)
+                        {
+                            const index begin = next.fetch_add(chunk_size);
+                            if (begin >= count)
+                                return;
+                            const index end =
+                                    std::min(count, begin + chunk_size);
+                            for (index j = begin; j < end; ++j)
+                                function(j);
+                        }
+                    });
+    }
+    pool.wait();
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include "typed_indices.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace metamath_playground {
+
+/* Fixed set of worker threads executing submitted tasks. The first exception
+ * thrown by a task is rethrown from wait(). */
+class thread_pool
+{
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable task_available;
+    std::condition_variable all_done;
+    index pending_count = 0;
+    bool stopping = false;
+    std::exception_ptr first_exception;
+
+public:
+    /* 0 means one thread per hardware thread. */
+    explicit thread_pool(unsigned threads_count = 0);
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+    ~thread_pool();
+
+    index get_threads_count() const
+    {
+        return static_cast<index>(workers.size());
+    }
+
+    void submit(std::function<void()> task);
+    /* Waits until all submitted tasks are finished. */
+    void wait();
+
+private:
+    void run_worker();
+};
+
+/* Calls function(i) for each i in [0, count), distributing chunks of indices
+ * over the threads of the pool, and waits for completion. Must not be called
+ * from a task running in the same pool. */
+void parallel_for(
+        thread_pool &pool,
+        index count,
+        const std::function<void(index)> &function);
+
+} /* namespace metamath_playground */
+
+#endif /* THREAD_POOL_H */
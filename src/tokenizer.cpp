@@ -18,6 +18,8 @@
  * limitations under the License.
  */
 #include "tokenizer.h"
+#include "allocation_tracker.h"
+
 #include <stdexcept>
 
 namespace metamath_playground {
@@ -25,17 +27,20 @@ namespace metamath_playground {
 tokenizer::tokenizer(std::istream &input_stream_in) :
     input_stream(input_stream_in)
 {
-    input_stream >> next_token;
+    const allocation_phase_scope phase(allocation_phase::tokenize);
+    extract_next_token();
 }
 /*----------------------------------------------------------------------------*/
 std::string tokenizer::get_token()
 {
+    const allocation_phase_scope phase(allocation_phase::tokenize);
     if (next_token.empty())
     {
         throw std::runtime_error("requested a token from past the end of the"
             "stream");
     }
     std::string result(next_token);
+    consumed_offset = next_token_offset + next_token.size();
     extract_next_token();
     return result;
 }
@@ -47,9 +52,39 @@ const std::string &tokenizer::peek()
 /*----------------------------------------------------------------------------*/
 void tokenizer::extract_next_token()
 {
-    input_stream >> next_token;
-    if (!input_stream)
-        next_token.clear();
+    /* Reading directly from the buffer keeps track of offsets. */
+    next_token.clear();
+    std::streambuf *const buffer = input_stream.rdbuf();
+    if (buffer == nullptr)
+        return;
+
+    using traits = std::streambuf::traits_type;
+    const auto is_space =
+            [] (const traits::int_type character)
+            {
+                return
+                        character == ' ' || character == '\t'
+                        || character == '\n' || character == '\r'
+                        || character == '\f' || character == '\v';
+            };
+
+    traits::int_type character = buffer->sgetc();
+    while (
+            !traits::eq_int_type(character, traits::eof())
+            && is_space(character))
+    {
+        ++stream_offset;
+        character = buffer->snextc();
+    }
+    next_token_offset = stream_offset;
+    while (
+            !traits::eq_int_type(character, traits::eof())
+            && !is_space(character))
+    {
+        next_token.push_back(traits::to_char_type(character));
+        ++stream_offset;
+        character = buffer->snextc();
+    }
 }
 /*----------------------------------------------------------------------------*/
 } /* namespace metamath_playground */
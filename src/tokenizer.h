@@ -20,7 +20,10 @@
 #ifndef TOKENIZER_H
 #define TOKENIZER_H
 
+#include "typed_indices.h"
+
 #include <iostream>
+#include <string>
 
 namespace metamath_playground {
 
@@ -29,12 +32,28 @@ class tokenizer
 private:
     std::istream &input_stream;
     std::string next_token;
+    /* byte offsets in the stream, counted from the tokenizer's creation */
+    index next_token_offset = 0;
+    index consumed_offset = 0;
+    index stream_offset = 0;
 
 public:
     tokenizer(std::istream &input_stream);
     std::string get_token();
     const std::string &peek();
 
+    /* Offset of the first character of the token returned by peek(). */
+    index get_next_token_offset() const
+    {
+        return next_token_offset;
+    }
+
+    /* Offset just past the last token returned by get_token(). */
+    index get_consumed_offset() const
+    {
+        return consumed_offset;
+    }
+
 private:
     void extract_next_token();
 };
@@ -0,0 +1,313 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "unification_index.h"
+#include "span_tracer.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace metamath_playground {
+/*----------------------------------------------------------------------------*/
+/* Keys of a statement are its typecode and nodes of its tree in reverse
+ * order of steps, which is prefix order with children taken from the last
+ * one. Queries use the same order, so it does not matter for matching. */
+/*----------------------------------------------------------------------------*/
+unification_index::unification_index(
+        const metamath_database &database,
+        const unsigned threads_count):
+    grammar_0(database)
+{
+    const trace_span span("build_unification_index");
+    const index assertions_count = (*database.assertions_end()).get_index();
+    const parse_tree_cache *const cached = database.get_parse_trees();
+    std::vector<parse_tree> trees(cached == nullptr ? assertions_count : 0);
+    std::vector<bool> parsed(assertions_count);
+    if (cached != nullptr)
+    {
+        for (index i = 0; i < assertions_count; ++i)
+            parsed[i] = cached->is_parsed(assertion_index(i));
+    }
+    else
+    {
+        /* vector<bool> elements share words, so flags are set afterwards */
+        thread_pool pool(threads_count);
+        parallel_for(
+                    pool,
+                    assertions_count,
+                    [&] (const index i)
+                    {
+                        const assertion &assertion_0 =
+                                database.get_assertion(assertion_index(i));
+                        try
+                        {
+                            trees[i] =
+                                    parse_expression(
+                                        grammar_0,
+                                        assertion_0.expression_0,
+                                        assertion_0.floating_hypotheses);
+                        }
+                        catch (const std::runtime_error &)
+                        {
+                        }
+                    });
+        for (index i = 0; i < assertions_count; ++i)
+            parsed[i] = !trees[i].empty();
+    }
+
+    arities.reserve(assertions_count);
+    for (index i = 0; i < assertions_count; ++i)
+    {
+        const assertion_index assertion_index_0(i);
+        const assertion &assertion_0 =
+                database.get_assertion(assertion_index_0);
+        arities.push_back(assertion_0.floating_hypotheses.size());
+        if (!parsed[i])
+            unparsed.push_back(assertion_index_0);
+        else if (cached != nullptr)
+            insert(
+                        assertion_0.expression_0[0],
+                        cached->get_expression_tree(assertion_index_0),
+                        assertion_index_0);
+        else
+            insert(assertion_0.expression_0[0], trees[i], assertion_index_0);
+    }
+}
+/*----------------------------------------------------------------------------*/
+void unification_index::add_assertion(
+        const metamath_database &database,
+        const assertion_index assertion_index_0)
+{
+    if (assertion_index_0.get_index() != static_cast<index>(arities.size()))
+        throw std::runtime_error("assertions must be indexed in order");
+    const assertion &assertion_0 = database.get_assertion(assertion_index_0);
+    arities.push_back(assertion_0.floating_hypotheses.size());
+    try
+    {
+        grammar_0.add_assertion(database, assertion_index_0);
+        const parse_tree tree =
+                parse_expression(
+                    grammar_0,
+                    assertion_0.expression_0,
+                    assertion_0.floating_hypotheses);
+        insert(assertion_0.expression_0[0], tree, assertion_index_0);
+    }
+    catch (const std::runtime_error &)
+    {
+        unparsed.push_back(assertion_index_0);
+    }
+}
+/*----------------------------------------------------------------------------*/
+void unification_index::find_candidates(
+        const symbol_index typecode,
+        const std::span<const parse_node> goal,
+        const std::vector<index> &metavariables,
+        std::vector<assertion_index> &candidates) const
+{
+    const index first_candidate = candidates.size();
+    candidates.insert(candidates.end(), unparsed.begin(), unparsed.end());
+    const index start = find_child(0, typecode.second);
+    if (start == -1 || goal.empty())
+        return;
+
+    /* sizes[q] is the size of the subtree at position q of the keys */
+    const index goal_size = goal.size();
+    std::vector<index> sizes(goal_size);
+    std::vector<index> stack;
+    for (index i = 0; i < goal_size; ++i)
+    {
+        index size = 1;
+        const index arity =
+                goal[i].type == parse_node::type_t::variable
+                ? 0
+                : arities[goal[i].index_0];
+        for (index j = 0; j < arity; ++j)
+        {
+            size += stack.back();
+            stack.pop_back();
+        }
+        stack.push_back(size);
+        sizes[goal_size - 1 - i] = size;
+    }
+
+    const auto match =
+            [&] (const auto &self, const index node_index, const index position)
+                -> void
+            {
+                if (position == goal_size)
+                {
+                    const index leaf = nodes[node_index].leaf;
+                    if (leaf != -1)
+                        candidates.insert(
+                                    candidates.end(),
+                                    leaves[leaf].begin(),
+                                    leaves[leaf].end());
+                    return;
+                }
+                const parse_node &goal_node = goal[goal_size - 1 - position];
+                const index after = position + sizes[position];
+                if (
+                        goal_node.type == parse_node::type_t::variable
+                        && std::find(
+                            metavariables.begin(),
+                            metavariables.end(),
+                            goal_node.index_0) != metavariables.end())
+                {
+                    /* a metavariable matches any indexed term */
+                    const auto on_end =
+                            [&] (const index end_node)
+                            {
+                                self(self, end_node, after);
+                            };
+                    skip_term(node_index, 1, on_end);
+                    return;
+                }
+                const index any = find_child(node_index, wildcard);
+                if (any != -1)
+                    self(self, any, after);
+                if (goal_node.type == parse_node::type_t::syntax_axiom)
+                {
+                    const index child =
+                            find_child(node_index, goal_node.index_0);
+                    if (child != -1)
+                        self(self, child, position + 1);
+                }
+            };
+    match(match, start, 0);
+    std::sort(
+                candidates.begin() + first_candidate,
+                candidates.end(),
+                [] (const assertion_index lhs, const assertion_index rhs)
+                {
+                    return lhs.get_index() < rhs.get_index();
+                });
+}
+/*----------------------------------------------------------------------------*/
+std::vector<assertion_index> unification_index::find_candidates(
+        const expression &goal,
+        const std::vector<floating_hypothesis> &floating_hypotheses,
+        const std::vector<index> &metavariables) const
+{
+    const parse_tree tree =
+            parse_expression(grammar_0, goal, floating_hypotheses);
+    std::vector<assertion_index> candidates;
+    find_candidates(goal[0], tree, metavariables, candidates);
+    return candidates;
+}
+/*----------------------------------------------------------------------------*/
+std::size_t unification_index::memory_usage() const
+{
+    std::size_t result =
+            nodes.capacity() * sizeof(node)
+            + leaves.capacity() * sizeof(leaves[0])
+            + unparsed.capacity() * sizeof(assertion_index)
+            + arities.capacity() * sizeof(index);
+    for (const auto &node_0 : nodes)
+        result += node_0.edges.capacity() * sizeof(edge);
+    for (const auto &leaf : leaves)
+        result += leaf.capacity() * sizeof(assertion_index);
+    return result;
+}
+/*----------------------------------------------------------------------------*/
+void unification_index::insert(
+        const symbol_index typecode,
+        const std::span<const parse_node> tree,
+        const assertion_index assertion_index_0)
+{
+    index node_index = 0;
+    const auto descend =
+            [this, &node_index] (const index key)
+            {
+                auto &edges = nodes[node_index].edges;
+                const auto found =
+                        std::lower_bound(
+                            edges.begin(),
+                            edges.end(),
+                            key,
+                            [] (const edge &edge_0, const index key_0)
+                            {
+                                return edge_0.key < key_0;
+                            });
+                if (found != edges.end() && found->key == key)
+                {
+                    node_index = found->child;
+                    return;
+                }
+                const index child = nodes.size();
+                edges.insert(found, edge{key, child});
+                /* invalidates edges */
+                nodes.emplace_back();
+                node_index = child;
+            };
+
+    descend(typecode.second);
+    for (auto node_0 = tree.rbegin(); node_0 != tree.rend(); ++node_0)
+        descend(
+                    node_0->type == parse_node::type_t::variable
+                    ? wildcard
+                    : node_0->index_0);
+    if (nodes[node_index].leaf == -1)
+    {
+        nodes[node_index].leaf = leaves.size();
+        leaves.emplace_back();
+    }
+    leaves[nodes[node_index].leaf].push_back(assertion_index_0);
+}
+/*----------------------------------------------------------------------------*/
+index unification_index::get_arity(const index key) const
+{
+    return key == wildcard ? 0 : arities[key];
+}
+/*----------------------------------------------------------------------------*/
+index unification_index::find_child(
+        const index node_index,
+        const index key) const
+{
+    const auto &edges = nodes[node_index].edges;
+    const auto found =
+            std::lower_bound(
+                edges.begin(),
+                edges.end(),
+                key,
+                [] (const edge &edge_0, const index key_0)
+                {
+                    return edge_0.key < key_0;
+                });
+    if (found == edges.end() || found->key != key)
+        return -1;
+    return found->child;
+}
+/*----------------------------------------------------------------------------*/
+template<typename function_t>
+void unification_index::skip_term(
+        const index node_index,
+        const index pending,
+        function_t &on_end) const
+{
+    if (pending == 0)
+    {
+        on_end(node_index);
+        return;
+    }
+    for (const auto &edge_0 : nodes[node_index].edges)
+        skip_term(edge_0.child, pending - 1 + get_arity(edge_0.key), on_end);
+}
+/*----------------------------------------------------------------------------*/
+} /* namespace metamath_playground */
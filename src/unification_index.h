@@ -0,0 +1,122 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UNIFICATION_INDEX_H
+#define UNIFICATION_INDEX_H
+
+#include "expression_parser.h"
+
+#include <span>
+#include <vector>
+
+namespace metamath_playground {
+
+/* Discrimination tree over parse trees of statements of assertions. Each
+ * statement is a path of keys: its typecode followed by nodes of the tree in
+ * prefix order, where variables, which may be substituted by any subtree,
+ * are a common wildcard key.
+ *
+ * A query returns a superset of assertions whose statement unifies with the
+ * goal: repeated variables are not checked. Statements which do not parse
+ * are returned by every query. */
+class unification_index
+{
+private:
+    struct edge
+    {
+        index key;
+        index child;
+    };
+
+    struct node
+    {
+        /* sorted by key */
+        std::vector<edge> edges;
+        /* in leaves, -1 for inner nodes */
+        index leaf = -1;
+    };
+
+    grammar grammar_0;
+    std::vector<node> nodes{1};
+    std::vector<std::vector<assertion_index>> leaves;
+    std::vector<assertion_index> unparsed;
+    /* number of floating hypotheses of each assertion */
+    std::vector<index> arities;
+
+public:
+    /* key of variables of indexed statements */
+    static constexpr index wildcard = -1;
+
+    unification_index() = default;
+    /* Parses statements of the database in parallel, threads_count 0 means
+     * one thread per hardware thread. */
+    explicit unification_index(
+            const metamath_database &database,
+            unsigned threads_count = 0);
+
+    /* Indexes the next assertion of the database. Syntax axioms extend the
+     * grammar for the following assertions. */
+    void add_assertion(
+            const metamath_database &database,
+            assertion_index assertion_index_0);
+
+    const grammar &get_grammar() const
+    {
+        return grammar_0;
+    }
+
+    /* Appends to candidates assertions whose statement may be unified with
+     * the goal of given typecode. Variables of the goal listed in
+     * metavariables may be substituted, other variables match only variables
+     * of the indexed statements. */
+    void find_candidates(
+            symbol_index typecode,
+            std::span<const parse_node> goal,
+            const std::vector<index> &metavariables,
+            std::vector<assertion_index> &candidates) const;
+
+    /* As above for an expression, typed by the floating hypotheses. Throws
+     * std::runtime_error if the goal does not parse. */
+    std::vector<assertion_index> find_candidates(
+            const expression &goal,
+            const std::vector<floating_hypothesis> &floating_hypotheses,
+            const std::vector<index> &metavariables) const;
+
+    /* Bytes of heap memory held, without the grammar. */
+    std::size_t memory_usage() const;
+
+private:
+    void insert(
+            symbol_index typecode,
+            std::span<const parse_node> tree,
+            assertion_index assertion_index_0);
+    index get_arity(index key) const;
+    index find_child(index node_index, index key) const;
+    /* Calls on_end for each node reached by skipping one term from the
+     * node. */
+    template<typename function_t>
+    void skip_term(
+            index node_index,
+            index pending,
+            function_t &on_end) const;
+};
+
+} /* namespace metamath_playground */
+
+#endif /* UNIFICATION_INDEX_H */
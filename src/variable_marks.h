@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 Dominik Wójt
+ *
+ * This file is part of metamath_playground.
+ *
+ * SPDX-License-Identifier: MIT OR Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef VARIABLE_MARKS_H
+#define VARIABLE_MARKS_H
+
+#include "metamath_database.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace metamath_playground {
+
+/* Set of variables, cleared in O(1) by bumping the generation, so that it can
+ * be reused for every assertion without allocation. */
+class variable_marks
+{
+private:
+    std::vector<std::uint32_t> generations;
+    std::uint32_t current_generation = 1;
+
+public:
+    void clear()
+    {
+        if (++current_generation == 0)
+        {
+            std::fill(generations.begin(), generations.end(), 0);
+            current_generation = 1;
+        }
+    }
+
+    void mark(const symbol_index variable)
+    {
+        const auto variable_number =
+                static_cast<std::size_t>(variable.second);
+        if (variable_number >= generations.size())
+            generations.resize(variable_number + 1, 0);
+        generations[variable_number] = current_generation;
+    }
+
+    void mark(const expression &expression_0)
+    {
+        for (const auto &symbol : expression_0)
+            if (symbol.first == symbol::type_t::variable)
+                mark(symbol);
+    }
+
+    bool is_marked(const symbol_index variable) const
+    {
+        const auto variable_number =
+                static_cast<std::size_t>(variable.second);
+        return
+                variable_number < generations.size()
+                && generations[variable_number] == current_generation;
+    }
+};
+
+} /* namespace metamath_playground */
+
+#endif /* VARIABLE_MARKS_H */